@@ -1,7 +1,18 @@
 
 
+# target_static_resource(<target> [COMPRESS] <file>...)
+#
+# Embed files in the executable, with COMPRESS the files are zlib compressed
+# and decompressed on first access.
 function(target_static_resource TARGET)
-    foreach(SOURCE_FILE IN LISTS ARGN)
+    cmake_parse_arguments(PARSE_ARGV 1 STATIC_RESOURCE "COMPRESS" "" "")
+
+    set(EMBED_OPTIONS)
+    if(STATIC_RESOURCE_COMPRESS)
+        set(EMBED_OPTIONS --compress)
+    endif()
+
+    foreach(SOURCE_FILE IN LISTS STATIC_RESOURCE_UNPARSED_ARGUMENTS)
         get_filename_component(INPUT_PATH "${SOURCE_FILE}" ABSOLUTE)
         get_filename_component(INPUT_FILENAME "${SOURCE_FILE}" NAME)
         get_relative_path(INPUT_RELPATH "${INPUT_PATH}")
@@ -17,7 +28,7 @@ function(target_static_resource TARGET)
 
 	    add_custom_command(
 		    OUTPUT "${OUTPUT_PATH}"
-		    COMMAND embed_static_resource "${INPUT_PATH}" "${OUTPUT_PATH}"
+		    COMMAND embed_static_resource ${EMBED_OPTIONS} "${INPUT_PATH}" "${OUTPUT_PATH}"
 		    DEPENDS "${INPUT_PATH}" embed_static_resource
 		    VERBATIM
 	    )
@@ -0,0 +1,24 @@
+
+
+function(target_translation_catalog TARGET)
+    foreach(SOURCE_FILE IN LISTS ARGN)
+        get_filename_component(INPUT_PATH "${SOURCE_FILE}" ABSOLUTE)
+        get_filename_component(INPUT_NAME "${SOURCE_FILE}" NAME_WE)
+
+        # The catalog is loaded by language from "resource:locale/<language-tag>.tcat".
+        set(OUTPUT_PATH "${CMAKE_CURRENT_BINARY_DIR}/locale/${INPUT_NAME}.tcat")
+
+        # Create the output directory.
+        get_filename_component(OUTPUT_DIR "${OUTPUT_PATH}" DIRECTORY)
+        file(MAKE_DIRECTORY "${OUTPUT_DIR}")
+
+	    add_custom_command(
+		    OUTPUT "${OUTPUT_PATH}"
+		    COMMAND compile_translation_catalog "${INPUT_PATH}" "${OUTPUT_PATH}"
+		    DEPENDS "${INPUT_PATH}" compile_translation_catalog
+		    VERBATIM
+	    )
+
+        target_static_resource(${TARGET} "${OUTPUT_PATH}")
+    endforeach()
+endfunction()
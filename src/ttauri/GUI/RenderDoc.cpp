@@ -14,23 +14,32 @@
 namespace tt {
 
 RenderDoc::RenderDoc() noexcept {
-#if TT_BUILD_TYPE == TT_BT_DEBUG
 #if TT_OPERATING_SYSTEM == TT_OS_WINDOWS
-    ttlet dll_urls = std::vector{
-        URL{"file:renderdoc.dll"},
-        URL{"file:///C:/Program%20Files/RenderDoc/renderdoc.dll"},
-        URL{"file:///C:/Program%20Files%20(x86)/RenderDoc/renderdoc.dll"}
-    };
-
-    HMODULE mod = nullptr;
-    for (ttlet &dll_url: dll_urls) {
-        tt_log_debug("Trying to load renderdoc.dll at: {}", dll_url.nativePath());
-        
-        if ((mod = LoadLibraryW(dll_url.nativeWPath().c_str()))) {
-            goto found_dll;
+    // When the application is launched from RenderDoc the library is already loaded,
+    // this allows slow frames to be captured in release builds.
+    HMODULE mod = GetModuleHandleW(L"renderdoc.dll");
+    if (mod) {
+        goto found_dll;
+    }
+
+#if TT_BUILD_TYPE == TT_BT_DEBUG
+    {
+        ttlet dll_urls = std::vector{
+            URL{"file:renderdoc.dll"},
+            URL{"file:///C:/Program%20Files/RenderDoc/renderdoc.dll"},
+            URL{"file:///C:/Program%20Files%20(x86)/RenderDoc/renderdoc.dll"}
+        };
+
+        for (ttlet &dll_url: dll_urls) {
+            tt_log_debug("Trying to load renderdoc.dll at: {}", dll_url.nativePath());
+
+            if ((mod = LoadLibraryW(dll_url.nativeWPath().c_str()))) {
+                goto found_dll;
+            }
         }
+        tt_log_warning("Could not load renderdoc.dll");
     }
-    tt_log_warning("Could not load renderdoc.dll");
+#endif
     return;
 
 found_dll:
@@ -58,7 +67,6 @@ found_dll:
 
     set_overlay(false, false, false);
 #endif
-#endif
 }
 
 void RenderDoc::set_overlay(bool frameRate, bool frameNumber, bool captureList) noexcept {
@@ -99,4 +107,13 @@ void RenderDoc::set_overlay(bool frameRate, bool frameNumber, bool captureList)
     api_->MaskOverlayBits(and_mask, or_mask);
 }
 
+void RenderDoc::trigger_capture() noexcept {
+    if (!api) {
+        return;
+    }
+
+    auto *api_ = reinterpret_cast<RENDERDOC_API_1_4_1 *>(api);
+    api_->TriggerCapture();
+}
+
 }
@@ -16,6 +16,18 @@ public:
 
     void set_overlay(bool frameRate, bool frameNumber, bool captureList) noexcept;
 
+    /** Check if the application is running under RenderDoc.
+     */
+    [[nodiscard]] bool is_loaded() const noexcept
+    {
+        return api != nullptr;
+    }
+
+    /** Capture the next frame that is presented.
+     * The capture is written to the capture directory configured in RenderDoc.
+     */
+    void trigger_capture() noexcept;
+
 private:
     /** Pointer to the RenderDoc API struct.
      */
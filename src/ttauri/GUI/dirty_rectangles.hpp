@@ -0,0 +1,238 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../geometry/axis_aligned_rectangle.hpp"
+#include "../required.hpp"
+#include "../assert.hpp"
+#include <array>
+#include <limits>
+#include <climits>
+#include <cstdint>
+
+namespace tt {
+
+/** A small set of rectangles of a window that need to be redrawn.
+ *
+ * Overlapping rectangles are merged into a single bounding rectangle.
+ * When the set is full, the new rectangle is merged with the rectangle
+ * that grows the least in area. This keeps two small rectangles in opposite
+ * corners of a window from becoming a single full-window redraw.
+ */
+class dirty_rectangles {
+public:
+    static constexpr size_t max_size = 8;
+
+    using array_type = std::array<aarectangle, max_size>;
+    using const_iterator = typename array_type::const_iterator;
+
+    /** A set of the dirty rectangles, bit i is the i-th rectangle.
+     */
+    using mask_type = uint32_t;
+    static_assert(max_size <= sizeof(mask_type) * CHAR_BIT);
+
+    constexpr dirty_rectangles() noexcept = default;
+    constexpr dirty_rectangles(dirty_rectangles const &) noexcept = default;
+    constexpr dirty_rectangles(dirty_rectangles &&) noexcept = default;
+    constexpr dirty_rectangles &operator=(dirty_rectangles const &) noexcept = default;
+    constexpr dirty_rectangles &operator=(dirty_rectangles &&) noexcept = default;
+
+    dirty_rectangles(aarectangle const &rectangle) noexcept
+    {
+        *this |= rectangle;
+    }
+
+    [[nodiscard]] constexpr size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    /** True when there is something to be redrawn.
+     */
+    [[nodiscard]] constexpr explicit operator bool() const noexcept
+    {
+        return not empty();
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+        return _rectangles.begin();
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+        return _rectangles.begin() + _size;
+    }
+
+    constexpr void clear() noexcept
+    {
+        _size = 0;
+    }
+
+    /** The bounding rectangle of all the dirty rectangles.
+     */
+    [[nodiscard]] aarectangle bounding_rectangle() const noexcept
+    {
+        auto r = aarectangle{};
+        for (ttlet &rectangle : *this) {
+            r |= rectangle;
+        }
+        return r;
+    }
+
+    /** Check if any of the dirty rectangles fully contains the given rectangle.
+     */
+    [[nodiscard]] bool contains(aarectangle const &rhs) const noexcept
+    {
+        for (ttlet &rectangle : *this) {
+            if (rectangle.contains(rhs)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** Add a rectangle to be redrawn.
+     */
+    dirty_rectangles &operator|=(aarectangle rhs) noexcept
+    {
+        if (not rhs) {
+            return *this;
+        }
+
+        while (true) {
+            // Merge with any overlapping rectangle, the merged rectangle may overlap with others.
+            if (ttlet i = find_overlapping(rhs); i != _size) {
+                rhs |= _rectangles[i];
+                remove(i);
+                continue;
+            }
+
+            if (_size == max_size) {
+                ttlet i = find_least_growth(rhs);
+                rhs |= _rectangles[i];
+                remove(i);
+                continue;
+            }
+
+            _rectangles[_size++] = rhs;
+            return *this;
+        }
+    }
+
+    dirty_rectangles &operator|=(dirty_rectangles const &rhs) noexcept
+    {
+        for (ttlet &rectangle : rhs) {
+            *this |= rectangle;
+        }
+        return *this;
+    }
+
+    [[nodiscard]] friend dirty_rectangles operator|(dirty_rectangles lhs, dirty_rectangles const &rhs) noexcept
+    {
+        return lhs |= rhs;
+    }
+
+    [[nodiscard]] friend dirty_rectangles operator|(dirty_rectangles lhs, aarectangle const &rhs) noexcept
+    {
+        return lhs |= rhs;
+    }
+
+    /** Check if any of the dirty rectangles overlaps with the given rectangle.
+     */
+    [[nodiscard]] friend bool overlaps(dirty_rectangles const &lhs, aarectangle const &rhs) noexcept
+    {
+        for (ttlet &rectangle : lhs) {
+            if (overlaps(rectangle, rhs)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** Get the dirty rectangles that overlap with the given rectangle.
+     * @return A mask with bit i set when the i-th rectangle overlaps.
+     */
+    [[nodiscard]] mask_type overlapping(aarectangle const &rhs) const noexcept
+    {
+        auto r = mask_type{0};
+        for (size_t i = 0; i != _size; ++i) {
+            if (overlaps(_rectangles[i], rhs)) {
+                r |= mask_type{1} << i;
+            }
+        }
+        return r;
+    }
+
+    /** Round each rectangle by expanding to pixel edges.
+     */
+    [[nodiscard]] friend dirty_rectangles ceil(dirty_rectangles const &rhs) noexcept
+    {
+        auto r = dirty_rectangles{};
+        for (ttlet &rectangle : rhs) {
+            r |= ceil(rectangle);
+        }
+        return r;
+    }
+
+    /** Clip each rectangle to the given rectangle.
+     */
+    [[nodiscard]] friend dirty_rectangles intersect(dirty_rectangles const &lhs, aarectangle const &rhs) noexcept
+    {
+        auto r = dirty_rectangles{};
+        for (ttlet &rectangle : lhs) {
+            r |= intersect(rectangle, rhs);
+        }
+        return r;
+    }
+
+private:
+    array_type _rectangles = {};
+    size_t _size = 0;
+
+    [[nodiscard]] static float area(aarectangle const &rhs) noexcept
+    {
+        return rhs.width() * rhs.height();
+    }
+
+    [[nodiscard]] size_t find_overlapping(aarectangle const &rhs) const noexcept
+    {
+        for (size_t i = 0; i != _size; ++i) {
+            if (overlaps(_rectangles[i], rhs)) {
+                return i;
+            }
+        }
+        return _size;
+    }
+
+    [[nodiscard]] size_t find_least_growth(aarectangle const &rhs) const noexcept
+    {
+        tt_axiom(_size != 0);
+
+        auto best_index = size_t{0};
+        auto best_growth = std::numeric_limits<float>::max();
+        for (size_t i = 0; i != _size; ++i) {
+            ttlet growth = area(_rectangles[i] | rhs) - area(_rectangles[i]);
+            if (growth < best_growth) {
+                best_index = i;
+                best_growth = growth;
+            }
+        }
+        return best_index;
+    }
+
+    void remove(size_t i) noexcept
+    {
+        tt_axiom(i < _size);
+        _rectangles[i] = _rectangles[--_size];
+    }
+};
+
+} // namespace tt
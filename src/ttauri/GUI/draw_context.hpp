@@ -9,6 +9,8 @@
 
 #include "gui_device_vulkan.hpp"
 #include "gui_window.hpp"
+#include "dirty_rectangles.hpp"
+#include "redraw_vertex_ranges.hpp"
 #include "theme.hpp"
 #include "pipeline_image_image.hpp"
 #include "pipeline_flat_device_shared.hpp"
@@ -20,14 +22,38 @@
 #include "pipeline_image_vertex.hpp"
 #include "pipeline_SDF_vertex.hpp"
 #include "../geometry/axis_aligned_rectangle.hpp"
+#include "../geometry/transform.hpp"
 #include "../vspan.hpp"
 #include "../text/shaped_text.hpp"
 #include "../color/color.hpp"
 #include "../geometry/corner_shapes.hpp"
+#include <array>
+#include <memory_resource>
+#include <span>
 #include <type_traits>
+#include <vector>
 
 namespace tt {
 
+/** The vertices placed by a widget and its children during a previous frame.
+ * In retained mode a widget that did not change since the previous frame
+ * copies these vertices instead of calculating them again.
+ */
+struct draw_cache {
+    std::vector<pipeline_flat::vertex> flat_vertices;
+    std::vector<pipeline_box::vertex> box_vertices;
+    std::vector<pipeline_image::vertex> image_vertices;
+    std::vector<pipeline_SDF::vertex> sdf_vertices;
+
+    /** The draw-cache-generation of the window when the vertices were recorded.
+     */
+    size_t generation = 0;
+
+    /** The recorded vertices are complete and up to date.
+     */
+    bool valid = false;
+};
+
 /** Draw context for drawing using the TTauri shaders.
  */
 class draw_context {
@@ -40,30 +66,43 @@ public:
 
     draw_context(
         gui_window &window,
-        aarectangle scissor_rectangle,
+        dirty_rectangles const &redraw_rectangles,
         vspan<pipeline_flat::vertex> &flatVertices,
         vspan<pipeline_box::vertex> &boxVertices,
         vspan<pipeline_image::vertex> &imageVertices,
-        vspan<pipeline_SDF::vertex> &sdfVertices) noexcept :
+        vspan<pipeline_SDF::vertex> &sdfVertices,
+        redraw_vertex_ranges &flatRanges,
+        redraw_vertex_ranges &boxRanges,
+        redraw_vertex_ranges &imageRanges,
+        redraw_vertex_ranges &sdfRanges,
+        std::pmr::memory_resource &frame_resource) noexcept :
         _window(&window),
-        _scissor_rectangle(scissor_rectangle),
+        _frame_resource(&frame_resource),
+        _redraw_rectangles(&redraw_rectangles),
         _flat_vertices(&flatVertices),
         _box_vertices(&boxVertices),
         _image_vertices(&imageVertices),
         _sdf_vertices(&sdfVertices),
+        _flat_ranges(&flatRanges),
+        _box_ranges(&boxRanges),
+        _image_ranges(&imageRanges),
+        _sdf_ranges(&sdfRanges),
         _clipping_rectangle(window.extent)
     {
         _flat_vertices->clear();
         _box_vertices->clear();
         _image_vertices->clear();
         _sdf_vertices->clear();
+        _flat_ranges->clear();
+        _box_ranges->clear();
+        _image_ranges->clear();
+        _sdf_ranges->clear();
     }
 
     [[nodiscard]] draw_context
-    make_child_context(matrix3 parent_to_local, matrix3 local_to_window, aarectangle clipping_rectangle) const noexcept
+    make_child_context([[maybe_unused]] matrix3 parent_to_local, matrix3 local_to_window, aarectangle clipping_rectangle) const noexcept
     {
         auto new_context = *this;
-        new_context._scissor_rectangle = aarectangle{parent_to_local * this->_scissor_rectangle};
         new_context._clipping_rectangle = clipping_rectangle;
         new_context._transform = local_to_window;
         return new_context;
@@ -97,6 +136,16 @@ public:
         return *device;
     }
 
+    /** The memory resource for temporary allocations while drawing.
+     * Memory allocated from this resource is reclaimed at the start of the next frame.
+     * Use it with std::pmr containers, so that drawing does not allocate from the global heap.
+     */
+    [[nodiscard]] std::pmr::memory_resource &frame_resource() const noexcept
+    {
+        tt_axiom(_frame_resource);
+        return *_frame_resource;
+    }
+
     /** Draw a polygon with four corners of one color.
      * This function will draw a polygon between the four given points.
      * This will use the current:
@@ -107,10 +156,16 @@ public:
     void draw_filled_quad(point3 p1, point3 p2, point3 p3, point3 p4, color fill_color) const noexcept
     {
         tt_axiom(_flat_vertices != nullptr);
-        _flat_vertices->emplace_back(aarectangle{_transform * _clipping_rectangle}, _transform * p1, fill_color);
-        _flat_vertices->emplace_back(aarectangle{_transform * _clipping_rectangle}, _transform * p2, fill_color);
-        _flat_vertices->emplace_back(aarectangle{_transform * _clipping_rectangle}, _transform * p3, fill_color);
-        _flat_vertices->emplace_back(aarectangle{_transform * _clipping_rectangle}, _transform * p4, fill_color);
+        ttlet clipping_rectangle = aarectangle{_transform * _clipping_rectangle};
+
+        auto corners = std::array{p1, p2, p3, p4};
+        geo::transform_points(_transform, std::span<point3>{corners});
+
+        ttlet first = _flat_vertices->size();
+        for (ttlet &corner : corners) {
+            _flat_vertices->emplace_back(clipping_rectangle, corner, fill_color);
+        }
+        add_vertex_range(*_flat_ranges, *_flat_vertices, first);
     }
 
     /** Draw a rectangle of one color.
@@ -145,6 +200,7 @@ public:
     {
         tt_axiom(_box_vertices != nullptr);
 
+        ttlet first = _box_vertices->size();
         pipeline_box::device_shared::place_vertices(
             *_box_vertices,
             aarectangle{_transform * _clipping_rectangle},
@@ -153,6 +209,7 @@ public:
             line_color,
             line_width,
             corner_shapes);
+        add_vertex_range(*_box_ranges, *_box_vertices, first);
     }
 
     void draw_box(rectangle box, color fill_color, color line_color, tt::corner_shapes corner_shapes) const noexcept
@@ -195,6 +252,7 @@ public:
 
         ttlet new_corner_shapes = corner_shapes - shrink_value;
 
+        ttlet first = _box_vertices->size();
         pipeline_box::device_shared::place_vertices(
             *_box_vertices,
             aarectangle{_transform * _clipping_rectangle},
@@ -203,6 +261,7 @@ public:
             line_color,
             line_width,
             new_corner_shapes);
+        add_vertex_range(*_box_ranges, *_box_vertices, first);
     }
 
     
@@ -244,6 +303,7 @@ public:
 
         ttlet new_corner_shapes = corner_shapes + expand_value;
 
+        ttlet first = _box_vertices->size();
         pipeline_box::device_shared::place_vertices(
             *_box_vertices,
             aarectangle{_transform * _clipping_rectangle},
@@ -252,6 +312,7 @@ public:
             line_color,
             line_width,
             new_corner_shapes);
+        add_vertex_range(*_box_ranges, *_box_vertices, first);
     }
 
     void draw_box_with_border_outside(rectangle rectangle, color fill_color, color line_color, tt::corner_shapes corner_shapes)
@@ -270,7 +331,9 @@ public:
     {
         tt_axiom(_image_vertices != nullptr);
 
+        ttlet first = _image_vertices->size();
         image.place_vertices(*_image_vertices, aarectangle{_transform * _clipping_rectangle}, _transform * image_transform);
+        add_vertex_range(*_image_ranges, *_image_vertices, first);
     }
 
     /** Draw shaped text.
@@ -287,40 +350,156 @@ public:
     {
         tt_axiom(_sdf_vertices != nullptr);
 
+        ttlet first = _sdf_vertices->size();
         if (text_color) {
-            narrow_cast<gui_device_vulkan &>(device()).SDFPipeline->place_vertices(
+            narrow_cast<gui_device_vulkan &>(device()).SDF_pipeline().place_vertices(
                 *_sdf_vertices, aarectangle{_transform * _clipping_rectangle}, _transform * transform, text, *text_color);
         } else {
-            narrow_cast<gui_device_vulkan &>(device()).SDFPipeline->place_vertices(
+            narrow_cast<gui_device_vulkan &>(device()).SDF_pipeline().place_vertices(
                 *_sdf_vertices, aarectangle{_transform * _clipping_rectangle}, _transform * transform, text);
         }
+        add_vertex_range(*_sdf_ranges, *_sdf_vertices, first);
+    }
+
+    /** Draw text, using the glyphs that were resolved in the atlas on a previous draw.
+     *
+     * @param text The text to draw.
+     * @param run The glyph run of the text, it must be cleared when the text changes.
+     * @param text_color Override the color of the text.
+     * @param transform The transformation from text coordinates to local coordinates.
+     */
+    void draw_text(
+        shaped_text const &text,
+        pipeline_SDF::glyph_run &run,
+        std::optional<color> text_color = {},
+        matrix3 transform = geo::identity{}) const noexcept
+    {
+        tt_axiom(_sdf_vertices != nullptr);
+
+        ttlet first = _sdf_vertices->size();
+        narrow_cast<gui_device_vulkan &>(device()).SDF_pipeline().place_vertices(
+            *_sdf_vertices, aarectangle{_transform * _clipping_rectangle}, _transform * transform, run, text, text_color);
+        add_vertex_range(*_sdf_ranges, *_sdf_vertices, first);
     }
 
     void draw_glyph(font_glyph_ids const &glyph, rectangle box, color text_color) const noexcept
     {
         tt_axiom(_sdf_vertices != nullptr);
 
-        narrow_cast<gui_device_vulkan &>(device()).SDFPipeline->place_vertices(
+        ttlet first = _sdf_vertices->size();
+        narrow_cast<gui_device_vulkan &>(device()).SDF_pipeline().place_vertices(
             *_sdf_vertices, aarectangle{_transform * _clipping_rectangle}, _transform * box, glyph, text_color);
+        add_vertex_range(*_sdf_ranges, *_sdf_vertices, first);
     }
 
     [[nodiscard]] friend bool overlaps(draw_context const &context, aarectangle const &rectangle) noexcept
     {
-        return overlaps(context._scissor_rectangle, rectangle);
+        return overlaps(*context._redraw_rectangles, aarectangle{context._transform * rectangle});
+    }
+
+    /** Skip drawing a widget that is outside of the redraw rectangles.
+     * The enclosing recording can not be replayed, since it would miss the vertices of the widget.
+     */
+    void skip_retained() const noexcept
+    {
+        if (_recording_cache) {
+            _recording_cache->valid = false;
+        }
+    }
+
+    /** Draw using retained vertices.
+     * When the window is in retained mode and the cache is valid, the vertices
+     * of the cache are copied into the vertex buffers. Otherwise the draw function
+     * is called and the vertices it placed are recorded into the cache.
+     *
+     * The recording is only marked valid when the clipping rectangle is completely inside
+     * one of the redraw rectangles, when no redraw was requested during drawing and when all
+     * the nested recordings are valid.
+     *
+     * @param cache The cache of the widget.
+     * @param draw_function A function `void(draw_context const &)` that does the actual drawing.
+     */
+    template<typename DrawFunction>
+    void draw_retained(draw_cache &cache, DrawFunction &&draw_function) const noexcept
+    {
+        tt_axiom(_flat_vertices != nullptr);
+        tt_axiom(_box_vertices != nullptr);
+        tt_axiom(_image_vertices != nullptr);
+        tt_axiom(_sdf_vertices != nullptr);
+
+        // A widget outside of the redraw rectangles does not need to place any vertices.
+        if (not overlaps(*this, _clipping_rectangle)) {
+            skip_retained();
+            return;
+        }
+
+        auto &window_ = window();
+        if (not window_.retained_mode) {
+            cache.valid = false;
+            std::forward<DrawFunction>(draw_function)(*this);
+            return;
+        }
+
+        if (cache.valid and cache.generation == window_.draw_cache_generation()) {
+            replay_vertices(*_flat_vertices, *_flat_ranges, cache.flat_vertices);
+            replay_vertices(*_box_vertices, *_box_ranges, cache.box_vertices);
+            replay_vertices(*_image_vertices, *_image_ranges, cache.image_vertices);
+            replay_vertices(*_sdf_vertices, *_sdf_ranges, cache.sdf_vertices);
+            return;
+        }
+
+        ttlet flat_offset = _flat_vertices->size();
+        ttlet box_offset = _box_vertices->size();
+        ttlet image_offset = _image_vertices->size();
+        ttlet sdf_offset = _sdf_vertices->size();
+        ttlet redraw_request_count = window_.redraw_request_count();
+
+        auto recording_context = *this;
+        recording_context._recording_cache = &cache;
+
+        // Nested recordings, or a request_redraw() from the widget, may invalidate the cache during drawing.
+        cache.valid = true;
+        std::forward<DrawFunction>(draw_function)(recording_context);
+
+        record_vertices(cache.flat_vertices, *_flat_vertices, flat_offset);
+        record_vertices(cache.box_vertices, *_box_vertices, box_offset);
+        record_vertices(cache.image_vertices, *_image_vertices, image_offset);
+        record_vertices(cache.sdf_vertices, *_sdf_vertices, sdf_offset);
+        cache.generation = window_.draw_cache_generation();
+
+        // When part of the widget was outside the redraw rectangles, the widget may have skipped placing vertices.
+        cache.valid = cache.valid and _redraw_rectangles->contains(aarectangle{_transform * _clipping_rectangle}) and
+            window_.redraw_request_count() == redraw_request_count;
+
+        if (_recording_cache and not cache.valid) {
+            _recording_cache->valid = false;
+        }
     }
 
 private:
     gui_window *_window;
+    std::pmr::memory_resource *_frame_resource;
+
+    /** The cache of the enclosing widget that is currently recording vertices.
+     */
+    draw_cache *_recording_cache = nullptr;
 
     vspan<pipeline_flat::vertex> *_flat_vertices;
     vspan<pipeline_box::vertex> *_box_vertices;
     vspan<pipeline_image::vertex> *_image_vertices;
     vspan<pipeline_SDF::vertex> *_sdf_vertices;
 
-    /** This is the rectangle of the window that is being redrawn.
-     * The scissor rectangle, like drawing coordinates are relative to the widget.
+    /** The ranges of the vertices with the redraw rectangles they overlap.
+     */
+    redraw_vertex_ranges *_flat_ranges;
+    redraw_vertex_ranges *_box_ranges;
+    redraw_vertex_ranges *_image_ranges;
+    redraw_vertex_ranges *_sdf_ranges;
+
+    /** The rectangles of the window that are being redrawn.
+     * Unlike the drawing coordinates, the redraw rectangles are in window coordinates.
      */
-    aarectangle _scissor_rectangle;
+    dirty_rectangles const *_redraw_rectangles;
 
     /** The clipping rectangle when drawing.
      * The clipping rectangle, like drawing coordinates are relative to the widget.
@@ -332,6 +511,35 @@ private:
      * (inverse depth buffer) of the shape.
      */
     matrix3 _transform = geo::identity{};
+
+    /** Add the vertices placed since `first` to the ranges, with the redraw rectangles that overlap the clipping rectangle.
+     */
+    template<typename T>
+    void add_vertex_range(redraw_vertex_ranges &ranges, vspan<T> const &vertices, size_t first) const noexcept
+    {
+        ranges.add(first, vertices.size(), _redraw_rectangles->overlapping(aarectangle{_transform * _clipping_rectangle}));
+    }
+
+    /** Copy the cached vertices; they are inside the clipping rectangle of the widget that recorded them.
+     */
+    template<typename T>
+    void replay_vertices(vspan<T> &vertices, redraw_vertex_ranges &ranges, std::vector<T> const &cached_vertices) const noexcept
+    {
+        ttlet first = vertices.size();
+        for (ttlet &vertex : cached_vertices) {
+            vertices.push_back(vertex);
+        }
+        add_vertex_range(ranges, vertices, first);
+    }
+
+    template<typename T>
+    static void record_vertices(std::vector<T> &cached_vertices, vspan<T> const &vertices, size_t offset) noexcept
+    {
+        cached_vertices.clear();
+        for (auto i = offset; i != vertices.size(); ++i) {
+            cached_vertices.push_back(vertices[i]);
+        }
+    }
 };
 
 } // namespace tt
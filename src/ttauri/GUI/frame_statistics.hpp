@@ -0,0 +1,122 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../hires_utc_clock.hpp"
+#include "../required.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+namespace tt {
+
+/** Measurements of a single frame rendered by a window.
+ */
+struct frame_statistics {
+    /** The time it took the CPU to update and draw the widgets and to submit the frame.
+     */
+    hires_utc_clock::duration cpu_duration = {};
+
+    /** The time the GPU took to render the most recently completed frame.
+     * The GPU finishes a frame one or more frames after it was submitted; zero
+     * when the device does not support timestamp queries.
+     */
+    hires_utc_clock::duration gpu_duration = {};
+
+    /** The number of widgets of which the constraints were updated.
+     */
+    int64_t nr_constrained = 0;
+
+    /** The number of widgets that were laid out.
+     */
+    int64_t nr_laid_out = 0;
+
+    /** The number of widgets that were drawn, instead of replaying their retained vertices.
+     */
+    int64_t nr_drawn = 0;
+
+    /** The number of widgets that were tested for the position of the mouse.
+     */
+    int64_t nr_hitbox_tested = 0;
+
+    /** The number of vertices placed in the vertex buffer of each pipeline.
+     */
+    int64_t nr_flat_vertices = 0;
+    int64_t nr_box_vertices = 0;
+    int64_t nr_image_vertices = 0;
+    int64_t nr_SDF_vertices = 0;
+
+    /** The number of glyphs that were added to the SDF atlas.
+     */
+    int64_t nr_glyphs_added = 0;
+
+    /** The number of heap allocations made by the thread rendering the frame.
+     * Zero unless the library is build with allocation tracking.
+     */
+    int64_t nr_allocations = 0;
+
+    /** The fraction of the SDF atlas textures that is allocated to glyphs.
+     */
+    float sdf_atlas_occupancy = 0.0f;
+
+    /** The number of pages of the image atlas that are in use.
+     */
+    size_t nr_image_atlas_pages = 0;
+
+    /** The number of pages of the image atlas textures that are allocated.
+     */
+    size_t image_atlas_capacity = 0;
+};
+
+/** The statistics of the most recent frames of a window.
+ */
+class frame_statistics_history {
+public:
+    static constexpr size_t capacity = 128;
+
+    /** Add the statistics of a frame, replacing the oldest frame when full.
+     */
+    void push(frame_statistics const &frame) noexcept
+    {
+        _frames[_next] = frame;
+        _next = (_next + 1) % capacity;
+        _size = std::min(_size + 1, capacity);
+    }
+
+    [[nodiscard]] size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    /** Get the statistics of a frame.
+     * @param index The index of a frame, zero for the oldest.
+     */
+    [[nodiscard]] frame_statistics const &operator[](size_t index) const noexcept
+    {
+        tt_axiom(index < _size);
+        return _frames[(_next + capacity - _size + index) % capacity];
+    }
+
+    /** Get the statistics of the most recent frame.
+     */
+    [[nodiscard]] frame_statistics const &back() const noexcept
+    {
+        tt_axiom(_size > 0);
+        return (*this)[_size - 1];
+    }
+
+private:
+    std::array<frame_statistics, capacity> _frames = {};
+    size_t _next = 0;
+    size_t _size = 0;
+};
+
+} // namespace tt
@@ -0,0 +1,98 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "frame_vertex_buffers.hpp"
+#include "gui_device_vulkan.hpp"
+#include "../counters.hpp"
+#include "../logger.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace tt {
+
+frame_vertex_buffers_base::frame_vertex_buffers_base(
+    size_t vertex_size,
+    size_t initial_capacity,
+    size_t maximum_capacity) noexcept :
+    _vertex_size(vertex_size), _capacity(initial_capacity), _maximum_capacity(maximum_capacity)
+{
+    tt_axiom(initial_capacity > 0 and initial_capacity <= maximum_capacity);
+}
+
+void frame_vertex_buffers_base::acquire(gui_device_vulkan &device, buffer_type &buffer)
+{
+    ttlet vertex_buffer = device.acquire_vertex_buffer(_capacity * _vertex_size);
+    buffer = {vertex_buffer.buffer, vertex_buffer.allocation, vertex_buffer.mapping};
+}
+
+void frame_vertex_buffers_base::build(gui_device_vulkan &device, size_t nr_frames_in_flight)
+{
+    tt_axiom(_buffers.empty());
+
+    // The buffers are recycled by the device, so that a new window does not need to create them.
+    _buffers.resize(nr_frames_in_flight);
+    for (auto &buffer : _buffers) {
+        acquire(device, buffer);
+    }
+    _index = 0;
+}
+
+void frame_vertex_buffers_base::teardown(gui_device_vulkan &device) noexcept
+{
+    for (ttlet &buffer : _buffers) {
+        device.release_vertex_buffer(buffer.buffer);
+    }
+    _buffers.clear();
+
+    add_to_counter<"vertex_buffer_high_watermark">(-narrow_cast<int64_t>(_high_watermark));
+    _high_watermark = 0;
+}
+
+void frame_vertex_buffers_base::flush(gui_device_vulkan &device, size_t nr_vertices) const
+{
+    tt_axiom(_index < _buffers.size());
+    device.flushAllocation(_buffers[_index].allocation, 0, nr_vertices * _vertex_size);
+}
+
+[[nodiscard]] std::span<std::byte>
+frame_vertex_buffers_base::select_mapping(gui_device_vulkan &device, size_t index, size_t nr_vertices_needed) noexcept
+{
+    tt_axiom(index < _buffers.size());
+    _index = index;
+
+    ttlet nr_bytes_needed = nr_vertices_needed * _vertex_size;
+    if (nr_bytes_needed > _high_watermark) {
+        add_to_counter<"vertex_buffer_high_watermark">(narrow_cast<int64_t>(nr_bytes_needed - _high_watermark));
+        _high_watermark = nr_bytes_needed;
+    }
+
+    if (nr_vertices_needed > _capacity and _capacity < _maximum_capacity) [[unlikely]] {
+        ttlet new_capacity = std::min(std::bit_ceil(nr_vertices_needed), _maximum_capacity);
+        tt_log_info(
+            "Growing vertex buffers from {} to {} vertices, a frame needed {} vertices.",
+            _capacity,
+            new_capacity,
+            nr_vertices_needed);
+        increment_counter<"vertex_buffer_grow">();
+        _capacity = new_capacity;
+    }
+
+    auto &buffer = _buffers[index];
+    if (buffer.mapping.size() < _capacity * _vertex_size) [[unlikely]] {
+        // The fence of this frame-in-flight has signalled, so the old buffer can be returned to the pool.
+        try {
+            ttlet old_buffer = buffer.buffer;
+            acquire(device, buffer);
+            device.release_vertex_buffer(old_buffer);
+        } catch (std::exception const &e) {
+            // Keep drawing into the old buffer and stop growing; the vertices that do not fit are dropped.
+            tt_log_error("Could not grow vertex buffer to {} vertices: {}", _capacity, e.what());
+            _capacity = _maximum_capacity = buffer.mapping.size() / _vertex_size;
+        }
+    }
+
+    return buffer.mapping;
+}
+
+} // namespace tt
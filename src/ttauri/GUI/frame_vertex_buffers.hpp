@@ -0,0 +1,135 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../vspan.hpp"
+#include "../required.hpp"
+#include <vulkan/vulkan.hpp>
+#include <vk_mem_alloc.h>
+#include <vector>
+#include <span>
+#include <cstddef>
+
+namespace tt {
+class gui_device_vulkan;
+
+/** The persistently mapped vertex buffers of a pipeline, one for each frame-in-flight.
+ *
+ * The vertices of a frame are written directly into the mapped buffer through a `vspan`, which
+ * drops the vertices that do not fit. When a frame dropped vertices the capacity is doubled,
+ * and each buffer is replaced by a larger buffer from the pool of the device the next time
+ * its frame-in-flight is selected; by then the fence of that frame-in-flight has signalled,
+ * so the GPU is no longer using the old buffer.
+ *
+ * The largest number of bytes used by a frame is added to the "vertex_buffer_high_watermark"
+ * counter, so that the counter is the sum over the pipelines of all windows.
+ */
+class frame_vertex_buffers_base {
+public:
+    /**
+     * @param vertex_size The size of a vertex in bytes.
+     * @param initial_capacity The number of vertices of each buffer when first built.
+     * @param maximum_capacity The number of vertices the buffers may grow to.
+     */
+    frame_vertex_buffers_base(size_t vertex_size, size_t initial_capacity, size_t maximum_capacity) noexcept;
+
+    frame_vertex_buffers_base(frame_vertex_buffers_base const &) = delete;
+    frame_vertex_buffers_base(frame_vertex_buffers_base &&) = delete;
+    frame_vertex_buffers_base &operator=(frame_vertex_buffers_base const &) = delete;
+    frame_vertex_buffers_base &operator=(frame_vertex_buffers_base &&) = delete;
+
+    /** The number of vertices of a buffer.
+     */
+    [[nodiscard]] size_t capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    /** The buffer of the selected frame-in-flight.
+     */
+    [[nodiscard]] vk::Buffer buffer() const noexcept
+    {
+        tt_axiom(_index < _buffers.size());
+        return _buffers[_index].buffer;
+    }
+
+    /** Take a buffer for each frame-in-flight from the device.
+     * The buffers keep the capacity they had grown to before they were torn down.
+     */
+    void build(gui_device_vulkan &device, size_t nr_frames_in_flight);
+
+    /** Return the buffers to the device.
+     * @pre The GPU is no longer using any of the buffers.
+     */
+    void teardown(gui_device_vulkan &device) noexcept;
+
+    /** Flush the vertices written to the buffer of the selected frame-in-flight.
+     */
+    void flush(gui_device_vulkan &device, size_t nr_vertices) const;
+
+protected:
+    /** Select the buffer of a frame-in-flight, growing it when needed.
+     *
+     * @pre The GPU is no longer using the buffer of this frame-in-flight.
+     * @param index The index of the frame-in-flight.
+     * @param nr_vertices_needed The number of vertices the previous frame tried to add.
+     * @return The mapping of the buffer.
+     */
+    [[nodiscard]] std::span<std::byte>
+    select_mapping(gui_device_vulkan &device, size_t index, size_t nr_vertices_needed) noexcept;
+
+private:
+    struct buffer_type {
+        vk::Buffer buffer;
+        VmaAllocation allocation;
+        std::span<std::byte> mapping;
+    };
+
+    size_t _vertex_size;
+    size_t _capacity;
+    size_t _maximum_capacity;
+
+    /** The largest number of bytes used by a frame, as added to the counter.
+     */
+    size_t _high_watermark = 0;
+
+    size_t _index = 0;
+    std::vector<buffer_type> _buffers;
+
+    void acquire(gui_device_vulkan &device, buffer_type &buffer);
+};
+
+/** The persistently mapped vertex buffers of a pipeline, one for each frame-in-flight.
+ * @see frame_vertex_buffers_base
+ */
+template<typename T>
+class frame_vertex_buffers : public frame_vertex_buffers_base {
+public:
+    using value_type = T;
+
+    frame_vertex_buffers(size_t initial_capacity, size_t maximum_capacity) noexcept :
+        frame_vertex_buffers_base(sizeof(value_type), initial_capacity, maximum_capacity)
+    {
+    }
+
+    /** Select the buffer of a frame-in-flight for the vertices of the next frame.
+     *
+     * @pre The GPU is no longer using the buffer of this frame-in-flight.
+     * @param index The index of the frame-in-flight.
+     * @param[in,out] vertices The vertices of the previous frame, replaced with an empty vspan on the selected buffer.
+     */
+    void select(gui_device_vulkan &device, size_t index, vspan<value_type> &vertices) noexcept
+    {
+        vertices = as_vspan(select_mapping(device, index, vertices.size() + vertices.nr_dropped()));
+    }
+
+private:
+    [[nodiscard]] static vspan<value_type> as_vspan(std::span<std::byte> bytes) noexcept
+    {
+        return std::span<value_type>{reinterpret_cast<value_type *>(bytes.data()), bytes.size() / sizeof(value_type)};
+    }
+};
+
+} // namespace tt
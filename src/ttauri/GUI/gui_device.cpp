@@ -47,14 +47,19 @@ void gui_device::add(std::shared_ptr<gui_window> window)
     windows.push_back(std::move(window));
 }
 
-void gui_device::remove(gui_window &window) noexcept
+std::shared_ptr<gui_window> gui_device::remove(gui_window &window) noexcept
 {
     ttlet lock = std::scoped_lock(gui_system_mutex);
 
     window.unset_device();
-    windows.erase(std::find_if(windows.begin(), windows.end(), [&](auto &x) {
+    ttlet it = std::find_if(windows.begin(), windows.end(), [&](auto &x) {
         return x.get() == &window;
-    }));
+    });
+    tt_axiom(it != windows.end());
+
+    auto r = std::move(*it);
+    windows.erase(it);
+    return r;
 }
 
 }
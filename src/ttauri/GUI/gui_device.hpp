@@ -64,9 +64,21 @@ public:
         return std::ssize(windows);
     }
 
+    /** The windows managed by this device.
+     */
+    [[nodiscard]] std::vector<std::shared_ptr<gui_window>> const &managed_windows() const noexcept
+    {
+        return windows;
+    }
+
     void add(std::shared_ptr<gui_window> window);
 
-    void remove(gui_window &window) noexcept;
+    /** Remove a window from this device.
+     *
+     * @param window The window to remove.
+     * @return The window, so that it can be added to another device.
+     */
+    std::shared_ptr<gui_window> remove(gui_window &window) noexcept;
 
     void render(hires_utc_clock::time_point displayTimePoint) noexcept {
         tt_axiom(gui_system_mutex.recurse_lock_count());
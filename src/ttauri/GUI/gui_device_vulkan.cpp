@@ -8,7 +8,14 @@
 #include "pipeline_image_device_shared.hpp"
 #include "gui_window.hpp"
 #include "../application.hpp"
+#include "../file.hpp"
+#include "../URL.hpp"
+#include "../counters.hpp"
 #include <span>
+#include <cstring>
+#include <algorithm>
+#include <limits>
+#include <array>
 
 namespace tt {
 
@@ -177,18 +184,31 @@ gui_device_vulkan::~gui_device_vulkan()
     try {
         ttlet lock = std::scoped_lock(gui_system_mutex);
 
-        toneMapperPipeline->destroy(this);
-        toneMapperPipeline = nullptr;
-        SDFPipeline->destroy(this);
-        SDFPipeline = nullptr;
-        imagePipeline->destroy(this);
-        imagePipeline = nullptr;
-        boxPipeline->destroy(this);
-        boxPipeline = nullptr;
-        flatPipeline->destroy(this);
-        flatPipeline = nullptr;
+        if (_tone_mapper_pipeline) {
+            _tone_mapper_pipeline->destroy(this);
+            _tone_mapper_pipeline = nullptr;
+        }
+        if (_SDF_pipeline) {
+            _SDF_pipeline->destroy(this);
+            _SDF_pipeline = nullptr;
+        }
+        if (_image_pipeline) {
+            _image_pipeline->destroy(this);
+            _image_pipeline = nullptr;
+        }
+        if (_box_pipeline) {
+            _box_pipeline->destroy(this);
+            _box_pipeline = nullptr;
+        }
+        if (_flat_pipeline) {
+            _flat_pipeline->destroy(this);
+            _flat_pipeline = nullptr;
+        }
 
+        destroy_transfer_queue();
         destroy_quad_index_buffer();
+        destroy_vertex_buffer_pool();
+        destroy_pipeline_cache();
 
         vmaDestroyAllocator(allocator);
 
@@ -227,20 +247,48 @@ void gui_device_vulkan::initialize_device(gui_window const &window)
         deviceQueueCreateInfos.push_back({vk::DeviceQueueCreateFlags(), index, 1, &defaultQueuePriority});
     }
 
-    intrinsic = physicalIntrinsic.createDevice(
-        {vk::DeviceCreateFlags(),
-         narrow_cast<uint32_t>(deviceQueueCreateInfos.size()),
-         deviceQueueCreateInfos.data(),
-         0,
-         nullptr,
-         narrow_cast<uint32_t>(requiredExtensions.size()),
-         requiredExtensions.data(),
-         &(narrow_cast<gui_system_vulkan &>(system).requiredFeatures)});
+    // A dedicated transfer queue is only used with timeline semaphores, so that the graphics
+    // queue can wait on uploads without the CPU waiting.
+    ttlet timelineSemaphores = supports_timeline_semaphores();
+    ttlet transferQueueFamilyIndex = timelineSemaphores ? find_transfer_queue_family_index() : std::nullopt;
+    if (transferQueueFamilyIndex) {
+        deviceQueueCreateInfos.push_back({vk::DeviceQueueCreateFlags(), *transferQueueFamilyIndex, 1, &defaultQueuePriority});
+    }
+
+    // Optional extensions are enabled when available.
+    auto enabledExtensions = requiredExtensions;
+    supportsIncrementalPresent = hasRequiredExtensions(physicalIntrinsic, {VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME});
+    if (supportsIncrementalPresent) {
+        enabledExtensions.push_back(VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME);
+    }
+    supportsMemoryBudget = hasRequiredExtensions(physicalIntrinsic, {VK_EXT_MEMORY_BUDGET_EXTENSION_NAME});
+    if (supportsMemoryBudget) {
+        enabledExtensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+    }
+
+    auto timelineSemaphoreFeatures = vk::PhysicalDeviceTimelineSemaphoreFeatures{VK_TRUE};
+    auto deviceCreateInfo = vk::DeviceCreateInfo{
+        vk::DeviceCreateFlags(),
+        narrow_cast<uint32_t>(deviceQueueCreateInfos.size()),
+        deviceQueueCreateInfos.data(),
+        0,
+        nullptr,
+        narrow_cast<uint32_t>(enabledExtensions.size()),
+        enabledExtensions.data(),
+        &(narrow_cast<gui_system_vulkan &>(system).requiredFeatures)};
+    if (timelineSemaphores) {
+        deviceCreateInfo.pNext = &timelineSemaphoreFeatures;
+    }
+
+    intrinsic = physicalIntrinsic.createDevice(deviceCreateInfo);
 
     VmaAllocatorCreateInfo allocatorCreateInfo = {};
     allocatorCreateInfo.physicalDevice = physicalIntrinsic;
     allocatorCreateInfo.device = intrinsic;
     allocatorCreateInfo.instance = narrow_cast<gui_system_vulkan &>(system).intrinsic;
+    if (supportsMemoryBudget) {
+        allocatorCreateInfo.flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+    }
     vmaCreateAllocator(&allocatorCreateInfo, &allocator);
 
     VmaAllocationCreateInfo lazyAllocationInfo = {};
@@ -283,17 +331,132 @@ void gui_device_vulkan::initialize_device(gui_window const &window)
         index++;
     }
 
-    initialize_quad_index_buffer();
+    graphicsTimestampValidBits = physicalIntrinsic.getQueueFamilyProperties().at(graphicsQueueFamilyIndex).timestampValidBits;
 
-    flatPipeline = std::make_unique<pipeline_flat::device_shared>(*this);
-    boxPipeline = std::make_unique<pipeline_box::device_shared>(*this);
-    imagePipeline = std::make_unique<pipeline_image::device_shared>(*this);
-    SDFPipeline = std::make_unique<pipeline_SDF::device_shared>(*this);
-    toneMapperPipeline = std::make_unique<pipeline_tone_mapper::device_shared>(*this);
+    initialize_transfer_queue(timelineSemaphores, transferQueueFamilyIndex);
+    initialize_quad_index_buffer();
+    initialize_pipeline_cache();
 
     gui_device::initialize_device(window);
 }
 
+pipeline_flat::device_shared &gui_device_vulkan::flat_pipeline()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    if (!_flat_pipeline) {
+        _flat_pipeline = std::make_unique<pipeline_flat::device_shared>(*this);
+    }
+    return *_flat_pipeline;
+}
+
+pipeline_box::device_shared &gui_device_vulkan::box_pipeline()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    if (!_box_pipeline) {
+        _box_pipeline = std::make_unique<pipeline_box::device_shared>(*this);
+    }
+    return *_box_pipeline;
+}
+
+pipeline_image::device_shared &gui_device_vulkan::image_pipeline()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    if (!_image_pipeline) {
+        _image_pipeline = std::make_unique<pipeline_image::device_shared>(*this);
+    }
+    return *_image_pipeline;
+}
+
+pipeline_SDF::device_shared &gui_device_vulkan::SDF_pipeline()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    if (!_SDF_pipeline) {
+        _SDF_pipeline = std::make_unique<pipeline_SDF::device_shared>(*this);
+    }
+    return *_SDF_pipeline;
+}
+
+pipeline_tone_mapper::device_shared &gui_device_vulkan::tone_mapper_pipeline()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    if (!_tone_mapper_pipeline) {
+        _tone_mapper_pipeline = std::make_unique<pipeline_tone_mapper::device_shared>(*this);
+    }
+    return *_tone_mapper_pipeline;
+}
+
+void gui_device_vulkan::update_memory_budget(hires_utc_clock::time_point displayTimePoint) noexcept
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    if (displayTimePoint < nextMemoryBudgetSample) {
+        return;
+    }
+    nextMemoryBudgetSample = displayTimePoint + memoryBudgetSampleInterval;
+
+    // The allocator caches the budget reported by the driver until the frame index changes.
+    vmaSetCurrentFrameIndex(allocator, ++memoryBudgetFrameIndex);
+
+    VkPhysicalDeviceMemoryProperties const *memoryProperties = nullptr;
+    vmaGetMemoryProperties(allocator, &memoryProperties);
+
+    auto budgets = std::array<VmaBudget, VK_MAX_MEMORY_HEAPS>{};
+    vmaGetBudget(allocator, budgets.data());
+
+    auto localUsage = int64_t{0};
+    auto localBudget = int64_t{0};
+    auto hostUsage = int64_t{0};
+    auto hostBudget = int64_t{0};
+    auto isOverSoftLimit = false;
+    for (uint32_t heapIndex = 0; heapIndex != memoryProperties->memoryHeapCount; ++heapIndex) {
+        ttlet &budget = budgets[heapIndex];
+        ttlet usage = narrow_cast<int64_t>(budget.usage);
+        ttlet limit = narrow_cast<int64_t>(budget.budget);
+
+        if (memoryProperties->memoryHeaps[heapIndex].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) {
+            localUsage += usage;
+            localBudget += limit;
+        } else {
+            hostUsage += usage;
+            hostBudget += limit;
+        }
+
+        if (static_cast<double>(usage) > static_cast<double>(limit) * memoryBudgetSoftLimit) {
+            if (not memoryIsOverSoftLimit) {
+                tt_log_warning("Memory heap {} of device {} is using {} of {} bytes of its budget.", heapIndex, deviceName, usage, limit);
+            }
+            isOverSoftLimit = true;
+        }
+    }
+
+    // The counters track the current value, so add the difference with the previous sample.
+    add_to_counter<"gpu_local_usage">(localUsage - read_counter<"gpu_local_usage">());
+    add_to_counter<"gpu_local_budget">(localBudget - read_counter<"gpu_local_budget">());
+    add_to_counter<"gpu_host_usage">(hostUsage - read_counter<"gpu_host_usage">());
+    add_to_counter<"gpu_host_budget">(hostBudget - read_counter<"gpu_host_budget">());
+
+    memoryIsOverSoftLimit = isOverSoftLimit;
+    if (isOverSoftLimit) {
+        handle_memory_pressure();
+    }
+}
+
+void gui_device_vulkan::handle_memory_pressure() noexcept
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    // The image atlas only holds pages of images that are still alive, so only the SDF atlas
+    // is able to evict, the glyphs will be rendered again when they are needed.
+    if (_SDF_pipeline) {
+        _SDF_pipeline->reduceAtlasMemory();
+    }
+}
+
 void gui_device_vulkan::initialize_quad_index_buffer()
 {
     tt_axiom(gui_system_mutex.recurse_lock_count());
@@ -379,6 +542,162 @@ void gui_device_vulkan::destroy_quad_index_buffer()
     destroyBuffer(quadIndexBuffer, quadIndexBufferAllocation);
 }
 
+[[nodiscard]] bool gui_device_vulkan::supports_timeline_semaphores() const noexcept
+{
+    if (physicalProperties.apiVersion < VK_API_VERSION_1_2) {
+        return false;
+    }
+
+    ttlet features = physicalIntrinsic.getFeatures2<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceTimelineSemaphoreFeatures>();
+    return features.get<vk::PhysicalDeviceTimelineSemaphoreFeatures>().timelineSemaphore == VK_TRUE;
+}
+
+[[nodiscard]] std::optional<uint32_t> gui_device_vulkan::find_transfer_queue_family_index() const noexcept
+{
+    uint32_t index = 0;
+    for (ttlet &queueFamilyProperties : physicalIntrinsic.getQueueFamilyProperties()) {
+        ttlet flags = queueFamilyProperties.queueFlags;
+        ttlet granularity = queueFamilyProperties.minImageTransferGranularity;
+
+        ttlet isTransferOnly = (flags & vk::QueueFlagBits::eTransfer) &&
+            !(flags & (vk::QueueFlagBits::eGraphics | vk::QueueFlagBits::eCompute));
+        ttlet isAlreadyUsed = std::any_of(
+            queueFamilyIndicesAndCapabilities.cbegin(), queueFamilyIndicesAndCapabilities.cend(), [index](ttlet &item) {
+                return item.first == index;
+            });
+
+        // Glyphs and image pages are copied to any pixel offset in the atlas.
+        if (isTransferOnly && !isAlreadyUsed && queueFamilyProperties.queueCount > 0 && granularity.width == 1 &&
+            granularity.height == 1 && granularity.depth == 1) {
+            return index;
+        }
+        ++index;
+    }
+    return {};
+}
+
+void gui_device_vulkan::initialize_transfer_queue(bool timeline_semaphores, std::optional<uint32_t> transfer_queue_family_index)
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    if (transfer_queue_family_index) {
+        tt_axiom(timeline_semaphores);
+        transferQueueFamilyIndex = *transfer_queue_family_index;
+        transferQueue = intrinsic.getQueue(transferQueueFamilyIndex, 0);
+        transferCommandPool = intrinsic.createCommandPool(
+            {vk::CommandPoolCreateFlagBits::eTransient | vk::CommandPoolCreateFlagBits::eResetCommandBuffer,
+             transferQueueFamilyIndex});
+        hasDedicatedTransferQueue = true;
+        transferSharingQueueFamilyIndices = {graphicsQueueFamilyIndex, transferQueueFamilyIndex};
+        tt_log_info(" - Uploading on dedicated transfer queue family {}", transferQueueFamilyIndex);
+
+    } else {
+        transferQueueFamilyIndex = graphicsQueueFamilyIndex;
+        transferQueue = graphicsQueue;
+        transferCommandPool = graphicsCommandPool;
+        hasDedicatedTransferQueue = false;
+        transferSharingQueueFamilyIndices = {graphicsQueueFamilyIndex};
+    }
+
+    if (timeline_semaphores) {
+        ttlet semaphoreCreateInfo = vk::StructureChain<vk::SemaphoreCreateInfo, vk::SemaphoreTypeCreateInfo>{
+            vk::SemaphoreCreateInfo{vk::SemaphoreCreateFlags()}, vk::SemaphoreTypeCreateInfo{vk::SemaphoreType::eTimeline, 0}};
+        transferTimeline = intrinsic.createSemaphore(semaphoreCreateInfo.get<vk::SemaphoreCreateInfo>());
+        transferTimelineValue = 0;
+    }
+}
+
+void gui_device_vulkan::destroy_transfer_queue()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    if (transferTimeline) {
+        waitForTransfer(transferTimelineValue);
+        free_completed_transfer_commands();
+        intrinsic.destroy(transferTimeline);
+        transferTimeline = vk::Semaphore{};
+    }
+    tt_axiom(transferCommandBuffersInFlight.empty());
+
+    if (hasDedicatedTransferQueue) {
+        intrinsic.destroy(transferCommandPool);
+    }
+    transferCommandPool = vk::CommandPool{};
+}
+
+URL gui_device_vulkan::pipeline_cache_location() const noexcept
+{
+    return URL::urlFromApplicationDataDirectory() /
+        fmt::format("vulkan_pipeline_cache_{}_{:08x}.bin", deviceUUID.UUIDString(), physicalProperties.driverVersion);
+}
+
+void gui_device_vulkan::initialize_pipeline_cache()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    // The header of the pipeline cache data, as defined in the Vulkan specification.
+    struct pipeline_cache_header {
+        uint32_t length;
+        uint32_t version;
+        uint32_t vendorID;
+        uint32_t deviceID;
+        std::array<uint8_t, VK_UUID_SIZE> pipelineCacheUUID;
+    };
+
+    auto data = bstring{};
+    try {
+        auto file = tt::file(pipeline_cache_location(), access_mode::open_for_read);
+        data = file.read_bstring();
+
+    } catch (io_error const &e) {
+        tt_log_info("Could not read pipeline cache file. \"{}\"", e.what());
+    }
+
+    // Some drivers do not validate the cache data, so make sure it was created by this device and driver.
+    if (data.size() >= sizeof(pipeline_cache_header)) {
+        auto header = pipeline_cache_header{};
+        std::memcpy(&header, data.data(), sizeof(pipeline_cache_header));
+
+        if (header.version != VK_PIPELINE_CACHE_HEADER_VERSION_ONE || header.vendorID != physicalProperties.vendorID ||
+            header.deviceID != physicalProperties.deviceID ||
+            not std::equal(
+                header.pipelineCacheUUID.cbegin(),
+                header.pipelineCacheUUID.cend(),
+                std::begin(physicalProperties.pipelineCacheUUID))) {
+            tt_log_info("Ignoring pipeline cache file from a different device or driver.");
+            data.clear();
+        }
+    } else {
+        data.clear();
+    }
+
+    pipelineCache = intrinsic.createPipelineCache({vk::PipelineCacheCreateFlags(), data.size(), data.data()});
+}
+
+void gui_device_vulkan::destroy_pipeline_cache()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    ttlet location = pipeline_cache_location();
+    ttlet tmp_location = location.urlByAppendingExtension(".tmp");
+
+    try {
+        ttlet data = intrinsic.getPipelineCacheData(pipelineCache);
+
+        auto file = tt::file(
+            tmp_location, access_mode::truncate_or_create_for_write | access_mode::rename | access_mode::create_directories);
+        file.write(data.data(), std::ssize(data));
+        file.flush();
+        file.rename(location, true);
+
+    } catch (io_error const &e) {
+        tt_log_error("Could not save pipeline cache file. \"{}\"", e.what());
+    }
+
+    intrinsic.destroy(pipelineCache);
+    pipelineCache = vk::PipelineCache{};
+}
+
 std::vector<std::pair<uint32_t, uint8_t>> gui_device_vulkan::find_best_queue_family_indices(vk::SurfaceKHR surface) const
 {
     tt_axiom(gui_system_mutex.recurse_lock_count());
@@ -394,7 +713,7 @@ std::vector<std::pair<uint32_t, uint8_t>> gui_device_vulkan::find_best_queue_fam
             if (queueFamilyProperties.queueFlags & vk::QueueFlagBits::eGraphics) {
                 capabilities |= QUEUE_CAPABILITY_GRAPHICS;
             }
-            if (physicalIntrinsic.getSurfaceSupportKHR(index, surface)) {
+            if (surface && physicalIntrinsic.getSurfaceSupportKHR(index, surface)) {
                 capabilities |= QUEUE_CAPABILITY_PRESENT;
             }
             if (queueFamilyProperties.queueFlags & vk::QueueFlagBits::eCompute) {
@@ -435,8 +754,11 @@ int gui_device_vulkan::score(vk::SurfaceKHR surface) const
 {
     tt_axiom(gui_system_mutex.recurse_lock_count());
 
-    auto formats = physicalIntrinsic.getSurfaceFormatsKHR(surface);
-    auto presentModes = physicalIntrinsic.getSurfacePresentModesKHR(surface);
+    // A headless window has no surface; it renders into its own images and does not present.
+    ttlet isHeadless = !surface;
+
+    auto formats = isHeadless ? std::vector<vk::SurfaceFormatKHR>{} : physicalIntrinsic.getSurfaceFormatsKHR(surface);
+    auto presentModes = isHeadless ? std::vector<vk::PresentModeKHR>{} : physicalIntrinsic.getSurfacePresentModesKHR(surface);
     queueFamilyIndicesAndCapabilities = find_best_queue_family_indices(surface);
 
     tt_log_info("Scoring device: {}", string());
@@ -461,6 +783,14 @@ int gui_device_vulkan::score(vk::SurfaceKHR surface) const
     }
     tt_log_info(" - Capabilities={:03b}", deviceCapabilities);
 
+    if (isHeadless) {
+        if (!(deviceCapabilities & QUEUE_CAPABILITY_GRAPHICS)) {
+            tt_log_info(" - Does not have a graphics queue.");
+            return -1;
+        }
+        return score_device_type() + score_device_memory();
+    }
+
     if ((deviceCapabilities & QUEUE_CAPABILITY_GRAPHICS_AND_PRESENT) != QUEUE_CAPABILITY_GRAPHICS_AND_PRESENT) {
         tt_log_info(" - Does not have both the graphics and compute queues.");
         return -1;
@@ -550,18 +880,48 @@ int gui_device_vulkan::score(vk::SurfaceKHR surface) const
         return 0;
     }
 
+    return narrow_cast<int>(totalScore) + score_device_type() + score_device_memory();
+}
+
+int gui_device_vulkan::score_device_type() const
+{
     // Give score based on the performance of the device.
+    // The steps are larger than the memory score, so that the type of device is more important.
     ttlet properties = physicalIntrinsic.getProperties();
-    tt_log_info(" - Type of device: {}", vk::to_string(properties.deviceType));
+    ttlet on_battery_power = system.is_on_battery_power();
+    tt_log_info(" - Type of device: {}, on battery power: {}", vk::to_string(properties.deviceType), on_battery_power);
     switch (properties.deviceType) {
-    case vk::PhysicalDeviceType::eCpu: totalScore += 1; break;
-    case vk::PhysicalDeviceType::eOther: totalScore += 1; break;
-    case vk::PhysicalDeviceType::eVirtualGpu: totalScore += 2; break;
-    case vk::PhysicalDeviceType::eIntegratedGpu: totalScore += 3; break;
-    case vk::PhysicalDeviceType::eDiscreteGpu: totalScore += 4; break;
+    case vk::PhysicalDeviceType::eCpu: return 10;
+    case vk::PhysicalDeviceType::eOther: return 10;
+    case vk::PhysicalDeviceType::eVirtualGpu: return 20;
+    // An integrated GPU uses a lot less power than a discrete GPU.
+    case vk::PhysicalDeviceType::eIntegratedGpu: return on_battery_power ? 50 : 30;
+    case vk::PhysicalDeviceType::eDiscreteGpu: return 40;
+    default: return 0;
     }
+}
+
+int gui_device_vulkan::score_device_memory() const
+{
+    ttlet properties = physicalIntrinsic.getMemoryProperties();
 
-    return totalScore;
+    auto budgets = std::array<VmaBudget, VK_MAX_MEMORY_HEAPS>{};
+    ttlet has_budget = state == state_type::ready_to_draw and supportsMemoryBudget;
+    if (has_budget) {
+        vmaGetBudget(allocator, budgets.data());
+    }
+
+    auto available = uint64_t{0};
+    for (uint32_t heapIndex = 0; heapIndex != properties.memoryHeapCount; ++heapIndex) {
+        ttlet &heap = properties.memoryHeaps[heapIndex];
+        if (heap.flags & vk::MemoryHeapFlagBits::eDeviceLocal) {
+            available = std::max(available, has_budget ? uint64_t{budgets[heapIndex].budget} : uint64_t{heap.size});
+        }
+    }
+
+    ttlet score = narrow_cast<int>(std::min(available >> 30, uint64_t{4}));
+    tt_log_info(" - Device-local memory: {} MiB, score={}", available >> 20, score);
+    return score;
 }
 
 int gui_device_vulkan::score(gui_window const &window) const
@@ -599,6 +959,66 @@ void gui_device_vulkan::destroyBuffer(const vk::Buffer &buffer, const VmaAllocat
     vmaDestroyBuffer(allocator, buffer, allocation);
 }
 
+[[nodiscard]] gui_device_vulkan::pooled_vertex_buffer gui_device_vulkan::acquire_vertex_buffer(vk::DeviceSize size)
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    for (auto &vertex_buffer : vertexBufferPool) {
+        if (!vertex_buffer.in_use and vertex_buffer.size == size) {
+            increment_counter<"vertex_buffer_reuse">();
+            vertex_buffer.in_use = true;
+            return vertex_buffer;
+        }
+    }
+
+    vk::BufferCreateInfo const bufferCreateInfo = {
+        vk::BufferCreateFlags(), size, vk::BufferUsageFlagBits::eVertexBuffer, vk::SharingMode::eExclusive};
+    VmaAllocationCreateInfo allocationCreateInfo = {};
+    allocationCreateInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
+
+    ttlet[buffer, allocation] = createBuffer(bufferCreateInfo, allocationCreateInfo);
+    add_to_counter<"vertex_buffer_bytes">(allocationSize(allocation));
+
+    vertexBufferPool.push_back({buffer, allocation, mapMemory<std::byte>(allocation), size, true});
+    return vertexBufferPool.back();
+}
+
+void gui_device_vulkan::release_vertex_buffer(vk::Buffer buffer) noexcept
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    ttlet it = std::find_if(vertexBufferPool.begin(), vertexBufferPool.end(), [buffer](ttlet &item) {
+        return item.buffer == buffer;
+    });
+    tt_axiom(it != vertexBufferPool.end() and it->in_use);
+    it->in_use = false;
+
+    ttlet nr_unused = std::count_if(vertexBufferPool.cbegin(), vertexBufferPool.cend(), [](ttlet &item) {
+        return !item.in_use;
+    });
+    if (narrow_cast<size_t>(nr_unused) > maximum_nr_unused_vertex_buffers) {
+        destroy_vertex_buffer(*it);
+        vertexBufferPool.erase(it);
+    }
+}
+
+void gui_device_vulkan::destroy_vertex_buffer(pooled_vertex_buffer const &vertex_buffer) noexcept
+{
+    unmapMemory(vertex_buffer.allocation);
+    add_to_counter<"vertex_buffer_bytes">(-allocationSize(vertex_buffer.allocation));
+    destroyBuffer(vertex_buffer.buffer, vertex_buffer.allocation);
+}
+
+void gui_device_vulkan::destroy_vertex_buffer_pool() noexcept
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    for (ttlet &vertex_buffer : vertexBufferPool) {
+        destroy_vertex_buffer(vertex_buffer);
+    }
+    vertexBufferPool.clear();
+}
+
 std::pair<vk::Image, VmaAllocation> gui_device_vulkan::createImage(
     const vk::ImageCreateInfo &imageCreateInfo,
     const VmaAllocationCreateInfo &allocationCreateInfo) const
@@ -666,6 +1086,83 @@ void gui_device_vulkan::endSingleTimeCommands(vk::CommandBuffer commandBuffer) c
     intrinsic.freeCommandBuffers(graphicsCommandPool, commandBuffers);
 }
 
+vk::CommandBuffer gui_device_vulkan::beginTransferCommands() const
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    ttlet commandBuffers = intrinsic.allocateCommandBuffers({transferCommandPool, vk::CommandBufferLevel::ePrimary, 1});
+    ttlet commandBuffer = commandBuffers.at(0);
+
+    commandBuffer.begin({vk::CommandBufferUsageFlagBits::eOneTimeSubmit});
+    return commandBuffer;
+}
+
+uint64_t gui_device_vulkan::endTransferCommands(vk::CommandBuffer commandBuffer) const
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    commandBuffer.end();
+
+    if (!transferTimeline) {
+        // Without timeline semaphores the transfer is completed before returning.
+        transferQueue.submit({{0, nullptr, nullptr, 1, &commandBuffer, 0, nullptr}}, vk::Fence());
+        transferQueue.waitIdle();
+        intrinsic.freeCommandBuffers(transferCommandPool, commandBuffer);
+        return 0;
+    }
+
+    ttlet value = ++transferTimelineValue;
+    ttlet timelineSubmitInfo = vk::TimelineSemaphoreSubmitInfo{0, nullptr, 1, &value};
+
+    auto submitInfo = vk::SubmitInfo{
+        0,
+        nullptr,
+        nullptr, // wait semaphores, wait stages
+        1,
+        &commandBuffer,
+        1,
+        &transferTimeline // signal semaphores
+    };
+    submitInfo.pNext = &timelineSubmitInfo;
+    transferQueue.submit(submitInfo, vk::Fence());
+
+    transferCommandBuffersInFlight.emplace_back(value, commandBuffer);
+    free_completed_transfer_commands();
+    return value;
+}
+
+[[nodiscard]] bool gui_device_vulkan::isTransferCompleted(uint64_t value) const
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    if (!transferTimeline || value == 0) {
+        return true;
+    }
+    return intrinsic.getSemaphoreCounterValue(transferTimeline) >= value;
+}
+
+void gui_device_vulkan::waitForTransfer(uint64_t value) const
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    if (isTransferCompleted(value)) {
+        return;
+    }
+
+    [[maybe_unused]] ttlet result =
+        intrinsic.waitSemaphores({vk::SemaphoreWaitFlags(), 1, &transferTimeline, &value}, std::numeric_limits<uint64_t>::max());
+}
+
+void gui_device_vulkan::free_completed_transfer_commands() const
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    while (!transferCommandBuffersInFlight.empty() && isTransferCompleted(transferCommandBuffersInFlight.front().first)) {
+        intrinsic.freeCommandBuffers(transferCommandPool, transferCommandBuffersInFlight.front().second);
+        transferCommandBuffersInFlight.pop_front();
+    }
+}
+
 static std::pair<vk::AccessFlags, vk::PipelineStageFlags> access_and_stage_from_layout(vk::ImageLayout layout) noexcept
 {
     switch (layout) {
@@ -11,8 +11,14 @@
 #include "pipeline_box_device_shared.hpp"
 #include "pipeline_SDF_device_shared.hpp"
 #include "pipeline_tone_mapper_device_shared.hpp"
+#include "../URL.hpp"
+#include "../hires_utc_clock.hpp"
 #include <vulkan/vulkan.hpp>
 #include <vk_mem_alloc.h>
+#include <deque>
+#include <optional>
+#include <span>
+#include <chrono>
 
 namespace tt {
 class URL;
@@ -38,6 +44,38 @@ public:
     vk::CommandPool presentCommandPool;
     vk::CommandPool computeCommandPool;
 
+    /** The number of valid bits in a timestamp written on the graphics queue.
+     * Zero when the graphics queue does not support timestamps.
+     */
+    uint32_t graphicsTimestampValidBits = 0;
+
+    /** The queue used for uploading to images.
+     * This is a queue from a transfer-only queue family when the device has one,
+     * otherwise it is the graphics queue.
+     */
+    uint32_t transferQueueFamilyIndex = 0;
+    vk::Queue transferQueue;
+    vk::CommandPool transferCommandPool;
+
+    /** Uploads are done on a queue family separate from the graphics queue family.
+     */
+    bool hasDedicatedTransferQueue = false;
+
+    /** The queue families that need to access images written by the transfer queue.
+     * Images that are written by the transfer queue and sampled by the graphics queue are
+     * created with concurrent sharing when this contains more than one queue family.
+     */
+    std::vector<uint32_t> transferSharingQueueFamilyIndices;
+
+    /** Timeline semaphore that is signaled when a transfer has completed.
+     * Empty when the device does not support timeline semaphores.
+     */
+    vk::Semaphore transferTimeline;
+
+    /** The value of transferTimeline that is signaled by the last submitted transfer.
+     */
+    mutable uint64_t transferTimelineValue = 0;
+
     /** Shared index buffer containing indices for drawing quads.
      * The index buffer uses the following index order: 0, 1, 2, 2, 1, 3
      * ```
@@ -51,16 +89,51 @@ public:
     vk::Buffer quadIndexBuffer;
     VmaAllocation quadIndexBufferAllocation = {};
 
-    std::unique_ptr<pipeline_flat::device_shared> flatPipeline;
-    std::unique_ptr<pipeline_box::device_shared> boxPipeline;
-    std::unique_ptr<pipeline_image::device_shared> imagePipeline;
-    std::unique_ptr<pipeline_SDF::device_shared> SDFPipeline;
-    std::unique_ptr<pipeline_tone_mapper::device_shared> toneMapperPipeline;
+    /** Pipeline cache shared by the pipelines of all windows on this device.
+     * The cache is loaded from, and saved to, a file keyed by the device UUID and driver version.
+     */
+    vk::PipelineCache pipelineCache;
+
+    /** Get the resources of a pipeline that are shared by all windows on this device.
+     * The shaders and atlases of a pipeline are created the first time they are needed,
+     * so that the memory of an atlas is only used when something is drawn with its pipeline.
+     */
+    [[nodiscard]] pipeline_flat::device_shared &flat_pipeline();
+    [[nodiscard]] pipeline_box::device_shared &box_pipeline();
+    [[nodiscard]] pipeline_image::device_shared &image_pipeline();
+    [[nodiscard]] pipeline_SDF::device_shared &SDF_pipeline();
+    [[nodiscard]] pipeline_tone_mapper::device_shared &tone_mapper_pipeline();
+
+    /** Check if the shared resources of the SDF pipeline have been created.
+     */
+    [[nodiscard]] bool has_SDF_pipeline() const noexcept
+    {
+        return static_cast<bool>(_SDF_pipeline);
+    }
 
     /*! List if extension required on this device.
      */
     std::vector<const char *> requiredExtensions;
 
+    /** The device supports VK_KHR_incremental_present, which is enabled when available.
+     * This allows a window to tell the compositor which parts of the image have changed.
+     */
+    bool supportsIncrementalPresent = false;
+
+    /** The device supports VK_EXT_memory_budget, which is enabled when available.
+     * The allocator will then use the memory budget reported by the driver, instead of an estimate.
+     */
+    bool supportsMemoryBudget = false;
+
+    /** The fraction of the budget of a heap, above which the atlases are asked to release memory.
+     * This gives the atlases a chance to evict before the driver starts paging memory out of the heap.
+     */
+    static constexpr double memoryBudgetSoftLimit = 0.9;
+
+    /** The interval between samples of the memory budget.
+     */
+    static constexpr std::chrono::milliseconds memoryBudgetSampleInterval = std::chrono::milliseconds(1000);
+
     bool supportsLazyTransientImages = false;
     vk::ImageUsageFlags transientImageUsageFlags = vk::ImageUsageFlags{};
     VmaMemoryUsage lazyMemoryUsage = VMA_MEMORY_USAGE_GPU_ONLY;
@@ -90,6 +163,9 @@ public:
 
     void initialize_device(gui_window const &window) override;
 
+    /** Score the device for rendering to a surface.
+     * @param surface The surface of a window, or empty for a headless window.
+     */
     int score(vk::SurfaceKHR surface) const;
 
     int score(gui_window const &window) const override;
@@ -108,6 +184,41 @@ public:
 
     void destroyBuffer(const vk::Buffer &buffer, const VmaAllocation &allocation) const;
 
+    /** A mapped host-visible vertex buffer, recycled between the windows of this device.
+     */
+    struct pooled_vertex_buffer {
+        vk::Buffer buffer;
+        VmaAllocation allocation;
+        std::span<std::byte> mapping;
+
+        /** The size in bytes that was requested for the buffer.
+         */
+        vk::DeviceSize size;
+
+        bool in_use;
+
+        template<typename T>
+        [[nodiscard]] std::span<T> mapping_as() const noexcept
+        {
+            return {reinterpret_cast<T *>(mapping.data()), mapping.size() / sizeof(T)};
+        }
+    };
+
+    /** Get a vertex buffer from the pool, or create one when there is no unused buffer of this size.
+     *
+     * The vertex buffers of a window are returned to the pool when the window is closed or moved
+     * to another device, so that opening another window does not create and map new buffers.
+     *
+     * @param size The size of the buffer in bytes.
+     * @return The buffer, which stays mapped while it is in the pool.
+     */
+    [[nodiscard]] pooled_vertex_buffer acquire_vertex_buffer(vk::DeviceSize size);
+
+    /** Return a vertex buffer to the pool.
+     * @pre The buffer was acquired from this device, and the GPU is no longer using it.
+     */
+    void release_vertex_buffer(vk::Buffer buffer) noexcept;
+
     std::pair<vk::Image, VmaAllocation>
     createImage(const vk::ImageCreateInfo &imageCreateInfo, const VmaAllocationCreateInfo &allocationCreateInfo) const;
     void destroyImage(const vk::Image &image, const VmaAllocation &allocation) const;
@@ -115,6 +226,28 @@ public:
     vk::CommandBuffer beginSingleTimeCommands() const;
     void endSingleTimeCommands(vk::CommandBuffer commandBuffer) const;
 
+    /** Begin recording commands for the transfer queue.
+     */
+    vk::CommandBuffer beginTransferCommands() const;
+
+    /** Submit commands to the transfer queue.
+     * This does not wait for the commands to complete; the graphics queue waits on
+     * the transfer timeline before rendering the next frame.
+     *
+     * @return The value of transferTimeline that is signaled when the commands have completed.
+     */
+    uint64_t endTransferCommands(vk::CommandBuffer commandBuffer) const;
+
+    /** Check if a transfer has completed.
+     * @param value A value returned by `endTransferCommands()`.
+     */
+    [[nodiscard]] bool isTransferCompleted(uint64_t value) const;
+
+    /** Wait until a transfer has completed.
+     * @param value A value returned by `endTransferCommands()`.
+     */
+    void waitForTransfer(uint64_t value) const;
+
     static void transition_layout(
         vk::CommandBuffer command_buffer,
         vk::Image image,
@@ -155,6 +288,27 @@ public:
 
     void unmapMemory(const VmaAllocation &allocation) const;
 
+    /** The number of bytes of device memory used by an allocation.
+     */
+    [[nodiscard]] int64_t allocationSize(VmaAllocation allocation) const noexcept
+    {
+        VmaAllocationInfo allocationInfo;
+        vmaGetAllocationInfo(allocator, allocation, &allocationInfo);
+        return narrow_cast<int64_t>(allocationInfo.size);
+    }
+
+    /** Sample the memory budget of each heap.
+     *
+     * This is called by each window when it renders, the budget is sampled at most once every
+     * `memoryBudgetSampleInterval`. The usage and budget are reported through the counters:
+     * "gpu_local_usage", "gpu_local_budget", "gpu_host_usage" and "gpu_host_budget".
+     *
+     * When the usage of a heap is above `memoryBudgetSoftLimit` the atlases are asked to release memory.
+     *
+     * @param displayTimePoint The time when the frame being rendered will be displayed.
+     */
+    void update_memory_budget(hires_utc_clock::time_point displayTimePoint) noexcept;
+
     void flushAllocation(const VmaAllocation &allocation, VkDeviceSize offset, VkDeviceSize size) const
     {
         tt_axiom(gui_system_mutex.recurse_lock_count());
@@ -272,6 +426,29 @@ public:
         return intrinsic.createGraphicsPipeline(pipelineCache, createInfo).value;
     }
 
+    vk::QueryPool createQueryPool(const vk::QueryPoolCreateInfo &createInfo) const
+    {
+        tt_axiom(gui_system_mutex.recurse_lock_count());
+        return intrinsic.createQueryPool(createInfo);
+    }
+
+    /** Read the 64-bit results of queries, without waiting.
+     * @return True if all results were available.
+     */
+    bool getQueryPoolResults(vk::QueryPool queryPool, uint32_t firstQuery, std::span<uint64_t> results) const
+    {
+        tt_axiom(gui_system_mutex.recurse_lock_count());
+        ttlet result = intrinsic.getQueryPoolResults(
+            queryPool,
+            firstQuery,
+            narrow_cast<uint32_t>(results.size()),
+            results.size_bytes(),
+            results.data(),
+            sizeof(uint64_t),
+            vk::QueryResultFlagBits::e64);
+        return result == vk::Result::eSuccess;
+    }
+
     vk::Sampler createSampler(const vk::SamplerCreateInfo &createInfo) const
     {
         tt_axiom(gui_system_mutex.recurse_lock_count());
@@ -290,6 +467,21 @@ public:
         return intrinsic.allocateCommandBuffers(allocateInfo);
     }
 
+    vk::CommandPool createCommandPool(const vk::CommandPoolCreateInfo &createInfo) const
+    {
+        tt_axiom(gui_system_mutex.recurse_lock_count());
+        return intrinsic.createCommandPool(createInfo);
+    }
+
+    /** Reset a command pool, returning all its command buffers to the initial state.
+     * @pre None of the command buffers allocated from the pool are in use by the GPU.
+     */
+    void resetCommandPool(vk::CommandPool commandPool) const
+    {
+        tt_axiom(gui_system_mutex.recurse_lock_count());
+        intrinsic.resetCommandPool(commandPool, vk::CommandPoolResetFlags());
+    }
+
     void updateDescriptorSets(
         vk::ArrayProxy<const vk::WriteDescriptorSet> descriptorWrites,
         vk::ArrayProxy<const vk::CopyDescriptorSet> descriptorCopies) const
@@ -323,8 +515,74 @@ protected:
     VmaAllocator allocator;
 
 private:
+    /** Score the performance of the device based on its type.
+     * When the computer is running on battery power an integrated GPU scores higher than a discrete GPU.
+     */
+    [[nodiscard]] int score_device_type() const;
+
+    /** Score the device on the amount of device-local memory, up to 4 points for 4 GiB.
+     * When the device is initialized the memory budget reported by the driver is used.
+     */
+    [[nodiscard]] int score_device_memory() const;
+
     void initialize_quad_index_buffer();
     void destroy_quad_index_buffer();
+
+    /** The location of the pipeline cache file for this device and driver.
+     */
+    [[nodiscard]] URL pipeline_cache_location() const noexcept;
+
+    void initialize_pipeline_cache();
+    void destroy_pipeline_cache();
+
+    /** The maximum number of unused vertex buffers that are kept in the pool.
+     * Enough for the pipelines of a few windows with three frames-in-flight.
+     */
+    static constexpr size_t maximum_nr_unused_vertex_buffers = 16;
+
+    /** The vertex buffers created by `acquire_vertex_buffer()`, both in use and unused.
+     */
+    std::vector<pooled_vertex_buffer> vertexBufferPool;
+
+    void destroy_vertex_buffer(pooled_vertex_buffer const &vertex_buffer) noexcept;
+    void destroy_vertex_buffer_pool() noexcept;
+
+    /** Command buffers submitted to the transfer queue, with the timeline value that signals their completion.
+     */
+    mutable std::deque<std::pair<uint64_t, vk::CommandBuffer>> transferCommandBuffersInFlight;
+
+    /** Find a transfer-only queue family, which can copy to any offset of an image.
+     * @return The index of the queue family, or std::nullopt.
+     */
+    [[nodiscard]] std::optional<uint32_t> find_transfer_queue_family_index() const noexcept;
+
+    [[nodiscard]] bool supports_timeline_semaphores() const noexcept;
+
+    void initialize_transfer_queue(bool timeline_semaphores, std::optional<uint32_t> transfer_queue_family_index);
+    void destroy_transfer_queue();
+    void free_completed_transfer_commands() const;
+
+    /** The time when the memory budget is sampled next.
+     */
+    hires_utc_clock::time_point nextMemoryBudgetSample = {};
+
+    /** The frame index given to the allocator, each sample uses a different index so that the budget is refreshed.
+     */
+    uint32_t memoryBudgetFrameIndex = 0;
+
+    /** Set when a heap was over its soft limit during the previous sample.
+     */
+    bool memoryIsOverSoftLimit = false;
+
+    /** Release memory held by the atlases, because a heap is over its soft limit.
+     */
+    void handle_memory_pressure() noexcept;
+
+    std::unique_ptr<pipeline_flat::device_shared> _flat_pipeline;
+    std::unique_ptr<pipeline_box::device_shared> _box_pipeline;
+    std::unique_ptr<pipeline_image::device_shared> _image_pipeline;
+    std::unique_ptr<pipeline_SDF::device_shared> _SDF_pipeline;
+    std::unique_ptr<pipeline_tone_mapper::device_shared> _tone_mapper_pipeline;
 };
 
 } // namespace tt
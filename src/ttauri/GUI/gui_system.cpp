@@ -38,6 +38,54 @@ gui_device *gui_system::findBestDeviceForWindow(gui_window const &window)
     }
 }
 
+void gui_system::reevaluate_devices()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    // Collect the windows first, since moving a window modifies the list of windows of a device.
+    auto windows = std::vector<std::pair<gui_device *, std::shared_ptr<gui_window>>>{};
+    for (ttlet &device : devices) {
+        for (ttlet &window : device->managed_windows()) {
+            windows.emplace_back(device.get(), window);
+        }
+    }
+
+    for (ttlet &[current_device, window] : windows) {
+        if (window->is_closed()) {
+            continue;
+        }
+
+        ttlet current_score = current_device->score(*window);
+
+        auto best_score = current_score;
+        gui_device *best_device = current_device;
+        for (ttlet &device : devices) {
+            if (device.get() == current_device) {
+                continue;
+            }
+
+            ttlet score = device->score(*window);
+            if (score > best_score) {
+                best_score = score;
+                best_device = device.get();
+            }
+        }
+
+        if (best_device != current_device and best_score >= current_score + device_migration_cost) {
+            tt_log_info(
+                "Moving window from gui_device {} with score={} to {} with score={}.",
+                current_device->string(),
+                current_score,
+                best_device->string(),
+                best_score);
+
+            // Score the new device last, so that it uses the queue families and surface format of this window.
+            [[maybe_unused]] ttlet score = best_device->score(*window);
+            best_device->add(current_device->remove(*window));
+        }
+    }
+}
+
 ssize_t gui_system::num_windows()
 {
     ttlet lock = std::scoped_lock(gui_system_mutex);
@@ -57,5 +105,12 @@ void gui_system::_handlevertical_sync(void *data, hires_utc_clock::time_point di
     self->handlevertical_sync(displayTimePoint);
 }
 
+void gui_system::_handle_posted_notifications() noexcept
+{
+    if (global) {
+        global->request_frame();
+    }
+}
+
 
 }
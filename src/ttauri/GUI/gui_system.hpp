@@ -7,14 +7,17 @@
 #include "gui_device.hpp"
 #include "gui_window.hpp"
 #include "gui_window_vulkan_win32.hpp"
+#include "gui_window_vulkan_headless.hpp"
 #include "vertical_sync.hpp"
 #include "gui_system_delegate.hpp"
 #include "../unfair_recursive_mutex.hpp"
+#include "../notifier.hpp"
 #include <span>
 #include <memory>
 #include <mutex>
 #include <thread>
 #include <vector>
+#include <atomic>
 
 namespace tt {
 
@@ -36,6 +39,14 @@ public:
      */
     os_handle instance;
 
+    /** The amount a device must score higher than the current device of a window, before the window is moved.
+     *
+     * Moving a window tears down its swapchain and rebuilds it on the other device, and the glyphs
+     * and images of the window need to be uploaded again into the atlases of the other device.
+     * This prevents windows from moving between devices that score almost the same.
+     */
+    static constexpr int device_migration_cost = 5;
+
     /*! Keep track of the numberOfWindows in the previous render cycle.
      * This way we can call closedLastWindow on the application once.
      */
@@ -45,9 +56,11 @@ public:
         delegate(delegate), instance(instance)
     {
         verticalSync = std::make_unique<vertical_sync>(_handlevertical_sync, this);
+        detail::notifier_posted_wakeup.store(_handle_posted_notifications, std::memory_order::release);
     }
 
     virtual ~gui_system() {
+        detail::notifier_posted_wakeup.store(nullptr, std::memory_order::release);
         verticalSync = {};
     }
 
@@ -83,13 +96,65 @@ public:
         return window_ptr;
     }
 
+    /** Create a window that renders into offscreen images.
+     *
+     * The window is not shown on screen; the rendered image is retrieved with
+     * `gui_window_vulkan_headless::read_image()`.
+     */
+    template<typename... Args>
+    gui_window_vulkan_headless *make_headless_window(Args &&... args)
+    {
+        tt_assert(is_main_thread(), "createWindow should be called from the main thread.");
+        tt_axiom(gui_system_mutex.recurse_lock_count() == 0);
+
+        auto window = std::make_shared<gui_window_vulkan_headless>(static_cast<gui_system &>(*this), std::forward<Args>(args)...);
+        auto window_ptr = window.get();
+        window->init();
+
+        ttlet lock = std::scoped_lock(gui_system_mutex);
+        auto device = findBestDeviceForWindow(*window);
+        if (!device) {
+            throw gui_error("Could not find a vulkan-device for a headless window");
+        }
+
+        device->add(std::move(window));
+        return window_ptr;
+    }
+
     /*! Count the number of windows managed by the GUI.
      */
     ssize_t num_windows();
 
+    /** Check if the computer is running on battery power.
+     * When on battery power, devices that use less power are preferred.
+     */
+    [[nodiscard]] virtual bool is_on_battery_power() const noexcept
+    {
+        return false;
+    }
+
+    /** Request the devices of the windows to be scored again before the next frame.
+     *
+     * This should be called when the score of a device for a window may have changed,
+     * for example when the window moved to another monitor, or when the power source changed.
+     * This function may be called from any thread.
+     */
+    void request_device_reevaluation() noexcept
+    {
+        _device_reevaluation_requested.store(true, std::memory_order::relaxed);
+        request_frame();
+    }
+
     void render(hires_utc_clock::time_point displayTimePoint) {
+        // Coalesced notifications of observables are delivered once per frame, before the layout.
+        deliver_posted_notifications();
+
         ttlet lock = std::scoped_lock(gui_system_mutex);
 
+        if (_device_reevaluation_requested.exchange(false, std::memory_order::relaxed)) {
+            reevaluate_devices();
+        }
+
         for (auto &device: devices) {
             device->render(displayTimePoint);
         }
@@ -104,6 +169,20 @@ public:
         previousNumberOfWindows = currentNumberOfWindows;
     }
 
+    /** Request a frame to be rendered on all windows.
+     *
+     * The vertical-sync thread is parked while no frame is requested.
+     * This function may be called from any thread.
+     *
+     * @param time_point The time at or after which the frame should be rendered.
+     */
+    void request_frame(hires_utc_clock::time_point time_point = hires_utc_clock::time_point::min()) noexcept
+    {
+        if (verticalSync) {
+            verticalSync->request_frame(time_point);
+        }
+    }
+
     void handlevertical_sync(hires_utc_clock::time_point displayTimePoint)
     {
         render(displayTimePoint);
@@ -112,8 +191,20 @@ public:
 
     static void _handlevertical_sync(void *data, hires_utc_clock::time_point displayTimePoint);
 
+    static void _handle_posted_notifications() noexcept;
+
 protected:
     gui_device *findBestDeviceForWindow(gui_window const &window);
+
+    /** Move windows to the device with the best score.
+     *
+     * A window is only moved when the other device scores at least `device_migration_cost`
+     * higher than its current device.
+     */
+    void reevaluate_devices();
+
+private:
+    std::atomic<bool> _device_reevaluation_requested = false;
 };
 
 }
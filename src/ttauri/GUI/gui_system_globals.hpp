@@ -5,14 +5,28 @@
 #pragma once
 
 #include "../os_detect.hpp"
-#include "../unfair_recursive_mutex.hpp"
+#include "../unfair_recursive_shared_mutex.hpp"
+#include <shared_mutex>
 
 namespace tt {
 
 class gui_system;
 
 /** Global mutex for GUI elements, like gui_system, gui_device, Windows and Widgets.
+ *
+ * All windows are rendered from the vertical-sync thread while holding this mutex,
+ * one after another. Widgets, the theme and the device-shared resources, such as the
+ * glyph atlas, rely on this mutex; each `tt_axiom(gui_system_mutex.recurse_lock_count())`
+ * marks a function that does. Rendering windows on separate threads requires those
+ * to be protected by a lock per window or per device first.
+ *
+ * Paths that only read the widget tree, such as hit testing and finding the next
+ * keyboard widget, take a `std::shared_lock`; functions that are safe to call from them
+ * are marked with `tt_axiom(gui_system_mutex.recurse_shared_lock_count())`.
+ *
+ * Contention on this mutex is counted in the "gui_system_mutex:contended" and
+ * "gui_system_mutex:wait" counters.
  */
-inline unfair_recursive_mutex gui_system_mutex;
+inline unfair_recursive_shared_mutex_impl<"gui_system_mutex"> gui_system_mutex;
 
 }
@@ -61,7 +61,7 @@ public:
 
     vk::DispatchLoaderDynamic loader() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return _loader;
     }
 
@@ -19,5 +19,14 @@ gui_system_vulkan_win32::~gui_system_vulkan_win32()
 {
 }
 
+[[nodiscard]] bool gui_system_vulkan_win32::is_on_battery_power() const noexcept
+{
+    SYSTEM_POWER_STATUS status;
+    if (!GetSystemPowerStatus(&status)) {
+        return false;
+    }
+    return status.ACLineStatus == 0;
+}
+
 
 }
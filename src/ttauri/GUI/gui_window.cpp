@@ -4,8 +4,13 @@
 
 #include "gui_window.hpp"
 #include "gui_device.hpp"
+#include "gui_system.hpp"
 #include "keyboard_bindings.hpp"
+#include "RenderDoc.hpp"
 #include "../widgets/window_widget.hpp"
+#include "../counters.hpp"
+#include "../startup_profiler.hpp"
+#include "../trace.hpp"
 
 namespace tt {
 
@@ -63,6 +68,7 @@ void gui_window::init()
     // and therefor should not have a lock on the window.
     tt_assert(is_main_thread(), "createWindow should be called from the main thread.");
     tt_axiom(gui_system_mutex.recurse_lock_count() == 0);
+    ttlet phase = startup_phase{"gui_window::init"};
 
     widget = std::make_shared<window_widget>(*this, delegate, title);
     widget->init();
@@ -112,18 +118,23 @@ void gui_window::set_device(gui_device *new_device)
         teardown();
     }
 
+    // Retained vertices refer to atlas positions of the previous device.
+    ++_draw_cache_generation;
     _device = new_device;
+
+    // Render a frame to build the swapchain on the new device.
+    request_frame();
 }
 
 bool gui_window::is_closed()
 {
-    ttlet lock = std::scoped_lock(gui_system_mutex);
+    ttlet lock = std::shared_lock(gui_system_mutex);
     return state == gui_window_state::no_window;
 }
 
 [[nodiscard]] float gui_window::window_scale() const noexcept
 {
-    ttlet lock = std::scoped_lock(gui_system_mutex);
+    ttlet lock = std::shared_lock(gui_system_mutex);
 
     return std::ceil(dpi / 100.0f);
 }
@@ -139,6 +150,101 @@ void gui_window::window_changed_size(extent2 new_extent)
     requestLayout = true;
 }
 
+void gui_window::request_frame(hires_utc_clock::time_point time_point) noexcept
+{
+    system.request_frame(time_point);
+}
+
+void gui_window::request_animation(
+    std::weak_ptr<tt::widget> widget,
+    hires_utc_clock::time_point start_time_point,
+    hires_utc_clock::time_point end_time_point) noexcept
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+    tt_axiom(start_time_point <= end_time_point);
+
+    auto it = std::find_if(_animations.begin(), _animations.end(), [&widget](ttlet &item) {
+        return not item.widget.owner_before(widget) and not widget.owner_before(item.widget);
+    });
+
+    if (it == _animations.end()) {
+        _animations.push_back({std::move(widget), start_time_point, end_time_point});
+    } else {
+        it->start_time_point = start_time_point;
+        it->end_time_point = end_time_point;
+    }
+
+    request_frame(start_time_point);
+}
+
+void gui_window::check_slow_frame(tt::frame_statistics const &statistics) noexcept
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    if (not capture_slow_frames or statistics.cpu_duration <= slow_frame_budget) {
+        return;
+    }
+
+    increment_counter<"slow_frame">();
+
+    ttlet now = hires_utc_clock::now();
+    if (now - _slow_frame_capture_time_point < slow_frame_cooldown) {
+        return;
+    }
+    _slow_frame_capture_time_point = now;
+
+    tt_log_warning(
+        "Frame took {}, which is over the budget of {}.",
+        format_engineering(statistics.cpu_duration),
+        format_engineering(slow_frame_budget));
+
+    if (RenderDoc::global and RenderDoc::global->is_loaded()) {
+        RenderDoc::global->trigger_capture();
+        tt_log_info("Triggered a RenderDoc capture of the next frame.");
+    }
+
+    if (slow_frame_trace_location) {
+        try {
+            trace_recorder_dump(*slow_frame_trace_location);
+            tt_log_info("Dumped the trace flight-recorder to \"{}\".", slow_frame_trace_location->nativePath());
+        } catch (std::exception const &e) {
+            tt_log_error("Could not dump the trace flight-recorder. \"{}\"", e.what());
+        }
+    }
+}
+
+void gui_window::update_animations(hires_utc_clock::time_point display_time_point) noexcept
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    auto next_frame_time_point = hires_utc_clock::time_point::max();
+    std::erase_if(_animations, [&](ttlet &item) {
+        auto widget_ = item.widget.lock();
+        if (not widget_) {
+            return true;
+        }
+
+        if (display_time_point >= item.start_time_point) {
+            widget_->request_redraw();
+        } else {
+            next_frame_time_point = std::min(next_frame_time_point, item.start_time_point);
+            return false;
+        }
+
+        if (display_time_point >= item.end_time_point) {
+            return true;
+        } else {
+            // Keep rendering frames until the end of the animation.
+            next_frame_time_point = hires_utc_clock::time_point::min();
+            return false;
+        }
+    });
+
+    if (next_frame_time_point != hires_utc_clock::time_point::max()) {
+        request_frame(next_frame_time_point);
+    }
+}
+
 void gui_window::set_resize_border_priority(bool left, bool right, bool bottom, bool top) noexcept
 {
     ttlet lock = std::scoped_lock(gui_system_mutex);
@@ -260,6 +366,44 @@ bool gui_window::send_event(mouse_event const &event) noexcept
 {
     ttlet lock = std::scoped_lock(gui_system_mutex);
 
+    if (coalesce_mouse_events) {
+        if (_pending_mouse_event and _pending_mouse_event->merge(event)) {
+            increment_counter<"mouse_event_merged">();
+            return true;
+        }
+
+        // Other events must be handled after the pending event.
+        flush_mouse_events();
+
+        switch (event.type) {
+        case mouse_event::Type::Move:
+        case mouse_event::Type::Drag:
+        case mouse_event::Type::Wheel:
+            _pending_mouse_event = event;
+            request_frame();
+            return true;
+        default:;
+        }
+    }
+
+    return dispatch_event(event);
+}
+
+void gui_window::flush_mouse_events() noexcept
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    if (_pending_mouse_event) {
+        ttlet event = *_pending_mouse_event;
+        _pending_mouse_event.reset();
+        dispatch_event(event);
+    }
+}
+
+bool gui_window::dispatch_event(mouse_event const &event) noexcept
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
     switch (event.type) {
     case mouse_event::Type::Exited: // Mouse left window.
         update_mouse_target({});
@@ -267,6 +411,7 @@ bool gui_window::send_event(mouse_event const &event) noexcept
 
     case mouse_event::Type::ButtonDown:
     case mouse_event::Type::Move: {
+        increment_counter<"widget_hitbox_test">();
         ttlet hitbox = widget->hitbox_test(event.position);
         update_mouse_target(std::const_pointer_cast<tt::widget>(hitbox.widget.lock()), event.position);
 
@@ -298,7 +443,7 @@ bool gui_window::send_event(keyboard_event const &event) noexcept
 
     // If the keyboard event is not handled directly, convert the key event to a command.
     if (event.type == keyboard_event::Type::Key) {
-        ttlet commands = keyboardBindings.translate(event.key);
+        ttlet &commands = keyboardBindings.translate(event.key);
 
         ttlet handled = send_event_to_widget(target, commands);
 
@@ -309,6 +454,8 @@ bool gui_window::send_event(keyboard_event const &event) noexcept
             // potential duplicate gui_escape messages to all widgets that need it.
             if (command == command::gui_escape) {
                 update_keyboard_target({}, keyboard_focus_group::any);
+            } else if (command == command::gui_toggle_performance_overlay) {
+                widget->toggle_performance_overlay();
             }
         }
 
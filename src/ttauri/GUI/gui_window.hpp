@@ -15,14 +15,19 @@
 #include "subpixel_orientation.hpp"
 #include "keyboard_focus_direction.hpp"
 #include "keyboard_focus_group.hpp"
+#include "dirty_rectangles.hpp"
+#include "frame_statistics.hpp"
+#include "../widgets/flat_widget_tree.hpp"
 #include "../text/gstring.hpp"
 #include "../logger.hpp"
 #include "../geometry/axis_aligned_rectangle.hpp"
 #include "../hires_utc_clock.hpp"
 #include "../label.hpp"
+#include "../URL.hpp"
 #include <unordered_set>
 #include <memory>
 #include <mutex>
+#include <optional>
 
 namespace tt {
 class gui_device;
@@ -68,6 +73,15 @@ public:
      */
     std::atomic<bool> active = false;
 
+    /** Merge mouse move, drag and wheel events until the next frame.
+     *
+     * When enabled, consecutive move, drag and wheel events that are received between frames
+     * are merged into a single event with the latest position and the accumulated wheel delta.
+     * The merged event is sent before any other mouse event and before the next frame is rendered,
+     * so that the order of the events is maintained.
+     */
+    bool coalesce_mouse_events = false;
+
     /*! Current size state of the window.
      */
     gui_window_size size_state = gui_window_size::normal;
@@ -93,6 +107,43 @@ public:
     //! The widget covering the complete window.
     std::shared_ptr<window_widget> widget;
 
+    /** Draw widgets in retained mode.
+     * When enabled, a widget that did not request a redraw since the previous frame
+     * will copy the vertices it placed during the previous frame, instead of drawing
+     * itself again.
+     */
+    bool retained_mode = false;
+
+    /** The statistics of the most recently rendered frames.
+     * Shown by the performance overlay of the window.
+     */
+    frame_statistics_history frame_history;
+
+    /** Leave a diagnostic artifact behind when a frame takes longer than `slow_frame_budget`.
+     *
+     * On a slow frame:
+     *  - A RenderDoc capture is triggered when the application runs under RenderDoc. This captures
+     *    the next frame, since the slow frame itself has already been presented.
+     *  - The trace flight-recorder is dumped to `slow_frame_trace_location` when it is set. The
+     *    recorder must have been started with `trace_recorder_start()`.
+     *
+     * At most one artifact is left per `slow_frame_cooldown`, so that a burst of slow frames,
+     * including those slowed down by writing the artifact, does not flood the disk.
+     */
+    bool capture_slow_frames = false;
+
+    /** The CPU time of a frame after which it is handled as a slow frame.
+     * The default is twice the refresh interval of a 60 Hz display.
+     */
+    hires_utc_clock::duration slow_frame_budget = std::chrono::milliseconds(33);
+
+    /** The file to dump the trace flight-recorder to on a slow frame.
+     * Each dump replaces the previous one, so the file contains the traces around the last slow frame.
+     */
+    std::optional<URL> slow_frame_trace_location;
+
+    static constexpr hires_utc_clock::duration slow_frame_cooldown = std::chrono::seconds(10);
+
     gui_window(gui_system &system, std::weak_ptr<gui_window_delegate> const &delegate, label const &title);
     virtual ~gui_window();
 
@@ -109,22 +160,88 @@ public:
      */
     virtual void init();
 
+    /** Request the gui_system to render a frame.
+     *
+     * Widgets that change their constraints, layout or drawing need a frame to be rendered,
+     * since no frames are rendered while nothing changes.
+     *
+     * @param time_point The time at or after which the frame should be rendered.
+     */
+    void request_frame(hires_utc_clock::time_point time_point = hires_utc_clock::time_point::min()) noexcept;
+
     /** Request a rectangle on the window to be redrawn
      */
     void request_redraw(aarectangle rectangle) noexcept
     {
         tt_axiom(gui_system_mutex.recurse_lock_count());
-        _request_redraw_rectangle |= rectangle;
+        _request_redraw_rectangles |= rectangle;
+        ++_redraw_request_count;
+        request_frame();
     }
 
-    /** Request a rectangle on the window to be redrawn
+    /** Request the complete window to be redrawn.
+     * This will also invalidate all the retained vertices of the widgets.
      */
     void request_redraw() noexcept
     {
         tt_axiom(gui_system_mutex.recurse_lock_count());
+        ++_draw_cache_generation;
         request_redraw(aarectangle{extent});
     }
 
+    /** Request a widget to be redrawn on every frame during an animation.
+     *
+     * The window only requests frames while an animation is active; outside the animations
+     * no frames are rendered for the widget. A widget that only needs to be redrawn once
+     * at a certain time, such as a blinking caret, passes the same time for the start and end.
+     *
+     * A new request from the same widget replaces its previous request.
+     *
+     * @param widget The widget to redraw.
+     * @param start_time_point The time of the first frame of the animation.
+     * @param end_time_point The time of the last frame of the animation.
+     */
+    void request_animation(
+        std::weak_ptr<tt::widget> widget,
+        hires_utc_clock::time_point start_time_point,
+        hires_utc_clock::time_point end_time_point) noexcept;
+
+    /** The flattened widget tree of this window.
+     * The tree is rebuilt and culled before the widgets are drawn.
+     */
+    [[nodiscard]] flat_widget_tree const &widget_tree() const noexcept
+    {
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
+        return _widget_tree;
+    }
+
+    /** Rebuild the flattened widget tree before the next frame is drawn.
+     * This must be called when a widget is added or removed.
+     */
+    void invalidate_widget_tree() noexcept
+    {
+        tt_axiom(gui_system_mutex.recurse_lock_count());
+        _widget_tree.invalidate();
+    }
+
+    /** The number of times a redraw was requested.
+     * Used to detect if a widget requested a redraw while it was drawing.
+     */
+    [[nodiscard]] size_t redraw_request_count() const noexcept
+    {
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
+        return _redraw_request_count;
+    }
+
+    /** The generation of the retained vertices of the widgets.
+     * Retained vertices from an older generation must not be replayed.
+     */
+    [[nodiscard]] size_t draw_cache_generation() const noexcept
+    {
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
+        return _draw_cache_generation;
+    }
+
     /** By how much the font needs to be scaled compared to current windowScale.
      * Widgets should pass this value to the text-shaper.
      */
@@ -147,7 +264,7 @@ public:
 
     gui_device *device() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return _device;
     }
 
@@ -284,7 +401,12 @@ protected:
 
     bool _request_setting_change = true;
 
-    aarectangle _request_redraw_rectangle = aarectangle{};
+    dirty_rectangles _request_redraw_rectangles;
+
+    size_t _redraw_request_count = 0;
+    size_t _draw_cache_generation = 0;
+
+    flat_widget_tree _widget_tree;
 
     /** Let the operating system create the actual window.
      * @param title The title of the window.
@@ -348,6 +470,16 @@ protected:
      */
     bool send_event(mouse_event const &event) noexcept;
 
+    /** Leave a diagnostic artifact behind when the frame exceeded the `slow_frame_budget`.
+     * This is called after each frame was presented.
+     */
+    void check_slow_frame(tt::frame_statistics const &statistics) noexcept;
+
+    /** Send the mouse event that was held back by `coalesce_mouse_events`.
+     * This is called before rendering a frame.
+     */
+    void flush_mouse_events() noexcept;
+
     /*! Handle keyboard event.
      * Called by the operating system to show the character that was entered
      * or special key that was used.
@@ -367,11 +499,37 @@ private:
      */
     std::weak_ptr<tt::widget> _mouse_target_widget = {};
 
+    /** A merged move, drag or wheel event which has not yet been sent.
+     */
+    std::optional<mouse_event> _pending_mouse_event;
+
+    /** The time an artifact was last left behind for a slow frame.
+     */
+    hires_utc_clock::time_point _slow_frame_capture_time_point = {};
+
+    struct animation {
+        std::weak_ptr<tt::widget> widget;
+        hires_utc_clock::time_point start_time_point;
+        hires_utc_clock::time_point end_time_point;
+    };
+
+    /** The animations requested by the widgets, at most one per widget.
+     */
+    std::vector<animation> _animations;
+
     /** Target of the keyboard
      * widget where keyboard events are sent to.
      */
     std::weak_ptr<tt::widget> _keyboard_target_widget = {};
 
+    /** Redraw the widgets that are animating and request the frame for the next animation.
+     */
+    void update_animations(hires_utc_clock::time_point display_time_point) noexcept;
+
+    /** Find the target for a mouse event and send the event to it.
+     */
+    bool dispatch_event(mouse_event const &event) noexcept;
+
     /** Send event to a target widget.
      *
      * The commands are send in order, until the command is handled, then processing stops immediately.
@@ -13,9 +13,16 @@
 #include "draw_context.hpp"
 #include "../widgets/window_widget.hpp"
 #include "../trace.hpp"
+#include "../counters.hpp"
+#include "../allocation_tracker.hpp"
 #include "../application.hpp"
 #include "../cast.hpp"
+#include "../algorithm.hpp"
+#include "../thread_pool.hpp"
 #include <vector>
+#include <span>
+#include <array>
+#include <future>
 
 namespace tt {
 
@@ -30,7 +37,7 @@ gui_window_vulkan::~gui_window_vulkan() {}
 
 gui_device_vulkan &gui_window_vulkan::vulkan_device() const noexcept
 {
-    tt_axiom(gui_system_mutex.recurse_lock_count());
+    tt_axiom(gui_system_mutex.recurse_shared_lock_count());
     tt_axiom(_device != nullptr);
     return narrow_cast<gui_device_vulkan &>(*_device);
 }
@@ -50,19 +57,29 @@ void gui_window_vulkan::init()
     toneMapperPipeline = std::make_unique<pipeline_tone_mapper::pipeline_tone_mapper>(*this);
 }
 
-void gui_window_vulkan::waitIdle()
+void gui_window_vulkan::waitForFramesInFlight()
 {
     tt_axiom(gui_system_mutex.recurse_lock_count());
 
     tt_assert(_device);
-    if (renderFinishedFence) {
-        vulkan_device().waitForFences({renderFinishedFence}, VK_TRUE, std::numeric_limits<uint64_t>::max());
+    for (auto &frame : frame_in_flight_infos) {
+        if (frame.render_finished_fence) {
+            vulkan_device().waitForFences({frame.render_finished_fence}, VK_TRUE, std::numeric_limits<uint64_t>::max());
+            readTimestamps(frame);
+        }
     }
+}
+
+void gui_window_vulkan::waitIdle()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    waitForFramesInFlight();
     vulkan_device().waitIdle();
     tt_log_info("/waitIdle");
 }
 
-std::optional<uint32_t> gui_window_vulkan::acquireNextImageFromSwapchain()
+std::optional<uint32_t> gui_window_vulkan::acquireNextImageFromSwapchain(vk::Semaphore imageAvailableSemaphore)
 {
     tt_axiom(gui_system_mutex.recurse_lock_count());
 
@@ -77,9 +94,12 @@ std::optional<uint32_t> gui_window_vulkan::acquireNextImageFromSwapchain()
     case vk::Result::eSuccess: return {frameBufferIndex};
 
     case vk::Result::eSuboptimalKHR:
-        tt_log_info("acquireNextImageKHR() eSuboptimalKHR");
-        state = gui_window_state::swapchain_lost;
-        return {};
+        // The image was acquired and its semaphore will be signaled, so the image must be rendered.
+        // The swapchain is recreated after this frame, or when the window is no longer being resized.
+        if (not std::exchange(swapchainIsSuboptimal, true)) {
+            tt_log_info("acquireNextImageKHR() eSuboptimalKHR");
+        }
+        return {frameBufferIndex};
 
     case vk::Result::eErrorOutOfDateKHR:
         tt_log_info("acquireNextImageKHR() eErrorOutOfDateKHR");
@@ -96,11 +116,18 @@ std::optional<uint32_t> gui_window_vulkan::acquireNextImageFromSwapchain()
         tt_log_info("acquireNextImageKHR() eTimeout");
         return {};
 
+    case vk::Result::eNotReady:
+        // Don't render, all swapchain images are still in use by frames in flight.
+        return {};
+
     default: throw gui_error("Unknown result from acquireNextImageKHR(). '{}'", to_string(result));
     }
 }
 
-void gui_window_vulkan::presentImageToQueue(uint32_t frameBufferIndex, vk::Semaphore semaphore)
+void gui_window_vulkan::presentImageToQueue(
+    uint32_t frameBufferIndex,
+    vk::Semaphore semaphore,
+    dirty_rectangles const &changed_rectangles)
 {
     tt_axiom(gui_system_mutex.recurse_lock_count());
 
@@ -111,21 +138,50 @@ void gui_window_vulkan::presentImageToQueue(uint32_t frameBufferIndex, vk::Semap
     std::array<uint32_t, 1> const presentImageIndices = {frameBufferIndex};
     tt_axiom(presentSwapchains.size() == presentImageIndices.size());
 
+    auto presentInfo = vk::PresentInfoKHR{
+        narrow_cast<uint32_t>(renderFinishedSemaphores.size()),
+        renderFinishedSemaphores.data(),
+        narrow_cast<uint32_t>(presentSwapchains.size()),
+        presentSwapchains.data(),
+        presentImageIndices.data()};
+
+    // The present rectangles have their origin at the top-left of the image, the same as the scissors.
+    ttlet window_rectangle =
+        aarectangle{0.0f, 0.0f, narrow_cast<float>(swapchainImageExtent.width), narrow_cast<float>(swapchainImageExtent.height)};
+
+    auto presentRectangles = std::array<vk::RectLayerKHR, dirty_rectangles::max_size>{};
+    uint32_t nrPresentRectangles = 0;
+    for (ttlet &changed_rectangle : changed_rectangles) {
+        ttlet rectangle = ceil(intersect(changed_rectangle, window_rectangle));
+        if (not rectangle) {
+            continue;
+        }
+
+        presentRectangles[nrPresentRectangles++] = vk::RectLayerKHR{
+            vk::Offset2D(
+                narrow_cast<int32_t>(rectangle.left()),
+                narrow_cast<int32_t>(swapchainImageExtent.height - rectangle.bottom() - rectangle.height())),
+            vk::Extent2D(narrow_cast<uint32_t>(rectangle.width()), narrow_cast<uint32_t>(rectangle.height())),
+            0};
+    }
+
+    ttlet presentRegion = vk::PresentRegionKHR{nrPresentRectangles, presentRectangles.data()};
+    ttlet presentRegions = vk::PresentRegionsKHR{1, &presentRegion};
+    if (vulkan_device().supportsIncrementalPresent) {
+        presentInfo.pNext = &presentRegions;
+    }
+
     try {
         // tt_log_debug("presentQueue {}", presentImageIndices.at(0));
-        ttlet result = vulkan_device().presentQueue.presentKHR(
-            {narrow_cast<uint32_t>(renderFinishedSemaphores.size()),
-             renderFinishedSemaphores.data(),
-             narrow_cast<uint32_t>(presentSwapchains.size()),
-             presentSwapchains.data(),
-             presentImageIndices.data()});
+        ttlet result = vulkan_device().presentQueue.presentKHR(presentInfo);
 
         switch (result) {
         case vk::Result::eSuccess: return;
 
         case vk::Result::eSuboptimalKHR:
-            tt_log_info("presentKHR() eSuboptimalKHR");
-            state = gui_window_state::swapchain_lost;
+            if (not std::exchange(swapchainIsSuboptimal, true)) {
+                tt_log_info("presentKHR() eSuboptimalKHR");
+            }
             return;
 
         default: throw gui_error("Unknown result from presentKHR(). '{}'", to_string(result));
@@ -190,10 +246,20 @@ void gui_window_vulkan::build()
             teardownSwapchain();
             return;
         }
-        buildRenderPasses(); // Render-pass requires the swapchain/color/depth image-format.
+        buildAttachmentImages();
+        if (renderPass and renderPassFormat != swapchainImageFormat.format) {
+            teardownRenderPasses();
+        }
+        if (not renderPass) {
+            buildRenderPasses(); // Render-pass requires the swapchain/color/depth image-format.
+        }
         buildFramebuffers(); // Framebuffer required render passes.
-        buildCommandBuffers();
-        buildSemaphores();
+        if (frame_in_flight_infos.empty()) {
+            // The command buffers, query pool and semaphores are kept when the swapchain is recreated.
+            buildCommandBuffers();
+            buildQueryPool();
+            buildSemaphores();
+        }
         flatPipeline->buildForNewSwapchain(renderPass, 0, swapchainImageExtent);
         boxPipeline->buildForNewSwapchain(renderPass, 1, swapchainImageExtent);
         imagePipeline->buildForNewSwapchain(renderPass, 2, swapchainImageExtent);
@@ -211,8 +277,24 @@ void gui_window_vulkan::teardown()
 
     auto nextState = state;
 
-    if (state >= gui_window_state::swapchain_lost) {
+    if (state == gui_window_state::swapchain_lost) {
+        // When only the swapchain is lost, for example when the window is resized, then only the objects
+        // that depend on the images or the extent of the swapchain are rebuilt. This only needs to wait
+        // for the frames-in-flight of this window, instead of for the whole device.
         tt_log_info("Tearing down because the window lost the swapchain.");
+        waitForFramesInFlight();
+        toneMapperPipeline->teardownForSwapchainLost();
+        SDFPipeline->teardownForSwapchainLost();
+        imagePipeline->teardownForSwapchainLost();
+        boxPipeline->teardownForSwapchainLost();
+        flatPipeline->teardownForSwapchainLost();
+        teardownFramebuffers();
+        teardownAttachmentImages();
+        retireSwapchain();
+        nextState = gui_window_state::no_swapchain;
+
+    } else if (state >= gui_window_state::surface_lost) {
+        tt_log_info("Tearing down because the window lost the drawable surface.");
         waitIdle();
         toneMapperPipeline->teardownForSwapchainLost();
         SDFPipeline->teardownForSwapchainLost();
@@ -220,47 +302,45 @@ void gui_window_vulkan::teardown()
         boxPipeline->teardownForSwapchainLost();
         flatPipeline->teardownForSwapchainLost();
         teardownSemaphores();
+        teardownQueryPool();
         teardownCommandBuffers();
         teardownFramebuffers();
         teardownRenderPasses();
+        teardownAttachmentImages();
         teardownSwapchain();
-        nextState = gui_window_state::no_swapchain;
 
-        if (state >= gui_window_state::surface_lost) {
-            tt_log_info("Tearing down because the window lost the drawable surface.");
-            toneMapperPipeline->teardownForSurfaceLost();
-            SDFPipeline->teardownForSurfaceLost();
-            imagePipeline->teardownForSurfaceLost();
-            boxPipeline->teardownForSurfaceLost();
-            flatPipeline->teardownForSurfaceLost();
-            teardownSurface();
-            nextState = gui_window_state::no_surface;
-
-            if (state >= gui_window_state::device_lost) {
-                tt_log_info("Tearing down because the window lost the vulkan device.");
-
-                toneMapperPipeline->teardownForDeviceLost();
-                SDFPipeline->teardownForDeviceLost();
-                imagePipeline->teardownForDeviceLost();
-                boxPipeline->teardownForDeviceLost();
-                flatPipeline->teardownForDeviceLost();
-                teardownDevice();
-                nextState = gui_window_state::no_device;
-
-                if (state >= gui_window_state::window_lost) {
-                    tt_log_info("Tearing down because the window doesn't exist anymore.");
-
-                    toneMapperPipeline->teardownForWindowLost();
-                    SDFPipeline->teardownForWindowLost();
-                    imagePipeline->teardownForWindowLost();
-                    boxPipeline->teardownForWindowLost();
-                    flatPipeline->teardownForWindowLost();
-
-                    if (auto delegate_ = delegate.lock()) {
-                        delegate_->deinit(*this);
-                    }
-                    nextState = gui_window_state::no_window;
+        toneMapperPipeline->teardownForSurfaceLost();
+        SDFPipeline->teardownForSurfaceLost();
+        imagePipeline->teardownForSurfaceLost();
+        boxPipeline->teardownForSurfaceLost();
+        flatPipeline->teardownForSurfaceLost();
+        teardownSurface();
+        nextState = gui_window_state::no_surface;
+
+        if (state >= gui_window_state::device_lost) {
+            tt_log_info("Tearing down because the window lost the vulkan device.");
+
+            toneMapperPipeline->teardownForDeviceLost();
+            SDFPipeline->teardownForDeviceLost();
+            imagePipeline->teardownForDeviceLost();
+            boxPipeline->teardownForDeviceLost();
+            flatPipeline->teardownForDeviceLost();
+            teardownDevice();
+            nextState = gui_window_state::no_device;
+
+            if (state >= gui_window_state::window_lost) {
+                tt_log_info("Tearing down because the window doesn't exist anymore.");
+
+                toneMapperPipeline->teardownForWindowLost();
+                SDFPipeline->teardownForWindowLost();
+                imagePipeline->teardownForWindowLost();
+                boxPipeline->teardownForWindowLost();
+                flatPipeline->teardownForWindowLost();
+
+                if (auto delegate_ = delegate.lock()) {
+                    delegate_->deinit(*this);
                 }
+                nextState = gui_window_state::no_window;
             }
         }
     }
@@ -271,12 +351,37 @@ void gui_window_vulkan::render(hires_utc_clock::time_point displayTimePoint)
 {
     tt_axiom(gui_system_mutex.recurse_lock_count());
 
+    // The work done for this frame is measured for the performance overlay.
+    ttlet frame_start = hires_utc_clock::now();
+    ttlet nr_constrained_start = read_counter<"widget_constrain">();
+    ttlet nr_laid_out_start = read_counter<"widget_layout">();
+    ttlet nr_drawn_start = read_counter<"widget_draw">();
+    ttlet nr_hitbox_tested_start = read_counter<"widget_hitbox_test">();
+    ttlet nr_glyphs_added_start = read_counter<"sdf_atlas_glyph_add">();
+    ttlet frame_allocations = allocation_scope{};
+
+    // Mouse events that were merged since the last frame are handled before the widgets are updated.
+    flush_mouse_events();
+    update_animations(displayTimePoint);
+
+    // While the window is being resized the images of a suboptimal swapchain are still presented,
+    // scaled by the presentation engine. The swapchain is recreated once, when resizing has ended.
+    if (swapchainIsSuboptimal and not resizing and state == gui_window_state::ready_to_render) {
+        state = gui_window_state::swapchain_lost;
+    }
+
     // Tear down then buildup from the Vulkan objects that where invalid.
     teardown();
     build();
 
     // Bail out when the window is not yet ready to be rendered.
     if (state != gui_window_state::ready_to_render) {
+        // Keep rendering frames to finish the teardown and build of the window.
+        // A window without a swapchain, such as a minimized window, waits for a message
+        // from the operating system instead.
+        if (state != gui_window_state::no_swapchain) {
+            request_frame();
+        }
         return;
     }
 
@@ -312,13 +417,51 @@ void gui_window_vulkan::render(hires_utc_clock::time_point displayTimePoint)
     // Make sure the widget's layout is updated before draw, but after window resize.
     widget->update_layout(displayTimePoint, need_layout);
 
-    if (!static_cast<bool>(_request_redraw_rectangle)) {
-        return;
+    vulkan_device().update_memory_budget(displayTimePoint);
+
+    // Glyphs are rendered in the background, text drawn before the glyphs were uploaded to the atlas
+    // shows empty glyphs; redraw the window once these glyphs are available.
+    // The SDF atlas does not exist until the first text is drawn on this device.
+    if (vulkan_device().has_SDF_pipeline()) {
+        auto &sdf_device_shared = vulkan_device().SDF_pipeline();
+        sdf_device_shared.updateAtlas();
+        if (sdf_device_shared.atlas_layout_generation != sdfAtlasLayoutGeneration) {
+            // Glyphs have moved inside the atlas; the retained vertices of all widgets must be recreated.
+            sdfAtlasLayoutGeneration = sdf_device_shared.atlas_layout_generation;
+            request_redraw();
+        }
+        if (sdf_device_shared.atlas_generation != sdfAtlasGeneration) {
+            sdfAtlasGeneration = sdf_device_shared.atlas_generation;
+            request_redraw(aarectangle{extent});
+        }
     }
 
-    auto tr = trace<"window_render", "frame_buffer_index">();
+    if (!_request_redraw_rectangles) {
+        return;
+    }
 
-    ttlet optionalFrameBufferIndex = acquireNextImageFromSwapchain();
+    auto tr = trace<
+        "window_render",
+        "frame_buffer_index",
+        "nr_constrained",
+        "nr_laid_out",
+        "nr_drawn",
+        "nr_hitbox_tested",
+        "nr_flat_vertices",
+        "nr_box_vertices",
+        "nr_image_vertices",
+        "nr_SDF_vertices",
+        "nr_glyphs_added">();
+
+    auto &frame = frame_in_flight_infos.at(frameInFlightIndex);
+
+    // Wait until the GPU has finished the previous use of this frame-in-flight, before
+    // its command buffer, semaphores and vertex buffers are reused. Other frames-in-flight
+    // may still be executing on the GPU while we record this frame.
+    vulkan_device().waitForFences({frame.render_finished_fence}, VK_TRUE, std::numeric_limits<uint64_t>::max());
+    readTimestamps(frame);
+
+    ttlet optionalFrameBufferIndex = acquireNextImageFromSwapchain(frame.image_available_semaphore);
     if (!optionalFrameBufferIndex) {
         // No image is ready to be rendered, yet, possibly because our vertical sync function
         // is not working correctly.
@@ -329,59 +472,206 @@ void gui_window_vulkan::render(hires_utc_clock::time_point displayTimePoint)
 
     tr.set<"frame_buffer_index">(frameBufferIndex);
 
-    // Wait until previous rendering has finished, before the next rendering.
-    vulkan_device().waitForFences({renderFinishedFence}, VK_TRUE, std::numeric_limits<uint64_t>::max());
+    // When there are more frames-in-flight than swapchain images, the acquired image may
+    // still be rendered into by another frame-in-flight.
+    if (current_image.render_finished_fence && current_image.render_finished_fence != frame.render_finished_fence) {
+        vulkan_device().waitForFences({current_image.render_finished_fence}, VK_TRUE, std::numeric_limits<uint64_t>::max());
+    }
+    current_image.render_finished_fence = frame.render_finished_fence;
 
     // Unsignal the fence so we will not modify/destroy the command buffers during rendering.
-    vulkan_device().resetFences({renderFinishedFence});
+    vulkan_device().resetFences({frame.render_finished_fence});
+
+    // Let the pipelines place vertices in the vertex buffers of this frame-in-flight.
+    flatPipeline->set_frame_in_flight(frameInFlightIndex);
+    boxPipeline->set_frame_in_flight(frameInFlightIndex);
+    imagePipeline->set_frame_in_flight(frameInFlightIndex);
+    SDFPipeline->set_frame_in_flight(frameInFlightIndex);
+    toneMapperPipeline->set_frame_in_flight(frameInFlightIndex);
 
     // Record which part of the image will be redrawn on the current swapchain image.
-    current_image.redraw_rectangle = _request_redraw_rectangle;
+    current_image.redraw_rectangles = _request_redraw_rectangles;
 
-    // Calculate the scissor rectangle, from the combined redraws of the complete swapchain.
+    // Calculate the rectangles to redraw, from the combined redraws of the complete swapchain.
     // We need to do this so that old redraws are also executed in the current swapchain image.
-    ttlet scissor_rectangle = ceil(
-        std::accumulate(swapchain_image_infos.cbegin(), swapchain_image_infos.cend(), aarectangle{}, [](ttlet &sum, ttlet &item) {
-            return sum | item.redraw_rectangle;
+    ttlet redraw_rectangles = ceil(std::accumulate(
+        swapchain_image_infos.cbegin(), swapchain_image_infos.cend(), dirty_rectangles{}, [](ttlet &sum, ttlet &item) {
+            return sum | item.redraw_rectangles;
         }));
 
     // Update the widgets before the pipelines need their vertices.
     // We unset modified before, so that modification requests are captured.
+    frame_arena.reset();
     auto drawContext = draw_context(
         *this,
-        scissor_rectangle,
+        redraw_rectangles,
         flatPipeline->vertexBufferData,
         boxPipeline->vertexBufferData,
         imagePipeline->vertexBufferData,
-        SDFPipeline->vertexBufferData);
+        SDFPipeline->vertexBufferData,
+        flatPipeline->vertexBufferRanges,
+        boxPipeline->vertexBufferRanges,
+        imagePipeline->vertexBufferRanges,
+        SDFPipeline->vertexBufferRanges,
+        frame_arena);
+
+    // Cull the widgets outside of the redraw rectangles in a single pass over the flattened widget tree.
+    if (not _widget_tree.valid()) {
+        _widget_tree.rebuild(*widget);
+    }
+    _widget_tree.update();
+    _widget_tree.cull(redraw_rectangles);
 
-    _request_redraw_rectangle = aarectangle{};
+    _request_redraw_rectangles.clear();
     auto widget_context =
         drawContext.make_child_context(widget->parent_to_local(), widget->local_to_window(), widget->clipping_rectangle());
-    widget->draw(widget_context, displayTimePoint);
+    widget->draw_retained(widget_context, displayTimePoint);
+
+    add_to_counter<"flat_vertices">(narrow_cast<int64_t>(flatPipeline->vertexBufferData.size()));
+    add_to_counter<"box_vertices">(narrow_cast<int64_t>(boxPipeline->vertexBufferData.size()));
+    add_to_counter<"image_vertices">(narrow_cast<int64_t>(imagePipeline->vertexBufferData.size()));
+    add_to_counter<"SDF_vertices">(narrow_cast<int64_t>(SDFPipeline->vertexBufferData.size()));
 
-    fill_command_buffer(current_image, scissor_rectangle);
-    submitCommandBuffer();
+    fill_command_buffer(frame, current_image, redraw_rectangles);
+    submitCommandBuffer(frame);
 
     // Signal the fence when all rendering has finished on the graphics queue.
     // When the fence is signaled we can modify/destroy the command buffers.
-    [[maybe_unused]] ttlet submit_result = vulkan_device().graphicsQueue.submit(0, nullptr, renderFinishedFence);
-
-    presentImageToQueue(frameBufferIndex, renderFinishedSemaphore);
+    [[maybe_unused]] ttlet submit_result = vulkan_device().graphicsQueue.submit(0, nullptr, frame.render_finished_fence);
+
+    // Only the rectangles requested during this frame differ from the previously presented image,
+    // the other redraw rectangles bring this swapchain image up to date.
+    presentImageToQueue(frameBufferIndex, frame.render_finished_semaphore, current_image.redraw_rectangles);
+
+    // The GPU finishes a frame only after one or more frames were submitted, so the GPU duration
+    // is of the last frame that was read back.
+    auto statistics = tt::frame_statistics{};
+    statistics.cpu_duration = hires_utc_clock::now() - frame_start;
+    statistics.gpu_duration = lastGPUFrameDuration;
+    statistics.nr_constrained = read_counter<"widget_constrain">() - nr_constrained_start;
+    statistics.nr_laid_out = read_counter<"widget_layout">() - nr_laid_out_start;
+    statistics.nr_drawn = read_counter<"widget_draw">() - nr_drawn_start;
+    statistics.nr_hitbox_tested = read_counter<"widget_hitbox_test">() - nr_hitbox_tested_start;
+    statistics.nr_flat_vertices = narrow_cast<int64_t>(flatPipeline->vertexBufferData.size());
+    statistics.nr_box_vertices = narrow_cast<int64_t>(boxPipeline->vertexBufferData.size());
+    statistics.nr_image_vertices = narrow_cast<int64_t>(imagePipeline->vertexBufferData.size());
+    statistics.nr_SDF_vertices = narrow_cast<int64_t>(SDFPipeline->vertexBufferData.size());
+    statistics.nr_glyphs_added = read_counter<"sdf_atlas_glyph_add">() - nr_glyphs_added_start;
+    statistics.nr_allocations = frame_allocations.allocations().count;
+    read_atlas_statistics(statistics);
+    frame_history.push(statistics);
+
+    tr.set<"nr_constrained">(statistics.nr_constrained);
+    tr.set<"nr_laid_out">(statistics.nr_laid_out);
+    tr.set<"nr_drawn">(statistics.nr_drawn);
+    tr.set<"nr_hitbox_tested">(statistics.nr_hitbox_tested);
+    tr.set<"nr_flat_vertices">(statistics.nr_flat_vertices);
+    tr.set<"nr_box_vertices">(statistics.nr_box_vertices);
+    tr.set<"nr_image_vertices">(statistics.nr_image_vertices);
+    tr.set<"nr_SDF_vertices">(statistics.nr_SDF_vertices);
+    tr.set<"nr_glyphs_added">(statistics.nr_glyphs_added);
+    check_slow_frame(statistics);
+
+    // The next frame is recorded using the next set of resources, while the GPU is rendering this frame.
+    frameInFlightIndex = (frameInFlightIndex + 1) % frame_in_flight_infos.size();
 
     // Do an early tear down of invalid vulkan objects.
     teardown();
 }
 
-void gui_window_vulkan::fill_command_buffer(swapchain_image_info &current_image, aarectangle scissor_rectangle)
+void gui_window_vulkan::fill_command_buffer(
+    frame_in_flight_info &frame,
+    swapchain_image_info &current_image,
+    dirty_rectangles const &redraw_rectangles)
 {
     tt_axiom(gui_system_mutex.recurse_lock_count());
 
     auto t = trace<"fill_command_buffer">{};
 
+    ttlet window_rectangle =
+        aarectangle{0.0f, 0.0f, narrow_cast<float>(swapchainImageExtent.width), narrow_cast<float>(swapchainImageExtent.height)};
+
+    // Each dirty rectangle is rendered in its own render pass, so that only the pixels inside the
+    // dirty rectangles are cleared and shaded. The vertices are shared between all render passes,
+    // each pipeline only draws the ranges of vertices that overlap the dirty rectangle.
+    struct render_pass_info {
+        vk::Rect2D scissor;
+        size_t redraw_rectangle_index;
+
+        /** The first of the nrTimestampsPerRectangle timestamps of the render pass.
+         */
+        uint32_t first_timestamp;
+    };
+
+    auto render_passes = std::array<render_pass_info, dirty_rectangles::max_size>{};
+    auto nr_render_passes = 0_uz;
+    auto next_redraw_rectangle_index = 0_uz;
+    for (ttlet &redraw_rectangle : redraw_rectangles) {
+        ttlet redraw_rectangle_index = next_redraw_rectangle_index++;
+        // Clamp the scissor rectangle to the size of the window.
+        ttlet scissor_rectangle = ceil(intersect(redraw_rectangle, window_rectangle));
+        if (not scissor_rectangle) {
+            continue;
+        }
+
+        ttlet scissor = vk::Rect2D{
+            vk::Offset2D(
+                narrow_cast<uint32_t>(scissor_rectangle.left()),
+                narrow_cast<uint32_t>(swapchainImageExtent.height - scissor_rectangle.bottom() - scissor_rectangle.height())),
+            vk::Extent2D(narrow_cast<uint32_t>(scissor_rectangle.width()), narrow_cast<uint32_t>(scissor_rectangle.height()))};
+
+        // The first timestamp of the frame is written before the first render pass.
+        ttlet first_timestamp = frame.first_timestamp + 1 + narrow_cast<uint32_t>(nr_render_passes) * nrTimestampsPerRectangle;
+        render_passes[nr_render_passes++] = {scissor, redraw_rectangle_index, first_timestamp};
+    }
+    ttlet frame_render_passes = std::span{render_passes.data(), nr_render_passes};
+
+    // Pipelines without vertices are skipped; a pipeline is built the first time it has something to draw.
+    // Building the pipelines, updating descriptor sets and flushing the vertex buffers is done before
+    // recording, so that the draws of the pipelines can be recorded in parallel.
+    ttlet has_vertices = std::array{
+        flatPipeline->vertexBufferData.size() != 0,
+        boxPipeline->vertexBufferData.size() != 0,
+        imagePipeline->vertexBufferData.size() != 0,
+        SDFPipeline->vertexBufferData.size() != 0};
+    static_assert(has_vertices.size() == frame_in_flight_info::nr_secondary_pipelines);
+
+    if (has_vertices[0]) {
+        flatPipeline->prepareForDraw();
+    }
+    if (has_vertices[1]) {
+        boxPipeline->prepareForDraw();
+    }
+    if (has_vertices[2]) {
+        imagePipeline->prepareForDraw();
+    }
+    if (has_vertices[3]) {
+        SDFPipeline->prepareForDraw();
+    }
+    toneMapperPipeline->prepareForDraw();
+
+    // The fence of this frame-in-flight has signalled, so the GPU no longer uses the secondary command buffers.
+    for (ttlet command_pool : frame.secondary_command_pools) {
+        vulkan_device().resetCommandPool(command_pool);
+    }
+
+    auto &commandBuffer = frame.command_buffer;
+
     commandBuffer.reset(vk::CommandBufferResetFlagBits::eReleaseResources);
     commandBuffer.begin({vk::CommandBufferUsageFlagBits::eSimultaneousUse});
 
+    // The timestamps are written after the commands before it have completed.
+    ttlet write_timestamp = [&](uint32_t timestamp) {
+        if (timestampQueryPool) {
+            commandBuffer.writeTimestamp(vk::PipelineStageFlagBits::eBottomOfPipe, timestampQueryPool, timestamp);
+        }
+    };
+
+    if (timestampQueryPool) {
+        commandBuffer.resetQueryPool(timestampQueryPool, frame.first_timestamp, nrTimestampsPerFrame);
+    }
+    write_timestamp(frame.first_timestamp);
+
     ttlet background_color = widget->backgroundColor();
     ttlet background_color_f32x4 = static_cast<f32x4>(background_color);
     ttlet background_color_array = static_cast<std::array<float, 4>>(background_color_f32x4);
@@ -395,78 +685,227 @@ void gui_window_vulkan::fill_command_buffer(swapchain_image_info &current_image,
         vk::ClearValue{sdfClearValue},
         vk::ClearValue{colorClearValue}};
 
-    // Clamp the scissor rectangle to the size of the window.
-    scissor_rectangle = intersect(
-        scissor_rectangle,
-        aarectangle{0.0f, 0.0f, narrow_cast<float>(swapchainImageExtent.width), narrow_cast<float>(swapchainImageExtent.height)});
-    scissor_rectangle = ceil(scissor_rectangle);
-
-    ttlet scissors = std::array{vk::Rect2D{
-        vk::Offset2D(
-            narrow_cast<uint32_t>(scissor_rectangle.left()),
-            narrow_cast<uint32_t>(swapchainImageExtent.height - scissor_rectangle.bottom() - scissor_rectangle.height())),
-        vk::Extent2D(narrow_cast<uint32_t>(scissor_rectangle.width()), narrow_cast<uint32_t>(scissor_rectangle.height()))}};
-
-    // The scissor and render area makes sure that the frame buffer is not modified where we are not drawing the widgets.
-    commandBuffer.setScissor(0, scissors);
-
-    ttlet renderArea = scissors.at(0);
-
     // Because we use a scissor the image from the swapchain around the scissor-area is reused.
-    // Because of reuse the swapchain image must already be in the "ePresentSrcKHR" layout.
+    // Because of reuse the swapchain image must already be in the "swapchainImageLayout" layout.
     // The swapchain creates images in undefined layout, so we need to change the layout once.
     if (not current_image.layout_is_present) {
         gui_device_vulkan::transition_layout(commandBuffer,
-            current_image.image, swapchainImageFormat.format, vk::ImageLayout::eUndefined, vk::ImageLayout::ePresentSrcKHR);
+            current_image.image, swapchainImageFormat.format, vk::ImageLayout::eUndefined, swapchainImageLayout);
 
         current_image.layout_is_present = true;
     }
 
-    commandBuffer.beginRenderPass(
-        {renderPass, current_image.frame_buffer, renderArea, narrow_cast<uint32_t>(clearValues.size()), clearValues.data()},
-        vk::SubpassContents::eInline);
+    // Each pipeline records its draws of all render passes into secondary command buffers from its own pool.
+    // The subpass of a pipeline is the same as its index.
+    ttlet record_secondary_command_buffers = [&](auto &pipeline, size_t pipeline_index) {
+        ttlet subpass = narrow_cast<uint32_t>(pipeline_index);
+        ttlet inheritance_info = vk::CommandBufferInheritanceInfo{renderPass, subpass, current_image.frame_buffer};
+
+        for (size_t i = 0; i != frame_render_passes.size(); ++i) {
+            ttlet &render_pass = frame_render_passes[i];
+            auto command_buffer = frame.secondary_command_buffers[pipeline_index][i];
+
+            command_buffer.begin(
+                {vk::CommandBufferUsageFlagBits::eRenderPassContinue | vk::CommandBufferUsageFlagBits::eOneTimeSubmit,
+                 &inheritance_info});
+
+            // Dynamic state is not inherited from the primary command buffer.
+            command_buffer.setScissor(0, render_pass.scissor);
+
+            pipeline.drawInCommandBuffer(command_buffer, render_pass.redraw_rectangle_index);
+
+            if (timestampQueryPool) {
+                command_buffer.writeTimestamp(
+                    vk::PipelineStageFlagBits::eBottomOfPipe, timestampQueryPool, render_pass.first_timestamp + 1 + subpass);
+            }
+            command_buffer.end();
+        }
+    };
+
+    auto recordings = std::array<std::future<void>, frame_in_flight_info::nr_secondary_pipelines>{};
+    ttlet record_async = [&](auto &pipeline, size_t pipeline_index) {
+        if (has_vertices[pipeline_index]) {
+            recordings[pipeline_index] = thread_pool_async(
+                [&record_secondary_command_buffers, &pipeline, pipeline_index] {
+                    record_secondary_command_buffers(pipeline, pipeline_index);
+                },
+                thread_pool_priority::interactive);
+        }
+    };
+    record_async(*flatPipeline, 0);
+    record_async(*boxPipeline, 1);
+    record_async(*imagePipeline, 2);
+    record_async(*SDFPipeline, 3);
+
+    // The workers use the command buffers of this frame, so wait for all of them before an
+    // exception of one of them is passed on. The render passes that execute the secondary command
+    // buffers can only be recorded after the secondary command buffers are finished.
+    for (ttlet &recording : recordings) {
+        if (recording.valid()) {
+            recording.wait();
+        }
+    }
+    for (auto &recording : recordings) {
+        if (recording.valid()) {
+            recording.get();
+        }
+    }
+
+    // A subpass of a pipeline without vertices has no secondary command buffer, its timestamp is
+    // written directly in the primary command buffer.
+    ttlet subpass_contents = [&](size_t pipeline_index) {
+        return has_vertices[pipeline_index] ? vk::SubpassContents::eSecondaryCommandBuffers : vk::SubpassContents::eInline;
+    };
 
-    flatPipeline->drawInCommandBuffer(commandBuffer);
+    for (size_t i = 0; i != frame_render_passes.size(); ++i) {
+        ttlet &render_pass = frame_render_passes[i];
 
-    commandBuffer.nextSubpass(vk::SubpassContents::eInline);
-    boxPipeline->drawInCommandBuffer(commandBuffer);
+        ttlet draw_subpass = [&](size_t pipeline_index) {
+            if (has_vertices[pipeline_index]) {
+                commandBuffer.executeCommands(frame.secondary_command_buffers[pipeline_index][i]);
+            } else {
+                write_timestamp(render_pass.first_timestamp + 1 + narrow_cast<uint32_t>(pipeline_index));
+            }
+        };
+
+        // The scissor and render area makes sure that the frame buffer is not modified where we are not drawing the widgets.
+        commandBuffer.setScissor(0, render_pass.scissor);
+        write_timestamp(render_pass.first_timestamp);
+
+        commandBuffer.beginRenderPass(
+            {renderPass,
+             current_image.frame_buffer,
+             render_pass.scissor,
+             narrow_cast<uint32_t>(clearValues.size()),
+             clearValues.data()},
+            subpass_contents(0));
+        draw_subpass(0);
+
+        for (size_t pipeline_index = 1; pipeline_index != frame_in_flight_info::nr_secondary_pipelines; ++pipeline_index) {
+            commandBuffer.nextSubpass(subpass_contents(pipeline_index));
+            draw_subpass(pipeline_index);
+        }
 
-    commandBuffer.nextSubpass(vk::SubpassContents::eInline);
-    imagePipeline->drawInCommandBuffer(commandBuffer);
+        commandBuffer.nextSubpass(vk::SubpassContents::eInline);
+        toneMapperPipeline->drawInCommandBuffer(commandBuffer);
+        write_timestamp(render_pass.first_timestamp + nrTimestampsPerRectangle - 1);
 
-    commandBuffer.nextSubpass(vk::SubpassContents::eInline);
-    SDFPipeline->drawInCommandBuffer(commandBuffer);
+        commandBuffer.endRenderPass();
+    }
 
-    commandBuffer.nextSubpass(vk::SubpassContents::eInline);
-    toneMapperPipeline->drawInCommandBuffer(commandBuffer);
+    frame.nr_timestamps = 2 + narrow_cast<uint32_t>(nr_render_passes) * nrTimestampsPerRectangle;
+    tt_axiom(frame.nr_timestamps <= nrTimestampsPerFrame);
+    write_timestamp(frame.first_timestamp + frame.nr_timestamps - 1);
 
-    commandBuffer.endRenderPass();
     commandBuffer.end();
 }
 
-void gui_window_vulkan::submitCommandBuffer()
+void gui_window_vulkan::readTimestamps(frame_in_flight_info &frame)
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    if (!timestampQueryPool || frame.nr_timestamps < 2) {
+        return;
+    }
+
+    auto timestamps = std::array<uint64_t, nrTimestampsPerFrame>{};
+    if (!vulkan_device().getQueryPoolResults(
+            timestampQueryPool, frame.first_timestamp, std::span{timestamps.data(), frame.nr_timestamps})) {
+        return;
+    }
+    ttlet nrTimestamps = frame.nr_timestamps;
+    frame.nr_timestamps = 0;
+
+    ttlet validBits = vulkan_device().graphicsTimestampValidBits;
+    ttlet mask = validBits >= 64 ? std::numeric_limits<uint64_t>::max() : (uint64_t{1} << validBits) - 1;
+    ttlet period = vulkan_device().physicalProperties.limits.timestampPeriod;
+
+    ttlet duration = [&](uint32_t first, uint32_t last) {
+        ttlet ticks = (timestamps[last] - timestamps[first]) & mask;
+        return std::chrono::nanoseconds{static_cast<int64_t>(static_cast<double>(ticks) * period)};
+    };
+
+    // Add the time of each pipeline over all the render passes of the frame.
+    auto pipelineDurations = std::array<std::chrono::nanoseconds, nrTimestampsPerRectangle - 1>{};
+    for (uint32_t first = 1; first + nrTimestampsPerRectangle < nrTimestamps; first += nrTimestampsPerRectangle) {
+        for (uint32_t i = 0; i != std::size(pipelineDurations); ++i) {
+            pipelineDurations[i] += duration(first + i, first + i + 1);
+        }
+    }
+
+    lastGPUFrameDuration = duration(0, nrTimestamps - 1);
+    trace_statistics_write<"gpu_frame">(lastGPUFrameDuration);
+    trace_statistics_write<"gpu_flat_pipeline">(pipelineDurations[0]);
+    trace_statistics_write<"gpu_box_pipeline">(pipelineDurations[1]);
+    trace_statistics_write<"gpu_image_pipeline">(pipelineDurations[2]);
+    trace_statistics_write<"gpu_SDF_pipeline">(pipelineDurations[3]);
+    trace_statistics_write<"gpu_tone_mapper_pipeline">(pipelineDurations[4]);
+}
+
+void gui_window_vulkan::read_atlas_statistics(tt::frame_statistics &statistics)
 {
     tt_axiom(gui_system_mutex.recurse_lock_count());
 
-    ttlet waitSemaphores = std::array{imageAvailableSemaphore};
+    // Glyphs are allocated in rows from the bottom-left of the last texture of the SDF atlas.
+    if (vulkan_device().has_SDF_pipeline()) {
+        ttlet &sdf_device_shared = vulkan_device().SDF_pipeline();
+        constexpr auto image_area = static_cast<float>(pipeline_SDF::device_shared::atlasImageWidth) *
+            static_cast<float>(pipeline_SDF::device_shared::atlasImageHeight);
+
+        if (ttlet nr_images = sdf_device_shared.atlasTextures.size()) {
+            ttlet &position = sdf_device_shared.atlas_allocation_position;
+            ttlet allocated_area = position.z() * image_area +
+                position.y() * static_cast<float>(pipeline_SDF::device_shared::atlasImageWidth) +
+                position.x() * static_cast<float>(sdf_device_shared.atlasAllocationMaxHeight);
+            ttlet total_area = static_cast<float>(nr_images) * image_area;
+            statistics.sdf_atlas_occupancy = std::clamp(allocated_area / total_area, 0.0f, 1.0f);
+        }
+    }
+
+    ttlet &image_device_shared = vulkan_device().image_pipeline();
+    statistics.image_atlas_capacity =
+        image_device_shared.atlasTextures.size() * pipeline_image::device_shared::atlasNrPagesPerImage;
+    statistics.nr_image_atlas_pages = statistics.image_atlas_capacity - image_device_shared.atlasFreePages.size();
+}
 
-    ttlet waitStages = std::array{vk::PipelineStageFlags{vk::PipelineStageFlagBits::eColorAttachmentOutput}};
+void gui_window_vulkan::submitCommandBuffer(frame_in_flight_info const &frame)
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    ttlet &device = vulkan_device();
+
+    // The atlases are sampled by the fragment shader, wait for the uploads on the transfer queue.
+    // The value for the binary image-available semaphore is ignored.
+    ttlet waitOnTransfer = device.hasDedicatedTransferQueue;
+    ttlet waitSemaphores = std::array{frame.image_available_semaphore, device.transferTimeline};
+    ttlet waitValues = std::array{uint64_t{0}, device.transferTimelineValue};
+    ttlet waitStages = std::array{
+        vk::PipelineStageFlags{vk::PipelineStageFlagBits::eColorAttachmentOutput},
+        vk::PipelineStageFlags{vk::PipelineStageFlagBits::eFragmentShader}};
+    ttlet nrWaitSemaphores = waitOnTransfer ? 2_uz : 1_uz;
 
     tt_axiom(waitSemaphores.size() == waitStages.size());
+    tt_axiom(waitSemaphores.size() == waitValues.size());
+
+    ttlet signalSemaphores = std::array{frame.render_finished_semaphore};
+    ttlet commandBuffersToSubmit = std::array{frame.command_buffer};
 
-    ttlet signalSemaphores = std::array{renderFinishedSemaphore};
-    ttlet commandBuffersToSubmit = std::array{commandBuffer};
+    ttlet timelineSubmitInfo =
+        vk::TimelineSemaphoreSubmitInfo{narrow_cast<uint32_t>(nrWaitSemaphores), waitValues.data(), 0, nullptr};
 
-    ttlet submitInfo = std::array{vk::SubmitInfo{
-        narrow_cast<uint32_t>(waitSemaphores.size()),
+    auto submitInfo = vk::SubmitInfo{
+        narrow_cast<uint32_t>(nrWaitSemaphores),
         waitSemaphores.data(),
         waitStages.data(),
         narrow_cast<uint32_t>(commandBuffersToSubmit.size()),
         commandBuffersToSubmit.data(),
         narrow_cast<uint32_t>(signalSemaphores.size()),
-        signalSemaphores.data()}};
+        signalSemaphores.data()};
+    if (waitOnTransfer) {
+        submitInfo.pNext = &timelineSubmitInfo;
+    }
 
-    vulkan_device().graphicsQueue.submit(submitInfo, vk::Fence());
+    device.graphicsQueue.submit(submitInfo, vk::Fence());
 }
 
 std::tuple<uint32_t, vk::Extent2D> gui_window_vulkan::getImageCountAndExtent()
@@ -600,9 +1039,15 @@ gui_window_state gui_window_vulkan::buildSwapchain()
         vk::CompositeAlphaFlagBitsKHR::eOpaque,
         vulkan_device().bestSurfacePresentMode,
         VK_TRUE, // clipped
-        nullptr};
+        retiredSwapchain};
 
     vk::Result const result = vulkan_device().createSwapchainKHR(&swapchainCreateInfo, nullptr, &swapchain);
+
+    // The retired swapchain can not be used anymore, even when creating the new swapchain failed.
+    // Its images are no longer used by the frames-in-flight of this window.
+    vulkan_device().destroy(retiredSwapchain);
+    retiredSwapchain = vk::SwapchainKHR{};
+
     switch (result) {
     case vk::Result::eSuccess: break;
 
@@ -620,12 +1065,47 @@ gui_window_state gui_window_vulkan::buildSwapchain()
     tt_log_info(
         " - presentMode={}, imageCount={}", vk::to_string(swapchainCreateInfo.presentMode), swapchainCreateInfo.minImageCount);
 
+    swapchainIsSuboptimal = false;
+    return gui_window_state::ready_to_render;
+}
+
+void gui_window_vulkan::teardownSwapchain()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    vulkan_device().destroy(swapchain);
+    vulkan_device().destroy(retiredSwapchain);
+    swapchain = vk::SwapchainKHR{};
+    retiredSwapchain = vk::SwapchainKHR{};
+}
+
+void gui_window_vulkan::retireSwapchain()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    // Handing over the old swapchain lets the presentation engine reuse its resources and keep
+    // showing the last presented image while the new swapchain is built.
+    tt_axiom(not retiredSwapchain);
+    retiredSwapchain = std::exchange(swapchain, vk::SwapchainKHR{});
+}
+
+std::vector<vk::Image> gui_window_vulkan::getSwapchainImages()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    return vulkan_device().getSwapchainImagesKHR(swapchain);
+}
+
+void gui_window_vulkan::buildAttachmentImages()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
     // Create depth matching the swapchain.
     vk::ImageCreateInfo const depthImageCreateInfo = {
         vk::ImageCreateFlags(),
         vk::ImageType::e2D,
         depthImageFormat,
-        vk::Extent3D(swapchainCreateInfo.imageExtent.width, swapchainCreateInfo.imageExtent.height, 1),
+        vk::Extent3D(swapchainImageExtent.width, swapchainImageExtent.height, 1),
         1, // mipLevels
         1, // arrayLayers
         vk::SampleCountFlagBits::e1,
@@ -645,7 +1125,7 @@ gui_window_state gui_window_vulkan::buildSwapchain()
         vk::ImageCreateFlags(),
         vk::ImageType::e2D,
         colorImageFormat,
-        vk::Extent3D(swapchainCreateInfo.imageExtent.width, swapchainCreateInfo.imageExtent.height, 1),
+        vk::Extent3D(swapchainImageExtent.width, swapchainImageExtent.height, 1),
         1, // mipLevels
         1, // arrayLayers
         vk::SampleCountFlagBits::e1,
@@ -663,19 +1143,20 @@ gui_window_state gui_window_vulkan::buildSwapchain()
         vulkan_device().createImage(colorImageCreateInfo, colorAllocationCreateInfo);
     std::tie(colorImages[1], colorImageAllocations[1]) =
         vulkan_device().createImage(colorImageCreateInfo, colorAllocationCreateInfo);
-
-    return gui_window_state::ready_to_render;
 }
 
-void gui_window_vulkan::teardownSwapchain()
+void gui_window_vulkan::teardownAttachmentImages()
 {
     tt_axiom(gui_system_mutex.recurse_lock_count());
 
-    vulkan_device().destroy(swapchain);
     vulkan_device().destroyImage(depthImage, depthImageAllocation);
+    depthImage = vk::Image{};
+    depthImageAllocation = nullptr;
 
     for (size_t i = 0; i != std::size(colorImages); ++i) {
         vulkan_device().destroyImage(colorImages[i], colorImageAllocations[i]);
+        colorImages[i] = vk::Image{};
+        colorImageAllocations[i] = nullptr;
     }
 }
 
@@ -703,7 +1184,7 @@ void gui_window_vulkan::buildFramebuffers()
         colorDescriptorImageInfos[i] = {vk::Sampler(), colorImageViews[i], vk::ImageLayout::eShaderReadOnlyOptimal};
     }
 
-    auto swapchain_images = vulkan_device().getSwapchainImagesKHR(swapchain);
+    auto swapchain_images = getSwapchainImages();
     for (auto image : swapchain_images) {
         auto image_view = vulkan_device().createImageView(
             {vk::ImageViewCreateFlags(),
@@ -726,7 +1207,7 @@ void gui_window_vulkan::buildFramebuffers()
         });
 
         swapchain_image_infos.emplace_back(
-            std::move(image), std::move(image_view), std::move(frame_buffer), aarectangle{}, false);
+            std::move(image), std::move(image_view), std::move(frame_buffer), dirty_rectangles{}, false);
     }
 
     tt_axiom(swapchain_image_infos.size() == swapchain_images.size());
@@ -743,8 +1224,10 @@ void gui_window_vulkan::teardownFramebuffers()
     swapchain_image_infos.clear();
 
     vulkan_device().destroy(depthImageView);
+    depthImageView = vk::ImageView{};
     for (size_t i = 0; i != std::size(colorImageViews); ++i) {
         vulkan_device().destroy(colorImageViews[i]);
+        colorImageViews[i] = vk::ImageView{};
     }
 }
 
@@ -798,8 +1281,8 @@ void gui_window_vulkan::buildRenderPasses()
             vk::AttachmentStoreOp::eStore,
             vk::AttachmentLoadOp::eDontCare, // stencilLoadOp
             vk::AttachmentStoreOp::eDontCare, // stencilStoreOp
-            vk::ImageLayout::ePresentSrcKHR, // initialLayout
-            vk::ImageLayout::ePresentSrcKHR // finalLayout
+            swapchainImageLayout, // initialLayout
+            swapchainImageLayout // finalLayout
         }};
 
     ttlet depthAttachmentReference = vk::AttachmentReference{0, vk::ImageLayout::eDepthStencilAttachmentOptimal};
@@ -936,6 +1419,7 @@ void gui_window_vulkan::buildRenderPasses()
     };
 
     renderPass = vulkan_device().createRenderPass(renderPassCreateInfo);
+    renderPassFormat = swapchainImageFormat.format;
 }
 
 void gui_window_vulkan::teardownRenderPasses()
@@ -943,46 +1427,110 @@ void gui_window_vulkan::teardownRenderPasses()
     tt_axiom(gui_system_mutex.recurse_lock_count());
 
     vulkan_device().destroy(renderPass);
+    renderPass = vk::RenderPass{};
+    renderPassFormat = vk::Format::eUndefined;
 }
 
 void gui_window_vulkan::buildSemaphores()
 {
     tt_axiom(gui_system_mutex.recurse_lock_count());
 
-    imageAvailableSemaphore = vulkan_device().createSemaphore({});
-    renderFinishedSemaphore = vulkan_device().createSemaphore({});
+    for (auto &frame : frame_in_flight_infos) {
+        frame.image_available_semaphore = vulkan_device().createSemaphore({});
+        frame.render_finished_semaphore = vulkan_device().createSemaphore({});
 
-    // This fence is used to wait for the Window and its Pipelines to be idle.
-    // It should therefor be signed at the start so that when no rendering has been
-    // done it is still idle.
-    renderFinishedFence = vulkan_device().createFence({vk::FenceCreateFlagBits::eSignaled});
+        // This fence is used to wait for the Window and its Pipelines to be idle.
+        // It should therefor be signed at the start so that when no rendering has been
+        // done it is still idle.
+        frame.render_finished_fence = vulkan_device().createFence({vk::FenceCreateFlagBits::eSignaled});
+    }
 }
 
 void gui_window_vulkan::teardownSemaphores()
 {
     tt_axiom(gui_system_mutex.recurse_lock_count());
 
-    vulkan_device().destroy(renderFinishedSemaphore);
-    vulkan_device().destroy(imageAvailableSemaphore);
-    vulkan_device().destroy(renderFinishedFence);
+    for (auto &frame : frame_in_flight_infos) {
+        vulkan_device().destroy(frame.render_finished_semaphore);
+        vulkan_device().destroy(frame.image_available_semaphore);
+        vulkan_device().destroy(frame.render_finished_fence);
+        frame.render_finished_semaphore = vk::Semaphore{};
+        frame.image_available_semaphore = vk::Semaphore{};
+        frame.render_finished_fence = vk::Fence{};
+    }
 }
 
 void gui_window_vulkan::buildCommandBuffers()
 {
     tt_axiom(gui_system_mutex.recurse_lock_count());
 
-    ttlet commandBuffers =
-        vulkan_device().allocateCommandBuffers({vulkan_device().graphicsCommandPool, vk::CommandBufferLevel::ePrimary, 1});
+    tt_assert(nrFramesInFlight >= 1);
+
+    ttlet commandBuffers = vulkan_device().allocateCommandBuffers(
+        {vulkan_device().graphicsCommandPool, vk::CommandBufferLevel::ePrimary, narrow_cast<uint32_t>(nrFramesInFlight)});
+
+    frame_in_flight_infos.resize(nrFramesInFlight);
+    for (size_t i = 0; i != nrFramesInFlight; ++i) {
+        auto &frame = frame_in_flight_infos[i];
+        frame.command_buffer = commandBuffers.at(i);
+
+        for (size_t j = 0; j != frame_in_flight_info::nr_secondary_pipelines; ++j) {
+            // The pool is reset as a whole at the start of each frame.
+            frame.secondary_command_pools[j] = vulkan_device().createCommandPool(
+                {vk::CommandPoolCreateFlagBits::eTransient, vulkan_device().graphicsQueueFamilyIndex});
 
-    commandBuffer = commandBuffers.at(0);
+            frame.secondary_command_buffers[j] = vulkan_device().allocateCommandBuffers(
+                {frame.secondary_command_pools[j],
+                 vk::CommandBufferLevel::eSecondary,
+                 narrow_cast<uint32_t>(dirty_rectangles::max_size)});
+        }
+    }
+    frameInFlightIndex = 0;
 }
 
 void gui_window_vulkan::teardownCommandBuffers()
 {
     tt_axiom(gui_system_mutex.recurse_lock_count());
-    ttlet commandBuffers = std::vector<vk::CommandBuffer>{commandBuffer};
+    ttlet commandBuffers = transform<std::vector<vk::CommandBuffer>>(frame_in_flight_infos, [](ttlet &frame) {
+        return frame.command_buffer;
+    });
 
     vulkan_device().freeCommandBuffers(vulkan_device().graphicsCommandPool, commandBuffers);
+
+    // Destroying a command pool frees the command buffers allocated from it.
+    for (ttlet &frame : frame_in_flight_infos) {
+        for (ttlet command_pool : frame.secondary_command_pools) {
+            vulkan_device().destroy(command_pool);
+        }
+    }
+    frame_in_flight_infos.clear();
+}
+
+void gui_window_vulkan::buildQueryPool()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    if (vulkan_device().graphicsTimestampValidBits == 0) {
+        return;
+    }
+
+    timestampQueryPool = vulkan_device().createQueryPool(
+        {vk::QueryPoolCreateFlags(), vk::QueryType::eTimestamp, narrow_cast<uint32_t>(nrFramesInFlight) * nrTimestampsPerFrame});
+
+    for (size_t i = 0; i != frame_in_flight_infos.size(); ++i) {
+        frame_in_flight_infos[i].first_timestamp = narrow_cast<uint32_t>(i) * nrTimestampsPerFrame;
+        frame_in_flight_infos[i].nr_timestamps = 0;
+    }
+}
+
+void gui_window_vulkan::teardownQueryPool()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    if (timestampQueryPool) {
+        vulkan_device().destroy(timestampQueryPool);
+        timestampQueryPool = vk::QueryPool{};
+    }
 }
 
 void gui_window_vulkan::teardownSurface()
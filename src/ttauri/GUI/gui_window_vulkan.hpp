@@ -5,9 +5,12 @@
 #pragma once
 
 #include "gui_window.hpp"
+#include "../monotonic_arena.hpp"
 #include <vulkan/vulkan.hpp>
 #include <vk_mem_alloc.h>
 #include <optional>
+#include <array>
+#include <vector>
 
 namespace tt {
 class gui_device_vulkan;
@@ -32,8 +35,47 @@ struct swapchain_image_info {
     vk::Image image;
     vk::ImageView image_view;
     vk::Framebuffer frame_buffer;
-    aarectangle redraw_rectangle;
+    dirty_rectangles redraw_rectangles;
     bool layout_is_present = false;
+
+    /** The fence of the frame-in-flight which last rendered into this image.
+     */
+    vk::Fence render_finished_fence = {};
+};
+
+/** Vulkan objects owned by a single frame-in-flight.
+ * While the GPU is executing the command buffer of one frame, the CPU can
+ * already record the command buffer and vertices of the next frame.
+ */
+struct frame_in_flight_info {
+    /** The number of pipelines which record their draws in secondary command buffers.
+     * The flat, box, image and SDF pipelines; the tone mapper is recorded in the primary command buffer.
+     */
+    static constexpr size_t nr_secondary_pipelines = 4;
+
+    vk::CommandBuffer command_buffer;
+
+    /** A command pool for each pipeline recording secondary command buffers.
+     * A command pool may only be used by one thread at a time, each pipeline records its
+     * draws on the thread pool into command buffers allocated from its own pool.
+     */
+    std::array<vk::CommandPool, nr_secondary_pipelines> secondary_command_pools;
+
+    /** For each pipeline, a secondary command buffer for each redraw rectangle.
+     */
+    std::array<std::vector<vk::CommandBuffer>, nr_secondary_pipelines> secondary_command_buffers;
+    vk::Semaphore image_available_semaphore;
+    vk::Semaphore render_finished_semaphore;
+    vk::Fence render_finished_fence;
+
+    /** The index of the first timestamp query of this frame in the window's query pool.
+     */
+    uint32_t first_timestamp = 0;
+
+    /** The number of timestamps written by the command buffer.
+     * The timestamps are read back after the frame has finished rendering.
+     */
+    uint32_t nr_timestamps = 0;
 };
 
 class gui_window_vulkan : public gui_window {
@@ -42,6 +84,17 @@ public:
 
     vk::SwapchainKHR swapchain;
 
+    /** The previous swapchain, while the swapchain is recreated.
+     * It is passed as `oldSwapchain` when building the new swapchain, then destroyed.
+     */
+    vk::SwapchainKHR retiredSwapchain;
+
+    /** The presentation engine reported that the swapchain no longer matches the surface.
+     * While the window is being resized the swapchain is kept, with the presentation engine
+     * scaling the image, and it is recreated at the final size when resizing ends.
+     */
+    bool swapchainIsSuboptimal = false;
+
     static constexpr uint32_t defaultNumberOfSwapchainImages = 2;
 
     int nrSwapchainImages;
@@ -49,6 +102,11 @@ public:
     vk::SurfaceFormatKHR swapchainImageFormat;
     std::vector<swapchain_image_info> swapchain_image_infos;
 
+    /** The layout of the swapchain images between frames.
+     * The render pass leaves the images in this layout after the tone mapper has written to them.
+     */
+    vk::ImageLayout swapchainImageLayout = vk::ImageLayout::ePresentSrcKHR;
+
     static const vk::Format depthImageFormat = vk::Format::eD32Sfloat;
     VmaAllocation depthImageAllocation;
     vk::Image depthImage;
@@ -62,11 +120,57 @@ public:
 
     vk::RenderPass renderPass;
 
-    vk::CommandBuffer commandBuffer;
+    /** The format of the swapchain images the render pass was built for.
+     * The render pass is kept when the swapchain is recreated with the same format.
+     */
+    vk::Format renderPassFormat = vk::Format::eUndefined;
+
+    static constexpr size_t defaultNumberOfFramesInFlight = 2;
+
+    /** The number of frames that the CPU may record ahead of the GPU.
+     * Each frame-in-flight has its own command buffer, semaphores, fence and
+     * a set of vertex buffers for each pipeline.
+     *
+     * This value must be set before the window is built on a device.
+     */
+    size_t nrFramesInFlight = defaultNumberOfFramesInFlight;
+    std::vector<frame_in_flight_info> frame_in_flight_infos;
 
-    vk::Semaphore imageAvailableSemaphore;
-    vk::Semaphore renderFinishedSemaphore;
-    vk::Fence renderFinishedFence;
+    /** The number of timestamps written for each dirty rectangle.
+     * One at the start of the render pass and one after each of the five pipelines.
+     */
+    static constexpr uint32_t nrTimestampsPerRectangle = 6;
+
+    /** The number of timestamps for each frame-in-flight.
+     * One at the start and end of the frame, and the timestamps of each dirty rectangle.
+     */
+    static constexpr uint32_t nrTimestampsPerFrame = 2 + dirty_rectangles::max_size * nrTimestampsPerRectangle;
+
+    /** Timestamp queries measuring the GPU time of each frame and each pipeline.
+     * Empty when the graphics queue does not support timestamps.
+     */
+    vk::QueryPool timestampQueryPool;
+
+    /** The index in frame_in_flight_infos of the frame that will be recorded next.
+     */
+    size_t frameInFlightIndex = 0;
+
+    /** Memory for temporary allocations while drawing a frame.
+     * The arena is reset at the start of each frame, see `draw_context::frame_resource()`.
+     */
+    monotonic_arena frame_arena;
+
+    /** The atlas generation of the SDF glyphs when this window was last drawn.
+     */
+    size_t sdfAtlasGeneration = 0;
+
+    /** The atlas layout generation of the SDF glyphs when this window was last drawn.
+     */
+    size_t sdfAtlasLayoutGeneration = 0;
+
+    /** The GPU time of the most recently finished frame, as read from the timestamp queries.
+     */
+    hires_utc_clock::duration lastGPUFrameDuration = {};
 
     std::unique_ptr<pipeline_image::pipeline_image> imagePipeline;
     std::unique_ptr<pipeline_flat::pipeline_flat> flatPipeline;
@@ -95,35 +199,92 @@ public:
 protected:
     void teardown() override;
     void build() override;
-    
+
+    /** Wait until the GPU has finished the frames-in-flight of this window.
+     * Unlike `waitIdle()` this does not wait for the other windows of the device.
+     */
+    void waitForFramesInFlight();
+
+    void waitIdle();
+
+    /** Acquire the next image to render into.
+     *
+     * @param imageAvailableSemaphore The semaphore to signal when the image is available.
+     * @return The index of the swapchain image, or empty when no image is available.
+     */
+    virtual std::optional<uint32_t> acquireNextImageFromSwapchain(vk::Semaphore imageAvailableSemaphore);
+
+    /** Present an image of the swapchain.
+     *
+     * @param frameBufferIndex The index of the swapchain image.
+     * @param renderFinishedSemaphore The semaphore to wait on before presenting.
+     * @param changed_rectangles The parts of the image that changed since the previous present. These
+     *                           are passed as present regions when VK_KHR_incremental_present is supported.
+     */
+    virtual void presentImageToQueue(
+        uint32_t frameBufferIndex,
+        vk::Semaphore renderFinishedSemaphore,
+        dirty_rectangles const &changed_rectangles);
+
+    /** Read the number of swapchain images and their extent.
+     * @return false when the window can not be drawn at its current size.
+     */
+    virtual bool readSurfaceExtent();
+
+    /** Check if the extent of the surface is still the same as the swapchain.
+     */
+    virtual bool checkSurfaceExtent();
+
+    virtual bool buildSurface();
+    virtual void teardownSurface();
+    virtual gui_window_state buildSwapchain();
+    virtual void teardownSwapchain();
+
+    /** Keep the swapchain as `retiredSwapchain`, to be handed over to the swapchain that replaces it.
+     */
+    virtual void retireSwapchain();
+
+    /** Get the images of the swapchain, to build the frame buffers.
+     */
+    virtual std::vector<vk::Image> getSwapchainImages();
+
 private:
-    std::optional<uint32_t> acquireNextImageFromSwapchain();
-    void presentImageToQueue(uint32_t frameBufferIndex, vk::Semaphore renderFinishedSemaphore);
+    /** Record the command buffer of a frame.
+     * The draws of the flat, box, image and SDF pipelines are recorded in parallel on the thread pool
+     * into secondary command buffers, which are executed from the primary command buffer.
+     */
+    void fill_command_buffer(
+        frame_in_flight_info &frame,
+        swapchain_image_info &current_image,
+        dirty_rectangles const &redraw_rectangles);
+    void submitCommandBuffer(frame_in_flight_info const &frame);
 
-    void fill_command_buffer(swapchain_image_info &current_image, aarectangle scissor_rectangle);
-    void submitCommandBuffer();
+    /** Add the GPU time of a finished frame to the trace statistics.
+     * The durations are reported as "gpu_frame" and "gpu_<pipeline>_pipeline".
+     */
+    void readTimestamps(frame_in_flight_info &frame);
 
-    bool readSurfaceExtent();
-    bool checkSurfaceExtent();
+    /** Add the occupancy of the SDF and image atlases of the device to the statistics of a frame.
+     */
+    void read_atlas_statistics(tt::frame_statistics &statistics);
 
     void buildDevice();
     void buildSemaphores();
     void teardownSemaphores();
-    gui_window_state buildSwapchain();
-    void teardownSwapchain();
+    void buildAttachmentImages();
+    void teardownAttachmentImages();
     void buildCommandBuffers();
     void teardownCommandBuffers();
+    void buildQueryPool();
+    void teardownQueryPool();
     void buildRenderPasses();
     void teardownRenderPasses();
     void buildFramebuffers();
     void teardownFramebuffers();
     void buildPipelines();
     void teardownPipelines();
-    bool buildSurface();
-    void teardownSurface();
     void teardownDevice();
 
-    void waitIdle();
     std::tuple<uint32_t, vk::Extent2D> getImageCountAndExtent();
 };
 
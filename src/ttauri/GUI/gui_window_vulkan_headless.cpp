@@ -0,0 +1,238 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gui_window_vulkan_headless.hpp"
+#include "gui_device_vulkan.hpp"
+#include "gui_system.hpp"
+#include "../logger.hpp"
+#include "../assert.hpp"
+#include <cstring>
+#include <cmath>
+
+namespace tt {
+
+gui_window_vulkan_headless::gui_window_vulkan_headless(
+    gui_system &system,
+    std::weak_ptr<gui_window_delegate> const &delegate,
+    label const &title) :
+    gui_window_vulkan(system, delegate, title)
+{
+    // The image is copied into a buffer after rendering, instead of being presented.
+    swapchainImageLayout = vk::ImageLayout::eTransferSrcOptimal;
+}
+
+gui_window_vulkan_headless::~gui_window_vulkan_headless() {}
+
+void gui_window_vulkan_headless::create_window(const std::u8string &title, extent2 new_extent)
+{
+    // The extent was already set by gui_window::init(); there is no operating-system window to create.
+    tt_log_info("Create headless window of {}", new_extent);
+}
+
+vk::SurfaceKHR gui_window_vulkan_headless::getSurface() const
+{
+    return {};
+}
+
+void gui_window_vulkan_headless::close_window()
+{
+    ttlet lock = std::scoped_lock(gui_system_mutex);
+    state = gui_window_state::window_lost;
+}
+
+void gui_window_vulkan_headless::set_window_size(extent2 new_extent)
+{
+    ttlet lock = std::scoped_lock(gui_system_mutex);
+    extent = new_extent;
+    if (state == gui_window_state::ready_to_render) {
+        state = gui_window_state::swapchain_lost;
+    }
+}
+
+[[nodiscard]] extent2 gui_window_vulkan_headless::virtual_screen_size() const noexcept
+{
+    ttlet lock = std::scoped_lock(gui_system_mutex);
+    return extent;
+}
+
+[[nodiscard]] std::string gui_window_vulkan_headless::get_text_from_clipboard() const noexcept
+{
+    ttlet lock = std::scoped_lock(gui_system_mutex);
+    return clipboard;
+}
+
+void gui_window_vulkan_headless::set_text_on_clipboard(std::string str) noexcept
+{
+    ttlet lock = std::scoped_lock(gui_system_mutex);
+    clipboard = std::move(str);
+}
+
+std::optional<uint32_t> gui_window_vulkan_headless::acquireNextImageFromSwapchain(vk::Semaphore imageAvailableSemaphore)
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    ttlet imageIndex = nextImageIndex;
+    nextImageIndex = (nextImageIndex + 1) % narrow_cast<uint32_t>(images.size());
+
+    // There is no presentation engine to signal the semaphore, signal it with an empty batch.
+    auto submitInfo = vk::SubmitInfo{0, nullptr, nullptr, 0, nullptr, 1, &imageAvailableSemaphore};
+    vulkan_device().graphicsQueue.submit({submitInfo}, vk::Fence());
+
+    lastImageIndex = imageIndex;
+    return imageIndex;
+}
+
+void gui_window_vulkan_headless::presentImageToQueue(
+    uint32_t frameBufferIndex,
+    vk::Semaphore renderFinishedSemaphore,
+    dirty_rectangles const &changed_rectangles)
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    // Wait on the semaphore so that it is unsignaled before it is used by the next frame.
+    ttlet waitStage = vk::PipelineStageFlags{vk::PipelineStageFlagBits::eBottomOfPipe};
+    auto submitInfo = vk::SubmitInfo{1, &renderFinishedSemaphore, &waitStage, 0, nullptr, 0, nullptr};
+    vulkan_device().graphicsQueue.submit({submitInfo}, vk::Fence());
+}
+
+bool gui_window_vulkan_headless::readSurfaceExtent()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    nrSwapchainImages = defaultNumberOfSwapchainImages;
+    swapchainImageExtent = vk::Extent2D{
+        narrow_cast<uint32_t>(std::ceil(extent.width())), narrow_cast<uint32_t>(std::ceil(extent.height()))};
+
+    return swapchainImageExtent.width > 0 && swapchainImageExtent.height > 0;
+}
+
+bool gui_window_vulkan_headless::checkSurfaceExtent()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    // The extent only changes through set_window_size(), which tears down the images first.
+    return true;
+}
+
+bool gui_window_vulkan_headless::buildSurface()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    return true;
+}
+
+void gui_window_vulkan_headless::teardownSurface()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+}
+
+gui_window_state gui_window_vulkan_headless::buildSwapchain()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    tt_log_info("Building offscreen images:");
+    swapchainImageFormat = vk::SurfaceFormatKHR{imageFormat, vk::ColorSpaceKHR::eExtendedSrgbLinearEXT};
+
+    vk::ImageCreateInfo const imageCreateInfo = {
+        vk::ImageCreateFlags(),
+        vk::ImageType::e2D,
+        imageFormat,
+        vk::Extent3D(swapchainImageExtent.width, swapchainImageExtent.height, 1),
+        1, // mipLevels
+        1, // arrayLayers
+        vk::SampleCountFlagBits::e1,
+        vk::ImageTiling::eOptimal,
+        vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eTransferSrc,
+        vk::SharingMode::eExclusive,
+        0,
+        nullptr,
+        vk::ImageLayout::eUndefined};
+
+    VmaAllocationCreateInfo allocationCreateInfo = {};
+    allocationCreateInfo.usage = VMA_MEMORY_USAGE_GPU_ONLY;
+
+    images.resize(narrow_cast<size_t>(nrSwapchainImages));
+    imageAllocations.resize(narrow_cast<size_t>(nrSwapchainImages));
+    for (size_t i = 0; i != images.size(); ++i) {
+        std::tie(images[i], imageAllocations[i]) = vulkan_device().createImage(imageCreateInfo, allocationCreateInfo);
+    }
+
+    nextImageIndex = 0;
+    lastImageIndex = {};
+
+    tt_log_info(
+        " - extent=({}, {}), imageCount={}", swapchainImageExtent.width, swapchainImageExtent.height, nrSwapchainImages);
+    return gui_window_state::ready_to_render;
+}
+
+void gui_window_vulkan_headless::teardownSwapchain()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    for (size_t i = 0; i != images.size(); ++i) {
+        vulkan_device().destroyImage(images[i], imageAllocations[i]);
+    }
+    images.clear();
+    imageAllocations.clear();
+    lastImageIndex = {};
+}
+
+void gui_window_vulkan_headless::retireSwapchain()
+{
+    // There is no presentation engine to hand the offscreen images over to.
+    teardownSwapchain();
+}
+
+std::vector<vk::Image> gui_window_vulkan_headless::getSwapchainImages()
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    return images;
+}
+
+[[nodiscard]] pixel_map<sfloat_rgba16> gui_window_vulkan_headless::read_image()
+{
+    ttlet lock = std::scoped_lock(gui_system_mutex);
+
+    if (not lastImageIndex) {
+        return {};
+    }
+
+    waitIdle();
+
+    ttlet width = swapchainImageExtent.width;
+    ttlet height = swapchainImageExtent.height;
+    ttlet size = sizeof(sfloat_rgba16) * width * height;
+
+    vk::BufferCreateInfo const bufferCreateInfo = {
+        vk::BufferCreateFlags(), size, vk::BufferUsageFlagBits::eTransferDst, vk::SharingMode::eExclusive};
+    VmaAllocationCreateInfo allocationCreateInfo = {};
+    allocationCreateInfo.usage = VMA_MEMORY_USAGE_GPU_TO_CPU;
+    auto [buffer, allocation] = vulkan_device().createBuffer(bufferCreateInfo, allocationCreateInfo);
+
+    auto commands = vulkan_device().beginSingleTimeCommands();
+    ttlet region = vk::BufferImageCopy{
+        0, // bufferOffset
+        0, // bufferRowLength, tightly packed
+        0, // bufferImageHeight, tightly packed
+        vk::ImageSubresourceLayers{vk::ImageAspectFlagBits::eColor, 0, 0, 1},
+        vk::Offset3D{0, 0, 0},
+        vk::Extent3D{width, height, 1}};
+    commands.copyImageToBuffer(images[*lastImageIndex], vk::ImageLayout::eTransferSrcOptimal, buffer, {region});
+    vulkan_device().endSingleTimeCommands(commands);
+
+    // Rows are copied in the order of the image; row 0 is the top of the window.
+    auto r = pixel_map<sfloat_rgba16>(narrow_cast<ssize_t>(width), narrow_cast<ssize_t>(height));
+    ttlet data = vulkan_device().mapMemory<sfloat_rgba16>(allocation);
+    for (ssize_t y = 0; y != r.height(); ++y) {
+        auto row = r[y];
+        std::memcpy(row.data(), data.data() + y * r.width(), sizeof(sfloat_rgba16) * narrow_cast<size_t>(r.width()));
+    }
+    vulkan_device().unmapMemory(allocation);
+
+    vulkan_device().destroyBuffer(buffer, allocation);
+    return r;
+}
+
+} // namespace tt
@@ -0,0 +1,111 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "gui_window_vulkan.hpp"
+#include "../pixel_map.hpp"
+#include "../color/sfloat_rgba16.hpp"
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace tt {
+
+/** A window without an operating-system window or swapchain.
+ *
+ * The widgets are rendered into images allocated on the device, instead of into the images
+ * of a swapchain. The last rendered image can be read back into a pixel-map; this is used
+ * for benchmarking the rendering of widgets and for comparing the rendered pixels in tests.
+ *
+ * The window is rendered by `gui_system::render()` like any other window, or by calling
+ * `render()` directly while holding the `gui_system_mutex`.
+ */
+class gui_window_vulkan_headless final : public gui_window_vulkan {
+public:
+    /** The format of the images the window renders into.
+     * This is the same format as the pixel-map returned by `read_image()`.
+     */
+    static constexpr vk::Format imageFormat = vk::Format::eR16G16B16A16Sfloat;
+
+    gui_window_vulkan_headless(gui_system &system, std::weak_ptr<gui_window_delegate> const &delegate, label const &title);
+    ~gui_window_vulkan_headless();
+
+    gui_window_vulkan_headless(const gui_window_vulkan_headless &) = delete;
+    gui_window_vulkan_headless &operator=(const gui_window_vulkan_headless &) = delete;
+    gui_window_vulkan_headless(gui_window_vulkan_headless &&) = delete;
+    gui_window_vulkan_headless &operator=(gui_window_vulkan_headless &&) = delete;
+
+    void create_window(const std::u8string &title, extent2 extent) override;
+
+    /** A headless window has no surface.
+     * @return An empty surface.
+     */
+    vk::SurfaceKHR getSurface() const override;
+
+    void set_cursor(mouse_cursor cursor) noexcept override {}
+
+    void close_window() override;
+
+    void minimize_window() override {}
+
+    void maximize_window() override {}
+
+    void normalize_window() override {}
+
+    /** Change the size of the images the window renders into.
+     * The images are rebuild before the next frame.
+     */
+    void set_window_size(extent2 extent) override;
+
+    [[nodiscard]] extent2 virtual_screen_size() const noexcept override;
+
+    [[nodiscard]] std::string get_text_from_clipboard() const noexcept override;
+
+    void set_text_on_clipboard(std::string str) noexcept override;
+
+    /** Read back the image that was rendered last.
+     *
+     * This waits until the GPU has finished rendering.
+     *
+     * @return The pixels of the image, or an empty pixel-map when nothing was rendered yet.
+     */
+    [[nodiscard]] pixel_map<sfloat_rgba16> read_image();
+
+protected:
+    std::optional<uint32_t> acquireNextImageFromSwapchain(vk::Semaphore imageAvailableSemaphore) override;
+
+    void presentImageToQueue(
+        uint32_t frameBufferIndex,
+        vk::Semaphore renderFinishedSemaphore,
+        dirty_rectangles const &changed_rectangles) override;
+
+    bool readSurfaceExtent() override;
+    bool checkSurfaceExtent() override;
+    bool buildSurface() override;
+    void teardownSurface() override;
+    gui_window_state buildSwapchain() override;
+    void teardownSwapchain() override;
+    void retireSwapchain() override;
+    std::vector<vk::Image> getSwapchainImages() override;
+
+private:
+    std::vector<vk::Image> images;
+    std::vector<VmaAllocation> imageAllocations;
+
+    /** The index of the image that will be rendered into next.
+     */
+    uint32_t nextImageIndex = 0;
+
+    /** The index of the image that was rendered into last.
+     */
+    std::optional<uint32_t> lastImageIndex;
+
+    /** The text on the clipboard of this window.
+     * A headless window does not share the clipboard with the operating system.
+     */
+    std::string clipboard;
+};
+
+} // namespace tt
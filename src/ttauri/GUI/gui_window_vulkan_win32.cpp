@@ -58,6 +58,9 @@ static LRESULT CALLBACK _WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM
         tt_axiom(gui_system_mutex.recurse_lock_count() == 0);
         LRESULT result = window->windowProc(uMsg, wParam, lParam);
 
+        // Any message may change the state of the window or its widgets.
+        window->request_frame();
+
         if (uMsg == WM_DESTROY) {
             // Remove the window now, before DefWindowProc, which could recursively
             // Reuse the window as it is being cleaned up.
@@ -544,8 +547,18 @@ int gui_window_vulkan_win32::windowProc(unsigned int uMsg, uint64_t wParam, int6
     case WM_EXITSIZEMOVE: {
         ttlet lock = std::scoped_lock(gui_system_mutex);
         resizing = false;
+        // The window may have been moved to a monitor that is connected to another device.
+        system.request_device_reevaluation();
     } break;
 
+    case WM_DISPLAYCHANGE: system.request_device_reevaluation(); break;
+
+    case WM_POWERBROADCAST:
+        if (wParam == PBT_APMPOWERSTATUSCHANGE) {
+            system.request_device_reevaluation();
+        }
+        break;
+
     case WM_ACTIVATE: {
         ttlet lock = std::scoped_lock(gui_system_mutex);
         switch (wParam) {
@@ -654,13 +667,14 @@ int gui_window_vulkan_win32::windowProc(unsigned int uMsg, uint64_t wParam, int6
         break;
 
     case WM_NCHITTEST: {
-        gui_system_mutex.lock();
+        gui_system_mutex.lock_shared();
         ttlet screen_extent = virtual_screen_size();
         ttlet screen_position =
             point2(narrow_cast<float>(GET_X_LPARAM(lParam)), screen_extent.height() - narrow_cast<float>(GET_Y_LPARAM(lParam)));
 
+        increment_counter<"widget_hitbox_test">();
         ttlet hitbox_type = widget->hitbox_test(screen_to_window() * screen_position).type;
-        gui_system_mutex.unlock();
+        gui_system_mutex.unlock_shared();
 
         switch (hitbox_type) {
         case hit_box::Type::BottomResizeBorder: set_cursor(mouse_cursor::None); return HTBOTTOM;
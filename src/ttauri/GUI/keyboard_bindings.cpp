@@ -5,6 +5,7 @@
 #include "keyboard_bindings.hpp"
 #include "../codec/JSON.hpp"
 #include "../command.hpp"
+#include <bit>
 
 namespace tt {
 
@@ -45,18 +46,48 @@ void keyboard_bindings::loadBindings(URL url, bool system_binding)
             }
 
             if (ignored_binding) {
-                addIgnoredBinding(key, command);
+                add_binding(key, command, binding_type::ignored);
             } else if (system_binding) {
-                addSystemBinding(key, command);
+                add_binding(key, command, binding_type::system);
             } else {
-                addUserBinding(key, command);
+                add_binding(key, command, binding_type::user);
             }
         }
 
     } catch (std::exception const &e) {
+        compile();
         throw io_error("{}: Could not load keyboard bindings.\n{}", url, e.what());
     }
 
+    compile();
+}
+
+void keyboard_bindings::compile() noexcept
+{
+    auto merged = std::vector<bucket_t>{};
+    merged.reserve(bindings.size());
+    for (ttlet &[key, commands] : bindings) {
+        if (auto merged_commands = commands.merge(); !merged_commands.empty()) {
+            merged.push_back({key, std::move(merged_commands)});
+        }
+    }
+
+    table.clear();
+    if (merged.empty()) {
+        return;
+    }
+
+    // Keep the load factor at or below 50%, which also guarantees an empty bucket.
+    table.resize(std::bit_ceil(merged.size() * 2 + 1));
+    ttlet mask = table.size() - 1;
+
+    for (auto &bucket : merged) {
+        auto i = bucket.key.hash() & mask;
+        while (!table[i].commands.empty()) {
+            i = (i + 1) & mask;
+        }
+        table[i] = std::move(bucket);
+    }
 }
 
 
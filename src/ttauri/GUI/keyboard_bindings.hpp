@@ -9,6 +9,8 @@
 #include "../os_detect.hpp"
 #include "../command.hpp"
 #include <unordered_map>
+#include <vector>
+#include <algorithm>
 #include <tuple>
 
 namespace tt {
@@ -24,81 +26,94 @@ class keyboard_bindings {
         /** Added bindings loaded from user-binding-file. */
         std::vector<command> user = {};
 
-        /** Combined system-/ignored-/added-commands. */
-        std::vector<command> cache = {};
-
-        [[nodiscard]] std::vector<command> const &get_commands() const noexcept {
-            return cache;
-        }
-
         void add_system_command(command cmd) noexcept {
-            ttlet i = std::find(system.cbegin(), system.cend(), cmd);
-            if (i == system.cend()) {
-                system.push_back(cmd);
-                update_cache();
-            }
+            add_command(system, cmd);
         }
 
         void add_ignored_command(command cmd) noexcept {
-            ttlet i = std::find(ignored.cbegin(), ignored.cend(), cmd);
-            if (i == ignored.cend()) {
-                ignored.push_back(cmd);
-                update_cache();
-            }
+            add_command(ignored, cmd);
         }
 
         void add_user_command(command cmd) noexcept {
-            ttlet i = std::find(user.cbegin(), user.cend(), cmd);
-            if (i == user.cend()) {
-                user.push_back(cmd);
-                update_cache();
-            }
+            add_command(user, cmd);
         }
 
-        void update_cache() noexcept {
-            cache.reserve(std::ssize(system) + std::ssize(user));
+        /** Combine the system-/ignored-/added-commands.
+         */
+        [[nodiscard]] std::vector<command> merge() const noexcept {
+            auto r = std::vector<command>{};
+            r.reserve(std::ssize(system) + std::ssize(user));
 
             for (ttlet cmd: system) {
-                ttlet i = std::find(cache.cbegin(), cache.cend(), cmd);
-                if (i == cache.cend()) {
-                    cache.push_back(cmd);
+                if (std::find(ignored.cbegin(), ignored.cend(), cmd) == ignored.cend()) {
+                    add_command(r, cmd);
                 }
             }
 
-            for (ttlet cmd: ignored) {
-                ttlet i = std::find(cache.cbegin(), cache.cend(), cmd);
-                if (i != cache.cend()) {
-                    cache.erase(i);
-                }
+            for (ttlet cmd: user) {
+                add_command(r, cmd);
             }
+            return r;
+        }
 
-            for (ttlet cmd: user) {
-                ttlet i = std::find(cache.cbegin(), cache.cend(), cmd);
-                if (i == cache.cend()) {
-                    cache.push_back(cmd);
-                }
+    private:
+        static void add_command(std::vector<command> &commands, command cmd) noexcept {
+            if (std::find(commands.cbegin(), commands.cend(), cmd) == commands.cend()) {
+                commands.push_back(cmd);
             }
         }
     };
 
-    /** Bindings made by the user which may be saved for the user.
+    /** A bucket of the compiled binding table.
+     * A bucket without commands is empty, keys whose commands are all ignored are not in the table.
+     */
+    struct bucket_t {
+        keyboard_key key = {};
+        std::vector<command> commands = {};
+    };
+
+    /** Bindings made by the system and the user which may be saved for the user.
      */
     std::unordered_map<keyboard_key,commands_t> bindings;
 
+    /** The merged bindings, as a hash table with linear probing.
+     * The number of buckets is a power of two, and at least twice the number of keys,
+     * so that a probe finds the key or an empty bucket almost immediately.
+     */
+    std::vector<bucket_t> table;
+
+    enum class binding_type { system, ignored, user };
+
+    void add_binding(keyboard_key key, command command, binding_type type) noexcept {
+        switch (type) {
+        case binding_type::system: bindings[key].add_system_command(command); break;
+        case binding_type::ignored: bindings[key].add_ignored_command(command); break;
+        case binding_type::user: bindings[key].add_user_command(command); break;
+        default: tt_no_default();
+        }
+    }
+
+    /** Merge the user bindings with the system bindings into the binding table.
+     */
+    void compile() noexcept;
+
 public:
     keyboard_bindings() noexcept :
         bindings() {}
 
     void addSystemBinding(keyboard_key key, command command) noexcept {
-        bindings[key].add_system_command(command);
+        add_binding(key, command, binding_type::system);
+        compile();
     }
 
     void addIgnoredBinding(keyboard_key key, command command) noexcept {
-        bindings[key].add_ignored_command(command);
+        add_binding(key, command, binding_type::ignored);
+        compile();
     }
 
     void addUserBinding(keyboard_key key, command command) noexcept {
-        bindings[key].add_user_command(command);
+        add_binding(key, command, binding_type::user);
+        compile();
     }
 
     /** translate a key press in the empty-context to a command.
@@ -106,12 +121,19 @@ public:
     [[nodiscard]] std::vector<command> const &translate(keyboard_key key) const noexcept {
         static std::vector<command> empty_commands = {};
 
-        ttlet i = bindings.find(key);
-        if (i != bindings.cend()) {
-            return i->second.get_commands();
-        } else {
+        if (table.empty()) {
             return empty_commands;
         }
+
+        ttlet mask = table.size() - 1;
+
+        // There is always an empty bucket, which ends the linear probing.
+        for (auto i = key.hash() & mask; true; i = (i + 1) & mask) {
+            ttlet &bucket = table[i];
+            if (bucket.commands.empty() || bucket.key == key) {
+                return bucket.commands;
+            }
+        }
     }
 
     /** Clear all bindings.
@@ -121,9 +143,11 @@ public:
      */
     void clear() noexcept {
         bindings.clear();
+        table.clear();
     }
 
     /** Load bindings from a JSON file.
+     * The bindings are merged into the binding table once, after the whole file is loaded.
      */
     void loadBindings(URL url, bool system_binding);
 
@@ -27,6 +27,8 @@ struct mouse_buttons {
         shiftKey(false)
     {
     }
+
+    [[nodiscard]] friend bool operator==(mouse_buttons const &lhs, mouse_buttons const &rhs) noexcept = default;
 };
 
 }
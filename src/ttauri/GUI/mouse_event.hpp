@@ -71,6 +71,36 @@ struct mouse_event {
         return type == Type::Drag ? position - downPosition : vector2{};
     }
 
+    /** Merge a later event into this event.
+     *
+     * Consecutive move, drag and wheel events with the same buttons held down can be merged;
+     * the merged event has the latest position and the accumulated wheel delta.
+     *
+     * @param rhs The event that happened after this event.
+     * @return True if the event was merged, false if the events must be handled separately.
+     */
+    [[nodiscard]] bool merge(mouse_event const &rhs) noexcept
+    {
+        if (type != rhs.type or down != rhs.down) {
+            return false;
+        }
+
+        switch (type) {
+        case Type::Move: break;
+        case Type::Drag:
+            if (downPosition != rhs.downPosition) {
+                return false;
+            }
+            break;
+        case Type::Wheel: wheelDelta += rhs.wheelDelta; break;
+        default: return false;
+        }
+
+        timePoint = rhs.timePoint;
+        position = rhs.position;
+        return true;
+    }
+
     [[nodiscard]] friend mouse_event operator*(geo::transformer auto const &transform, mouse_event const &rhs) noexcept
     {
         auto r = rhs;
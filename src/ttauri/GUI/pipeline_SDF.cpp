@@ -6,6 +6,7 @@
 #include "pipeline_SDF_device_shared.hpp"
 #include "gui_window_vulkan.hpp"
 #include "gui_device_vulkan.hpp"
+#include <algorithm>
 
 namespace tt::pipeline_SDF {
 
@@ -13,28 +14,47 @@ using namespace tt;
 using namespace std;
 
 pipeline_SDF::pipeline_SDF(gui_window const &window) :
-    pipeline_vulkan(window)
+    pipeline_vulkan(window),
+    // Initially the number of vertices addressed by the quad index buffer.
+    vertexBuffers(1 << 16, 1 << 20)
 {
 }
 
-void pipeline_SDF::drawInCommandBuffer(vk::CommandBuffer commandBuffer)
+void pipeline_SDF::set_frame_in_flight(size_t index) noexcept
 {
-    pipeline_vulkan::drawInCommandBuffer(commandBuffer);
+    pipeline_vulkan::set_frame_in_flight(index);
+    vertexBuffers.select(vulkan_device(), index, vertexBufferData);
+}
+
+void pipeline_SDF::prepareForDraw()
+{
+    if (intrinsic and window.subpixel_orientation != subpixelOrientationForBuild) {
+        // The pipeline is specialized for the subpixel orientation; rebuild it once the frames
+        // in flight no longer use it.
+        [[unlikely]] vulkan_device().waitIdle();
+        teardownPipeline();
+    }
 
-    vulkan_device().flushAllocation(vertexBufferAllocation, 0, vertexBufferData.size() * sizeof (vertex));
-    vulkan_device().SDFPipeline->prepareAtlasForRendering();
+    pipeline_vulkan::prepareForDraw();
 
-    std::vector<vk::Buffer> tmpvertexBuffers = { vertexBuffer };
+    vertexBuffers.flush(vulkan_device(), vertexBufferData.size());
+    sharedPipeline = &vulkan_device().SDF_pipeline();
+}
+
+void pipeline_SDF::drawInCommandBuffer(vk::CommandBuffer commandBuffer, size_t redrawRectangleIndex)
+{
+    pipeline_vulkan::drawInCommandBuffer(commandBuffer);
+
+    std::vector<vk::Buffer> tmpvertexBuffers = { vertexBuffers.buffer() };
     std::vector<vk::DeviceSize> tmpOffsets = { 0 };
     tt_axiom(tmpvertexBuffers.size() == tmpOffsets.size());
 
-    vulkan_device().SDFPipeline->drawInCommandBuffer(commandBuffer);
+    sharedPipeline->drawInCommandBuffer(commandBuffer);
 
     commandBuffer.bindVertexBuffers(0, tmpvertexBuffers, tmpOffsets);
 
     pushConstants.windowExtent = extent2{ narrow_cast<float>(extent.width) , narrow_cast<float>(extent.height) };
     pushConstants.viewportScale = scale2{ narrow_cast<float>(2.0f / extent.width), narrow_cast<float>(2.0f / extent.height)};
-    pushConstants.subpixel_orientation = static_cast<int>(window.subpixel_orientation);
 
     commandBuffer.pushConstants(
         pipelineLayout,
@@ -44,19 +64,33 @@ void pipeline_SDF::drawInCommandBuffer(vk::CommandBuffer commandBuffer)
         &pushConstants
     );
 
-    ttlet numberOfRectangles = vertexBufferData.size() / 4;
-    ttlet numberOfTriangles = numberOfRectangles * 2;
-    commandBuffer.drawIndexed(
-        narrow_cast<uint32_t>(numberOfTriangles * 3),
-        1,
-        0,
-        0,
-        0
-    );
+    // Only the ranges of vertices that overlap the redraw rectangle are drawn.
+    // The quad index buffer addresses 65536 vertices, larger ranges are drawn in batches.
+    constexpr size_t maximumNumberOfRectanglesPerDraw = (1 << 16) / 4;
+    vertexBufferRanges.for_each(redrawRectangleIndex, [&](size_t firstVertex, size_t numberOfVertices) {
+        ttlet firstRectangle = firstVertex / 4;
+        ttlet lastRectangle = firstRectangle + numberOfVertices / 4;
+        for (auto i = firstRectangle; i < lastRectangle; i += maximumNumberOfRectanglesPerDraw) {
+            ttlet numberOfTriangles = std::min(lastRectangle - i, maximumNumberOfRectanglesPerDraw) * 2;
+            commandBuffer.drawIndexed(
+                narrow_cast<uint32_t>(numberOfTriangles * 3),
+                1,
+                0,
+                narrow_cast<int32_t>(i * 4),
+                0
+            );
+        }
+    });
 }
 
 std::vector<vk::PipelineShaderStageCreateInfo> pipeline_SDF::createShaderStages() const {
-    return vulkan_device().SDFPipeline->shaderStages;
+    return vulkan_device().SDF_pipeline().shader_stages(window.subpixel_orientation);
+}
+
+void pipeline_SDF::buildPipeline(vk::RenderPass renderPass, uint32_t renderSubpass, vk::Extent2D extent)
+{
+    subpixelOrientationForBuild = window.subpixel_orientation;
+    pipeline_vulkan::buildPipeline(renderPass, renderSubpass, extent);
 }
 
 /* No alpha blending as SDF fragment shader does this manually.
@@ -98,7 +132,7 @@ std::vector<vk::DescriptorSetLayoutBinding> pipeline_SDF::createDescriptorSetLay
 
 vector<vk::WriteDescriptorSet> pipeline_SDF::createWriteDescriptorSet() const
 {
-    ttlet &sharedImagePipeline = vulkan_device().SDFPipeline;
+    ttlet &sharedImagePipeline = vulkan_device().SDF_pipeline();
 
     return {
         {
@@ -116,16 +150,16 @@ vector<vk::WriteDescriptorSet> pipeline_SDF::createWriteDescriptorSet() const
             0, // arrayElement
             1, // descriptorCount
             vk::DescriptorType::eSampler,
-            &sharedImagePipeline->atlasSamplerDescriptorImageInfo,
+            &sharedImagePipeline.atlasSamplerDescriptorImageInfo,
             nullptr,  // bufferInfo
             nullptr // texelBufferView
         }, {
             descriptorSet,
             2, // destBinding
             0, // arrayElement
-            narrow_cast<uint32_t>(sharedImagePipeline->atlasDescriptorImageInfos.size()), // descriptorCount
+            narrow_cast<uint32_t>(sharedImagePipeline.atlasDescriptorImageInfos.size()), // descriptorCount
             vk::DescriptorType::eSampledImage,
-            sharedImagePipeline->atlasDescriptorImageInfos.data(),
+            sharedImagePipeline.atlasDescriptorImageInfos.data(),
             nullptr, // bufferInfo
             nullptr // texelBufferView
         }, 
@@ -134,7 +168,7 @@ vector<vk::WriteDescriptorSet> pipeline_SDF::createWriteDescriptorSet() const
 
 ssize_t pipeline_SDF::getDescriptorSetVersion() const
 {
-    return std::ssize(vulkan_device().SDFPipeline->atlasTextures);
+    return vulkan_device().SDF_pipeline().atlasDescriptorSetVersion;
 }
 
 std::vector<vk::PushConstantRange> pipeline_SDF::createPushConstantRanges() const
@@ -153,26 +187,14 @@ std::vector<vk::VertexInputAttributeDescription> pipeline_SDF::createVertexInput
 
 void pipeline_SDF::buildvertexBuffers()
 {
-    using vertexIndexType = uint16_t;
-    constexpr ssize_t numberOfVertices = 1 << (sizeof(vertexIndexType) * CHAR_BIT);
-
-    vk::BufferCreateInfo const bufferCreateInfo = {
-        vk::BufferCreateFlags(),
-        sizeof (vertex) * numberOfVertices,
-        vk::BufferUsageFlagBits::eVertexBuffer,
-        vk::SharingMode::eExclusive
-    };
-    VmaAllocationCreateInfo allocationCreateInfo = {};
-    allocationCreateInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
-
-    std::tie(vertexBuffer, vertexBufferAllocation) = vulkan_device().createBuffer(bufferCreateInfo, allocationCreateInfo);
-    vertexBufferData = vulkan_device().mapMemory<vertex>(vertexBufferAllocation);
+    vertexBuffers.build(vulkan_device(), nrFramesInFlight());
+    vertexBuffers.select(vulkan_device(), frameInFlightIndex, vertexBufferData);
 }
 
 void pipeline_SDF::teardownvertexBuffers()
 {
-    vulkan_device().unmapMemory(vertexBufferAllocation);
-    vulkan_device().destroyBuffer(vertexBuffer, vertexBufferAllocation);
+    vertexBuffers.teardown(vulkan_device());
+    vertexBufferData = {};
 }
 
 }
@@ -4,16 +4,19 @@
 layout(push_constant) uniform push_constants {
     vec2 window_extent;
     vec2 viewport_scale;
-    int subpixel_orientation; // 0:Unknown, 1:BlueRight, 2:BlueLeft, 3:BlueTop, 4:BlueBottom
 } pushConstants;
 
 layout(constant_id = 0) const float sdf_max_distance = 1.0;
 layout(constant_id = 1) const float atlas_image_width = 1.0;
+layout(constant_id = 2) const int subpixel_orientation = 0; // 0:Unknown, 1:BlueRight, 2:BlueLeft, 3:BlueTop, 4:BlueBottom
 
 layout(input_attachment_index = 0, set = 0, binding = 0) uniform subpassInput in_background_color;
 layout(set = 0, binding = 1) uniform sampler in_sampler;
 layout(set = 0, binding = 2) uniform texture2D in_textures[16];
 
+// Coverage glyphs use the layers beyond the last atlas image in the texture coordinate.
+const int atlas_nr_images = 16;
+
 layout(location = 0) in flat vec4 in_clipping_rectangle;
 layout(location = 1) in vec3 in_texture_coord;
 layout(location = 2) in vec4 in_color_luv;
@@ -27,7 +30,7 @@ layout(location = 0) out vec4 out_color;
  * @return The red subpixel offset in (x,y), the blue subpixel offset in (z,w)
  */
 vec4 get_red_blue_subpixel_offset(vec4 texture_stride) {
-    switch (pushConstants.subpixel_orientation) {
+    switch (subpixel_orientation) {
     case 1: // Red-left, Blue-right
         return vec4(
             texture_stride.xy / -3.0,
@@ -78,6 +81,51 @@ vec2 get_red_blue_subpixel_radius(float distance_multiplier, vec4 texture_stride
         texture(sampler2D(in_textures[int(in_texture_coord.z)], in_sampler), rb_coords.zw).r * distance_multiplier);
 }
 
+/** Get the coverage of each subpixel of a coverage glyph.
+ * The texture has a texel for each subpixel horizontally, already filtered for LCD displays.
+ * @return The coverage of the red, green and blue subpixel.
+ */
+vec3 get_subpixel_coverage(int layer)
+{
+    vec2 texel_stride = vec2(1.0 / atlas_image_width, 0.0);
+    vec3 coverage = max(vec3(
+        texture(sampler2D(in_textures[layer], in_sampler), in_texture_coord.xy - texel_stride).r,
+        texture(sampler2D(in_textures[layer], in_sampler), in_texture_coord.xy).r,
+        texture(sampler2D(in_textures[layer], in_sampler), in_texture_coord.xy + texel_stride).r), 0.0);
+
+    switch (subpixel_orientation) {
+    case 1: // Red-left, Blue-right
+        return coverage;
+
+    case 2: // Blue-left, Red-right
+        return coverage.bgr;
+
+    default:
+        // The glyph was not rendered for vertical subpixels, use normal anti-aliasing.
+        return vec3((coverage.r + coverage.g + coverage.b) / 3.0);
+    }
+}
+
+/** Draw a coverage glyph.
+ */
+void draw_coverage_glyph(int layer)
+{
+    vec3 rgb_coverage = get_subpixel_coverage(layer) * in_color_luv.a;
+    if (all(equal(rgb_coverage, vec3(0.0, 0.0, 0.0)))) {
+        discard;
+    }
+
+    vec4 background_rgba = subpassLoad(in_background_color);
+    vec3 background_luv = rgb_to_tluv(background_rgba.rgb);
+
+    vec3 r_composit_luv = mix(background_luv, in_color_luv.xyz, rgb_coverage.r);
+    vec3 g_composit_luv = mix(background_luv, in_color_luv.xyz, rgb_coverage.g);
+    vec3 b_composit_luv = mix(background_luv, in_color_luv.xyz, rgb_coverage.b);
+
+    vec3 composit_rgb = tluv_to_rgb(r_composit_luv, g_composit_luv, b_composit_luv);
+    out_color = vec4(composit_rgb, 1.0);
+}
+
 /** Get the horizontal and vertical stride in a texture map from one fragment to the next.
  * @return The horizontal texture stride in (x,y) and the vertical texture stride in (z,w).
  */
@@ -96,6 +144,12 @@ void main()
         discard;
     }
 
+    int layer = int(in_texture_coord.z + 0.5);
+    if (layer >= atlas_nr_images) {
+        draw_coverage_glyph(layer - atlas_nr_images);
+        return;
+    }
+
     // The amount of distance and direction covered in 2D inside the texture when
     // stepping one fragment to the right.
     vec4 texture_stride = get_texture_stride();
@@ -118,8 +172,8 @@ void main()
         vec4 background_rgba = subpassLoad(in_background_color);
         vec3 background_luv = rgb_to_tluv(background_rgba.rgb);
 
-        if (pushConstants.subpixel_orientation == 0) {
-            // Normal anti-aliasing.
+        if (subpixel_orientation == 0) {
+            // Normal anti-aliasing, the subpixel code is removed when the pipeline is specialized.
             float coverage = clamp(g_radius + 0.5, 0.0, 1.0) * in_color_luv.a;
             vec3 composit_luv = mix(background_luv, in_color_luv.xyz, coverage);
             vec3 composit_rgb = tluv_to_rgb(composit_luv);
@@ -5,13 +5,17 @@
 #pragma once
 
 #include "pipeline_vulkan.hpp"
+#include "frame_vertex_buffers.hpp"
+#include "redraw_vertex_ranges.hpp"
 #include "pipeline_SDF_push_constants.hpp"
 #include "pipeline_SDF_vertex.hpp"
+#include "subpixel_orientation.hpp"
 #include "../vspan.hpp"
 #include <vk_mem_alloc.h>
 #include <span>
 
 namespace tt::pipeline_SDF {
+struct device_shared;
 
 /*! Pipeline for rendering backings of widgets.
  * Maintains texture map atlases and sharing for all views.
@@ -20,6 +24,10 @@ class pipeline_SDF : public pipeline_vulkan {
 public:
     vspan<vertex> vertexBufferData;
 
+    /** The ranges of `vertexBufferData` with the redraw rectangles they overlap.
+     */
+    redraw_vertex_ranges vertexBufferRanges;
+
     pipeline_SDF(gui_window const &window);
     ~pipeline_SDF() {};
 
@@ -28,14 +36,29 @@ public:
     pipeline_SDF(pipeline_SDF &&) = delete;
     pipeline_SDF &operator=(pipeline_SDF &&) = delete;
 
-    void drawInCommandBuffer(vk::CommandBuffer commandBuffer) override;
+    void prepareForDraw() override;
+
+    /** Draw the vertices that overlap a redraw rectangle.
+     * This only records commands, so that the draws of the pipelines can be recorded in parallel.
+     * @param redrawRectangleIndex The index of the redraw rectangle of the current render pass.
+     */
+    void drawInCommandBuffer(vk::CommandBuffer commandBuffer, size_t redrawRectangleIndex);
+    void set_frame_in_flight(size_t index) noexcept override;
 
 protected:
     push_constants pushConstants;
     int numberOfAtlasImagesInDescriptor = 0;
 
-    vk::Buffer vertexBuffer;
-    VmaAllocation vertexBufferAllocation;
+    /** The subpixel orientation for which the pipeline was specialized.
+     */
+    subpixel_orientation subpixelOrientationForBuild = subpixel_orientation::Unknown;
+
+    // One vertex buffer for each frame-in-flight.
+    frame_vertex_buffers<vertex> vertexBuffers;
+
+    /** The resources shared by the windows on the device, selected by `prepareForDraw()`.
+     */
+    device_shared *sharedPipeline = nullptr;
 
     std::vector<vk::PipelineShaderStageCreateInfo> createShaderStages() const override;
     std::vector<vk::DescriptorSetLayoutBinding> createDescriptorSetLayoutBindings() const override;
@@ -45,6 +68,7 @@ protected:
     vk::VertexInputBindingDescription createVertexInputBindingDescription() const override;
     std::vector<vk::VertexInputAttributeDescription> createVertexInputAttributeDescriptions() const override;
     std::vector<vk::PipelineColorBlendAttachmentState> getPipelineColorBlendAttachmentStates() const override;
+    void buildPipeline(vk::RenderPass renderPass, uint32_t renderSubpass, vk::Extent2D extent) override;
 
 private:
     void buildvertexBuffers() override;
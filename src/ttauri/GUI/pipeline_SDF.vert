@@ -4,7 +4,6 @@
 layout(push_constant) uniform push_constants {
     vec2 window_extent;
     vec2 viewport_scale;
-    int subpixel_orientation;
 } pushConstants;
 
 // In position is in window pixel position, with left-bottom origin.
@@ -7,22 +7,29 @@
 #include "gui_device_vulkan.hpp"
 #include "../text/shaped_text.hpp"
 #include "../pixel_map.hpp"
+#include "../bezier_curve.hpp"
 #include "../URL.hpp"
 #include "../memory.hpp"
 #include "../cast.hpp"
+#include "../counters.hpp"
 #include "../geometry/axis_aligned_rectangle.hpp"
 #include "../geometry/scale.hpp"
 #include "../geometry/translate.hpp"
+#include "../thread.hpp"
+#include "../trace.hpp"
 #include <array>
+#include <algorithm>
 
 namespace tt::pipeline_SDF {
 
 using namespace std;
 
-device_shared::device_shared(gui_device_vulkan const &device) : device(device)
+device_shared::device_shared(gui_device_vulkan const &device) : device(device), stagingBuffer(device, stagingBufferSize)
 {
     buildShaders();
     buildAtlas();
+    glyphCache = std::make_unique<glyph_cache>(URL::urlFromApplicationDataDirectory() / "glyph_sdf_cache.bin");
+    buildGlyphThreads();
 }
 
 device_shared::~device_shared() {}
@@ -31,6 +38,11 @@ void device_shared::destroy(gui_device_vulkan *vulkanDevice)
 {
     tt_axiom(vulkanDevice);
 
+    teardownGlyphThreads();
+    if (glyphCache) {
+        glyphCache->save();
+        glyphCache = nullptr;
+    }
     teardownShaders(vulkanDevice);
     teardownAtlas(vulkanDevice);
 }
@@ -52,6 +64,12 @@ void device_shared::destroy(gui_device_vulkan *vulkanDevice)
         if (atlas_allocation_position.z() >= size(atlasTextures)) {
             addAtlasImage();
         }
+
+        // The atlas can not be compacted right now, since vertices of the current frame
+        // may already point to glyphs in the atlas.
+        if (size(atlasTextures) * atlasImageSize > atlasMemoryBudget) {
+            atlasNeedsCompaction = true;
+        }
     }
 
     if (atlas_allocation_position.x() + imageWidth > atlasImageWidth) {
@@ -67,43 +85,216 @@ void device_shared::destroy(gui_device_vulkan *vulkanDevice)
     return r;
 }
 
-void device_shared::uploadStagingPixmapToAtlas(atlas_rect location)
+void device_shared::uploadStagingBufferToAtlas(std::vector<glyph_upload> const &uploads)
 {
-    // Flush the given image, included the border.
-    device.flushAllocation(
-        stagingTexture.allocation, 0, (stagingTexture.pixel_map.height() * stagingTexture.pixel_map.stride()) * sizeof(sdf_r8));
+    array<vector<vk::BufferImageCopy>, atlasMaximumNrImages> regionsToCopyPerAtlasTexture;
+
+    for (ttlet &upload : uploads) {
+        ttlet &location = upload.location;
+        regionsToCopyPerAtlasTexture.at(narrow_cast<size_t>(location.atlas_position.z()))
+            .emplace_back(
+                upload.staging_offset,
+                0, // The rows of the glyph are tightly packed.
+                0,
+                vk::ImageSubresourceLayers{vk::ImageAspectFlagBits::eColor, 0, 0, 1},
+                vk::Offset3D{
+                    narrow_cast<int32_t>(location.atlas_position.x()), narrow_cast<int32_t>(location.atlas_position.y()), 0},
+                vk::Extent3D{narrow_cast<uint32_t>(location.size.width()), narrow_cast<uint32_t>(location.size.height()), 1});
+    }
 
-    stagingTexture.transitionLayout(device, vk::Format::eR8Snorm, vk::ImageLayout::eTransferSrcOptimal);
+    // The atlas textures stay in the general layout, so that the transfer queue does not
+    // need to transition images that are being sampled by the graphics queue.
+    ttlet commandBuffer = device.beginTransferCommands();
+    for (size_t atlasTextureIndex = 0; atlasTextureIndex != atlasTextures.size(); ++atlasTextureIndex) {
+        ttlet &regionsToCopy = regionsToCopyPerAtlasTexture.at(atlasTextureIndex);
+        if (regionsToCopy.empty()) {
+            continue;
+        }
 
-    array<vector<vk::ImageCopy>, atlasMaximumNrImages> regionsToCopyPerAtlasTexture;
+        commandBuffer.copyBufferToImage(
+            stagingBuffer.buffer, atlasTextures.at(atlasTextureIndex).image, vk::ImageLayout::eGeneral, regionsToCopy);
+    }
+    stagingBuffer.submitted(device.endTransferCommands(commandBuffer));
+}
 
-    auto regionsToCopy = std::vector{vk::ImageCopy{
-        {vk::ImageAspectFlagBits::eColor, 0, 0, 1},
-        {0, 0, 0},
-        {vk::ImageAspectFlagBits::eColor, 0, 0, 1},
-        {narrow_cast<int32_t>(location.atlas_position.x()), narrow_cast<int32_t>(location.atlas_position.y()), 0},
-        {narrow_cast<uint32_t>(location.size.width()), narrow_cast<uint32_t>(location.size.height()), 1}}};
+bool device_shared::uploadCompletedGlyphs() noexcept
+{
+    auto results = std::vector<glyph_result>{};
+    {
+        ttlet lock = std::scoped_lock(glyph_mutex);
+        std::swap(results, glyph_results);
+    }
 
-    auto &atlasTexture = atlasTextures.at(narrow_cast<size_t>(location.atlas_position.z()));
-    atlasTexture.transitionLayout(device, vk::Format::eR8Snorm, vk::ImageLayout::eTransferDstOptimal);
+    if (results.empty()) {
+        return false;
+    }
+
+    auto tr = trace<"sdf_glyph_upload", "nr_glyphs", "nr_submits">();
+
+    // All glyphs of a frame are copied by a single submit, unless the staging buffer is full.
+    auto nr_submits = 0;
+    auto uploads = std::vector<glyph_upload>{};
+    uploads.reserve(results.size());
+    for (ttlet &result : results) {
+        ttlet width = result.pixels.width();
+        ttlet height = result.pixels.height();
+        ttlet size = narrow_cast<size_t>(width * height) * sizeof(sdf_r8);
+
+        // The offset of a buffer-to-image copy must be a multiple of 4.
+        auto region = stagingBuffer.allocate(size, 4);
+        if (!region) {
+            // The staging buffer is full, upload what we have so far to make room.
+            uploadStagingBufferToAtlas(uploads);
+            ++nr_submits;
+            uploads.clear();
+            region = stagingBuffer.allocate(size, 4);
+            tt_axiom(region);
+        }
 
-    device.copyImage(
-        stagingTexture.image,
-        vk::ImageLayout::eTransferSrcOptimal,
-        atlasTexture.image,
-        vk::ImageLayout::eTransferDstOptimal,
-        std::move(regionsToCopy));
+        auto pixmap = pixel_map<sdf_r8>{reinterpret_cast<sdf_r8 *>(region.bytes.data()), width, height};
+        copy(result.pixels, pixmap);
+        stagingBuffer.flush(region);
+        uploads.push_back({region.offset, result.location});
+        --nrQueuedGlyphs;
+
+        if (!result.is_cached) {
+            glyphCache->insert(result.cache_key, result.pixels);
+        }
+    }
+    uploadStagingBufferToAtlas(uploads);
+    ++nr_submits;
+
+    tr.set<"nr_glyphs">(results.size());
+    tr.set<"nr_submits">(nr_submits);
+    ++atlas_generation;
+    return true;
 }
 
-void device_shared::prepareStagingPixmapForDrawing()
+void device_shared::compactAtlas() noexcept
 {
-    stagingTexture.transitionLayout(device, vk::Format::eR8Snorm, vk::ImageLayout::eGeneral);
+    auto tr = trace<"sdf_atlas_compact">();
+
+    tt_axiom(nrQueuedGlyphs == 0);
+
+    // Sort the glyphs from most-recently-used to least-recently-used.
+    auto glyphs = std::vector<atlas_glyph *>{};
+    glyphs.reserve(size(glyphs_in_atlas) + size(small_glyphs_in_atlas));
+    for (auto &[key, entry] : glyphs_in_atlas) {
+        glyphs.push_back(&entry);
+    }
+    for (auto &[key, entry] : small_glyphs_in_atlas) {
+        glyphs.push_back(&entry);
+    }
+    std::sort(glyphs.begin(), glyphs.end(), [](ttlet &lhs, ttlet &rhs) {
+        return lhs->last_used_frame > rhs->last_used_frame;
+    });
+
+    auto oldAtlasTextures = std::move(atlasTextures);
+    atlasTextures.clear();
+    atlas_allocation_position = {};
+    atlasAllocationMaxHeight = 0;
+    addAtlasImage();
+
+    // Leave half of the budget for new glyphs, so that the atlas is not compacted every frame.
+    ttlet targetArea = narrow_cast<float>(atlasMemoryBudget / sizeof(sdf_r8)) * 0.5f;
+    auto keptArea = 0.0f;
+
+    auto regionsToCopy = std::vector<std::vector<vk::ImageCopy>>(size(oldAtlasTextures) * atlasMaximumNrImages);
+    auto nrKeptGlyphs = 0_uz;
+    for (; nrKeptGlyphs != size(glyphs); ++nrKeptGlyphs) {
+        auto &entry = *glyphs[nrKeptGlyphs];
+        ttlet area = entry.location.size.width() * entry.location.size.height();
+        ttlet recently_used = entry.last_used_frame + 1 >= frameCount;
+        if (!recently_used && keptArea + area > targetArea) {
+            // The rest of the glyphs have been used even less recently, evict them too.
+            break;
+        }
+        keptArea += area;
+
+        ttlet oldLocation = entry.location;
+        ttlet newLocation = allocateRect(oldLocation.size);
+        entry.location = newLocation;
+
+        ttlet oldIndex = narrow_cast<size_t>(oldLocation.atlas_position.z());
+        ttlet newIndex = narrow_cast<size_t>(newLocation.atlas_position.z());
+        regionsToCopy.at(oldIndex * atlasMaximumNrImages + newIndex)
+            .emplace_back(
+                vk::ImageSubresourceLayers{vk::ImageAspectFlagBits::eColor, 0, 0, 1},
+                vk::Offset3D{
+                    narrow_cast<int32_t>(oldLocation.atlas_position.x()), narrow_cast<int32_t>(oldLocation.atlas_position.y()), 0},
+                vk::ImageSubresourceLayers{vk::ImageAspectFlagBits::eColor, 0, 0, 1},
+                vk::Offset3D{
+                    narrow_cast<int32_t>(newLocation.atlas_position.x()), narrow_cast<int32_t>(newLocation.atlas_position.y()), 0},
+                vk::Extent3D{narrow_cast<uint32_t>(oldLocation.size.width()), narrow_cast<uint32_t>(oldLocation.size.height()), 1});
+    }
+
+    // Mark the evicted glyphs, so that they can be removed from both maps.
+    for (auto i = nrKeptGlyphs; i != size(glyphs); ++i) {
+        glyphs[i]->last_used_frame = evicted_frame;
+    }
+    ttlet is_evicted = [](ttlet &item) {
+        return item.second.last_used_frame == evicted_frame;
+    };
+    std::erase_if(glyphs_in_atlas, is_evicted);
+    std::erase_if(small_glyphs_in_atlas, is_evicted);
+
+    tt_log_info(
+        "pipeline_SDF atlas compacted from {} to {} images, kept {} of {} glyphs.",
+        size(oldAtlasTextures),
+        size(atlasTextures),
+        nrKeptGlyphs,
+        size(glyphs));
+
+    // Glyphs may still be copied into the old textures by the transfer queue.
+    device.waitForTransfer(device.transferTimelineValue);
+
+    for (size_t oldIndex = 0; oldIndex != size(oldAtlasTextures); ++oldIndex) {
+        ttlet &oldAtlasTexture = oldAtlasTextures.at(oldIndex);
+
+        for (size_t newIndex = 0; newIndex != size(atlasTextures); ++newIndex) {
+            auto &regions = regionsToCopy.at(oldIndex * atlasMaximumNrImages + newIndex);
+            if (regions.empty()) {
+                continue;
+            }
+
+            device.copyImage(
+                oldAtlasTexture.image,
+                vk::ImageLayout::eGeneral,
+                atlasTextures.at(newIndex).image,
+                vk::ImageLayout::eGeneral,
+                std::move(regions));
+        }
+    }
+
+    // The copies wait for the graphics queue to be idle, so the old textures are no longer in use.
+    for (ttlet &oldAtlasTexture : oldAtlasTextures) {
+        device.destroy(oldAtlasTexture.view);
+        add_to_counter<"sdf_atlas_bytes">(-device.allocationSize(oldAtlasTexture.allocation));
+        device.destroyImage(oldAtlasTexture.image, oldAtlasTexture.allocation);
+    }
+
+    atlasNeedsCompaction = false;
+    ++atlasDescriptorSetVersion;
+    ++atlas_layout_generation;
 }
 
-void device_shared::prepareAtlasForRendering()
+void device_shared::updateAtlas() noexcept
 {
-    for (auto &atlasTexture : atlasTextures) {
-        atlasTexture.transitionLayout(device, vk::Format::eR8Snorm, vk::ImageLayout::eShaderReadOnlyOptimal);
+    ++frameCount;
+
+    uploadCompletedGlyphs();
+
+    // Glyphs that are still queued point to locations in the current atlas textures.
+    if (atlasNeedsCompaction && nrQueuedGlyphs == 0) {
+        compactAtlas();
+    }
+}
+
+void device_shared::reduceAtlasMemory() noexcept
+{
+    // Compaction keeps at least the first atlas image, so a single image can not be reduced.
+    if (size(atlasTextures) > 1) {
+        atlasNeedsCompaction = true;
     }
 }
 
@@ -140,45 +331,157 @@ atlas_rect device_shared::addGlyphToAtlas(font_glyph_ids glyph) noexcept
     ttlet drawTranslate = translate2{drawOffset};
 
     // Transform the path to the scale of the fixed font size and drawing the bounding box inside the image.
-    ttlet drawPath = (drawTranslate * drawScale) * glyphPath;
+    auto drawPath = (drawTranslate * drawScale) * glyphPath;
 
-    // Draw glyphs into staging buffer of the atlas and upload it to the correct position in the atlas.
-    prepareStagingPixmapForDrawing();
+    // The glyph is rendered by one of the glyph-threads, and uploaded to the atlas on a later frame.
+    // Until then the allocated rectangle in the atlas is empty.
     auto atlas_rect = allocateRect(drawExtent);
-    auto pixmap = stagingTexture.pixel_map.submap(aarectangle{atlas_rect.size});
-    fill(pixmap, drawPath);
-    uploadStagingPixmapToAtlas(atlas_rect);
+    ttlet cache_key = glyph_cache::make_key(drawPath, drawExtent);
+    ++nrQueuedGlyphs;
+    increment_counter<"sdf_atlas_glyph_add">();
+
+    if (auto cached_pixels = glyphCache->find(cache_key)) {
+        // A glyph from the cache is uploaded with the next batch of rendered glyphs.
+        ttlet lock = std::scoped_lock(glyph_mutex);
+        glyph_results.push_back({atlas_rect, std::move(cached_pixels), cache_key, true});
+
+    } else {
+        {
+            ttlet lock = std::scoped_lock(glyph_mutex);
+            glyph_jobs.push_back({atlas_rect, std::move(drawPath), cache_key, false});
+        }
+        glyph_condition.notify_one();
+    }
 
     return atlas_rect;
 }
 
-std::pair<atlas_rect, bool> device_shared::getGlyphFromAtlas(font_glyph_ids glyph) noexcept
+atlas_rect device_shared::getGlyphFromAtlas(font_glyph_ids glyph) noexcept
 {
     ttlet i = glyphs_in_atlas.find(glyph);
     if (i != glyphs_in_atlas.cend()) {
-        return {i->second, false};
+        i->second.last_used_frame = frameCount;
+        return i->second.location;
 
     } else {
         ttlet aarectangle = addGlyphToAtlas(glyph);
-        glyphs_in_atlas.emplace(glyph, aarectangle);
-        return {aarectangle, true};
+        glyphs_in_atlas.emplace(glyph, atlas_glyph{aarectangle, frameCount});
+        return aarectangle;
     }
 }
 
+/** Allocate a coverage glyph in the atlas.
+ *
+ * The image of a coverage glyph has a texel for each subpixel horizontally, and a texel for
+ * each pixel vertically. The origin of the glyph is on a pixel corner in the image, with a
+ * border on the left and right for drawing the glyph up to two subpixels to the right.
+ */
+device_shared::small_atlas_glyph device_shared::addSmallGlyphToAtlas(small_glyph_key const &key) noexcept
+{
+    ttlet[glyphPath, glyphBoundingBox] = key.glyphs.getPathAndBoundingBox();
+
+    ttlet size = narrow_cast<float>(key.size) * 0.25f;
+    ttlet border = narrow_cast<float>(small_glyph_border);
+    ttlet oversampling = narrow_cast<float>(small_glyph_oversampling);
+
+    // The rectangle of the image in pixels relative to the origin of the glyph.
+    ttlet left = std::floor(glyphBoundingBox.left() * size) - border;
+    ttlet right = std::ceil(glyphBoundingBox.right() * size) + border;
+    ttlet bottom = std::floor(glyphBoundingBox.bottom() * size) - 1.0f;
+    ttlet top = std::ceil(glyphBoundingBox.top() * size) + 1.0f;
+
+    ttlet drawExtent = extent2{(right - left) * oversampling, top - bottom};
+    auto drawPath = (translate2{-left * oversampling, -bottom} * scale2{size * oversampling, size}) * glyphPath;
+
+    auto atlas_rect = allocateRect(drawExtent);
+    ttlet cache_key = glyph_cache::make_key(drawPath, drawExtent) ^ coverage_cache_key_tag;
+    ++nrQueuedGlyphs;
+
+    if (auto cached_pixels = glyphCache->find(cache_key)) {
+        ttlet lock = std::scoped_lock(glyph_mutex);
+        glyph_results.push_back({atlas_rect, std::move(cached_pixels), cache_key, true});
+
+    } else {
+        {
+            ttlet lock = std::scoped_lock(glyph_mutex);
+            glyph_jobs.push_back({atlas_rect, std::move(drawPath), cache_key, true});
+        }
+        glyph_condition.notify_one();
+    }
+
+    // The first pixel of the image is not drawn, so that shifting the texture coordinates to the
+    // left by up to two subpixels stays inside the image.
+    ttlet box = aarectangle{left + 1.0f, bottom, right - left - 1.0f, top - bottom};
+    return {{atlas_rect, frameCount}, box};
+}
+
+[[nodiscard]] bool device_shared::is_small_glyph(matrix3 const &transform, attributed_glyph const &attr_glyph) noexcept
+{
+    if (attr_glyph.style.scaled_size() > small_glyph_maximum_size) {
+        return false;
+    }
+
+    // The glyph can only be placed on the pixel grid when the text is not scaled or rotated.
+    return get<0>(transform) == f32x4{1.0f, 0.0f, 0.0f, 0.0f} and get<1>(transform) == f32x4{0.0f, 1.0f, 0.0f, 0.0f};
+}
+
+[[nodiscard]] std::pair<aarectangle, std::array<point3, 4>>
+device_shared::getSmallGlyphFromAtlas(attributed_glyph const &attr_glyph, vector2 translation) noexcept
+{
+    ttlet key = small_glyph_key{attr_glyph.glyphs, narrow_cast<int>(std::round(attr_glyph.style.scaled_size() * 4.0f))};
+
+    auto i = small_glyphs_in_atlas.find(key);
+    if (i == small_glyphs_in_atlas.end()) {
+        i = small_glyphs_in_atlas.emplace(key, addSmallGlyphToAtlas(key)).first;
+    }
+    auto &entry = i->second;
+    entry.last_used_frame = frameCount;
+
+    // Snap the origin of the glyph in window coordinates to a subpixel horizontally and to a pixel vertically.
+    ttlet origin = attr_glyph.position + translation;
+    ttlet x = std::round(origin.x() * small_glyph_oversampling);
+    ttlet pixel_x = std::floor(x / small_glyph_oversampling);
+    ttlet subpixel_x = x - pixel_x * small_glyph_oversampling;
+    ttlet pixel_y = std::round(origin.y());
+
+    ttlet box = translate2{pixel_x - translation.x(), pixel_y - translation.y()} * entry.box;
+
+    // The quad starts one pixel into the image, and is shifted to the right by moving the texture coordinates left.
+    ttlet &location = entry.location;
+    ttlet texel_rectangle = aarectangle{
+        location.atlas_position.x() + small_glyph_oversampling - subpixel_x,
+        location.atlas_position.y(),
+        entry.box.width() * small_glyph_oversampling,
+        entry.box.height()};
+    ttlet texture_rectangle = scale2{atlasTextureCoordinateMultiplier} * texel_rectangle;
+
+    // Coverage glyphs are marked for the fragment shader by the layer beyond the last atlas image.
+    ttlet layer = location.atlas_position.z() + atlasMaximumNrImages;
+    ttlet texture_coordinate = [layer](point2 p) {
+        return point3{p.x(), p.y(), layer};
+    };
+    return {
+        box,
+        {texture_coordinate(get<0>(texture_rectangle)),
+         texture_coordinate(get<1>(texture_rectangle)),
+         texture_coordinate(get<2>(texture_rectangle)),
+         texture_coordinate(get<3>(texture_rectangle))}};
+}
+
 aarectangle device_shared::getBoundingBox(font_glyph_ids const &glyphs) noexcept
 {
     // Adjust bounding box by adding a border based on 1EM.
     return expand(glyphs.getBoundingBox(), scaledDrawBorder);
 }
 
-bool device_shared::_place_vertices(
+void device_shared::_place_vertices(
     vspan<vertex> &vertices,
     aarectangle clipping_rectangle,
     rectangle box,
     font_glyph_ids const &glyphs,
     color color) noexcept
 {
-    ttlet[atlas_rect, glyph_was_added] = getGlyphFromAtlas(glyphs);
+    ttlet atlas_rect = getGlyphFromAtlas(glyphs);
 
     ttlet p0 = get<0>(box);
     ttlet p1 = get<1>(box);
@@ -188,17 +491,16 @@ bool device_shared::_place_vertices(
     // If none of the vertices is inside the clipping rectangle then don't add the
     // quad to the vertex list.
     if (!overlaps(clipping_rectangle, aarectangle{box})) {
-        return glyph_was_added;
+        return;
     }
 
     vertices.emplace_back(p0, clipping_rectangle, get<0>(atlas_rect.texture_coordinates), color);
     vertices.emplace_back(p1, clipping_rectangle, get<1>(atlas_rect.texture_coordinates), color);
     vertices.emplace_back(p2, clipping_rectangle, get<2>(atlas_rect.texture_coordinates), color);
     vertices.emplace_back(p3, clipping_rectangle, get<3>(atlas_rect.texture_coordinates), color);
-    return glyph_was_added;
 }
 
-bool device_shared::_place_vertices(
+void device_shared::_place_vertices(
     vspan<vertex> &vertices,
     aarectangle clipping_rectangle,
     matrix3 transform,
@@ -206,23 +508,37 @@ bool device_shared::_place_vertices(
     color color) noexcept
 {
     if (!is_visible(attr_glyph.general_category)) {
-        return false;
+        return;
+    }
+
+    if (is_small_glyph(transform, attr_glyph)) {
+        ttlet[box, texture_coordinates] = getSmallGlyphFromAtlas(attr_glyph, vector2{get<3>(transform).xy00()});
+        ttlet window_box = transform * box;
+        if (!overlaps(clipping_rectangle, aarectangle{window_box})) {
+            return;
+        }
+
+        vertices.emplace_back(get<0>(window_box), clipping_rectangle, get<0>(texture_coordinates), color);
+        vertices.emplace_back(get<1>(window_box), clipping_rectangle, get<1>(texture_coordinates), color);
+        vertices.emplace_back(get<2>(window_box), clipping_rectangle, get<2>(texture_coordinates), color);
+        vertices.emplace_back(get<3>(window_box), clipping_rectangle, get<3>(texture_coordinates), color);
+        return;
     }
 
     // Adjust bounding box by adding a border based on 1EM.
     ttlet bounding_box = transform * attr_glyph.boundingBox(scaledDrawBorder);
 
-    return _place_vertices(vertices, clipping_rectangle, bounding_box, attr_glyph.glyphs, color);
+    _place_vertices(vertices, clipping_rectangle, bounding_box, attr_glyph.glyphs, color);
 }
 
-bool device_shared::_place_vertices(
+void device_shared::_place_vertices(
     vspan<vertex> &vertices,
     aarectangle clipping_rectangle,
     matrix3 transform,
     attributed_glyph const &attr_glyph
     ) noexcept
 {
-    return _place_vertices(vertices, clipping_rectangle, transform, attr_glyph, attr_glyph.style.color);
+    _place_vertices(vertices, clipping_rectangle, transform, attr_glyph, attr_glyph.style.color);
 }
 
 void device_shared::place_vertices(
@@ -233,9 +549,7 @@ void device_shared::place_vertices(
     color color
     ) noexcept
 {
-    if (_place_vertices(vertices, clippingRectangle, box, glyphs, color)) {
-        prepareAtlasForRendering();
-    }
+    _place_vertices(vertices, clippingRectangle, box, glyphs, color);
 }
 
 void device_shared::place_vertices(
@@ -245,34 +559,97 @@ void device_shared::place_vertices(
     shaped_text const &text
     ) noexcept
 {
-    auto atlas_was_updated = false;
+    for (ttlet &attr_glyph : text) {
+        _place_vertices(vertices, clipping_rectangle, transform, attr_glyph);
+    }
+}
 
+void device_shared::place_vertices(
+    vspan<vertex> &vertices,
+    aarectangle clipping_rectangle,
+    matrix3 transform,
+    shaped_text const &text,
+    color color) noexcept
+{
     for (ttlet &attr_glyph : text) {
-        ttlet glyph_added = _place_vertices(vertices, clipping_rectangle, transform, attr_glyph);
-        atlas_was_updated = atlas_was_updated || glyph_added;
+        _place_vertices(vertices, clipping_rectangle, transform, attr_glyph, color);
     }
+}
+
+void device_shared::make_glyph_run(glyph_run &run, matrix3 const &transform, shaped_text const &text) noexcept
+{
+    increment_counter<"glyph_run">();
+
+    ttlet translation = vector2{get<3>(transform).xy00()};
 
-    if (atlas_was_updated) {
-        prepareAtlasForRendering();
+    run.clear();
+    for (ttlet &attr_glyph : text) {
+        if (!is_visible(attr_glyph.general_category)) {
+            continue;
+        }
+
+        if (attr_glyph.style.scaled_size() <= small_glyph_maximum_size) {
+            run.has_small_glyphs = true;
+        }
+
+        if (is_small_glyph(transform, attr_glyph)) {
+            ttlet[box, texture_coordinates] = getSmallGlyphFromAtlas(attr_glyph, translation);
+            run.quads.push_back({box, texture_coordinates, attr_glyph.style.color});
+            run.bounding_box |= box;
+
+        } else {
+            ttlet box = attr_glyph.boundingBox(scaledDrawBorder);
+            ttlet atlas_rect = getGlyphFromAtlas(attr_glyph.glyphs);
+            run.quads.push_back({box, atlas_rect.texture_coordinates, attr_glyph.style.color});
+            run.bounding_box |= box;
+        }
     }
+
+    run.device = this;
+    run.atlas_layout_generation = atlas_layout_generation;
+    run.is_translation = get<0>(transform) == f32x4{1.0f, 0.0f, 0.0f, 0.0f} and get<1>(transform) == f32x4{0.0f, 1.0f, 0.0f, 0.0f};
+    run.translation = translation;
 }
 
 void device_shared::place_vertices(
     vspan<vertex> &vertices,
     aarectangle clipping_rectangle,
     matrix3 transform,
+    glyph_run &run,
     shaped_text const &text,
-    color color) noexcept
+    std::optional<color> color) noexcept
 {
-    auto atlas_was_updated = false;
+    if (run.device != this or run.atlas_layout_generation != atlas_layout_generation) {
+        make_glyph_run(run, transform, text);
+
+    } else if (run.has_small_glyphs) {
+        // Small glyphs are placed on the pixel grid, which only stays the same when the text is
+        // translated by whole pixels.
+        ttlet is_translation =
+            get<0>(transform) == f32x4{1.0f, 0.0f, 0.0f, 0.0f} and get<1>(transform) == f32x4{0.0f, 1.0f, 0.0f, 0.0f};
+        ttlet delta = vector2{get<3>(transform).xy00()} - run.translation;
+        if (is_translation != run.is_translation or (is_translation and delta != round(delta))) {
+            make_glyph_run(run, transform, text);
+        }
+    }
 
-    for (ttlet &attr_glyph : text) {
-        ttlet glyph_added = _place_vertices(vertices, clipping_rectangle, transform, attr_glyph, color);
-        atlas_was_updated = atlas_was_updated || glyph_added;
+    ttlet bounding_box = aarectangle{transform * run.bounding_box};
+    if (!overlaps(clipping_rectangle, bounding_box)) {
+        return;
     }
+    ttlet needs_clipping = !clipping_rectangle.contains(bounding_box);
 
-    if (atlas_was_updated) {
-        prepareAtlasForRendering();
+    for (ttlet &quad : run.quads) {
+        ttlet box = transform * quad.box;
+        if (needs_clipping and !overlaps(clipping_rectangle, aarectangle{box})) {
+            continue;
+        }
+
+        ttlet quad_color = color ? *color : quad.color;
+        vertices.emplace_back(get<0>(box), clipping_rectangle, get<0>(quad.texture_coordinates), quad_color);
+        vertices.emplace_back(get<1>(box), clipping_rectangle, get<1>(quad.texture_coordinates), quad_color);
+        vertices.emplace_back(get<2>(box), clipping_rectangle, get<2>(quad.texture_coordinates), quad_color);
+        vertices.emplace_back(get<3>(box), clipping_rectangle, get<3>(quad.texture_coordinates), quad_color);
     }
 }
 
@@ -283,22 +660,29 @@ void device_shared::drawInCommandBuffer(vk::CommandBuffer &commandBuffer)
 
 void device_shared::buildShaders()
 {
-    specializationConstants.sdf_r8maxDistance = sdf_r8::max_distance;
-    specializationConstants.atlasImageWidth = atlasImageWidth;
-
-    fragmentShaderSpecializationMapEntries = specialization_constants::specializationConstantMapEntries();
-    fragmentShaderSpecializationInfo = specializationConstants.specializationInfo(fragmentShaderSpecializationMapEntries);
-
     vertexShaderModule = device.loadShader(URL("resource:GUI/pipeline_SDF.vert.spv"));
     fragmentShaderModule = device.loadShader(URL("resource:GUI/pipeline_SDF.frag.spv"));
 
-    shaderStages = {
-        {vk::PipelineShaderStageCreateFlags(), vk::ShaderStageFlagBits::eVertex, vertexShaderModule, "main"},
-        {vk::PipelineShaderStageCreateFlags(),
-         vk::ShaderStageFlagBits::eFragment,
-         fragmentShaderModule,
-         "main",
-         &fragmentShaderSpecializationInfo}};
+    fragmentShaderSpecializationMapEntries = specialization_constants::specializationConstantMapEntries();
+
+    // A pipeline is only created for the orientations of the windows, so that the driver compiles the
+    // variants of the fragment shader that are used.
+    for (size_t i = 0; i != nr_subpixel_orientations; ++i) {
+        specializationConstants[i].sdf_r8maxDistance = sdf_r8::max_distance;
+        specializationConstants[i].atlasImageWidth = atlasImageWidth;
+        specializationConstants[i].subpixel_orientation = narrow_cast<int32_t>(i);
+
+        fragmentShaderSpecializationInfos[i] =
+            specializationConstants[i].specializationInfo(fragmentShaderSpecializationMapEntries);
+
+        shaderStages[i] = {
+            {vk::PipelineShaderStageCreateFlags(), vk::ShaderStageFlagBits::eVertex, vertexShaderModule, "main"},
+            {vk::PipelineShaderStageCreateFlags(),
+             vk::ShaderStageFlagBits::eFragment,
+             fragmentShaderModule,
+             "main",
+             &fragmentShaderSpecializationInfos[i]}};
+    }
 }
 
 void device_shared::teardownShaders(gui_device_vulkan *vulkanDevice)
@@ -323,22 +707,22 @@ void device_shared::addAtlasImage()
         1, // arrayLayers
         vk::SampleCountFlagBits::e1,
         vk::ImageTiling::eOptimal,
-        vk::ImageUsageFlagBits::eTransferDst | vk::ImageUsageFlagBits::eSampled,
-        vk::SharingMode::eExclusive,
-        0,
-        nullptr,
+        vk::ImageUsageFlagBits::eTransferSrc | vk::ImageUsageFlagBits::eTransferDst | vk::ImageUsageFlagBits::eSampled,
+        device.transferSharingQueueFamilyIndices.size() > 1 ? vk::SharingMode::eConcurrent : vk::SharingMode::eExclusive,
+        narrow_cast<uint32_t>(device.transferSharingQueueFamilyIndices.size()),
+        device.transferSharingQueueFamilyIndices.data(),
         vk::ImageLayout::eUndefined};
     VmaAllocationCreateInfo allocationCreateInfo = {};
     allocationCreateInfo.usage = VMA_MEMORY_USAGE_GPU_ONLY;
 
     ttlet[atlasImage, atlasImageAllocation] = device.createImage(imageCreateInfo, allocationCreateInfo);
+    add_to_counter<"sdf_atlas_bytes">(device.allocationSize(atlasImageAllocation));
 
     ttlet clearValue = vk::ClearColorValue{std::array{-1.0f, -1.0f, -1.0f, -1.0f}};
     ttlet clearRange = std::array{vk::ImageSubresourceRange{vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1}};
 
-    device.transition_layout(
-        atlasImage, imageCreateInfo.format, vk::ImageLayout::eUndefined, vk::ImageLayout::eTransferDstOptimal);
-    device.clearColorImage(atlasImage, vk::ImageLayout::eTransferDstOptimal, clearValue, clearRange);
+    device.transition_layout(atlasImage, imageCreateInfo.format, vk::ImageLayout::eUndefined, vk::ImageLayout::eGeneral);
+    device.clearColorImage(atlasImage, vk::ImageLayout::eGeneral, clearValue, clearRange);
 
     ttlet atlasImageView = device.createImageView(
         {vk::ImageViewCreateFlags(),
@@ -354,7 +738,11 @@ void device_shared::addAtlasImage()
              1 // layerCount
          }});
 
-    atlasTextures.push_back({atlasImage, atlasImageAllocation, atlasImageView});
+    // The atlas textures stay in the general layout; they are written by the transfer queue
+    // while being sampled by the graphics queue.
+    atlasTextures.push_back(
+        {atlasImage, atlasImageAllocation, atlasImageView, tt::pixel_map<sdf_r8>{}, vk::ImageLayout::eGeneral});
+    ++atlasDescriptorSetVersion;
 
     // Build image descriptor info.
     for (int i = 0; i < std::ssize(atlasDescriptorImageInfos); i++) {
@@ -363,38 +751,12 @@ void device_shared::addAtlasImage()
         atlasDescriptorImageInfos.at(i) = {
             vk::Sampler(),
             i < atlasTextures.size() ? atlasTextures.at(i).view : atlasTextures.at(0).view,
-            vk::ImageLayout::eShaderReadOnlyOptimal};
+            vk::ImageLayout::eGeneral};
     }
 }
 
 void device_shared::buildAtlas()
 {
-    // Create staging image
-    vk::ImageCreateInfo const imageCreateInfo = {
-        vk::ImageCreateFlags(),
-        vk::ImageType::e2D,
-        vk::Format::eR8Snorm,
-        vk::Extent3D(stagingImageWidth, stagingImageHeight, 1),
-        1, // mipLevels
-        1, // arrayLayers
-        vk::SampleCountFlagBits::e1,
-        vk::ImageTiling::eLinear,
-        vk::ImageUsageFlagBits::eTransferSrc,
-        vk::SharingMode::eExclusive,
-        0,
-        nullptr,
-        vk::ImageLayout::ePreinitialized};
-    VmaAllocationCreateInfo allocationCreateInfo = {};
-    allocationCreateInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
-    ttlet[image, allocation] = device.createImage(imageCreateInfo, allocationCreateInfo);
-    ttlet data = device.mapMemory<sdf_r8>(allocation);
-
-    stagingTexture = {
-        image,
-        allocation,
-        vk::ImageView(),
-        tt::pixel_map<sdf_r8>{data.data(), imageCreateInfo.extent.width, imageCreateInfo.extent.height}};
-
     vk::SamplerCreateInfo const samplerCreateInfo = {
         vk::SamplerCreateFlags(),
         vk::Filter::eLinear, // magFilter
@@ -426,16 +788,108 @@ void device_shared::teardownAtlas(gui_device_vulkan *vulkanDevice)
 {
     tt_axiom(vulkanDevice);
 
+    // Wait for uploads to complete before destroying the atlas.
+    stagingBuffer.destroy(vulkanDevice);
+
     vulkanDevice->destroy(atlasSampler);
 
     for (const auto &atlasImage : atlasTextures) {
         vulkanDevice->destroy(atlasImage.view);
+        add_to_counter<"sdf_atlas_bytes">(-vulkanDevice->allocationSize(atlasImage.allocation));
         vulkanDevice->destroyImage(atlasImage.image, atlasImage.allocation);
     }
     atlasTextures.clear();
+}
+
+/** Render the coverage of a path, filtered for a LCD display.
+ *
+ * Each texel is a subpixel, the coverage is spread over the neighbouring subpixels with the
+ * five-tap filter that FreeType uses by default, so that a pixel does not show color fringes.
+ * The coverage is stored as a positive value in the signed-normalized atlas.
+ */
+static void fill_coverage(pixel_map<sdf_r8> &dst, graphic_path const &path) noexcept
+{
+    constexpr auto weights = std::array{8, 77, 86, 77, 8};
+
+    auto mask = pixel_map<uint8_t>(dst.width(), dst.height(), pixel_map_pool());
+    fill(mask);
+    fill(mask, path.getBeziers());
+
+    ttlet width = dst.width();
+    for (auto y = ssize_t{0}; y != dst.height(); ++y) {
+        ttlet mask_row = mask.at(y);
+        auto dst_row = dst.at(y);
+
+        for (auto x = ssize_t{0}; x != width; ++x) {
+            auto sum = 0;
+            for (auto i = ssize_t{0}; i != ssize(weights); ++i) {
+                ttlet mask_x = x + i - 2;
+                if (mask_x >= 0 and mask_x < width) {
+                    sum += weights[i] * mask_row[mask_x];
+                }
+            }
+            static_cast<snorm_r8 &>(dst_row[x]) = std::min(narrow_cast<float>(sum) * (1.0f / (256.0f * 255.0f)), 1.0f);
+        }
+    }
+}
+
+void device_shared::glyphThreadLoop(std::stop_token stop_token) noexcept
+{
+    set_thread_name("glyph_sdf");
+
+    while (true) {
+        auto lock = std::unique_lock(glyph_mutex);
+        if (!glyph_condition.wait(lock, stop_token, [this] {
+                return !glyph_jobs.empty();
+            })) {
+            return;
+        }
+
+        auto job = std::move(glyph_jobs.front());
+        glyph_jobs.pop_front();
+        lock.unlock();
+
+        // The pixels are released after the upload to the atlas, recycle them through the pool.
+        auto pixels = pixel_map<sdf_r8>{
+            narrow_cast<ssize_t>(std::ceil(job.location.size.width())),
+            narrow_cast<ssize_t>(std::ceil(job.location.size.height())),
+            pixel_map_pool()};
+        if (job.is_coverage) {
+            fill_coverage(pixels, job.path);
+        } else {
+            fill(pixels, job.path);
+        }
+
+        lock.lock();
+        glyph_results.push_back({job.location, std::move(pixels), job.cache_key, false});
+    }
+}
+
+void device_shared::buildGlyphThreads()
+{
+    ttlet nrThreads = std::clamp(std::thread::hardware_concurrency() / 2, 1u, maximumNrGlyphThreads);
+
+    for (unsigned int i = 0; i != nrThreads; ++i) {
+        glyph_threads.emplace_back([this](std::stop_token stop_token) {
+            glyphThreadLoop(stop_token);
+        });
+    }
+}
+
+void device_shared::teardownGlyphThreads()
+{
+    for (auto &thread : glyph_threads) {
+        thread.request_stop();
+    }
+    for (auto &thread : glyph_threads) {
+        thread.join();
+    }
+    glyph_threads.clear();
 
-    vulkanDevice->unmapMemory(stagingTexture.allocation);
-    vulkanDevice->destroyImage(stagingTexture.image, stagingTexture.allocation);
+    auto lock = std::scoped_lock(glyph_mutex);
+    glyph_jobs.clear();
+    glyph_results.clear();
+    nrQueuedGlyphs = 0;
 }
 
 } // namespace tt::pipeline_SDF
@@ -7,20 +7,31 @@
 #include "pipeline_SDF_texture_map.hpp"
 #include "pipeline_SDF_atlas_rect.hpp"
 #include "pipeline_SDF_specialization_constants.hpp"
+#include "pipeline_SDF_glyph_cache.hpp"
+#include "pipeline_SDF_glyph_run.hpp"
+#include "staging_ring_buffer.hpp"
+#include "subpixel_orientation.hpp"
 #include "../text/font_glyph_ids.hpp"
 #include "../required.hpp"
 #include "../logger.hpp"
 #include "../vspan.hpp"
 #include "../geometry/rectangle.hpp"
+#include "../graphic_path.hpp"
+#include "../pixel_map.hpp"
+#include "../hash.hpp"
 #include <vk_mem_alloc.h>
 #include <vulkan/vulkan.hpp>
 #include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <deque>
+#include <optional>
+#include <limits>
 #include <unordered_map>
+#include <array>
 
 namespace tt {
 class gui_device_vulkan;
-template<typename T>
-class pixel_map;
 class mat;
 } // namespace tt
 
@@ -35,6 +46,48 @@ struct Image;
 struct vertex;
 
 struct device_shared final {
+    /** A glyph in the atlas.
+     */
+    struct atlas_glyph {
+        atlas_rect location;
+
+        /** The frame when this glyph was last drawn.
+         * Used to evict the least-recently-used glyphs from the atlas.
+         */
+        size_t last_used_frame;
+    };
+
+    /** The key of a coverage glyph in the atlas.
+     * Coverage glyphs are rendered for a specific font size, see `small_glyph_maximum_size`.
+     */
+    struct small_glyph_key {
+        font_glyph_ids glyphs;
+
+        /** The font size in quarter pixels.
+         */
+        int size;
+
+        [[nodiscard]] friend bool operator==(small_glyph_key const &lhs, small_glyph_key const &rhs) noexcept
+        {
+            return lhs.glyphs == rhs.glyphs and lhs.size == rhs.size;
+        }
+    };
+
+    struct small_glyph_key_hash {
+        [[nodiscard]] size_t operator()(small_glyph_key const &key) const noexcept
+        {
+            return hash_mix(key.glyphs, key.size);
+        }
+    };
+
+    /** A coverage glyph in the atlas.
+     */
+    struct small_atlas_glyph : atlas_glyph {
+        /** The rectangle of the quad relative to the origin of the glyph, in whole pixels.
+         */
+        aarectangle box;
+    };
+
     // Studies in China have shown that literate individuals know and use between 3,000 and 4,000 characters.
     // Handle up to 4096 characters with a 16 x 1024 x 1024, 16 x 1 MByte
     static constexpr int atlasImageWidth = 1024; // 16 characters, of 64 pixels wide.
@@ -42,26 +95,58 @@ struct device_shared final {
     static_assert(atlasImageWidth == atlasImageHeight, "needed for fwidth(textureCoord)");
 
     static constexpr int atlasMaximumNrImages = 16; // 16 * 512 characters, of 64x64 pixels.
-    static constexpr int stagingImageWidth = 128; // maximum size of character that can be uploaded is 128x128
-    static constexpr int stagingImageHeight = 128;
+    static constexpr size_t atlasImageSize = atlasImageWidth * atlasImageHeight * sizeof(sdf_r8);
+    static constexpr size_t defaultAtlasMemoryBudget = 4 * atlasImageSize; // 4 * 256 characters, of 64x64 pixels.
+    static constexpr size_t stagingBufferSize = 1024 * 1024; // Room to upload many glyphs at once, each at most 1024x1024.
+
+    /** The maximum number of threads generating signed-distance-fields of glyphs.
+     */
+    static constexpr unsigned int maximumNrGlyphThreads = 4;
 
     static constexpr float atlasTextureCoordinateMultiplier = 1.0f / atlasImageWidth;
     static constexpr float drawfontSize = 28.0f;
     static constexpr float drawBorder = sdf_r8::max_distance;
     static constexpr float scaledDrawBorder = drawBorder / drawfontSize;
 
+    static constexpr size_t nr_subpixel_orientations = 5;
+
+    /** The largest font size in pixels that is drawn using coverage glyphs.
+     *
+     * The signed-distance-field is rendered at `drawfontSize` and looks soft and blurry when
+     * scaled down to small sizes. Text up to this size that is only translated is drawn with
+     * glyphs which coverage is rendered at the exact font size instead, snapped to the pixel
+     * grid vertically and to a third of a pixel horizontally.
+     */
+    static constexpr float small_glyph_maximum_size = 16.0f;
+
+    /** The number of horizontal texels in the atlas for each pixel of a coverage glyph.
+     * There is a texel for each subpixel of a LCD display.
+     */
+    static constexpr int small_glyph_oversampling = 3;
+
+    /** The horizontal border in pixels around a coverage glyph.
+     * Room for the spread of the LCD filter and the horizontal offset of the glyph.
+     */
+    static constexpr int small_glyph_border = 2;
+
     gui_device_vulkan const &device;
 
     vk::ShaderModule vertexShaderModule;
     vk::ShaderModule fragmentShaderModule;
 
-    specialization_constants specializationConstants;
+    /** The specialization of the fragment shader for each subpixel orientation.
+     */
+    std::array<specialization_constants, nr_subpixel_orientations> specializationConstants;
     std::vector<vk::SpecializationMapEntry> fragmentShaderSpecializationMapEntries;
-    vk::SpecializationInfo fragmentShaderSpecializationInfo;
-    std::vector<vk::PipelineShaderStageCreateInfo> shaderStages;
+    std::array<vk::SpecializationInfo, nr_subpixel_orientations> fragmentShaderSpecializationInfos;
+
+    /** The shader stages for each subpixel orientation, see `shader_stages()`.
+     */
+    std::array<std::vector<vk::PipelineShaderStageCreateInfo>, nr_subpixel_orientations> shaderStages;
 
-    std::unordered_map<font_glyph_ids, atlas_rect> glyphs_in_atlas;
-    texture_map stagingTexture;
+    std::unordered_map<font_glyph_ids, atlas_glyph> glyphs_in_atlas;
+    std::unordered_map<small_glyph_key, small_atlas_glyph, small_glyph_key_hash> small_glyphs_in_atlas;
+    staging_ring_buffer stagingBuffer;
     std::vector<texture_map> atlasTextures;
 
     std::array<vk::DescriptorImageInfo, atlasMaximumNrImages> atlasDescriptorImageInfos;
@@ -72,6 +157,31 @@ struct device_shared final {
     /// During allocation on a row, we keep track of the tallest glyph.
     int atlasAllocationMaxHeight = 0;
 
+    /** Incremented each time glyphs are uploaded into the atlas.
+     * A window which has drawn text before the glyphs where uploaded needs to be redrawn.
+     */
+    size_t atlas_generation = 0;
+
+    /** Incremented each time the atlas is compacted.
+     * Glyphs are moved during compaction, so vertices retained by the widgets are invalid.
+     */
+    size_t atlas_layout_generation = 0;
+
+    /** Incremented each time the atlas textures are replaced or added.
+     */
+    ssize_t atlasDescriptorSetVersion = 0;
+
+    /** The amount of GPU memory the atlas textures should use.
+     * When more atlas textures are in use the atlas is compacted, evicting the least-recently-used glyphs.
+     * The atlas may temporarily grow beyond the budget, up to atlasMaximumNrImages, when the glyphs
+     * in use do not fit.
+     */
+    size_t atlasMemoryBudget = defaultAtlasMemoryBudget;
+
+    /** The current frame, used for stamping the glyphs when they are used.
+     */
+    size_t frameCount = 0;
+
     device_shared(gui_device_vulkan const &device);
     ~device_shared();
 
@@ -93,18 +203,26 @@ struct device_shared final {
 
     void drawInCommandBuffer(vk::CommandBuffer &commandBuffer);
 
-    /** Once drawing in the staging pixmap is completed, you can upload it to the atlas.
-     * This will transition the stating texture to 'source' and the atlas to 'destination'.
+    /** Get the shader stages of the pipeline specialized for a subpixel orientation.
      */
-    void uploadStagingPixmapToAtlas(atlas_rect location);
-
-    /** This will transition the staging texture to 'general' for writing by the CPU.
+    [[nodiscard]] std::vector<vk::PipelineShaderStageCreateInfo> const &
+    shader_stages(subpixel_orientation orientation) const noexcept
+    {
+        ttlet index = static_cast<size_t>(orientation);
+        tt_axiom(index < nr_subpixel_orientations);
+        return shaderStages[index];
+    }
+
+    /** Update the atlas before drawing a frame.
+     * This will upload the glyphs completed by the glyph-threads,
+     * and compact the atlas when it is over its memory budget.
      */
-    void prepareStagingPixmapForDrawing();
+    void updateAtlas() noexcept;
 
-    /** This will transition the atlas to 'shader-read'.
+    /** Release memory of the atlas, because the device is running low on memory.
+     * The least-recently-used glyphs are evicted when the atlas is compacted by the next `updateAtlas()`.
      */
-    void prepareAtlasForRendering();
+    void reduceAtlasMemory() noexcept;
 
     /** Prepare the atlas for drawing a text.
      */
@@ -146,24 +264,129 @@ struct device_shared final {
         shaped_text const &text,
         color color) noexcept;
 
+    /** Draw text on the screen using the glyphs resolved in a glyph run.
+     *
+     * The run is made from the text when it is empty, was made for another device or
+     * the atlas was compacted since. Otherwise the glyphs are not looked up in the atlas,
+     * and when the text is completely inside the clipping rectangle the quads are not clipped.
+     *
+     * @param vertices The vertices to draw the glyphs to.
+     * @param clipping_rectangle The clipping rectangle in screen space where glyphs should be cut off.
+     * @param transform The 2D transformation to move and rotate the text to the correct position on screen.
+     * @param run The glyph run of the text, made on first use.
+     * @param text The text to draw.
+     * @param color Override the color of the text to draw.
+     */
+    void place_vertices(
+        vspan<vertex> &vertices,
+        aarectangle clipping_rectangle,
+        matrix3 transform,
+        glyph_run &run,
+        shaped_text const &text,
+        std::optional<color> color) noexcept;
+
 private:
+    /** Marks the glyphs that are evicted during compaction of the atlas.
+     */
+    static constexpr size_t evicted_frame = std::numeric_limits<size_t>::max();
+
+    /** Mixed into the key of coverage glyphs in the glyph cache, which are rendered from the same
+     * paths as signed-distance-fields.
+     */
+    static constexpr uint64_t coverage_cache_key_tag = 0x636f'7665'7261'6765; // "coverage"
+
+    /** A glyph waiting to be rendered by a glyph-thread.
+     */
+    struct glyph_job {
+        atlas_rect location;
+        graphic_path path;
+        uint64_t cache_key;
+
+        /** Render the coverage of the path for a small glyph, instead of a signed-distance-field.
+         */
+        bool is_coverage;
+    };
+
+    /** A glyph rendered by a glyph-thread, waiting to be uploaded into the atlas.
+     */
+    struct glyph_result {
+        atlas_rect location;
+        pixel_map<sdf_r8> pixels;
+        uint64_t cache_key;
+
+        /** The pixels point into the glyph cache, so the glyph does not need to be added to the cache.
+         */
+        bool is_cached;
+    };
+
+    /** A glyph in the staging buffer to be copied into the atlas.
+     */
+    struct glyph_upload {
+        size_t staging_offset;
+        atlas_rect location;
+    };
+
+    std::vector<std::jthread> glyph_threads;
+    std::mutex glyph_mutex;
+    std::condition_variable_any glyph_condition;
+    std::deque<glyph_job> glyph_jobs;
+    std::vector<glyph_result> glyph_results;
+
+    /** The number of glyphs that are queued, being rendered, or not yet uploaded.
+     * The atlas can not be compacted while glyphs are queued, since the glyph-threads
+     * will render into already allocated atlas locations.
+     */
+    size_t nrQueuedGlyphs = 0;
+
+    /** Set when the atlas is using more textures than the memory budget allows.
+     */
+    bool atlasNeedsCompaction = false;
+
+    /** Signed-distance-fields of glyphs generated during previous runs of the application.
+     */
+    std::unique_ptr<glyph_cache> glyphCache;
+
     void buildShaders();
     void teardownShaders(gui_device_vulkan *vulkanDevice);
     void addAtlasImage();
     void buildAtlas();
     void teardownAtlas(gui_device_vulkan *vulkanDevice);
+    void buildGlyphThreads();
+    void teardownGlyphThreads();
+
+    /** The loop of a glyph-thread.
+     * Takes jobs from the queue and renders its path into a signed-distance-field.
+     */
+    void glyphThreadLoop(std::stop_token stop_token) noexcept;
+
+    /** Copy glyphs from the staging buffer into the atlas.
+     * The copies are submitted to the transfer queue and complete asynchronously.
+     */
+    void uploadStagingBufferToAtlas(std::vector<glyph_upload> const &uploads);
+
+    /** Upload the glyphs that where generated by the glyph-threads into the atlas.
+     * The glyphs are copied into the staging buffer so that they are uploaded with
+     * a single submission.
+     *
+     * @return True if any glyph was uploaded to the atlas.
+     */
+    bool uploadCompletedGlyphs() noexcept;
+
+    /** Repack the glyphs into new atlas textures.
+     * The most-recently-used glyphs are copied until half of the memory budget is used, the other
+     * glyphs are evicted. Glyphs drawn in the current or previous frame are never evicted.
+     */
+    void compactAtlas() noexcept;
 
     /** Place vertices for a single glyph.
-     * This function will not execute prepareAtlasForRendering().
      *
      * @param vertices The list of vertices to add to.
      * @param glyphs The font-id, composed-glyphs to render
      * @param box The rectangle of the glyph in window coordinates; including the draw border.
      * @param color The color of the glyph.
      * @param clippingRectangle The rectangle to clip the glyph.
-     * @return True if the glyph was added to the atlas.
      */
-    [[nodiscard]] bool _place_vertices(
+    void _place_vertices(
         vspan<vertex> &vertices,
         aarectangle clipping_rectangle,
         rectangle box,
@@ -172,15 +395,13 @@ private:
         ) noexcept;
 
     /** Place an single attributed glyph.
-     * This function will not execute prepareAtlasForRendering().
      *
      * @param vertices The list of vertices to add to.
      * @param attr_glyph The attributed glyph; scaled and positioned.
      * @param transform Extra transformation on the glyph.
      * @param clippingRectangle The rectangle to clip the glyph.
-     * @return True if the glyph was added to the atlas.
      */
-    [[nodiscard]] bool _place_vertices(
+    void _place_vertices(
         vspan<vertex> &vertices,
         aarectangle clippingRectangle,
         matrix3 transform,
@@ -188,28 +409,61 @@ private:
         ) noexcept;
 
     /** Place an single attributed glyph.
-     * This function will not execute prepareAtlasForRendering().
      *
      * @param vertices The list of vertices to add to.
      * @param attr_glyph The attributed glyph; scaled and positioned.
      * @param transform Extra transformation on the glyph.
      * @param clippingRectangle The rectangle to clip the glyph.
      * @param color Override the color from the glyph style.
-     * @return True if the glyph was added to the atlas.
      */
-    [[nodiscard]] bool _place_vertices(
+    void _place_vertices(
         vspan<vertex> &vertices,
         aarectangle clippingRectangle,
         matrix3 transform,
         attributed_glyph const &attr_glyph,
         color color) noexcept;
 
+    /** Allocate a glyph in the atlas, and queue it to be rendered by a glyph-thread.
+     * Until the glyph is uploaded the allocated rectangle in the atlas is empty.
+     */
     atlas_rect addGlyphToAtlas(font_glyph_ids glyph) noexcept;
 
     /**
-     * @return The Atlas rectangle and true if a new glyph was added to the atlas.
+     * @return The Atlas rectangle.
+     */
+    atlas_rect getGlyphFromAtlas(font_glyph_ids glyph) noexcept;
+
+    /** Allocate a coverage glyph in the atlas, and queue it to be rendered by a glyph-thread.
+     */
+    small_atlas_glyph addSmallGlyphToAtlas(small_glyph_key const &key) noexcept;
+
+    /** Check if a glyph is drawn using a coverage glyph.
+     *
+     * @param transform The transformation from text coordinates to window coordinates.
+     * @param attr_glyph The attributed glyph; scaled and positioned.
+     */
+    [[nodiscard]] static bool is_small_glyph(matrix3 const &transform, attributed_glyph const &attr_glyph) noexcept;
+
+    /** Get a coverage glyph from the atlas, and the rectangle where it is drawn.
+     *
+     * The glyph is snapped to whole pixels vertically and to a third of a pixel horizontally,
+     * the horizontal offset selects which subpixel of the display the glyph starts at.
+     *
+     * @param attr_glyph The attributed glyph; scaled and positioned.
+     * @param translation The translation from text coordinates to window coordinates.
+     * @return The rectangle of the glyph in text coordinates, and its texture coordinates.
+     */
+    [[nodiscard]] std::pair<aarectangle, std::array<point3, 4>>
+    getSmallGlyphFromAtlas(attributed_glyph const &attr_glyph, vector2 translation) noexcept;
+
+    /** Resolve the visible glyphs of a text in the atlas.
+     *
+     * @param run The glyph run to fill in.
+     * @param transform The transformation from text coordinates to window coordinates,
+     *                  used for placing small glyphs on the pixel grid.
+     * @param text The text to draw.
      */
-    std::pair<atlas_rect, bool> getGlyphFromAtlas(font_glyph_ids glyph) noexcept;
+    void make_glyph_run(glyph_run &run, matrix3 const &transform, shaped_text const &text) noexcept;
 };
 
 } // namespace tt::pipeline_SDF
@@ -0,0 +1,189 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "pipeline_SDF_glyph_cache.hpp"
+#include "pipeline_SDF_device_shared.hpp"
+#include "../file.hpp"
+#include "../endian.hpp"
+#include "../placement.hpp"
+#include "../strings.hpp"
+#include "../check.hpp"
+#include "../logger.hpp"
+#include <bit>
+#include <cstring>
+
+namespace tt::pipeline_SDF {
+
+static_assert(sizeof(sdf_r8) == 1);
+
+struct glyph_cache_header {
+    little_uint32_buf_t magic;
+    little_uint32_buf_t version;
+    little_uint32_buf_t draw_font_size;
+    little_uint32_buf_t max_distance;
+};
+
+struct glyph_cache_entry {
+    little_uint64_buf_t key;
+    little_uint16_buf_t width;
+    little_uint16_buf_t height;
+};
+
+constexpr uint32_t glyph_cache_magic = fourcc("tsdf");
+
+glyph_cache::glyph_cache(URL const &location) noexcept : _location(location)
+{
+    try {
+        _view = std::make_unique<file_view>(_location);
+        // The glyphs are read in random order when they are first drawn; page them in
+        // on a background thread after parsing the entry headers.
+        _view->hint(file_view_hint::large_pages);
+        _view->hint(file_view_hint::random);
+        parse(_view->bytes());
+        _file_size = _view->size();
+        _view->prefetch_async();
+
+    } catch (io_error const &e) {
+        tt_log_info("Could not open glyph cache file. \"{}\"", e.what());
+        _view = nullptr;
+        _entries.clear();
+        _file_size = 0;
+
+    } catch (parse_error const &e) {
+        tt_log_warning("Could not parse glyph cache file, it will be replaced. \"{}\"", e.what());
+        _view = nullptr;
+        _entries.clear();
+        _file_size = 0;
+    }
+}
+
+void glyph_cache::parse(std::span<std::byte const> bytes)
+{
+    ssize_t offset = 0;
+
+    ttlet header = make_placement_ptr<glyph_cache_header>(bytes, offset);
+    tt_parse_check(header->magic.value() == glyph_cache_magic, "Not a glyph cache file");
+    tt_parse_check(header->version.value() == version, "Glyph cache file has a different version");
+    tt_parse_check(
+        header->draw_font_size.value() == std::bit_cast<uint32_t>(device_shared::drawfontSize),
+        "Glyph cache file has a different draw size");
+    tt_parse_check(
+        header->max_distance.value() == std::bit_cast<uint32_t>(sdf_r8::max_distance),
+        "Glyph cache file has a different maximum distance");
+
+    while (offset != std::ssize(bytes)) {
+        ttlet glyph = make_placement_ptr<glyph_cache_entry>(bytes, offset);
+        ttlet width = glyph->width.value();
+        ttlet height = glyph->height.value();
+        ttlet nr_bytes = static_cast<ssize_t>(width) * static_cast<ssize_t>(height);
+
+        tt_parse_check(offset + nr_bytes <= std::ssize(bytes), "Glyph extends beyond end of file");
+        _entries[glyph->key.value()] = entry{narrow_cast<size_t>(offset), width, height};
+        offset += nr_bytes;
+    }
+}
+
+[[nodiscard]] uint64_t glyph_cache::make_key(graphic_path const &path, extent2 size) noexcept
+{
+    // FNV-1a, which gives the same key on each run of the application.
+    auto r = uint64_t{0xcbf2'9ce4'8422'2325};
+    auto mix = [&r](uint64_t value) {
+        for (int i = 0; i != 8; ++i) {
+            r ^= (value >> (i * 8)) & 0xff;
+            r *= uint64_t{0x0000'0100'0000'01b3};
+        }
+    };
+
+    mix(std::bit_cast<uint32_t>(size.width()));
+    mix(std::bit_cast<uint32_t>(size.height()));
+    for (ttlet &point : path.points) {
+        mix(static_cast<uint64_t>(point.type));
+        mix(std::bit_cast<uint32_t>(point.p.x()));
+        mix(std::bit_cast<uint32_t>(point.p.y()));
+    }
+    for (ttlet end_point : path.contourEndPoints) {
+        mix(static_cast<uint64_t>(end_point));
+    }
+    return r;
+}
+
+[[nodiscard]] pixel_map<sdf_r8> glyph_cache::find(uint64_t key) const noexcept
+{
+    if (!_view) {
+        return {};
+    }
+
+    ttlet i = _entries.find(key);
+    if (i == _entries.cend()) {
+        return {};
+    }
+
+    // The pixel-map will only be read from, even though it requires a non-const pointer.
+    auto *pixels = const_cast<sdf_r8 *>(reinterpret_cast<sdf_r8 const *>(_view->data() + i->second.offset));
+    return pixel_map<sdf_r8>{pixels, i->second.width, i->second.height};
+}
+
+void glyph_cache::insert(uint64_t key, pixel_map<sdf_r8> const &pixels) noexcept
+{
+    ttlet nr_bytes = narrow_cast<size_t>(pixels.width() * pixels.height());
+    if (_file_size + _new_entries.size() + sizeof(glyph_cache_entry) + nr_bytes > maximum_file_size) {
+        return;
+    }
+
+    auto offset = std::ssize(_new_entries);
+    _new_entries.resize(_new_entries.size() + sizeof(glyph_cache_entry) + nr_bytes);
+
+    auto glyph = unsafe_make_placement_ptr<glyph_cache_entry>(std::span{_new_entries}, offset);
+    glyph->key = key;
+    glyph->width = narrow_cast<uint16_t>(pixels.width());
+    glyph->height = narrow_cast<uint16_t>(pixels.height());
+
+    for (ssize_t y = 0; y != pixels.height(); ++y) {
+        ttlet row = pixels[y];
+        std::memcpy(_new_entries.data() + offset, row.data(), narrow_cast<size_t>(pixels.width()));
+        offset += pixels.width();
+    }
+}
+
+void glyph_cache::save() noexcept
+{
+    // Unmap the file before writing to it.
+    _view = nullptr;
+    _entries.clear();
+
+    if (_new_entries.empty()) {
+        return;
+    }
+
+    try {
+        if (_file_size == 0) {
+            auto header_bytes = std::vector<std::byte>(sizeof(glyph_cache_header));
+            auto header = unsafe_make_placement_ptr<glyph_cache_header>(std::span{header_bytes});
+            header->magic = glyph_cache_magic;
+            header->version = version;
+            header->draw_font_size = std::bit_cast<uint32_t>(device_shared::drawfontSize);
+            header->max_distance = std::bit_cast<uint32_t>(sdf_r8::max_distance);
+
+            auto file = tt::file(_location, access_mode::truncate_or_create_for_write | access_mode::create_directories);
+            file.write(std::span<std::byte const>{header_bytes});
+            file.write(std::span<std::byte const>{_new_entries});
+            file.flush();
+            _file_size = file.size();
+
+        } else {
+            auto file = tt::file(_location, access_mode::open | access_mode::write);
+            file.seek(0, seek_whence::end);
+            file.write(std::span<std::byte const>{_new_entries});
+            file.flush();
+            _file_size = file.size();
+        }
+
+    } catch (io_error const &e) {
+        tt_log_error("Could not save glyph cache file. \"{}\"", e.what());
+    }
+
+    _new_entries.clear();
+}
+
+} // namespace tt::pipeline_SDF
@@ -0,0 +1,107 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../file_view.hpp"
+#include "../pixel_map.hpp"
+#include "../graphic_path.hpp"
+#include "../URL.hpp"
+#include "../color/sdf_r8.hpp"
+#include "../geometry/extent.hpp"
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <cstddef>
+
+namespace tt::pipeline_SDF {
+
+/** A persistent cache of signed-distance-field glyphs.
+ *
+ * The cache file is memory-mapped when it is opened, so that cached glyphs
+ * can be copied directly from the file into the staging pixmap of the atlas.
+ * Glyphs which are added while the application is running are appended to the
+ * file when the cache is saved.
+ *
+ * Glyphs are keyed by a hash of the outline as drawn into the atlas. A change of font file,
+ * glyph or draw size results in a different key; so the cache does not need to be invalidated.
+ */
+class glyph_cache {
+public:
+    /** The version of the file format and of the algorithm generating the signed-distance-fields.
+     */
+    static constexpr uint32_t version = 1;
+
+    /** New glyphs are no longer added when the file becomes larger than this size.
+     */
+    static constexpr size_t maximum_file_size = 64 * 1024 * 1024;
+
+    glyph_cache(glyph_cache const &) = delete;
+    glyph_cache(glyph_cache &&) = delete;
+    glyph_cache &operator=(glyph_cache const &) = delete;
+    glyph_cache &operator=(glyph_cache &&) = delete;
+
+    /** Open the cache file.
+     * A missing or incompatible file is ignored and will be replaced when the cache is saved.
+     *
+     * @param location The location of the cache file.
+     */
+    glyph_cache(URL const &location) noexcept;
+
+    ~glyph_cache() = default;
+
+    /** Make a key for a glyph.
+     *
+     * @param path The path of the glyph, transformed as it will be drawn into the atlas.
+     * @param size The size of the glyph in the atlas, including the draw border.
+     */
+    [[nodiscard]] static uint64_t make_key(graphic_path const &path, extent2 size) noexcept;
+
+    /** Find a glyph in the cache.
+     *
+     * @return A pixel-map pointing into the memory-mapped file, or an empty pixel-map when not found.
+     *         The pixel-map is valid until the cache is saved.
+     */
+    [[nodiscard]] pixel_map<sdf_r8> find(uint64_t key) const noexcept;
+
+    /** Add a glyph to the cache.
+     * The glyph is written to the cache file on `save()`.
+     */
+    void insert(uint64_t key, pixel_map<sdf_r8> const &pixels) noexcept;
+
+    /** Append the newly inserted glyphs to the cache file.
+     * This will also unmap the file, invalidating all pixel-maps returned by `find()`.
+     */
+    void save() noexcept;
+
+private:
+    struct entry {
+        size_t offset;
+        uint16_t width;
+        uint16_t height;
+    };
+
+    URL _location;
+
+    /** The memory-mapped cache file, or empty when the file could not be opened.
+     */
+    std::unique_ptr<file_view> _view;
+
+    /** The glyphs in the memory-mapped file, the offset points to the first pixel of the glyph.
+     */
+    std::unordered_map<uint64_t, entry> _entries;
+
+    /** Serialized entries to be appended to the cache file.
+     */
+    std::vector<std::byte> _new_entries;
+
+    /** The size of the cache file.
+     * When zero the file needs to be created.
+     */
+    size_t _file_size = 0;
+
+    void parse(std::span<std::byte const> bytes);
+};
+
+} // namespace tt::pipeline_SDF
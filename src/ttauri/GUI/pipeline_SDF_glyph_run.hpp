@@ -0,0 +1,74 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../required.hpp"
+#include "../geometry/axis_aligned_rectangle.hpp"
+#include "../geometry/point.hpp"
+#include "../geometry/vector.hpp"
+#include "../color/color.hpp"
+#include <array>
+#include <vector>
+
+namespace tt::pipeline_SDF {
+
+struct device_shared;
+
+/** The visible glyphs of a text, with their locations in the atlas.
+ *
+ * A text that does not change can be placed with a single pass over the quads of
+ * the run, without looking up each glyph in the atlas.
+ * The run is made again when it is placed on another device or after the glyphs
+ * in the atlas have been moved. A run with small glyphs, which are placed on the pixel
+ * grid, is also made again when it is moved by a fraction of a pixel or is no longer
+ * only translated.
+ */
+struct glyph_run {
+    struct quad {
+        /** The rectangle of the glyph in text coordinates, including the draw border.
+         */
+        aarectangle box;
+
+        std::array<point3, 4> texture_coordinates;
+
+        /** The color of the glyph from the text style.
+         */
+        tt::color color;
+    };
+
+    std::vector<quad> quads;
+
+    /** The rectangle around all the quads, in text coordinates.
+     */
+    aarectangle bounding_box;
+
+    device_shared const *device = nullptr;
+    size_t atlas_layout_generation = 0;
+
+    /** The run has glyphs which are drawn as coverage glyphs when the text is only translated.
+     */
+    bool has_small_glyphs = false;
+
+    /** The run was made for a transformation that is only a translation.
+     */
+    bool is_translation = false;
+
+    /** The translation the run was made for.
+     */
+    vector2 translation;
+
+    /** Forget the glyphs, so that the run is made again when it is placed.
+     * This must be called when the text changes.
+     */
+    void clear() noexcept
+    {
+        quads.clear();
+        bounding_box = {};
+        device = nullptr;
+        has_small_glyphs = false;
+    }
+};
+
+} // namespace tt::pipeline_SDF
@@ -13,6 +13,11 @@ struct specialization_constants {
     float sdf_r8maxDistance;
     float atlasImageWidth;
 
+    /** The subpixel orientation of the window, zero for grayscale anti-aliasing.
+     * As a specialization constant the fragment shader is compiled without the code for the other orientations.
+     */
+    int32_t subpixel_orientation;
+
     [[nodiscard]] vk::SpecializationInfo specializationInfo(std::vector<vk::SpecializationMapEntry> &entries) const noexcept {
         return {
             narrow_cast<uint32_t>(std::ssize(entries)), entries.data(),
@@ -25,6 +30,7 @@ struct specialization_constants {
         return {
             {0, offsetof(specialization_constants, sdf_r8maxDistance), sizeof(sdf_r8maxDistance)},
             {1, offsetof(specialization_constants, atlasImageWidth), sizeof(atlasImageWidth)},
+            {2, offsetof(specialization_constants, subpixel_orientation), sizeof(subpixel_orientation)},
         };
     }
 };
@@ -12,21 +12,35 @@ using namespace tt;
 using namespace std;
 
 pipeline_box::pipeline_box(gui_window const &window) :
-    pipeline_vulkan(window)
+    pipeline_vulkan(window),
+    // Initially the same number of boxes as when each box used four vertices of a 16-bit vertex index.
+    vertexBuffers(1 << 14, 1 << 18)
 {
 }
 
-void pipeline_box::drawInCommandBuffer(vk::CommandBuffer commandBuffer)
+void pipeline_box::set_frame_in_flight(size_t index) noexcept
 {
-    pipeline_vulkan::drawInCommandBuffer(commandBuffer);
+    pipeline_vulkan::set_frame_in_flight(index);
+    vertexBuffers.select(vulkan_device(), index, vertexBufferData);
+}
 
-    vulkan_device().flushAllocation(vertexBufferAllocation, 0, vertexBufferData.size() * sizeof (vertex));
+void pipeline_box::prepareForDraw()
+{
+    pipeline_vulkan::prepareForDraw();
+
+    vertexBuffers.flush(vulkan_device(), vertexBufferData.size());
+    sharedPipeline = &vulkan_device().box_pipeline();
+}
 
-    std::vector<vk::Buffer> tmpvertexBuffers = { vertexBuffer };
+void pipeline_box::drawInCommandBuffer(vk::CommandBuffer commandBuffer, size_t redrawRectangleIndex)
+{
+    pipeline_vulkan::drawInCommandBuffer(commandBuffer);
+
+    std::vector<vk::Buffer> tmpvertexBuffers = { vertexBuffers.buffer() };
     std::vector<vk::DeviceSize> tmpOffsets = { 0 };
     tt_axiom(tmpvertexBuffers.size() == tmpOffsets.size());
 
-    vulkan_device().boxPipeline->drawInCommandBuffer(commandBuffer);
+    sharedPipeline->drawInCommandBuffer(commandBuffer);
 
     commandBuffer.bindVertexBuffers(0, tmpvertexBuffers, tmpOffsets);
 
@@ -40,19 +54,20 @@ void pipeline_box::drawInCommandBuffer(vk::CommandBuffer commandBuffer)
         &pushConstants
     );
 
-    ttlet numberOfRectangles = vertexBufferData.size() / 4;
-    ttlet numberOfTriangles = numberOfRectangles * 2;
-    commandBuffer.drawIndexed(
-        narrow_cast<uint32_t>(numberOfTriangles * 3),
-        1,
-        0,
-        0,
-        0
-    );
+    // Each box is an instance of the first quad of the index buffer.
+    vertexBufferRanges.for_each(redrawRectangleIndex, [&](size_t firstInstance, size_t numberOfInstances) {
+        commandBuffer.drawIndexed(
+            6,
+            narrow_cast<uint32_t>(numberOfInstances),
+            0,
+            0,
+            narrow_cast<uint32_t>(firstInstance)
+        );
+    });
 }
 
 std::vector<vk::PipelineShaderStageCreateInfo> pipeline_box::createShaderStages() const {
-    return vulkan_device().boxPipeline->shaderStages;
+    return vulkan_device().box_pipeline().shaderStages;
 }
 
 std::vector<vk::DescriptorSetLayoutBinding> pipeline_box::createDescriptorSetLayoutBindings() const {
@@ -85,26 +100,14 @@ std::vector<vk::VertexInputAttributeDescription> pipeline_box::createVertexInput
 
 void pipeline_box::buildvertexBuffers()
 {
-    using vertexIndexType = uint16_t;
-    constexpr ssize_t numberOfVertices = 1 << (sizeof(vertexIndexType) * CHAR_BIT);
-
-    vk::BufferCreateInfo const bufferCreateInfo = {
-        vk::BufferCreateFlags(),
-        sizeof (vertex) * numberOfVertices,
-        vk::BufferUsageFlagBits::eVertexBuffer,
-        vk::SharingMode::eExclusive
-    };
-    VmaAllocationCreateInfo allocationCreateInfo = {};
-    allocationCreateInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
-
-    std::tie(vertexBuffer, vertexBufferAllocation) = vulkan_device().createBuffer(bufferCreateInfo, allocationCreateInfo);
-    vertexBufferData = vulkan_device().mapMemory<vertex>(vertexBufferAllocation);
+    vertexBuffers.build(vulkan_device(), nrFramesInFlight());
+    vertexBuffers.select(vulkan_device(), frameInFlightIndex, vertexBufferData);
 }
 
 void pipeline_box::teardownvertexBuffers()
 {
-    vulkan_device().unmapMemory(vertexBufferAllocation);
-    vulkan_device().destroyBuffer(vertexBuffer, vertexBufferAllocation);
+    vertexBuffers.teardown(vulkan_device());
+    vertexBufferData = {};
 }
 
 }
@@ -72,7 +72,10 @@ bool insideTopRightCorner(float maximumDistanceFromCorner)
 
 float shapeAdjustedDistance(vec2 distance2D)
 {
-    if (insideBottomLeftCorner(inCornerRadii.x)) {
+    if (inCornerShapes == uvec4(0, 0, 0, 0)) {
+        // Square corners; all fragments of a box take the same branch, so it does not diverge.
+        return edgeDistance(distance2D);
+    } else if (insideBottomLeftCorner(inCornerRadii.x)) {
         return cornerDistance(distance2D, inCornerRadii.x, inCornerShapes.x);
     } else if (insideBottomRightCorner(inCornerRadii.y)) {
         return cornerDistance(distance2D, inCornerRadii.y, inCornerShapes.y);
@@ -99,8 +102,13 @@ void main() {
     float distance = shapeAdjustedDistance(distance2D);
     
     float background = clamp(distance - inBorderEnd + 0.5, 0.0, 1.0);
-    if (background == 1.0 && inBackgroundColor.a == 0.0) {
-        discard;
+    if (background == 1.0) {
+        // Fully inside the border, which is most of the fragments of a box.
+        if (inBackgroundColor.a == 0.0) {
+            discard;
+        }
+        outColor = inBackgroundColor;
+        return;
     }
 
     float border = clamp(distance - inBorderStart + 0.5, 0.0, 1.0);
@@ -5,6 +5,8 @@
 #pragma once
 
 #include "pipeline_vulkan.hpp"
+#include "frame_vertex_buffers.hpp"
+#include "redraw_vertex_ranges.hpp"
 #include "pipeline_box_push_constants.hpp"
 #include "pipeline_box_vertex.hpp"
 #include "../vspan.hpp"
@@ -12,6 +14,7 @@
 #include <span>
 
 namespace tt::pipeline_box {
+struct device_shared;
 
 /*! Pipeline for rendering simple box shaded quats.
  */
@@ -19,6 +22,10 @@ class pipeline_box : public pipeline_vulkan {
 public:
     vspan<vertex> vertexBufferData;
 
+    /** The ranges of `vertexBufferData` with the redraw rectangles they overlap.
+     */
+    redraw_vertex_ranges vertexBufferRanges;
+
     pipeline_box(gui_window const &window);
     ~pipeline_box() {};
 
@@ -27,13 +34,24 @@ public:
     pipeline_box(pipeline_box &&) = delete;
     pipeline_box &operator=(pipeline_box &&) = delete;
 
-    void drawInCommandBuffer(vk::CommandBuffer commandBuffer) override;
+    void prepareForDraw() override;
+
+    /** Draw the vertices that overlap a redraw rectangle.
+     * This only records commands, so that the draws of the pipelines can be recorded in parallel.
+     * @param redrawRectangleIndex The index of the redraw rectangle of the current render pass.
+     */
+    void drawInCommandBuffer(vk::CommandBuffer commandBuffer, size_t redrawRectangleIndex);
+    void set_frame_in_flight(size_t index) noexcept override;
 
 protected:
     push_constants pushConstants;
 
-    vk::Buffer vertexBuffer;
-    VmaAllocation vertexBufferAllocation;
+    // One vertex buffer for each frame-in-flight.
+    frame_vertex_buffers<vertex> vertexBuffers;
+
+    /** The resources shared by the windows on the device, selected by `prepareForDraw()`.
+     */
+    device_shared *sharedPipeline = nullptr;
 
     std::vector<vk::PipelineShaderStageCreateInfo> createShaderStages() const override;
     std::vector<vk::DescriptorSetLayoutBinding> createDescriptorSetLayoutBindings() const override;
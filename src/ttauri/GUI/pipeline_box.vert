@@ -6,13 +6,15 @@ layout(push_constant) uniform push_constants {
     vec2 viewportScale;
 } pushConstants;
 
-layout(location = 0) in vec3 inPosition;
-layout(location = 1) in vec4 inClippingRectangle;
-layout(location = 2) in vec4 inCornerCoordinates;
-layout(location = 3) in vec4 inBackgroundColor;
-layout(location = 4) in vec4 inBorderColor;
-layout(location = 5) in vec4 inCornerRadiiAndShapes;
-layout(location = 6) in float inBorderSize;
+// Per instance attributes, one instance per box.
+layout(location = 0) in vec3 inOrigin;
+layout(location = 1) in vec3 inRight;
+layout(location = 2) in vec3 inUp;
+layout(location = 3) in vec4 inClippingRectangle;
+layout(location = 4) in vec4 inBackgroundColor;
+layout(location = 5) in vec4 inBorderColor;
+layout(location = 6) in vec4 inCornerRadiiAndShapes;
+layout(location = 7) in float inBorderSize;
 
 layout(location = 0) out flat vec4 outClippingRectangle;
 layout(location = 1) out vec4 outCornerCoordinates;
@@ -46,9 +48,13 @@ void main() {
     float borderMiddle = borderStart + inBorderSize * 0.5;
     float borderEnd = borderStart + inBorderSize;
 
-    gl_Position = convertPositionToViewport(inPosition);
+    // The index buffer selects the corner of the quad: 0 = bottom-left, 1 = bottom-right, 2 = top-left, 3 = top-right.
+    vec2 corner = vec2(float(gl_VertexIndex & 1), float((gl_VertexIndex >> 1) & 1));
+    vec2 extent = vec2(length(inRight), length(inUp));
+
+    gl_Position = convertPositionToViewport(inOrigin + inRight * corner.x + inUp * corner.y);
     outClippingRectangle = convertClippingRectangleToScreen(inClippingRectangle);
-    outCornerCoordinates = inCornerCoordinates;
+    outCornerCoordinates = vec4(corner * extent, (vec2(1.0, 1.0) - corner) * extent);
     outBackgroundColor = vec4(inBackgroundColor.rgb * inBackgroundColor.a, inBackgroundColor.a);
     outBorderColor = vec4(inBorderColor.rgb * inBorderColor.a, inBorderColor.a);
     outCornerShapes = ivec4(
@@ -6,6 +6,9 @@
 
 #include "../vspan.hpp"
 #include "../geometry/axis_aligned_rectangle.hpp"
+#include "../geometry/rectangle.hpp"
+#include "../geometry/corner_shapes.hpp"
+#include "../color/color.hpp"
 #include "../color/sfloat_rgba16.hpp"
 #include "../color/sfloat_rgba32.hpp"
 #include "../color/sfloat_rgb32.hpp"
@@ -14,27 +17,23 @@
 
 namespace tt::pipeline_box {
 
-/*! A vertex defining a rectangle on a window.
+/*! An instance defining a box on a window.
+* Each box is drawn as a single instance; the vertex shader expands it into the four corners of a quad.
 * The vertex shader will convert window pixel-coordinates to normalized projection-coordinates.
 */
 struct vertex {
-    //! The pixel-coordinates where the origin is located relative to the bottom-left corner of the window.
-    sfloat_rgb32 position;
+    //! The pixel-coordinates of the bottom-left corner of the quad, relative to the bottom-left corner of the window.
+    sfloat_rgb32 origin;
+
+    //! The vector in pixels from the bottom-left corner to the bottom-right corner of the quad.
+    sfloat_rgb32 right;
+
+    //! The vector in pixels from the bottom-left corner to the top-left corner of the quad.
+    sfloat_rgb32 up;
 
     //! The position in pixels of the clipping rectangle relative to the bottom-left corner of the window, and extent in pixels.
     sfloat_rgba32 clipping_rectangle;
 
-    /** Double 2D coordinates inside the quad, used to determine the distance from the sides and corner inside the fragment shader.
-     * x = Number of pixels to the right from the left edge of the quad.
-     * y = Number of pixels above the bottom edge.
-     * z = Number of pixels to the left from the right edge of the quad.
-     * w = Number of pixels below the top edge.
-     * 
-     * The rasteriser will interpolate these numbers, so that inside the fragment shader
-     * the distance from a corner can be determined easily.
-     */
-    sfloat_rgba32 corner_coordinate;
-
     //! background color of the box.
     sfloat_rgba16 fill_color;
 
@@ -48,16 +47,16 @@ struct vertex {
 
     vertex(
         aarectangle clipping_rectangle,
-        point3 position,
-        f32x4 corner_coordinate,
+        rectangle quad,
         color fill_color,
         color line_color,
         float line_width,
         tt::corner_shapes corner_shapes
     ) noexcept :
-        position(position),
+        origin(get<0>(quad)),
+        right(static_cast<f32x4>(quad.right_vector())),
+        up(static_cast<f32x4>(quad.up_vector())),
         clipping_rectangle(clipping_rectangle),
-        corner_coordinate(corner_coordinate),
         fill_color(fill_color),
         line_color(line_color),
         corner_shapes(corner_shapes),
@@ -68,20 +67,21 @@ struct vertex {
     static vk::VertexInputBindingDescription inputBindingDescription()
     {
         return {
-            0, sizeof(vertex), vk::VertexInputRate::eVertex
+            0, sizeof(vertex), vk::VertexInputRate::eInstance
         };
     }
 
     static std::vector<vk::VertexInputAttributeDescription> inputAttributeDescriptions()
     {
         return {
-            { 0, 0, vk::Format::eR32G32B32Sfloat, offsetof(vertex, position) },
-            { 1, 0, vk::Format::eR32G32B32A32Sfloat, offsetof(vertex, clipping_rectangle) },
-            { 2, 0, vk::Format::eR32G32B32A32Sfloat, offsetof(vertex, corner_coordinate) },
-            { 3, 0, vk::Format::eR16G16B16A16Sfloat, offsetof(vertex, fill_color) },
-            { 4, 0, vk::Format::eR16G16B16A16Sfloat, offsetof(vertex, line_color) },
-            { 5, 0, vk::Format::eR16G16B16A16Sfloat, offsetof(vertex, corner_shapes) },
-            { 6, 0, vk::Format::eR32Sfloat, offsetof(vertex, line_width) },
+            { 0, 0, vk::Format::eR32G32B32Sfloat, offsetof(vertex, origin) },
+            { 1, 0, vk::Format::eR32G32B32Sfloat, offsetof(vertex, right) },
+            { 2, 0, vk::Format::eR32G32B32Sfloat, offsetof(vertex, up) },
+            { 3, 0, vk::Format::eR32G32B32A32Sfloat, offsetof(vertex, clipping_rectangle) },
+            { 4, 0, vk::Format::eR16G16B16A16Sfloat, offsetof(vertex, fill_color) },
+            { 5, 0, vk::Format::eR16G16B16A16Sfloat, offsetof(vertex, line_color) },
+            { 6, 0, vk::Format::eR16G16B16A16Sfloat, offsetof(vertex, corner_shapes) },
+            { 7, 0, vk::Format::eR32Sfloat, offsetof(vertex, line_width) },
         };
     }
 };
@@ -5,6 +5,7 @@
 #include "pipeline_flat.hpp"
 #include "pipeline_flat_device_shared.hpp"
 #include "gui_device_vulkan.hpp"
+#include <algorithm>
 
 namespace tt::pipeline_flat {
 
@@ -12,21 +13,35 @@ using namespace tt;
 using namespace std;
 
 pipeline_flat::pipeline_flat(gui_window const &window) :
-    pipeline_vulkan(window)
+    pipeline_vulkan(window),
+    // Initially the number of vertices addressed by the quad index buffer.
+    vertexBuffers(1 << 16, 1 << 20)
 {
 }
 
-void pipeline_flat::drawInCommandBuffer(vk::CommandBuffer commandBuffer)
+void pipeline_flat::set_frame_in_flight(size_t index) noexcept
 {
-    pipeline_vulkan::drawInCommandBuffer(commandBuffer);
+    pipeline_vulkan::set_frame_in_flight(index);
+    vertexBuffers.select(vulkan_device(), index, vertexBufferData);
+}
 
-    vulkan_device().flushAllocation(vertexBufferAllocation, 0, vertexBufferData.size() * sizeof (vertex));
+void pipeline_flat::prepareForDraw()
+{
+    pipeline_vulkan::prepareForDraw();
+
+    vertexBuffers.flush(vulkan_device(), vertexBufferData.size());
+    sharedPipeline = &vulkan_device().flat_pipeline();
+}
 
-    std::vector<vk::Buffer> tmpvertexBuffers = { vertexBuffer };
+void pipeline_flat::drawInCommandBuffer(vk::CommandBuffer commandBuffer, size_t redrawRectangleIndex)
+{
+    pipeline_vulkan::drawInCommandBuffer(commandBuffer);
+
+    std::vector<vk::Buffer> tmpvertexBuffers = { vertexBuffers.buffer() };
     std::vector<vk::DeviceSize> tmpOffsets = { 0 };
     tt_axiom(tmpvertexBuffers.size() == tmpOffsets.size());
 
-    vulkan_device().flatPipeline->drawInCommandBuffer(commandBuffer);
+    sharedPipeline->drawInCommandBuffer(commandBuffer);
 
     commandBuffer.bindVertexBuffers(0, tmpvertexBuffers, tmpOffsets);
 
@@ -40,19 +55,27 @@ void pipeline_flat::drawInCommandBuffer(vk::CommandBuffer commandBuffer)
         &pushConstants
     );
 
-    ttlet numberOfRectangles = vertexBufferData.size() / 4;
-    ttlet numberOfTriangles = numberOfRectangles * 2;
-    commandBuffer.drawIndexed(
-        narrow_cast<uint32_t>(numberOfTriangles * 3),
-        1,
-        0,
-        0,
-        0
-    );
+    // Only the ranges of vertices that overlap the redraw rectangle are drawn.
+    // The quad index buffer addresses 65536 vertices, larger ranges are drawn in batches.
+    constexpr size_t maximumNumberOfRectanglesPerDraw = (1 << 16) / 4;
+    vertexBufferRanges.for_each(redrawRectangleIndex, [&](size_t firstVertex, size_t numberOfVertices) {
+        ttlet firstRectangle = firstVertex / 4;
+        ttlet lastRectangle = firstRectangle + numberOfVertices / 4;
+        for (auto i = firstRectangle; i < lastRectangle; i += maximumNumberOfRectanglesPerDraw) {
+            ttlet numberOfTriangles = std::min(lastRectangle - i, maximumNumberOfRectanglesPerDraw) * 2;
+            commandBuffer.drawIndexed(
+                narrow_cast<uint32_t>(numberOfTriangles * 3),
+                1,
+                0,
+                narrow_cast<int32_t>(i * 4),
+                0
+            );
+        }
+    });
 }
 
 std::vector<vk::PipelineShaderStageCreateInfo> pipeline_flat::createShaderStages() const {
-    return vulkan_device().flatPipeline->shaderStages;
+    return vulkan_device().flat_pipeline().shaderStages;
 }
 
 std::vector<vk::DescriptorSetLayoutBinding> pipeline_flat::createDescriptorSetLayoutBindings() const {
@@ -85,26 +108,14 @@ std::vector<vk::VertexInputAttributeDescription> pipeline_flat::createVertexInpu
 
 void pipeline_flat::buildvertexBuffers()
 {
-    using vertexIndexType = uint16_t;
-    constexpr ssize_t numberOfVertices = 1 << (sizeof(vertexIndexType) * CHAR_BIT);
-
-    vk::BufferCreateInfo const bufferCreateInfo = {
-        vk::BufferCreateFlags(),
-        sizeof (vertex) * numberOfVertices,
-        vk::BufferUsageFlagBits::eVertexBuffer,
-        vk::SharingMode::eExclusive
-    };
-    VmaAllocationCreateInfo allocationCreateInfo = {};
-    allocationCreateInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
-
-    std::tie(vertexBuffer, vertexBufferAllocation) = vulkan_device().createBuffer(bufferCreateInfo, allocationCreateInfo);
-    vertexBufferData = vulkan_device().mapMemory<vertex>(vertexBufferAllocation);
+    vertexBuffers.build(vulkan_device(), nrFramesInFlight());
+    vertexBuffers.select(vulkan_device(), frameInFlightIndex, vertexBufferData);
 }
 
 void pipeline_flat::teardownvertexBuffers()
 {
-    vulkan_device().unmapMemory(vertexBufferAllocation);
-    vulkan_device().destroyBuffer(vertexBuffer, vertexBufferAllocation);
+    vertexBuffers.teardown(vulkan_device());
+    vertexBufferData = {};
 }
 
 }
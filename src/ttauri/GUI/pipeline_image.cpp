@@ -5,6 +5,7 @@
 #include "pipeline_image.hpp"
 #include "pipeline_image_device_shared.hpp"
 #include "gui_device_vulkan.hpp"
+#include <algorithm>
 
 namespace tt::pipeline_image {
 
@@ -12,31 +13,42 @@ using namespace tt;
 using namespace std;
 
 pipeline_image::pipeline_image(gui_window const &window) :
-    pipeline_vulkan(window)
+    pipeline_vulkan(window),
+    // Initially the number of vertices addressed by the quad index buffer.
+    vertexBuffers(1 << 16, 1 << 20)
 {
 }
 
 
-void pipeline_image::drawInCommandBuffer(vk::CommandBuffer commandBuffer)
+void pipeline_image::set_frame_in_flight(size_t index) noexcept
 {
-    pipeline_vulkan::drawInCommandBuffer(commandBuffer);
+    pipeline_vulkan::set_frame_in_flight(index);
+    vertexBuffers.select(vulkan_device(), index, vertexBufferData);
+}
 
-    vulkan_device().flushAllocation(vertexBufferAllocation, 0, vertexBufferData.size() * sizeof (vertex));
-    vulkan_device().imagePipeline->prepareAtlasForRendering();
+void pipeline_image::prepareForDraw()
+{
+    pipeline_vulkan::prepareForDraw();
+
+    vertexBuffers.flush(vulkan_device(), vertexBufferData.size());
+    sharedPipeline = &vulkan_device().image_pipeline();
+}
 
-    std::vector<vk::Buffer> tmpvertexBuffers = { vertexBuffer };
+void pipeline_image::drawInCommandBuffer(vk::CommandBuffer commandBuffer, size_t redrawRectangleIndex)
+{
+    pipeline_vulkan::drawInCommandBuffer(commandBuffer);
+
+    std::vector<vk::Buffer> tmpvertexBuffers = { vertexBuffers.buffer() };
     std::vector<vk::DeviceSize> tmpOffsets = { 0 };
     tt_axiom(tmpvertexBuffers.size() == tmpOffsets.size());
 
-    vulkan_device().imagePipeline->drawInCommandBuffer(commandBuffer);
+    sharedPipeline->drawInCommandBuffer(commandBuffer);
 
 
     commandBuffer.bindVertexBuffers(0, tmpvertexBuffers, tmpOffsets);
 
     pushConstants.windowExtent = extent2{ narrow_cast<float>(extent.width) , narrow_cast<float>(extent.height) };
     pushConstants.viewportScale = { 2.0f / extent.width, 2.0f / extent.height };
-    pushConstants.atlasExtent = { device_shared::atlasImageWidth, device_shared::atlasImageHeight };
-    pushConstants.atlasScale = { 1.0f / device_shared::atlasImageWidth, 1.0f / device_shared::atlasImageHeight };
     commandBuffer.pushConstants(
         pipelineLayout,
         vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment,
@@ -45,19 +57,27 @@ void pipeline_image::drawInCommandBuffer(vk::CommandBuffer commandBuffer)
         &pushConstants
     );
 
-    ttlet numberOfRectangles = vertexBufferData.size() / 4;
-    ttlet numberOfTriangles = numberOfRectangles * 2;
-    commandBuffer.drawIndexed(
-        narrow_cast<uint32_t>(numberOfTriangles * 3),
-        1,
-        0,
-        0,
-        0
-    );
+    // Only the ranges of vertices that overlap the redraw rectangle are drawn.
+    // The quad index buffer addresses 65536 vertices, larger ranges are drawn in batches.
+    constexpr size_t maximumNumberOfRectanglesPerDraw = (1 << 16) / 4;
+    vertexBufferRanges.for_each(redrawRectangleIndex, [&](size_t firstVertex, size_t numberOfVertices) {
+        ttlet firstRectangle = firstVertex / 4;
+        ttlet lastRectangle = firstRectangle + numberOfVertices / 4;
+        for (auto i = firstRectangle; i < lastRectangle; i += maximumNumberOfRectanglesPerDraw) {
+            ttlet numberOfTriangles = std::min(lastRectangle - i, maximumNumberOfRectanglesPerDraw) * 2;
+            commandBuffer.drawIndexed(
+                narrow_cast<uint32_t>(numberOfTriangles * 3),
+                1,
+                0,
+                narrow_cast<int32_t>(i * 4),
+                0
+            );
+        }
+    });
 }
 
 std::vector<vk::PipelineShaderStageCreateInfo> pipeline_image::createShaderStages() const {
-    return vulkan_device().imagePipeline->shaderStages;
+    return vulkan_device().image_pipeline().shaderStages;
 }
 
 std::vector<vk::DescriptorSetLayoutBinding> pipeline_image::createDescriptorSetLayoutBindings() const {
@@ -69,14 +89,14 @@ std::vector<vk::DescriptorSetLayoutBinding> pipeline_image::createDescriptorSetL
     }, {
         1, // binding
         vk::DescriptorType::eSampledImage,
-        narrow_cast<uint32_t>(device_shared::atlasMaximumNrImages), // descriptorCount
+        vulkan_device().image_pipeline().nrTextures, // descriptorCount
         vk::ShaderStageFlagBits::eFragment
     } };
 }
 
 vector<vk::WriteDescriptorSet> pipeline_image::createWriteDescriptorSet() const
 {
-    ttlet &sharedImagePipeline = vulkan_device().imagePipeline;
+    ttlet &sharedImagePipeline = vulkan_device().image_pipeline();
 
     return { {
         descriptorSet,
@@ -84,16 +104,16 @@ vector<vk::WriteDescriptorSet> pipeline_image::createWriteDescriptorSet() const
         0, // arrayElement
         1, // descriptorCount
         vk::DescriptorType::eSampler,
-        &sharedImagePipeline->atlasSamplerDescriptorImageInfo,
+        &sharedImagePipeline.atlasSamplerDescriptorImageInfo,
         nullptr,  // bufferInfo
         nullptr // texelBufferView
     }, {
         descriptorSet,
         1, // destBinding
         0, // arrayElement
-        narrow_cast<uint32_t>(sharedImagePipeline->atlasDescriptorImageInfos.size()), // descriptorCount
+        narrow_cast<uint32_t>(sharedImagePipeline.textureDescriptorImageInfos.size()), // descriptorCount
         vk::DescriptorType::eSampledImage,
-        sharedImagePipeline->atlasDescriptorImageInfos.data(),
+        sharedImagePipeline.textureDescriptorImageInfos.data(),
         nullptr, // bufferInfo
         nullptr // texelBufferView
     } };
@@ -101,7 +121,7 @@ vector<vk::WriteDescriptorSet> pipeline_image::createWriteDescriptorSet() const
 
 ssize_t pipeline_image::getDescriptorSetVersion() const
 {
-    return std::ssize(vulkan_device().imagePipeline->atlasTextures);
+    return vulkan_device().image_pipeline().textureDescriptorVersion;
 }
 
 std::vector<vk::PushConstantRange> pipeline_image::createPushConstantRanges() const
@@ -120,26 +140,14 @@ std::vector<vk::VertexInputAttributeDescription> pipeline_image::createVertexInp
 
 void pipeline_image::buildvertexBuffers()
 {
-    using vertexIndexType = uint16_t;
-    constexpr ssize_t numberOfVertices = 1 << (sizeof(vertexIndexType) * CHAR_BIT);
-
-    vk::BufferCreateInfo const bufferCreateInfo = {
-        vk::BufferCreateFlags(),
-        sizeof (vertex) * numberOfVertices,
-        vk::BufferUsageFlagBits::eVertexBuffer,
-        vk::SharingMode::eExclusive
-    };
-    VmaAllocationCreateInfo allocationCreateInfo = {};
-    allocationCreateInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
-
-    std::tie(vertexBuffer, vertexBufferAllocation) = vulkan_device().createBuffer(bufferCreateInfo, allocationCreateInfo);
-    vertexBufferData = vulkan_device().mapMemory<vertex>(vertexBufferAllocation);
+    vertexBuffers.build(vulkan_device(), nrFramesInFlight());
+    vertexBuffers.select(vulkan_device(), frameInFlightIndex, vertexBufferData);
 }
 
 void pipeline_image::teardownvertexBuffers()
 {
-    vulkan_device().unmapMemory(vertexBufferAllocation);
-    vulkan_device().destroyBuffer(vertexBuffer, vertexBufferAllocation);
+    vertexBuffers.teardown(vulkan_device());
+    vertexBufferData = {};
 }
 
 }
@@ -7,7 +7,9 @@ layout(push_constant) uniform push_constants {
 } pushConstants;
 
 layout(set = 0, binding = 0) uniform sampler bilinearSampler;
-layout(set = 0, binding = 1) uniform texture2D textures[16];
+// The number of textures is specialized for the limits of the device.
+layout(constant_id = 0) const int nrTextures = 16;
+layout(set = 0, binding = 1) uniform texture2D textures[nrTextures];
 
 layout(location = 0) in flat vec4 inClippingRectangle;
 layout(location = 1) in vec3 inAtlasPosition;
@@ -5,12 +5,15 @@
 #pragma once
 
 #include "pipeline_vulkan.hpp"
+#include "frame_vertex_buffers.hpp"
+#include "redraw_vertex_ranges.hpp"
 #include "pipeline_image_push_constants.hpp"
 #include "pipeline_image_vertex.hpp"
 #include "../vspan.hpp"
 #include <vk_mem_alloc.h>
 
 namespace tt::pipeline_image {
+struct device_shared;
 
 /*! Pipeline for rendering backings of widgets.
  * Maintains texture map atlas and sharing for all views.
@@ -19,6 +22,10 @@ class pipeline_image : public pipeline_vulkan {
 public:
     vspan<vertex> vertexBufferData;
 
+    /** The ranges of `vertexBufferData` with the redraw rectangles they overlap.
+     */
+    redraw_vertex_ranges vertexBufferRanges;
+
     pipeline_image(gui_window const &window);
     ~pipeline_image() {};
 
@@ -27,14 +34,25 @@ public:
     pipeline_image(pipeline_image &&) = delete;
     pipeline_image &operator=(pipeline_image &&) = delete;
 
-    void drawInCommandBuffer(vk::CommandBuffer commandBuffer) override;
+    void prepareForDraw() override;
+
+    /** Draw the vertices that overlap a redraw rectangle.
+     * This only records commands, so that the draws of the pipelines can be recorded in parallel.
+     * @param redrawRectangleIndex The index of the redraw rectangle of the current render pass.
+     */
+    void drawInCommandBuffer(vk::CommandBuffer commandBuffer, size_t redrawRectangleIndex);
+    void set_frame_in_flight(size_t index) noexcept override;
 
 protected:
     push_constants pushConstants;
     int numberOfAtlasImagesInDescriptor = 0;
 
-    vk::Buffer vertexBuffer;
-    VmaAllocation vertexBufferAllocation;
+    // One vertex buffer for each frame-in-flight.
+    frame_vertex_buffers<vertex> vertexBuffers;
+
+    /** The resources shared by the windows on the device, selected by `prepareForDraw()`.
+     */
+    device_shared *sharedPipeline = nullptr;
 
     std::vector<vk::PipelineShaderStageCreateInfo> createShaderStages() const override;
     std::vector<vk::DescriptorSetLayoutBinding> createDescriptorSetLayoutBindings() const override;
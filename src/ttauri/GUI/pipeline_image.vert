@@ -4,8 +4,6 @@
 layout(push_constant) uniform push_constants {
     vec2 windowExtent;
     vec2 viewportScale;
-    vec2 atlasExtent;
-    vec2 atlasScale;
 } pushConstants;
 
 layout(location = 0) in vec3 inPosition;
@@ -36,5 +34,5 @@ vec4 convertClippingRectangleToScreen(vec4 clippingRectangle)
 void main() {
     gl_Position = convertPositionToViewport(inPosition);
     outClippingRectangle = convertClippingRectangleToScreen(inClippingRectangle);
-    outTextureCoord = inTextureCoord * vec3(pushConstants.atlasScale, 1.0);
+    outTextureCoord = inTextureCoord;
 }
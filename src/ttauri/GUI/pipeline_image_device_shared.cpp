@@ -11,14 +11,23 @@
 #include "../URL.hpp"
 #include "../memory.hpp"
 #include "../cast.hpp"
+#include "../counters.hpp"
 #include <array>
+#include <algorithm>
 
 namespace tt::pipeline_image {
 
 using namespace std;
 
-device_shared::device_shared(gui_device_vulkan const &device) : device(device)
+device_shared::device_shared(gui_device_vulkan const &device) : device(device), stagingBuffer(device, stagingBufferSize)
 {
+    ttlet &limits = device.physicalProperties.limits;
+    nrTextures = std::min(
+        {narrow_cast<uint32_t>(atlasMaximumNrImages + maximumNrDedicatedTextures),
+         limits.maxPerStageDescriptorSampledImages,
+         limits.maxDescriptorSetSampledImages});
+    dedicatedTextures.resize(nrTextures > atlasMaximumNrImages ? nrTextures - atlasMaximumNrImages : 0);
+
     buildShaders();
     buildAtlas();
 }
@@ -52,26 +61,131 @@ void device_shared::freePages(std::vector<Page> const &pages) noexcept
     atlasFreePages.insert(atlasFreePages.end(), pages.begin(), pages.end());
 }
 
+ssize_t device_shared::allocateDedicatedTexture(size_t width, size_t height) noexcept
+{
+    ttlet it = std::find_if(dedicatedTextures.begin(), dedicatedTextures.end(), [](ttlet &texture) {
+        return not texture.image;
+    });
+    if (it == dedicatedTextures.end()) {
+        return -1;
+    }
+
+    vk::ImageCreateInfo const imageCreateInfo = {
+        vk::ImageCreateFlags(),
+        vk::ImageType::e2D,
+        vk::Format::eR16G16B16A16Sfloat,
+        vk::Extent3D(narrow_cast<uint32_t>(width + 2 * Page::border), narrow_cast<uint32_t>(height + 2 * Page::border), 1),
+        1, // mipLevels
+        1, // arrayLayers
+        vk::SampleCountFlagBits::e1,
+        vk::ImageTiling::eOptimal,
+        vk::ImageUsageFlagBits::eTransferDst | vk::ImageUsageFlagBits::eSampled,
+        device.transferSharingQueueFamilyIndices.size() > 1 ? vk::SharingMode::eConcurrent : vk::SharingMode::eExclusive,
+        narrow_cast<uint32_t>(device.transferSharingQueueFamilyIndices.size()),
+        device.transferSharingQueueFamilyIndices.data(),
+        vk::ImageLayout::eUndefined};
+    VmaAllocationCreateInfo allocationCreateInfo = {};
+    allocationCreateInfo.usage = VMA_MEMORY_USAGE_GPU_ONLY;
+
+    ttlet[image, allocation] = device.createImage(imageCreateInfo, allocationCreateInfo);
+    add_to_counter<"image_atlas_bytes">(device.allocationSize(allocation));
+    device.transition_layout(image, imageCreateInfo.format, vk::ImageLayout::eUndefined, vk::ImageLayout::eGeneral);
+
+    ttlet view = device.createImageView(
+        {vk::ImageViewCreateFlags(),
+         image,
+         vk::ImageViewType::e2D,
+         imageCreateInfo.format,
+         vk::ComponentMapping(),
+         {vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1}});
+
+    *it = texture_map{image, allocation, view, tt::pixel_map<sfloat_rgba16>{}, vk::ImageLayout::eGeneral};
+    updateTextureDescriptors();
+
+    return atlasMaximumNrImages + std::distance(dedicatedTextures.begin(), it);
+}
+
+void device_shared::freeDedicatedTexture(ssize_t textureIndex) noexcept
+{
+    auto &texture = dedicatedTextures.at(narrow_cast<size_t>(textureIndex - atlasMaximumNrImages));
+    tt_axiom(texture.image);
+
+    // The texture may still be sampled by frames in flight, or written by an upload.
+    device.waitIdle();
+
+    device.destroy(texture.view);
+    add_to_counter<"image_atlas_bytes">(-device.allocationSize(texture.allocation));
+    device.destroyImage(texture.image, texture.allocation);
+    texture = {};
+
+    updateTextureDescriptors();
+}
+
 Image device_shared::makeImage(size_t width, size_t height) noexcept
 {
     ttlet width_in_pages = (width + (Page::width - 1)) / Page::width;
     ttlet height_in_pages = (height + (Page::height - 1)) / Page::height;
     ttlet nr_pages = width_in_pages * height_in_pages;
 
+    if (nr_pages > dedicatedTextureMinimumNrPages) {
+        if (ttlet textureIndex = allocateDedicatedTexture(width, height); textureIndex >= 0) {
+            return Image{this, width, height, textureIndex};
+        }
+    }
+
     return Image{this, width, height, width_in_pages, height_in_pages, allocatePages(nr_pages)};
 }
 
-tt::pixel_map<sfloat_rgba16> device_shared::getStagingPixelMap()
+std::shared_ptr<Image> device_shared::findSharedImage(uint64_t key) noexcept
+{
+    ttlet it = sharedImages.find(key);
+    if (it == sharedImages.end()) {
+        return {};
+    }
+
+    if (auto image = it->second.lock()) {
+        increment_counter<"image_shared_hit">();
+        return image;
+    }
+
+    sharedImages.erase(it);
+    return {};
+}
+
+std::shared_ptr<Image> device_shared::makeSharedImage(uint64_t key, pixel_map<sfloat_rgba16> const &pixels) noexcept
+{
+    // Remove the entries of images that have been released, so that the cache does not grow.
+    std::erase_if(sharedImages, [](ttlet &item) {
+        return item.second.expired();
+    });
+
+    auto image = std::make_shared<Image>(makeImage(narrow_cast<size_t>(pixels.width()), narrow_cast<size_t>(pixels.height())));
+    image->upload(pixels);
+    sharedImages[key] = image;
+    return image;
+}
+
+tt::pixel_map<sfloat_rgba16> device_shared::getStagingPixelMap(size_t width, size_t height)
 {
-    stagingTexture.transitionLayout(device, vk::Format::eR16G16B16A16Sfloat, vk::ImageLayout::eGeneral);
+    ttlet widthIncludingBorder = width + 2 * Page::border;
+    ttlet heightIncludingBorder = height + 2 * Page::border;
+
+    // Each image is submitted before the next is allocated, so the ring will always make room.
+    stagingRegion =
+        stagingBuffer.allocate(widthIncludingBorder * heightIncludingBorder * sizeof(sfloat_rgba16), sizeof(sfloat_rgba16));
+    tt_axiom(stagingRegion);
 
-    return stagingTexture.pixel_map.submap(
-        Page::border, Page::border, stagingImageWidth - 2 * Page::border, stagingImageHeight - 2 * Page::border);
+    stagingPixelMap = tt::pixel_map<sfloat_rgba16>{
+        reinterpret_cast<sfloat_rgba16 *>(stagingRegion.bytes.data()),
+        narrow_cast<ssize_t>(widthIncludingBorder),
+        narrow_cast<ssize_t>(heightIncludingBorder)};
+
+    return stagingPixelMap.submap(Page::border, Page::border, width, height);
 }
 
 void device_shared::updateAtlasWithStagingPixelMap(const Image &image)
 {
-    // Start with the actual image inside the stagingImage.
+    // Start with the actual image inside the staging pixel map.
     auto rectangle = aarectangle{
         point2{narrow_cast<float>(Page::border), narrow_cast<float>(Page::border)},
         extent2{narrow_cast<float>(image.width_in_px), narrow_cast<float>(image.height_in_px)}};
@@ -81,19 +195,31 @@ void device_shared::updateAtlasWithStagingPixelMap(const Image &image)
     for (int b = 0; b < Page::border; b++) {
         rectangle = expand(rectangle, 1);
 
-        auto pixel_map = stagingTexture.pixel_map.submap(rectangle);
+        auto pixel_map = stagingPixelMap.submap(rectangle);
         makeTransparentBorder(pixel_map);
     }
 
     // Flush the given image, included the border.
-    device.flushAllocation(
-        stagingTexture.allocation,
-        0,
-        ((image.width_in_px + 2 * Page::border) * stagingTexture.pixel_map.stride()) * sizeof(uint32_t));
-
-    stagingTexture.transitionLayout(device, vk::Format::eR16G16B16A16Sfloat, vk::ImageLayout::eTransferSrcOptimal);
+    stagingBuffer.flush(stagingRegion);
+
+    if (image.dedicated_texture >= 0) {
+        // The image including its border fills the dedicated texture.
+        ttlet &texture = dedicatedTextures.at(narrow_cast<size_t>(image.dedicated_texture - atlasMaximumNrImages));
+        ttlet region = vk::BufferImageCopy{
+            stagingRegion.offset,
+            narrow_cast<uint32_t>(stagingPixelMap.stride()),
+            narrow_cast<uint32_t>(stagingPixelMap.height()),
+            {vk::ImageAspectFlagBits::eColor, 0, 0, 1},
+            {0, 0, 0},
+            {narrow_cast<uint32_t>(stagingPixelMap.width()), narrow_cast<uint32_t>(stagingPixelMap.height()), 1}};
+
+        ttlet commandBuffer = device.beginTransferCommands();
+        commandBuffer.copyBufferToImage(stagingBuffer.buffer, texture.image, vk::ImageLayout::eGeneral, {region});
+        stagingBuffer.submitted(device.endTransferCommands(commandBuffer));
+        return;
+    }
 
-    array<vector<vk::ImageCopy>, atlasMaximumNrImages> regionsToCopyPerAtlasTexture;
+    array<vector<vk::BufferImageCopy>, atlasMaximumNrImages> regionsToCopyPerAtlasTexture;
     for (int index = 0; index < std::ssize(image.pages); index++) {
         ttlet page = image.pages.at(index);
 
@@ -106,7 +232,7 @@ void device_shared::updateAtlasWithStagingPixelMap(const Image &image)
         ttlet remove_border_translate = ~add_border_translate;
 
         ttlet imageRect = image.index_to_rect(index);
-        // Adjust the position to be inside the stagingImage, excluding its border.
+        // Adjust the position to be inside the staging pixel map, excluding its border.
         ttlet imageRectInStagingImage = add_border_translate * imageRect;
 
         // During copying we want to copy extra pixels around each page, this allows for non-nearest-neighbor sampling
@@ -116,38 +242,34 @@ void device_shared::updateAtlasWithStagingPixelMap(const Image &image)
         // We are copying the border into the atlas as well.
         ttlet atlasPositionIncludingBorder = remove_border_translate * getAtlasPositionFromPage(page);
 
+        ttlet stagingOffset = stagingRegion.offset +
+            (narrow_cast<size_t>(imageRectToCopy.bottom()) * narrow_cast<size_t>(stagingPixelMap.stride()) +
+             narrow_cast<size_t>(imageRectToCopy.left())) *
+                sizeof(sfloat_rgba16);
+
         auto &regionsToCopy = regionsToCopyPerAtlasTexture.at(narrow_cast<size_t>(atlasPositionIncludingBorder.z()));
         regionsToCopy.push_back(
-            {{vk::ImageAspectFlagBits::eColor, 0, 0, 1},
-             {narrow_cast<int32_t>(imageRectToCopy.left()), narrow_cast<int32_t>(imageRectToCopy.bottom()), 0},
+            {stagingOffset,
+             narrow_cast<uint32_t>(stagingPixelMap.stride()),
+             narrow_cast<uint32_t>(stagingPixelMap.height()),
              {vk::ImageAspectFlagBits::eColor, 0, 0, 1},
              {narrow_cast<int32_t>(atlasPositionIncludingBorder.x()), narrow_cast<int32_t>(atlasPositionIncludingBorder.y()), 0},
              {narrow_cast<uint32_t>(imageRectToCopy.width()), narrow_cast<uint32_t>(imageRectToCopy.height()), 1}});
     }
 
+    // The atlas textures stay in the general layout, so that the transfer queue does not
+    // need to transition images that are being sampled by the graphics queue.
+    ttlet commandBuffer = device.beginTransferCommands();
     for (int atlasTextureIndex = 0; atlasTextureIndex < std::ssize(atlasTextures); atlasTextureIndex++) {
         ttlet &regionsToCopy = regionsToCopyPerAtlasTexture.at(atlasTextureIndex);
         if (regionsToCopy.size() == 0) {
             continue;
         }
 
-        auto &atlasTexture = atlasTextures.at(atlasTextureIndex);
-        atlasTexture.transitionLayout(device, vk::Format::eR16G16B16A16Sfloat, vk::ImageLayout::eTransferDstOptimal);
-
-        device.copyImage(
-            stagingTexture.image,
-            vk::ImageLayout::eTransferSrcOptimal,
-            atlasTexture.image,
-            vk::ImageLayout::eTransferDstOptimal,
-            regionsToCopy);
-    }
-}
-
-void device_shared::prepareAtlasForRendering()
-{
-    for (auto &atlasTexture : atlasTextures) {
-        atlasTexture.transitionLayout(device, vk::Format::eR16G16B16A16Sfloat, vk::ImageLayout::eShaderReadOnlyOptimal);
+        commandBuffer.copyBufferToImage(
+            stagingBuffer.buffer, atlasTextures.at(atlasTextureIndex).image, vk::ImageLayout::eGeneral, regionsToCopy);
     }
+    stagingBuffer.submitted(device.endTransferCommands(commandBuffer));
 }
 
 void device_shared::drawInCommandBuffer(vk::CommandBuffer &commandBuffer)
@@ -160,9 +282,17 @@ void device_shared::buildShaders()
     vertexShaderModule = device.loadShader(URL("resource:GUI/pipeline_image.vert.spv"));
     fragmentShaderModule = device.loadShader(URL("resource:GUI/pipeline_image.frag.spv"));
 
+    // The size of the texture array in the fragment shader is specialization constant 0.
+    fragmentSpecializationMapEntry = {0, 0, sizeof(nrTextures)};
+    fragmentSpecializationInfo = {1, &fragmentSpecializationMapEntry, sizeof(nrTextures), &nrTextures};
+
     shaderStages = {
         {vk::PipelineShaderStageCreateFlags(), vk::ShaderStageFlagBits::eVertex, vertexShaderModule, "main"},
-        {vk::PipelineShaderStageCreateFlags(), vk::ShaderStageFlagBits::eFragment, fragmentShaderModule, "main"}};
+        {vk::PipelineShaderStageCreateFlags(),
+         vk::ShaderStageFlagBits::eFragment,
+         fragmentShaderModule,
+         "main",
+         &fragmentSpecializationInfo}};
 }
 
 void device_shared::teardownShaders(gui_device_vulkan *vulkanDevice)
@@ -187,14 +317,16 @@ void device_shared::addAtlasImage()
         vk::SampleCountFlagBits::e1,
         vk::ImageTiling::eOptimal,
         vk::ImageUsageFlagBits::eTransferDst | vk::ImageUsageFlagBits::eSampled,
-        vk::SharingMode::eExclusive,
-        0,
-        nullptr,
+        device.transferSharingQueueFamilyIndices.size() > 1 ? vk::SharingMode::eConcurrent : vk::SharingMode::eExclusive,
+        narrow_cast<uint32_t>(device.transferSharingQueueFamilyIndices.size()),
+        device.transferSharingQueueFamilyIndices.data(),
         vk::ImageLayout::eUndefined};
     VmaAllocationCreateInfo allocationCreateInfo = {};
     allocationCreateInfo.usage = VMA_MEMORY_USAGE_GPU_ONLY;
 
     ttlet[atlasImage, atlasImageAllocation] = device.createImage(imageCreateInfo, allocationCreateInfo);
+    add_to_counter<"image_atlas_bytes">(device.allocationSize(atlasImageAllocation));
+    device.transition_layout(atlasImage, imageCreateInfo.format, vk::ImageLayout::eUndefined, vk::ImageLayout::eGeneral);
 
     ttlet atlasImageView = device.createImageView(
         {vk::ImageViewCreateFlags(),
@@ -210,7 +342,7 @@ void device_shared::addAtlasImage()
              1 // layerCount
          }});
 
-    atlasTextures.push_back({atlasImage, atlasImageAllocation, atlasImageView});
+    atlasTextures.push_back({atlasImage, atlasImageAllocation, atlasImageView, tt::pixel_map<sfloat_rgba16>{}, vk::ImageLayout::eGeneral});
 
     // Add pages for this image to free list.
     ttlet pageOffset = currentImageIndex * atlasNrPagesPerImage;
@@ -218,45 +350,33 @@ void device_shared::addAtlasImage()
         atlasFreePages.push_back({pageOffset + i});
     }
 
-    // Build image descriptor info.
-    for (int i = 0; i < std::ssize(atlasDescriptorImageInfos); i++) {
-        // Point the descriptors to each imageView,
-        // repeat the first imageView if there are not enough.
-        atlasDescriptorImageInfos.at(i) = {
-            vk::Sampler(),
-            i < atlasTextures.size() ? atlasTextures.at(i).view : atlasTextures.at(0).view,
-            vk::ImageLayout::eShaderReadOnlyOptimal};
-    }
+    updateTextureDescriptors();
 }
 
-void device_shared::buildAtlas()
+void device_shared::updateTextureDescriptors() noexcept
 {
-    // Create staging image
-    vk::ImageCreateInfo const imageCreateInfo = {
-        vk::ImageCreateFlags(),
-        vk::ImageType::e2D,
-        vk::Format::eR16G16B16A16Sfloat,
-        vk::Extent3D(stagingImageWidth, stagingImageHeight, 1),
-        1, // mipLevels
-        1, // arrayLayers
-        vk::SampleCountFlagBits::e1,
-        vk::ImageTiling::eLinear,
-        vk::ImageUsageFlagBits::eTransferSrc,
-        vk::SharingMode::eExclusive,
-        0,
-        nullptr,
-        vk::ImageLayout::ePreinitialized};
-    VmaAllocationCreateInfo allocationCreateInfo = {};
-    allocationCreateInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
-    ttlet[image, allocation] = device.createImage(imageCreateInfo, allocationCreateInfo);
-    ttlet data = device.mapMemory<sfloat_rgba16>(allocation);
+    textureDescriptorImageInfos.resize(nrTextures);
+
+    // Point the descriptors to each imageView, repeat the first imageView for the slots without a texture.
+    ttlet firstView = atlasTextures.at(0).view;
+    for (size_t i = 0; i != textureDescriptorImageInfos.size(); ++i) {
+        auto view = firstView;
+        if (i < atlasMaximumNrImages) {
+            if (i < atlasTextures.size()) {
+                view = atlasTextures[i].view;
+            }
+        } else if (ttlet &texture = dedicatedTextures[i - atlasMaximumNrImages]; texture.image) {
+            view = texture.view;
+        }
 
-    stagingTexture = {
-        image,
-        allocation,
-        vk::ImageView(),
-        tt::pixel_map<sfloat_rgba16>{data.data(), imageCreateInfo.extent.width, imageCreateInfo.extent.height}};
+        textureDescriptorImageInfos[i] = {vk::Sampler(), view, vk::ImageLayout::eGeneral};
+    }
+
+    ++textureDescriptorVersion;
+}
 
+void device_shared::buildAtlas()
+{
     vk::SamplerCreateInfo const samplerCreateInfo = {
         vk::SamplerCreateFlags(),
         vk::Filter::eLinear, // magFilter
@@ -287,16 +407,27 @@ void device_shared::buildAtlas()
 void device_shared::teardownAtlas(gui_device_vulkan *vulkanDevice)
 {
     tt_axiom(vulkanDevice);
+
+    // Wait for uploads to complete before destroying the atlas.
+    stagingBuffer.destroy(vulkanDevice);
+
     vulkanDevice->destroy(atlasSampler);
 
     for (const auto &atlasImage : atlasTextures) {
         vulkanDevice->destroy(atlasImage.view);
+        add_to_counter<"image_atlas_bytes">(-vulkanDevice->allocationSize(atlasImage.allocation));
         vulkanDevice->destroyImage(atlasImage.image, atlasImage.allocation);
     }
     atlasTextures.clear();
 
-    vulkanDevice->unmapMemory(stagingTexture.allocation);
-    vulkanDevice->destroyImage(stagingTexture.image, stagingTexture.allocation);
+    for (const auto &texture : dedicatedTextures) {
+        if (texture.image) {
+            vulkanDevice->destroy(texture.view);
+            add_to_counter<"image_atlas_bytes">(-vulkanDevice->allocationSize(texture.allocation));
+            vulkanDevice->destroyImage(texture.image, texture.allocation);
+        }
+    }
+    dedicatedTextures.clear();
 }
 
 } // namespace tt::pipeline_image
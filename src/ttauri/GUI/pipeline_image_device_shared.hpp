@@ -6,11 +6,14 @@
 
 #include "pipeline_image_texture_map.hpp"
 #include "pipeline_image_page.hpp"
+#include "staging_ring_buffer.hpp"
 #include "../required.hpp"
 #include "../color/sfloat_rgba16.hpp"
 #include <vk_mem_alloc.h>
 #include <vulkan/vulkan.hpp>
 #include <mutex>
+#include <memory>
+#include <unordered_map>
 
 namespace tt {
 class gui_device_vulkan;
@@ -28,8 +31,21 @@ struct device_shared final {
     static constexpr int atlasImageHeight = atlasNrVerticalPages * Page::heightIncludingBorder;
     static constexpr int atlasNrPagesPerImage = atlasNrHorizontalPages * atlasNrVerticalPages;
     static constexpr int atlasMaximumNrImages = 16;
-    static constexpr int stagingImageWidth = 1024;
-    static constexpr int stagingImageHeight = 1024;
+
+    /** The maximum number of dedicated textures.
+     * Dedicated textures are placed in the texture array after the atlas textures.
+     */
+    static constexpr int maximumNrDedicatedTextures = 240;
+
+    /** Images that need more pages than this are stored in a dedicated texture.
+     * A large image split into pages would fragment the atlas.
+     */
+    static constexpr size_t dedicatedTextureMinimumNrPages = atlasNrPagesPerImage / 4;
+
+    /** The size of the ring buffer used for uploading images.
+     * Room for several images of 1024 x 1024 pixels to be uploaded at the same time.
+     */
+    static constexpr size_t stagingBufferSize = 32 * 1024 * 1024;
 
     gui_device_vulkan const &device;
 
@@ -37,15 +53,44 @@ struct device_shared final {
     vk::ShaderModule fragmentShaderModule;
     std::vector<vk::PipelineShaderStageCreateInfo> shaderStages;
 
-    texture_map stagingTexture;
+    /** The number of textures in the texture array of the fragment shader.
+     * This is limited by the number of sampled images per shader stage of the device.
+     */
+    uint32_t nrTextures;
+
+    /** Specialization of the fragment shader with the size of the texture array.
+     */
+    vk::SpecializationMapEntry fragmentSpecializationMapEntry;
+    vk::SpecializationInfo fragmentSpecializationInfo;
+
+    staging_ring_buffer stagingBuffer;
     std::vector<texture_map> atlasTextures;
 
-    std::array<vk::DescriptorImageInfo, atlasMaximumNrImages> atlasDescriptorImageInfos;
+    /** Textures for a single image each.
+     * The texture at index i is at index `atlasMaximumNrImages + i` in the texture array.
+     * A texture without an image is a free slot.
+     */
+    std::vector<texture_map> dedicatedTextures;
+
+    /** The descriptors of the texture array.
+     * Slots without a texture point to the first atlas texture.
+     */
+    std::vector<vk::DescriptorImageInfo> textureDescriptorImageInfos;
+
+    /** Incremented each time the textureDescriptorImageInfos are modified.
+     */
+    ssize_t textureDescriptorVersion = 0;
+
     vk::Sampler atlasSampler;
     vk::DescriptorImageInfo atlasSamplerDescriptorImageInfo;
 
     std::vector<Page> atlasFreePages;
 
+    /** Images that are shared between stencils, keyed by a hash of the URL or of the pixels.
+     * The cache does not own the images, an image is freed when the last stencil releases it.
+     */
+    std::unordered_map<uint64_t, std::weak_ptr<Image>> sharedImages;
+
     device_shared(gui_device_vulkan const &device);
     ~device_shared();
 
@@ -84,29 +129,67 @@ struct device_shared final {
      */
     void freePages(std::vector<Page> const &pages) noexcept;
 
-    /** Allocate an image in the atlas.
+    /** Allocate a dedicated texture for a single image.
      * @param width of the image.
      * @param height of the image.
-     * @return An image with allocated pages in the atlas.
+     * @return The index of the texture in the texture array, or -1 when all dedicated textures are in use.
+     */
+    ssize_t allocateDedicatedTexture(size_t width, size_t height) noexcept;
+
+    /** Deallocate a dedicated texture.
+     * This waits for the device to be idle, as the texture may be in use by a frame in flight.
+     * @param textureIndex Index of the texture in the texture array.
+     */
+    void freeDedicatedTexture(ssize_t textureIndex) noexcept;
+
+    /** Allocate an image in the atlas, or in a dedicated texture for large images.
+     * @param width of the image.
+     * @param height of the image.
+     * @return An image with allocated pages in the atlas, or with a dedicated texture.
      */
     Image makeImage(size_t width, size_t height) noexcept;
 
-    void drawInCommandBuffer(vk::CommandBuffer &commandBuffer);
+    /** Find an image that was shared with makeSharedImage().
+     *
+     * @param key The hash of the URL or pixels of the image.
+     * @return The image, or nullptr when the image is no longer used.
+     */
+    [[nodiscard]] std::shared_ptr<Image> findSharedImage(uint64_t key) noexcept;
 
-    tt::pixel_map<sfloat_rgba16> getStagingPixelMap();
+    /** Allocate an image, upload the pixels, and share it with later calls to findSharedImage().
+     *
+     * @param key The hash of the URL or pixels of the image.
+     * @param pixels The pixels to upload.
+     * @return The uploaded image.
+     */
+    [[nodiscard]] std::shared_ptr<Image> makeSharedImage(uint64_t key, pixel_map<sfloat_rgba16> const &pixels) noexcept;
 
-    void prepareAtlasForRendering();
+    void drawInCommandBuffer(vk::CommandBuffer &commandBuffer);
 
 private:
-    tt::pixel_map<sfloat_rgba16> getStagingPixelMap(size_t width, size_t height) {
-        return getStagingPixelMap().submap(0, 0, width, height);
-    }
+    /** The region of the staging buffer of the image being uploaded.
+     */
+    staging_ring_buffer::region stagingRegion;
+
+    /** The pixels of the staging region, including the border around the image.
+     */
+    tt::pixel_map<sfloat_rgba16> stagingPixelMap;
+
+    /** Allocate room in the staging buffer for an image.
+     *
+     * @return The pixel map to draw the image in, excluding the border.
+     */
+    tt::pixel_map<sfloat_rgba16> getStagingPixelMap(size_t width, size_t height);
 
+    /** Copy the image from the staging buffer into the atlas.
+     * The copy is submitted to the transfer queue and will complete asynchronously.
+     */
     void updateAtlasWithStagingPixelMap(Image const &image);
 
     void buildShaders();
     void teardownShaders(gui_device_vulkan *vulkanDevice);
     void addAtlasImage();
+    void updateTextureDescriptors() noexcept;
     void buildAtlas();
     void teardownAtlas(gui_device_vulkan *vulkanDevice);
 
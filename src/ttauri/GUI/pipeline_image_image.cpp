@@ -10,6 +10,7 @@
 #include "../required.hpp"
 #include "../cast.hpp"
 #include "../geometry/translate.hpp"
+#include "../geometry/scale.hpp"
 #include "../geometry/axis_aligned_rectangle.hpp"
 #include "../geometry/extent.hpp"
 
@@ -21,7 +22,8 @@ Image::Image(Image &&other) noexcept :
     height_in_px(other.height_in_px),
     width_in_pages(other.width_in_pages),
     height_in_pages(other.height_in_pages),
-    pages(std::move(other.pages))
+    pages(std::move(other.pages)),
+    dedicated_texture(other.dedicated_texture)
 {
     tt_axiom(&other != this);
     other.parent = nullptr;
@@ -30,9 +32,7 @@ Image::Image(Image &&other) noexcept :
 Image &Image::operator=(Image &&other) noexcept
 {
     // Self-assignment is allowed.
-    if (parent) {
-        parent->freePages(pages);
-    }
+    release();
 
     parent = other.parent;
     width_in_px = other.width_in_px;
@@ -40,14 +40,24 @@ Image &Image::operator=(Image &&other) noexcept
     width_in_pages = other.width_in_pages;
     height_in_pages = other.height_in_pages;
     pages = std::move(other.pages);
+    dedicated_texture = other.dedicated_texture;
     other.parent = nullptr;
     return *this;
 }
 
 Image::~Image()
+{
+    release();
+}
+
+void Image::release() noexcept
 {
     if (parent) {
-        parent->freePages(pages);
+        if (dedicated_texture >= 0) {
+            parent->freeDedicatedTexture(dedicated_texture);
+        } else {
+            parent->freePages(pages);
+        }
     }
 }
 
@@ -145,14 +155,46 @@ void Image::placePageVertices(vspan<vertex> &vertices, size_t index, aarectangle
     }
 
     ttlet atlasPosition = device_shared::getAtlasPositionFromPage(page);
-    ttlet atlasPosition_ = point3{
-        narrow_cast<float>(atlasPosition.x()), narrow_cast<float>(atlasPosition.y()), narrow_cast<float>(atlasPosition.z())};
-    ttlet atlasRect = translate3{atlasPosition_} * aarectangle{e4};
-
-    vertices.emplace_back(p1, get<0>(atlasRect), clippingRectangle);
-    vertices.emplace_back(p2, get<1>(atlasRect), clippingRectangle);
-    vertices.emplace_back(p3, get<2>(atlasRect), clippingRectangle);
-    vertices.emplace_back(p4, get<3>(atlasRect), clippingRectangle);
+    ttlet atlasRect = translate3{atlasPosition} * aarectangle{e4};
+
+    // Normalize the coordinates in the atlas texture, the z-coordinate is the index in the texture array.
+    ttlet atlasScale = scale3{1.0f / device_shared::atlasImageWidth, 1.0f / device_shared::atlasImageHeight, 1.0f};
+
+    vertices.emplace_back(p1, atlasScale * get<0>(atlasRect), clippingRectangle);
+    vertices.emplace_back(p2, atlasScale * get<1>(atlasRect), clippingRectangle);
+    vertices.emplace_back(p3, atlasScale * get<2>(atlasRect), clippingRectangle);
+    vertices.emplace_back(p4, atlasScale * get<3>(atlasRect), clippingRectangle);
+}
+
+void Image::placeDedicatedTextureVertices(vspan<vertex> &vertices, aarectangle clippingRectangle, matrix3 transform) const
+{
+    ttlet width = narrow_cast<float>(width_in_px);
+    ttlet height = narrow_cast<float>(height_in_px);
+
+    ttlet p1 = transform * point2{0.0f, 0.0f};
+    ttlet p2 = transform * point2{width, 0.0f};
+    ttlet p3 = transform * point2{0.0f, height};
+    ttlet p4 = transform * point2{width, height};
+
+    if (!(clippingRectangle.contains(point2{p1}) || clippingRectangle.contains(point2{p2}) ||
+          clippingRectangle.contains(point2{p3}) || clippingRectangle.contains(point2{p4}))) {
+        // Clipped image.
+        return;
+    }
+
+    // The image is surrounded by a border inside the dedicated texture.
+    ttlet textureWidth = width + 2.0f * Page::border;
+    ttlet textureHeight = height + 2.0f * Page::border;
+    ttlet left = Page::border / textureWidth;
+    ttlet bottom = Page::border / textureHeight;
+    ttlet right = (Page::border + width) / textureWidth;
+    ttlet top = (Page::border + height) / textureHeight;
+    ttlet z = narrow_cast<float>(dedicated_texture);
+
+    vertices.emplace_back(p1, point3{left, bottom, z}, clippingRectangle);
+    vertices.emplace_back(p2, point3{right, bottom, z}, clippingRectangle);
+    vertices.emplace_back(p3, point3{left, top, z}, clippingRectangle);
+    vertices.emplace_back(p4, point3{right, top, z}, clippingRectangle);
 }
 
 /*! Place vertices for this image.
@@ -164,6 +206,11 @@ void Image::placePageVertices(vspan<vertex> &vertices, size_t index, aarectangle
  */
 void Image::place_vertices(vspan<vertex> &vertices, aarectangle clipping_rectangle, matrix3 transform)
 {
+    if (dedicated_texture >= 0) {
+        placeDedicatedTextureVertices(vertices, clipping_rectangle, transform);
+        return;
+    }
+
     calculateVertexPositions(transform, clipping_rectangle);
 
     for (int index = 0; index < std::ssize(pages); index++) {
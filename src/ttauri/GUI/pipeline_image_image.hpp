@@ -51,8 +51,21 @@ struct Image {
 
     std::vector<Page> pages;
 
+    /** The index in the texture array of the dedicated texture of the image.
+     * -1 when the image is split into pages in the atlas.
+     */
+    ssize_t dedicated_texture;
+
     Image() noexcept :
-        parent(nullptr), width_in_px(0), height_in_px(0), width_in_pages(0), height_in_pages(0), pages() {}
+        parent(nullptr),
+        width_in_px(0),
+        height_in_px(0),
+        width_in_pages(0),
+        height_in_pages(0),
+        pages(),
+        dedicated_texture(-1)
+    {
+    }
 
     Image(
         device_shared *parent,
@@ -66,7 +79,21 @@ struct Image {
         height_in_px(height_in_px),
         width_in_pages(width_in_pages),
         height_in_pages(height_in_pages),
-        pages(std::move(pages)) {}
+        pages(std::move(pages)),
+        dedicated_texture(-1)
+    {
+    }
+
+    Image(device_shared *parent, size_t width_in_px, size_t height_in_px, ssize_t dedicated_texture) noexcept :
+        parent(parent),
+        width_in_px(width_in_px),
+        height_in_px(height_in_px),
+        width_in_pages(0),
+        height_in_pages(0),
+        pages(),
+        dedicated_texture(dedicated_texture)
+    {
+    }
 
     Image(Image &&other) noexcept;
     Image &operator=(Image &&other) noexcept;
@@ -100,6 +127,12 @@ private:
 
     void placePageVertices(vspan<vertex> &vertices, size_t index, aarectangle clippingRectangle) const;
 
+    void placeDedicatedTextureVertices(vspan<vertex> &vertices, aarectangle clippingRectangle, matrix3 transform) const;
+
+    /** Release the pages or dedicated texture back to the parent.
+     */
+    void release() noexcept;
+
 };
 
 }
@@ -18,14 +18,14 @@ void pipeline_tone_mapper::drawInCommandBuffer(vk::CommandBuffer commandBuffer)
 {
     pipeline_vulkan::drawInCommandBuffer(commandBuffer);
 
-    vulkan_device().toneMapperPipeline->drawInCommandBuffer(commandBuffer);
+    vulkan_device().tone_mapper_pipeline().drawInCommandBuffer(commandBuffer);
 
     commandBuffer.draw(3, 1, 0, 0);
 }
 
 std::vector<vk::PipelineShaderStageCreateInfo> pipeline_tone_mapper::createShaderStages() const
 {
-    return vulkan_device().toneMapperPipeline->shaderStages;
+    return vulkan_device().tone_mapper_pipeline().shaderStages;
 }
 
 std::vector<vk::DescriptorSetLayoutBinding> pipeline_tone_mapper::createDescriptorSetLayoutBindings() const
@@ -11,7 +11,12 @@
 
 namespace tt::pipeline_tone_mapper {
 
-/*! Pipeline for rendering simple flat shaded quats.
+/*! Pipeline for composing the color and SDF attachments into the swapchain image.
+ *
+ * This is the last subpass of the render pass. It reads the attachments as input
+ * attachments, which stay in tile memory on tiled GPUs. A full-window triangle is
+ * drawn, but only the pixels inside the render area and scissor, the rectangle being
+ * redrawn, are shaded; the cost scales with the redrawn area, not the window size.
  */
 class pipeline_tone_mapper : public pipeline_vulkan {
 public:
@@ -4,6 +4,7 @@
 
 #include "pipeline_vulkan.hpp"
 #include "gui_device_vulkan.hpp"
+#include "gui_window_vulkan.hpp"
 #include "../trace.hpp"
 #include <array>
 #include <vector>
@@ -26,17 +27,35 @@ gui_device_vulkan &pipeline_vulkan::vulkan_device() const noexcept
     return narrow_cast<gui_device_vulkan&>(*device);
 }
 
+size_t pipeline_vulkan::nrFramesInFlight() const noexcept
+{
+    return narrow_cast<gui_window_vulkan const &>(window).nrFramesInFlight;
+}
+
+void pipeline_vulkan::set_frame_in_flight(size_t index) noexcept
+{
+    tt_axiom(index < nrFramesInFlight());
+    frameInFlightIndex = index;
+}
+
+void pipeline_vulkan::prepareForDraw()
+{
+    buildIfNeeded();
+
+    if (descriptorSet and descriptorSetVersion < getDescriptorSetVersion()) {
+        descriptorSetVersion = getDescriptorSetVersion();
+
+        vulkan_device().updateDescriptorSets(createWriteDescriptorSet(), {});
+    }
+}
+
 void pipeline_vulkan::drawInCommandBuffer(vk::CommandBuffer commandBuffer)
 {
+    tt_axiom(intrinsic);
+
     commandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, intrinsic);
 
     if (descriptorSet) {
-        if (descriptorSetVersion < getDescriptorSetVersion()) {
-            descriptorSetVersion = getDescriptorSetVersion();
-
-            vulkan_device().updateDescriptorSets(createWriteDescriptorSet(), {});
-        }
-
         commandBuffer.bindDescriptorSets(
             vk::PipelineBindPoint::eGraphics,
             pipelineLayout, 0, {descriptorSet}, {}
@@ -256,14 +275,33 @@ void pipeline_vulkan::buildPipeline(vk::RenderPass renderPass, uint32_t renderSu
         -1 // basePipelineIndex
     };
 
-    intrinsic = vulkan_device().createGraphicsPipeline(vk::PipelineCache(), graphicsPipelineCreateInfo);
+    intrinsic = vulkan_device().createGraphicsPipeline(vulkan_device().pipelineCache, graphicsPipelineCreateInfo);
     tt_log_info("/buildPipeline new size ({}, {})", extent.width, extent.height);
 }
 
 void pipeline_vulkan::teardownPipeline()
 {
+    if (!intrinsic) {
+        return;
+    }
+
     vulkan_device().destroy(intrinsic);
     vulkan_device().destroy(pipelineLayout);
+    intrinsic = nullptr;
+    pipelineLayout = nullptr;
+}
+
+void pipeline_vulkan::buildIfNeeded()
+{
+    if (intrinsic) {
+        return;
+    }
+
+    tt_axiom(renderPassForBuild);
+    // Input attachments described by the descriptor set will change when a
+    // new swap chain is created.
+    buildDescriptorSets();
+    buildPipeline(renderPassForBuild, renderSubpassForBuild, extent);
 }
 
 
@@ -277,20 +315,23 @@ void pipeline_vulkan::buildForNewSurface()
 
 void pipeline_vulkan::buildForNewSwapchain(vk::RenderPass renderPass, uint32_t renderSubpass, vk::Extent2D _extent)
 {
+    // The vertex buffers are needed by the draw_context before the first draw.
     if (!buffersInitialized) {
         buildvertexBuffers();
         buffersInitialized = true;
     }
-    // Input attachments described by the descriptor set will change when a
-    // new swap chain is created.
-    buildDescriptorSets();
-    buildPipeline(renderPass, renderSubpass, _extent);
+
+    // The descriptor sets and pipeline are built on the first draw.
+    renderPassForBuild = renderPass;
+    renderSubpassForBuild = renderSubpass;
+    extent = _extent;
 }
 
 void pipeline_vulkan::teardownForSwapchainLost()
 {
     teardownPipeline();
     teardownDescriptorSets();
+    renderPassForBuild = nullptr;
 }
 
 void pipeline_vulkan::teardownForSurfaceLost()
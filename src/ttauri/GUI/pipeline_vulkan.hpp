@@ -26,8 +26,22 @@ public:
 
     gui_device_vulkan &vulkan_device() const noexcept;
 
+    /** Prepare the pipeline for drawing the current frame.
+     * Builds the pipeline when needed and updates its descriptor set, so that `drawInCommandBuffer()`
+     * only records commands and may be called from a worker of the thread pool.
+     */
+    virtual void prepareForDraw();
+
+    /** Bind the pipeline and its descriptor set.
+     * @pre `prepareForDraw()` was called for the current frame.
+     */
     virtual void drawInCommandBuffer(vk::CommandBuffer commandBuffer);
 
+    /** Select the resources of a frame-in-flight for the next draw.
+     * @param index The index of the frame-in-flight, less than `nrFramesInFlight()`.
+     */
+    virtual void set_frame_in_flight(size_t index) noexcept;
+
     void buildForNewDevice();
     void teardownForDeviceLost();
     void buildForNewSurface();
@@ -41,9 +55,17 @@ protected:
     vk::DescriptorSet descriptorSet;
     ssize_t descriptorSetVersion = 0;
     vk::Extent2D extent;
+    vk::RenderPass renderPassForBuild;
+    uint32_t renderSubpassForBuild = 0;
     vk::DescriptorSetLayout descriptorSetLayout;
     vk::PipelineLayout pipelineLayout;
     vk::DescriptorPool descriptorPool;
+    size_t frameInFlightIndex = 0;
+
+    /** The number of frames-in-flight of the window.
+     * The pipeline will need a separate vertex buffer for each of these frames.
+     */
+    [[nodiscard]] size_t nrFramesInFlight() const noexcept;
 
     virtual std::vector<vk::PipelineShaderStageCreateInfo> createShaderStages() const = 0;
     virtual std::vector<vk::DescriptorSetLayoutBinding> createDescriptorSetLayoutBindings() const = 0;
@@ -62,6 +84,12 @@ protected:
     virtual void teardownDescriptorSets();
     virtual void buildPipeline(vk::RenderPass renderPass, uint32_t renderSubpass, vk::Extent2D extent);
     virtual void teardownPipeline();
+
+    /** Build the descriptor sets and pipeline for the current swapchain, if they were not yet built.
+     * This is done on the first draw after a new swapchain, so that pipelines which do not
+     * draw anything in a window do not create their vulkan objects or device-shared resources.
+     */
+    void buildIfNeeded();
 };
 
 }
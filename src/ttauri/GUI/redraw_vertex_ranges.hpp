@@ -0,0 +1,114 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "dirty_rectangles.hpp"
+#include "../required.hpp"
+#include "../assert.hpp"
+#include <vector>
+#include <cstddef>
+
+namespace tt {
+
+/** The ranges of the vertices of a pipeline, with the redraw rectangles each range overlaps.
+ *
+ * The window renders each redraw rectangle in its own render pass, in which a pipeline draws
+ * only the ranges that overlap the scissor of that render pass. Consecutive draws that overlap
+ * the same redraw rectangles share a single range.
+ */
+class redraw_vertex_ranges {
+public:
+    /** When more draw calls would be needed for a redraw rectangle, the vertices from the first
+     * to the last overlapping range are drawn in a single draw call.
+     */
+    static constexpr size_t maximum_nr_draws = 32;
+
+    /** Forget the ranges of the previous frame.
+     * The memory is kept, so that the next frame does not need to allocate.
+     */
+    void clear() noexcept
+    {
+        _ranges.clear();
+    }
+
+    /** Add the vertices that were placed by a draw.
+     *
+     * @param first The index of the first vertex placed.
+     * @param last The index one beyond the last vertex placed.
+     * @param mask The redraw rectangles that overlap the clipping rectangle of the draw.
+     */
+    void add(size_t first, size_t last, dirty_rectangles::mask_type mask) noexcept
+    {
+        tt_axiom(first <= last);
+        tt_axiom(_ranges.empty() or _ranges.back().last <= first);
+
+        if (first == last or mask == 0) {
+            return;
+        } else if (not _ranges.empty() and _ranges.back().last == first and _ranges.back().mask == mask) {
+            _ranges.back().last = last;
+        } else {
+            _ranges.push_back({first, last, mask});
+        }
+    }
+
+    /** Call a function for each run of consecutive vertices that overlap a redraw rectangle.
+     *
+     * @param index The index of the redraw rectangle.
+     * @param function A function `void(size_t first, size_t size)`.
+     */
+    template<typename Function>
+    void for_each(size_t index, Function const &function) const noexcept
+    {
+        ttlet bit = dirty_rectangles::mask_type{1} << index;
+
+        ttlet for_each_run = [&](auto const &run_function) {
+            size_t first = 0;
+            size_t last = 0;
+            for (ttlet &range : _ranges) {
+                if ((range.mask & bit) == 0) {
+                    continue;
+                } else if (range.first != last) {
+                    if (first != last) {
+                        run_function(first, last);
+                    }
+                    first = range.first;
+                }
+                last = range.last;
+            }
+            if (first != last) {
+                run_function(first, last);
+            }
+        };
+
+        size_t nr_runs = 0;
+        size_t first_vertex = 0;
+        size_t last_vertex = 0;
+        for_each_run([&](size_t first, size_t last) {
+            if (nr_runs++ == 0) {
+                first_vertex = first;
+            }
+            last_vertex = last;
+        });
+
+        if (nr_runs > maximum_nr_draws) {
+            function(first_vertex, last_vertex - first_vertex);
+        } else if (nr_runs != 0) {
+            for_each_run([&](size_t first, size_t last) {
+                function(first, last - first);
+            });
+        }
+    }
+
+private:
+    struct range_type {
+        size_t first;
+        size_t last;
+        dirty_rectangles::mask_type mask;
+    };
+
+    std::vector<range_type> _ranges;
+};
+
+} // namespace tt
@@ -0,0 +1,118 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "staging_ring_buffer.hpp"
+#include "gui_device_vulkan.hpp"
+#include "../memory.hpp"
+#include "../logger.hpp"
+#include "../assert.hpp"
+
+namespace tt {
+
+staging_ring_buffer::staging_ring_buffer(gui_device_vulkan const &device, size_t capacity) : _device(device)
+{
+    vk::BufferCreateInfo const bufferCreateInfo = {
+        vk::BufferCreateFlags(), capacity, vk::BufferUsageFlagBits::eTransferSrc, vk::SharingMode::eExclusive};
+    VmaAllocationCreateInfo allocationCreateInfo = {};
+    allocationCreateInfo.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
+    std::tie(buffer, allocation) = _device.createBuffer(bufferCreateInfo, allocationCreateInfo);
+
+    _data = _device.mapMemory<std::byte>(allocation).subspan(0, capacity);
+}
+
+void staging_ring_buffer::destroy(gui_device_vulkan *vulkanDevice)
+{
+    tt_axiom(vulkanDevice);
+
+    vulkanDevice->waitForTransfer(vulkanDevice->transferTimelineValue);
+    _in_flight.clear();
+
+    vulkanDevice->unmapMemory(allocation);
+    vulkanDevice->destroyBuffer(buffer, allocation);
+}
+
+void staging_ring_buffer::reclaim() noexcept
+{
+    while (not _in_flight.empty()) {
+        ttlet &front = _in_flight.front();
+        if (not front.is_submitted || not _device.isTransferCompleted(front.transfer_value)) {
+            break;
+        }
+        _in_flight.pop_front();
+    }
+
+    if (_in_flight.empty()) {
+        _head = 0;
+    }
+}
+
+[[nodiscard]] size_t staging_ring_buffer::find_offset(size_t size, size_t alignment) const noexcept
+{
+    if (_in_flight.empty()) {
+        return size <= capacity() ? 0 : capacity();
+    }
+
+    ttlet tail = _in_flight.front().offset;
+    ttlet offset = ceil(_head, alignment);
+
+    if (tail < _head) {
+        // The regions in use are in one piece, try after it then wrap around to the start.
+        if (offset + size <= capacity()) {
+            return offset;
+        } else if (size <= tail) {
+            return 0;
+        }
+
+    } else if (_head < tail) {
+        // The regions in use wrap around, there is only room between head and tail.
+        if (offset + size <= tail) {
+            return offset;
+        }
+    }
+
+    // When head and tail are equal the ring is full.
+    return capacity();
+}
+
+[[nodiscard]] staging_ring_buffer::region staging_ring_buffer::allocate(size_t size, size_t alignment) noexcept
+{
+    tt_axiom(size > 0);
+
+    if (size > capacity()) {
+        tt_log_fatal("Staging buffer of {} bytes is too small for an upload of {} bytes.", capacity(), size);
+    }
+
+    while (true) {
+        reclaim();
+
+        if (ttlet offset = find_offset(size, alignment); offset != capacity()) {
+            _in_flight.push_back({offset, size, 0, false});
+            _head = offset + size;
+            return {offset, _data.subspan(offset, size)};
+        }
+
+        ttlet &front = _in_flight.front();
+        if (not front.is_submitted) {
+            // The ring is full with regions of the transfer that is still being recorded.
+            return {};
+        }
+
+        _device.waitForTransfer(front.transfer_value);
+    }
+}
+
+void staging_ring_buffer::flush(region const &region) const noexcept
+{
+    _device.flushAllocation(allocation, region.offset, region.bytes.size());
+}
+
+void staging_ring_buffer::submitted(uint64_t transfer_value) noexcept
+{
+    for (auto it = _in_flight.rbegin(); it != _in_flight.rend() && not it->is_submitted; ++it) {
+        it->transfer_value = transfer_value;
+        it->is_submitted = true;
+    }
+}
+
+} // namespace tt
@@ -0,0 +1,122 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../required.hpp"
+#include <vk_mem_alloc.h>
+#include <vulkan/vulkan.hpp>
+#include <deque>
+#include <span>
+#include <cstddef>
+#include <cstdint>
+
+namespace tt {
+class gui_device_vulkan;
+
+/** A ring buffer in host-visible memory for uploading to the GPU.
+ *
+ * Regions are allocated from the ring and written by the CPU, then copied by
+ * commands submitted with `gui_device_vulkan::endTransferCommands()`.
+ * A region is reused once the transfer reading from it has completed, so that
+ * several uploads can be in flight at the same time.
+ */
+class staging_ring_buffer {
+public:
+    /** A region of the staging buffer.
+     */
+    struct region {
+        /** The offset in bytes from the start of the buffer.
+         */
+        size_t offset = 0;
+
+        /** The mapped memory of the region.
+         */
+        std::span<std::byte> bytes = {};
+
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return not bytes.empty();
+        }
+    };
+
+    vk::Buffer buffer;
+    VmaAllocation allocation = {};
+
+    staging_ring_buffer(gui_device_vulkan const &device, size_t capacity);
+    ~staging_ring_buffer() = default;
+
+    staging_ring_buffer(staging_ring_buffer const &) = delete;
+    staging_ring_buffer &operator=(staging_ring_buffer const &) = delete;
+    staging_ring_buffer(staging_ring_buffer &&) = delete;
+    staging_ring_buffer &operator=(staging_ring_buffer &&) = delete;
+
+    /** Deallocate vulkan resources.
+     * This will wait for all transfers to complete.
+     */
+    void destroy(gui_device_vulkan *vulkanDevice);
+
+    [[nodiscard]] size_t capacity() const noexcept
+    {
+        return _data.size();
+    }
+
+    /** Allocate a region of the staging buffer.
+     *
+     * This will wait for transfers to complete when the ring is full.
+     *
+     * @param size The number of bytes to allocate.
+     * @param alignment The alignment of the offset of the region.
+     * @return The allocated region, or an empty region when the ring is full with regions that have not
+     *         yet been submitted. The caller should submit its transfer, call `submitted()` and try again.
+     */
+    [[nodiscard]] region allocate(size_t size, size_t alignment) noexcept;
+
+    /** Make the written region visible to the GPU.
+     */
+    void flush(region const &region) const noexcept;
+
+    /** Mark all regions allocated since the previous call as being read by a transfer.
+     *
+     * @param transfer_value The value returned by `gui_device_vulkan::endTransferCommands()`.
+     */
+    void submitted(uint64_t transfer_value) noexcept;
+
+private:
+    struct in_flight {
+        size_t offset;
+        size_t size;
+
+        /** The transfer reading the region.
+         */
+        uint64_t transfer_value;
+
+        /** Set when the transfer reading from the region was submitted.
+         */
+        bool is_submitted;
+    };
+
+    gui_device_vulkan const &_device;
+
+    std::span<std::byte> _data;
+
+    /** The offset in the ring where the next region is allocated.
+     */
+    size_t _head = 0;
+
+    /** The regions in the order they where allocated.
+     */
+    std::deque<in_flight> _in_flight;
+
+    /** Release the regions of which the transfers have completed.
+     */
+    void reclaim() noexcept;
+
+    /** Find the offset for a new region.
+     * @return The offset, or capacity() when there is no room.
+     */
+    [[nodiscard]] size_t find_offset(size_t size, size_t alignment) const noexcept;
+};
+
+} // namespace tt
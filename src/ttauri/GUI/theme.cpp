@@ -23,6 +23,15 @@ theme::theme(URL const &url)
     }
 }
 
+theme::theme(URL const &url, datum const &data)
+{
+    try {
+        parse(data);
+    } catch (std::exception const &e) {
+        throw io_error("{}: Could not load theme.\n{}", url, e.what());
+    }
+}
+
 [[nodiscard]] std::string theme::parseString(datum const &data, char const *object_name)
 {
     // Extract name
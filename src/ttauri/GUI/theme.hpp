@@ -114,6 +114,12 @@ public:
      */
     theme(URL const &url);
 
+    /** Make a theme from the parsed JSON of a theme file.
+     * @param url The location of the theme file, used for error messages.
+     * @param data The parsed theme file.
+     */
+    theme(URL const &url, datum const &data);
+
     /** Get fill color of elements of widgets and child widgets.
     * @param nestingLevel The nesting level.
     */
@@ -3,27 +3,180 @@
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #include "theme_book.hpp"
+#include "../codec/BON8.hpp"
+#include "../codec/JSON.hpp"
+#include "../file.hpp"
+#include "../file_view.hpp"
 #include "../trace.hpp"
+#include "../counters.hpp"
+#include "../strings.hpp"
+#include <filesystem>
 
 namespace tt {
 
-theme_book::theme_book(std::vector<URL> const &theme_directories) noexcept :
-    themes(), _current_theme_name(), _current_theme_mode(theme_mode::light)
+/** The version of the theme index file.
+ * Increment when the layout of the index changes.
+ */
+constexpr int64_t theme_index_version = 1;
+
+[[nodiscard]] static datum theme_index_load(URL const &location) noexcept
+{
+    try {
+        ttlet view = file_view(location);
+        view.hint(file_view_hint::sequential);
+        auto ptr = view.bytes().data();
+        ttlet last = ptr + view.size();
+        auto index = decode_BON8(ptr, last);
+
+        if (not index.is_map() or not index.contains("version") or
+            static_cast<int64_t>(index["version"]) != theme_index_version or not index.contains("themes")) {
+            tt_log_info("Theme index file has a different version, it will be replaced.");
+            return datum::map{};
+        }
+
+        auto themes = index["themes"];
+        if (not themes.is_map()) {
+            tt_log_warning("Could not parse theme index file, it will be replaced.");
+            return datum::map{};
+        }
+        return themes;
+
+    } catch (io_error const &e) {
+        tt_log_info("Could not open theme index file. \"{}\"", e.what());
+    } catch (std::exception const &e) {
+        tt_log_warning("Could not parse theme index file, it will be replaced. \"{}\"", e.what());
+    }
+    return datum::map{};
+}
+
+static void theme_index_save(URL const &location, datum const &themes) noexcept
+{
+    auto index = datum::map{};
+    index["version"] = theme_index_version;
+    index["themes"] = themes;
+
+    try {
+        ttlet bytes = encode_BON8(datum{std::move(index)});
+        auto file = tt::file(location, access_mode::truncate_or_create_for_write | access_mode::create_directories);
+        file.write(std::span<std::byte const>{bytes.data(), bytes.size()});
+        file.flush();
+
+    } catch (io_error const &e) {
+        tt_log_error("Could not save theme index file. \"{}\"", e.what());
+    }
+}
+
+/** The size and modification time of a theme file.
+ * Used to check if the entry in the theme index still matches the theme file.
+ */
+[[nodiscard]] static datum theme_index_file_stamp(URL const &url) noexcept
+{
+    auto ec = std::error_code{};
+    ttlet path = std::filesystem::path{url.nativeWPath()};
+
+    ttlet size = std::filesystem::file_size(path, ec);
+    if (ec) {
+        return {};
+    }
+
+    ttlet time = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        return {};
+    }
+
+    auto r = datum::vector{};
+    r.emplace_back(static_cast<int64_t>(size));
+    r.emplace_back(static_cast<int64_t>(time.time_since_epoch().count()));
+    return datum{std::move(r)};
+}
+
+/** Get the name and mode of a theme from its parsed theme file.
+ * @throws parse_error When the name or mode is missing or invalid.
+ */
+[[nodiscard]] static std::pair<std::string, theme_mode> theme_index_name_and_mode(datum const &data)
+{
+    if (not data.is_map() or not data.contains("name") or not data.contains("mode")) {
+        throw parse_error("Missing 'name' or 'mode'");
+    }
+
+    ttlet name = data["name"];
+    ttlet mode = data["mode"];
+    if (not name.is_string() or not mode.is_string()) {
+        throw parse_error("'name' and 'mode' attributes must be strings");
+    }
+
+    ttlet mode_name = to_lower(static_cast<std::string>(mode));
+    if (mode_name == "light") {
+        return {static_cast<std::string>(name), theme_mode::light};
+    } else if (mode_name == "dark") {
+        return {static_cast<std::string>(name), theme_mode::dark};
+    } else {
+        throw parse_error("Attribute 'mode' must be \"light\" or \"dark\", got \"{}\".", mode_name);
+    }
+}
+
+theme_book::theme_book(std::vector<URL> const &theme_directories, URL const &index_location) noexcept :
+    _entries(), _current_theme_name(), _current_theme_mode(theme_mode::light)
 {
+    ttlet old_index = theme_index_load(index_location);
+    auto new_index = datum::map{};
+    auto index_changed = false;
+
     for (ttlet &theme_directory: theme_directories) {
         ttlet theme_directory_glob = theme_directory / "**" / "*.theme.json";
         for (ttlet &theme_url: theme_directory_glob.urlsByScanningWithGlobPattern()) {
             auto t = trace<"theme_scan">{};
 
+            ttlet key = to_string(theme_url);
+            ttlet stamp = theme_index_file_stamp(theme_url);
+
+            auto data = datum{};
+            if (not stamp.is_undefined() and old_index.contains(key)) {
+                ttlet index_entry = old_index[key];
+                if (index_entry.is_map() and index_entry.contains("stamp") and index_entry.contains("data") and
+                    index_entry["stamp"] == stamp) {
+                    data = index_entry["data"];
+                }
+            }
+
+            if (not data.is_undefined()) {
+                increment_counter<"theme_index_hit">();
+                new_index[key] = old_index[key];
+
+            } else {
+                increment_counter<"theme_index_miss">();
+                index_changed = true;
+                try {
+                    tt_log_info("Parsing theme at {}", theme_url);
+                    data = parse_JSON(theme_url);
+                } catch (std::exception const &e) {
+                    tt_log_error("Failed parsing theme at {}. \"{}\"", theme_url, e.what());
+                    continue;
+                }
+
+                if (not stamp.is_undefined()) {
+                    auto index_entry = datum::map{};
+                    index_entry["stamp"] = stamp;
+                    index_entry["data"] = data;
+                    new_index[key] = datum{std::move(index_entry)};
+                }
+            }
+
             try {
-                themes.push_back(std::make_unique<theme>(theme_url));
+                auto [name, mode] = theme_index_name_and_mode(data);
+                _entries.push_back({theme_url, std::move(name), mode, std::move(data)});
             } catch (std::exception const &e) {
                 tt_log_error("Failed parsing theme at {}. \"{}\"", theme_url, e.what());
             }
         }
     }
 
-    if (std::ssize(themes) == 0) {
+    // Also rewrite the index when themes were removed from the theme directories.
+    if (index_changed or new_index.size() != old_index.size()) {
+        theme_index_save(index_location, datum{std::move(new_index)});
+    }
+
+    if (_entries.empty()) {
         tt_log_fatal("Could not parse any themes.");
     }
 
@@ -33,8 +186,8 @@ theme_book::theme_book(std::vector<URL> const &theme_directories) noexcept :
 [[nodiscard]] std::vector<std::string> theme_book::theme_names() const noexcept {
     std::vector<std::string> names;
 
-    for (ttlet &t: themes) {
-        names.push_back(t->name);
+    for (ttlet &e: _entries) {
+        names.push_back(e.name);
     }
 
     std::sort(names.begin(), names.end());
@@ -62,41 +215,65 @@ void theme_book::set_current_theme_name(std::string const &theme_name) noexcept
     update_theme();
 }
 
-void theme_book::update_theme() noexcept
+[[nodiscard]] theme_book::entry *theme_book::find_entry() noexcept
 {
-    theme *default_theme = nullptr;
-    theme *default_theme_and_mode = nullptr;
-    theme *matching_theme = nullptr;
-    theme *matching_theme_and_mode = nullptr;
-
-    for (auto &t: themes) {
-        if (t->name == _current_theme_name && t->mode == _current_theme_mode) {
-            matching_theme_and_mode = t.get();
-        } else if (t->name == _current_theme_name) {
-            matching_theme = t.get();
-        } else if (t->name == _default_theme_name && t->mode == _current_theme_mode) {
-            default_theme_and_mode = t.get();
-        } else if (t->name == _default_theme_name) {
-            default_theme = t.get();
+    entry *default_theme = nullptr;
+    entry *default_theme_and_mode = nullptr;
+    entry *matching_theme = nullptr;
+    entry *matching_theme_and_mode = nullptr;
+    entry *any_theme = nullptr;
+
+    for (auto &e: _entries) {
+        if (e.failed) {
+            continue;
+        } else if (e.name == _current_theme_name && e.mode == _current_theme_mode) {
+            matching_theme_and_mode = &e;
+        } else if (e.name == _current_theme_name) {
+            matching_theme = &e;
+        } else if (e.name == _default_theme_name && e.mode == _current_theme_mode) {
+            default_theme_and_mode = &e;
+        } else if (e.name == _default_theme_name) {
+            default_theme = &e;
+        } else if (any_theme == nullptr) {
+            any_theme = &e;
         }
     }
 
     if (matching_theme_and_mode) {
-        theme::global = matching_theme_and_mode;
+        return matching_theme_and_mode;
     } else if (matching_theme) {
-        theme::global = matching_theme;
+        return matching_theme;
     } else if (default_theme_and_mode) {
-        theme::global = default_theme_and_mode;
+        return default_theme_and_mode;
     } else if (default_theme) {
-        theme::global = default_theme;
-    } else if (std::ssize(themes) > 0) {
-        theme::global = themes[0].get();
+        return default_theme;
     } else {
-        tt_no_default();
+        return any_theme;
     }
-
-    tt_log_info("theme changed to {}, operating system mode {}", to_string(*theme::global), _current_theme_mode);
 }
 
+void theme_book::update_theme() noexcept
+{
+    while (auto e = find_entry()) {
+        if (not e->loaded_theme) {
+            auto t = trace<"theme_load">{};
+            try {
+                e->loaded_theme = std::make_unique<theme>(e->url, e->data);
+            } catch (std::exception const &ex) {
+                tt_log_error("Failed loading theme at {}. \"{}\"", e->url, ex.what());
+                e->failed = true;
+                continue;
+            }
+        }
+
+        theme::global = e->loaded_theme.get();
+        tt_log_info("theme changed to {}, operating system mode {}", to_string(*theme::global), _current_theme_mode);
+        return;
+    }
+
+    if (theme::global == nullptr) {
+        tt_log_fatal("Could not load any themes.");
+    }
+}
 
 }
@@ -15,13 +15,21 @@ namespace tt {
 
 /** theme_book keeps track of multiple themes.
  * The theme_book is instantiated during application startup
- * 
+ *
+ * The theme files are indexed by name and mode; a theme is only made when it is selected.
+ * The parsed theme files are kept in a BON8 index file, so that the JSON of a theme file is
+ * only parsed again when the file was modified.
  */
 class theme_book {
 public:
     static inline std::unique_ptr<theme_book> global;
 
-    theme_book(std::vector<URL> const &theme_directories) noexcept;
+    /** Find the themes in the theme directories.
+     *
+     * @param theme_directories The directories to search recursively for `*.theme.json` files.
+     * @param index_location The location of the theme index file.
+     */
+    theme_book(std::vector<URL> const &theme_directories, URL const &index_location) noexcept;
 
     [[nodiscard]] std::vector<std::string> theme_names() const noexcept;
 
@@ -34,7 +42,25 @@ public:
     void set_current_theme_name(std::string const &themeName) noexcept;
 
 private:
-    std::vector<std::unique_ptr<theme>> themes;
+    struct entry {
+        URL url;
+        std::string name;
+        tt::theme_mode mode;
+
+        /** The parsed theme file.
+         */
+        datum data;
+
+        /** The theme, made when it is first selected.
+         */
+        std::unique_ptr<tt::theme> loaded_theme;
+
+        /** Set when making the theme failed.
+         */
+        bool failed = false;
+    };
+
+    std::vector<entry> _entries;
     std::string _current_theme_name;
     tt::theme_mode _current_theme_mode;
 
@@ -43,6 +69,11 @@ private:
     /** Find a theme matching the current name and mode.
      */
     void update_theme() noexcept;
+
+    /** Find the entry that best matches the current name and mode.
+     * @return The entry, or nullptr when there are no themes left that could be made.
+     */
+    [[nodiscard]] entry *find_entry() noexcept;
 };
 
 }
@@ -6,6 +6,9 @@
 
 #include "../hires_utc_clock.hpp"
 #include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <stop_token>
 
 namespace tt {
 
@@ -14,12 +17,70 @@ protected:
     std::function<void(void *,hires_utc_clock::time_point)> callback;
     void *callbackData;
 
+    /** Park the vertical-sync thread until a frame is requested.
+     *
+     * The request is consumed, the next call will park again until `request_frame()` is called.
+     *
+     * @param stop_token The stop token of the vertical-sync thread.
+     * @return false when a stop was requested.
+     */
+    [[nodiscard]] bool wait_for_frame_request(std::stop_token stop_token) noexcept
+    {
+        auto lock = std::unique_lock(_frame_request_mutex);
+
+        while (not stop_token.stop_requested()) {
+            ttlet time_point = _frame_request_time_point;
+            ttlet now = hires_utc_clock::now();
+
+            if (time_point <= now) {
+                _frame_request_time_point = hires_utc_clock::time_point::max();
+                return true;
+
+            } else if (time_point == hires_utc_clock::time_point::max()) {
+                _frame_request_condition.wait(lock, stop_token, [&] {
+                    return _frame_request_time_point != hires_utc_clock::time_point::max();
+                });
+
+            } else {
+                _frame_request_condition.wait_for(lock, stop_token, time_point - now, [&] {
+                    return _frame_request_time_point < time_point;
+                });
+            }
+        }
+        return false;
+    }
+
 public:
     vertical_sync_base(std::function<void(void *,hires_utc_clock::time_point)> callback, void *callbackData) noexcept:
         callback(callback), callbackData(callbackData) {}
 
     ~vertical_sync_base() = default;
 
+    /** Request the callback to be called on a vertical-sync.
+     *
+     * Without requests the vertical-sync thread is parked, so that windows which
+     * do not change do not use the CPU to update their constraints and layout.
+     * This function may be called from any thread.
+     *
+     * @param time_point The time at or after which the frame should be rendered.
+     */
+    void request_frame(hires_utc_clock::time_point time_point = hires_utc_clock::time_point::min()) noexcept
+    {
+        ttlet lock = std::scoped_lock(_frame_request_mutex);
+        if (time_point < _frame_request_time_point) {
+            _frame_request_time_point = time_point;
+            _frame_request_condition.notify_one();
+        }
+    }
+
+private:
+    std::mutex _frame_request_mutex;
+    std::condition_variable_any _frame_request_condition;
+
+    /** The earliest time at which a frame was requested, or max() when no frame was requested.
+     * The first frame is rendered directly.
+     */
+    hires_utc_clock::time_point _frame_request_time_point = hires_utc_clock::time_point::min();
 };
 
 }
@@ -11,6 +11,7 @@
 #undef WIN32_NO_STATUS
 #include <ntstatus.h>
 #include <numeric>
+#include <algorithm>
 
 typedef UINT D3DKMT_HANDLE;
 typedef UINT D3DDDI_VIDEO_PRESENT_SOURCE_ID;
@@ -197,11 +198,41 @@ hires_utc_clock::time_point vertical_sync_win32::wait() noexcept
     return now + averageFrameDuration(now);
 }
 
+void vertical_sync_win32::recordRenderDuration(hires_utc_clock::duration renderDuration) noexcept
+{
+    renderDurationData[renderDurationDataCounter++ % renderDurationData.size()] = renderDuration;
+}
+
+hires_utc_clock::duration vertical_sync_win32::predictedRenderDuration() const noexcept
+{
+    ttlet number_of_elements = std::min(renderDurationDataCounter, renderDurationData.size());
+    ttlet last_i = renderDurationData.cbegin() + number_of_elements;
+    return *std::max_element(renderDurationData.cbegin(), last_i);
+}
+
+void vertical_sync_win32::waitForRenderStart(hires_utc_clock::time_point displayTimePoint) noexcept
+{
+    if (!framePacing.load(std::memory_order::relaxed) || renderDurationDataCounter == 0) {
+        return;
+    }
+
+    // When rendering takes longer than a frame the delay is negative, and rendering starts immediately.
+    ttlet renderStartTimePoint = displayTimePoint - predictedRenderDuration() - framePacingMargin;
+    ttlet delay = renderStartTimePoint - hires_utc_clock::now();
+    if (delay > 0ms) {
+        std::this_thread::sleep_for(delay);
+    }
+}
+
 void vertical_sync_win32::verticalSyncThread(std::stop_token stop_token) noexcept
 {
-    while (!stop_token.stop_requested()) {
+    while (wait_for_frame_request(stop_token)) {
         ttlet displayTimePoint = wait();
+        waitForRenderStart(displayTimePoint);
+
+        ttlet renderStartTimePoint = hires_utc_clock::now();
         callback(callbackData, displayTimePoint);
+        recordRenderDuration(hires_utc_clock::now() - renderStartTimePoint);
     }
 }
 
@@ -8,6 +8,7 @@
 #include <span>
 #include <thread>
 #include <array>
+#include <atomic>
 
 namespace tt {
 
@@ -30,6 +31,9 @@ class vertical_sync_win32 final : public vertical_sync_base {
     std::array<hires_utc_clock::duration,15> frameDurationData;
     size_t frameDurationDataCounter = 0;
 
+    std::array<hires_utc_clock::duration,15> renderDurationData;
+    size_t renderDurationDataCounter = 0;
+
     void openAdapter() noexcept;
     void closeAdapter() noexcept;
 
@@ -37,6 +41,20 @@ class vertical_sync_win32 final : public vertical_sync_base {
      */
     [[nodiscard]] hires_utc_clock::duration averageFrameDuration(hires_utc_clock::time_point frameTimestamp) noexcept;
 
+    /** Record how long the callback took to render a frame.
+     */
+    void recordRenderDuration(hires_utc_clock::duration renderDuration) noexcept;
+
+    /** Returns the longest of the recent render durations.
+     * The longest duration is used so that a slower frame does not miss the vertical-sync.
+     */
+    [[nodiscard]] hires_utc_clock::duration predictedRenderDuration() const noexcept;
+
+    /** Delay the start of rendering so that it finishes just before the frame is displayed.
+     * @param displayTimePoint Timestamp when the current frame will be displayed.
+     */
+    void waitForRenderStart(hires_utc_clock::time_point displayTimePoint) noexcept;
+
     /** Waits for vertical-sync
      * @return Timestamp when the current frame will be displayed.
      */
@@ -45,6 +63,19 @@ class vertical_sync_win32 final : public vertical_sync_base {
     void verticalSyncThread(std::stop_token stop_token) noexcept;
 
 public:
+    /** The time between the predicted end of rendering and the display of the frame.
+     * This absorbs the variation in render duration and the granularity of the sleep of the thread.
+     */
+    static constexpr hires_utc_clock::duration framePacingMargin = 2ms;
+
+    /** Delay the start of rendering until just before the next vertical-sync.
+     *
+     * When enabled, the callback is called as late as possible based on the duration of
+     * recent renders, so that input is sampled closer to the time the frame is displayed.
+     * When disabled, the callback is called directly after the vertical-sync.
+     */
+    std::atomic<bool> framePacing = false;
+
     vertical_sync_win32(std::function<void(void *,hires_utc_clock::time_point)> callback, void *callbackData) noexcept;
     ~vertical_sync_win32();
 };
@@ -11,6 +11,7 @@
 #include "exception.hpp"
 #include "static_resource_view.hpp"
 #include "logger.hpp"
+#include "hash.hpp"
 #include <regex>
 
 namespace tt {
@@ -37,7 +38,7 @@ URL::URL(url_parts const &parts) :
 
 size_t URL::hash() const noexcept
 {
-    return std::hash<std::string>{}(value);
+    return hash_bytes(value);
 }
 
 std::string_view URL::scheme() const noexcept
@@ -193,22 +194,34 @@ URL URL::urlByRemovingFilename() const noexcept
     return URL(parts);
 }
 
-static void urlsByRecursiveScanning(std::string const &base, glob_token_list_t const &glob, std::vector<URL> &result) noexcept
+/** Scan a directory for paths matching the glob.
+ *
+ * @param base The path of the directory.
+ * @param glob The compiled glob pattern.
+ * @param state The state of the glob after matching `base`; each entry only advances it with its own name.
+ * @param result The URLs of the matching files.
+ */
+static void urlsByRecursiveScanning(
+    std::string const &base,
+    glob_pattern const &glob,
+    glob_pattern::state_type const &state,
+    std::vector<URL> &result) noexcept
 {
     for (ttlet &filename: URL::filenamesByScanningDirectory(base)) {
         if (filename.back() == '/') {
             ttlet directory = std::string_view(filename.data(), filename.size() - 1);
-            auto recursePath = base + "/";
-            recursePath += directory;
+            auto directory_state = glob.advance(glob.advance(state, "/"), directory);
 
-            if (matchGlob(glob, recursePath) != glob_match_result_t::No) {
-                urlsByRecursiveScanning(recursePath, glob, result);
+            // Skip the whole sub-tree when no path inside it can match.
+            if (glob.result(directory_state) != glob_match_result_t::No) {
+                auto recursePath = base + "/";
+                recursePath += directory;
+                urlsByRecursiveScanning(recursePath, glob, directory_state, result);
             }
 
         } else {
-            ttlet finalPath = base + '/' + filename;
-            if (matchGlob(glob, finalPath) == glob_match_result_t::Match) {
-                result.push_back(URL::urlFromPath(finalPath));
+            if (glob.result(glob.advance(glob.advance(state, "/"), filename)) == glob_match_result_t::Match) {
+                result.push_back(URL::urlFromPath(base + '/' + filename));
             }
         }
     }
@@ -216,11 +229,11 @@ static void urlsByRecursiveScanning(std::string const &base, glob_token_list_t c
 
 std::vector<URL> URL::urlsByScanningWithGlobPattern() const noexcept
 {
-    ttlet glob = parseGlob(path());
-    ttlet basePath = basePathOfGlob(glob);
+    ttlet glob = glob_pattern(path());
+    ttlet &basePath = glob.base_path();
 
     std::vector<URL> urls;
-    urlsByRecursiveScanning(basePath, glob, urls);
+    urlsByRecursiveScanning(basePath, glob, glob.advance(glob.start(), basePath), urls);
     return urls;
 }
 
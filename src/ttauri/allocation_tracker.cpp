@@ -0,0 +1,254 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "allocation_tracker.hpp"
+#include "cast.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <new>
+
+namespace tt {
+namespace detail {
+
+/** The allocations of a thread, as read by the statistics thread.
+ * Only the owning thread writes to an entry, so it can store instead of doing an atomic add.
+ */
+struct allocation_thread_entry {
+    std::atomic<tt::thread_id> thread = 0;
+    std::atomic<int64_t> count = 0;
+    std::atomic<int64_t> bytes = 0;
+};
+
+/** The table of threads, followed by the entry shared by the threads that did not fit.
+ */
+static std::array<allocation_thread_entry, MAX_NR_ALLOCATION_THREADS + 1> allocation_thread_entries;
+static std::atomic<size_t> allocation_thread_entries_size = 0;
+
+[[nodiscard]] static allocation_thread_entry *allocation_thread_entry_claim() noexcept
+{
+    ttlet index = allocation_thread_entries_size.fetch_add(1, std::memory_order::relaxed);
+    if (index >= MAX_NR_ALLOCATION_THREADS) {
+        return &allocation_thread_entries[MAX_NR_ALLOCATION_THREADS];
+    }
+
+    auto &entry = allocation_thread_entries[index];
+    entry.thread.store(current_thread_id(), std::memory_order::release);
+    return &entry;
+}
+
+void allocation_hook(std::size_t size) noexcept
+{
+    auto &state = allocation_thread;
+    state.allocations.count += 1;
+    state.allocations.bytes += narrow_cast<int64_t>(size);
+
+    if (state.in_hook) {
+        return;
+    }
+    state.in_hook = true;
+
+    if (state.entry == nullptr) {
+        [[unlikely]] state.entry = allocation_thread_entry_claim();
+    }
+
+    if (state.entry != &allocation_thread_entries[MAX_NR_ALLOCATION_THREADS]) {
+        [[likely]] state.entry->count.store(state.allocations.count, std::memory_order::relaxed);
+        state.entry->bytes.store(state.allocations.bytes, std::memory_order::relaxed);
+    } else {
+        state.entry->count.fetch_add(1, std::memory_order::relaxed);
+        state.entry->bytes.fetch_add(narrow_cast<int64_t>(size), std::memory_order::relaxed);
+    }
+
+    if (state.tag != nullptr) {
+        state.tag->count->add(1);
+        state.tag->bytes->add(narrow_cast<int64_t>(size));
+    }
+
+    state.in_hook = false;
+}
+
+} // namespace detail
+
+[[nodiscard]] std::vector<thread_allocation_count> thread_allocations() noexcept
+{
+    ttlet size = std::min(detail::allocation_thread_entries_size.load(std::memory_order::relaxed), MAX_NR_ALLOCATION_THREADS + 1);
+
+    auto r = std::vector<thread_allocation_count>{};
+    r.reserve(size);
+    for (size_t i = 0; i != size; ++i) {
+        ttlet &entry = detail::allocation_thread_entries[i];
+        ttlet thread = entry.thread.load(std::memory_order::acquire);
+        if (thread == 0 and i != MAX_NR_ALLOCATION_THREADS) {
+            // The entry is being claimed.
+            continue;
+        }
+
+        r.push_back(
+            {thread, {entry.count.load(std::memory_order::relaxed), entry.bytes.load(std::memory_order::relaxed)}});
+    }
+    return r;
+}
+
+} // namespace tt
+
+#if TT_ALLOCATION_TRACKING
+// Replacements of the global allocation functions.
+// The aligned and nothrow versions are replaced as well, because the default implementations of
+// the standard library do not necessarily forward to the replaced `operator new(std::size_t)`.
+
+[[nodiscard]] static void *tt_tracked_malloc(std::size_t size, std::size_t alignment) noexcept
+{
+    ::tt::detail::allocation_hook(size);
+
+    if (size == 0) {
+        size = 1;
+    }
+
+#if TT_COMPILER == TT_CC_MSVC
+    return _aligned_malloc(size, alignment);
+#else
+    if (alignment <= alignof(std::max_align_t)) {
+        return std::malloc(size);
+    }
+    // aligned_alloc() requires the size to be a multiple of the alignment.
+    return std::aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+#endif
+}
+
+static void tt_tracked_free(void *ptr) noexcept
+{
+#if TT_COMPILER == TT_CC_MSVC
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+[[nodiscard]] static void *tt_tracked_new(std::size_t size, std::size_t alignment)
+{
+    while (true) {
+        if (auto ptr = tt_tracked_malloc(size, alignment)) {
+            return ptr;
+        }
+
+        if (auto handler = std::get_new_handler()) {
+            handler();
+        } else {
+            throw std::bad_alloc();
+        }
+    }
+}
+
+[[nodiscard]] static void *tt_tracked_new(std::size_t size, std::size_t alignment, std::nothrow_t const &) noexcept
+{
+    try {
+        return tt_tracked_new(size, alignment);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+constexpr std::size_t tt_default_alignment = alignof(std::max_align_t);
+
+void *operator new(std::size_t size)
+{
+    return tt_tracked_new(size, tt_default_alignment);
+}
+
+void *operator new[](std::size_t size)
+{
+    return tt_tracked_new(size, tt_default_alignment);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+    return tt_tracked_new(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return tt_tracked_new(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new(std::size_t size, std::nothrow_t const &tag) noexcept
+{
+    return tt_tracked_new(size, tt_default_alignment, tag);
+}
+
+void *operator new[](std::size_t size, std::nothrow_t const &tag) noexcept
+{
+    return tt_tracked_new(size, tt_default_alignment, tag);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment, std::nothrow_t const &tag) noexcept
+{
+    return tt_tracked_new(size, static_cast<std::size_t>(alignment), tag);
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment, std::nothrow_t const &tag) noexcept
+{
+    return tt_tracked_new(size, static_cast<std::size_t>(alignment), tag);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    tt_tracked_free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    tt_tracked_free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    tt_tracked_free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+    tt_tracked_free(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t) noexcept
+{
+    tt_tracked_free(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t) noexcept
+{
+    tt_tracked_free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t, std::align_val_t) noexcept
+{
+    tt_tracked_free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t, std::align_val_t) noexcept
+{
+    tt_tracked_free(ptr);
+}
+
+void operator delete(void *ptr, std::nothrow_t const &) noexcept
+{
+    tt_tracked_free(ptr);
+}
+
+void operator delete[](void *ptr, std::nothrow_t const &) noexcept
+{
+    tt_tracked_free(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t, std::nothrow_t const &) noexcept
+{
+    tt_tracked_free(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t, std::nothrow_t const &) noexcept
+{
+    tt_tracked_free(ptr);
+}
+#endif
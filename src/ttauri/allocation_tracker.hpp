@@ -0,0 +1,186 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file allocation_tracker.hpp
+ *
+ * Counting of heap allocations.
+ *
+ * When the library is build with the `TT_ENABLE_ALLOCATION_TRACKING` CMake option the global
+ * `operator new` is replaced with a version that counts the number of allocations and bytes:
+ *  - for each thread, reported through the statistics subsystem,
+ *  - for the innermost `trace<>` on the thread, as the counters "<tag>:allocations" and
+ *    "<tag>:allocated_bytes".
+ *
+ * Without the option the counts remain zero and `allocation_scope` always reports no allocations.
+ */
+
+#pragma once
+
+#include "counters.hpp"
+#include "fixed_string.hpp"
+#include "thread.hpp"
+#include "assert.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#ifndef TT_ALLOCATION_TRACKING
+#define TT_ALLOCATION_TRACKING 0
+#endif
+
+namespace tt {
+
+/** True when the global allocation functions are replaced to count allocations.
+ */
+constexpr bool allocation_tracking_is_enabled = TT_ALLOCATION_TRACKING != 0;
+
+/** The maximum number of threads of which allocations are reported separately.
+ * The allocations of threads beyond this number are reported together, with a thread id of zero.
+ */
+constexpr size_t MAX_NR_ALLOCATION_THREADS = 256;
+
+/** A number of allocations and the number of bytes requested by them.
+ */
+struct allocation_count {
+    int64_t count = 0;
+    int64_t bytes = 0;
+
+    [[nodiscard]] constexpr friend allocation_count operator-(allocation_count const &lhs, allocation_count const &rhs) noexcept
+    {
+        return {lhs.count - rhs.count, lhs.bytes - rhs.bytes};
+    }
+
+    [[nodiscard]] constexpr friend bool operator==(allocation_count const &lhs, allocation_count const &rhs) noexcept = default;
+};
+
+/** The allocations made by a thread since it started.
+ */
+struct thread_allocation_count {
+    tt::thread_id thread;
+    allocation_count allocations;
+};
+
+namespace detail {
+
+/** The counters to which the allocations within a trace are added.
+ */
+struct allocation_tag_counters {
+    sharded_counter *count;
+    sharded_counter *bytes;
+};
+
+struct allocation_thread_entry;
+
+/** The allocation state of a thread.
+ * This is constant-initialized, so that it can be used by `operator new` during static initialization.
+ */
+struct allocation_thread_state {
+    /** The counters of the innermost trace, or nullptr when outside of a trace.
+     */
+    allocation_tag_counters *tag = nullptr;
+
+    /** The entry of this thread in the table that is read by the statistics thread.
+     */
+    allocation_thread_entry *entry = nullptr;
+
+    /** The allocations of this thread; only accessed by this thread.
+     */
+    allocation_count allocations = {};
+
+    /** Set while the allocation hook is running, so that allocations made by the hook itself
+     * are counted but not reported recursively.
+     */
+    bool in_hook = false;
+};
+
+inline thread_local allocation_thread_state allocation_thread;
+
+/** Count an allocation by the current thread.
+ * Called by the replaced global `operator new`.
+ */
+void allocation_hook(std::size_t size) noexcept;
+
+template<basic_fixed_string Tag>
+using allocation_count_counter = counter_functor<Tag + basic_fixed_string{":allocations"}>;
+
+template<basic_fixed_string Tag>
+using allocation_bytes_counter = counter_functor<Tag + basic_fixed_string{":allocated_bytes"}>;
+
+template<basic_fixed_string Tag>
+inline allocation_tag_counters allocation_tag_counters_of = {
+    &allocation_count_counter<Tag>::counter,
+    &allocation_bytes_counter<Tag>::counter};
+
+/** Get the allocation counters of a trace tag, adding them to the counter map on first use.
+ */
+template<basic_fixed_string Tag>
+[[nodiscard]] allocation_tag_counters *allocation_tag_counters_get() noexcept
+{
+    if (not allocation_count_counter<Tag>::is_in_map.load(std::memory_order::relaxed)) {
+        [[unlikely]] allocation_count_counter<Tag>{}.add_to_map();
+        allocation_bytes_counter<Tag>{}.add_to_map();
+    }
+    return &allocation_tag_counters_of<Tag>;
+}
+
+} // namespace detail
+
+/** Get the number of allocations made by the current thread since it started.
+ */
+[[nodiscard]] inline allocation_count current_thread_allocations() noexcept
+{
+    return detail::allocation_thread.allocations;
+}
+
+/** Get the number of allocations made by each thread.
+ * The threads are listed in the order in which they first allocated memory.
+ */
+[[nodiscard]] std::vector<thread_allocation_count> thread_allocations() noexcept;
+
+/** Measure the allocations made by the current thread within a scope.
+ *
+ * ```
+ * auto scope = allocation_scope{};
+ * tt_log_info("Hello {}", 42);
+ * ASSERT_EQ(scope.allocations().count, 0);
+ * ```
+ */
+class allocation_scope {
+public:
+    allocation_scope() noexcept : _start(current_thread_allocations()) {}
+
+    /** The allocations made by the current thread since the construction of this scope.
+     */
+    [[nodiscard]] allocation_count allocations() const noexcept
+    {
+        return current_thread_allocations() - _start;
+    }
+
+private:
+    allocation_count _start;
+};
+
+/** A scope in which no allocations are expected on the current thread.
+ * The application is aborted when the current thread allocated memory by the end of the scope.
+ */
+class no_allocation_scope {
+public:
+    no_allocation_scope() noexcept = default;
+
+    ~no_allocation_scope()
+    {
+        tt_assert(_scope.allocations().count == 0, "Memory was allocated inside a no_allocation_scope.");
+    }
+
+    no_allocation_scope(no_allocation_scope const &) = delete;
+    no_allocation_scope(no_allocation_scope &&) = delete;
+    no_allocation_scope &operator=(no_allocation_scope const &) = delete;
+    no_allocation_scope &operator=(no_allocation_scope &&) = delete;
+
+private:
+    allocation_scope _scope;
+};
+
+} // namespace tt
@@ -0,0 +1,96 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/allocation_tracker.hpp"
+#include "ttauri/trace.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace tt;
+
+TEST(allocation_tracker, scope)
+{
+    if constexpr (not allocation_tracking_is_enabled) {
+        GTEST_SKIP() << "Allocation tracking is not enabled.";
+    }
+
+    auto scope = allocation_scope{};
+    ASSERT_EQ(scope.allocations().count, 0);
+
+    auto p = std::make_unique<std::array<char, 1000>>();
+    ASSERT_EQ(scope.allocations().count, 1);
+    ASSERT_GE(scope.allocations().bytes, 1000);
+
+    p = {};
+    // Deallocations are not counted.
+    ASSERT_EQ(scope.allocations().count, 1);
+}
+
+TEST(allocation_tracker, no_allocations)
+{
+    auto scope = no_allocation_scope{};
+
+    auto v = std::array<int, 16>{};
+    std::ranges::fill(v, 42);
+    ASSERT_EQ(v[15], 42);
+}
+
+TEST(allocation_tracker, thread)
+{
+    if constexpr (not allocation_tracking_is_enabled) {
+        GTEST_SKIP() << "Allocation tracking is not enabled.";
+    }
+
+    thread_id thread = 0;
+    auto t = std::thread([&thread] {
+        thread = current_thread_id();
+        auto v = std::vector<std::unique_ptr<int>>{};
+        for (int i = 0; i != 10; ++i) {
+            v.push_back(std::make_unique<int>(i));
+        }
+    });
+    t.join();
+
+    ttlet allocations = thread_allocations();
+    ttlet it = std::ranges::find(allocations, thread, &thread_allocation_count::thread);
+    ASSERT_NE(it, allocations.end());
+    ASSERT_GE(it->allocations.count, 10);
+}
+
+TEST(allocation_tracker, trace)
+{
+    if constexpr (not allocation_tracking_is_enabled) {
+        GTEST_SKIP() << "Allocation tracking is not enabled.";
+    }
+
+    // Keep the allocations alive, so that the compiler can not elide them.
+    auto v = std::vector<std::unique_ptr<int>>{};
+    v.reserve(10);
+
+    ttlet run = [&v] {
+        auto t = trace<"alloc_test_a">{};
+        v.push_back(std::make_unique<int>(1));
+        {
+            auto t2 = trace<"alloc_test_b">{};
+            v.push_back(std::make_unique<int>(2));
+            v.push_back(std::make_unique<int>(3));
+        }
+        v.push_back(std::make_unique<int>(4));
+    };
+
+    // The first use of a trace tag allocates while registering the tag.
+    run();
+    ttlet a = read_counter<"alloc_test_a:allocations">();
+    ttlet b = read_counter<"alloc_test_b:allocations">();
+
+    run();
+    v.push_back(std::make_unique<int>(5));
+    ASSERT_EQ(read_counter<"alloc_test_a:allocations">() - a, 2);
+    ASSERT_EQ(read_counter<"alloc_test_b:allocations">() - b, 2);
+}
@@ -9,8 +9,11 @@
 #include "timer.hpp"
 #include "os_detect.hpp"
 #include "trace.hpp"
+#include "startup_profiler.hpp"
 #include "thread.hpp"
 #include "metadata.hpp"
+#include "preferences.hpp"
+#include "subsystem.hpp"
 #include "text/elusive_icon.hpp"
 #include "text/ttauri_icon.hpp"
 #include "text/language.hpp"
@@ -50,8 +53,23 @@ int application::main()
         }
     }
 
+    startup_finish();
+    if (configuration.contains("startup-trace")) {
+        ttlet location = URL::urlFromCurrentWorkingDirectory() / static_cast<std::string>(configuration["startup-trace"]);
+        try {
+            startup_phases_dump(location);
+        } catch (std::exception const &e) {
+            tt_log_error("Could not write the startup trace to '{}': \"{}\"", location, e.what());
+        }
+    }
+
     auto exit_value = loop();
 
+    if (fast_exit) {
+        fast_deinit();
+        fast_shutdown_system(exit_value);
+    }
+
     deinit();
     return exit_value;
 }
@@ -65,12 +83,18 @@ void application::init()
     application::global = this;
 
     if (auto delegate_ = delegate.lock()) {
+        auto phase = startup_phase{"application_delegate::init"};
         delegate_->init(*this);
     }
 
     init_foundation();
-    init_text();
+    add_startup_resources();
+    startup_resources.start(parallel_init);
+
+    // The audio system does not depend on any of the resources. Creating the GUI system
+    // overlaps with loading the themes, which it only needs to open windows.
     init_audio();
+    init_text();
     init_gui();
 
     tt_log_info("Started application '{}'.", application_metadata().display_name);
@@ -79,6 +103,8 @@ void application::init()
 
 void application::init_foundation()
 {
+    auto phase = startup_phase{"application::init_foundation"};
+
     timer::global = std::make_unique<timer>("Maintenance Timer");
 
     main_thread_id = current_thread_id();
@@ -90,17 +116,51 @@ void application::init_foundation()
     }
 }
 
+void application::add_startup_resources()
+{
+    startup_resources.add("font_book", {}, [] {
+        font_book::global = std::make_unique<font_book>(
+            std::vector<URL>{URL::urlFromSystemfontDirectory()}, URL::urlFromApplicationDataDirectory() / "font_index.bon8");
+    });
+
+    startup_resources.add("icon_fonts", {"font_book"}, [] {
+        elusive_icons_font_id = font_book::global->register_font(URL("resource:elusiveicons-webfont.ttf"));
+        ttauri_icons_font_id = font_book::global->register_font(URL("resource:ttauri_icons.ttf"));
+    });
+
+    startup_resources.add("preferred_languages", {}, [] {
+        language::set_preferred_languages(language::read_os_preferred_languages());
+    });
+
+    if (auto delegate_ = delegate.lock()) {
+        if (!delegate_->gui_system_delegate(*this).expired()) {
+            // The themes need the fonts.
+            startup_resources.add("theme_book", {"font_book"}, [] {
+                theme_book::global = std::make_unique<theme_book>(
+                    std::vector<URL>{URL::urlFromResourceDirectory() / "themes"},
+                    URL::urlFromApplicationDataDirectory() / "theme_index.bon8");
+                theme_book::global->set_current_theme_mode(read_os_theme_mode());
+            });
+
+            startup_resources.add("keyboard_bindings", {}, [] {
+                keyboardBindings.loadSystemBindings();
+            });
+        }
+    }
+}
+
 void application::init_text()
 {
-    font_book::global = std::make_unique<font_book>(std::vector<URL>{URL::urlFromSystemfontDirectory()});
-    elusive_icons_font_id = font_book::global->register_font(URL("resource:elusiveicons-webfont.ttf"));
-    ttauri_icons_font_id = font_book::global->register_font(URL("resource:ttauri_icons.ttf"));
+    auto phase = startup_phase{"application::init_text"};
 
-    language::set_preferred_languages(language::read_os_preferred_languages());
+    startup_resources.wait("icon_fonts");
+    startup_resources.wait("preferred_languages");
 }
 
 void application::init_audio()
 {
+    auto phase = startup_phase{"application::init_audio"};
+
     if (auto delegate_ = delegate.lock()) {
         ttlet audio_system_delegate = delegate_->audio_system_delegate(narrow_cast<application &>(*this));
         if (!audio_system_delegate.expired()) {
@@ -112,22 +172,26 @@ void application::init_audio()
 
 void application::init_gui()
 {
+    auto phase = startup_phase{"application::init_gui"};
+
     if (auto delegate_ = delegate.lock()) {
         ttlet gui_delegate = delegate_->gui_system_delegate(narrow_cast<application &>(*this));
         if (!gui_delegate.expired()) {
             RenderDoc::global = std::make_unique<RenderDoc>();
 
-            theme_book::global = std::make_unique<theme_book>(std::vector<URL>{URL::urlFromResourceDirectory() / "themes"});
-            theme_book::global->set_current_theme_mode(read_os_theme_mode());
+            {
+                auto gui_system_phase = startup_phase{"gui_system::init"};
+                gui_system::global = std::make_unique<gui_system_vulkan_win32>(gui_delegate, instance);
+                gui_system::global->init();
+            }
 
+            // The first window needs the themes and the keyboard bindings.
+            startup_resources.wait("theme_book");
             try {
-                keyboardBindings.loadSystemBindings();
+                startup_resources.wait("keyboard_bindings");
             } catch (std::exception const &e) {
                 tt_log_fatal("Could not load keyboard bindings. \"{}\"", e.what());
             }
-
-            gui_system::global = std::make_unique<gui_system_vulkan_win32>(gui_delegate, instance);
-            gui_system::global->init();
         }
     }
 }
@@ -136,6 +200,13 @@ void application::deinit()
 {
     tt_log_info("Stopping application.");
 
+    // The loads that the delegate did not wait for may still be running.
+    try {
+        startup_resources.wait_all();
+    } catch (std::exception const &e) {
+        tt_log_error("Could not load a startup resource. \"{}\"", e.what());
+    }
+
     deinit_gui();
     deinit_audio();
     deinit_text();
@@ -150,6 +221,20 @@ void application::deinit()
     application::global = nullptr;
 }
 
+void application::fast_deinit()
+{
+    tt_log_info("Stopping application, fast exit.");
+
+    // The timer calls the callbacks of the preferences and the logger.
+    timer::global->stop();
+
+    if (auto delegate_ = delegate.lock()) {
+        delegate_->deinit(*this);
+    }
+
+    preferences::flush_all();
+}
+
 void application::deinit_foundation()
 {
     // Force all timers to finish.
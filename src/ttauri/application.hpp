@@ -8,6 +8,7 @@
 #include "required.hpp"
 #include "timer.hpp"
 #include "datum.hpp"
+#include "startup_graph.hpp"
 #include "GUI/gui_window_size.hpp"
 #include <span>
 #include <memory>
@@ -46,9 +47,33 @@ public:
     gui_window_size initial_window_size = gui_window_size::normal;
 
     /** The global configuration.
+     * - "log-level": The minimum level of messages to log.
+     * - "startup-trace": The path of a file to write the phases of the startup to,
+     *   in the Chrome Trace Event format.
     */
     datum configuration;
 
+    /** Load the startup resources in parallel.
+     * The `startup_resources` are loaded on the thread pool while the audio and GUI systems
+     * are initialized on the main thread; each system waits only for the resources it needs.
+     * This may be set by the delegate's `init()`.
+     */
+    bool parallel_init = false;
+
+    /** Exit the application quickly.
+     * When the main loop exits only the durable state is flushed: the preferences and the log.
+     * The GUI, audio and text systems are not destroyed and the process exits from `main()`,
+     * leaving the memory, GPU objects and caches for the operating system to reclaim.
+     * This may be set by the delegate at any time before the main loop exits.
+     */
+    bool fast_exit = false;
+
+    /** The resources that are loaded at startup: fonts, languages, themes and keyboard bindings.
+     * The delegate's `init()` may add its own loads, which are started together with those of
+     * the application, and wait for them in its `main()`.
+     */
+    startup_graph startup_resources;
+
     /** Thread id of the main thread.
     */
     thread_id main_thread_id;
@@ -71,6 +96,8 @@ public:
     );
 
     /** Start the application.
+     * When `fast_exit` is set this function does not return, instead the process exits
+     * after the subsystems are shutdown.
      */
     virtual int main();
 
@@ -97,12 +124,23 @@ protected:
      */
     virtual void deinit();
 
+    /** Destruction for a fast exit.
+     * Stops the timers, calls the delegate's `deinit()` and flushes the preferences,
+     * the systems are left running until the process exits.
+     */
+    virtual void fast_deinit();
+
     /*! Run the operating system's main loop.
      * Must be called after init().
      */
     virtual int loop() = 0;
 
     virtual void init_foundation();
+
+    /** Add the loads of the application to `startup_resources`.
+     */
+    virtual void add_startup_resources();
+
     virtual void deinit_foundation();
     virtual void init_audio();
     virtual void deinit_audio();
@@ -4,6 +4,7 @@
 #include "application_win32.hpp"
 #include "audio/audio_system_aggregate.hpp"
 #include "audio/audio_system_win32.hpp"
+#include "audio/audio_system_asio.hpp"
 #include "strings.hpp"
 #include "timer.hpp"
 #include <thread>
@@ -24,11 +25,29 @@ void application_win32::run_from_main_loop(std::function<void()> function)
 {
     tt_assert(inLoop);
 
-    ttlet functionP = new std::function<void()>(std::move(function));
-    tt_assert(functionP);
+    if (!main_loop_functions.try_add(std::move(function))) {
+        // The fifo is full, the main thread may be waiting on itself; post the function on its own.
+        ttlet functionP = new std::function<void()>(std::move(function));
+        tt_assert(functionP);
 
-    auto r = PostThreadMessageW(main_thread_id, WM_APP_CALL_FUNCTION, 0, reinterpret_cast<LPARAM>(functionP));
-    tt_assert(r != 0);
+        auto r = PostThreadMessageW(main_thread_id, WM_APP_CALL_FUNCTION, 0, reinterpret_cast<LPARAM>(functionP));
+        tt_assert(r != 0);
+        return;
+    }
+
+    // Only post a message when the main loop has not yet been woken up.
+    if (!main_loop_wakeup_pending.exchange(true, std::memory_order::acq_rel)) {
+        auto r = PostThreadMessageW(main_thread_id, WM_APP_CALL_FUNCTIONS, 0, 0);
+        tt_assert(r != 0);
+    }
+}
+
+void application_win32::run_main_loop_functions()
+{
+    // Clear the flag before running, so that a function added during the run posts a new message.
+    // This is a read-modify-write, so that the fifo is read after the flag is cleared.
+    main_loop_wakeup_pending.exchange(false, std::memory_order::acq_rel);
+    while (main_loop_functions.run_all() != 0) {}
 }
 
 static BOOL CALLBACK win32_windows_EnumThreadWndProc(_In_ HWND hwnd, _In_ LPARAM lParam) noexcept
@@ -98,11 +117,16 @@ int application_win32::loop()
     while (GetMessage(&msg, nullptr, 0, 0)) {
         switch (msg.message) {
         case WM_APP_CALL_FUNCTION: {
+            // This function was posted when the fifo was full, run the functions before it first.
+            run_main_loop_functions();
+
             ttlet functionP = reinterpret_cast<std::function<void()> *>(msg.lParam);
             (*functionP)();
             delete functionP;
         } break;
 
+        case WM_APP_CALL_FUNCTIONS: run_main_loop_functions(); break;
+
         case WM_QUIT:
             exit_code = narrow_cast<int>(msg.wParam);
             break;
@@ -123,6 +147,7 @@ void application_win32::init_audio()
     if (audio_system::global) {
         auto audio_system = std::dynamic_pointer_cast<audio_system_aggregate>(audio_system::global);
         audio_system->make_audio_system<audio_system_win32>();
+        audio_system->make_audio_system<audio_system_asio>();
     }
 }
 
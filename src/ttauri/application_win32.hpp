@@ -4,6 +4,8 @@
 #pragma once
 
 #include "application.hpp"
+#include "function_fifo.hpp"
+#include <atomic>
 #include <thread>
 
 namespace tt {
@@ -12,6 +14,7 @@ namespace tt {
 // WM_APP = 0x8000-0xbfff.
 constexpr unsigned int WM_WIN_LANGUAGE_CHANGE = 0x8000 - 1;
 constexpr unsigned int WM_APP_CALL_FUNCTION = 0x8000 + 1;
+constexpr unsigned int WM_APP_CALL_FUNCTIONS = 0x8000 + 2;
 
 class application_win32 final : public application {
 public:
@@ -48,6 +51,19 @@ public:
 protected:
     typename timer::callback_ptr_type languages_maintenance_callback;
 
+    /** Functions to run from the main loop.
+     */
+    function_fifo<> main_loop_functions;
+
+    /** Set when a WM_APP_CALL_FUNCTIONS message was posted and the main loop has not yet started
+     * running the functions; so that a burst of functions is woken up by a single message.
+     */
+    std::atomic<bool> main_loop_wakeup_pending = false;
+
+    /** Run the functions from main_loop_functions.
+     */
+    void run_main_loop_functions();
+
     void init_audio() override;
 };
 
@@ -0,0 +1,192 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "audio_block.hpp"
+#include "../required.hpp"
+#include "../assert.hpp"
+#include "../memory.hpp"
+#include "../cast.hpp"
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <bit>
+
+namespace tt {
+
+/** A single-producer, single-consumer ring of audio blocks.
+ *
+ * The ring is used to hand audio blocks from the real-time thread of an audio stream to a
+ * consumer such as a meter widget or a disk writer. All the sample memory is allocated
+ * when the ring is constructed, `push()` copies the samples into the next slot without
+ * locking or allocating. To fan-out to multiple consumers the producer pushes into a ring
+ * for each consumer.
+ *
+ * The samples of each slot are aligned to `samples_per_vector` floats, the same guarantee
+ * as given by the blocks of an audio device.
+ */
+class audio_block_ring {
+public:
+    /** The alignment of the samples of each block, in bytes.
+     */
+    static constexpr size_t alignment = audio_block::samples_per_vector * sizeof(float);
+
+    /** Construct a ring.
+     *
+     * @param capacity The minimum number of blocks in the ring; rounded up to a power of two.
+     * @param number_of_channels The number of channels of each block.
+     * @param number_of_vectors The number of vectors of samples of each channel of a block.
+     */
+    audio_block_ring(size_t capacity, ssize_t number_of_channels, ssize_t number_of_vectors) noexcept :
+        _capacity(std::bit_ceil(std::max(capacity, 1_uz))),
+        _number_of_channels(number_of_channels),
+        _number_of_vectors(number_of_vectors),
+        _samples_per_block(narrow_cast<size_t>(number_of_channels * number_of_vectors * audio_block::samples_per_vector)),
+        _blocks(_capacity)
+    {
+        tt_axiom(number_of_channels >= 0);
+        tt_axiom(number_of_vectors >= 0);
+
+        // Each block is a whole number of vectors, so only the start of the storage needs to be aligned.
+        _storage.resize(_capacity * _samples_per_block + audio_block::samples_per_vector);
+        auto *samples = ceil(_storage.data(), alignment);
+        for (auto &block : _blocks) {
+            block.number_of_vectors = number_of_vectors;
+            block.number_of_channels = number_of_channels;
+            block.samples = std::span{samples, _samples_per_block};
+            samples += _samples_per_block;
+        }
+    }
+
+    audio_block_ring(audio_block_ring const &) = delete;
+    audio_block_ring(audio_block_ring &&) = delete;
+    audio_block_ring &operator=(audio_block_ring const &) = delete;
+    audio_block_ring &operator=(audio_block_ring &&) = delete;
+
+    [[nodiscard]] size_t capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    /** Check if there are no blocks available.
+     * May only be called by the consumer; this does not count as an underrun.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _head.load(std::memory_order::acquire) == _tail.load(std::memory_order::relaxed);
+    }
+
+    /** Copy a block into the ring.
+     * May only be called by the producer.
+     *
+     * @param block A block with the number of channels and vectors of the ring.
+     * @return True when the block was copied; false when the ring was full and the block was dropped,
+     *         which is counted as an overrun.
+     */
+    bool push(audio_block const &block) noexcept
+    {
+        tt_axiom(block.number_of_channels == _number_of_channels);
+        tt_axiom(block.number_of_vectors == _number_of_vectors);
+
+        ttlet head = _head.load(std::memory_order::relaxed);
+        if (head - _tail_cache == _capacity) {
+            _tail_cache = _tail.load(std::memory_order::acquire);
+            if (head - _tail_cache == _capacity) {
+                [[unlikely]] _overrun_count.fetch_add(1, std::memory_order::relaxed);
+                return false;
+            }
+        }
+
+        auto &slot = _blocks[head % _capacity];
+        ttlet samples = slot.samples.data();
+        slot = block;
+
+        // The samples of a silent or corrupt block are empty, the span keeps pointing to the slot's storage.
+        if (block.samples.empty()) {
+            slot.samples = {samples, 0_uz};
+        } else {
+            tt_axiom(block.samples.size() == _samples_per_block);
+            std::copy(block.samples.begin(), block.samples.end(), samples);
+            slot.samples = {samples, _samples_per_block};
+        }
+
+        _head.store(head + 1, std::memory_order::release);
+        return true;
+    }
+
+    /** Get the oldest block in the ring.
+     * May only be called by the consumer. The block remains valid until `pop()`.
+     *
+     * @return The oldest block, or nullptr when the ring is empty; which is counted as an underrun.
+     */
+    [[nodiscard]] audio_block const *front() noexcept
+    {
+        ttlet tail = _tail.load(std::memory_order::relaxed);
+        if (tail == _head_cache) {
+            _head_cache = _head.load(std::memory_order::acquire);
+            if (tail == _head_cache) {
+                [[unlikely]] _underrun_count.fetch_add(1, std::memory_order::relaxed);
+                return nullptr;
+            }
+        }
+
+        return &_blocks[tail % _capacity];
+    }
+
+    /** Release the oldest block back to the producer.
+     * May only be called by the consumer, after `front()` returned a block.
+     */
+    void pop() noexcept
+    {
+        ttlet tail = _tail.load(std::memory_order::relaxed);
+        tt_axiom(tail != _head_cache);
+        _tail.store(tail + 1, std::memory_order::release);
+    }
+
+    /** The number of blocks that were dropped because the ring was full.
+     */
+    [[nodiscard]] uint64_t overrun_count() const noexcept
+    {
+        return _overrun_count.load(std::memory_order::relaxed);
+    }
+
+    /** The number of times the consumer asked for a block when the ring was empty.
+     */
+    [[nodiscard]] uint64_t underrun_count() const noexcept
+    {
+        return _underrun_count.load(std::memory_order::relaxed);
+    }
+
+private:
+    size_t _capacity;
+    ssize_t _number_of_channels;
+    ssize_t _number_of_vectors;
+    size_t _samples_per_block;
+
+    std::vector<float> _storage;
+    std::vector<audio_block> _blocks;
+
+    /** The index of the next block to write, owned by the producer.
+     * Head and tail are extremely large integers; they will never wrap around.
+     */
+    alignas(hardware_destructive_interference_size) std::atomic<size_t> _head = 0;
+
+    /** The producer's copy of the tail, only refreshed when the ring looks full.
+     */
+    size_t _tail_cache = 0;
+
+    /** The index of the next block to read, owned by the consumer.
+     */
+    alignas(hardware_destructive_interference_size) std::atomic<size_t> _tail = 0;
+
+    /** The consumer's copy of the head, only refreshed when the ring looks empty.
+     */
+    size_t _head_cache = 0;
+
+    alignas(hardware_destructive_interference_size) std::atomic<uint64_t> _overrun_count = 0;
+    std::atomic<uint64_t> _underrun_count = 0;
+};
+
+} // namespace tt
@@ -0,0 +1,141 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/audio/audio_block_ring.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace tt;
+
+static audio_block make_block(std::vector<float> &samples, ssize_t number_of_channels, ssize_t number_of_vectors, float value)
+{
+    samples.assign(number_of_channels * number_of_vectors * audio_block::samples_per_vector, value);
+
+    auto r = audio_block{};
+    r.number_of_channels = number_of_channels;
+    r.number_of_vectors = number_of_vectors;
+    r.samples = samples;
+    r.sample_position = static_cast<uint64_t>(value);
+    return r;
+}
+
+TEST(AudioBlockRing, PushPop)
+{
+    auto ring = audio_block_ring(3, 2, 4);
+    ASSERT_EQ(ring.capacity(), 4);
+    ASSERT_TRUE(ring.empty());
+
+    auto samples = std::vector<float>{};
+    ASSERT_TRUE(ring.push(make_block(samples, 2, 4, 1.0f)));
+    ASSERT_TRUE(ring.push(make_block(samples, 2, 4, 2.0f)));
+    ASSERT_FALSE(ring.empty());
+
+    auto block = ring.front();
+    ASSERT_NE(block, nullptr);
+    ASSERT_EQ(block->sample_position, 1);
+    ASSERT_EQ(block->samples.size(), 2 * 4 * audio_block::samples_per_vector);
+    ASSERT_EQ(block->samples.back(), 1.0f);
+    ring.pop();
+
+    block = ring.front();
+    ASSERT_NE(block, nullptr);
+    ASSERT_EQ(block->sample_position, 2);
+    ASSERT_EQ(block->samples.front(), 2.0f);
+    ring.pop();
+
+    ASSERT_TRUE(ring.empty());
+    ASSERT_EQ(ring.underrun_count(), 0);
+    ASSERT_EQ(ring.overrun_count(), 0);
+}
+
+TEST(AudioBlockRing, Alignment)
+{
+    auto ring = audio_block_ring(4, 3, 1);
+    auto samples = std::vector<float>{};
+
+    for (auto i = 0; i != 4; ++i) {
+        ASSERT_TRUE(ring.push(make_block(samples, 3, 1, 0.0f)));
+        ttlet block = ring.front();
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(block->samples.data()) % audio_block_ring::alignment, 0);
+        ring.pop();
+    }
+}
+
+TEST(AudioBlockRing, OverrunUnderrun)
+{
+    auto ring = audio_block_ring(2, 1, 1);
+    auto samples = std::vector<float>{};
+
+    ASSERT_EQ(ring.front(), nullptr);
+    ASSERT_EQ(ring.underrun_count(), 1);
+
+    ASSERT_TRUE(ring.push(make_block(samples, 1, 1, 1.0f)));
+    ASSERT_TRUE(ring.push(make_block(samples, 1, 1, 2.0f)));
+    ASSERT_FALSE(ring.push(make_block(samples, 1, 1, 3.0f)));
+    ASSERT_EQ(ring.overrun_count(), 1);
+
+    // The dropped block is not in the ring.
+    ASSERT_EQ(ring.front()->sample_position, 1);
+    ring.pop();
+    ASSERT_EQ(ring.front()->sample_position, 2);
+    ring.pop();
+    ASSERT_EQ(ring.front(), nullptr);
+    ASSERT_EQ(ring.underrun_count(), 2);
+}
+
+TEST(AudioBlockRing, SilentBlock)
+{
+    auto ring = audio_block_ring(2, 2, 1);
+
+    auto block = audio_block{};
+    block.number_of_channels = 2;
+    block.number_of_vectors = 1;
+    block.silent = true;
+    ASSERT_TRUE(ring.push(block));
+
+    ASSERT_TRUE(ring.front()->silent);
+    ASSERT_TRUE(ring.front()->samples.empty());
+    ring.pop();
+
+    // A slot that held a silent block can hold samples again.
+    auto samples = std::vector<float>{};
+    ASSERT_TRUE(ring.push(make_block(samples, 2, 1, 5.0f)));
+    ASSERT_TRUE(ring.push(make_block(samples, 2, 1, 6.0f)));
+    ASSERT_EQ(ring.front()->samples.size(), 2 * audio_block::samples_per_vector);
+    ASSERT_EQ(ring.front()->samples.front(), 5.0f);
+}
+
+TEST(AudioBlockRing, Threaded)
+{
+    constexpr auto number_of_blocks = 10'000;
+    auto ring = audio_block_ring(8, 2, 2);
+
+    auto producer = std::thread([&ring] {
+        auto samples = std::vector<float>{};
+        for (auto i = 0; i != number_of_blocks; ++i) {
+            ttlet block = make_block(samples, 2, 2, static_cast<float>(i));
+            while (not ring.push(block)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    for (auto i = 0; i != number_of_blocks; ++i) {
+        while (ring.empty()) {
+            std::this_thread::yield();
+        }
+
+        ttlet block = ring.front();
+        ASSERT_EQ(block->sample_position, static_cast<uint64_t>(i));
+        for (ttlet sample : block->samples) {
+            ASSERT_EQ(sample, static_cast<float>(i));
+        }
+        ring.pop();
+    }
+
+    producer.join();
+    ASSERT_EQ(ring.underrun_count(), 0);
+}
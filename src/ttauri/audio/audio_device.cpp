@@ -1,9 +1,59 @@
+// Copyright Take Vos 2019-2020.
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #include "audio_device.hpp"
+#include "../counters.hpp"
+#include <cmath>
 
 namespace tt {
 
+[[nodiscard]] audio_stream_statistics audio_device::stream_statistics() const noexcept
+{
+    return {
+        _measured_sample_rate.load(std::memory_order::relaxed),
+        _measured_drift_ppm.load(std::memory_order::relaxed),
+        _xruns.load(std::memory_order::relaxed)};
+}
+
+void audio_device::reset_stream_statistics(double sample_rate) noexcept
+{
+    _drift_estimator.reset(sample_rate);
+    _measured_sample_rate.store(sample_rate, std::memory_order::relaxed);
+    _measured_drift_ppm.store(0.0, std::memory_order::relaxed);
+    _xruns.store(0, std::memory_order::relaxed);
+    _restart_drift_estimator.store(false, std::memory_order::relaxed);
+
+    // The counter is the sum of the drift of the running streams.
+    add_to_counter<"audio_clock_drift_ppb">(-std::exchange(_published_drift_ppb, 0));
+}
+
+void audio_device::measure_block(audio_block const &block) noexcept
+{
+    if (_restart_drift_estimator.exchange(false, std::memory_order::relaxed)) {
+        _drift_estimator.restart();
+    }
 
+    if (not _drift_estimator.update(block)) {
+        _xruns.fetch_add(1, std::memory_order::relaxed);
+        increment_counter<"audio_xrun">();
+    }
+
+    ttlet drift_ppm = _drift_estimator.drift_ppm();
+    _measured_sample_rate.store(_drift_estimator.sample_rate(), std::memory_order::relaxed);
+    _measured_drift_ppm.store(drift_ppm, std::memory_order::relaxed);
+
+    ttlet drift_ppb = static_cast<int64_t>(std::round(drift_ppm * 1000.0));
+    if (drift_ppb != _published_drift_ppb) {
+        add_to_counter<"audio_clock_drift_ppb">(drift_ppb - std::exchange(_published_drift_ppb, drift_ppb));
+    }
 }
+
+void audio_device::count_xrun() noexcept
+{
+    _xruns.fetch_add(1, std::memory_order::relaxed);
+    increment_counter<"audio_xrun">();
+    _restart_drift_estimator.store(true, std::memory_order::relaxed);
+}
+
+} // namespace tt
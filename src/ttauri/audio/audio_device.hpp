@@ -7,10 +7,12 @@
 #include "../bigint.hpp"
 #include "audio_device_delegate.hpp"
 #include "audio_stream_config.hpp"
+#include "audio_measurement.hpp"
 #include "../label.hpp"
 #include <string>
 #include <memory>
 #include <ostream>
+#include <atomic>
 
 namespace tt {
 
@@ -48,6 +50,22 @@ inline std::ostream &operator<<(std::ostream &lhs, audio_device_state const &rhs
     return lhs << to_const_string(rhs);
 }
 
+/** Measurements of a running audio stream.
+ */
+struct audio_stream_statistics {
+    /** The sample rate of the device, measured against `hires_utc_clock`.
+     */
+    double sample_rate = 0.0;
+
+    /** The drift of the device's clock against `hires_utc_clock`, in parts per million.
+     */
+    double drift_ppm = 0.0;
+
+    /** The number of times samples were lost since the stream started.
+    */
+    size_t xruns = 0;
+};
+
 /** A set of audio channels which can be rendered and/or captures at the same time.
  * On win32 this would be Audio Endpoint gui_device, which can either render or capture
  * but not at the same time.
@@ -83,6 +101,26 @@ public:
 
     virtual audio_device_flow_direction direction() const noexcept = 0;
 
+    /** Start streaming audio.
+     * Blocks of samples are exchanged with the delegate's `process_audio()`
+     * from a dedicated real-time thread, until the stream is stopped.
+     *
+     * @param delegate The delegate which processes the audio; the stream is silent when it is gone.
+     * @param config Configuration such as the sample rate and the block size.
+     * @throw io_error When the device does not support the configuration.
+     */
+    virtual void start_stream(std::weak_ptr<audio_device_delegate> delegate, audio_stream_config const &config) = 0;
+
+    /** Stop streaming audio.
+     * After this function returns the delegate is no longer called.
+     */
+    virtual void stop_stream() noexcept = 0;
+
+    /** Get the measurements of the current or last stream.
+     * This may be called from any thread.
+     */
+    [[nodiscard]] audio_stream_statistics stream_statistics() const noexcept;
+
     /** Check if a audio configuration is supported by this device.
      * @param config Configuration such as sample rate, sample format and bit-depth.
      */
@@ -111,8 +149,38 @@ public:
      */
     //virtual void stopSession() noexcept = 0;
 
+protected:
+    /** Reset the measurements, when a stream is started.
+     */
+    void reset_stream_statistics(double sample_rate) noexcept;
+
+    /** Measure the timing of a block.
+     * Called from the stream thread for each block, before it is passed to the delegate.
+     * A block that does not follow the previous blocks in time is counted as an xrun.
+     */
+    void measure_block(audio_block const &block) noexcept;
+
+    /** Count that samples were lost by the device, the driver or because the stream thread was late.
+     * This is for xruns reported by the device; the measurement of the drift restarts at the next block.
+     * May be called from any thread.
+     */
+    void count_xrun() noexcept;
+
 private:
     std::shared_ptr<audio_device_delegate> delegate = {};
+
+    /** Only used from the stream thread.
+     */
+    audio_clock_drift_estimator _drift_estimator;
+
+    /** The drift that was added to the `audio_clock_drift_ppb` counter by this device.
+     */
+    int64_t _published_drift_ppb = 0;
+
+    std::atomic<double> _measured_sample_rate = 0.0;
+    std::atomic<double> _measured_drift_ppm = 0.0;
+    std::atomic<size_t> _xruns = 0;
+    std::atomic<bool> _restart_drift_estimator = false;
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,588 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "audio_device_asio.hpp"
+#include "../logger.hpp"
+#include "../strings.hpp"
+#include "../exception.hpp"
+#include "../counters.hpp"
+#include "../cast.hpp"
+#include <Windows.h>
+#include <combaseapi.h>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+
+namespace tt {
+
+/** ASIO return codes.
+ */
+enum asio_error : long {
+    asio_ok = 0,
+    asio_success = 0x3f4847a0,
+    asio_not_present = -1000,
+    asio_hw_malfunction = -999,
+    asio_invalid_parameter = -998,
+    asio_invalid_mode = -997,
+    asio_sp_not_advancing = -996,
+    asio_no_clock = -995,
+    asio_no_memory = -994
+};
+
+/** The formats of the samples in the buffers of an ASIO driver.
+ * Only the little endian formats are used on Windows.
+ */
+enum asio_sample_type : long {
+    asio_int16_lsb = 16,
+    asio_int24_lsb = 17,
+    asio_int32_lsb = 18,
+    asio_float32_lsb = 19,
+    asio_float64_lsb = 20,
+    asio_int32_lsb16 = 24,
+    asio_int32_lsb18 = 25,
+    asio_int32_lsb20 = 26,
+    asio_int32_lsb24 = 27
+};
+
+/** The selectors of the messages a driver sends to the host.
+ */
+enum asio_message_selector : long {
+    asio_selector_supported = 1,
+    asio_engine_version = 2,
+    asio_reset_request = 3,
+    asio_buffer_size_change = 4,
+    asio_resync_request = 5,
+    asio_latencies_changed = 6,
+    asio_supports_time_info = 7,
+    asio_supports_time_code = 8,
+    asio_overload = 15
+};
+
+struct asio_buffer_info {
+    long is_input;
+    long channel_nr;
+    void *buffers[2];
+};
+
+struct asio_channel_info {
+    long channel_nr;
+    long is_input;
+    long is_active;
+    long channel_group;
+    long sample_type;
+    char name[32];
+};
+
+struct asio_callbacks {
+    void (*buffer_switch)(long buffer_index, long direct_process);
+    void (*sample_rate_did_change)(double sample_rate);
+    long (*asio_message)(long selector, long value, void *message, double *opt);
+    void *(*buffer_switch_time_info)(void *params, long buffer_index, long direct_process);
+};
+
+/** The interface of an ASIO driver.
+ * An ASIO driver is an in-process COM object, which uses the CLSID of the driver as interface id.
+ * The methods use the default calling convention for member functions, not `STDMETHODCALLTYPE`.
+ */
+struct asio_driver : public IUnknown {
+    virtual long init(void *system_handle) = 0;
+    virtual void get_driver_name(char *name) = 0;
+    virtual long get_driver_version() = 0;
+    virtual void get_error_message(char *message) = 0;
+    virtual long start() = 0;
+    virtual long stop() = 0;
+    virtual long get_channels(long *number_of_inputs, long *number_of_outputs) = 0;
+    virtual long get_latencies(long *input_latency, long *output_latency) = 0;
+    virtual long get_buffer_size(long *minimum_size, long *maximum_size, long *preferred_size, long *granularity) = 0;
+    virtual long can_sample_rate(double sample_rate) = 0;
+    virtual long get_sample_rate(double *sample_rate) = 0;
+    virtual long set_sample_rate(double sample_rate) = 0;
+    virtual long get_clock_sources(void *clocks, long *number_of_sources) = 0;
+    virtual long set_clock_source(long reference) = 0;
+    virtual long get_sample_position(void *sample_position, void *time_stamp) = 0;
+    virtual long get_channel_info(asio_channel_info *info) = 0;
+    virtual long create_buffers(asio_buffer_info *buffer_infos, long number_of_channels, long buffer_size, asio_callbacks *callbacks) = 0;
+    virtual long dispose_buffers() = 0;
+    virtual long control_panel() = 0;
+    virtual long future(long selector, void *opt) = 0;
+    virtual long output_ready() = 0;
+};
+
+/** The callbacks must stay alive while the buffers of the driver exist.
+ */
+static auto asio_host_callbacks = asio_callbacks{};
+
+/** Throw an io_error with the error message of the driver.
+ */
+[[noreturn]] tt_no_inline static void throw_asio_error(asio_driver *driver, char const *operation, long result)
+{
+    char message[124] = {};
+    driver->get_error_message(message);
+    throw io_error("ASIO {} failed with {}: '{}'", operation, result, message);
+}
+
+static void check_asio_result(asio_driver *driver, char const *operation, long result)
+{
+    if (result != asio_ok && result != asio_success) [[unlikely]] {
+        throw_asio_error(driver, operation, result);
+    }
+}
+
+[[nodiscard]] static bool is_supported_sample_type(long sample_type) noexcept
+{
+    switch (sample_type) {
+    case asio_int16_lsb:
+    case asio_int24_lsb:
+    case asio_int32_lsb:
+    case asio_float32_lsb:
+    case asio_float64_lsb:
+    case asio_int32_lsb16:
+    case asio_int32_lsb18:
+    case asio_int32_lsb20:
+    case asio_int32_lsb24: return true;
+    default: return false;
+    }
+}
+
+[[nodiscard]] static size_t sample_size(long sample_type) noexcept
+{
+    switch (sample_type) {
+    case asio_int16_lsb: return 2;
+    case asio_int24_lsb: return 3;
+    case asio_float64_lsb: return 8;
+    default: return 4;
+    }
+}
+
+/** Convert fixed point samples to float.
+ * @tparam T The integer type of a sample.
+ * @tparam Bits The number of bits of the value, which is right aligned in the sample.
+ */
+template<typename T, int Bits>
+static void load_fixed_samples(void const *src, float *dst, size_t number_of_samples) noexcept
+{
+    constexpr auto scale = 1.0f / static_cast<float>(1LL << (Bits - 1));
+
+    auto src_ = static_cast<T const *>(src);
+    for (auto i = 0_uz; i != number_of_samples; ++i) {
+        dst[i] = static_cast<float>(src_[i]) * scale;
+    }
+}
+
+template<typename T, int Bits>
+static void store_fixed_samples(float const *src, void *dst, size_t number_of_samples) noexcept
+{
+    constexpr auto scale = static_cast<double>((1LL << (Bits - 1)) - 1);
+
+    auto dst_ = static_cast<T *>(dst);
+    for (auto i = 0_uz; i != number_of_samples; ++i) {
+        dst_[i] = static_cast<T>(std::round(static_cast<double>(std::clamp(src[i], -1.0f, 1.0f)) * scale));
+    }
+}
+
+/** Convert the samples of one channel of the driver to float.
+ * The buffers of a driver are already non-interleaved, so this is a single pass over contiguous samples.
+ */
+static void load_samples(long sample_type, void const *src, float *dst, size_t number_of_samples) noexcept
+{
+    switch (sample_type) {
+    case asio_float32_lsb: std::memcpy(dst, src, number_of_samples * sizeof(float)); break;
+    case asio_float64_lsb: {
+        auto src_ = static_cast<double const *>(src);
+        for (auto i = 0_uz; i != number_of_samples; ++i) {
+            dst[i] = static_cast<float>(src_[i]);
+        }
+    } break;
+    case asio_int16_lsb: load_fixed_samples<int16_t, 16>(src, dst, number_of_samples); break;
+    case asio_int32_lsb: load_fixed_samples<int32_t, 32>(src, dst, number_of_samples); break;
+    case asio_int32_lsb16: load_fixed_samples<int32_t, 16>(src, dst, number_of_samples); break;
+    case asio_int32_lsb18: load_fixed_samples<int32_t, 18>(src, dst, number_of_samples); break;
+    case asio_int32_lsb20: load_fixed_samples<int32_t, 20>(src, dst, number_of_samples); break;
+    case asio_int32_lsb24: load_fixed_samples<int32_t, 24>(src, dst, number_of_samples); break;
+    case asio_int24_lsb: {
+        auto src_ = static_cast<uint8_t const *>(src);
+        for (auto i = 0_uz; i != number_of_samples; ++i, src_ += 3) {
+            ttlet sample = static_cast<int32_t>(
+                static_cast<uint32_t>(src_[0]) << 8 | static_cast<uint32_t>(src_[1]) << 16 | static_cast<uint32_t>(src_[2]) << 24);
+            dst[i] = static_cast<float>(sample) * (1.0f / 2147483648.0f);
+        }
+    } break;
+    default: tt_no_default();
+    }
+}
+
+/** Convert float samples to the samples of one channel of the driver.
+ */
+static void store_samples(long sample_type, float const *src, void *dst, size_t number_of_samples) noexcept
+{
+    switch (sample_type) {
+    case asio_float32_lsb: std::memcpy(dst, src, number_of_samples * sizeof(float)); break;
+    case asio_float64_lsb: {
+        auto dst_ = static_cast<double *>(dst);
+        for (auto i = 0_uz; i != number_of_samples; ++i) {
+            dst_[i] = static_cast<double>(src[i]);
+        }
+    } break;
+    case asio_int16_lsb: store_fixed_samples<int16_t, 16>(src, dst, number_of_samples); break;
+    case asio_int32_lsb: store_fixed_samples<int32_t, 32>(src, dst, number_of_samples); break;
+    case asio_int32_lsb16: store_fixed_samples<int32_t, 16>(src, dst, number_of_samples); break;
+    case asio_int32_lsb18: store_fixed_samples<int32_t, 18>(src, dst, number_of_samples); break;
+    case asio_int32_lsb20: store_fixed_samples<int32_t, 20>(src, dst, number_of_samples); break;
+    case asio_int32_lsb24: store_fixed_samples<int32_t, 24>(src, dst, number_of_samples); break;
+    case asio_int24_lsb: {
+        auto dst_ = static_cast<uint8_t *>(dst);
+        for (auto i = 0_uz; i != number_of_samples; ++i, dst_ += 3) {
+            ttlet sample = static_cast<uint32_t>(
+                static_cast<int32_t>(std::round(static_cast<double>(std::clamp(src[i], -1.0f, 1.0f)) * 8388607.0)));
+            dst_[0] = static_cast<uint8_t>(sample);
+            dst_[1] = static_cast<uint8_t>(sample >> 8);
+            dst_[2] = static_cast<uint8_t>(sample >> 16);
+        }
+    } break;
+    default: tt_no_default();
+    }
+}
+
+audio_device_asio::audio_device_asio(std::wstring clsid, std::string name) noexcept :
+    audio_device(), _clsid(std::move(clsid)), _name(std::move(name))
+{
+}
+
+audio_device_asio::~audio_device_asio()
+{
+    stop_stream();
+}
+
+std::string audio_device_asio::get_id_from_clsid(std::wstring const &clsid) noexcept
+{
+    return "asio:"s + to_string(clsid);
+}
+
+std::string audio_device_asio::id() const noexcept
+{
+    return get_id_from_clsid(_clsid);
+}
+
+std::string audio_device_asio::name() const noexcept
+{
+    return _name;
+}
+
+tt::label audio_device_asio::label() const noexcept
+{
+    return {elusive_icon::Speaker, l10n("{} (ASIO)"), name()};
+}
+
+audio_device_state audio_device_asio::state() const noexcept
+{
+    // The state of an ASIO device is only known after its driver is loaded.
+    return audio_device_state::active;
+}
+
+audio_device_flow_direction audio_device_asio::direction() const noexcept
+{
+    return audio_device_flow_direction::bidirectional;
+}
+
+void audio_device_asio::start_stream(std::weak_ptr<audio_device_delegate> delegate, audio_stream_config const &config)
+{
+    stop_stream();
+
+    audio_device_asio *expected = nullptr;
+    if (not _streaming_device.compare_exchange_strong(expected, this)) {
+        throw io_error("Could not start ASIO driver {}, another ASIO driver is already streaming", name());
+    }
+
+    _delegate = std::move(delegate);
+    _reset_requested = false;
+
+    try {
+        CLSID clsid;
+        if (FAILED(CLSIDFromString(_clsid.c_str(), &clsid))) {
+            throw io_error("ASIO driver {} has an invalid CLSID {}", name(), to_string(_clsid));
+        }
+
+        // An ASIO driver uses its CLSID also as the id of its interface.
+        if (FAILED(CoCreateInstance(clsid, nullptr, CLSCTX_INPROC_SERVER, clsid, reinterpret_cast<void **>(&_driver)))) {
+            throw io_error("Could not load ASIO driver {}", name());
+        }
+
+        if (not _driver->init(GetDesktopWindow())) {
+            throw_asio_error(_driver, "init", 0);
+        }
+
+        if (config.sample_rate != 0.0) {
+            check_asio_result(_driver, "set_sample_rate", _driver->set_sample_rate(config.sample_rate));
+        }
+        double sample_rate;
+        check_asio_result(_driver, "get_sample_rate", _driver->get_sample_rate(&sample_rate));
+
+        ttlet buffer_size = select_buffer_size(config.block_size);
+
+        long number_of_inputs;
+        long number_of_outputs;
+        check_asio_result(_driver, "get_channels", _driver->get_channels(&number_of_inputs, &number_of_outputs));
+
+        auto buffer_infos = std::vector<asio_buffer_info>{};
+        for (long i = 0; i != number_of_inputs; ++i) {
+            buffer_infos.push_back({1, i, {nullptr, nullptr}});
+        }
+        for (long i = 0; i != number_of_outputs; ++i) {
+            buffer_infos.push_back({0, i, {nullptr, nullptr}});
+        }
+
+        asio_host_callbacks.buffer_switch = buffer_switch_callback;
+        asio_host_callbacks.sample_rate_did_change = sample_rate_did_change_callback;
+        asio_host_callbacks.asio_message = asio_message_callback;
+        asio_host_callbacks.buffer_switch_time_info = buffer_switch_time_info_callback;
+        check_asio_result(
+            _driver,
+            "create_buffers",
+            _driver->create_buffers(
+                buffer_infos.data(), narrow_cast<long>(buffer_infos.size()), narrow_cast<long>(buffer_size), &asio_host_callbacks));
+
+        _input_channels.clear();
+        _output_channels.clear();
+        for (ttlet &buffer_info : buffer_infos) {
+            auto channel_info = asio_channel_info{};
+            channel_info.channel_nr = buffer_info.channel_nr;
+            channel_info.is_input = buffer_info.is_input;
+            check_asio_result(_driver, "get_channel_info", _driver->get_channel_info(&channel_info));
+            if (not is_supported_sample_type(channel_info.sample_type)) {
+                throw io_error("ASIO driver {} uses unsupported sample type {}", name(), channel_info.sample_type);
+            }
+
+            auto &channels = buffer_info.is_input ? _input_channels : _output_channels;
+            channels.push_back({channel_info.sample_type, {buffer_info.buffers[0], buffer_info.buffers[1]}});
+        }
+
+        long input_latency;
+        long output_latency;
+        check_asio_result(_driver, "get_latencies", _driver->get_latencies(&input_latency, &output_latency));
+        _input_latency = narrow_cast<size_t>(input_latency);
+        _output_latency = narrow_cast<size_t>(output_latency);
+
+        // A driver which supports output_ready() can start sending the output right after the callback.
+        _post_output = _driver->output_ready() == asio_ok;
+
+        allocate_blocks(buffer_size, sample_rate);
+        reset_stream_statistics(sample_rate);
+        check_asio_result(_driver, "start", _driver->start());
+
+    } catch (...) {
+        stop_stream();
+        throw;
+    }
+
+    tt_log_info(
+        "Started ASIO stream on {}: {} Hz, {} inputs, {} outputs, {} samples per block",
+        name(),
+        _output_block.device_sample_rate,
+        _input_channels.size(),
+        _output_channels.size(),
+        _output_block.number_of_samples());
+}
+
+void audio_device_asio::stop_stream() noexcept
+{
+    if (_driver) {
+        _driver->stop();
+        _driver->dispose_buffers();
+        _driver->Release();
+        _driver = nullptr;
+    }
+
+    _input_channels.clear();
+    _output_channels.clear();
+
+    auto expected = this;
+    _streaming_device.compare_exchange_strong(expected, nullptr);
+}
+
+size_t audio_device_asio::select_buffer_size(size_t requested) const
+{
+    long minimum_size;
+    long maximum_size;
+    long preferred_size;
+    long granularity;
+    check_asio_result(
+        _driver, "get_buffer_size", _driver->get_buffer_size(&minimum_size, &maximum_size, &preferred_size, &granularity));
+
+    // The block contains whole vectors of samples, select the first size that allows this.
+    auto is_valid = [&](long size) {
+        return size >= minimum_size && size <= maximum_size && size % audio_block::samples_per_vector == 0;
+    };
+
+    if (requested == 0 && is_valid(preferred_size)) {
+        return narrow_cast<size_t>(preferred_size);
+    }
+
+    auto size = minimum_size;
+    while (size <= maximum_size) {
+        if (is_valid(size) && size >= narrow_cast<long>(requested)) {
+            return narrow_cast<size_t>(size);
+        }
+
+        if (granularity == -1) {
+            // Only powers of two are allowed.
+            size *= 2;
+        } else if (granularity > 0) {
+            size += granularity;
+        } else {
+            break;
+        }
+    }
+
+    throw io_error(
+        "ASIO driver {} has no buffer size of at least {} that is a multiple of {} samples",
+        name(),
+        requested,
+        audio_block::samples_per_vector);
+}
+
+void audio_device_asio::allocate_blocks(size_t block_size, double sample_rate) noexcept
+{
+    constexpr auto alignment = static_cast<size_t>(audio_block::samples_per_vector);
+    tt_axiom(block_size % alignment == 0);
+
+    ttlet number_of_input_samples = _input_channels.size() * block_size;
+    ttlet number_of_output_samples = _output_channels.size() * block_size;
+
+    // Allocate extra samples so that the blocks can be aligned to a whole vector.
+    _samples.assign(number_of_input_samples + number_of_output_samples + alignment, 0.0f);
+    ttlet misalignment = reinterpret_cast<uintptr_t>(_samples.data()) % (alignment * sizeof(float)) / sizeof(float);
+    ttlet offset = (alignment - misalignment) % alignment;
+
+    auto init_block = [&](audio_block &block, size_t number_of_channels, std::span<float> samples) {
+        block = {};
+        block.number_of_vectors = narrow_cast<ssize_t>(block_size / alignment);
+        block.number_of_channels = narrow_cast<ssize_t>(number_of_channels);
+        block.samples = samples;
+        block.sample_position = 0;
+        block.timestamp = hires_utc_clock::time_point::max();
+        block.word_clock_sample_rate = sample_rate;
+        block.device_sample_rate = sample_rate;
+    };
+
+    init_block(_input_block, _input_channels.size(), std::span{_samples.data() + offset, number_of_input_samples});
+    init_block(
+        _output_block,
+        _output_channels.size(),
+        std::span{_samples.data() + offset + number_of_input_samples, number_of_output_samples});
+}
+
+void audio_device_asio::buffer_switch(long buffer_index) noexcept
+{
+    ttlet block_size = narrow_cast<size_t>(_output_block.number_of_samples());
+    ttlet now = hires_utc_clock::now();
+
+    for (auto i = 0_uz; i != _input_channels.size(); ++i) {
+        ttlet &channel = _input_channels[i];
+        load_samples(channel.sample_type, channel.buffers[buffer_index], _input_block.samples_for_channel(i).data(), block_size);
+    }
+    _input_block.timestamp = now - std::chrono::nanoseconds{static_cast<int64_t>(
+                                       static_cast<double>(_input_latency + block_size) * 1'000'000'000.0 /
+                                       _input_block.device_sample_rate)};
+    _input_block.silent = false;
+    _input_block.corrupt = false;
+
+    _output_block.timestamp = now + std::chrono::nanoseconds{static_cast<int64_t>(
+                                        static_cast<double>(_output_latency) * 1'000'000'000.0 / _output_block.device_sample_rate)};
+    _output_block.silent = false;
+    _output_block.corrupt = false;
+    measure_block(_output_block);
+
+    if (auto delegate = _delegate.lock()) {
+        delegate->process_audio(_input_block, _output_block, now);
+    } else {
+        _output_block.silent = true;
+    }
+
+    for (auto i = 0_uz; i != _output_channels.size(); ++i) {
+        ttlet &channel = _output_channels[i];
+        if (_output_block.silent) {
+            // Silence is all zero bits in each of the sample types.
+            std::memset(channel.buffers[buffer_index], 0, block_size * sample_size(channel.sample_type));
+        } else {
+            store_samples(channel.sample_type, _output_block.samples_for_channel(i).data(), channel.buffers[buffer_index], block_size);
+        }
+    }
+
+    _input_block.sample_position += block_size;
+    _output_block.sample_position += block_size;
+
+    if (_post_output) {
+        _driver->output_ready();
+    }
+}
+
+long audio_device_asio::asio_message(long selector, long value) noexcept
+{
+    switch (selector) {
+    case asio_selector_supported:
+        return value == asio_engine_version || value == asio_reset_request || value == asio_buffer_size_change ||
+                value == asio_resync_request || value == asio_latencies_changed || value == asio_overload ?
+            1 :
+            0;
+
+    case asio_engine_version: return 2;
+
+    case asio_reset_request:
+        // The driver can not be reset from inside its callback; the application restarts the stream.
+        tt_log_warning("ASIO driver {} requested a reset", name());
+        _reset_requested = true;
+        return 1;
+
+    case asio_buffer_size_change:
+        tt_log_warning("ASIO driver {} changed its buffer size", name());
+        _reset_requested = true;
+        return 1;
+
+    case asio_resync_request: increment_counter<"asio_resync">(); return 1;
+
+    case asio_latencies_changed: return 1;
+
+    case asio_overload:
+        increment_counter<"asio_overload">();
+        count_xrun();
+        return 1;
+
+    case asio_supports_time_info:
+    case asio_supports_time_code:
+    default: return 0;
+    }
+}
+
+void audio_device_asio::buffer_switch_callback(long buffer_index, long direct_process) noexcept
+{
+    if (auto device = _streaming_device.load(std::memory_order::acquire)) {
+        device->buffer_switch(buffer_index);
+    }
+}
+
+void audio_device_asio::sample_rate_did_change_callback(double sample_rate) noexcept
+{
+    if (auto device = _streaming_device.load(std::memory_order::acquire)) {
+        tt_log_warning("ASIO driver {} changed its sample rate to {} Hz", device->name(), sample_rate);
+        device->_reset_requested = true;
+    }
+}
+
+long audio_device_asio::asio_message_callback(long selector, long value, void *message, double *opt) noexcept
+{
+    if (auto device = _streaming_device.load(std::memory_order::acquire)) {
+        return device->asio_message(selector, value);
+    } else {
+        return 0;
+    }
+}
+
+void *audio_device_asio::buffer_switch_time_info_callback(void *params, long buffer_index, long direct_process) noexcept
+{
+    // Time info is not supported, but some drivers call this callback anyway.
+    buffer_switch_callback(buffer_index, direct_process);
+    return nullptr;
+}
+
+} // namespace tt
@@ -1,18 +1,108 @@
-// Copyright Take Vos 2019.
+// Copyright Take Vos 2019-2021.
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #pragma once
 
-#include "AudioDevice.hpp"
+#include "audio_device.hpp"
+#include "audio_block.hpp"
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <array>
 
 namespace tt {
 
-/*! A class representing an audio device on the system.
-*/
+struct asio_driver;
+
+/** An audio device for an ASIO driver.
+ * The device has all the inputs and outputs of the audio interface, which are streamed together.
+ *
+ * The driver calls back from its own real-time thread at the swap of its double buffer. Since the
+ * callbacks of ASIO have no context argument, only a single ASIO device can stream at the same time.
+ */
 class audio_device_asio : public audio_device {
+public:
+    audio_device_asio(std::wstring clsid, std::string name) noexcept;
+    ~audio_device_asio();
+
+    std::string id() const noexcept override;
+    std::string name() const noexcept override;
+    tt::label label() const noexcept override;
+    audio_device_state state() const noexcept override;
+    audio_device_flow_direction direction() const noexcept override;
+
+    /** Load the driver and start streaming.
+     * The block size is the size of the double buffer of the driver; zero selects the driver's preferred size.
+     *
+     * @throw io_error When the driver could not be loaded, or does not support the configuration.
+     */
+    void start_stream(std::weak_ptr<audio_device_delegate> delegate, audio_stream_config const &config) override;
+    void stop_stream() noexcept override;
+
+    /** Check if the driver has asked to be reset.
+     * This happens after the sample rate or the buffer size was changed from the control panel of the driver;
+     * the stream should then be stopped and started again.
+     */
+    [[nodiscard]] bool reset_requested() const noexcept
+    {
+        return _reset_requested.load(std::memory_order::relaxed);
+    }
+
+    static std::string get_id_from_clsid(std::wstring const &clsid) noexcept;
+
+private:
+    /** The format and the double buffer of a single channel of the driver.
+     */
+    struct channel_type {
+        long sample_type;
+        std::array<void *, 2> buffers;
+    };
+
+    std::wstring _clsid;
+    std::string _name;
+
+    asio_driver *_driver = nullptr;
+    std::weak_ptr<audio_device_delegate> _delegate;
+    bool _post_output = false;
+
+    std::vector<channel_type> _input_channels;
+    std::vector<channel_type> _output_channels;
+
+    /** The samples of the input and output blocks.
+     * Allocated when the stream starts, so that the callback does not allocate.
+     */
+    std::vector<float> _samples;
+    audio_block _input_block = {};
+    audio_block _output_block = {};
+
+    /** The number of samples that the driver adds before the input and after the output.
+     */
+    size_t _input_latency = 0;
+    size_t _output_latency = 0;
+
+    /** The driver has requested to be reset, after which the stream should be restarted.
+     */
+    std::atomic<bool> _reset_requested = false;
+
+    /** Select the size of the double buffer of the driver.
+     */
+    [[nodiscard]] size_t select_buffer_size(size_t requested) const;
+
+    void allocate_blocks(size_t block_size, double sample_rate) noexcept;
+
+    void buffer_switch(long buffer_index) noexcept;
+    long asio_message(long selector, long value) noexcept;
 
+    /** The device that is currently streaming, used by the callbacks of the driver.
+     */
+    static inline std::atomic<audio_device_asio *> _streaming_device = nullptr;
 
+    static void buffer_switch_callback(long buffer_index, long direct_process) noexcept;
+    static void sample_rate_did_change_callback(double sample_rate) noexcept;
+    static long asio_message_callback(long selector, long value, void *message, double *opt) noexcept;
+    static void *buffer_switch_time_info_callback(void *params, long buffer_index, long direct_process) noexcept;
 };
 
-}
\ No newline at end of file
+} // namespace tt
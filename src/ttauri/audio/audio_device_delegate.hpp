@@ -10,10 +10,12 @@ namespace tt {
 
 class audio_device_delegate {
 public:
-    audio_device_delegate();
-    virtual ~audio_device_delegate() = 0;
+    audio_device_delegate() = default;
+    virtual ~audio_device_delegate() = default;
 
     /** Process a block of samples.
+     * This function is called from the real-time thread of the audio stream, it should not
+     * block on locks, allocate memory or do any other operation with an unbounded execution time.
      *
      * @param inputBlock Samples captured from the audio device.
      * @param outputBlock Samples rendered to the audio device.
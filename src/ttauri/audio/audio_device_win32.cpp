@@ -6,13 +6,291 @@
 #include "../logger.hpp"
 #include "../strings.hpp"
 #include "../exception.hpp"
+#include "../check.hpp"
+#include "../thread.hpp"
+#include "../cpu_topology.hpp"
+#include "../counters.hpp"
+#include "../cast.hpp"
 #include <Windows.h>
 #include <propsys.h>
 #include <functiondiscoverykeys_devpkey.h>
 #include <mmdeviceapi.h>
+#include <Audioclient.h>
+#include <avrt.h>
+#include <mmreg.h>
+#include <ksmedia.h>
+#include <optional>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+
+#pragma comment(lib, "avrt")
 
 namespace tt {
 
+/** The number of REFERENCE_TIME units in a second, WASAPI durations are in 100 ns units.
+ */
+constexpr REFERENCE_TIME reference_time_per_second = 10'000'000;
+
+[[nodiscard]] static size_t to_frames(REFERENCE_TIME duration, double sample_rate) noexcept
+{
+    return static_cast<size_t>(std::ceil(static_cast<double>(duration) * sample_rate / reference_time_per_second));
+}
+
+[[nodiscard]] static REFERENCE_TIME to_reference_time(size_t frames, double sample_rate) noexcept
+{
+    return static_cast<REFERENCE_TIME>(std::round(static_cast<double>(frames) * reference_time_per_second / sample_rate));
+}
+
+[[nodiscard]] static hires_utc_clock::duration to_duration(size_t frames, double sample_rate) noexcept
+{
+    return std::chrono::nanoseconds{static_cast<int64_t>(static_cast<double>(frames) * 1'000'000'000.0 / sample_rate)};
+}
+
+/** Round a number of frames up to a multiple of `audio_block::samples_per_vector`.
+ */
+[[nodiscard]] static size_t round_up_to_vector(size_t frames) noexcept
+{
+    constexpr auto n = static_cast<size_t>(audio_block::samples_per_vector);
+    return (frames + n - 1) / n * n;
+}
+
+/** Convert a position of the performance counter in 100 ns units to a time point.
+ */
+[[nodiscard]] static hires_utc_clock::time_point to_time_point(UINT64 qpc_position) noexcept
+{
+    LARGE_INTEGER counter;
+    LARGE_INTEGER frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+
+    // Split the multiplication to not overflow a counter with a high frequency.
+    ttlet now = (counter.QuadPart / frequency.QuadPart) * reference_time_per_second +
+        (counter.QuadPart % frequency.QuadPart) * reference_time_per_second / frequency.QuadPart;
+    ttlet age = now - static_cast<int64_t>(qpc_position);
+    return hires_utc_clock::now() - std::chrono::nanoseconds{age * 100};
+}
+
+[[nodiscard]] static constexpr size_t bytes_per_sample(wasapi_sample_format format) noexcept
+{
+    switch (format) {
+    case wasapi_sample_format::float32: return 4;
+    case wasapi_sample_format::int32: return 4;
+    case wasapi_sample_format::int24_in_32: return 4;
+    case wasapi_sample_format::int24: return 3;
+    case wasapi_sample_format::int16: return 2;
+    default: tt_no_default();
+    }
+}
+
+[[nodiscard]] static WAVEFORMATEXTENSIBLE
+make_wave_format(wasapi_sample_format format, WORD number_of_channels, DWORD channel_mask, DWORD sample_rate) noexcept
+{
+    ttlet container_bits = narrow_cast<WORD>(bytes_per_sample(format) * 8);
+
+    auto r = WAVEFORMATEXTENSIBLE{};
+    r.Format.wFormatTag = WAVE_FORMAT_EXTENSIBLE;
+    r.Format.nChannels = number_of_channels;
+    r.Format.nSamplesPerSec = sample_rate;
+    r.Format.wBitsPerSample = container_bits;
+    r.Format.nBlockAlign = narrow_cast<WORD>(number_of_channels * container_bits / 8);
+    r.Format.nAvgBytesPerSec = sample_rate * r.Format.nBlockAlign;
+    r.Format.cbSize = sizeof(WAVEFORMATEXTENSIBLE) - sizeof(WAVEFORMATEX);
+    r.Samples.wValidBitsPerSample = format == wasapi_sample_format::int24_in_32 ? 24 : container_bits;
+    r.dwChannelMask = channel_mask;
+    r.SubFormat = format == wasapi_sample_format::float32 ? KSDATAFORMAT_SUBTYPE_IEEE_FLOAT : KSDATAFORMAT_SUBTYPE_PCM;
+    return r;
+}
+
+/** Get the sample format of a wave format.
+ * @return The sample format, or empty when the samples can not be converted.
+ */
+[[nodiscard]] static std::optional<wasapi_sample_format> to_sample_format(WAVEFORMATEXTENSIBLE const &format) noexcept
+{
+    auto is_float = format.Format.wFormatTag == WAVE_FORMAT_IEEE_FLOAT;
+    auto is_pcm = format.Format.wFormatTag == WAVE_FORMAT_PCM;
+    auto valid_bits = format.Format.wBitsPerSample;
+    if (format.Format.wFormatTag == WAVE_FORMAT_EXTENSIBLE) {
+        is_float = format.SubFormat == KSDATAFORMAT_SUBTYPE_IEEE_FLOAT;
+        is_pcm = format.SubFormat == KSDATAFORMAT_SUBTYPE_PCM;
+        valid_bits = format.Samples.wValidBitsPerSample;
+    }
+
+    if (is_float && format.Format.wBitsPerSample == 32) {
+        return wasapi_sample_format::float32;
+    } else if (is_pcm && format.Format.wBitsPerSample == 32) {
+        return valid_bits == 24 ? wasapi_sample_format::int24_in_32 : wasapi_sample_format::int32;
+    } else if (is_pcm && format.Format.wBitsPerSample == 24) {
+        return wasapi_sample_format::int24;
+    } else if (is_pcm && format.Format.wBitsPerSample == 16) {
+        return wasapi_sample_format::int16;
+    } else {
+        return {};
+    }
+}
+
+/** Select a period for a low latency shared stream.
+ * The period is a multiple of the fundamental period between the minimum and maximum period;
+ * preferably also a multiple of `audio_block::samples_per_vector`, so that each period is exactly one block.
+ */
+[[nodiscard]] static size_t select_shared_period(size_t requested, size_t minimum, size_t maximum, size_t fundamental) noexcept
+{
+    tt_axiom(fundamental > 0);
+
+    auto first_fit = maximum;
+    for (auto period = minimum; period <= maximum; period += fundamental) {
+        if (period >= requested) {
+            if (period % static_cast<size_t>(audio_block::samples_per_vector) == 0) {
+                return period;
+            }
+            first_fit = std::min(first_fit, period);
+        }
+    }
+    return first_fit;
+}
+
+template<wasapi_sample_format Format>
+[[nodiscard]] static float load_sample(std::byte const *src) noexcept
+{
+    if constexpr (Format == wasapi_sample_format::float32) {
+        float r;
+        std::memcpy(&r, src, sizeof(r));
+        return r;
+
+    } else if constexpr (Format == wasapi_sample_format::int32 || Format == wasapi_sample_format::int24_in_32) {
+        // 24 bit samples in a 32 bit container are left aligned.
+        int32_t r;
+        std::memcpy(&r, src, sizeof(r));
+        return static_cast<float>(r) * (1.0f / 2147483648.0f);
+
+    } else if constexpr (Format == wasapi_sample_format::int24) {
+        ttlet r = static_cast<int32_t>(
+            static_cast<uint32_t>(src[0]) << 8 | static_cast<uint32_t>(src[1]) << 16 | static_cast<uint32_t>(src[2]) << 24);
+        return static_cast<float>(r) * (1.0f / 2147483648.0f);
+
+    } else if constexpr (Format == wasapi_sample_format::int16) {
+        int16_t r;
+        std::memcpy(&r, src, sizeof(r));
+        return static_cast<float>(r) * (1.0f / 32768.0f);
+
+    } else {
+        tt_static_no_default();
+    }
+}
+
+template<wasapi_sample_format Format>
+static void store_sample(std::byte *dst, float sample) noexcept
+{
+    if constexpr (Format == wasapi_sample_format::float32) {
+        std::memcpy(dst, &sample, sizeof(sample));
+
+    } else {
+        ttlet sample_ = static_cast<double>(std::clamp(sample, -1.0f, 1.0f));
+
+        if constexpr (Format == wasapi_sample_format::int32) {
+            ttlet r = static_cast<int32_t>(std::round(sample_ * 2147483647.0));
+            std::memcpy(dst, &r, sizeof(r));
+
+        } else if constexpr (Format == wasapi_sample_format::int24_in_32) {
+            ttlet r = static_cast<int32_t>(std::round(sample_ * 8388607.0)) * 256;
+            std::memcpy(dst, &r, sizeof(r));
+
+        } else if constexpr (Format == wasapi_sample_format::int24) {
+            ttlet r = static_cast<uint32_t>(static_cast<int32_t>(std::round(sample_ * 8388607.0)));
+            dst[0] = static_cast<std::byte>(r);
+            dst[1] = static_cast<std::byte>(r >> 8);
+            dst[2] = static_cast<std::byte>(r >> 16);
+
+        } else if constexpr (Format == wasapi_sample_format::int16) {
+            ttlet r = static_cast<int16_t>(std::round(sample_ * 32767.0));
+            std::memcpy(dst, &r, sizeof(r));
+
+        } else {
+            tt_static_no_default();
+        }
+    }
+}
+
+/** Convert interleaved samples from the device to the non-interleaved samples of a block.
+ *
+ * @param src The interleaved samples of the device buffer.
+ * @param dst The samples of the first channel; the samples of the next channel start at `dst + dst_stride`.
+ */
+template<wasapi_sample_format Format>
+static void
+deinterleave(std::byte const *src, size_t number_of_channels, size_t number_of_frames, float *dst, size_t dst_stride) noexcept
+{
+    constexpr auto sample_size = bytes_per_sample(Format);
+    ttlet frame_size = number_of_channels * sample_size;
+
+    for (auto channel = 0_uz; channel != number_of_channels; ++channel) {
+        auto src_ = src + channel * sample_size;
+        auto dst_ = dst + channel * dst_stride;
+        for (auto i = 0_uz; i != number_of_frames; ++i, src_ += frame_size) {
+            dst_[i] = load_sample<Format>(src_);
+        }
+    }
+}
+
+static void deinterleave(
+    wasapi_sample_format format,
+    std::byte const *src,
+    size_t number_of_channels,
+    size_t number_of_frames,
+    float *dst,
+    size_t dst_stride) noexcept
+{
+    switch (format) {
+        using enum wasapi_sample_format;
+    case float32: return deinterleave<float32>(src, number_of_channels, number_of_frames, dst, dst_stride);
+    case int32: return deinterleave<int32>(src, number_of_channels, number_of_frames, dst, dst_stride);
+    case int24_in_32: return deinterleave<int24_in_32>(src, number_of_channels, number_of_frames, dst, dst_stride);
+    case int24: return deinterleave<int24>(src, number_of_channels, number_of_frames, dst, dst_stride);
+    case int16: return deinterleave<int16>(src, number_of_channels, number_of_frames, dst, dst_stride);
+    default: tt_no_default();
+    }
+}
+
+/** Convert the non-interleaved samples of a block to interleaved samples for the device.
+ *
+ * @param src The samples of the first channel; the samples of the next channel start at `src + src_stride`.
+ * @param dst The interleaved samples of the device buffer.
+ */
+template<wasapi_sample_format Format>
+static void
+interleave(float const *src, size_t src_stride, size_t number_of_channels, size_t number_of_frames, std::byte *dst) noexcept
+{
+    constexpr auto sample_size = bytes_per_sample(Format);
+    ttlet frame_size = number_of_channels * sample_size;
+
+    for (auto channel = 0_uz; channel != number_of_channels; ++channel) {
+        auto src_ = src + channel * src_stride;
+        auto dst_ = dst + channel * sample_size;
+        for (auto i = 0_uz; i != number_of_frames; ++i, dst_ += frame_size) {
+            store_sample<Format>(dst_, src_[i]);
+        }
+    }
+}
+
+static void interleave(
+    wasapi_sample_format format,
+    float const *src,
+    size_t src_stride,
+    size_t number_of_channels,
+    size_t number_of_frames,
+    std::byte *dst) noexcept
+{
+    switch (format) {
+        using enum wasapi_sample_format;
+    case float32: return interleave<float32>(src, src_stride, number_of_channels, number_of_frames, dst);
+    case int32: return interleave<int32>(src, src_stride, number_of_channels, number_of_frames, dst);
+    case int24_in_32: return interleave<int24_in_32>(src, src_stride, number_of_channels, number_of_frames, dst);
+    case int24: return interleave<int24>(src, src_stride, number_of_channels, number_of_frames, dst);
+    case int16: return interleave<int16>(src, src_stride, number_of_channels, number_of_frames, dst);
+    default: tt_no_default();
+    }
+}
+
 static std::string getStringProperty(void *propertyStore, REFPROPERTYKEY key)
 {
     auto propertyStore_ = static_cast<IPropertyStore *>(propertyStore);
@@ -34,10 +312,15 @@ audio_device_win32::audio_device_win32(IMMDevice *device) : audio_device(), _dev
     tt_assert(_device != nullptr);
     tt_hresult_check(_device->QueryInterface(&_endpoint));
     tt_hresult_check(_device->OpenPropertyStore(STGM_READ, &_property_store));
+
+    _id = get_id_from_device(_device);
+    _direction = query_direction();
+    update_properties();
 }
 
 audio_device_win32::~audio_device_win32()
 {
+    stop_stream();
     _property_store->Release();
     _endpoint->Release();
     _device->Release();
@@ -55,18 +338,26 @@ std::string audio_device_win32::get_id_from_device(IMMDevice *device) noexcept
     return "win32:"s + id;
 }
 
+void audio_device_win32::update_properties() noexcept
+{
+    // Query outside of the lock, the COM calls may block while the device is being (un)plugged.
+    auto name = query_name();
+    ttlet state = query_state();
+
+    ttlet lock = std::scoped_lock(_properties_mutex);
+    _name = std::move(name);
+    _state = state;
+}
+
 std::string audio_device_win32::id() const noexcept
 {
-    return get_id_from_device(_device);
+    return _id;
 }
 
 std::string audio_device_win32::name() const noexcept
 {
-    try {
-        return getStringProperty(_property_store, PKEY_Device_FriendlyName);
-    } catch (io_error const &) {
-        return "<unknown name>"s;
-    }
+    ttlet lock = std::scoped_lock(_properties_mutex);
+    return _name;
 }
 
 tt::label audio_device_win32::label() const noexcept
@@ -75,6 +366,26 @@ tt::label audio_device_win32::label() const noexcept
 }
 
 audio_device_state audio_device_win32::state() const noexcept
+{
+    ttlet lock = std::scoped_lock(_properties_mutex);
+    return _state;
+}
+
+audio_device_flow_direction audio_device_win32::direction() const noexcept
+{
+    return _direction;
+}
+
+std::string audio_device_win32::query_name() const noexcept
+{
+    try {
+        return getStringProperty(_property_store, PKEY_Device_FriendlyName);
+    } catch (io_error const &) {
+        return "<unknown name>"s;
+    }
+}
+
+audio_device_state audio_device_win32::query_state() const noexcept
 {
     DWORD state;
     tt_hresult_check(_device->GetState(&state));
@@ -88,7 +399,7 @@ audio_device_state audio_device_win32::state() const noexcept
     }
 }
 
-audio_device_flow_direction audio_device_win32::direction() const noexcept
+audio_device_flow_direction audio_device_win32::query_direction() const noexcept
 {
     EDataFlow data_flow;
     tt_hresult_check(_endpoint->GetDataFlow(&data_flow));
@@ -119,4 +430,392 @@ std::string audio_device_win32::end_point_name() const noexcept
     }
 }
 
+void audio_device_win32::start_stream(std::weak_ptr<audio_device_delegate> delegate, audio_stream_config const &config)
+{
+    stop_stream();
+
+    _delegate = std::move(delegate);
+    _exclusive = config.exclusive;
+
+    try {
+        tt_hresult_check(_device->Activate(__uuidof(IAudioClient), CLSCTX_ALL, nullptr, reinterpret_cast<void **>(&_audio_client)));
+        ttlet block_size = initialize_audio_client(config);
+
+        _stream_event = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+        if (_stream_event == nullptr) {
+            throw io_error("Could not create the event for the audio stream: '{}'", get_last_error_message());
+        }
+        tt_hresult_check(_audio_client->SetEventHandle(_stream_event));
+
+        if (direction() == audio_device_flow_direction::input) {
+            tt_hresult_check(_audio_client->GetService(__uuidof(IAudioCaptureClient), reinterpret_cast<void **>(&_capture_client)));
+        } else {
+            tt_hresult_check(_audio_client->GetService(__uuidof(IAudioRenderClient), reinterpret_cast<void **>(&_render_client)));
+
+            // Fill the buffer with silence, so that the device does not start with an underrun.
+            BYTE *data;
+            tt_hresult_check(_render_client->GetBuffer(narrow_cast<UINT32>(_buffer_size), &data));
+            tt_hresult_check(_render_client->ReleaseBuffer(narrow_cast<UINT32>(_buffer_size), AUDCLNT_BUFFERFLAGS_SILENT));
+        }
+
+        allocate_block(block_size);
+        reset_stream_statistics(_sample_rate);
+        tt_hresult_check(_audio_client->Start());
+
+    } catch (...) {
+        stop_stream();
+        throw;
+    }
+
+    tt_log_info(
+        "Started {} audio stream on {}: {} Hz, {} channels, {} samples per block",
+        _exclusive ? "exclusive" : "shared",
+        name(),
+        _sample_rate,
+        _number_of_channels,
+        _block.number_of_samples());
+
+    _stream_thread = std::jthread{[this](std::stop_token stop_token) {
+        stream_proc(stop_token);
+    }};
+}
+
+void audio_device_win32::stop_stream() noexcept
+{
+    if (_stream_thread.joinable()) {
+        _stream_thread.request_stop();
+        _stream_thread.join();
+
+        ttlet statistics = stream_statistics();
+        tt_log_info(
+            "Stopped audio stream on {}: measured {:.3f} Hz, drift {:.1f} ppm, {} xruns",
+            name(),
+            statistics.sample_rate,
+            statistics.drift_ppm,
+            statistics.xruns);
+    }
+
+    if (_audio_client) {
+        _audio_client->Stop();
+    }
+    if (_render_client) {
+        _render_client->Release();
+        _render_client = nullptr;
+    }
+    if (_capture_client) {
+        _capture_client->Release();
+        _capture_client = nullptr;
+    }
+    if (_audio_client) {
+        _audio_client->Release();
+        _audio_client = nullptr;
+    }
+    if (_stream_event) {
+        CloseHandle(_stream_event);
+        _stream_event = nullptr;
+    }
+}
+
+size_t audio_device_win32::initialize_audio_client(audio_stream_config const &config)
+{
+    tt_axiom(_audio_client);
+
+    WAVEFORMATEX *mix_format_ptr;
+    tt_hresult_check(_audio_client->GetMixFormat(&mix_format_ptr));
+    auto mix_format = WAVEFORMATEXTENSIBLE{};
+    std::memcpy(
+        &mix_format,
+        mix_format_ptr,
+        mix_format_ptr->wFormatTag == WAVE_FORMAT_EXTENSIBLE ? sizeof(WAVEFORMATEXTENSIBLE) : sizeof(WAVEFORMATEX));
+    CoTaskMemFree(mix_format_ptr);
+
+    ttlet channel_mask = mix_format.Format.wFormatTag == WAVE_FORMAT_EXTENSIBLE ? mix_format.dwChannelMask : DWORD{0};
+    auto block_size = 0_uz;
+    auto format = mix_format;
+
+    if (config.exclusive) {
+        _sample_rate = config.sample_rate != 0.0 ? config.sample_rate : narrow_cast<double>(mix_format.Format.nSamplesPerSec);
+
+        // Find the sample format with the highest resolution that the device supports at this sample rate.
+        auto found = false;
+        for (ttlet sample_format :
+             {wasapi_sample_format::float32,
+              wasapi_sample_format::int32,
+              wasapi_sample_format::int24_in_32,
+              wasapi_sample_format::int24,
+              wasapi_sample_format::int16}) {
+            format = make_wave_format(
+                sample_format, mix_format.Format.nChannels, channel_mask, static_cast<DWORD>(std::round(_sample_rate)));
+            if (_audio_client->IsFormatSupported(AUDCLNT_SHAREMODE_EXCLUSIVE, &format.Format, nullptr) == S_OK) {
+                found = true;
+                break;
+            }
+        }
+        if (not found) {
+            throw io_error("Audio device {} does not support an exclusive stream at {} Hz", name(), _sample_rate);
+        }
+
+        REFERENCE_TIME default_period;
+        REFERENCE_TIME minimum_period;
+        tt_hresult_check(_audio_client->GetDevicePeriod(&default_period, &minimum_period));
+        block_size = round_up_to_vector(std::max(config.block_size, to_frames(minimum_period, _sample_rate)));
+
+        // In exclusive event driven mode the buffer is a single period.
+        auto period = to_reference_time(block_size, _sample_rate);
+        auto result = _audio_client->Initialize(
+            AUDCLNT_SHAREMODE_EXCLUSIVE, AUDCLNT_STREAMFLAGS_EVENTCALLBACK, period, period, &format.Format, nullptr);
+
+        if (result == AUDCLNT_E_BUFFER_SIZE_NOT_ALIGNED) {
+            // The device requires a different period, the suggested buffer size can only be used
+            // with a new audio client.
+            UINT32 aligned_buffer_size;
+            tt_hresult_check(_audio_client->GetBufferSize(&aligned_buffer_size));
+            _audio_client->Release();
+            _audio_client = nullptr;
+
+            tt_hresult_check(
+                _device->Activate(__uuidof(IAudioClient), CLSCTX_ALL, nullptr, reinterpret_cast<void **>(&_audio_client)));
+            block_size = aligned_buffer_size;
+            period = to_reference_time(block_size, _sample_rate);
+            result = _audio_client->Initialize(
+                AUDCLNT_SHAREMODE_EXCLUSIVE, AUDCLNT_STREAMFLAGS_EVENTCALLBACK, period, period, &format.Format, nullptr);
+        }
+        tt_hresult_check(result);
+
+    } else {
+        _sample_rate = narrow_cast<double>(mix_format.Format.nSamplesPerSec);
+        if (config.sample_rate != 0.0 && config.sample_rate != _sample_rate) {
+            throw io_error(
+                "Audio device {} is shared at {} Hz, an exclusive stream is needed for {} Hz", name(), _sample_rate, config.sample_rate);
+        }
+
+        IAudioClient3 *audio_client3;
+        if (SUCCEEDED(_audio_client->QueryInterface(__uuidof(IAudioClient3), reinterpret_cast<void **>(&audio_client3)))) {
+            // Since Windows 10 the mixer can run with a shorter period than its default of 10 ms.
+            UINT32 default_period;
+            UINT32 fundamental_period;
+            UINT32 minimum_period;
+            UINT32 maximum_period;
+            auto result = audio_client3->GetSharedModeEnginePeriod(
+                &format.Format, &default_period, &fundamental_period, &minimum_period, &maximum_period);
+            if (SUCCEEDED(result)) {
+                ttlet period = select_shared_period(config.block_size, minimum_period, maximum_period, fundamental_period);
+                block_size = round_up_to_vector(period);
+                result = audio_client3->InitializeSharedAudioStream(
+                    AUDCLNT_STREAMFLAGS_EVENTCALLBACK, narrow_cast<UINT32>(period), &format.Format, nullptr);
+            }
+            audio_client3->Release();
+            tt_hresult_check(result);
+
+        } else {
+            REFERENCE_TIME default_period;
+            REFERENCE_TIME minimum_period;
+            tt_hresult_check(_audio_client->GetDevicePeriod(&default_period, &minimum_period));
+            block_size = round_up_to_vector(config.block_size != 0 ? config.block_size : to_frames(default_period, _sample_rate));
+
+            // The buffer holds two blocks or two periods of the mixer, so that it can absorb both.
+            ttlet buffer_duration = std::max(default_period, to_reference_time(block_size, _sample_rate)) * 2;
+            tt_hresult_check(_audio_client->Initialize(
+                AUDCLNT_SHAREMODE_SHARED, AUDCLNT_STREAMFLAGS_EVENTCALLBACK, buffer_duration, 0, &format.Format, nullptr));
+        }
+    }
+
+    if (ttlet sample_format = to_sample_format(format)) {
+        _sample_format = *sample_format;
+    } else {
+        throw io_error("Audio device {} uses an unsupported sample format", name());
+    }
+    _number_of_channels = format.Format.nChannels;
+    _bytes_per_frame = format.Format.nBlockAlign;
+
+    UINT32 buffer_size;
+    tt_hresult_check(_audio_client->GetBufferSize(&buffer_size));
+    _buffer_size = buffer_size;
+
+    if (_exclusive && _buffer_size % static_cast<size_t>(audio_block::samples_per_vector) != 0) {
+        throw io_error(
+            "Audio device {} uses a period of {} frames, which is not a multiple of {}",
+            name(),
+            _buffer_size,
+            audio_block::samples_per_vector);
+    } else if (_buffer_size < block_size) {
+        throw io_error("Audio device {} has a buffer of {} frames, smaller than a block of {}", name(), _buffer_size, block_size);
+    }
+
+    return _exclusive ? _buffer_size : block_size;
+}
+
+void audio_device_win32::allocate_block(size_t block_size) noexcept
+{
+    constexpr auto alignment = static_cast<size_t>(audio_block::samples_per_vector);
+    tt_axiom(block_size % alignment == 0);
+
+    // Allocate extra samples so that the block can be aligned to a whole vector.
+    _samples.assign(_number_of_channels * block_size + alignment, 0.0f);
+    ttlet misalignment = reinterpret_cast<uintptr_t>(_samples.data()) % (alignment * sizeof(float)) / sizeof(float);
+    ttlet offset = (alignment - misalignment) % alignment;
+
+    _block = {};
+    _block.number_of_vectors = narrow_cast<ssize_t>(block_size / alignment);
+    _block.number_of_channels = narrow_cast<ssize_t>(_number_of_channels);
+    _block.samples = std::span{_samples.data() + offset, _number_of_channels * block_size};
+    _block.sample_position = 0;
+    _block.timestamp = hires_utc_clock::time_point::max();
+    _block.word_clock_sample_rate = _sample_rate;
+    _block.device_sample_rate = _sample_rate;
+    _block_fill = 0;
+}
+
+void audio_device_win32::stream_proc(std::stop_token stop_token) noexcept
+{
+    set_thread_name("audio_stream");
+    ttlet com_result = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+    // The multimedia class scheduler gives the thread a real-time priority.
+    DWORD task_index = 0;
+    ttlet task = AvSetMmThreadCharacteristicsW(L"Pro Audio", &task_index);
+    if (task == nullptr) {
+        tt_log_warning("Could not register the audio stream thread as 'Pro Audio': '{}'", get_last_error_message());
+    }
+
+    // Keep the stream off the efficiency cores of a hybrid CPU, where a block may not be ready in time.
+    try {
+        set_thread_affinity_mask(cpu_mask(cpu_core_type::performance));
+    } catch (os_error const &e) {
+        tt_log_warning("Could not set the affinity of the audio stream thread: '{}'", e.what());
+    }
+
+    try {
+        while (not stop_token.stop_requested()) {
+            // The timeout is there to check for a stop request, when the device stopped signaling.
+            if (WaitForSingleObject(_stream_event, 100) != WAIT_OBJECT_0) {
+                continue;
+            }
+
+            if (_capture_client) {
+                capture();
+            } else {
+                render();
+            }
+        }
+    } catch (std::exception const &e) {
+        tt_log_error("The audio stream on {} has stopped: {}", name(), e.what());
+    }
+
+    if (task != nullptr) {
+        AvRevertMmThreadCharacteristics(task);
+    }
+    if (SUCCEEDED(com_result)) {
+        CoUninitialize();
+    }
+}
+
+void audio_device_win32::render()
+{
+    ttlet block_size = narrow_cast<size_t>(_block.number_of_samples());
+
+    auto available = _buffer_size;
+    if (not _exclusive) {
+        UINT32 padding;
+        tt_hresult_check(_audio_client->GetCurrentPadding(&padding));
+        available -= padding;
+    }
+
+    auto input_block = audio_block{};
+    input_block.timestamp = hires_utc_clock::time_point::max();
+    input_block.silent = true;
+
+    while (available >= block_size) {
+        BYTE *data;
+        tt_hresult_check(_render_client->GetBuffer(narrow_cast<UINT32>(block_size), &data));
+
+        // The first sample of the block is played after the samples that are still queued.
+        _block.timestamp = hires_utc_clock::now() + to_duration(_buffer_size - available, _sample_rate);
+        _block.silent = false;
+        _block.corrupt = false;
+        measure_block(_block);
+
+        if (auto delegate = _delegate.lock()) {
+            delegate->process_audio(input_block, _block, _block.timestamp);
+        } else {
+            _block.silent = true;
+        }
+
+        if (not _block.silent) {
+            interleave(
+                _sample_format, _block.samples.data(), block_size, _number_of_channels, block_size, reinterpret_cast<std::byte *>(data));
+        }
+        tt_hresult_check(
+            _render_client->ReleaseBuffer(narrow_cast<UINT32>(block_size), _block.silent ? AUDCLNT_BUFFERFLAGS_SILENT : 0));
+
+        _block.sample_position += block_size;
+        available -= block_size;
+    }
+}
+
+void audio_device_win32::capture()
+{
+    ttlet block_size = narrow_cast<size_t>(_block.number_of_samples());
+
+    auto output_block = audio_block{};
+    output_block.timestamp = hires_utc_clock::time_point::max();
+    output_block.silent = true;
+
+    UINT32 packet_size;
+    tt_hresult_check(_capture_client->GetNextPacketSize(&packet_size));
+    while (packet_size != 0) {
+        BYTE *data;
+        UINT32 number_of_frames;
+        DWORD flags;
+        UINT64 qpc_position;
+        tt_hresult_check(_capture_client->GetBuffer(&data, &number_of_frames, &flags, nullptr, &qpc_position));
+
+        if (flags & AUDCLNT_BUFFERFLAGS_DATA_DISCONTINUITY) {
+            increment_counter<"audio_discontinuity">();
+            count_xrun();
+        }
+
+        // Packets do not need to be the size of a block, so the samples are collected in the block
+        // which is processed when it is full.
+        auto offset = 0_uz;
+        while (offset != number_of_frames) {
+            if (_block_fill == 0) {
+                _block.timestamp = to_time_point(qpc_position) + to_duration(offset, _sample_rate);
+            }
+
+            ttlet n = std::min(number_of_frames - offset, block_size - _block_fill);
+            if (flags & AUDCLNT_BUFFERFLAGS_SILENT) {
+                for (auto channel = 0_uz; channel != _number_of_channels; ++channel) {
+                    std::fill_n(_block.samples.data() + channel * block_size + _block_fill, n, 0.0f);
+                }
+            } else {
+                deinterleave(
+                    _sample_format,
+                    reinterpret_cast<std::byte const *>(data) + offset * _bytes_per_frame,
+                    _number_of_channels,
+                    n,
+                    _block.samples.data() + _block_fill,
+                    block_size);
+            }
+            offset += n;
+            _block_fill += n;
+
+            if (_block_fill == block_size) {
+                _block.silent = false;
+                _block.corrupt = false;
+                measure_block(_block);
+                if (auto delegate = _delegate.lock()) {
+                    delegate->process_audio(_block, output_block, _block.timestamp);
+                }
+
+                _block.sample_position += block_size;
+                _block_fill = 0;
+            }
+        }
+
+        tt_hresult_check(_capture_client->ReleaseBuffer(number_of_frames));
+        tt_hresult_check(_capture_client->GetNextPacketSize(&packet_size));
+    }
+}
+
 } // namespace tt
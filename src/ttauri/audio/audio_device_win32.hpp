@@ -5,13 +5,26 @@
 #pragma once
 
 #include "audio_device.hpp"
+#include "audio_block.hpp"
+#include <thread>
+#include <mutex>
+#include <stop_token>
+#include <memory>
+#include <vector>
 
 struct IMMDevice;
 struct IPropertyStore;
 struct IMMEndpoint;
+struct IAudioClient;
+struct IAudioRenderClient;
+struct IAudioCaptureClient;
 
 namespace tt {
 
+/** The format of the samples in the buffer of a WASAPI stream.
+ */
+enum class wasapi_sample_format { float32, int32, int24_in_32, int24, int16 };
+
 /*! A class representing an audio device on the system.
 */
 class audio_device_win32 : public audio_device {
@@ -25,6 +38,20 @@ public:
     audio_device_state state() const noexcept override;
     audio_device_flow_direction direction() const noexcept override;
 
+    /** Start an event driven WASAPI stream.
+     * In shared mode the sample rate is the one of the operating system's mixer, and the
+     * block size may go down to the period of the mixer's low latency mode.
+     * In exclusive mode the block size may go down to the minimum period of the device.
+     */
+    void start_stream(std::weak_ptr<audio_device_delegate> delegate, audio_stream_config const &config) override;
+    void stop_stream() noexcept override;
+
+    /** Query the properties of the device, and cache them.
+     * The getters return the cached properties and do not call into COM, this function is
+     * called when the device is opened and when the audio system is notified of a change.
+     */
+    void update_properties() noexcept;
+
     static std::string get_id_from_device(IMMDevice *device) noexcept;
 
 private:
@@ -32,6 +59,63 @@ private:
     IMMEndpoint *_endpoint;
     IPropertyStore *_property_store;
 
+    /** The id and direction never change for an end-point.
+     */
+    std::string _id;
+    audio_device_flow_direction _direction;
+
+    /** Protects the cached properties that may change, which are updated from the audio system's thread.
+     */
+    mutable std::mutex _properties_mutex;
+    std::string _name;
+    audio_device_state _state = audio_device_state::not_present;
+
+    IAudioClient *_audio_client = nullptr;
+    IAudioRenderClient *_render_client = nullptr;
+    IAudioCaptureClient *_capture_client = nullptr;
+
+    /** The event that is signaled by WASAPI when the device is ready for the next period.
+     */
+    void *_stream_event = nullptr;
+
+    std::jthread _stream_thread;
+    std::weak_ptr<audio_device_delegate> _delegate;
+
+    wasapi_sample_format _sample_format = wasapi_sample_format::float32;
+    size_t _number_of_channels = 0;
+    size_t _bytes_per_frame = 0;
+    double _sample_rate = 0.0;
+    bool _exclusive = false;
+
+    /** The number of frames in the buffer of the device.
+     */
+    size_t _buffer_size = 0;
+
+    /** The samples of the block which is exchanged with the delegate.
+     * Allocated when the stream starts, so that the stream thread does not allocate.
+     */
+    std::vector<float> _samples;
+    audio_block _block = {};
+
+    /** The number of frames captured into `_block` so far.
+     */
+    size_t _block_fill = 0;
+
+    /** Initialize the audio client, and select the sample format and period.
+     * @return The number of frames in a block.
+     */
+    size_t initialize_audio_client(audio_stream_config const &config);
+
+    void allocate_block(size_t block_size) noexcept;
+
+    void stream_proc(std::stop_token stop_token) noexcept;
+    void render();
+    void capture();
+
+    [[nodiscard]] std::string query_name() const noexcept;
+    [[nodiscard]] audio_device_state query_state() const noexcept;
+    [[nodiscard]] audio_device_flow_direction query_direction() const noexcept;
+
     /** Get a user friendly name of the audio device.
      * This is the name of the audio device itself, such as
      * "Realtek High Definition Audio".
@@ -0,0 +1,223 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "audio_dsp.hpp"
+#include "../geometry/numeric_array.hpp"
+#include "../assert.hpp"
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+#include <type_traits>
+
+namespace tt::dsp {
+
+/** The widest vector of floats with a SIMD backend.
+ */
+using vector_type = std::conditional_t<has_avx, f32x8, f32x4>;
+constexpr auto vector_size = sizeof(vector_type) / sizeof(float);
+
+[[nodiscard]] static vector_type load(float const *ptr) noexcept
+{
+    auto r = std::array<float, vector_size>{};
+    std::memcpy(r.data(), ptr, sizeof(r));
+    return vector_type{r};
+}
+
+static void store(float *ptr, vector_type const &rhs) noexcept
+{
+    ttlet tmp = static_cast<std::array<float, vector_size>>(rhs);
+    std::memcpy(ptr, tmp.data(), sizeof(tmp));
+}
+
+/** The number of samples that can be processed as whole vectors.
+ */
+[[nodiscard]] static size_t vector_end(size_t size) noexcept
+{
+    return size - size % vector_size;
+}
+
+void gain(std::span<float> samples, float gain) noexcept
+{
+    ttlet gain_ = vector_type::broadcast(gain);
+
+    auto i = 0_uz;
+    for (ttlet end = vector_end(samples.size()); i != end; i += vector_size) {
+        store(&samples[i], load(&samples[i]) * gain_);
+    }
+    for (; i != samples.size(); ++i) {
+        samples[i] *= gain;
+    }
+}
+
+void ramp(std::span<float> samples, float start_gain, float end_gain) noexcept
+{
+    if (samples.empty()) {
+        return;
+    }
+
+    ttlet step = (end_gain - start_gain) / static_cast<float>(samples.size());
+
+    auto offsets = vector_type{};
+    for (auto j = 0_uz; j != vector_size; ++j) {
+        offsets[j] = static_cast<float>(j);
+    }
+    ttlet step_ = vector_type::broadcast(step);
+
+    // Calculate the gain from the index, instead of accumulating, so that rounding errors do not add up.
+    auto i = 0_uz;
+    for (ttlet end = vector_end(samples.size()); i != end; i += vector_size) {
+        ttlet gain_ = vector_type::broadcast(start_gain) + (vector_type::broadcast(static_cast<float>(i)) + offsets) * step_;
+        store(&samples[i], load(&samples[i]) * gain_);
+    }
+    for (; i != samples.size(); ++i) {
+        samples[i] *= start_gain + static_cast<float>(i) * step;
+    }
+}
+
+void mix(std::span<float> dst, std::span<float const> src, float gain) noexcept
+{
+    tt_axiom(dst.size() == src.size());
+    ttlet gain_ = vector_type::broadcast(gain);
+
+    auto i = 0_uz;
+    for (ttlet end = vector_end(dst.size()); i != end; i += vector_size) {
+        store(&dst[i], load(&dst[i]) + load(&src[i]) * gain_);
+    }
+    for (; i != dst.size(); ++i) {
+        dst[i] += src[i] * gain;
+    }
+}
+
+[[nodiscard]] float peak(std::span<float const> samples) noexcept
+{
+    auto peak_ = vector_type{};
+
+    auto i = 0_uz;
+    for (ttlet end = vector_end(samples.size()); i != end; i += vector_size) {
+        peak_ = max(peak_, abs(load(&samples[i])));
+    }
+
+    auto r = 0.0f;
+    for (auto j = 0_uz; j != vector_size; ++j) {
+        r = std::max(r, peak_[j]);
+    }
+    for (; i != samples.size(); ++i) {
+        r = std::max(r, std::abs(samples[i]));
+    }
+    return r;
+}
+
+[[nodiscard]] float rms(std::span<float const> samples) noexcept
+{
+    if (samples.empty()) {
+        return 0.0f;
+    }
+
+    auto sum = vector_type{};
+
+    auto i = 0_uz;
+    for (ttlet end = vector_end(samples.size()); i != end; i += vector_size) {
+        ttlet v = load(&samples[i]);
+        sum = sum + v * v;
+    }
+
+    // Sum the vector lanes in double precision, a block of a loud signal may have a large total.
+    auto r = 0.0;
+    for (auto j = 0_uz; j != vector_size; ++j) {
+        r += static_cast<double>(sum[j]);
+    }
+    for (; i != samples.size(); ++i) {
+        r += static_cast<double>(samples[i]) * static_cast<double>(samples[i]);
+    }
+    return static_cast<float>(std::sqrt(r / static_cast<double>(samples.size())));
+}
+
+void interleave(audio_block &block, std::span<float> dst) noexcept
+{
+    ttlet number_of_channels = narrow_cast<size_t>(block.number_of_channels);
+    ttlet number_of_samples = narrow_cast<size_t>(block.number_of_samples());
+    tt_axiom(dst.size() == number_of_channels * number_of_samples);
+
+    for (auto channel = 0_uz; channel != number_of_channels; ++channel) {
+        ttlet src = block.samples_for_channel(narrow_cast<ssize_t>(channel));
+        for (auto i = 0_uz; i != number_of_samples; ++i) {
+            dst[i * number_of_channels + channel] = src[i];
+        }
+    }
+}
+
+void deinterleave(std::span<float const> src, audio_block &block) noexcept
+{
+    ttlet number_of_channels = narrow_cast<size_t>(block.number_of_channels);
+    ttlet number_of_samples = narrow_cast<size_t>(block.number_of_samples());
+    tt_axiom(src.size() == number_of_channels * number_of_samples);
+
+    for (auto channel = 0_uz; channel != number_of_channels; ++channel) {
+        auto dst = block.samples_for_channel(narrow_cast<ssize_t>(channel));
+        for (auto i = 0_uz; i != number_of_samples; ++i) {
+            dst[i] = src[i * number_of_channels + channel];
+        }
+    }
+}
+
+// The integer conversions are plain loops; numeric_array has no integer to float conversion with
+// a SIMD backend, and compilers vectorize these loops by themselves.
+
+void convert(std::span<int16_t const> src, std::span<float> dst) noexcept
+{
+    tt_axiom(src.size() == dst.size());
+    for (auto i = 0_uz; i != src.size(); ++i) {
+        dst[i] = static_cast<float>(src[i]) * (1.0f / 32768.0f);
+    }
+}
+
+void convert(std::span<int32_t const> src, std::span<float> dst) noexcept
+{
+    tt_axiom(src.size() == dst.size());
+    for (auto i = 0_uz; i != src.size(); ++i) {
+        dst[i] = static_cast<float>(src[i]) * (1.0f / 2147483648.0f);
+    }
+}
+
+void convert_int24(std::span<std::byte const> src, std::span<float> dst) noexcept
+{
+    tt_axiom(src.size() == dst.size() * 3);
+    for (auto i = 0_uz; i != dst.size(); ++i) {
+        // Place the 24 bit value in the top of a 32 bit integer, to sign extend it.
+        ttlet sample = static_cast<int32_t>(
+            static_cast<uint32_t>(src[i * 3]) << 8 | static_cast<uint32_t>(src[i * 3 + 1]) << 16 |
+            static_cast<uint32_t>(src[i * 3 + 2]) << 24);
+        dst[i] = static_cast<float>(sample) * (1.0f / 2147483648.0f);
+    }
+}
+
+void convert(std::span<float const> src, std::span<int16_t> dst) noexcept
+{
+    tt_axiom(src.size() == dst.size());
+    for (auto i = 0_uz; i != src.size(); ++i) {
+        dst[i] = static_cast<int16_t>(std::lround(std::clamp(src[i], -1.0f, 1.0f) * 32767.0f));
+    }
+}
+
+void convert(std::span<float const> src, std::span<int32_t> dst) noexcept
+{
+    tt_axiom(src.size() == dst.size());
+    for (auto i = 0_uz; i != src.size(); ++i) {
+        // A float does not have the precision of 2147483647, scale in double to not overflow at 1.0.
+        dst[i] = static_cast<int32_t>(std::llround(static_cast<double>(std::clamp(src[i], -1.0f, 1.0f)) * 2147483647.0));
+    }
+}
+
+void convert_int24(std::span<float const> src, std::span<std::byte> dst) noexcept
+{
+    tt_axiom(src.size() * 3 == dst.size());
+    for (auto i = 0_uz; i != src.size(); ++i) {
+        ttlet sample = static_cast<uint32_t>(static_cast<int32_t>(std::lround(std::clamp(src[i], -1.0f, 1.0f) * 8388607.0f)));
+        dst[i * 3] = static_cast<std::byte>(sample);
+        dst[i * 3 + 1] = static_cast<std::byte>(sample >> 8);
+        dst[i * 3 + 2] = static_cast<std::byte>(sample >> 16);
+    }
+}
+
+} // namespace tt::dsp
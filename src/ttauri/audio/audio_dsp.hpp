@@ -0,0 +1,84 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "audio_block.hpp"
+#include "../required.hpp"
+#include <span>
+#include <cstdint>
+#include <cstddef>
+
+/** Kernels for processing the samples of audio blocks.
+ *
+ * The kernels work on the spans returned by `audio_block::samples_for_channel()`;
+ * the floating point kernels use the SIMD backends of `numeric_array`. The spans may have
+ * any length, the samples after the last whole vector are processed one at a time.
+ */
+namespace tt::dsp {
+
+/** Multiply samples by a gain.
+ */
+void gain(std::span<float> samples, float gain) noexcept;
+
+/** Multiply samples by a gain which changes linearly from start_gain to end_gain.
+ * The first sample is multiplied by `start_gain`, the sample after the last sample would be
+ * multiplied by `end_gain`; so that consecutive ramps connect without discontinuity.
+ */
+void ramp(std::span<float> samples, float start_gain, float end_gain) noexcept;
+
+/** Add samples multiplied by a gain to other samples.
+ * With a gain of 1.0 this sums the two spans.
+ *
+ * @param dst The samples to add to.
+ * @param src The samples to add, the same length as `dst`.
+ */
+void mix(std::span<float> dst, std::span<float const> src, float gain = 1.0f) noexcept;
+
+/** The largest absolute value of the samples.
+ */
+[[nodiscard]] float peak(std::span<float const> samples) noexcept;
+
+/** The root mean square of the samples.
+ * @return The RMS level, or zero when there are no samples.
+ */
+[[nodiscard]] float rms(std::span<float const> samples) noexcept;
+
+/** Interleave the channels of a block.
+ *
+ * @param block A block with samples.
+ * @param dst The interleaved samples, `block.number_of_channels * block.number_of_samples()` long.
+ */
+void interleave(audio_block &block, std::span<float> dst) noexcept;
+
+/** Deinterleave samples into the channels of a block.
+ *
+ * @param src The interleaved samples, `block.number_of_channels * block.number_of_samples()` long.
+ * @param block A block with samples.
+ */
+void deinterleave(std::span<float const> src, audio_block &block) noexcept;
+
+/** Convert integer samples to float, in the range -1.0 to 1.0.
+ * The spans must have the same length.
+ */
+void convert(std::span<int16_t const> src, std::span<float> dst) noexcept;
+void convert(std::span<int32_t const> src, std::span<float> dst) noexcept;
+
+/** Convert packed little endian 24 bit samples to float, in the range -1.0 to 1.0.
+ * @param src Three bytes for each sample in `dst`.
+ */
+void convert_int24(std::span<std::byte const> src, std::span<float> dst) noexcept;
+
+/** Convert float samples to integer, clipping samples outside the range -1.0 to 1.0.
+ * The spans must have the same length.
+ */
+void convert(std::span<float const> src, std::span<int16_t> dst) noexcept;
+void convert(std::span<float const> src, std::span<int32_t> dst) noexcept;
+
+/** Convert float samples to packed little endian 24 bit samples, clipping samples outside the range -1.0 to 1.0.
+ * @param dst Three bytes for each sample in `src`.
+ */
+void convert_int24(std::span<float const> src, std::span<std::byte> dst) noexcept;
+
+} // namespace tt::dsp
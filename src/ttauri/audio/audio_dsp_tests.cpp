@@ -0,0 +1,134 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/audio/audio_dsp.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+#include <cmath>
+
+using namespace std;
+using namespace tt;
+
+// 37 samples, so that both the vector loop and the tail are used.
+static std::vector<float> make_samples(size_t size = 37)
+{
+    auto r = std::vector<float>(size);
+    for (auto i = 0_uz; i != size; ++i) {
+        r[i] = static_cast<float>(i) * 0.05f - 0.9f;
+    }
+    return r;
+}
+
+TEST(AudioDSP, Gain)
+{
+    auto samples = make_samples();
+    dsp::gain(samples, 0.5f);
+
+    ttlet expected = make_samples();
+    for (auto i = 0_uz; i != samples.size(); ++i) {
+        ASSERT_FLOAT_EQ(samples[i], expected[i] * 0.5f);
+    }
+}
+
+TEST(AudioDSP, Ramp)
+{
+    auto samples = std::vector<float>(37, 1.0f);
+    dsp::ramp(samples, 0.0f, 37.0f);
+
+    for (auto i = 0_uz; i != samples.size(); ++i) {
+        ASSERT_FLOAT_EQ(samples[i], static_cast<float>(i));
+    }
+}
+
+TEST(AudioDSP, Mix)
+{
+    auto dst = make_samples();
+    ttlet src = make_samples();
+    dsp::mix(dst, src, 2.0f);
+
+    for (auto i = 0_uz; i != dst.size(); ++i) {
+        ASSERT_FLOAT_EQ(dst[i], src[i] * 3.0f);
+    }
+}
+
+TEST(AudioDSP, PeakRMS)
+{
+    auto samples = std::vector<float>(37, 0.5f);
+    samples[36] = -0.75f;
+    ASSERT_FLOAT_EQ(dsp::peak(samples), 0.75f);
+
+    samples[36] = 0.5f;
+    samples[3] = -0.5f;
+    ASSERT_FLOAT_EQ(dsp::rms(samples), 0.5f);
+
+    ASSERT_EQ(dsp::peak({}), 0.0f);
+    ASSERT_EQ(dsp::rms({}), 0.0f);
+}
+
+TEST(AudioDSP, InterleaveDeinterleave)
+{
+    auto samples = std::vector<float>(2 * audio_block::samples_per_vector);
+    auto block = audio_block{};
+    block.number_of_channels = 2;
+    block.number_of_vectors = 1;
+    block.samples = samples;
+
+    auto interleaved = std::vector<float>(samples.size());
+    for (auto i = 0_uz; i != interleaved.size(); ++i) {
+        interleaved[i] = static_cast<float>(i);
+    }
+
+    dsp::deinterleave(interleaved, block);
+    ASSERT_EQ(block.samples_for_channel(0)[1], 2.0f);
+    ASSERT_EQ(block.samples_for_channel(1)[1], 3.0f);
+
+    auto result = std::vector<float>(samples.size());
+    dsp::interleave(block, result);
+    ASSERT_EQ(result, interleaved);
+}
+
+TEST(AudioDSP, ConvertInt16)
+{
+    ttlet src = std::vector<float>{-1.0f, -0.5f, 0.0f, 0.5f, 1.0f, 2.0f};
+    auto integers = std::vector<int16_t>(src.size());
+    dsp::convert(src, integers);
+    ASSERT_EQ(integers, (std::vector<int16_t>{-32767, -16384, 0, 16384, 32767, 32767}));
+
+    auto dst = std::vector<float>(src.size());
+    dsp::convert(integers, dst);
+    for (auto i = 0_uz; i != 5; ++i) {
+        ASSERT_NEAR(dst[i], src[i], 1.0f / 32768.0f);
+    }
+}
+
+TEST(AudioDSP, ConvertInt24)
+{
+    ttlet src = std::vector<float>{-1.0f, -0.5f, 0.0f, 0.25f, 1.0f};
+    auto bytes = std::vector<std::byte>(src.size() * 3);
+    dsp::convert_int24(src, bytes);
+    ASSERT_EQ(bytes[0], std::byte{0x01});
+    ASSERT_EQ(bytes[1], std::byte{0x00});
+    ASSERT_EQ(bytes[2], std::byte{0x80});
+
+    auto dst = std::vector<float>(src.size());
+    dsp::convert_int24(bytes, dst);
+    for (auto i = 0_uz; i != src.size(); ++i) {
+        ASSERT_NEAR(dst[i], src[i], 1.0f / 8388608.0f);
+    }
+}
+
+TEST(AudioDSP, ConvertInt32)
+{
+    ttlet src = std::vector<float>{-1.0f, -0.5f, 0.0f, 0.25f, 1.0f};
+    auto integers = std::vector<int32_t>(src.size());
+    dsp::convert(src, integers);
+    ASSERT_EQ(integers[4], 2147483647);
+    ASSERT_EQ(integers[0], -2147483647);
+
+    auto dst = std::vector<float>(src.size());
+    dsp::convert(integers, dst);
+    for (auto i = 0_uz; i != src.size(); ++i) {
+        ASSERT_NEAR(dst[i], src[i], 1e-6f);
+    }
+}
@@ -0,0 +1,136 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "audio_measurement.hpp"
+#include "../assert.hpp"
+#include "../cast.hpp"
+#include <cmath>
+#include <algorithm>
+#include <chrono>
+
+namespace tt {
+
+audio_clock_drift_estimator::audio_clock_drift_estimator(double nominal_sample_rate, hires_utc_clock::duration tolerance) noexcept :
+    _nominal_sample_rate(nominal_sample_rate), _tolerance(std::chrono::duration<double>(tolerance).count())
+{
+}
+
+void audio_clock_drift_estimator::reset(double nominal_sample_rate) noexcept
+{
+    _nominal_sample_rate = nominal_sample_rate;
+    _discontinuities = 0;
+    _count = 0;
+}
+
+[[nodiscard]] double audio_clock_drift_estimator::slope() const noexcept
+{
+    if (_count >= 2 and _m_xx > 0.0) {
+        return _m_xy / _m_xx;
+    } else if (_nominal_sample_rate > 0.0) {
+        return 1.0 / _nominal_sample_rate;
+    } else {
+        return 0.0;
+    }
+}
+
+bool audio_clock_drift_estimator::update(uint64_t sample_position, hires_utc_clock::time_point timestamp) noexcept
+{
+    if (_count == 0 or sample_position < _origin_position) {
+        _origin_position = sample_position;
+        _origin_timestamp = timestamp;
+        _count = 1;
+        _mean_x = 0.0;
+        _mean_y = 0.0;
+        _m_xx = 0.0;
+        _m_xy = 0.0;
+        return true;
+    }
+
+    ttlet x = static_cast<double>(sample_position - _origin_position);
+    ttlet y = std::chrono::duration<double>(timestamp - _origin_timestamp).count();
+
+    // Check the measurement against the line through the previous measurements.
+    ttlet predicted_y = _mean_y + (x - _mean_x) * slope();
+    if (_nominal_sample_rate > 0.0 and std::abs(y - predicted_y) > _tolerance) {
+        ++_discontinuities;
+        _count = 0;
+        update(sample_position, timestamp);
+        return false;
+    }
+
+    // Welford's online algorithm, the co-moments are updated with the deltas from the means.
+    ++_count;
+    ttlet n = static_cast<double>(_count);
+    ttlet dx = x - _mean_x;
+    _mean_x += dx / n;
+    _mean_y += (y - _mean_y) / n;
+    _m_xx += dx * (x - _mean_x);
+    _m_xy += dx * (y - _mean_y);
+    return true;
+}
+
+[[nodiscard]] double audio_clock_drift_estimator::sample_rate() const noexcept
+{
+    ttlet slope_ = slope();
+    return slope_ > 0.0 ? 1.0 / slope_ : _nominal_sample_rate;
+}
+
+[[nodiscard]] double audio_clock_drift_estimator::drift_ppm() const noexcept
+{
+    if (_nominal_sample_rate > 0.0) {
+        return (sample_rate() / _nominal_sample_rate - 1.0) * 1'000'000.0;
+    } else {
+        return 0.0;
+    }
+}
+
+audio_loopback_latency_test::audio_loopback_latency_test(size_t interval, float threshold) noexcept :
+    _interval(interval), _threshold(threshold)
+{
+    tt_axiom(interval > 0);
+}
+
+void audio_loopback_latency_test::process(audio_block &input, audio_block &output) noexcept
+{
+    ttlet number_of_samples = narrow_cast<size_t>(output.number_of_samples());
+
+    if (input.timestamp != hires_utc_clock::time_point::max() and output.timestamp != hires_utc_clock::time_point::max()) {
+        _reported_latency = output.timestamp - input.timestamp;
+    }
+
+    // Search for the impulse before writing the next, so that the impulse is never found in the same block.
+    if (_impulse_position and not input.samples.empty() and input.number_of_channels > 0) {
+        ttlet samples = input.samples_for_channel(0);
+        ttlet it = std::find_if(samples.begin(), samples.end(), [this](ttlet sample) {
+            return std::abs(sample) >= _threshold;
+        });
+        if (it != samples.end()) {
+            _latency = _position + narrow_cast<size_t>(std::distance(samples.begin(), it)) - *_impulse_position;
+            _impulse_position = {};
+        }
+    }
+
+    output.silent = false;
+    for (auto channel = 0; channel != output.number_of_channels; ++channel) {
+        ttlet samples = output.samples_for_channel(channel);
+        std::fill(samples.begin(), samples.end(), 0.0f);
+    }
+
+    // Write an impulse at each multiple of the interval within this block.
+    ttlet first = (_position + _interval - 1) / _interval * _interval;
+    for (auto position = first; position < _position + number_of_samples; position += _interval) {
+        if (_impulse_position) {
+            ++_missed;
+        }
+        _impulse_position = position;
+
+        for (auto channel = 0; channel != output.number_of_channels; ++channel) {
+            output.samples_for_channel(channel)[position - _position] = 1.0f;
+        }
+    }
+
+    _position += number_of_samples;
+}
+
+} // namespace tt
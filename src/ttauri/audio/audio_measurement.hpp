@@ -0,0 +1,188 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "audio_block.hpp"
+#include "../hires_utc_clock.hpp"
+#include "../required.hpp"
+#include <optional>
+#include <cstdint>
+#include <cstddef>
+
+namespace tt {
+
+/** Estimates the sample rate of an audio device, measured against `hires_utc_clock`.
+ *
+ * A device's sample clock runs from its own crystal, which is a little fast or slow compared
+ * to the clock of the computer. The estimator fits a line through the timestamp and sample position
+ * of each block; the slope of the line is the real sample rate of the device.
+ *
+ * A block whose timestamp is far from the line is a discontinuity, caused by samples that were
+ * dropped or inserted by the device or its driver (an xrun). A discontinuity restarts the fit.
+ */
+class audio_clock_drift_estimator {
+public:
+    /** Create an estimator.
+     *
+     * @param nominal_sample_rate The sample rate the device was configured to.
+     * @param tolerance The maximum difference between a timestamp and the fitted line, before
+     *                  a block is treated as a discontinuity.
+     */
+    audio_clock_drift_estimator(
+        double nominal_sample_rate = 0.0,
+        hires_utc_clock::duration tolerance = std::chrono::milliseconds(2)) noexcept;
+
+    /** Forget all measurements.
+     */
+    void reset(double nominal_sample_rate) noexcept;
+
+    /** Start a new fit at the next measurement.
+     * This is used after a discontinuity that was reported by the device, so that it is not counted twice.
+     */
+    void restart() noexcept
+    {
+        _count = 0;
+    }
+
+    /** Add a measurement.
+     *
+     * @param sample_position The position of the first sample of a block.
+     * @param timestamp The time when the first sample of the block was captured or will be played.
+     * @return False if the measurement was a discontinuity.
+     */
+    bool update(uint64_t sample_position, hires_utc_clock::time_point timestamp) noexcept;
+
+    /** Add a measurement from a block.
+     * Blocks without a valid timestamp are ignored.
+     */
+    bool update(audio_block const &block) noexcept
+    {
+        if (block.timestamp == hires_utc_clock::time_point::max()) {
+            return true;
+        }
+        return update(block.sample_position, block.timestamp);
+    }
+
+    /** The number of measurements since the last discontinuity.
+     */
+    [[nodiscard]] size_t size() const noexcept
+    {
+        return _count;
+    }
+
+    [[nodiscard]] double nominal_sample_rate() const noexcept
+    {
+        return _nominal_sample_rate;
+    }
+
+    /** The measured sample rate.
+     * @return The measured sample rate, or the nominal sample rate before there are enough measurements.
+     */
+    [[nodiscard]] double sample_rate() const noexcept;
+
+    /** The drift of the device's clock, in parts per million.
+     * A positive drift means that the device's clock is faster than `hires_utc_clock`.
+     */
+    [[nodiscard]] double drift_ppm() const noexcept;
+
+    /** The number of discontinuities since the estimator was reset.
+     */
+    [[nodiscard]] size_t discontinuities() const noexcept
+    {
+        return _discontinuities;
+    }
+
+private:
+    double _nominal_sample_rate;
+    double _tolerance;
+    size_t _discontinuities = 0;
+
+    /** The measurement that is used as the origin, to keep the sums small.
+     */
+    uint64_t _origin_position = 0;
+    hires_utc_clock::time_point _origin_timestamp = {};
+
+    /** The running means and co-moments of the sample positions (x) and timestamps (y) in seconds.
+     */
+    size_t _count = 0;
+    double _mean_x = 0.0;
+    double _mean_y = 0.0;
+    double _m_xx = 0.0;
+    double _m_xy = 0.0;
+
+    /** The seconds per sample of the fitted line.
+     */
+    [[nodiscard]] double slope() const noexcept;
+};
+
+/** Measure the round trip latency of an audio stream with a loopback cable.
+ *
+ * The test writes an impulse to the output at a fixed interval and waits for it to appear on the
+ * input; the cable from the output to the input closes the loop. The latency is the number of
+ * samples between writing and reading the impulse, which includes the buffers of the application,
+ * the driver, the converters and the hardware.
+ *
+ * It also records the latency reported by the timestamps of the blocks, so that the two can be compared.
+ */
+class audio_loopback_latency_test {
+public:
+    /** Create a test.
+     *
+     * @param interval The number of samples between impulses, longer than the expected latency.
+     * @param threshold The level at which an input sample is detected as the impulse.
+     */
+    audio_loopback_latency_test(size_t interval, float threshold = 0.5f) noexcept;
+
+    /** Process a duplex block.
+     * The output block is overwritten with the test signal; the first channel of the input block
+     * is searched for the impulse.
+     *
+     * @param input The block captured at the same time as output is rendered.
+     * @param output The block to render.
+     */
+    void process(audio_block &input, audio_block &output) noexcept;
+
+    /** The last measured round trip latency in samples.
+     * @return The latency, or empty when no impulse was detected yet.
+     */
+    [[nodiscard]] std::optional<size_t> latency() const noexcept
+    {
+        return _latency;
+    }
+
+    /** The latency reported by the timestamps of the last pair of blocks.
+     * This is the time between capturing the first sample of the input block and playing the
+     * first sample of the output block.
+     */
+    [[nodiscard]] hires_utc_clock::duration reported_latency() const noexcept
+    {
+        return _reported_latency;
+    }
+
+    /** The number of impulses that were not detected before the next impulse was written.
+     */
+    [[nodiscard]] size_t missed() const noexcept
+    {
+        return _missed;
+    }
+
+private:
+    size_t _interval;
+    float _threshold;
+
+    /** The number of samples processed since the start of the test.
+     */
+    size_t _position = 0;
+
+    /** The position of the last impulse that was written and not yet detected.
+     */
+    std::optional<size_t> _impulse_position;
+
+    std::optional<size_t> _latency;
+    hires_utc_clock::duration _reported_latency = {};
+    size_t _missed = 0;
+};
+
+} // namespace tt
@@ -0,0 +1,94 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/audio/audio_measurement.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+#include <deque>
+#include <chrono>
+
+using namespace std;
+using namespace tt;
+
+[[nodiscard]] static hires_utc_clock::time_point block_time(uint64_t position, double sample_rate) noexcept
+{
+    return hires_utc_clock::time_point{} + std::chrono::hours(1) +
+        std::chrono::nanoseconds(static_cast<int64_t>(static_cast<double>(position) * 1'000'000'000.0 / sample_rate));
+}
+
+TEST(AudioMeasurement, DriftEstimator)
+{
+    auto estimator = audio_clock_drift_estimator(48000.0);
+    ASSERT_EQ(estimator.sample_rate(), 48000.0);
+
+    // A device that runs 50 ppm fast, with a jitter of 100 us on the timestamps.
+    ttlet real_sample_rate = 48000.0 * 1.000'050;
+    for (auto i = 0; i != 10'000; ++i) {
+        ttlet position = static_cast<uint64_t>(i) * 256;
+        ttlet jitter = std::chrono::microseconds((i % 3 - 1) * 100);
+        ASSERT_TRUE(estimator.update(position, block_time(position, real_sample_rate) + jitter));
+    }
+
+    ASSERT_NEAR(estimator.sample_rate(), real_sample_rate, 0.01);
+    ASSERT_NEAR(estimator.drift_ppm(), 50.0, 0.5);
+    ASSERT_EQ(estimator.discontinuities(), 0);
+}
+
+TEST(AudioMeasurement, DriftEstimatorDiscontinuity)
+{
+    auto estimator = audio_clock_drift_estimator(48000.0);
+
+    for (auto i = 0; i != 100; ++i) {
+        ttlet position = static_cast<uint64_t>(i) * 256;
+        ASSERT_TRUE(estimator.update(position, block_time(position, 48000.0)));
+    }
+
+    // Samples were lost, the next block is 10 ms later than its position.
+    ttlet position = 100_uz * 256;
+    ASSERT_FALSE(estimator.update(position, block_time(position, 48000.0) + std::chrono::milliseconds(10)));
+    ASSERT_EQ(estimator.discontinuities(), 1);
+    ASSERT_EQ(estimator.size(), 1);
+
+    // The fit restarts after the discontinuity.
+    ttlet next_position = position + 256;
+    ASSERT_TRUE(estimator.update(next_position, block_time(next_position, 48000.0) + std::chrono::milliseconds(10)));
+    ASSERT_NEAR(estimator.sample_rate(), 48000.0, 1.0);
+}
+
+TEST(AudioMeasurement, LoopbackLatency)
+{
+    constexpr auto number_of_vectors = 4;
+    constexpr auto block_size = number_of_vectors * audio_block::samples_per_vector;
+    constexpr auto loopback_delay = 147_uz;
+
+    auto test = audio_loopback_latency_test(1000);
+
+    auto input_samples = std::vector<float>(block_size);
+    auto output_samples = std::vector<float>(block_size);
+    auto input = audio_block{};
+    input.number_of_channels = 1;
+    input.number_of_vectors = number_of_vectors;
+    input.samples = input_samples;
+    input.timestamp = hires_utc_clock::time_point::max();
+    auto output = input;
+    output.samples = output_samples;
+
+    // Simulate the cable and the buffers of the device with a delay line.
+    auto delay_line = std::deque<float>(loopback_delay, 0.0f);
+
+    for (auto i = 0; i != 100; ++i) {
+        test.process(input, output);
+
+        for (auto j = 0_uz; j != block_size; ++j) {
+            delay_line.push_back(output_samples[j]);
+            input_samples[j] = delay_line.front();
+            delay_line.pop_front();
+        }
+    }
+
+    // The input that is read in the next call was captured during the previous call.
+    ASSERT_TRUE(test.latency());
+    ASSERT_EQ(*test.latency(), loopback_delay + block_size);
+    ASSERT_EQ(test.missed(), 0);
+}
@@ -0,0 +1,121 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "audio_resampler.hpp"
+#include "../geometry/numeric_array.hpp"
+#include "../assert.hpp"
+#include <numeric>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+#include <numbers>
+#include <type_traits>
+
+namespace tt {
+
+using resampler_vector_type = std::conditional_t<has_avx, f32x8, f32x4>;
+constexpr auto resampler_vector_size = sizeof(resampler_vector_type) / sizeof(float);
+
+[[nodiscard]] static resampler_vector_type resampler_load(float const *ptr) noexcept
+{
+    auto r = std::array<float, resampler_vector_size>{};
+    std::memcpy(r.data(), ptr, sizeof(r));
+    return resampler_vector_type{r};
+}
+
+/** The dot product of the coefficients of a phase with the input samples.
+ * @param size The number of coefficients, a multiple of the vector size.
+ */
+[[nodiscard]] static float resampler_dot(float const *coefficients, float const *samples, size_t size) noexcept
+{
+    tt_axiom(size % resampler_vector_size == 0);
+
+    auto sum = resampler_vector_type{};
+    for (auto i = 0_uz; i != size; i += resampler_vector_size) {
+        sum = sum + resampler_load(coefficients + i) * resampler_load(samples + i);
+    }
+
+    auto r = 0.0f;
+    for (auto i = 0_uz; i != resampler_vector_size; ++i) {
+        r += sum[i];
+    }
+    return r;
+}
+
+polyphase_resampler::polyphase_resampler(size_t up, size_t down, size_t taps_per_phase, size_t max_input_size) noexcept
+{
+    tt_axiom(up > 0 and down > 0);
+    tt_axiom(taps_per_phase > 0);
+
+    ttlet gcd = std::gcd(up, down);
+    _up = up / gcd;
+    _down = down / gcd;
+    _taps_per_phase = (taps_per_phase + resampler_vector_size - 1) / resampler_vector_size * resampler_vector_size;
+    _max_input_size = max_input_size;
+
+    // A Blackman windowed sinc low-pass filter at the up-sampled rate. The cut-off is placed a little
+    // below the lowest of the two Nyquist frequencies, to leave room for the transition band.
+    ttlet number_of_taps = _up * _taps_per_phase;
+    ttlet cutoff = 0.5 / static_cast<double>(std::max(_up, _down)) * 0.9;
+    ttlet center = static_cast<double>(number_of_taps - 1) * 0.5;
+
+    auto filter = std::vector<double>(number_of_taps);
+    for (auto i = 0_uz; i != number_of_taps; ++i) {
+        ttlet x = static_cast<double>(i) - center;
+        ttlet sinc = x == 0.0 ? 2.0 * cutoff : std::sin(2.0 * std::numbers::pi * cutoff * x) / (std::numbers::pi * x);
+
+        ttlet w = 2.0 * std::numbers::pi * static_cast<double>(i) / static_cast<double>(number_of_taps - 1);
+        ttlet window = number_of_taps == 1 ? 1.0 : 0.42 - 0.5 * std::cos(w) + 0.08 * std::cos(2.0 * w);
+
+        // Multiply by up, since up-sampling by zero-stuffing divides the level by up.
+        filter[i] = sinc * window * static_cast<double>(_up);
+    }
+
+    // Split the filter in phases, in reverse order of taps.
+    _coefficients.resize(number_of_taps);
+    for (auto phase = 0_uz; phase != _up; ++phase) {
+        for (auto j = 0_uz; j != _taps_per_phase; ++j) {
+            _coefficients[phase * _taps_per_phase + j] =
+                static_cast<float>(filter[phase + (_taps_per_phase - 1 - j) * _up]);
+        }
+    }
+
+    _history.resize(_taps_per_phase - 1 + _max_input_size);
+    reset();
+}
+
+void polyphase_resampler::reset() noexcept
+{
+    std::fill(_history.begin(), _history.end(), 0.0f);
+    _time = 0;
+}
+
+[[nodiscard]] size_t polyphase_resampler::process(std::span<float const> input, std::span<float> output) noexcept
+{
+    tt_axiom(input.size() <= _max_input_size);
+    tt_axiom(output.size() >= max_output_size(input.size()));
+
+    ttlet history_size = _taps_per_phase - 1;
+    std::copy(input.begin(), input.end(), _history.begin() + history_size);
+
+    // Output sample at up-sampled time t uses the input samples [t / up - (taps_per_phase - 1), t / up],
+    // which are located at [t / up, t / up + taps_per_phase) in the history buffer.
+    ttlet end_time = input.size() * _up;
+    auto output_size = 0_uz;
+    for (; _time < end_time; _time += _down) {
+        ttlet base = _time / _up;
+        ttlet phase = _time % _up;
+        output[output_size++] = resampler_dot(&_coefficients[phase * _taps_per_phase], &_history[base], _taps_per_phase);
+    }
+    _time -= end_time;
+
+    // Keep the last samples for the next call.
+    if (history_size != 0) {
+        ttlet history_begin = _history.begin() + input.size();
+        std::copy(history_begin, history_begin + history_size, _history.begin());
+    }
+    return output_size;
+}
+
+} // namespace tt
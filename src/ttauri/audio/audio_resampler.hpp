@@ -0,0 +1,93 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../required.hpp"
+#include <span>
+#include <vector>
+#include <cstddef>
+
+namespace tt {
+
+/** A polyphase sample rate converter with a rational ratio.
+ *
+ * The input is conceptually up-sampled by `up`, low-pass filtered and then down-sampled
+ * by `down`. Only the filter taps which produce an output sample are calculated; these are
+ * grouped by phase, so that each output sample is a single dot product between the
+ * coefficients of a phase and a contiguous range of input samples.
+ *
+ * All memory is allocated by the constructor, `process()` may be called from the audio thread.
+ */
+class polyphase_resampler {
+public:
+    /** Create a resampler.
+     *
+     * @param up The interpolation factor, for 44100 Hz to 48000 Hz this is 160.
+     * @param down The decimation factor, for 44100 Hz to 48000 Hz this is 147.
+     * @param taps_per_phase The length of the filter for each phase; longer filters have a
+     *                       steeper cut-off. Rounded up to a multiple of the SIMD vector size.
+     * @param max_input_size The maximum number of samples passed to a single call of `process()`.
+     */
+    polyphase_resampler(size_t up, size_t down, size_t taps_per_phase, size_t max_input_size) noexcept;
+
+    polyphase_resampler(polyphase_resampler const &) = delete;
+    polyphase_resampler(polyphase_resampler &&) noexcept = default;
+    polyphase_resampler &operator=(polyphase_resampler const &) = delete;
+    polyphase_resampler &operator=(polyphase_resampler &&) noexcept = default;
+
+    [[nodiscard]] size_t up() const noexcept
+    {
+        return _up;
+    }
+
+    [[nodiscard]] size_t down() const noexcept
+    {
+        return _down;
+    }
+
+    /** The maximum number of output samples that `process()` produces for a number of input samples.
+     */
+    [[nodiscard]] size_t max_output_size(size_t input_size) const noexcept
+    {
+        return (input_size * _up + _down - 1) / _down + 1;
+    }
+
+    /** Convert samples.
+     *
+     * The state of the filter is retained between calls, so a continuous signal can be
+     * converted in blocks of arbitrary size.
+     *
+     * @param input The input samples, at most `max_input_size` samples.
+     * @param output The buffer for the output samples, at least `max_output_size(input.size())` long.
+     * @return The number of samples written to output.
+     */
+    [[nodiscard]] size_t process(std::span<float const> input, std::span<float> output) noexcept;
+
+    /** Clear the history of the filter.
+     */
+    void reset() noexcept;
+
+private:
+    size_t _up;
+    size_t _down;
+    size_t _taps_per_phase;
+    size_t _max_input_size;
+
+    /** The coefficients of each phase, `_taps_per_phase` for each of the `_up` phases.
+     * The coefficients are stored in reverse, so that they can be multiplied with the
+     * input samples in order.
+     */
+    std::vector<float> _coefficients;
+
+    /** The last `_taps_per_phase - 1` input samples, followed by the samples of the current input.
+     */
+    std::vector<float> _history;
+
+    /** The position of the next output sample, in up-sampled samples relative to the start of the current input.
+     */
+    size_t _time = 0;
+};
+
+} // namespace tt
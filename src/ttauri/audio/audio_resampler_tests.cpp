@@ -0,0 +1,72 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/audio/audio_resampler.hpp"
+#include "ttauri/audio/audio_dsp.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+#include <numbers>
+#include <cmath>
+
+using namespace std;
+using namespace tt;
+
+TEST(AudioResampler, ReduceRatio)
+{
+    auto resampler = polyphase_resampler(96000, 88200, 16, 256);
+    ASSERT_EQ(resampler.up(), 160);
+    ASSERT_EQ(resampler.down(), 147);
+}
+
+TEST(AudioResampler, OutputSize)
+{
+    auto resampler = polyphase_resampler(160, 147, 16, 441);
+
+    auto input = std::vector<float>(441);
+    auto output = std::vector<float>(resampler.max_output_size(input.size()));
+
+    // 441 samples at 44100 Hz is 480 samples at 48000 Hz.
+    auto total = 0_uz;
+    for (auto i = 0; i != 10; ++i) {
+        total += resampler.process(input, output);
+    }
+    ASSERT_EQ(total, 4800);
+}
+
+TEST(AudioResampler, DCGain)
+{
+    auto resampler = polyphase_resampler(3, 2, 32, 256);
+
+    auto input = std::vector<float>(256, 0.5f);
+    auto output = std::vector<float>(resampler.max_output_size(input.size()));
+
+    // Skip the first block, while the filter fills up.
+    std::ignore = resampler.process(input, output);
+    ttlet output_size = resampler.process(input, output);
+    ASSERT_EQ(output_size, 384);
+
+    for (auto i = 0_uz; i != output_size; ++i) {
+        ASSERT_NEAR(output[i], 0.5f, 0.005f);
+    }
+}
+
+TEST(AudioResampler, Sine)
+{
+    auto resampler = polyphase_resampler(160, 147, 32, 4410);
+
+    // A 1 kHz sine at 44100 Hz.
+    auto input = std::vector<float>(4410);
+    for (auto i = 0_uz; i != input.size(); ++i) {
+        input[i] = static_cast<float>(std::sin(2.0 * std::numbers::pi * 1000.0 * static_cast<double>(i) / 44100.0));
+    }
+
+    auto output = std::vector<float>(resampler.max_output_size(input.size()));
+    ttlet output_size = resampler.process(input, output);
+    ASSERT_EQ(output_size, 4800);
+
+    // Skip the samples while the filter fills up.
+    ttlet settled = std::span(output).subspan(480, output_size - 480);
+    ASSERT_NEAR(dsp::peak(settled), 1.0f, 0.01f);
+    ASSERT_NEAR(dsp::rms(settled), std::numbers::sqrt2_v<float> * 0.5f, 0.01f);
+}
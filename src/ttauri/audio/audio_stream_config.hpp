@@ -3,11 +3,27 @@
 
 #pragma once
 
+#include <cstddef>
+
 namespace tt {
 
 struct audio_stream_config {
-    double sample_rate;
+    /** The sample rate of the stream.
+     * Zero selects the sample rate that the device is currently configured to.
+     */
+    double sample_rate = 0.0;
+
+    /** The number of samples per channel in each audio_block.
+     * This is rounded up to a multiple of `audio_block::samples_per_vector`.
+     * Zero selects the smallest period that the device supports, for the lowest latency.
+     */
+    size_t block_size = 0;
 
+    /** Take exclusive use of the device.
+     * This bypasses the mixer of the operating system, which allows for shorter periods
+     * and other sample rates; other applications can not use the device during the stream.
+     */
+    bool exclusive = false;
 };
 
-}
\ No newline at end of file
+}
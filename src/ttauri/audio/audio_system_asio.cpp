@@ -0,0 +1,96 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "audio_system_asio.hpp"
+#include "audio_device_asio.hpp"
+#include "../required.hpp"
+#include "../logger.hpp"
+#include "../strings.hpp"
+#include <Windows.h>
+#include <winreg.h>
+#include <array>
+#include <algorithm>
+
+namespace tt {
+
+audio_system_asio::audio_system_asio(std::weak_ptr<audio_system_delegate> const &delegate) : audio_system(delegate) {}
+
+audio_system_asio::~audio_system_asio() {}
+
+void audio_system_asio::init() noexcept
+{
+    ttlet lock = std::scoped_lock(audio_system::mutex);
+
+    audio_system::init();
+    update_device_list();
+    if (auto delegate_ = _delegate.lock()) {
+        delegate_->audio_device_list_changed(*this);
+    }
+}
+
+/** Read a string value from a sub-key of the ASIO registry key.
+ * @return The value, or empty when the value does not exist.
+ */
+[[nodiscard]] static std::wstring get_asio_registry_string(HKEY asio_key, std::wstring const &driver_key, wchar_t const *name) noexcept
+{
+    auto value = std::array<wchar_t, 256>{};
+    DWORD value_size = narrow_cast<DWORD>(value.size() * sizeof(wchar_t));
+    ttlet status = RegGetValueW(asio_key, driver_key.c_str(), name, RRF_RT_REG_SZ, nullptr, value.data(), &value_size);
+    if (status != ERROR_SUCCESS) {
+        return {};
+    }
+    return std::wstring{value.data()};
+}
+
+void audio_system_asio::update_device_list() noexcept
+{
+    ttlet lock = std::scoped_lock(audio_system::mutex);
+
+    HKEY asio_key;
+    if (RegOpenKeyExW(HKEY_LOCAL_MACHINE, L"SOFTWARE\\ASIO", 0, KEY_READ, &asio_key) != ERROR_SUCCESS) {
+        // No ASIO drivers are installed.
+        _devices.clear();
+        return;
+    }
+
+    auto old_devices = _devices;
+    _devices.clear();
+
+    auto driver_key = std::array<wchar_t, 256>{};
+    for (DWORD i = 0; RegEnumKeyW(asio_key, i, driver_key.data(), narrow_cast<DWORD>(driver_key.size())) == ERROR_SUCCESS; ++i) {
+        ttlet driver_key_ = std::wstring{driver_key.data()};
+        ttlet clsid = get_asio_registry_string(asio_key, driver_key_, L"CLSID");
+        if (clsid.empty()) {
+            tt_log_error("ASIO driver {} has no CLSID in the registry", to_string(driver_key_));
+            continue;
+        }
+
+        auto description = get_asio_registry_string(asio_key, driver_key_, L"Description");
+        if (description.empty()) {
+            description = driver_key_;
+        }
+
+        ttlet device_id = audio_device_asio::get_id_from_clsid(clsid);
+        auto it = std::find_if(old_devices.begin(), old_devices.end(), [&device_id](auto &item) {
+            return item->id() == device_id;
+        });
+
+        if (it != old_devices.end()) {
+            // This device was already instantiated.
+            _devices.push_back(std::move(*it));
+            old_devices.erase(it);
+
+        } else {
+            auto device = std::make_shared<audio_device_asio>(clsid, to_string(description));
+            tt_log_info("Found ASIO driver {}", device->name());
+            _devices.push_back(std::move(device));
+        }
+    }
+
+    RegCloseKey(asio_key);
+
+    // Any devices in old_devices that are left over will be deallocated.
+}
+
+} // namespace tt
@@ -1,16 +1,40 @@
-// Copyright Take Vos 2019.
+// Copyright Take Vos 2019-2021.
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #pragma once
 
-#include "AudioSystem.hpp"
+#include "audio_system.hpp"
+#include "audio_system_delegate.hpp"
+#include <memory>
+#include <vector>
 
 namespace tt {
 
-class audio_system_asio: public audio_system {
+/** The ASIO drivers installed on the system.
+ * Each ASIO driver is an audio device with all the inputs and outputs of an audio interface.
+ * The drivers are found in the registry under `HKEY_LOCAL_MACHINE\SOFTWARE\ASIO`; a driver is
+ * only loaded when a stream is started on its device.
+ */
+class audio_system_asio : public audio_system {
+public:
+    using super = audio_system;
 
+    audio_system_asio(std::weak_ptr<audio_system_delegate> const &delegate);
+    ~audio_system_asio();
 
+    void init() noexcept override;
+
+    [[nodiscard]] std::vector<std::shared_ptr<audio_device>> devices() noexcept override
+    {
+        ttlet lock = std::scoped_lock(audio_system::mutex);
+        return _devices;
+    }
+
+    void update_device_list() noexcept;
+
+private:
+    std::vector<std::shared_ptr<audio_device>> _devices;
 };
 
-}
\ No newline at end of file
+} // namespace tt
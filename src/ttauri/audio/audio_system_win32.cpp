@@ -7,6 +7,8 @@
 #include "../required.hpp"
 #include "../logger.hpp"
 #include "../exception.hpp"
+#include "../check.hpp"
+#include "../thread.hpp"
 #include <Windows.h>
 #include <mmdeviceapi.h>
 
@@ -86,26 +88,33 @@ audio_system_win32::audio_system_win32(std::weak_ptr<audio_system_delegate> cons
 
 audio_system_win32::~audio_system_win32()
 {
+    // Stop the notifications before stopping the thread that handles them.
     _device_enumerator->UnregisterEndpointNotificationCallback(_notification_client);
+    if (_update_thread.joinable()) {
+        _update_thread.request_stop();
+        _update_thread.join();
+    }
     delete _notification_client;
     _device_enumerator->Release();
 }
 
 void audio_system_win32::init() noexcept
 {
-    ttlet lock = std::scoped_lock(audio_system::mutex);
-
     audio_system::init();
+
+    // The first list of devices is made directly, so that it is available when init() returns.
     update_device_list();
     if (auto delegate_ = _delegate.lock()) {
         delegate_->audio_device_list_changed(*this);
     }
+
+    _update_thread = std::jthread([this](std::stop_token stop_token) {
+        update_thread_proc(stop_token);
+    });
 }
 
 void audio_system_win32::update_device_list() noexcept
 {
-    ttlet lock = std::scoped_lock(audio_system::mutex);
-
     IMMDeviceCollection *device_collection;
     tt_hresult_check(_device_enumerator->EnumAudioEndpoints(eAll, DEVICE_STATEMASK_ALL, &device_collection));
     tt_assert(device_collection != nullptr);
@@ -113,8 +122,8 @@ void audio_system_win32::update_device_list() noexcept
     UINT number_of_devices;
     tt_hresult_check(device_collection->GetCount(&number_of_devices));
 
-    auto old_devices = _devices;
-    _devices.clear();
+    auto old_devices = devices();
+    auto new_devices = std::vector<std::shared_ptr<audio_device>>{};
     for (UINT i = 0; i < number_of_devices; i++) {
         IMMDevice *win32_device;
         tt_hresult_check(device_collection->Item(i, &win32_device));
@@ -128,51 +137,101 @@ void audio_system_win32::update_device_list() noexcept
         if (it != old_devices.end()) {
             // This device was already instantiated.
             win32_device->Release();
-            _devices.push_back(std::move(*it));
+            new_devices.push_back(std::move(*it));
             old_devices.erase(it);
 
         } else {
             auto device = std::make_shared<audio_device_win32>(win32_device);
             tt_log_info("Found audio device {} state={}", device->name(), device->state());
-            _devices.push_back(std::move(device));
+            new_devices.push_back(std::move(device));
         }
     }
 
     device_collection->Release();
 
+    {
+        ttlet lock = std::scoped_lock(audio_system::mutex);
+        _devices = std::move(new_devices);
+    }
+
     // Any devices in old_devices that are left over will be deallocated.
 }
 
+void audio_system_win32::update_thread_proc(std::stop_token stop_token) noexcept
+{
+    set_thread_name("audio_devices");
+    tt_hresult_check(CoInitializeEx(NULL, COINIT_MULTITHREADED));
+
+    while (true) {
+        auto lock = std::unique_lock(_update_mutex);
+        if (!_update_condition.wait(lock, stop_token, [this] {
+                return _device_list_changed or not _changed_device_ids.empty();
+            })) {
+            break;
+        }
+
+        ttlet device_list_changed = std::exchange(_device_list_changed, false);
+        ttlet changed_device_ids = std::exchange(_changed_device_ids, {});
+        lock.unlock();
+
+        if (device_list_changed) {
+            update_device_list();
+        }
+
+        for (ttlet &device : devices()) {
+            if (std::find(changed_device_ids.begin(), changed_device_ids.end(), device->id()) != changed_device_ids.end()) {
+                static_cast<audio_device_win32 &>(*device).update_properties();
+            }
+        }
+
+        if (auto delegate_ = _delegate.lock()) {
+            delegate_->audio_device_list_changed(*this);
+        }
+    }
+
+    CoUninitialize();
+}
+
+void audio_system_win32::request_update_device_list() noexcept
+{
+    {
+        ttlet lock = std::scoped_lock(_update_mutex);
+        _device_list_changed = true;
+    }
+    _update_condition.notify_one();
+}
+
+void audio_system_win32::request_update_device(std::string device_id) noexcept
+{
+    {
+        ttlet lock = std::scoped_lock(_update_mutex);
+        if (std::find(_changed_device_ids.begin(), _changed_device_ids.end(), device_id) == _changed_device_ids.end()) {
+            _changed_device_ids.push_back(std::move(device_id));
+        }
+    }
+    _update_condition.notify_one();
+}
+
 void audio_system_win32::default_device_changed() noexcept {}
 
 void audio_system_win32::device_added() noexcept
 {
-    update_device_list();
-    if (auto delegate_ = _delegate.lock()) {
-        delegate_->audio_device_list_changed(*this);
-    }
+    request_update_device_list();
 }
 
 void audio_system_win32::device_removed(std::string device_id) noexcept
 {
-    update_device_list();
-    if (auto delegate_ = _delegate.lock()) {
-        delegate_->audio_device_list_changed(*this);
-    }
+    request_update_device_list();
 }
 
 void audio_system_win32::device_state_changed(std::string device_id) noexcept
 {
-    if (auto delegate_ = _delegate.lock()) {
-        delegate_->audio_device_list_changed(*this);
-    }
+    request_update_device(std::move(device_id));
 }
 
 void audio_system_win32::device_property_value_changed(std::string device_id) noexcept
 {
-    if (auto delegate_ = _delegate.lock()) {
-        delegate_->audio_device_list_changed(*this);
-    }
+    request_update_device(std::move(device_id));
 }
 
-} // namespace tt
\ No newline at end of file
+} // namespace tt
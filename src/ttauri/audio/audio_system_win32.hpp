@@ -7,6 +7,12 @@
 #include "audio_system.hpp"
 #include "audio_system_delegate.hpp"
 #include <memory>
+#include <thread>
+#include <stop_token>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <string>
 
 struct IMMDeviceEnumerator;
 
@@ -14,6 +20,12 @@ namespace tt {
 
 class audio_system_win32_notification_client;
 
+/** The audio system for the Windows Audio Session API (WASAPI).
+ *
+ * The notifications from the device enumerator are handled on a separate thread, so that the
+ * notification callbacks return immediately and the GUI never waits on the COM calls that query
+ * the devices. Notifications that arrive while the thread is busy are combined into a single update.
+ */
 class audio_system_win32: public audio_system {
 public:
     using super = audio_system;
@@ -29,6 +41,9 @@ public:
         return _devices;
     }
 
+    /** Enumerate the devices, and create the devices which were not found before.
+     * The device enumerator is queried without holding `audio_system::mutex`.
+     */
     void update_device_list() noexcept;
 
 private:
@@ -36,6 +51,28 @@ private:
     IMMDeviceEnumerator *_device_enumerator;
     audio_system_win32_notification_client *_notification_client;
 
+    std::jthread _update_thread;
+    std::mutex _update_mutex;
+    std::condition_variable_any _update_condition;
+
+    /** A device was added or removed since the last update.
+     */
+    bool _device_list_changed = false;
+
+    /** The ids of devices whose properties or state changed since the last update.
+     */
+    std::vector<std::string> _changed_device_ids;
+
+    void update_thread_proc(std::stop_token stop_token) noexcept;
+
+    /** Request the update thread to enumerate the devices.
+     */
+    void request_update_device_list() noexcept;
+
+    /** Request the update thread to refresh the cached properties of a device.
+     */
+    void request_update_device(std::string device_id) noexcept;
+
     void default_device_changed() noexcept;
     void device_added() noexcept;
     void device_removed(std::string device_id) noexcept;
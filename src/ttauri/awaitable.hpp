@@ -0,0 +1,159 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "coroutine.hpp"
+#include "thread_pool.hpp"
+#include "thread.hpp"
+#include "timer.hpp"
+#include "file.hpp"
+#include "byte_string.hpp"
+#include "URL.hpp"
+#include "resource_view.hpp"
+#include "required.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <memory>
+
+namespace tt {
+
+/** Awaitable to continue a coroutine on a worker of the thread pool.
+ *
+ * ```
+ * co_await resume_on_thread_pool{};
+ * ```
+ */
+class resume_on_thread_pool {
+public:
+    explicit resume_on_thread_pool(thread_pool_priority priority = thread_pool_priority::background) noexcept :
+        _priority(priority)
+    {
+    }
+
+    [[nodiscard]] static bool await_ready() noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) const noexcept
+    {
+        thread_pool_post(
+            [handle] {
+                handle.resume();
+            },
+            _priority);
+    }
+
+    static void await_resume() noexcept {}
+
+private:
+    thread_pool_priority _priority;
+};
+
+/** Awaitable to continue a coroutine on the main thread, from the application's main loop.
+ * This is where the GUI may be modified.
+ */
+class resume_on_main_loop {
+public:
+    [[nodiscard]] static bool await_ready() noexcept
+    {
+        // Always go through the main loop, even on the main thread, like run_from_main_loop().
+        return false;
+    }
+
+    static void await_suspend(std::coroutine_handle<> handle) noexcept
+    {
+        run_from_main_loop([handle] {
+            handle.resume();
+        });
+    }
+
+    static void await_resume() noexcept {}
+};
+
+/** Awaitable to continue a coroutine at a deadline.
+ *
+ * The coroutine is continued on the thread of the timer, or earlier when the timer
+ * is stopped; use `resume_on_thread_pool` to move any real work off the timer's thread.
+ */
+class resume_at {
+public:
+    resume_at(timer &timer, hires_utc_clock::time_point deadline) noexcept : _timer(timer), _deadline(deadline) {}
+
+    [[nodiscard]] bool await_ready() const noexcept
+    {
+        return hires_utc_clock::now() >= _deadline;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) noexcept
+    {
+        // The timer calls its callbacks at multiples of the interval, pick an interval
+        // that is short compared to the time left, without waking up the timer too often.
+        ttlet time_left = _deadline - hires_utc_clock::now();
+        ttlet interval = std::clamp(timer::duration{time_left / 16}, timer::duration{std::chrono::milliseconds{1}}, timer::duration{std::chrono::milliseconds{100}});
+
+        // The callback is removed from the timer when the awaiter, and its _callback, is destroyed
+        // after the coroutine is continued.
+        _callback = _timer.add_callback(interval, [this, handle](auto current_time, bool last) {
+            if (current_time >= _deadline || last) {
+                // The timer may call back before _callback is assigned; the awaiter must not be
+                // destroyed by the continued coroutine before then.
+                while (!_registered.load(std::memory_order::acquire)) {
+                    cpu_pause();
+                }
+                handle.resume();
+            }
+        });
+        _registered.store(true, std::memory_order::release);
+    }
+
+    static void await_resume() noexcept {}
+
+private:
+    timer &_timer;
+    hires_utc_clock::time_point _deadline;
+    timer::callback_ptr_type _callback;
+    std::atomic<bool> _registered = false;
+};
+
+/** Read a whole file on the thread pool.
+ *
+ * The coroutine that awaits the returned task is continued on the worker that read the file.
+ *
+ * @param location The file: URL of the file to read.
+ * @param priority The lane on the thread pool to read the file in.
+ * @return A task with the contents of the file.
+ * @throws io_error On IO error.
+ */
+[[nodiscard]] inline task<bstring>
+read_file_async(URL location, thread_pool_priority priority = thread_pool_priority::background)
+{
+    co_await resume_on_thread_pool{priority};
+
+    auto f = file(location, access_mode::open_for_read);
+    co_return f.read_bstring(narrow_cast<ssize_t>(f.size()));
+}
+
+/** Open a resource on the thread pool.
+ *
+ * The file is mapped, or the static resource is found, on a worker; so that a GUI thread
+ * does not stall on the file system. The coroutine that awaits the returned task is
+ * continued on that worker.
+ *
+ * @param location The location of the resource, see `URL::loadView()`.
+ * @param priority The lane on the thread pool to open the resource in.
+ * @return A task with a view of the resource.
+ * @throws io_error On IO error.
+ */
+[[nodiscard]] inline task<std::unique_ptr<resource_view>>
+load_view_async(URL location, thread_pool_priority priority = thread_pool_priority::background)
+{
+    co_await resume_on_thread_pool{priority};
+    co_return location.loadView();
+}
+
+} // namespace tt
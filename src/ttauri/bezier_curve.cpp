@@ -3,10 +3,13 @@
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #include "bezier_curve.hpp"
+#include "geometry/numeric_array.hpp"
 #include "bezier_point.hpp"
 #include "pixel_map.inl"
 #include "memory.hpp"
 #include <optional>
+#include <array>
+#include <bit>
 
 namespace tt {
 
@@ -98,9 +101,16 @@ std::vector<bezier_curve> makeInverseContour(std::vector<bezier_curve> const &co
 std::vector<bezier_curve> makeParallelContour(std::vector<bezier_curve> const &contour, float offset, LineJoinStyle lineJoinStyle, float tolerance) noexcept
 {
     auto contourAtOffset = std::vector<bezier_curve>{};
+    contourAtOffset.reserve(contour.size());
+
+    auto points = std::array<point2, bezier_curve::max_flatten_count>{};
     for (ttlet &curve: contour) {
-        for (ttlet &flatCurve: curve.subdivideUntilFlat(tolerance)) {
-            contourAtOffset.push_back(flatCurve.toParallelLine(offset));
+        ttlet nr_points = curve.flatten(tolerance, points);
+
+        auto previous_point = curve.P1;
+        for (auto i = 0_uz; i != nr_points; ++i) {
+            contourAtOffset.push_back(bezier_curve{previous_point, points[i]}.toParallelLine(offset));
+            previous_point = points[i];
         }
     }
 
@@ -144,139 +154,174 @@ std::vector<bezier_curve> makeParallelContour(std::vector<bezier_curve> const &c
 }
 
 
-static std::vector<float> solveCurvesXByY(std::vector<bezier_curve> const &v, float y) noexcept {
-    std::vector<float> r;
-    r.reserve(v.size());
-
-    for (ttlet &curve: v) {
-        ttlet xValues = curve.solveXByY(y);
-        for (ttlet x: xValues) {
-            r.push_back(x);
-        }
-    }
-    return r;
-}
-
-
-static std::optional<std::vector<std::pair<float,float>>> getFillSpansAtY(std::vector<bezier_curve> const &v, float y) noexcept
+/** Add the signed area covered by a line to the accumulation buffer.
+ *
+ * Each cell of the buffer receives the change in coverage compared to the cell to its left,
+ * so that the coverage of a pixel is the prefix sum of the cells in its row.
+ *
+ * @param acc The accumulation buffer, with `stride` cells per row.
+ * @param stride The number of cells in a row, the width of the image plus two.
+ * @param height The number of rows.
+ * @param p0 The start of the line, the x-coordinate must be between 0 and the width of the image.
+ * @param p1 The end of the line, the x-coordinate must be between 0 and the width of the image.
+ */
+static void accumulate_line(std::vector<float> &acc, ssize_t stride, ssize_t height, point2 p0, point2 p1) noexcept
 {
-    auto xValues = solveCurvesXByY(v, y);
-
-    // Sort x values, each pair is a span.
-    std::sort(xValues.begin(), xValues.end());
-
-    // End-to-end connected curves will yield duplicate values.
-    ttlet uniqueEnd = std::unique(xValues.begin(), xValues.end());
-
-    // After removing duplicates, we should end up with pairs of x values.
-    size_t const uniqueValueCount = (uniqueEnd - xValues.begin());
+    if (p0.y() == p1.y()) {
+        return;
+    }
 
-    if (uniqueValueCount % 2 != 0) {
-        // Something is wrong in solving the curves. Probably numeric instability.
-        // In any case, just ignore this sample.
-        return {};
+    auto direction = 1.0f;
+    if (p0.y() > p1.y()) {
+        std::swap(p0, p1);
+        direction = -1.0f;
     }
 
-    // Create pairs of values.
-    auto r = std::vector<std::pair<float, float>>{};
-    r.reserve(uniqueValueCount / 2);
-    for (size_t i = 0; i < uniqueValueCount; i += 2) {
-        r.emplace_back(xValues[i], xValues[i+1]);
+    ttlet dxdy = (p1.x() - p0.x()) / (p1.y() - p0.y());
+    auto x = p0.x();
+    if (p0.y() < 0.0f) {
+        x -= p0.y() * dxdy;
     }
-    return r;
-}
 
-static void fillPartialPixels(pixel_row<uint8_t> row, ssize_t const i, float const startX, float const endX) noexcept
-{
-    ttlet pixelCoverage =
-        std::clamp(endX, i + 0.0f, i + 1.0f) -
-        std::clamp(startX, i + 0.0f, i + 1.0f);
+    ttlet y_begin = std::max(static_cast<ssize_t>(std::floor(p0.y())), ssize_t{0});
+    ttlet y_end = std::min(static_cast<ssize_t>(std::ceil(p1.y())), height);
+    for (auto y = y_begin; y < y_end; ++y) {
+        auto *row = acc.data() + y * stride;
+
+        ttlet y_ = static_cast<float>(y);
+        ttlet dy = std::min(y_ + 1.0f, p1.y()) - std::max(y_, p0.y());
+        ttlet x_next = x + dxdy * dy;
+        ttlet d = dy * direction;
+
+        ttlet x0 = std::min(x, x_next);
+        ttlet x1 = std::max(x, x_next);
+        ttlet x0_floor = std::floor(x0);
+        ttlet x0_i = static_cast<ssize_t>(x0_floor);
+        ttlet x1_ceil = std::ceil(x1);
+        ttlet x1_i = static_cast<ssize_t>(x1_ceil);
+
+        if (x1_i <= x0_i + 1) {
+            // The line stays within a single column in this row.
+            ttlet x_mid = 0.5f * (x + x_next) - x0_floor;
+            row[x0_i] += d - d * x_mid;
+            row[x0_i + 1] += d * x_mid;
+
+        } else {
+            ttlet s = 1.0f / (x1 - x0);
+            ttlet x0_fraction = x0 - x0_floor;
+            ttlet a0 = 0.5f * s * (1.0f - x0_fraction) * (1.0f - x0_fraction);
+            ttlet x1_fraction = x1 - x1_ceil + 1.0f;
+            ttlet a_end = 0.5f * s * x1_fraction * x1_fraction;
+
+            row[x0_i] += d * a0;
+            if (x1_i == x0_i + 2) {
+                row[x0_i + 1] += d * (1.0f - a0 - a_end);
+            } else {
+                ttlet a1 = s * (1.5f - x0_fraction);
+                row[x0_i + 1] += d * (a1 - a0);
+                for (auto i = x0_i + 2; i < x1_i - 1; ++i) {
+                    row[i] += d * s;
+                }
+                ttlet a2 = a1 + static_cast<float>(x1_i - x0_i - 3) * s;
+                row[x1_i - 1] += d * (1.0f - a2 - a_end);
+            }
+            row[x1_i] += d * a_end;
+        }
 
-    auto & pixel = row[i];
-    pixel = static_cast<uint8_t>(std::min(pixelCoverage * 51.0f + pixel, 255.0f));
+        x = x_next;
+    }
 }
 
-static void fillFullPixels(pixel_row<uint8_t> row, ssize_t const start, ssize_t const size) noexcept
+/** Add the signed area covered by a line to the accumulation buffer.
+ *
+ * The line is split where it crosses the left or right edge of the image, the parts outside the image
+ * are moved onto the edge. This does not change the coverage of the pixels inside the image.
+ */
+static void accumulate_clipped_line(std::vector<float> &acc, ssize_t width, ssize_t height, point2 p0, point2 p1) noexcept
 {
-    if (size < 16) {
-        ttlet end = start + size;
-        for (ssize_t i = start; i < end; i++) {
-            row[i] += 0x33;
-        }
-    } else {
-        auto u8p = &row[start];
-        ttlet u8end = u8p + size;
-
-        // First add 51 to all pixels up to the alignment.
-        ttlet alignedStart = tt::ceil(u8p, sizeof(uint64_t));
-        while (u8p < alignedStart) {
-            *(u8p++) += 0x33;
-        }
-
-        // add 51 for each pixel, 8 pixels at a time.
-        auto u64p = reinterpret_cast<uint64_t*>(u8p);
-        ttlet u64end = reinterpret_cast<uint64_t *>(tt::floor(u8end, sizeof(uint64_t)));
-        while (u64p < u64end) {
-            *(u64p++) += 0x3333333333333333ULL;
-        }
+    ttlet width_ = static_cast<float>(width);
 
-        // Add 51 to the last pixels.
-        u8p = reinterpret_cast<uint8_t*>(u64p);
-        while (u8p < u8end) {
-            *(u8p++) += 0x33;
+    auto ts = std::array<float, 4>{0.0f};
+    auto nr_ts = 1_uz;
+    for (ttlet edge : {0.0f, width_}) {
+        if ((p0.x() < edge) != (p1.x() < edge)) {
+            ts[nr_ts++] = (edge - p0.x()) / (p1.x() - p0.x());
         }
     }
+    ts[nr_ts++] = 1.0f;
+    std::sort(ts.begin(), ts.begin() + nr_ts);
+
+    ttlet clamp_x = [width_](point2 p) {
+        return point2{std::clamp(p.x(), 0.0f, width_), p.y()};
+    };
+
+    auto previous_point = clamp_x(p0);
+    for (auto i = 1_uz; i != nr_ts; ++i) {
+        ttlet point = i == nr_ts - 1 ? clamp_x(p1) : clamp_x(p0 + (p1 - p0) * ts[i]);
+        accumulate_line(acc, width + 2, height, previous_point, point);
+        previous_point = point;
+    }
 }
 
-/*! Render pixels in a row between two x values.
- * Fully covered sub-pixel will have the value 51.
+/** Add the coverage of the accumulated area of a row to the pixels.
+ *
+ * The coverage is the prefix sum of the cells, calculated four cells at a time.
  */
-static void fillRowSpan(pixel_row<uint8_t> row, float const startX, float const endX) noexcept
+static void fill_row_from_coverage(pixel_row<uint8_t> row, float const *acc) noexcept
 {
-    if (startX >= row.width() || endX < 0.0f) {
-        return;
+    ttlet width = row.width();
+
+    auto carry = f32x4{};
+    auto x = ssize_t{0};
+    for (; x + 4 <= width; x += 4) {
+        auto sum = f32x4{acc[x], acc[x + 1], acc[x + 2], acc[x + 3]};
+        sum += sum._0xyz();
+        sum += sum._00xy();
+        sum += carry;
+        carry = sum.wwww();
+
+        ttlet coverage = min(abs(sum), f32x4::broadcast(1.0f)) * 255.0f;
+        for (auto i = 0; i != 4; ++i) {
+            auto &pixel = row[x + i];
+            pixel = static_cast<uint8_t>(std::min(coverage[i] + pixel + 0.5f, 255.0f));
+        }
     }
 
-    ttlet startX_int = narrow_cast<ssize_t>(startX);
-    ttlet endXplusOne = endX + 1.0f;
-    ttlet endX_int = narrow_cast<ssize_t>(endXplusOne);
-    ttlet startColumn = std::max(startX_int, ssize_t{0});
-    ttlet endColumn = std::min(endX_int, row.width());
-    ttlet nrColumns = endColumn - startColumn;
+    auto sum = carry.w();
+    for (; x != width; ++x) {
+        sum += acc[x];
 
-    if (nrColumns == 1) {
-        fillPartialPixels(row, startColumn, startX, endX);
-    } else {
-        fillPartialPixels(row, startColumn, startX, endX);
-        fillFullPixels(row, startColumn + 1, nrColumns - 2);
-        fillPartialPixels(row, endColumn - 1, startX, endX);
+        ttlet coverage = std::min(std::abs(sum), 1.0f) * 255.0f;
+        auto &pixel = row[x];
+        pixel = static_cast<uint8_t>(std::min(coverage + pixel + 0.5f, 255.0f));
     }
 }
 
-static void fillRow(pixel_row<uint8_t> row, int const rowY, std::vector<bezier_curve> const& curves) noexcept
+void fill(pixel_map<uint8_t> &image, std::vector<bezier_curve> const &curves) noexcept
 {
-    // 5 times super sampling.
-    for (float y = rowY + 0.1f; y < (rowY + 1); y += 0.2f) {
-        auto optionalSpans = getFillSpansAtY(curves, y);
-        if (!optionalSpans) {
-            // try again, with a slight offset.
-            optionalSpans = getFillSpansAtY(curves, y + 0.01f);
-        }
+    // The maximum distance in pixels between a curve and the lines it is flattened into.
+    constexpr auto tolerance = 0.05f;
 
-        if (optionalSpans) {
-            ttlet &spans = optionalSpans.value();
+    ttlet width = image.width();
+    ttlet height = image.height();
+    ttlet stride = width + 2;
 
-            for (ttlet &span: spans) {
-                fillRowSpan(row, span.first, span.second);
-            }
+    // The signed area is accumulated for all the edges in one pass, then converted to coverage.
+    auto acc = std::vector<float>(static_cast<size_t>(stride * height), 0.0f);
+
+    auto points = std::array<point2, bezier_curve::max_flatten_count>{};
+    for (ttlet &curve : curves) {
+        ttlet nr_points = curve.flatten(tolerance, points);
+
+        auto previous_point = curve.P1;
+        for (auto i = 0_uz; i != nr_points; ++i) {
+            accumulate_clipped_line(acc, width, height, previous_point, points[i]);
+            previous_point = points[i];
         }
     }
-}
 
-void fill(pixel_map<uint8_t> &image, std::vector<bezier_curve> const &curves) noexcept
-{
-    for (int rowNr = 0; rowNr < image.height(); rowNr++) {
-        fillRow(image.at(rowNr), rowNr, curves);
+    for (auto y = ssize_t{0}; y != height; ++y) {
+        fill_row_from_coverage(image.at(y), acc.data() + y * stride);
     }
 }
 
@@ -405,17 +450,10 @@ static void bad_pixels_horizontally(pixel_map<sdf_r8> &image) noexcept
 }
 
 
-void fill(pixel_map<sdf_r8> &image, std::vector<bezier_curve> const &curves) noexcept
+/** Repair pixels where the sign of the distance is wrong.
+ */
+static void repair_sdf(pixel_map<sdf_r8> &image) noexcept
 {
-    for (int row_nr = 0; row_nr != image.height(); ++row_nr) {
-        auto row = image.at(row_nr);
-        auto y = static_cast<float>(row_nr);
-        for (int column_nr = 0; column_nr != image.width(); ++column_nr) {
-            auto x = static_cast<float>(column_nr);
-            row[column_nr] = generate_sdf_r8_pixel(point2(x, y), curves);
-        }
-    }
-
     bad_pixels_horizontally(image);
     bad_pixels_edges(image);
 
@@ -432,4 +470,334 @@ void fill(pixel_map<sdf_r8> &image, std::vector<bezier_curve> const &curves) noe
     }
 }
 
+/** The bounding boxes of the control points of the curves, four curves at a time.
+ * A curve is always inside the convex hull of its control points, so the distance
+ * from a pixel to the bounding box is a lower bound of the distance to the curve.
+ */
+struct sdf_curve_bounds {
+    std::vector<f32x4> min_x;
+    std::vector<f32x4> min_y;
+    std::vector<f32x4> max_x;
+    std::vector<f32x4> max_y;
+
+    sdf_curve_bounds(std::vector<bezier_curve> const &curves) noexcept
+    {
+        ttlet nr_groups = (std::ssize(curves) + 3) / 4;
+        // Padding boxes are infinitely far away, so they are never closer than a real curve.
+        min_x.resize(nr_groups, f32x4::broadcast(std::numeric_limits<float>::max()));
+        min_y.resize(nr_groups, f32x4::broadcast(std::numeric_limits<float>::max()));
+        max_x.resize(nr_groups, f32x4::broadcast(std::numeric_limits<float>::max()));
+        max_y.resize(nr_groups, f32x4::broadcast(std::numeric_limits<float>::max()));
+
+        for (ssize_t i = 0; i != std::ssize(curves); ++i) {
+            ttlet &curve = curves[i];
+
+            auto box_min = min(curve.P1, curve.P2);
+            auto box_max = max(curve.P1, curve.P2);
+            if (curve.type == bezier_curve::Type::Quadratic || curve.type == bezier_curve::Type::Cubic) {
+                box_min = min(box_min, curve.C1);
+                box_max = max(box_max, curve.C1);
+            }
+            if (curve.type == bezier_curve::Type::Cubic) {
+                box_min = min(box_min, curve.C2);
+                box_max = max(box_max, curve.C2);
+            }
+
+            min_x[i / 4][i % 4] = box_min.x();
+            min_y[i / 4][i % 4] = box_min.y();
+            max_x[i / 4][i % 4] = box_max.x();
+            max_y[i / 4][i % 4] = box_max.y();
+        }
+    }
+
+    [[nodiscard]] size_t size() const noexcept
+    {
+        return min_x.size();
+    }
+
+    /** Calculate the square vertical distance from a row to each of the bounding boxes.
+     */
+    void square_distance_y(std::vector<f32x4> &r, float y) const noexcept
+    {
+        ttlet y_ = f32x4::broadcast(y);
+        for (size_t i = 0; i != size(); ++i) {
+            ttlet dy = max(max(min_y[i] - y_, y_ - max_y[i]), f32x4{});
+            r[i] = dy * dy;
+        }
+    }
+};
+
+/** The coefficients of a curve that do not depend on the pixel.
+ * These are used to calculate the distance from four pixels to a linear or quadratic curve at once,
+ * with the batched cubic solver. The calculation is the same as `bezier_curve::sdf_distance()`,
+ * so that both result in the same distance.
+ */
+struct sdf_curve_coefficients {
+    enum class kind_type : uint8_t {
+        /** A curve that is calculated with `bezier_curve::sdf_distance()` for each pixel.
+         * These are cubic curves and degenerate curves, for which the number of roots differs.
+         */
+        scalar,
+        linear,
+        quadratic
+    };
+
+    kind_type kind = kind_type::scalar;
+    float P1_x = 0.0f;
+    float P1_y = 0.0f;
+
+    // The cubic function of a quadratic curve, see `bezierFindTForNormalsIntersectingPoint()`.
+    float p1_x = 0.0f;
+    float p1_y = 0.0f;
+    float p2_x = 0.0f;
+    float p2_y = 0.0f;
+    float a = 0.0f;
+    float b = 0.0f;
+    float c = 0.0f;
+
+    // The linear function of a linear curve.
+    float direction_x = 0.0f;
+    float direction_y = 0.0f;
+    float t_below = 0.0f;
+
+    // The polynomials of the point and the tangent at t.
+    float point_a_x = 0.0f;
+    float point_a_y = 0.0f;
+    float point_b_x = 0.0f;
+    float point_b_y = 0.0f;
+    float tangent_a_x = 0.0f;
+    float tangent_a_y = 0.0f;
+    float tangent_b_x = 0.0f;
+    float tangent_b_y = 0.0f;
+
+    sdf_curve_coefficients(bezier_curve const &curve) noexcept : P1_x(curve.P1.x()), P1_y(curve.P1.y())
+    {
+        ttlet P1_ = static_cast<f32x4>(curve.P1);
+        ttlet C_ = static_cast<f32x4>(curve.C1);
+        ttlet P2_ = static_cast<f32x4>(curve.P2);
+
+        if (curve.type == bezier_curve::Type::Linear) {
+            ttlet direction = curve.P2 - curve.P1;
+            t_below = dot(direction, direction);
+            if (t_below == 0.0f) {
+                return;
+            }
+
+            kind = kind_type::linear;
+            direction_x = direction.x();
+            direction_y = direction.y();
+
+            ttlet[point_b, point_c] = bezierToPolynomial(P1_, P2_);
+            point_b_x = point_b.x();
+            point_b_y = point_b.y();
+            tangent_b_x = direction.x();
+            tangent_b_y = direction.y();
+
+        } else if (curve.type == bezier_curve::Type::Quadratic) {
+            ttlet p1 = curve.C1 - curve.P1;
+            ttlet p2 = vector2{P2_ - (2 * C_) + P1_};
+            a = dot(p2, p2);
+            if (a == 0.0f) {
+                return;
+            }
+
+            kind = kind_type::quadratic;
+            p1_x = p1.x();
+            p1_y = p1.y();
+            p2_x = p2.x();
+            p2_y = p2.y();
+            b = 3 * dot(p1, p2);
+            c = dot(2 * p1, p1);
+
+            ttlet[point_a, point_b, point_c] = bezierToPolynomial(P1_, C_, P2_);
+            ttlet tangent_b = 2 * (C_ - P1_);
+            point_a_x = point_a.x();
+            point_a_y = point_a.y();
+            point_b_x = point_b.x();
+            point_b_y = point_b.y();
+            tangent_a_x = p2.x();
+            tangent_a_y = p2.y();
+            tangent_b_x = tangent_b.x();
+            tangent_b_y = tangent_b.y();
+        }
+    }
+
+    /** Calculate the signed distance from four pixels of a row to the curve.
+     *
+     * @param curve The curve of these coefficients.
+     * @param x The x coordinates of the pixels.
+     * @param y The y coordinate of the row.
+     * @return The signed distance of each pixel.
+     */
+    [[nodiscard]] f32x4 sdf_distance(bezier_curve const &curve, f32x4 x, float y) const noexcept
+    {
+        if (kind == kind_type::scalar) {
+            auto r = f32x4{};
+            for (ssize_t i = 0; i != 4; ++i) {
+                r[i] = curve.sdf_distance(point2{x[i], y});
+            }
+            return r;
+        }
+
+        ttlet p_x = x - f32x4::broadcast(P1_x);
+        ttlet p_y = f32x4::broadcast(y - P1_y);
+
+        if (kind == kind_type::linear) {
+            ttlet t = (p_x * f32x4::broadcast(direction_x) + p_y * f32x4::broadcast(direction_y)) / f32x4::broadcast(t_below);
+            return sdf_distance(std::array{t}, x, y);
+
+        } else {
+            ttlet c_ = f32x4::broadcast(c) - (f32x4::broadcast(p2_x) * p_x + f32x4::broadcast(p2_y) * p_y);
+            ttlet d_ = -(f32x4::broadcast(p1_x) * p_x + f32x4::broadcast(p1_y) * p_y);
+            return sdf_distance(solvePolynomial(f32x4::broadcast(a), f32x4::broadcast(b), c_, d_), x, y);
+        }
+    }
+
+private:
+    /** Calculate the signed distance to the nearest of the points at the given t.
+     */
+    template<size_t N>
+    [[nodiscard]] f32x4 sdf_distance(std::array<f32x4, N> const &ts, f32x4 x, float y) const noexcept
+    {
+        ttlet y_ = f32x4::broadcast(y);
+
+        auto min_square_distance = f32x4::broadcast(std::numeric_limits<float>::max());
+        auto min_t = f32x4{};
+        auto min_normal_x = f32x4{};
+        auto min_normal_y = f32x4::broadcast(1.0f);
+        for (ttlet &t_ : ts) {
+            ttlet t = clamp(t_, f32x4{}, f32x4::broadcast(1.0f));
+
+            ttlet normal_x = x - (point_a_x * t * t + point_b_x * t + P1_x);
+            ttlet normal_y = y_ - (point_a_y * t * t + point_b_y * t + P1_y);
+            ttlet square_distance = normal_x * normal_x + normal_y * normal_y;
+
+            ttlet closer = lt(square_distance, min_square_distance);
+            min_square_distance = select(closer, square_distance, min_square_distance);
+            min_t = select(closer, t, min_t);
+            min_normal_x = select(closer, normal_x, min_normal_x);
+            min_normal_y = select(closer, normal_y, min_normal_y);
+        }
+
+        ttlet tangent_x = 2 * min_t * tangent_a_x + tangent_b_x;
+        ttlet tangent_y = 2 * min_t * tangent_a_y + tangent_b_y;
+        ttlet distance = sqrt(min_square_distance);
+        ttlet cross = tangent_x * min_normal_y - tangent_y * min_normal_x;
+        return select(lt(cross, f32x4{}), distance, -distance);
+    }
+};
+
+/** Find the signed distance from four pixels of a row to the nearest curve.
+ * This results in the same distances as `generate_sdf_r8_pixel()`, but the exact distance to a curve
+ * is only calculated when its bounding box is closer to one of the pixels than the nearest curve so far;
+ * the distance is then calculated for the four pixels at once.
+ *
+ * @param x The x coordinates of the centers of the pixels.
+ * @param y The y coordinate of the center of the row.
+ * @param curves The curves.
+ * @param coefficients The coefficients of the curves.
+ * @param bounds The bounding boxes of the curves.
+ * @param square_distance_y The square vertical distance from the row to each bounding box.
+ * @param[in,out] hint The index of the nearest curve of the previous pixels, updated to the nearest curve of the last pixel.
+ */
+[[nodiscard]] static f32x4 generate_sdf_r8_pixels(
+    f32x4 x,
+    float y,
+    std::vector<bezier_curve> const &curves,
+    std::vector<sdf_curve_coefficients> const &coefficients,
+    sdf_curve_bounds const &bounds,
+    std::vector<f32x4> const &square_distance_y,
+    ssize_t &hint) noexcept
+{
+    // The nearest curve of the previous pixels is likely to be close, which allows most curves to be pruned.
+    auto min_index = std::array<ssize_t, 4>{hint, hint, hint, hint};
+    auto min_distance = coefficients[hint].sdf_distance(curves[hint], x, y);
+
+    for (size_t i = 0; i != bounds.size(); ++i) {
+        auto mask = 0U;
+        for (ssize_t k = 0; k != 4; ++k) {
+            // Allow for rounding errors, so that curves at the same distance are not pruned.
+            ttlet threshold = f32x4::broadcast(min_distance[k] * min_distance[k] * 1.0001f + 0.0001f);
+
+            ttlet x_ = f32x4::broadcast(x[k]);
+            ttlet dx = max(max(bounds.min_x[i] - x_, x_ - bounds.max_x[i]), f32x4{});
+            mask |= le(dx * dx + square_distance_y[i], threshold);
+        }
+
+        while (mask != 0) {
+            ttlet j = std::countr_zero(mask);
+            mask &= mask - 1;
+
+            ttlet index = narrow_cast<ssize_t>(i * 4 + j);
+            if (std::ranges::all_of(min_index, [index](ttlet item) { return item == index; })) {
+                continue;
+            }
+
+            // On equal distance the first curve wins, like the linear search in the scalar version.
+            ttlet distance = coefficients[index].sdf_distance(curves[index], x, y);
+            for (ssize_t k = 0; k != 4; ++k) {
+                if (std::abs(distance[k]) < std::abs(min_distance[k]) ||
+                    (std::abs(distance[k]) == std::abs(min_distance[k]) && index < min_index[k])) {
+                    min_distance[k] = distance[k];
+                    min_index[k] = index;
+                }
+            }
+        }
+    }
+
+    hint = min_index[3];
+    return min_distance;
+}
+
+void fill(pixel_map<sdf_r8> &image, std::vector<bezier_curve> const &curves) noexcept
+{
+    if (std::ssize(curves) == 0) {
+        fill_scalar(image, curves);
+        return;
+    }
+
+    ttlet bounds = sdf_curve_bounds{curves};
+    ttlet coefficients = std::vector<sdf_curve_coefficients>(curves.begin(), curves.end());
+    auto square_distance_y = std::vector<f32x4>(bounds.size());
+
+    auto hint = ssize_t{0};
+    for (int row_nr = 0; row_nr != image.height(); ++row_nr) {
+        auto row = image.at(row_nr);
+        auto y = static_cast<float>(row_nr);
+        bounds.square_distance_y(square_distance_y, y);
+
+        // Start each row with the nearest curve of the first pixels of the previous row.
+        auto row_hint = hint;
+        for (int column_nr = 0; column_nr < image.width(); column_nr += 4) {
+            ttlet x = static_cast<float>(column_nr);
+            ttlet distances = generate_sdf_r8_pixels(
+                f32x4{x, x + 1.0f, x + 2.0f, x + 3.0f}, y, curves, coefficients, bounds, square_distance_y, row_hint);
+
+            // The pixels past the right edge of the image are calculated, but not stored.
+            for (int i = 0; i != 4 && column_nr + i < image.width(); ++i) {
+                row[column_nr + i] = distances[i];
+            }
+            if (column_nr == 0) {
+                hint = row_hint;
+            }
+        }
+    }
+
+    repair_sdf(image);
+}
+
+void fill_scalar(pixel_map<sdf_r8> &image, std::vector<bezier_curve> const &curves) noexcept
+{
+    for (int row_nr = 0; row_nr != image.height(); ++row_nr) {
+        auto row = image.at(row_nr);
+        auto y = static_cast<float>(row_nr);
+        for (int column_nr = 0; column_nr != image.width(); ++column_nr) {
+            auto x = static_cast<float>(column_nr);
+            row[column_nr] = generate_sdf_r8_pixel(point2(x, y), curves);
+        }
+    }
+
+    repair_sdf(image);
+}
+
 }
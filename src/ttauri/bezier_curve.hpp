@@ -14,6 +14,8 @@
 #include "geometry/point.hpp"
 #include "geometry/transform.hpp"
 #include <tuple>
+#include <span>
+#include <cmath>
 #include <limits>
 #include <algorithm>
 
@@ -238,30 +240,63 @@ struct bezier_curve {
         }
     }
 
-    /*! Subdivide a bezier-curve until each are flat enough.
-     * \param r resulting list of linear segments.
-     * \param minimumFlatness minimum amount of flatness of the resulting curve segments.
+    /** The maximum number of line segments a curve is flattened into.
      */
-    void subdivideUntilFlat_impl(std::vector<bezier_curve> &r, float const minimumFlatness) const noexcept
+    static constexpr size_t max_flatten_count = 128;
+
+    /** The number of line segments needed to approximate the curve.
+     *
+     * The count is calculated with Wang's formula, from the largest second difference of the
+     * control points. For a quadratic curve this is the exact bound on the distance between the
+     * parabola and its chords.
+     *
+     * @param tolerance The maximum distance between the curve and the line segments.
+     * @return The number of line segments, between 1 and `max_flatten_count`.
+     */
+    [[nodiscard]] size_t flatten_count(float const tolerance) const noexcept
     {
-        if (flatness() >= minimumFlatness) {
-            r.push_back(*this);
-        } else {
-            ttlet[a, b] = split(0.5f);
-            a.subdivideUntilFlat_impl(r, minimumFlatness);
-            b.subdivideUntilFlat_impl(r, minimumFlatness);
+        tt_axiom(tolerance > 0.0f);
+
+        auto n = 1.0f;
+        switch (type) {
+        case Type::Linear: return 1;
+        case Type::Quadratic: {
+            // Wang's formula with degree 2: n = sqrt(2 * 1 / 8 * |P1 - 2 * C1 + P2| / tolerance)
+            ttlet dd = hypot((P1 - C1) + (P2 - C1));
+            n = std::sqrt(0.25f * dd / tolerance);
+        } break;
+        case Type::Cubic: {
+            // Wang's formula with degree 3: n = sqrt(3 * 2 / 8 * max(|P1 - 2 * C1 + C2|, |C1 - 2 * C2 + P2|) / tolerance)
+            ttlet dd = std::max(hypot((P1 - C1) + (C2 - C1)), hypot((C1 - C2) + (P2 - C2)));
+            n = std::sqrt(0.75f * dd / tolerance);
+        } break;
+        default: tt_no_default();
         }
+
+        return std::clamp(static_cast<size_t>(std::ceil(n)), size_t{1}, max_flatten_count);
     }
 
-    /*! Subdivide a bezier-curve until each are flat enough.
-     * \param tolerance maximum amount of curviness.
-     * \return resulting list of curve segments.
+    /** Flatten the curve into line segments.
+     *
+     * The line segments are placed at equal steps of `t`. The first segment starts at P1, which is
+     * not written to the buffer; the last point written is P2.
+     *
+     * @param tolerance The maximum distance between the curve and the line segments.
+     * @param points The buffer to write the end point of each line segment to; it must hold at
+     *               least `flatten_count(tolerance)` points.
+     * @return The number of points written.
      */
-    [[nodiscard]] std::vector<bezier_curve> subdivideUntilFlat(float const tolerance) const noexcept
+    size_t flatten(float const tolerance, std::span<point2> points) const noexcept
     {
-        std::vector<bezier_curve> r;
-        subdivideUntilFlat_impl(r, 1.0f - tolerance);
-        return r;
+        ttlet n = flatten_count(tolerance);
+        tt_axiom(n <= points.size());
+
+        ttlet step = 1.0f / static_cast<float>(n);
+        for (auto i = 1_uz; i != n; ++i) {
+            points[i - 1] = pointAt(static_cast<float>(i) * step);
+        }
+        points[n - 1] = P2;
+        return n;
     }
 
     /*! Return the flatness of a curve.
@@ -339,7 +374,7 @@ makeContourFromPoints(std::vector<bezier_point>::const_iterator first, std::vect
  * \param contour a list of bezier curve segments forming a closed contour.
  * \param offset positive means the parallel contour will be on the starboard side of the given contour.
  * \param lineJoinStyle how the gaps between line segments are joined together.
- * \param tolerance to how curved the new contour should look.
+ * \param tolerance the maximum distance between a curve and the line segments it is flattened into.
  */
 [[nodiscard]] std::vector<bezier_curve> makeParallelContour(
     std::vector<bezier_curve> const &contour,
@@ -348,6 +383,10 @@ makeContourFromPoints(std::vector<bezier_point>::const_iterator first, std::vect
     float tolerance) noexcept;
 
 /** Fill a linear gray scale image by filling a curve with anti-aliasing.
+ *
+ * The coverage of each pixel is calculated exactly from the signed area of the flattened curves,
+ * using the non-zero winding rule. The coverage is added to the current value of the pixels.
+ *
  * @param image An alpha-channel image to make opaque where pixel is inside the contours
  * @param curves All curves of path, in no particular order.
  */
@@ -359,4 +398,13 @@ void fill(pixel_map<uint8_t> &image, std::vector<bezier_curve> const &curves) no
  */
 void fill(pixel_map<sdf_r8> &image, std::vector<bezier_curve> const &curves) noexcept;
 
+/** Fill a signed distance field image from the given contour.
+ * This calculates the distance to each curve for every pixel, `fill()` should give the same result
+ * while skipping most curves. This function is used for testing and benchmarking.
+ *
+ * @param image An signed-distance-field which show distance toward the closest curve
+ * @param curves All curves of path, in no particular order.
+ */
+void fill_scalar(pixel_map<sdf_r8> &image, std::vector<bezier_curve> const &curves) noexcept;
+
 } // namespace tt
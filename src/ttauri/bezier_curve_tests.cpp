@@ -17,3 +17,45 @@ TEST(bezier_cruve, solve_x_by_y) {
     ASSERT_RESULTS(bezier_curve(point2(2.0f,2.0f), point2(1.5f,2.0f), point2(1.0f,2.0f)).solveXByY(1.5f), tt::results3());
     ASSERT_RESULTS(bezier_curve(point2(1.0f,2.0f), point2(1.0f,1.5f), point2(1.0f,1.0f)).solveXByY(1.5f), tt::results3(1.0f));
 }
+
+/** The distance from a point to the line segment pq.
+ */
+static float distance_to_segment(point2 p, point2 q, point2 point)
+{
+    ttlet pq = q - p;
+    ttlet t = std::clamp(dot(point - p, pq) / squared_hypot(pq), 0.0f, 1.0f);
+    return hypot(point - (p + pq * t));
+}
+
+static void assert_flatten_within_tolerance(bezier_curve const &curve, float tolerance)
+{
+    auto points = std::array<point2, bezier_curve::max_flatten_count>{};
+    ttlet n = curve.flatten(tolerance, points);
+    ASSERT_EQ(n, curve.flatten_count(tolerance));
+    ASSERT_TRUE(points[n - 1] == curve.P2);
+
+    // Sample the curve along each segment, the samples must be close to the segment.
+    auto p = curve.P1;
+    for (size_t i = 0; i != n; ++i) {
+        for (auto j = 1; j != 10; ++j) {
+            ttlet t = (static_cast<float>(i) + static_cast<float>(j) * 0.1f) / static_cast<float>(n);
+            ASSERT_LE(distance_to_segment(p, points[i], curve.pointAt(t)), tolerance * 1.01f);
+        }
+        p = points[i];
+    }
+}
+
+TEST(bezier_cruve, flatten)
+{
+    ASSERT_EQ(bezier_curve(point2(1.0f, 1.0f), point2(2.0f, 3.0f)).flatten_count(0.01f), 1);
+
+    assert_flatten_within_tolerance(bezier_curve(point2(0.0f, 0.0f), point2(1.0f, 2.0f), point2(2.0f, 0.0f)), 0.01f);
+    assert_flatten_within_tolerance(bezier_curve(point2(0.0f, 0.0f), point2(1.0f, 2.0f), point2(2.0f, 0.0f)), 0.1f);
+    assert_flatten_within_tolerance(
+        bezier_curve(point2(0.0f, 0.0f), point2(0.0f, 3.0f), point2(4.0f, -1.0f), point2(4.0f, 2.0f)), 0.01f);
+    assert_flatten_within_tolerance(
+        bezier_curve(point2(0.0f, 0.0f), point2(5.0f, 3.0f), point2(-1.0f, 3.0f), point2(4.0f, 0.0f)), 0.05f);
+
+    // A straight quadratic curve needs a single line.
+    ASSERT_EQ(bezier_curve(point2(0.0f, 0.0f), point2(1.0f, 1.0f), point2(2.0f, 2.0f)).flatten_count(0.01f), 1);
+}
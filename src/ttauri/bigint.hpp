@@ -11,8 +11,223 @@
 #include <fmt/format.h>
 #include <type_traits>
 #include <ostream>
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <limits>
 
 namespace tt {
+namespace detail {
+
+/** The number of digits from which multiplication switches from schoolbook to Karatsuba.
+ * Below this size the extra additions of Karatsuba cost more than the digit multiplications saved.
+ */
+constexpr size_t bigint_karatsuba_threshold = 32;
+
+/** Add digits to a number in place.
+ * @param r The number to add into, of `n` digits.
+ * @param a The digits to add, `m <= n`.
+ * @return The carry out of the most significant digit of `r`.
+ */
+template<std::unsigned_integral T>
+T bigint_add_into(T *r, size_t n, T const *a, size_t m) noexcept
+{
+    tt_axiom(m <= n);
+
+    T carry = 0;
+    size_t i = 0;
+    for (; i != m; ++i) {
+        std::tie(r[i], carry) = add_carry(r[i], a[i], carry);
+    }
+    for (; carry != 0 and i != n; ++i) {
+        std::tie(r[i], carry) = add_carry(r[i], T{0}, carry);
+    }
+    return carry;
+}
+
+/** Subtract digits from a number in place.
+ * @param r The number to subtract from, of `n` digits.
+ * @param a The digits to subtract, `m <= n`.
+ * @return The borrow out of the most significant digit of `r`.
+ */
+template<std::unsigned_integral T>
+T bigint_subtract_from(T *r, size_t n, T const *a, size_t m) noexcept
+{
+    tt_axiom(m <= n);
+
+    T borrow = 0;
+    size_t i = 0;
+    for (; i != m; ++i) {
+        std::tie(r[i], borrow) = sub_borrow(r[i], a[i], borrow);
+    }
+    for (; borrow != 0 and i != n; ++i) {
+        std::tie(r[i], borrow) = sub_borrow(r[i], T{0}, borrow);
+    }
+    return borrow;
+}
+
+/** Schoolbook multiply.
+ * @param r The product of `n + m` digits.
+ * @param a The left hand side, of `n` digits.
+ * @param b The right hand side, of `m` digits.
+ */
+template<std::unsigned_integral T>
+void bigint_multiply_schoolbook(T *r, T const *a, size_t n, T const *b, size_t m) noexcept
+{
+    std::fill_n(r, n + m, T{0});
+    for (size_t j = 0; j != m; ++j) {
+        T carry = 0;
+        for (size_t i = 0; i != n; ++i) {
+            std::tie(r[i + j], carry) = mul_carry(a[i], b[j], carry, r[i + j]);
+        }
+        r[n + j] = carry;
+    }
+}
+
+/** Schoolbook multiply, keeping only the least significant digits.
+ * @param r The product modulo the digit base to the power of `n`, of `n` digits.
+ * @param a The left hand side, of `n` digits.
+ * @param b The right hand side, of `n` digits.
+ */
+template<std::unsigned_integral T>
+void bigint_multiply_schoolbook_low(T *r, T const *a, T const *b, size_t n) noexcept
+{
+    std::fill_n(r, n, T{0});
+    for (size_t j = 0; j != n; ++j) {
+        T carry = 0;
+        for (size_t i = 0; i + j != n; ++i) {
+            std::tie(r[i + j], carry) = mul_carry(a[i], b[j], carry, r[i + j]);
+        }
+    }
+}
+
+/** The number of scratch digits needed by `bigint_multiply_karatsuba()`.
+ */
+[[nodiscard]] constexpr size_t bigint_karatsuba_scratch_size(size_t n) noexcept
+{
+    if (n < bigint_karatsuba_threshold) {
+        return 0;
+    }
+    ttlet hi = n - n / 2;
+    return 4 * (hi + 1) + bigint_karatsuba_scratch_size(hi + 1);
+}
+
+/** Karatsuba multiply.
+ * (a1 B + a0)(b1 B + b0) = a1 b1 B^2 + ((a0 + a1)(b0 + b1) - a0 b0 - a1 b1) B + a0 b0
+ *
+ * @param r The product of `2n` digits.
+ * @param a The left hand side, of `n` digits.
+ * @param b The right hand side, of `n` digits.
+ * @param scratch Temporary digits, of `bigint_karatsuba_scratch_size(n)`.
+ */
+template<std::unsigned_integral T>
+void bigint_multiply_karatsuba(T *r, T const *a, T const *b, size_t n, T *scratch) noexcept
+{
+    if (n < bigint_karatsuba_threshold) {
+        return bigint_multiply_schoolbook(r, a, n, b, n);
+    }
+
+    ttlet lo = n / 2;
+    ttlet hi = n - lo;
+
+    // a0 b0 and a1 b1 are placed directly in the result.
+    bigint_multiply_karatsuba(r, a, b, lo, scratch);
+    bigint_multiply_karatsuba(r + 2 * lo, a + lo, b + lo, hi, scratch);
+
+    auto *a_sum = scratch;
+    auto *b_sum = a_sum + (hi + 1);
+    auto *middle = b_sum + (hi + 1);
+    auto *next_scratch = middle + 2 * (hi + 1);
+
+    std::copy_n(a + lo, hi, a_sum);
+    a_sum[hi] = bigint_add_into(a_sum, hi, a, lo);
+    std::copy_n(b + lo, hi, b_sum);
+    b_sum[hi] = bigint_add_into(b_sum, hi, b, lo);
+
+    bigint_multiply_karatsuba(middle, a_sum, b_sum, hi + 1, next_scratch);
+    bigint_subtract_from(middle, 2 * (hi + 1), r, 2 * lo);
+    bigint_subtract_from(middle, 2 * (hi + 1), r + 2 * lo, 2 * hi);
+
+    // The middle term is less than 2 B^n, the digits beyond the result are zero.
+    ttlet r_size = 2 * n - lo;
+    bigint_add_into(r + lo, r_size, middle, std::min(2 * (hi + 1), r_size));
+}
+
+/** The number of scratch digits needed by `bigint_multiply_karatsuba_low()`.
+ */
+[[nodiscard]] constexpr size_t bigint_karatsuba_low_scratch_size(size_t n) noexcept
+{
+    if (n < bigint_karatsuba_threshold) {
+        return 0;
+    }
+    ttlet lo = n / 2;
+    ttlet hi = n - lo;
+    return 3 * hi + std::max(bigint_karatsuba_scratch_size(lo), bigint_karatsuba_low_scratch_size(hi));
+}
+
+/** Karatsuba multiply, keeping only the least significant digits.
+ * Only the least significant digits of the cross terms are needed, and of a1 b1 at most a single digit.
+ *
+ * @param r The product modulo the digit base to the power of `n`, of `n` digits.
+ * @param a The left hand side, of `n` digits.
+ * @param b The right hand side, of `n` digits.
+ * @param scratch Temporary digits, of `bigint_karatsuba_low_scratch_size(n)`.
+ */
+template<std::unsigned_integral T>
+void bigint_multiply_karatsuba_low(T *r, T const *a, T const *b, size_t n, T *scratch) noexcept
+{
+    if (n < bigint_karatsuba_threshold) {
+        return bigint_multiply_schoolbook_low(r, a, b, n);
+    }
+
+    ttlet lo = n / 2;
+    ttlet hi = n - lo;
+
+    auto *cross = scratch;
+    auto *a0 = cross + hi;
+    auto *b0 = a0 + hi;
+    auto *next_scratch = b0 + hi;
+
+    // When n is odd the low halves are one digit shorter than the high halves, and the least
+    // significant digit of a1 b1 lands on the most significant digit of the result.
+    std::copy_n(a, lo, a0);
+    std::copy_n(b, lo, b0);
+    if (lo != hi) {
+        a0[lo] = 0;
+        b0[lo] = 0;
+        r[n - 1] = wide_mul(a[lo], b[lo]).first;
+    }
+
+    bigint_multiply_karatsuba(r, a, b, lo, next_scratch);
+
+    bigint_multiply_karatsuba_low(cross, a + lo, b0, hi, next_scratch);
+    bigint_add_into(r + lo, hi, cross, hi);
+    bigint_multiply_karatsuba_low(cross, a0, b + lo, hi, next_scratch);
+    bigint_add_into(r + lo, hi, cross, hi);
+}
+
+/** Divide by a single digit.
+ * @param q The quotient, of `n` digits.
+ * @param a The dividend, of `n` digits.
+ * @param divisor The divisor.
+ * @return The remainder.
+ */
+template<std::unsigned_integral T>
+T bigint_divide_digit(T *q, T const *a, size_t n, T divisor) noexcept
+{
+    tt_axiom(divisor != 0);
+
+    T remainder = 0;
+    for (auto i = n; i != 0; --i) {
+        // The remainder is less than the divisor, so the quotient digit fits.
+        ttlet quotient = wide_div(a[i - 1], remainder, divisor);
+        remainder = a[i - 1] - quotient * divisor;
+        q[i - 1] = quotient;
+    }
+    return remainder;
+}
+
+} // namespace detail
 
 //template<typename T, int N, bool SIGNED=false>
 //struct bigint;
@@ -130,20 +345,32 @@ struct bigint {
     }
 
     std::string string() const noexcept {
-        static auto oneOver10 = bigint_reciprocal(bigint<T,N*2>{10});
+        // Divide by the largest power of ten that fits in a digit, producing many decimal digits for
+        // each short division of the number.
+        constexpr auto chunk = [] {
+            auto divisor = digit_type{1};
+            auto nr_decimals = 0;
+            while (divisor <= std::numeric_limits<digit_type>::max() / 10) {
+                divisor *= 10;
+                ++nr_decimals;
+            }
+            return std::pair{divisor, nr_decimals};
+        }();
 
         auto tmp = *this;
 
         std::string r;
-
-        if (tmp == 0) {
-            r = "0";
-        } else {
-            while (tmp > 0) {
-                bigint remainder;
-                std::tie(tmp, remainder) = div(tmp, 10, oneOver10);
-                r += (static_cast<char>(remainder) + '0');
+        do {
+            auto remainder = detail::bigint_divide_digit(tmp.digits.data(), tmp.digits.data(), N, chunk.first);
+            for (auto i = 0; i != chunk.second; ++i) {
+                r += static_cast<char>(remainder % 10) + '0';
+                remainder /= 10;
             }
+        } while (tmp != 0);
+
+        // Remove the leading zeros of the most significant chunk.
+        while (r.size() > 1 and r.back() == '0') {
+            r.pop_back();
         }
 
         std::reverse(r.begin(), r.end());
@@ -281,25 +508,42 @@ struct bigint {
         }
     }
 
+    /** Multiply and accumulate.
+     * o += lhs * rhs, keeping only the least significant digits.
+     */
     friend void bigint_multiply(bigint &o, bigint const &lhs, bigint const &rhs) noexcept
     {
-        for (auto rhs_index = 0; rhs_index < N; rhs_index++) {
-            ttlet rhs_digit = rhs.digits[rhs_index];
-
-            T carry = 0;
-            for (auto lhs_index = 0; (lhs_index + rhs_index) < N; lhs_index++) {
-                ttlet lhs_digit = lhs.digits[lhs_index];
+        if constexpr (N >= detail::bigint_karatsuba_threshold) {
+            auto product = bigint{};
+            auto scratch = std::array<T, detail::bigint_karatsuba_low_scratch_size(N)>{};
+            detail::bigint_multiply_karatsuba_low(product.digits.data(), lhs.digits.data(), rhs.digits.data(), N, scratch.data());
+            bigint_add(o, o, product);
 
-                T result;
-                T accumulator = o.digits[rhs_index + lhs_index];
-                std::tie(result, carry) = mul_carry(lhs_digit, rhs_digit, carry, accumulator);
-                o.digits[rhs_index + lhs_index] = result;
+        } else {
+            for (auto rhs_index = 0; rhs_index < N; rhs_index++) {
+                ttlet rhs_digit = rhs.digits[rhs_index];
+
+                T carry = 0;
+                for (auto lhs_index = 0; (lhs_index + rhs_index) < N; lhs_index++) {
+                    ttlet lhs_digit = lhs.digits[lhs_index];
+
+                    T result;
+                    T accumulator = o.digits[rhs_index + lhs_index];
+                    std::tie(result, carry) = mul_carry(lhs_digit, rhs_digit, carry, accumulator);
+                    o.digits[rhs_index + lhs_index] = result;
+                }
             }
         }
     }
 
     friend void bigint_div(bigint &quotient, bigint &remainder, bigint const &lhs, bigint const &rhs) noexcept
     {
+        if (std::all_of(rhs.digits.begin() + 1, rhs.digits.end(), [](ttlet digit) { return digit == 0; })) {
+            // A short division, one digit at a time, when the divisor fits in a single digit.
+            remainder = detail::bigint_divide_digit(quotient.digits.data(), lhs.digits.data(), N, rhs.digits[0]);
+            return;
+        }
+
         for (auto i = nr_bits - 1; i >= 0; i--) {
             remainder <<= 1;
             remainder |= lhs.get_bit(i);
@@ -312,16 +556,16 @@ struct bigint {
 
     friend void bigint_div(bigint &r_quotient, bigint &r_remainder, bigint const &lhs, bigint const &rhs, bigint<T,2*N> const &rhs_reciprocal) noexcept
     {
-        auto quotient = bigint<T,3*N>{0};
-        bigint_multiply(quotient, lhs, rhs_reciprocal);
-
-        quotient >>= (2*nr_bits);
+        // The most significant digits of lhs * rhs_reciprocal are an estimate of the quotient,
+        // which may be slightly less than the actual quotient.
+        ttlet product = bigint_wide_multiply(lhs, rhs_reciprocal);
+        auto quotient = bigint{};
+        std::copy_n(product.digits.begin() + 2 * N, N, quotient.digits.begin());
 
-        auto product = bigint<T,3*N>{0};
-        bigint_multiply(product, quotient, rhs);
-
-        tt_axiom(product <= lhs);
-        auto remainder = lhs - product;
+        // The estimate is not more than the actual quotient, so this product does not overflow.
+        ttlet estimate = quotient * rhs;
+        tt_axiom(estimate <= lhs);
+        auto remainder = lhs - estimate;
 
         int retry = 0;
         while (remainder >= rhs) {
@@ -333,8 +577,8 @@ struct bigint {
             remainder -= rhs;
             quotient += 1;
         }
-        r_quotient = static_cast<bigint>(quotient);
-        r_remainder = static_cast<bigint>(remainder);
+        r_quotient = quotient;
+        r_remainder = remainder;
     }
 
     /*! Bit scan reverse.
@@ -597,6 +841,22 @@ struct bigint {
     }
 };
 
+/** Multiply two numbers, returning the full product.
+ * Numbers of the same size use Karatsuba multiplication above `detail::bigint_karatsuba_threshold` digits.
+ */
+template<typename T, int N, int M>
+[[nodiscard]] bigint<T, N + M> bigint_wide_multiply(bigint<T, N> const &lhs, bigint<T, M> const &rhs) noexcept
+{
+    auto r = bigint<T, N + M>{};
+    if constexpr (N == M and N >= detail::bigint_karatsuba_threshold) {
+        auto scratch = std::array<T, detail::bigint_karatsuba_scratch_size(N)>{};
+        detail::bigint_multiply_karatsuba(r.digits.data(), lhs.digits.data(), rhs.digits.data(), N, scratch.data());
+    } else {
+        detail::bigint_multiply_schoolbook(r.digits.data(), lhs.digits.data(), N, rhs.digits.data(), M);
+    }
+    return r;
+}
+
 using ubig128 = bigint<uint64_t,2>;
 using uuid = bigint<uint64_t,2>;
 
@@ -7,6 +7,8 @@
 #include <iostream>
 #include <string>
 #include <array>
+#include <random>
+#include <vector>
 
 using namespace std;
 using namespace tt;
@@ -206,4 +208,84 @@ TEST(BigInt, Default) {
         ASSERT_EQ(t, u);
     }
 
-}
\ No newline at end of file
+}
+TEST(BigInt, DivideDigit) {
+    auto t = ubig128{"123456789012345678901234567890"};
+
+    ttlet [quotient, remainder] = div(t, ubig128{10});
+    ASSERT_EQ(quotient, ubig128{"12345678901234567890123456789"});
+    ASSERT_EQ(remainder, 0);
+
+    ASSERT_EQ(t / 7, ubig128{"17636684144620811271604938270"});
+    ASSERT_EQ(t % 7, 0);
+    ASSERT_EQ((t + 3) % 7, 3);
+}
+
+TEST(BigInt, DivideReciprocal) {
+    ttlet ten = ubig128{10};
+    ttlet one_over_ten = bigint_reciprocal(bigint<uint64_t, 4>{10});
+
+    auto t = ubig128{"123456789012345678901234567890"};
+    ttlet [quotient, remainder] = div(t, ten, one_over_ten);
+    ASSERT_EQ(quotient, ubig128{"12345678901234567890123456789"});
+    ASSERT_EQ(remainder, 0);
+
+    ttlet [quotient2, remainder2] = div(t + 9, ten, one_over_ten);
+    ASSERT_EQ(quotient2, ubig128{"12345678901234567890123456789"});
+    ASSERT_EQ(remainder2, 9);
+}
+
+TEST(BigInt, WideMultiply) {
+    ttlet t = ubig128{"123456789012345678901234567890"};
+    ttlet u = ubig128{"98765432109876543210987654321"};
+
+    ASSERT_EQ(bigint_wide_multiply(t, u), (bigint<uint64_t, 4>{"12193263113702179522618503273362292333223746380111126352690"}));
+}
+
+TEST(BigInt, Karatsuba) {
+    // Compare the Karatsuba multiplication with the schoolbook multiplication, including the
+    // odd sizes where the halves differ in length.
+    auto engine = std::mt19937_64{42};
+
+    for (auto n : {32_uz, 33_uz, 64_uz, 79_uz, 128_uz}) {
+        auto a = std::vector<uint64_t>(n);
+        auto b = std::vector<uint64_t>(n);
+        for (auto i = 0_uz; i != n; ++i) {
+            a[i] = engine();
+            b[i] = i % 3 == 0 ? std::numeric_limits<uint64_t>::max() : engine();
+        }
+
+        auto expected = std::vector<uint64_t>(2 * n);
+        detail::bigint_multiply_schoolbook(expected.data(), a.data(), n, b.data(), n);
+
+        auto result = std::vector<uint64_t>(2 * n);
+        auto scratch = std::vector<uint64_t>(detail::bigint_karatsuba_scratch_size(n));
+        detail::bigint_multiply_karatsuba(result.data(), a.data(), b.data(), n, scratch.data());
+        ASSERT_EQ(result, expected);
+
+        auto result_low = std::vector<uint64_t>(n);
+        auto scratch_low = std::vector<uint64_t>(detail::bigint_karatsuba_low_scratch_size(n));
+        detail::bigint_multiply_karatsuba_low(result_low.data(), a.data(), b.data(), n, scratch_low.data());
+        ASSERT_TRUE(std::equal(result_low.begin(), result_low.end(), expected.begin()));
+    }
+}
+
+TEST(BigInt, WideString) {
+    using ubig4096 = bigint<uint64_t, 64>;
+
+    // 2^4000 + 1
+    auto t = ubig4096{1} << 4000;
+    t += 1;
+    auto u = t * t;
+
+    auto str = t.string();
+    ASSERT_EQ(str.size(), 1205);
+    ASSERT_EQ(str.substr(0, 10), "1318204093");
+    ASSERT_EQ(str.back(), '7');
+    ASSERT_EQ(ubig4096{str}, t);
+
+    // (2^4000 + 1)^2 modulo 2^4096 = 2^4001 + 1
+    auto v = ubig4096{1} << 4001;
+    v += 1;
+    ASSERT_EQ(u, v);
+}
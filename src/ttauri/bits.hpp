@@ -6,8 +6,11 @@
 
 #include "exception.hpp"
 #include "assert.hpp"
+#include "endian.hpp"
 #include <span>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 
 namespace tt {
 
@@ -74,4 +77,115 @@ namespace tt {
     return value;
 } 
 
+/** Read bits from a span of bytes.
+ * Bits are ordered LSB first, the same as `get_bits()`.
+ *
+ * Up to 56 bits are kept in a 64 bit buffer, which is refilled
+ * with a single unaligned load while at least 8 bytes remain.
+ * Bits beyond the end of the span are read as zero.
+ */
+class bit_reader {
+public:
+    /** The maximum number of bits that can be peeked at once.
+     */
+    static constexpr int max_peek = 56;
+
+    /** Create a bit reader.
+     *
+     * @param bytes The bytes to read from.
+     * @param bit_offset The index of the first bit in the byte span.
+     */
+    bit_reader(std::span<std::byte const> bytes, ssize_t bit_offset) noexcept :
+        _bytes(bytes), _byte_offset(bit_offset >> 3), _buffer(0), _nr_bits(0)
+    {
+        refill();
+        skip(static_cast<int>(bit_offset & 7));
+    }
+
+    /** The index of the next bit in the byte span.
+     */
+    [[nodiscard]] ssize_t bit_offset() const noexcept
+    {
+        return _byte_offset * 8 - _nr_bits;
+    }
+
+    /** The bytes being read.
+     */
+    [[nodiscard]] std::span<std::byte const> bytes() const noexcept
+    {
+        return _bytes;
+    }
+
+    /** Get the next bits without consuming them.
+     *
+     * @param length Number of bits, at most `max_peek`.
+     */
+    [[nodiscard]] uint64_t peek(int length) noexcept
+    {
+        tt_axiom(length <= max_peek);
+        if (_nr_bits < length) {
+            refill();
+        }
+        return _buffer & ((uint64_t{1} << length) - 1);
+    }
+
+    /** Consume bits that were peeked.
+     */
+    void skip(int length) noexcept
+    {
+        tt_axiom(length <= _nr_bits);
+        _buffer >>= length;
+        _nr_bits -= length;
+    }
+
+    /** Get and consume the next bits.
+     *
+     * @param length Number of bits, at most `max_peek`.
+     */
+    [[nodiscard]] int get(int length) noexcept
+    {
+        ttlet r = static_cast<int>(peek(length));
+        skip(length);
+        return r;
+    }
+
+    /** Discard the bits up to the next byte boundary.
+     */
+    void align() noexcept
+    {
+        skip(_nr_bits & 7);
+    }
+
+private:
+    std::span<std::byte const> _bytes;
+
+    /** Index of the next byte to be loaded into the buffer.
+     */
+    ssize_t _byte_offset;
+    uint64_t _buffer;
+    int _nr_bits;
+
+    void refill() noexcept
+    {
+        if (_byte_offset + 8 <= std::ssize(_bytes)) {
+            uint64_t value;
+            std::memcpy(&value, _bytes.data() + _byte_offset, sizeof(value));
+            value = little_to_native(value);
+
+            _buffer |= value << _nr_bits;
+            _byte_offset += (63 - _nr_bits) >> 3;
+            _nr_bits |= 56;
+
+        } else {
+            while (_nr_bits <= 56) {
+                if (_byte_offset < std::ssize(_bytes)) {
+                    _buffer |= static_cast<uint64_t>(_bytes[_byte_offset]) << _nr_bits;
+                }
+                ++_byte_offset;
+                _nr_bits += 8;
+            }
+        }
+    }
+};
+
 }
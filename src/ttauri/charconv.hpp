@@ -4,8 +4,17 @@
 
 #pragma once
 
+#include "required.hpp"
+#include "assert.hpp"
+#include "exception.hpp"
+#include "endian.hpp"
 #include <concepts>
 #include <charconv>
+#include <array>
+#include <string>
+#include <string_view>
+#include <cstring>
+#include <cstdint>
 
 namespace tt {
 
@@ -24,7 +33,7 @@ template<std::integral T>
     ttlet last = first + std::size(buffer);
 
     ttlet[new_last, ec] = std::to_chars(first, last, value);
-    tt_assert(ec != std::errc{});
+    tt_assert(ec == std::errc{});
 
     auto r = std::string{};
     std::copy(first, new_last, std::back_inserter(r));
@@ -46,7 +55,7 @@ template<std::floating_point T>
     ttlet last = first + std::size(buffer);
 
     ttlet[new_last, ec] = std::to_chars(first, last, value, std::chars_format::general);
-    tt_assert(ec != std::errc{});
+    tt_assert(ec == std::errc{});
 
     auto r = std::string{};
     std::copy(first, new_last, std::back_inserter(r));
@@ -77,4 +86,45 @@ template<std::integral T>
     return value;
 }
 
+/** Load eight characters as an integer, with the first character in the least significant byte.
+ *
+ * @param ptr Pointer to at least eight characters.
+ * @return The characters packed in an integer.
+ */
+[[nodiscard]] inline uint64_t load_eight_chars(char const *ptr) noexcept
+{
+    uint64_t r;
+    std::memcpy(&r, ptr, sizeof(r));
+    return little_to_native(r);
+}
+
+/** Check if eight characters are all decimal digits.
+ * The high nibble of each byte must be 3, and adding 6 to a digit must not carry into the high nibble.
+ *
+ * @param chars Eight characters loaded with `load_eight_chars()`.
+ * @return True if all eight characters are in the range '0' to '9'.
+ */
+[[nodiscard]] constexpr bool is_eight_digits(uint64_t chars) noexcept
+{
+    return ((chars & 0xf0f0'f0f0'f0f0'f0f0) | (((chars + 0x0606'0606'0606'0606) & 0xf0f0'f0f0'f0f0'f0f0) >> 4)) ==
+        0x3333'3333'3333'3333;
+}
+
+/** Convert eight decimal digits to an integer.
+ * The digits are combined in pairs, then in groups of four and then eight, using three multiplications.
+ *
+ * @pre `is_eight_digits(chars)`
+ * @param chars Eight characters loaded with `load_eight_chars()`, the most significant digit first.
+ * @return The value of the eight digits, between 0 and 99'999'999.
+ */
+[[nodiscard]] constexpr uint32_t parse_eight_digits(uint64_t chars) noexcept
+{
+    chars -= 0x3030'3030'3030'3030;
+    chars = (chars * 10) + (chars >> 8);
+    chars = ((chars & 0x0000'00ff'0000'00ff) * (100 + (1'000'000ULL << 32)) +
+             ((chars >> 16) & 0x0000'00ff'0000'00ff) * (1 + (10'000ULL << 32))) >>
+        32;
+    return static_cast<uint32_t>(chars);
+}
+
 } // namespace tt
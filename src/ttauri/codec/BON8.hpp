@@ -9,6 +9,14 @@
 #include "../datum.hpp"
 #include "../exception.hpp"
 #include "../cast.hpp"
+#include "../check.hpp"
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <cstring>
 #include <cstddef>
 
 namespace tt {
@@ -42,89 +50,127 @@ constexpr auto BON8_code_eot           = uint8_t{0xff};
 
 
 /** BON8 encoder.
+ *
+ * The encoder writes the message into a buffer given by the caller, and counts the
+ * size of the complete message, including the bytes which did not fit in the buffer.
+ * A message can therefor be encoded in two passes, first without a buffer to measure
+ * its size, then into a buffer of exactly that size, which may be a memory-mapped file.
  */
 class BON8_encoder {
-    bool open_string;
-    bstring output;
+    std::span<std::byte> _buffer;
+    ssize_t _size;
+    bool _open_string;
+
+    void append(std::byte c) noexcept
+    {
+        if (_size < std::ssize(_buffer)) {
+            _buffer[_size] = c;
+        }
+        ++_size;
+    }
+
+    void append(std::byte const *ptr, ssize_t count) noexcept
+    {
+        if (_size + count <= std::ssize(_buffer)) {
+            std::memcpy(_buffer.data() + _size, ptr, narrow_cast<size_t>(count));
+        } else if (_size < std::ssize(_buffer)) {
+            std::memcpy(_buffer.data() + _size, ptr, narrow_cast<size_t>(std::ssize(_buffer) - _size));
+        }
+        _size += count;
+    }
 
 public:
-    BON8_encoder() noexcept :
-        open_string(false), output() {}
+    /** Create an encoder which only measures the size of the message.
+     */
+    BON8_encoder() noexcept : _buffer(), _size(0), _open_string(false) {}
 
-    /** Return a byte_string of the encoded object.
+    /** Create an encoder which writes the message into a buffer.
+     * @param buffer The buffer to write the message into.
      */
-    bstring const &get() const noexcept {
-        return output;
+    explicit BON8_encoder(std::span<std::byte> buffer) noexcept : _buffer(buffer), _size(0), _open_string(false) {}
+
+    /** The size of the message that was encoded.
+     */
+    [[nodiscard]] ssize_t size() const noexcept
+    {
+        return _size;
+    }
+
+    /** The message did not fit in the buffer.
+     */
+    [[nodiscard]] bool overflow() const noexcept
+    {
+        return _size > std::ssize(_buffer);
     }
 
     /** And a signed integer.
      * @param value A signed integer.
      */
     void add(signed long long value) noexcept {
-        open_string = false;
+        _open_string = false;
 
         if (value < std::numeric_limits<int32_t>::min()) {
-            output += static_cast<std::byte>(BON8_code_int64);
+            append(static_cast<std::byte>(BON8_code_int64));
             for (int i = 0; i != 8; ++i) {
-                output += static_cast<std::byte>(value >> (56 - i*8));
+                append(static_cast<std::byte>(value >> (56 - i*8)));
             }
 
         } else if (value < -33554432) {
-            output += static_cast<std::byte>(BON8_code_int32);
+            append(static_cast<std::byte>(BON8_code_int32));
             for (int i = 0; i != 4; ++i) {
-                output += static_cast<std::byte>(value >> (24 - i*8));
+                append(static_cast<std::byte>(value >> (24 - i*8)));
             }
 
         } else if (value < -262144) {
             value = -value - 1;
-            output += static_cast<std::byte>(0xf0 + (value >> 22 & 0x07));
-            output += static_cast<std::byte>(0xc0 + (value >> 16 & 0x3f));
-            output += static_cast<std::byte>(value >> 8);
-            output += static_cast<std::byte>(value);
+            append(static_cast<std::byte>(0xf0 + (value >> 22 & 0x07)));
+            append(static_cast<std::byte>(0xc0 + (value >> 16 & 0x3f)));
+            append(static_cast<std::byte>(value >> 8));
+            append(static_cast<std::byte>(value));
 
         } else if (value < -1920) {
             value = -value - 1;
-            output += static_cast<std::byte>(0xe0 + (value >> 14 & 0x0f));
-            output += static_cast<std::byte>(0xc0 + (value >> 8 & 0x3f));
-            output += static_cast<std::byte>(value);
+            append(static_cast<std::byte>(0xe0 + (value >> 14 & 0x0f)));
+            append(static_cast<std::byte>(0xc0 + (value >> 8 & 0x3f)));
+            append(static_cast<std::byte>(value));
 
         } else if (value < -10) {
             value = -value - 1;
-            output += static_cast<std::byte>(0xc2 + (value >> 6 & 0x1f));
-            output += static_cast<std::byte>(0xc0 + (value & 0x3f));
+            append(static_cast<std::byte>(0xc2 + (value >> 6 & 0x1f)));
+            append(static_cast<std::byte>(0xc0 + (value & 0x3f)));
 
         } else if (value < 0) {
             value = -value - 1;
-            output += static_cast<std::byte>(0xb0 + value);
+            append(static_cast<std::byte>(0xb0 + value));
 
         } else if (value <= 47) {
-            output += static_cast<std::byte>(0x80 + value);
+            append(static_cast<std::byte>(0x80 + value));
 
         } else if (value <= 3839) {
-            output += static_cast<std::byte>(0xc2 + (value >> 7 & 0x1f));
-            output += static_cast<std::byte>(value & 0x7f);
+            append(static_cast<std::byte>(0xc2 + (value >> 7 & 0x1f)));
+            append(static_cast<std::byte>(value & 0x7f));
 
         } else if (value <= 524287) {
-            output += static_cast<std::byte>(0xe0 + (value >> 15 & 0x0f));
-            output += static_cast<std::byte>(value >> 8 & 0x7f);
-            output += static_cast<std::byte>(value);
+            append(static_cast<std::byte>(0xe0 + (value >> 15 & 0x0f)));
+            append(static_cast<std::byte>(value >> 8 & 0x7f));
+            append(static_cast<std::byte>(value));
 
         } else if (value <= 67108863) {
-            output += static_cast<std::byte>(0xf0 + (value >> 23 & 0x17));
-            output += static_cast<std::byte>(value >> 16 & 0x7f);
-            output += static_cast<std::byte>(value >> 8);
-            output += static_cast<std::byte>(value);
+            append(static_cast<std::byte>(0xf0 + (value >> 23 & 0x07)));
+            append(static_cast<std::byte>(value >> 16 & 0x7f));
+            append(static_cast<std::byte>(value >> 8));
+            append(static_cast<std::byte>(value));
 
         } else if (value <= std::numeric_limits<int32_t>::max()) {
-            output += static_cast<std::byte>(BON8_code_int32);
+            append(static_cast<std::byte>(BON8_code_int32));
             for (int i = 0; i != 4; ++i) {
-                output += static_cast<std::byte>(value >> (24 - i*8));
+                append(static_cast<std::byte>(value >> (24 - i*8)));
             }
 
         } else {
-            output += static_cast<std::byte>(BON8_code_int64);
+            append(static_cast<std::byte>(BON8_code_int64));
             for (int i = 0; i != 8; ++i) {
-                output += static_cast<std::byte>(value >> (56 - i*8));
+                append(static_cast<std::byte>(value >> (56 - i*8)));
             }
         }
     }
@@ -196,36 +242,36 @@ public:
      * @param value A floating point number.
      */
     void add(double value) noexcept {
-        open_string = false;
+        _open_string = false;
 
         ttlet f32 = static_cast<float>(value);
         ttlet f32_64 = static_cast<double>(f32);
 
         if (value == -1.0) {
-            output += static_cast<std::byte>(BON8_code_float_min_one);
+            append(static_cast<std::byte>(BON8_code_float_min_one));
 
         } else if (value == 0.0 || value == -0.0) {
-            output += static_cast<std::byte>(BON8_code_float_zero);
+            append(static_cast<std::byte>(BON8_code_float_zero));
 
         } else if (value == 1.0) {
-            output += static_cast<std::byte>(BON8_code_float_one);
+            append(static_cast<std::byte>(BON8_code_float_one));
 
         } else if (f32_64 == value) {
             uint32_t u32;
             std::memcpy(&u32, &f32, sizeof(u32));
 
-            output += static_cast<std::byte>(BON8_code_binary32);
+            append(static_cast<std::byte>(BON8_code_binary32));
             for (int i = 0; i != 4; ++i) {
-                output += static_cast<std::byte>(u32 >> (24 - i*8));
+                append(static_cast<std::byte>(u32 >> (24 - i*8)));
             }
 
         } else {
             uint64_t u64;
             std::memcpy(&u64, &value, sizeof(u64));
 
-            output += static_cast<std::byte>(BON8_code_binary64);
+            append(static_cast<std::byte>(BON8_code_binary64));
             for (int i = 0; i != 8; ++i) {
-                output += static_cast<std::byte>(u64 >> (56 - i*8));
+                append(static_cast<std::byte>(u64 >> (56 - i*8)));
             }
         }
     }
@@ -241,16 +287,16 @@ public:
      * @param value A boolean value.
      */
     void add(bool value) noexcept {
-        open_string = false;
-        output += static_cast<std::byte>(value ? BON8_code_bool_true : BON8_code_bool_false);
+        _open_string = false;
+        append(static_cast<std::byte>(value ? BON8_code_bool_true : BON8_code_bool_false));
     }
 
     /** Add a null.
      * @param value A null pointer.
      */
     void add(nullptr_t value) noexcept {
-        open_string = false;
-        output += static_cast<std::byte>(BON8_code_null);
+        _open_string = false;
+        append(static_cast<std::byte>(BON8_code_null));
     }
 
     /** Add a UTF-8 string.
@@ -259,21 +305,21 @@ public:
      * @param value A UTF-8 string.
      */
     void add(std::u8string_view value) noexcept {
-        if (open_string) {
-            output += static_cast<std::byte>(BON8_code_eot);
+        if (_open_string) {
+            append(static_cast<std::byte>(BON8_code_eot));
         }
 
         if (std::ssize(value) == 0) {
-            output += static_cast<std::byte>(BON8_code_eot);
-            open_string = false;
+            append(static_cast<std::byte>(BON8_code_eot));
+            _open_string = false;
 
         } else {
-            int multi_byte = 0;
+            if constexpr (BuildType::current == BuildType::Debug) {
+                int multi_byte = 0;
 
-            for (ttlet _c : value) {
-                ttlet c = static_cast<uint8_t>(_c);
+                for (ttlet _c : value) {
+                    ttlet c = static_cast<uint8_t>(_c);
 
-                if constexpr (BuildType::current == BuildType::Debug) {
                     if (multi_byte == 0) {
                         if (c >= 0xc2 && c <= 0xdf) {
                             multi_byte = 1;
@@ -291,12 +337,11 @@ public:
                     }
                 }
 
-                output += static_cast<std::byte>(c);
+                tt_assert(multi_byte == 0);
             }
 
-            tt_assert(multi_byte == 0);
-
-            open_string = true;
+            append(reinterpret_cast<std::byte const *>(value.data()), std::ssize(value));
+            _open_string = true;
         }
     }
 
@@ -318,8 +363,20 @@ public:
         return add(std::u8string_view{value});
     }
 
+    /** Add a UTF-8 string.
+     * It is important that the UTF-8 string is valid.
+     *
+     * @param value A UTF-8 string.
+     */
+    void add(std::string_view value) noexcept {
+        return add(std::u8string_view{reinterpret_cast<char8_t const *>(value.data()), value.size()});
+    }
+
     /** Add a datum.
+     * The items of a vector or map are added directly from the datum, without copying.
+     *
      * @param value A datum.
+     * @throw operation_error When the datum, or one of its items, can not be encoded.
      */
     void add(datum const &value);
 
@@ -329,19 +386,19 @@ public:
      */
     template<typename T>
     void add(std::vector<T> const &items) {
-        open_string = false;
+        _open_string = false;
         if (std::ssize(items) == 0) {
-            output += static_cast<std::byte>(BON8_code_array_empty);
+            append(static_cast<std::byte>(BON8_code_array_empty));
         } else {
-            output += static_cast<std::byte>(BON8_code_array);
+            append(static_cast<std::byte>(BON8_code_array));
 
             for (ttlet &item: items) {
                 add(item);
             }
 
-            output += static_cast<std::byte>(BON8_code_eoc);
+            append(static_cast<std::byte>(BON8_code_eoc));
         }
-        open_string = false;
+        _open_string = false;
     }
 
     /** Add a map of key/values pairs.
@@ -353,32 +410,32 @@ public:
     void add(std::map<Key,Value> const &items) {
         using item_type = typename std::map<Key,Value>::value_type;
 
-        open_string = false;
+        _open_string = false;
         if (std::ssize(items) == 0) {
-            output += static_cast<std::byte>(BON8_code_object_empty);
+            append(static_cast<std::byte>(BON8_code_object_empty));
         } else {
             // Keys must be ordered lexically.
-            auto sorted_items = std::vector<std::reference_wrapper<item_type>>{items.begin(), items.end()};
+            auto sorted_items = std::vector<std::reference_wrapper<item_type const>>{items.begin(), items.end()};
             std::sort(sorted_items.begin(), sorted_items.end(), [](item_type const &a, item_type const &b) {
                 return
                     static_cast<std::u8string_view>(a.first) <
                     static_cast<std::u8string_view>(b.first);
             });
 
-            output += static_cast<std::byte>(BON8_code_object);
+            append(static_cast<std::byte>(BON8_code_object));
             for (item_type const &item: sorted_items) {
                 add(static_cast<std::u8string_view>(item.first));
                 add(item.second);
             }
-            output += static_cast<std::byte>(BON8_code_eoc);
+            append(static_cast<std::byte>(BON8_code_eoc));
         }
-        open_string = false;
+        _open_string = false;
     }
 };
 
-void BON8_encoder::add(datum const &value) {
+inline void BON8_encoder::add(datum const &value) {
     if (value.is_string() || value.is_url()) {
-        add(static_cast<std::string>(value));
+        add(std::string_view{static_cast<std::string>(value)});
     } else if (value.is_bool()) {
         add(static_cast<bool>(value));
     } else if (value.is_null()) {
@@ -388,9 +445,43 @@ void BON8_encoder::add(datum const &value) {
     } else if (value.is_float()) {
         add(static_cast<double>(value));
     } else if (value.is_vector()) {
-        add(static_cast<datum::vector>(value));
+        _open_string = false;
+        if (value.size() == 0) {
+            append(static_cast<std::byte>(BON8_code_array_empty));
+        } else {
+            append(static_cast<std::byte>(BON8_code_array));
+            for (auto i = value.vector_begin(); i != value.vector_end(); ++i) {
+                add(*i);
+            }
+            append(static_cast<std::byte>(BON8_code_eoc));
+        }
+        _open_string = false;
     } else if (value.is_map()) {
-        add(static_cast<datum::map>(value));
+        _open_string = false;
+        if (value.size() == 0) {
+            append(static_cast<std::byte>(BON8_code_object_empty));
+        } else {
+            // Keys must be ordered lexically.
+            auto sorted_items = std::vector<std::pair<std::string, datum const *>>{};
+            sorted_items.reserve(value.size());
+            for (auto i = value.map_begin(); i != value.map_end(); ++i) {
+                if (not i->first.is_string()) {
+                    throw operation_error("Datum map with a non-string key can not be encoded to BON8");
+                }
+                sorted_items.emplace_back(static_cast<std::string>(i->first), &i->second);
+            }
+            std::sort(sorted_items.begin(), sorted_items.end(), [](ttlet &a, ttlet &b) {
+                return a.first < b.first;
+            });
+
+            append(static_cast<std::byte>(BON8_code_object));
+            for (ttlet &item: sorted_items) {
+                add(std::string_view{item.first});
+                add(*item.second);
+            }
+            append(static_cast<std::byte>(BON8_code_eoc));
+        }
+        _open_string = false;
     } else {
         throw operation_error("Datum value can not be encoded to BON8");
     }
@@ -404,7 +495,7 @@ void BON8_encoder::add(datum const &value) {
  * @return When positive: the number of bytes in the UTF-8 character.
  *         When negative: the number of bytes in the integer.
  */
-[[nodiscard]] int BON8_multibyte_count(cbyteptr ptr, cbyteptr last) {
+[[nodiscard]] inline int BON8_multibyte_count(cbyteptr ptr, cbyteptr last) {
     ttlet c0 = static_cast<uint8_t>(*ptr);
     int count =
         c0 <= 0xdf ? 2 :
@@ -425,7 +516,7 @@ void BON8_encoder::add(datum const &value) {
  * @param count The number of bytes used to encode the integer.
  * @return The integer as a datum.
  */
-[[nodiscard]] datum decode_BON8_int(cbyteptr &ptr, cbyteptr last, int count)
+[[nodiscard]] inline datum decode_BON8_int(cbyteptr &ptr, cbyteptr last, int count)
 {
     tt_axiom(count == 4 || count == 8);
 
@@ -446,7 +537,7 @@ void BON8_encoder::add(datum const &value) {
     }
 }
 
-[[nodiscard]] datum decode_BON8_float(cbyteptr &ptr, cbyteptr last, int count)
+[[nodiscard]] inline datum decode_BON8_float(cbyteptr &ptr, cbyteptr last, int count)
 {
     tt_axiom(count == 4 || count == 8);
 
@@ -470,7 +561,7 @@ void BON8_encoder::add(datum const &value) {
     }
 }
 
-[[nodiscard]] datum decode_BON8_array(cbyteptr &ptr, cbyteptr last)
+[[nodiscard]] inline datum decode_BON8_array(cbyteptr &ptr, cbyteptr last)
 {
     auto r = datum::vector{};
 
@@ -486,7 +577,7 @@ void BON8_encoder::add(datum const &value) {
     throw parse_error("Incomplete array at end of buffer");
 }
 
-[[nodiscard]] datum decode_BON8_object(cbyteptr &ptr, cbyteptr last)
+[[nodiscard]] inline datum decode_BON8_object(cbyteptr &ptr, cbyteptr last)
 {
     auto r = datum::map{};
 
@@ -506,7 +597,7 @@ void BON8_encoder::add(datum const &value) {
     throw parse_error("Incomplete array at end of buffer");
 }
 
-[[nodiscard]] datum decode_BON8_UTF8_like_int(cbyteptr &ptr, cbyteptr last, int count) noexcept
+[[nodiscard]] inline datum decode_BON8_UTF8_like_int(cbyteptr &ptr, cbyteptr last, int count) noexcept
 {
     tt_axiom(count >= 2 && count <= 4);
     tt_axiom(ptr != last);
@@ -526,7 +617,7 @@ void BON8_encoder::add(datum const &value) {
         value |= static_cast<int>(c1);
     } else {
         value <<= 6;
-        value |= static_cast<int>(c1 & 0b0011'11111);
+        value |= static_cast<int>(c1 & 0b0011'1111);
     }
 
     switch (count) {
@@ -543,10 +634,10 @@ void BON8_encoder::add(datum const &value) {
     default:;
     }
 
-    return datum{is_positive ? value : -value};
+    return datum{is_positive ? value : -value - 1};
 }
 
-[[nodiscard]] datum decode_BON8(cbyteptr &ptr, cbyteptr last) {
+[[nodiscard]] inline datum decode_BON8(cbyteptr &ptr, cbyteptr last) {
     std::string str;
 
     while (ptr != last) {
@@ -587,15 +678,25 @@ void BON8_encoder::add(datum const &value) {
         // Everything below this, are non-string types.
         } else if (c <= 0xaf) {
             // 1 byte positive integer
+            ++ptr;
             return datum{c - 0x80};
 
         } else if (c <= 0xb9) {
             // 1 byte negative integer
-            return datum{-static_cast<int>(c - 0xb0)};
+            ++ptr;
+            return datum{-static_cast<int>(c - 0xb0) - 1};
 
         } else {
             // This is one of the non-string types.
             switch (c) {
+            case BON8_code_array_empty:
+                ++ptr;
+                return datum{datum::vector{}};
+
+            case BON8_code_object_empty:
+                ++ptr;
+                return datum{datum::map{}};
+
             case BON8_code_null:
                 ++ptr;
                 return datum{datum::null{}};
@@ -614,7 +715,7 @@ void BON8_encoder::add(datum const &value) {
 
             case BON8_code_float_zero:
                 ++ptr;
-                return datum{-0.0f};
+                return datum{0.0f};
 
             case BON8_code_float_one:
                 ++ptr;
@@ -660,7 +761,7 @@ void BON8_encoder::add(datum const &value) {
  * @param buffer A buffer to a BON8 encoded message.
  * @return The decoded message.
  */
-[[nodiscard]] datum decode_BON8(std::span<const std::byte> buffer)
+[[nodiscard]] inline datum decode_BON8(std::span<const std::byte> buffer)
 {
     auto *ptr = buffer.data();
     auto *last = ptr + buffer.size();
@@ -671,7 +772,7 @@ void BON8_encoder::add(datum const &value) {
  * @param buffer A buffer to a BON8 encoded message.
  * @return The decoded message.
  */
-[[nodiscard]] datum decode_BON8(bstring const &buffer)
+[[nodiscard]] inline datum decode_BON8(bstring const &buffer)
 {
     auto *ptr = buffer.data();
     auto *last = ptr + buffer.size();
@@ -682,22 +783,52 @@ void BON8_encoder::add(datum const &value) {
  * @param buffer A buffer to a BON8 encoded message.
  * @return The decoded message.
  */
-[[nodiscard]] datum decode_BON8(bstring_view buffer)
+[[nodiscard]] inline datum decode_BON8(bstring_view buffer)
 {
     auto *ptr = buffer.data();
     auto *last = ptr + buffer.size();
     return detail::decode_BON8(ptr, last);
 }
 
-/** Encode a value to a BON8 message.
+/** Calculate the size of the BON8 message of a value.
  * @param value The data to encode
- * @return The encoded message as a byte_string.
+ * @return The number of bytes of the encoded message.
  */
-[[nodiscard]] bstring encode_BON8(datum const &value)
+[[nodiscard]] inline ssize_t BON8_encoded_size(datum const &value)
 {
     auto encoder = detail::BON8_encoder{};
     encoder.add(value);
-    return encoder.get();
+    return encoder.size();
+}
+
+/** Encode a value to a BON8 message into a buffer.
+ * The buffer may be a memory-mapped file, sized with `BON8_encoded_size()`.
+ *
+ * @param value The data to encode
+ * @param buffer The buffer to write the message into.
+ * @return The number of bytes of the encoded message. When this is larger than the buffer,
+ *         the buffer holds only the start of the message.
+ */
+[[nodiscard]] inline ssize_t encode_BON8(datum const &value, std::span<std::byte> buffer)
+{
+    auto encoder = detail::BON8_encoder{buffer};
+    encoder.add(value);
+    return encoder.size();
+}
+
+/** Encode a value to a BON8 message.
+ * The message is measured first, so that it is encoded into a single allocation.
+ *
+ * @param value The data to encode
+ * @return The encoded message as a byte_string.
+ */
+[[nodiscard]] inline bstring encode_BON8(datum const &value)
+{
+    auto r = bstring{};
+    r.resize(narrow_cast<size_t>(BON8_encoded_size(value)));
+    ttlet size = encode_BON8(value, std::span<std::byte>{r.data(), r.size()});
+    tt_axiom(size == std::ssize(r));
+    return r;
 }
 
 }
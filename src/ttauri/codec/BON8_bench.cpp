@@ -0,0 +1,57 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/codec/BON8.hpp"
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+using namespace std;
+using namespace tt;
+
+/** A document shaped like the font index, with nr_items entries.
+ */
+[[nodiscard]] static datum make_BON8_bench_document(int64_t nr_items) noexcept
+{
+    auto items = datum::map{};
+    for (int64_t i = 0; i != nr_items; ++i) {
+        auto item = datum::map{};
+        item["stamp"] = datum::vector{datum{i * 4096}, datum{i * 1'000'003}};
+        item["family_name"] = fmt::format("Family {}", i / 4);
+        item["weight"] = (i % 9) * 100;
+        item["italic"] = (i % 2) == 0;
+        item["x_height"] = static_cast<double>(i) * 0.25;
+        items[fmt::format("file:///fonts/font-{}.ttf", i)] = datum{std::move(item)};
+    }
+
+    auto r = datum::map{};
+    r["version"] = 1;
+    r["fonts"] = std::move(items);
+    return datum{std::move(r)};
+}
+
+static void BON8_decode(benchmark::State &state)
+{
+    ttlet bytes = encode_BON8(make_BON8_bench_document(state.range(0)));
+
+    for (auto _ : state) {
+        auto document = decode_BON8(bytes);
+        benchmark::DoNotOptimize(document);
+    }
+    state.SetBytesProcessed(state.iterations() * std::ssize(bytes));
+}
+BENCHMARK(BON8_decode)->Arg(10)->Arg(1000);
+
+static void BON8_encode(benchmark::State &state)
+{
+    ttlet document = make_BON8_bench_document(state.range(0));
+
+    auto nr_bytes = int64_t{0};
+    for (auto _ : state) {
+        ttlet bytes = encode_BON8(document);
+        nr_bytes += std::ssize(bytes);
+        benchmark::DoNotOptimize(bytes.data());
+    }
+    state.SetBytesProcessed(nr_bytes);
+}
+BENCHMARK(BON8_encode)->Arg(10)->Arg(1000);
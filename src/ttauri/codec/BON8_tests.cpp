@@ -0,0 +1,68 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/codec/BON8.hpp"
+#include "ttauri/required.hpp"
+#include <gtest/gtest.h>
+#include <iostream>
+#include <array>
+
+using namespace std;
+using namespace tt;
+
+[[nodiscard]] static datum make_test_value()
+{
+    auto r = datum::map{};
+    r["a"] = 5;
+    r["bb"] = datum::vector{1, -1, "x", 300, -500, 100000, -100000, 5000000, 3000000000LL, 1.5, true, datum::null{}};
+    r["c"] = "hello";
+    r["d"] = datum::map{};
+    return datum{r};
+}
+
+TEST(BON8, EncodeIntegers) {
+    auto encoder = detail::BON8_encoder{};
+    encoder.add(47);
+    encoder.add(-10);
+    encoder.add(300);
+    encoder.add(-500);
+    ASSERT_EQ(encoder.size(), 6);
+    ASSERT_TRUE(encoder.overflow());
+
+    auto buffer = std::array<std::byte, 6>{};
+    encoder = detail::BON8_encoder{buffer};
+    encoder.add(47);
+    encoder.add(-10);
+    encoder.add(300);
+    encoder.add(-500);
+    ASSERT_FALSE(encoder.overflow());
+    ASSERT_EQ(buffer[0], std::byte{0xaf});
+    ASSERT_EQ(buffer[1], std::byte{0xb9});
+    ASSERT_EQ(buffer[2], std::byte{0xc4});
+    ASSERT_EQ(buffer[3], std::byte{0x2c});
+    ASSERT_EQ(buffer[4], std::byte{0xc9});
+    ASSERT_EQ(buffer[5], std::byte{0xf3});
+}
+
+TEST(BON8, RoundTrip) {
+    ttlet value = make_test_value();
+    ttlet bytes = encode_BON8(value);
+
+    ASSERT_EQ(std::ssize(bytes), BON8_encoded_size(value));
+    ASSERT_EQ(decode_BON8(bytes), value);
+}
+
+TEST(BON8, EncodeIntoBuffer) {
+    ttlet value = make_test_value();
+    ttlet expected = encode_BON8(value);
+
+    auto buffer = bstring(expected.size(), std::byte{0});
+    ASSERT_EQ(encode_BON8(value, std::span<std::byte>{buffer.data(), buffer.size()}), std::ssize(expected));
+    ASSERT_EQ(buffer, expected);
+
+    // A message that does not fit, reports the full size and fills the buffer with the start of the message.
+    auto small_buffer = bstring(expected.size() / 2, std::byte{0});
+    ASSERT_EQ(encode_BON8(value, std::span<std::byte>{small_buffer.data(), small_buffer.size()}), std::ssize(expected));
+    ASSERT_EQ(small_buffer, expected.substr(0, small_buffer.size()));
+}
@@ -0,0 +1,359 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "BON8_view.hpp"
+#include "BON8.hpp"
+#include "../check.hpp"
+#include <cstring>
+
+namespace tt {
+namespace detail {
+
+/** Find the end of the characters of a string.
+ *
+ * @param ptr The first byte of the string.
+ * @param last One beyond the last byte of the message.
+ * @return One beyond the last character; the end-of-text after the string is not included.
+ */
+[[nodiscard]] static cbyteptr BON8_skip_characters(cbyteptr ptr, cbyteptr last)
+{
+    while (ptr != last) {
+        ttlet c = static_cast<uint8_t>(*ptr);
+        if (c <= 0x7f) {
+            ++ptr;
+        } else if (c >= 0xc2 && c <= 0xf7) {
+            ttlet count = BON8_multibyte_count(ptr, last);
+            if (count < 0) {
+                // A multi-byte integer follows the string.
+                break;
+            }
+            ptr += count;
+        } else {
+            break;
+        }
+    }
+    return ptr;
+}
+
+[[nodiscard]] static bool BON8_is_string(cbyteptr ptr, cbyteptr last)
+{
+    tt_parse_check(ptr != last, "Unexpected end-of-buffer");
+
+    ttlet c = static_cast<uint8_t>(*ptr);
+    if (c <= 0x7f || c == BON8_code_eot) {
+        return true;
+    } else if (c >= 0xc2 && c <= 0xf7) {
+        return BON8_multibyte_count(ptr, last) > 0;
+    } else {
+        return false;
+    }
+}
+
+/** Skip over a value without decoding it.
+ *
+ * @param ptr The first byte of the value.
+ * @param last One beyond the last byte of the message.
+ * @return One beyond the last byte of the value.
+ */
+[[nodiscard]] static cbyteptr BON8_skip(cbyteptr ptr, cbyteptr last)
+{
+    auto skip_bytes = [&](ssize_t count) {
+        tt_parse_check(last - ptr >= count, "Unexpected end-of-buffer");
+        return ptr + count;
+    };
+
+    if (BON8_is_string(ptr, last)) {
+        ptr = BON8_skip_characters(ptr, last);
+        return (ptr != last && static_cast<uint8_t>(*ptr) == BON8_code_eot) ? ptr + 1 : ptr;
+    }
+
+    ttlet c = static_cast<uint8_t>(*ptr);
+    if (c >= 0xc2 && c <= 0xf7) {
+        return skip_bytes(-BON8_multibyte_count(ptr, last));
+    }
+
+    switch (c) {
+    case BON8_code_int32:
+    case BON8_code_binary32: return skip_bytes(5);
+    case BON8_code_int64:
+    case BON8_code_binary64: return skip_bytes(9);
+
+    case BON8_code_array:
+    case BON8_code_object:
+        ++ptr;
+        while (true) {
+            tt_parse_check(ptr != last, "Incomplete container at end of buffer");
+            if (static_cast<uint8_t>(*ptr) == BON8_code_eoc) {
+                return ptr + 1;
+            }
+            ptr = BON8_skip(ptr, last);
+        }
+
+    case BON8_code_eoc: throw parse_error("Unexpected end-of-container");
+
+    default:
+        // Small integers, constant floats, empty containers, null and booleans.
+        return ptr + 1;
+    }
+}
+
+[[nodiscard]] static uint64_t BON8_load_big_endian(cbyteptr ptr, int count) noexcept
+{
+    auto r = uint64_t{0};
+    for (int i = 0; i != count; ++i) {
+        r <<= 8;
+        r |= static_cast<uint64_t>(ptr[i]);
+    }
+    return r;
+}
+
+} // namespace detail
+
+using namespace detail;
+
+BON8_view::array_iterator::array_iterator(cbyteptr ptr, cbyteptr last) : _ptr(ptr), _last(last)
+{
+    tt_parse_check(_ptr != _last, "Incomplete array at end of buffer");
+    if (static_cast<uint8_t>(*_ptr) == BON8_code_eoc) {
+        _ptr = nullptr;
+    }
+}
+
+BON8_view::array_iterator &BON8_view::array_iterator::operator++()
+{
+    tt_axiom(_ptr != nullptr);
+    *this = array_iterator{BON8_skip(_ptr, _last), _last};
+    return *this;
+}
+
+BON8_view::object_iterator::object_iterator(cbyteptr ptr, cbyteptr last) : _key(ptr), _value(nullptr), _last(last)
+{
+    tt_parse_check(_key != _last, "Incomplete object at end of buffer");
+    if (static_cast<uint8_t>(*_key) == BON8_code_eoc) {
+        _key = nullptr;
+    } else {
+        tt_parse_check(BON8_is_string(_key, _last), "Key in object is not a string");
+        _value = BON8_skip(_key, _last);
+        tt_parse_check(_value != _last, "Incomplete object at end of buffer");
+    }
+}
+
+[[nodiscard]] BON8_view::object_iterator::value_type BON8_view::object_iterator::operator*() const
+{
+    tt_axiom(_key != nullptr);
+    return {static_cast<std::u8string_view>(BON8_view{_key, _last}), BON8_view{_value, _last}};
+}
+
+BON8_view::object_iterator &BON8_view::object_iterator::operator++()
+{
+    tt_axiom(_key != nullptr);
+    *this = object_iterator{BON8_skip(_value, _last), _last};
+    return *this;
+}
+
+[[nodiscard]] bool BON8_view::is_null() const
+{
+    tt_parse_check(_ptr != _last, "Unexpected end-of-buffer");
+    return static_cast<uint8_t>(*_ptr) == BON8_code_null;
+}
+
+[[nodiscard]] bool BON8_view::is_bool() const
+{
+    tt_parse_check(_ptr != _last, "Unexpected end-of-buffer");
+    ttlet c = static_cast<uint8_t>(*_ptr);
+    return c == BON8_code_bool_false || c == BON8_code_bool_true;
+}
+
+[[nodiscard]] bool BON8_view::is_integer() const
+{
+    if (is_string()) {
+        return false;
+    }
+    ttlet c = static_cast<uint8_t>(*_ptr);
+    return (c >= 0x80 && c <= 0xb9) || (c >= 0xc2 && c <= 0xf7) || c == BON8_code_int32 || c == BON8_code_int64;
+}
+
+[[nodiscard]] bool BON8_view::is_float() const
+{
+    tt_parse_check(_ptr != _last, "Unexpected end-of-buffer");
+    ttlet c = static_cast<uint8_t>(*_ptr);
+    return (c >= BON8_code_float_min_one && c <= BON8_code_float_one) || c == BON8_code_binary32 ||
+        c == BON8_code_binary64;
+}
+
+[[nodiscard]] bool BON8_view::is_string() const
+{
+    return BON8_is_string(_ptr, _last);
+}
+
+[[nodiscard]] bool BON8_view::is_array() const
+{
+    tt_parse_check(_ptr != _last, "Unexpected end-of-buffer");
+    ttlet c = static_cast<uint8_t>(*_ptr);
+    return c == BON8_code_array || c == BON8_code_array_empty;
+}
+
+[[nodiscard]] bool BON8_view::is_object() const
+{
+    tt_parse_check(_ptr != _last, "Unexpected end-of-buffer");
+    ttlet c = static_cast<uint8_t>(*_ptr);
+    return c == BON8_code_object || c == BON8_code_object_empty;
+}
+
+[[nodiscard]] BON8_view::operator bool() const
+{
+    tt_parse_check(is_bool(), "BON8 value is not a boolean");
+    return static_cast<uint8_t>(*_ptr) == BON8_code_bool_true;
+}
+
+[[nodiscard]] BON8_view::operator long long() const
+{
+    tt_parse_check(is_integer(), "BON8 value is not an integer");
+
+    ttlet c0 = static_cast<uint8_t>(*_ptr);
+    if (c0 <= 0xaf) {
+        return c0 - 0x80;
+
+    } else if (c0 <= 0xb9) {
+        return -static_cast<long long>(c0 - 0xb0) - 1;
+
+    } else if (c0 == BON8_code_int32) {
+        tt_parse_check(_last - _ptr >= 5, "Incomplete signed integer at end of buffer");
+        return static_cast<int32_t>(static_cast<uint32_t>(BON8_load_big_endian(_ptr + 1, 4)));
+
+    } else if (c0 == BON8_code_int64) {
+        tt_parse_check(_last - _ptr >= 9, "Incomplete signed integer at end of buffer");
+        return static_cast<int64_t>(BON8_load_big_endian(_ptr + 1, 8));
+    }
+
+    // A UTF-8-like multi-byte integer, the second byte determines the sign.
+    ttlet count = -BON8_multibyte_count(_ptr, _last);
+    ttlet c1 = static_cast<uint8_t>(_ptr[1]);
+    ttlet is_positive = c1 <= 0x7f;
+
+    auto value = static_cast<long long>(c0 & (0x7f >> count));
+    if (count == 2) {
+        value -= 2;
+    }
+    value = is_positive ? (value << 7) | c1 : (value << 6) | (c1 & 0x3f);
+    for (int i = 2; i != count; ++i) {
+        value = (value << 8) | static_cast<uint8_t>(_ptr[i]);
+    }
+    return is_positive ? value : -value - 1;
+}
+
+[[nodiscard]] BON8_view::operator double() const
+{
+    if (is_integer()) {
+        return static_cast<double>(static_cast<long long>(*this));
+    }
+
+    tt_parse_check(is_float(), "BON8 value is not a number");
+    switch (static_cast<uint8_t>(*_ptr)) {
+    case BON8_code_float_min_one: return -1.0;
+    case BON8_code_float_zero: return 0.0;
+    case BON8_code_float_one: return 1.0;
+    case BON8_code_binary32: {
+        tt_parse_check(_last - _ptr >= 5, "Incomplete floating point number at end of buffer");
+        ttlet u32 = static_cast<uint32_t>(BON8_load_big_endian(_ptr + 1, 4));
+        float f32;
+        std::memcpy(&f32, &u32, sizeof(f32));
+        return f32;
+    }
+    case BON8_code_binary64: {
+        tt_parse_check(_last - _ptr >= 9, "Incomplete floating point number at end of buffer");
+        ttlet u64 = BON8_load_big_endian(_ptr + 1, 8);
+        double f64;
+        std::memcpy(&f64, &u64, sizeof(f64));
+        return f64;
+    }
+    default: tt_no_default();
+    }
+}
+
+[[nodiscard]] BON8_view::operator std::u8string_view() const
+{
+    tt_parse_check(is_string(), "BON8 value is not a string");
+    ttlet end = BON8_skip_characters(_ptr, _last);
+    return {reinterpret_cast<char8_t const *>(_ptr), narrow_cast<size_t>(end - _ptr)};
+}
+
+[[nodiscard]] ssize_t BON8_view::size() const
+{
+    auto r = ssize_t{0};
+    if (is_array()) {
+        for (auto i = array_begin(); i != array_end(); ++i) {
+            ++r;
+        }
+    } else {
+        for (auto i = object_begin(); i != object_end(); ++i) {
+            ++r;
+        }
+    }
+    return r;
+}
+
+[[nodiscard]] BON8_view::array_iterator BON8_view::array_begin() const
+{
+    tt_parse_check(is_array(), "BON8 value is not an array");
+    if (static_cast<uint8_t>(*_ptr) == BON8_code_array_empty) {
+        return {};
+    }
+    return {_ptr + 1, _last};
+}
+
+[[nodiscard]] BON8_view::object_iterator BON8_view::object_begin() const
+{
+    tt_parse_check(is_object(), "BON8 value is not an object");
+    if (static_cast<uint8_t>(*_ptr) == BON8_code_object_empty) {
+        return {};
+    }
+    return {_ptr + 1, _last};
+}
+
+[[nodiscard]] BON8_view BON8_view::operator[](ssize_t index) const
+{
+    tt_parse_check(index >= 0, "Index into BON8 array out of range");
+
+    auto i = array_begin();
+    for (; index != 0 && i != array_end(); --index) {
+        ++i;
+    }
+    tt_parse_check(i != array_end(), "Index into BON8 array out of range");
+    return *i;
+}
+
+[[nodiscard]] BON8_view::object_iterator BON8_view::find(std::u8string_view key) const
+{
+    for (auto i = object_begin(); i != object_end(); ++i) {
+        ttlet item_key = static_cast<std::u8string_view>(BON8_view{i._key, _last});
+        if (item_key == key) {
+            return i;
+        } else if (item_key > key) {
+            // The keys of an object are ordered lexically.
+            break;
+        }
+    }
+    return {};
+}
+
+[[nodiscard]] BON8_view BON8_view::operator[](std::u8string_view key) const
+{
+    ttlet i = find(key);
+    tt_parse_check(i != object_end(), "Key not found in BON8 object");
+    return BON8_view{i._value, _last};
+}
+
+[[nodiscard]] bool BON8_view::contains(std::u8string_view key) const
+{
+    return find(key) != object_end();
+}
+
+[[nodiscard]] datum BON8_view::to_datum() const
+{
+    auto ptr = _ptr;
+    return decode_BON8(ptr, _last);
+}
+
+} // namespace tt
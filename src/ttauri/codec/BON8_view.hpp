@@ -0,0 +1,218 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../byte_string.hpp"
+#include "../required.hpp"
+#include "../datum.hpp"
+#include <span>
+#include <string_view>
+#include <iterator>
+#include <utility>
+#include <cstddef>
+
+namespace tt {
+
+/** A view of a BON8 encoded value, decoded lazily in place.
+ *
+ * Values are only decoded when they are accessed. Indexing into an array or object
+ * skips over the preceding items without decoding them, and strings are returned as
+ * views into the encoded message. The encoded message, for example the bytes of a `file_view`,
+ * must outlive the view and the strings retrieved from it.
+ *
+ * Errors in the encoded message are reported with a `parse_error` when the
+ * erroneous part of the message is accessed.
+ */
+class BON8_view {
+public:
+    /** Iterator over the items of an array.
+     * The end of the array is denoted by a `std::default_sentinel_t`.
+     */
+    class array_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = BON8_view;
+        using difference_type = std::ptrdiff_t;
+
+        array_iterator() noexcept : _ptr(nullptr), _last(nullptr) {}
+
+        [[nodiscard]] BON8_view operator*() const noexcept
+        {
+            return BON8_view{_ptr, _last};
+        }
+
+        array_iterator &operator++();
+
+        array_iterator operator++(int)
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        [[nodiscard]] bool operator==(array_iterator const &rhs) const noexcept = default;
+
+        [[nodiscard]] bool operator==(std::default_sentinel_t) const noexcept
+        {
+            return _ptr == nullptr;
+        }
+
+    private:
+        /** The first byte of the current item, or nullptr at the end of the array.
+         */
+        cbyteptr _ptr;
+        cbyteptr _last;
+
+        array_iterator(cbyteptr ptr, cbyteptr last);
+
+        friend BON8_view;
+    };
+
+    /** Iterator over the key/value pairs of an object.
+     * The end of the object is denoted by a `std::default_sentinel_t`.
+     */
+    class object_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<std::u8string_view, BON8_view>;
+        using difference_type = std::ptrdiff_t;
+
+        object_iterator() noexcept : _key(nullptr), _value(nullptr), _last(nullptr) {}
+
+        [[nodiscard]] value_type operator*() const;
+
+        object_iterator &operator++();
+
+        object_iterator operator++(int)
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        [[nodiscard]] bool operator==(object_iterator const &rhs) const noexcept
+        {
+            return _key == rhs._key;
+        }
+
+        [[nodiscard]] bool operator==(std::default_sentinel_t) const noexcept
+        {
+            return _key == nullptr;
+        }
+
+    private:
+        /** The first byte of the current key, or nullptr at the end of the object.
+         */
+        cbyteptr _key;
+        cbyteptr _value;
+        cbyteptr _last;
+
+        object_iterator(cbyteptr ptr, cbyteptr last);
+
+        friend BON8_view;
+    };
+
+    /** Create a view of a BON8 encoded message.
+     *
+     * @param bytes The encoded message.
+     */
+    explicit BON8_view(std::span<std::byte const> bytes) noexcept :
+        BON8_view(bytes.data(), bytes.data() + bytes.size())
+    {
+    }
+
+    BON8_view(BON8_view const &) noexcept = default;
+    BON8_view(BON8_view &&) noexcept = default;
+    BON8_view &operator=(BON8_view const &) noexcept = default;
+    BON8_view &operator=(BON8_view &&) noexcept = default;
+
+    [[nodiscard]] bool is_null() const;
+    [[nodiscard]] bool is_bool() const;
+    [[nodiscard]] bool is_integer() const;
+    [[nodiscard]] bool is_float() const;
+    [[nodiscard]] bool is_string() const;
+    [[nodiscard]] bool is_array() const;
+    [[nodiscard]] bool is_object() const;
+
+    /** Get a boolean value.
+     * @throw parse_error When the value is not a boolean.
+     */
+    [[nodiscard]] explicit operator bool() const;
+
+    /** Get an integer value.
+     * @throw parse_error When the value is not an integer.
+     */
+    [[nodiscard]] explicit operator long long() const;
+
+    /** Get a floating point value; integers are converted.
+     * @throw parse_error When the value is not a number.
+     */
+    [[nodiscard]] explicit operator double() const;
+
+    /** Get a string value.
+     * @return The string as a view into the encoded message.
+     * @throw parse_error When the value is not a string.
+     */
+    [[nodiscard]] explicit operator std::u8string_view() const;
+
+    /** The number of items in an array, or key/value pairs in an object.
+     * @throw parse_error When the value is not an array or object.
+     */
+    [[nodiscard]] ssize_t size() const;
+
+    [[nodiscard]] array_iterator array_begin() const;
+
+    [[nodiscard]] std::default_sentinel_t array_end() const noexcept
+    {
+        return std::default_sentinel;
+    }
+
+    [[nodiscard]] object_iterator object_begin() const;
+
+    [[nodiscard]] std::default_sentinel_t object_end() const noexcept
+    {
+        return std::default_sentinel;
+    }
+
+    /** Get an item of an array.
+     * The items before the requested item are skipped without being decoded.
+     *
+     * @param index The index of the item.
+     * @throw parse_error When the value is not an array or the index is out of range.
+     */
+    [[nodiscard]] BON8_view operator[](ssize_t index) const;
+
+    /** Get the value of a key in an object.
+     * @throw parse_error When the value is not an object or the key was not found.
+     */
+    [[nodiscard]] BON8_view operator[](std::u8string_view key) const;
+
+    /** Check if an object contains a key.
+     * @throw parse_error When the value is not an object.
+     */
+    [[nodiscard]] bool contains(std::u8string_view key) const;
+
+    /** Decode the value, including all items of an array or object, into a datum.
+     */
+    [[nodiscard]] datum to_datum() const;
+
+private:
+    /** The first byte of the value.
+     */
+    cbyteptr _ptr;
+
+    /** One beyond the last byte of the message.
+     */
+    cbyteptr _last;
+
+    BON8_view(cbyteptr ptr, cbyteptr last) noexcept : _ptr(ptr), _last(last) {}
+
+    /** Find the value of a key in an object.
+     * @return An iterator to the key/value pair, or at the end of the object when not found.
+     */
+    [[nodiscard]] object_iterator find(std::u8string_view key) const;
+};
+
+} // namespace tt
@@ -0,0 +1,112 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/codec/BON8_view.hpp"
+#include "ttauri/codec/BON8.hpp"
+#include "ttauri/required.hpp"
+#include <gtest/gtest.h>
+#include <iostream>
+#include <initializer_list>
+
+using namespace std;
+using namespace tt;
+
+[[nodiscard]] static bstring make_bytes(std::initializer_list<int> values)
+{
+    auto r = bstring{};
+    for (ttlet value : values) {
+        r += static_cast<std::byte>(value);
+    }
+    return r;
+}
+
+// {"a": 5, "bb": [1, -1, "x", 300, -500], "c": "hello", "d": true}
+static ttlet test_message = make_bytes({
+    0xfd,
+    'a', 0x85,
+    'b', 'b', 0xfc, 0x81, 0xb0, 'x', 0xc4, 0x2c, 0xc9, 0xf3, 0xfe,
+    'c', 0xff, 'h', 'e', 'l', 'l', 'o', 0xff,
+    'd', 0xc1,
+    0xfe});
+
+TEST(BON8_view, Scalars) {
+    ASSERT_TRUE(BON8_view(make_bytes({0xbf})).is_null());
+    ASSERT_EQ(static_cast<bool>(BON8_view(make_bytes({0xc0}))), false);
+    ASSERT_EQ(static_cast<bool>(BON8_view(make_bytes({0xc1}))), true);
+
+    ASSERT_EQ(static_cast<long long>(BON8_view(make_bytes({0x80}))), 0);
+    ASSERT_EQ(static_cast<long long>(BON8_view(make_bytes({0xaf}))), 47);
+    ASSERT_EQ(static_cast<long long>(BON8_view(make_bytes({0xb0}))), -1);
+    ASSERT_EQ(static_cast<long long>(BON8_view(make_bytes({0xb9}))), -10);
+    ASSERT_EQ(static_cast<long long>(BON8_view(make_bytes({0xc4, 0x2c}))), 300);
+    ASSERT_EQ(static_cast<long long>(BON8_view(make_bytes({0xc9, 0xf3}))), -500);
+    ASSERT_EQ(static_cast<long long>(BON8_view(make_bytes({0xf8, 0x80, 0x00, 0x00, 0x00}))), -2147483648LL);
+
+    ASSERT_EQ(static_cast<double>(BON8_view(make_bytes({0xba}))), -1.0);
+    ASSERT_EQ(static_cast<double>(BON8_view(make_bytes({0xfa, 0x3f, 0xc0, 0x00, 0x00}))), 1.5);
+    ASSERT_EQ(static_cast<double>(BON8_view(make_bytes({0x85}))), 5.0);
+
+    ASSERT_EQ(static_cast<std::u8string_view>(BON8_view(make_bytes({0xff}))), u8"");
+    ASSERT_EQ(static_cast<std::u8string_view>(BON8_view(make_bytes({'f', 0xc3, 0xa9, 'e'}))), u8"fée");
+}
+
+TEST(BON8_view, Index) {
+    ttlet view = BON8_view(test_message);
+
+    ASSERT_TRUE(view.is_object());
+    ASSERT_EQ(view.size(), 4);
+    ASSERT_EQ(static_cast<long long>(view[u8"a"]), 5);
+    ASSERT_EQ(static_cast<std::u8string_view>(view[u8"c"]), u8"hello");
+    ASSERT_EQ(static_cast<bool>(view[u8"d"]), true);
+    ASSERT_TRUE(view.contains(u8"bb"));
+    ASSERT_FALSE(view.contains(u8"b"));
+    ASSERT_FALSE(view.contains(u8"e"));
+    ASSERT_THROW((void)view[u8"e"], parse_error);
+
+    ttlet bb = view[u8"bb"];
+    ASSERT_TRUE(bb.is_array());
+    ASSERT_EQ(bb.size(), 5);
+    ASSERT_EQ(static_cast<long long>(bb[0]), 1);
+    ASSERT_EQ(static_cast<long long>(bb[1]), -1);
+    ASSERT_EQ(static_cast<std::u8string_view>(bb[2]), u8"x");
+    ASSERT_EQ(static_cast<long long>(bb[3]), 300);
+    ASSERT_EQ(static_cast<long long>(bb[4]), -500);
+    ASSERT_THROW((void)bb[5], parse_error);
+    ASSERT_THROW((void)static_cast<long long>(bb[2]), parse_error);
+}
+
+TEST(BON8_view, Iterate) {
+    ttlet view = BON8_view(test_message);
+
+    auto keys = std::vector<std::u8string_view>{};
+    for (auto i = view.object_begin(); i != view.object_end(); ++i) {
+        keys.push_back((*i).first);
+    }
+    ASSERT_EQ(keys, (std::vector<std::u8string_view>{u8"a", u8"bb", u8"c", u8"d"}));
+
+    ASSERT_EQ(BON8_view(make_bytes({0xbd})).size(), 0);
+    ASSERT_EQ(BON8_view(make_bytes({0xfc, 0xfe})).size(), 0);
+    ASSERT_EQ(BON8_view(make_bytes({0xbe})).size(), 0);
+}
+
+TEST(BON8_view, Corrupt) {
+    auto truncated = test_message;
+    truncated.resize(truncated.size() - 8);
+    ttlet view = BON8_view(truncated);
+
+    ASSERT_EQ(static_cast<long long>(view[u8"a"]), 5);
+    ASSERT_THROW((void)view[u8"d"], parse_error);
+    ASSERT_THROW((void)BON8_view(make_bytes({0xf9, 0x00})).operator long long(), parse_error);
+}
+
+TEST(BON8_view, ToDatum) {
+    auto expected = datum::map{};
+    expected["a"] = 5;
+    expected["bb"] = datum::vector{1, -1, "x", 300, -500};
+    expected["c"] = "hello";
+    expected["d"] = true;
+
+    ASSERT_EQ(BON8_view(test_message).to_datum(), datum{expected});
+    ASSERT_EQ(decode_BON8(test_message), datum{expected});
+}
@@ -3,176 +3,462 @@
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #include "JSON.hpp"
+#include "../file.hpp"
+#include <charconv>
+#include <cmath>
+#include <array>
 
 namespace tt {
 
-struct parse_context_t {
-    std::string_view::const_iterator text_begin;
+/** A single-pass JSON parser.
+ * Strings without escape sequences are passed to the handler without copying.
+ */
+class JSON_parser {
+public:
+    JSON_parser(std::string_view text, JSON_handler &handler) noexcept :
+        _begin(text.data()), _ptr(text.data()), _end(text.data() + text.size()), _handler(handler)
+    {
+    }
 
-};
+    void parse()
+    {
+        skip_whitespace();
+        if (_ptr == _end || *_ptr != '{') {
+            throw error("Missing JSON object");
+        }
 
-[[nodiscard]] static parse_result<datum> parseValue(parse_context_t &context, token_iterator token);
+        parse_value(0);
 
-[[nodiscard]] static parse_result<datum> parseArray(parse_context_t &context, token_iterator token)
-{
-    auto array = datum{datum::vector{}};
+        skip_whitespace();
+        if (_ptr != _end) {
+            throw error("Unexpected text after JSON root object");
+        }
+    }
+
+private:
+    /** The maximum nesting of objects and arrays, so that malicious input can not overflow the stack.
+     */
+    static constexpr int max_depth = 1000;
+
+    char const *_begin;
+    char const *_ptr;
+    char const *_end;
+    JSON_handler &_handler;
+
+    /** Buffer for decoding strings with escape sequences.
+     */
+    std::string _buffer;
+
+    [[nodiscard]] parse_error error(std::string_view message) const noexcept
+    {
+        // The location is only calculated when there is an error.
+        int line = 1;
+        int column = 1;
+        for (auto p = _begin; p != _ptr; ++p) {
+            if (*p == '\n') {
+                ++line;
+                column = 1;
+            } else {
+                ++column;
+            }
+        }
+        return parse_error("{}:{}: {}", line, column, message);
+    }
 
-    // Required '['
-    if ((*token == tokenizer_name_t::Operator) && (*token == "[")) {
-        token++;
-    } else {
-        return {};
+    void skip_whitespace() noexcept
+    {
+        while (_ptr != _end) {
+            switch (*_ptr) {
+            case ' ':
+            case '\t':
+            case '\r':
+            case '\n': ++_ptr; break;
+
+            case '#': skip_line_comment(); break;
+
+            case '/':
+                if (_end - _ptr >= 2 && _ptr[1] == '/') {
+                    skip_line_comment();
+                } else if (_end - _ptr >= 2 && _ptr[1] == '*') {
+                    skip_block_comment();
+                } else {
+                    return;
+                }
+                break;
+
+            default: return;
+            }
+        }
     }
 
-    bool commaAfterValue = true;
-    while (true) {
-        // A ']' is required at end of configuration-items.
-        if ((*token == tokenizer_name_t::Operator) && (*token == "]")) {
-            token++;
-            break;
+    void skip_line_comment() noexcept
+    {
+        while (_ptr != _end && *_ptr != '\n') {
+            ++_ptr;
+        }
+    }
+
+    void skip_block_comment() noexcept
+    {
+        for (_ptr += 2; _ptr != _end; ++_ptr) {
+            if (*_ptr == '*' && _end - _ptr >= 2 && _ptr[1] == '/') {
+                _ptr += 2;
+                return;
+            }
+        }
+    }
 
-        // Required a value.
-        } else if (auto result = parseValue(context, token)) {
-            if (!commaAfterValue) {
-                throw parse_error("{}: Missing expected ','", token->location);
+    void parse_value(int depth)
+    {
+        if (_ptr == _end) {
+            throw error("Missing JSON value");
+        }
+
+        switch (*_ptr) {
+        case '{': return parse_object(depth + 1);
+        case '[': return parse_array(depth + 1);
+        case '"': return _handler.string_value(parse_string());
+        case 't': return parse_literal("true"), _handler.boolean_value(true);
+        case 'f': return parse_literal("false"), _handler.boolean_value(false);
+        case 'n': return parse_literal("null"), _handler.null_value();
+        default:
+            if (*_ptr == '-' || (*_ptr >= '0' && *_ptr <= '9')) {
+                return parse_number();
             }
+            throw error(fmt::format("Unexpected character '{}'", *_ptr));
+        }
+    }
+
+    void parse_object(int depth)
+    {
+        if (depth > max_depth) {
+            throw error("JSON objects and arrays are nested too deeply");
+        }
+
+        // Skip over the '{'.
+        ++_ptr;
+        _handler.begin_object();
 
-            array.push_back(*result);
-            token = result.next_token;
+        while (true) {
+            skip_whitespace();
+            if (_ptr == _end) {
+                throw error("Missing expected '}'");
+
+            } else if (*_ptr == '}') {
+                ++_ptr;
+                break;
+
+            } else if (*_ptr == '"') {
+                _handler.key(parse_string());
+
+                skip_whitespace();
+                if (_ptr == _end || *_ptr != ':') {
+                    throw error("Missing expected ':'");
+                }
+                ++_ptr;
+
+                skip_whitespace();
+                parse_value(depth);
+
+                skip_whitespace();
+                if (_ptr != _end && *_ptr == ',') {
+                    ++_ptr;
+                } else if (_ptr != _end && *_ptr != '}') {
+                    throw error("Missing expected ','");
+                }
 
-            if ((*token == tokenizer_name_t::Operator) && (*token == ",")) {
-                token++;
-                commaAfterValue = true;
             } else {
-                commaAfterValue = false;
+                throw error("Expected a key or close-brace");
             }
-
-        } else {
-            throw parse_error("{}: Expecting a value as the next item in an array.", token->location);
         }
+
+        _handler.end_object();
     }
 
-    return {std::move(array), token};
-}
+    void parse_array(int depth)
+    {
+        if (depth > max_depth) {
+            throw error("JSON objects and arrays are nested too deeply");
+        }
 
-[[nodiscard]] static parse_result<datum> parseObject(parse_context_t &context, token_iterator token)
-{
-    auto object = datum{datum::map{}};
+        // Skip over the '['.
+        ++_ptr;
+        _handler.begin_array();
+
+        while (true) {
+            skip_whitespace();
+            if (_ptr == _end) {
+                throw error("Missing expected ']'");
+
+            } else if (*_ptr == ']') {
+                ++_ptr;
+                break;
+            }
+
+            parse_value(depth);
+
+            skip_whitespace();
+            if (_ptr != _end && *_ptr == ',') {
+                ++_ptr;
+            } else if (_ptr != _end && *_ptr != ']') {
+                throw error("Missing expected ','");
+            }
+        }
 
-    // Required '{'
-    if ((*token == tokenizer_name_t::Operator) && (*token == "{")) {
-        token++;
-    } else {
-        return {};
+        _handler.end_array();
     }
 
-    bool commaAfterValue = true;
-    while (true) {
-        // A '}' is required at end of configuration-items.
-        if ((*token == tokenizer_name_t::Operator) && (*token == "}")) {
-            token++;
-            break;
+    void parse_literal(std::string_view literal)
+    {
+        if (std::string_view{_ptr, narrow_cast<size_t>(_end - _ptr)}.substr(0, literal.size()) != literal) {
+            throw error("Unexpected name");
+        }
+        _ptr += literal.size();
+    }
 
-        // Required a string name.
-        } else if (*token == tokenizer_name_t::StringLiteral) {
-            if (!commaAfterValue) {
-                throw parse_error("{}: Missing expected ','", token->location);
+    void parse_number()
+    {
+        ttlet first = _ptr;
+        auto is_float = false;
+
+        if (*_ptr == '-') {
+            ++_ptr;
+        }
+        for (; _ptr != _end; ++_ptr) {
+            ttlet c = *_ptr;
+            if (c == '.' || c == 'e' || c == 'E' || ((c == '-' || c == '+') && is_float)) {
+                is_float = true;
+            } else if (c < '0' || c > '9') {
+                break;
             }
+        }
 
-            auto name = static_cast<std::string>(*token++);
+        if (is_float) {
+            auto value = 0.0;
+            ttlet [last, ec] = std::from_chars(first, _ptr, value);
+            if (ec != std::errc() || last != _ptr) {
+                _ptr = first;
+                throw error("Invalid floating point number");
+            }
+            _handler.float_value(value);
 
-            if ((*token == tokenizer_name_t::Operator) && (*token == ":")) {
-                token++;
-            } else {
-                throw parse_error("{}: Missing expected ':'", token->location);
+        } else {
+            auto value = 0LL;
+            ttlet [last, ec] = std::from_chars(first, _ptr, value);
+            if (ec != std::errc() || last != _ptr) {
+                _ptr = first;
+                throw error("Invalid integer");
             }
+            _handler.integer_value(value);
+        }
+    }
 
-            if (auto result = parseValue(context, token)) {
-                object[name] = *result;
-                token = result.next_token;
+    [[nodiscard]] std::string_view parse_string()
+    {
+        // Skip over the '"'.
+        ttlet first = ++_ptr;
+
+        // Most strings do not contain escape sequences and are returned from the original text.
+        for (; _ptr != _end; ++_ptr) {
+            ttlet c = *_ptr;
+            if (c == '"') {
+                return {first, narrow_cast<size_t>(_ptr++ - first)};
+            } else if (c == '\\') {
+                break;
+            } else if (c == '\n') {
+                throw error("Unexpected line-feed in string");
+            }
+        }
 
+        _buffer.assign(first, _ptr);
+        while (_ptr != _end) {
+            ttlet c = *_ptr++;
+            if (c == '"') {
+                return _buffer;
+            } else if (c == '\n') {
+                --_ptr;
+                throw error("Unexpected line-feed in string");
+            } else if (c != '\\') {
+                _buffer += c;
+            } else if (_ptr == _end) {
+                break;
             } else {
-                throw parse_error("{}: Missing JSON value", token->location);
+                switch (*_ptr++) {
+                case '"': _buffer += '"'; break;
+                case '\\': _buffer += '\\'; break;
+                case '/': _buffer += '/'; break;
+                case 'b': _buffer += '\b'; break;
+                case 'f': _buffer += '\f'; break;
+                case 'n': _buffer += '\n'; break;
+                case 'r': _buffer += '\r'; break;
+                case 't': _buffer += '\t'; break;
+                case 'u': append_code_point(parse_escaped_code_point()); break;
+                default: --_ptr; throw error("Invalid escape sequence in string");
+                }
             }
+        }
+        throw error("Unexpected end of text in string");
+    }
+
+    [[nodiscard]] char32_t parse_hex4()
+    {
+        if (_end - _ptr < 4) {
+            throw error("Invalid unicode escape sequence in string");
+        }
 
-            if ((*token == tokenizer_name_t::Operator) && (*token == ",")) {
-                token++;
-                commaAfterValue = true;
+        auto r = char32_t{0};
+        for (int i = 0; i != 4; ++i) {
+            ttlet c = *_ptr++;
+            r <<= 4;
+            if (c >= '0' && c <= '9') {
+                r |= c - '0';
+            } else if (c >= 'a' && c <= 'f') {
+                r |= c - 'a' + 10;
+            } else if (c >= 'A' && c <= 'F') {
+                r |= c - 'A' + 10;
             } else {
-                commaAfterValue = false;
+                throw error("Invalid unicode escape sequence in string");
             }
-
-        } else {
-            throw parse_error("{}: Unexpected token {}, expected a key or close-brace.", token->location, *token);
         }
+        return r;
     }
 
-    return {std::move(object), token};
-}
+    [[nodiscard]] char32_t parse_escaped_code_point()
+    {
+        ttlet high = parse_hex4();
+        if (high < 0xd800 || high > 0xdfff) {
+            return high;
+        }
 
-[[nodiscard]] static parse_result<datum> parseValue(parse_context_t &context, token_iterator token)
-{
-    switch (token->name) {
-    case tokenizer_name_t::StringLiteral: {
-        auto value = datum{static_cast<std::string>(*token++)};
-        return {std::move(value), token};
-        } break;
-    case tokenizer_name_t::IntegerLiteral: {
-        auto value = datum{static_cast<long long>(*token++)};
-        return {std::move(value), token};
-        } break;
-    case tokenizer_name_t::FloatLiteral: {
-        auto value = datum{static_cast<double>(*token++)};
-        return {std::move(value), token};
-        } break;
-    case tokenizer_name_t::Name: {
-        ttlet name = static_cast<std::string>(*token++);
-        if (name == "true") {
-            return {datum{true}, token};
-        } else if (name == "false") {
-            return {datum{false}, token};
-        } else if (name == "null") {
-            return {datum{datum::null{}}, token};
-        } else {
-            throw parse_error("{}: Unexpected name '{}'", token->location, name);
+        // A code point outside the basic multilingual plane is encoded as a surrogate pair.
+        if (high <= 0xdbff && _end - _ptr >= 2 && _ptr[0] == '\\' && _ptr[1] == 'u') {
+            _ptr += 2;
+            ttlet low = parse_hex4();
+            if (low >= 0xdc00 && low <= 0xdfff) {
+                return 0x10000 + ((high - 0xd800) << 10) + (low - 0xdc00);
+            }
         }
-        } break;
-    default:
-        if (auto result1 = parseObject(context, token)) {
-            return result1;
-        } else if (auto result2 = parseArray(context, token)) {
-            return result2;
+        throw error("Invalid surrogate pair in unicode escape sequence");
+    }
+
+    void append_code_point(char32_t c) noexcept
+    {
+        if (c < 0x80) {
+            _buffer += static_cast<char>(c);
+        } else if (c < 0x800) {
+            _buffer += static_cast<char>(0xc0 | (c >> 6));
+            _buffer += static_cast<char>(0x80 | (c & 0x3f));
+        } else if (c < 0x10000) {
+            _buffer += static_cast<char>(0xe0 | (c >> 12));
+            _buffer += static_cast<char>(0x80 | ((c >> 6) & 0x3f));
+            _buffer += static_cast<char>(0x80 | (c & 0x3f));
         } else {
-            throw parse_error("{}: Unexpected token '{}'", token->location, token->name);
+            _buffer += static_cast<char>(0xf0 | (c >> 18));
+            _buffer += static_cast<char>(0x80 | ((c >> 12) & 0x3f));
+            _buffer += static_cast<char>(0x80 | ((c >> 6) & 0x3f));
+            _buffer += static_cast<char>(0x80 | (c & 0x3f));
         }
     }
-}
-
-[[nodiscard]] datum parse_JSON(std::string_view text)
-{
-    token_vector tokens = parseTokens(text);
+};
 
+/** Build a datum tree from the events of the JSON parser.
+ */
+class JSON_datum_builder final : public JSON_handler {
+public:
     datum root;
 
-    tt_axiom(tokens.back() == tokenizer_name_t::End);
-    parse_context_t context;
-    context.text_begin = text.begin();
+    void begin_object() override
+    {
+        _stack.emplace_back(datum{datum::map{}});
+    }
+
+    void end_object() override
+    {
+        end_container();
+    }
+
+    void key(std::string_view name) override
+    {
+        _stack.back().key = name;
+    }
 
-    auto token = tokens.begin();
+    void begin_array() override
+    {
+        _stack.emplace_back(datum{datum::vector{}});
+    }
 
-    if (auto result = parseObject(context, token)) {
-        root = std::move(*result);
-        token = result.next_token;
+    void end_array() override
+    {
+        end_container();
+    }
+
+    void string_value(std::string_view value) override
+    {
+        add(datum{value});
+    }
+
+    void integer_value(long long value) override
+    {
+        add(datum{value});
+    }
+
+    void float_value(double value) override
+    {
+        add(datum{value});
+    }
 
-    } else {
-        throw parse_error("{}: Missing JSON object", token->location);
+    void boolean_value(bool value) override
+    {
+        add(datum{value});
     }
 
-    if (*token != tokenizer_name_t::End) {
-        throw parse_error("{}: Unexpected text after JSON root object", token->location);
+    void null_value() override
+    {
+        add(datum{datum::null{}});
     }
 
-    return root;
+private:
+    struct frame_type {
+        datum value;
+
+        /** The key for the next value added to an object.
+         */
+        std::string key;
+
+        frame_type(datum &&value) noexcept : value(std::move(value)), key() {}
+    };
+
+    std::vector<frame_type> _stack;
+
+    void add(datum &&value)
+    {
+        if (_stack.empty()) {
+            root = std::move(value);
+        } else if (auto &parent = _stack.back(); parent.value.is_vector()) {
+            parent.value.push_back(std::move(value));
+        } else {
+            parent.value[datum{parent.key}] = std::move(value);
+        }
+    }
+
+    void end_container()
+    {
+        auto value = std::move(_stack.back().value);
+        _stack.pop_back();
+        add(std::move(value));
+    }
+};
+
+void parse_JSON(std::string_view text, JSON_handler &handler)
+{
+    JSON_parser(text, handler).parse();
+}
+
+[[nodiscard]] datum parse_JSON(std::string_view text)
+{
+    auto builder = JSON_datum_builder{};
+    parse_JSON(text, builder);
+    return std::move(builder.root);
 }
 
 [[nodiscard]] datum parse_JSON(URL const &url)
@@ -180,98 +466,171 @@ struct parse_context_t {
     return parse_JSON(url.loadView()->string_view());
 }
 
-static void format_JSON_impl(datum const &value, std::string &result, tt::indent indent={})
-{
-    bool first_item = true;
+/** Write a datum as JSON text into a buffer.
+ * When writing to a file the buffer is flushed to the file whenever it grows beyond `flush_size`.
+ */
+class JSON_writer {
+public:
+    JSON_writer(std::string &buffer, tt::file *file = nullptr) noexcept : _buffer(buffer), _file(file) {}
 
-    switch (value.type()) {
-    case datum_type_t::Null:
-        result += "null";
-        break;
+    void write(datum const &value, int depth = 0)
+    {
+        switch (value.type()) {
+        case datum_type_t::Null: _buffer += "null"; break;
 
-    case datum_type_t::Boolean:
-        result += value ? "true" : "false";
-        break;
+        case datum_type_t::Boolean: _buffer += value ? "true" : "false"; break;
 
-    case datum_type_t::Integer:
-        result += tt::to_string(static_cast<long long>(value));
-        break;
+        case datum_type_t::Integer: write_number(static_cast<long long>(value)); break;
 
-    case datum_type_t::Float:
-        result += tt::to_string(static_cast<double>(value));
-        break;
+        case datum_type_t::Float: write_float(static_cast<double>(value)); break;
 
-    case datum_type_t::String:
-    case datum_type_t::URL:
-        result += '"';
-        for (ttlet c: static_cast<std::string>(value)) {
-            switch (c) {
-            case '\n': result += '\\'; result += 'n'; break;
-            case '\r': result += '\\'; result += 'r'; break;
-            case '\t': result += '\\'; result += 't'; break;
-            case '\f': result += '\\'; result += 'f'; break;
-            case '"': result += '\\'; result += '"'; break;
-            default: result += c;
+        case datum_type_t::String:
+        case datum_type_t::URL: write_string(static_cast<std::string>(value)); break;
+
+        case datum_type_t::Vector:
+            _buffer += '[';
+            for (auto i = value.vector_begin(); i != value.vector_end(); ++i) {
+                if (i != value.vector_begin()) {
+                    _buffer += ',';
+                }
+                write_newline(depth + 1);
+                write(*i, depth + 1);
             }
-        }
-        result += '"';
-        break;
-
-    case datum_type_t::Vector:
-        result += indent;
-        result += '[';
-        result += '\n';
-
-        for (auto i = value.vector_begin(); i != value.vector_end(); i++, first_item = true) {
-            if (!first_item) {
-                result += ',';
-                result += '\n';
+            write_newline(depth);
+            _buffer += ']';
+            break;
+
+        case datum_type_t::Map:
+            _buffer += '{';
+            for (auto i = value.map_begin(); i != value.map_end(); ++i) {
+                if (i != value.map_begin()) {
+                    _buffer += ',';
+                }
+                write_newline(depth + 1);
+                write(i->first, depth + 1);
+                _buffer += ':';
+                _buffer += ' ';
+                write(i->second, depth + 1);
             }
-            result += indent + 1;
+            write_newline(depth);
+            _buffer += '}';
+            break;
+
+        default: tt_no_default();
+        }
+
+        if (_file != nullptr && std::ssize(_buffer) >= flush_size) {
+            flush();
+        }
+    }
 
-            format_JSON_impl(*i, result, indent + 1);
+    void flush()
+    {
+        if (_file != nullptr) {
+            _file->write(_buffer);
+            _buffer.clear();
         }
+    }
 
-        result += '\n';
-        result += indent;
-        result += ']';
-        break;
+private:
+    static constexpr ssize_t flush_size = 0x1'0000;
+    static constexpr int indent_size = 4;
 
-    case datum_type_t::Map:
-        result += indent;
-        result += '{';
-        result += '\n';
+    std::string &_buffer;
+    tt::file *_file;
 
-        for (auto i = value.map_begin(); i != value.map_end(); i++, first_item = true) {
-            if (!first_item) {
-                result += ',';
-                result += '\n';
-            }
-            result += indent + 1;
+    void write_newline(int depth) noexcept
+    {
+        _buffer += '\n';
+        _buffer.append(narrow_cast<size_t>(depth * indent_size), ' ');
+    }
 
-            format_JSON_impl(i->first, result, indent + 1);
-            result += ':';
-            result += ' ';
-            format_JSON_impl(i->second, result, indent + 1);
+    template<typename T>
+    void write_number(T value) noexcept
+    {
+        auto tmp = std::array<char, 32>{};
+        ttlet[last, ec] = std::to_chars(tmp.data(), tmp.data() + tmp.size(), value);
+        tt_axiom(ec == std::errc{});
+        _buffer.append(tmp.data(), last);
+    }
+
+    void write_float(double value) noexcept
+    {
+        if (not std::isfinite(value)) {
+            // JSON has no representation of infinity and not-a-number.
+            _buffer += "null";
+            return;
         }
 
-        result += '\n';
-        result += indent;
-        result += '}';
-        break;
+        ttlet first = _buffer.size();
+        write_number(value);
 
-    default:
-        tt_no_default();
+        // Make sure the value is parsed as a float when read back.
+        if (_buffer.find_first_of(".eE", first) == std::string::npos) {
+            _buffer += ".0";
+        }
     }
+
+    void write_string(std::string_view str) noexcept
+    {
+        _buffer += '"';
+
+        // Characters that do not need escaping are appended in runs.
+        auto run = str.begin();
+        for (auto i = str.begin(); i != str.end(); ++i) {
+            ttlet c = *i;
+            if (c != '"' && c != '\\' && static_cast<unsigned char>(c) >= 0x20) {
+                continue;
+            }
+
+            _buffer.append(run, i);
+            run = i + 1;
+
+            _buffer += '\\';
+            switch (c) {
+            case '"': _buffer += '"'; break;
+            case '\\': _buffer += '\\'; break;
+            case '\b': _buffer += 'b'; break;
+            case '\f': _buffer += 'f'; break;
+            case '\n': _buffer += 'n'; break;
+            case '\r': _buffer += 'r'; break;
+            case '\t': _buffer += 't'; break;
+            default:
+                constexpr auto hex_digits = std::string_view{"0123456789abcdef"};
+                _buffer += "u00";
+                _buffer += hex_digits[(c >> 4) & 0xf];
+                _buffer += hex_digits[c & 0xf];
+            }
+        }
+        _buffer.append(run, str.end());
+
+        _buffer += '"';
+    }
+};
+
+void format_JSON(datum const &root, std::string &output)
+{
+    auto writer = JSON_writer{output};
+    writer.write(root);
+    output += '\n';
+}
+
+void format_JSON(datum const &root, tt::file &file)
+{
+    auto buffer = std::string{};
+    buffer.reserve(0x1'0000);
+
+    auto writer = JSON_writer{buffer, &file};
+    writer.write(root);
+    buffer += '\n';
+    writer.flush();
 }
 
 [[nodiscard]] std::string format_JSON(datum const &root)
 {
     auto r = std::string{};
-    format_JSON_impl(root, r);
-    r += '\n';
+    format_JSON(root, r);
     return r;
 }
 
-
 }
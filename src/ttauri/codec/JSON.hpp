@@ -19,6 +19,50 @@
 
 namespace tt {
 
+class file;
+
+/** Receives the events of a JSON document from the streaming parser.
+ *
+ * The parser makes a single pass over the text and calls the handler for each
+ * value, object member and array as it is found. A handler may bind the values
+ * directly to the members of a struct, without building a datum tree.
+ *
+ * The strings passed to `key()` and `string_value()` point into the text being
+ * parsed, or into a buffer of the parser when the string contains escape
+ * sequences; they are only valid during the call.
+ */
+class JSON_handler {
+public:
+    virtual ~JSON_handler() = default;
+
+    virtual void begin_object() = 0;
+    virtual void end_object() = 0;
+
+    /** The name of the next member of an object.
+     */
+    virtual void key(std::string_view name) = 0;
+
+    virtual void begin_array() = 0;
+    virtual void end_array() = 0;
+
+    virtual void string_value(std::string_view value) = 0;
+    virtual void integer_value(long long value) = 0;
+    virtual void float_value(double value) = 0;
+    virtual void boolean_value(bool value) = 0;
+    virtual void null_value() = 0;
+};
+
+/** Parse a JSON string, passing the events to a handler.
+ *
+ * Besides standard JSON, comments starting with `//` or `#`, block comments,
+ * and a comma after the last item of an object or array are accepted.
+ *
+ * @param text The text to parse.
+ * @param handler The handler receiving the events.
+ * @throw parse_error When the text is not valid JSON, or the root is not an object.
+ */
+void parse_JSON(std::string_view text, JSON_handler &handler);
+
 /** Parse a JSON string.
  * @param text The text to parse.
  * @return A datum representing the parsed object.
@@ -37,4 +81,21 @@ namespace tt {
  */
 [[nodiscard]] std::string format_JSON(datum const &root);
 
+/** Dump an datum object as JSON to the end of a string.
+ * The string is not cleared first, so that a buffer can be reused without reallocating.
+ *
+ * @param root datum-object to serialize
+ * @param[in,out] output The string to append the JSON serialized object to.
+ */
+void format_JSON(datum const &root, std::string &output);
+
+/** Dump an datum object as JSON into a file.
+ * The JSON text is written to the file in blocks, without first building the whole text in memory.
+ *
+ * @param root datum-object to serialize
+ * @param file The file to write to.
+ * @throw io_error
+ */
+void format_JSON(datum const &root, tt::file &file);
+
 }
@@ -0,0 +1,57 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/codec/JSON.hpp"
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+using namespace std;
+using namespace tt;
+
+/** A document shaped like a theme or preferences file, with nr_items objects.
+ */
+[[nodiscard]] static datum make_JSON_bench_document(int64_t nr_items) noexcept
+{
+    auto items = datum::vector{};
+    for (int64_t i = 0; i != nr_items; ++i) {
+        auto item = datum::map{};
+        item["name"] = fmt::format("item-{}", i);
+        item["size"] = static_cast<double>(i) * 0.5;
+        item["count"] = i;
+        item["enabled"] = (i % 2) == 0;
+        item["color"] = datum::vector{datum{i % 256}, datum{(i * 7) % 256}, datum{(i * 13) % 256}};
+        items.push_back(datum{std::move(item)});
+    }
+
+    auto r = datum::map{};
+    r["version"] = 1;
+    r["items"] = std::move(items);
+    return datum{std::move(r)};
+}
+
+static void JSON_parse(benchmark::State &state)
+{
+    ttlet text = format_JSON(make_JSON_bench_document(state.range(0)));
+
+    for (auto _ : state) {
+        auto document = parse_JSON(text);
+        benchmark::DoNotOptimize(document);
+    }
+    state.SetBytesProcessed(state.iterations() * std::ssize(text));
+}
+BENCHMARK(JSON_parse)->Arg(10)->Arg(1000);
+
+static void JSON_format(benchmark::State &state)
+{
+    ttlet document = make_JSON_bench_document(state.range(0));
+
+    auto nr_bytes = int64_t{0};
+    for (auto _ : state) {
+        ttlet text = format_JSON(document);
+        nr_bytes += std::ssize(text);
+        benchmark::DoNotOptimize(text.data());
+    }
+    state.SetBytesProcessed(nr_bytes);
+}
+BENCHMARK(JSON_format)->Arg(10)->Arg(1000);
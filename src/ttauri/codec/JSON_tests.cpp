@@ -92,4 +92,83 @@ TEST(JSON, ParseTwoItemObject) {
     expected["foo"]["baz"] = 43;
     ASSERT_EQ(parse_JSON("{\"foo\": {\"bar\": 42, \"baz\": 43}}"), expected);
     ASSERT_EQ(parse_JSON("{\"foo\": {\"bar\": 42, \"baz\": 43,}}"), expected);
-}
\ No newline at end of file
+}
+TEST(JSON, ParseComments) {
+    auto expected = datum::map{};
+    expected["foo"] = datum::vector{42, 43};
+    ASSERT_EQ(parse_JSON("// comment\n{\"foo\": /* block */ [42, # comment\n 43]}"), expected);
+}
+
+TEST(JSON, ParseEscapes) {
+    auto expected = datum::map{};
+    expected["foo\nbar"] = "\"\\/\b\f\n\r\t\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80";
+    ASSERT_EQ(parse_JSON("{\"foo\\nbar\": \"\\\"\\\\\\/\\b\\f\\n\\r\\t\\u00e9\\u20AC\\ud83d\\ude00\"}"), expected);
+}
+
+TEST(JSON, ParseNumbers) {
+    auto expected = datum::map{};
+    expected["foo"] = datum::vector{-42, 1.5e3, -0.25, 0};
+    ASSERT_EQ(parse_JSON("{\"foo\": [-42, 1.5e3, -0.25, 0]}"), expected);
+}
+
+TEST(JSON, ParseErrors) {
+    ASSERT_THROW(parse_JSON(""), parse_error);
+    ASSERT_THROW(parse_JSON("[]"), parse_error);
+    ASSERT_THROW(parse_JSON("{\"foo\": 42"), parse_error);
+    ASSERT_THROW(parse_JSON("{\"foo\" 42}"), parse_error);
+    ASSERT_THROW(parse_JSON("{\"foo\": 42 \"bar\": 43}"), parse_error);
+    ASSERT_THROW(parse_JSON("{\"foo\": tru}"), parse_error);
+    ASSERT_THROW(parse_JSON("{\"foo\": \"bar}"), parse_error);
+    ASSERT_THROW(parse_JSON("{\"foo\": \"\\x\"}"), parse_error);
+    ASSERT_THROW(parse_JSON("{} {}"), parse_error);
+    ASSERT_THROW(parse_JSON("{\"foo\": " + std::string(10000, '[')), parse_error);
+}
+
+namespace {
+
+/** Records the events, to check the order in which the handler is called.
+ */
+class test_JSON_handler : public JSON_handler {
+public:
+    std::string events;
+
+    void begin_object() override { events += '{'; }
+    void end_object() override { events += '}'; }
+    void key(std::string_view name) override { events += name; events += ':'; }
+    void begin_array() override { events += '['; }
+    void end_array() override { events += ']'; }
+    void string_value(std::string_view value) override { events += '"'; events += value; events += '"'; }
+    void integer_value(long long value) override { events += std::to_string(value); }
+    void float_value(double value) override { events += 'f'; }
+    void boolean_value(bool value) override { events += value ? 'T' : 'F'; }
+    void null_value() override { events += 'N'; }
+};
+
+}
+
+TEST(JSON, ParseEvents) {
+    auto handler = test_JSON_handler{};
+    parse_JSON("{\"a\": [1, \"x\", true, null, 2.0], \"b\": {}}", handler);
+    ASSERT_EQ(handler.events, "{a:[1\"x\"TNf]b:{}}");
+}
+
+TEST(JSON, FormatRoundTrip) {
+    auto expected = datum::map{};
+    expected["integer"] = 42;
+    expected["float"] = 42.0;
+    expected["string"] = "quote \" backslash \\ line-feed \n";
+    expected["vector"] = datum::vector{1, 2.5, "three", true, datum::null{}};
+    expected["map"] = datum::map{};
+    expected["map"]["foo"] = false;
+
+    ASSERT_EQ(parse_JSON(format_JSON(datum{expected})), expected);
+}
+
+TEST(JSON, FormatIntoBuffer) {
+    auto value = datum::map{};
+    value["foo"] = 42;
+
+    auto buffer = std::string{"prefix"};
+    format_JSON(datum{value}, buffer);
+    ASSERT_EQ(buffer, "prefix{\n    \"foo\": 42\n}\n");
+}
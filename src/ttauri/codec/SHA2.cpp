@@ -0,0 +1,262 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "SHA2.hpp"
+#include "../cpu_id.hpp"
+#include "../os_detect.hpp"
+#include <immintrin.h>
+#include <cstring>
+
+namespace tt {
+namespace detail::SHA2 {
+
+alignas(16) constexpr std::array<uint32_t, 64> K256 = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+constexpr std::array<uint32_t, 8> SHA256_initial_state = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+[[nodiscard]] bool has_sha_ni() noexcept
+{
+    static bool const r = cpu_has_sha() && cpu_has_sse4_1();
+    return r;
+}
+
+[[nodiscard]] bool has_avx2() noexcept
+{
+    static bool const r = cpu_has_avx2();
+    return r;
+}
+
+tt_target("sha,sse4.1") void sha256_blocks_sha_ni(std::array<uint32_t, 8> &state, std::byte const *ptr, size_t nr_blocks) noexcept
+{
+    ttlet byte_swap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    // The SHA instructions use the state as ABEF and CDGH.
+    auto tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const *>(state.data())), 0xb1);
+    auto state1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const *>(state.data() + 4)), 0x1b);
+    auto state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xf0);
+
+    for (; nr_blocks != 0; --nr_blocks, ptr += 64) {
+        ttlet saved0 = state0;
+        ttlet saved1 = state1;
+
+        __m128i msg[4];
+        for (int i = 0; i != 4; ++i) {
+            msg[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(ptr + i * 16)), byte_swap);
+        }
+
+        // Four rounds at a time, while calculating the message schedule of four rounds later.
+        for (int i = 0; i != 16; ++i) {
+            ttlet wk = _mm_add_epi32(msg[i % 4], _mm_load_si128(reinterpret_cast<__m128i const *>(K256.data() + i * 4)));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, wk);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(wk, 0x0e));
+
+            if (i < 12) {
+                auto w = _mm_sha256msg1_epu32(msg[i % 4], msg[(i + 1) % 4]);
+                w = _mm_add_epi32(w, _mm_alignr_epi8(msg[(i + 3) % 4], msg[(i + 2) % 4], 4));
+                msg[i % 4] = _mm_sha256msg2_epu32(w, msg[(i + 3) % 4]);
+            }
+        }
+
+        state0 = _mm_add_epi32(state0, saved0);
+        state1 = _mm_add_epi32(state1, saved1);
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1b);
+    state1 = _mm_shuffle_epi32(state1, 0xb1);
+    state0 = _mm_blend_epi16(tmp, state1, 0xf0);
+    state1 = _mm_alignr_epi8(state1, tmp, 8);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state.data()), state0);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state.data() + 4), state1);
+}
+
+template<int N>
+[[nodiscard]] tt_target("avx2") static __m256i rotr_x8(__m256i x) noexcept
+{
+    return _mm256_or_si256(_mm256_srli_epi32(x, N), _mm256_slli_epi32(x, 32 - N));
+}
+
+/** Add one block to each of eight SHA-256 states, one in each 32 bit lane.
+ */
+tt_target("avx2") static void sha256_block_x8(__m256i *state, std::array<std::byte const *, 8> const &blocks) noexcept
+{
+    ttlet byte_swap = _mm256_setr_epi8(
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+    auto load_word = [](std::byte const *ptr) {
+        int32_t r;
+        std::memcpy(&r, ptr, sizeof(r));
+        return r;
+    };
+
+    __m256i W[16];
+    for (int t = 0; t != 16; ++t) {
+        W[t] = _mm256_shuffle_epi8(
+            _mm256_setr_epi32(
+                load_word(blocks[0] + t * 4),
+                load_word(blocks[1] + t * 4),
+                load_word(blocks[2] + t * 4),
+                load_word(blocks[3] + t * 4),
+                load_word(blocks[4] + t * 4),
+                load_word(blocks[5] + t * 4),
+                load_word(blocks[6] + t * 4),
+                load_word(blocks[7] + t * 4)),
+            byte_swap);
+    }
+
+    auto a = state[0];
+    auto b = state[1];
+    auto c = state[2];
+    auto d = state[3];
+    auto e = state[4];
+    auto f = state[5];
+    auto g = state[6];
+    auto h = state[7];
+
+    for (int t = 0; t != 64; ++t) {
+        if (t >= 16) {
+            ttlet w2 = W[(t - 2) % 16];
+            ttlet w15 = W[(t - 15) % 16];
+            ttlet s1 = _mm256_xor_si256(_mm256_xor_si256(rotr_x8<17>(w2), rotr_x8<19>(w2)), _mm256_srli_epi32(w2, 10));
+            ttlet s0 = _mm256_xor_si256(_mm256_xor_si256(rotr_x8<7>(w15), rotr_x8<18>(w15)), _mm256_srli_epi32(w15, 3));
+            W[t % 16] = _mm256_add_epi32(_mm256_add_epi32(W[t % 16], s0), _mm256_add_epi32(W[(t - 7) % 16], s1));
+        }
+
+        ttlet S1 = _mm256_xor_si256(_mm256_xor_si256(rotr_x8<6>(e), rotr_x8<11>(e)), rotr_x8<25>(e));
+        ttlet ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+        ttlet T1 = _mm256_add_epi32(
+            _mm256_add_epi32(_mm256_add_epi32(h, S1), _mm256_add_epi32(ch, W[t % 16])),
+            _mm256_set1_epi32(static_cast<int32_t>(K256[t])));
+
+        ttlet S0 = _mm256_xor_si256(_mm256_xor_si256(rotr_x8<2>(a), rotr_x8<13>(a)), rotr_x8<22>(a));
+        ttlet maj = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+        ttlet T2 = _mm256_add_epi32(S0, maj);
+
+        h = g;
+        g = f;
+        f = e;
+        e = _mm256_add_epi32(d, T1);
+        d = c;
+        c = b;
+        b = a;
+        a = _mm256_add_epi32(T1, T2);
+    }
+
+    state[0] = _mm256_add_epi32(state[0], a);
+    state[1] = _mm256_add_epi32(state[1], b);
+    state[2] = _mm256_add_epi32(state[2], c);
+    state[3] = _mm256_add_epi32(state[3], d);
+    state[4] = _mm256_add_epi32(state[4], e);
+    state[5] = _mm256_add_epi32(state[5], f);
+    state[6] = _mm256_add_epi32(state[6], g);
+    state[7] = _mm256_add_epi32(state[7], h);
+}
+
+tt_target("avx2") void SHA256_x8_avx2(std::span<std::byte const> const *messages, bstring *digests) noexcept
+{
+    // The blocks of a message are the whole blocks read directly from the message,
+    // followed by one or two blocks with the rest of the message and the padding.
+    auto tails = std::array<std::array<std::byte, 128>, 8>{};
+    auto nr_whole_blocks = std::array<size_t, 8>{};
+    auto nr_blocks = std::array<size_t, 8>{};
+    auto max_nr_blocks = size_t{0};
+
+    for (int lane = 0; lane != 8; ++lane) {
+        ttlet message = messages[lane];
+        ttlet nr_rest = message.size() % 64;
+
+        nr_whole_blocks[lane] = message.size() / 64;
+        nr_blocks[lane] = nr_whole_blocks[lane] + (nr_rest < 56 ? 1 : 2);
+        max_nr_blocks = std::max(max_nr_blocks, nr_blocks[lane]);
+
+        auto &tail = tails[lane];
+        std::memcpy(tail.data(), message.data() + message.size() - nr_rest, nr_rest);
+        tail[nr_rest] = std::byte{0x80};
+
+        ttlet tail_size = (nr_blocks[lane] - nr_whole_blocks[lane]) * 64;
+        ttlet nr_bits = static_cast<uint64_t>(message.size()) * 8;
+        for (int i = 0; i != 8; ++i) {
+            tail[tail_size - 1 - i] = static_cast<std::byte>(nr_bits >> (i * 8));
+        }
+    }
+
+    __m256i state[8];
+    for (int i = 0; i != 8; ++i) {
+        state[i] = _mm256_set1_epi32(static_cast<int32_t>(SHA256_initial_state[i]));
+    }
+
+    auto blocks = std::array<std::byte const *, 8>{};
+    for (size_t block_nr = 0; block_nr != max_nr_blocks; ++block_nr) {
+        for (int lane = 0; lane != 8; ++lane) {
+            if (block_nr < nr_whole_blocks[lane]) {
+                blocks[lane] = messages[lane].data() + block_nr * 64;
+            } else if (block_nr < nr_blocks[lane]) {
+                blocks[lane] = tails[lane].data() + (block_nr - nr_whole_blocks[lane]) * 64;
+            } else {
+                // This message is already complete; hash its tail again, the result is not used.
+                blocks[lane] = tails[lane].data();
+            }
+        }
+
+        sha256_block_x8(state, blocks);
+
+        for (int lane = 0; lane != 8; ++lane) {
+            if (block_nr + 1 == nr_blocks[lane]) {
+                alignas(32) std::array<std::array<uint32_t, 8>, 8> words;
+                for (int i = 0; i != 8; ++i) {
+                    _mm256_store_si256(reinterpret_cast<__m256i *>(words[i].data()), state[i]);
+                }
+
+                auto &digest = digests[lane];
+                digest.resize(32);
+                for (int i = 0; i != 32; ++i) {
+                    digest[i] = static_cast<std::byte>(words[i / 4][lane] >> (24 - (i % 4) * 8));
+                }
+            }
+        }
+    }
+}
+
+} // namespace detail::SHA2
+
+[[nodiscard]] std::vector<bstring> SHA256_multi(std::span<std::span<std::byte const> const> messages) noexcept
+{
+    auto r = std::vector<bstring>(messages.size());
+
+    auto i = size_t{0};
+    if (not detail::SHA2::has_sha_ni() and detail::SHA2::has_avx2()) {
+        for (; i + 8 <= messages.size(); i += 8) {
+            detail::SHA2::SHA256_x8_avx2(messages.data() + i, r.data() + i);
+        }
+
+        if (i != messages.size()) {
+            // Fill the rest of the lanes with empty messages.
+            auto lanes = std::array<std::span<std::byte const>, 8>{};
+            auto digests = std::array<bstring, 8>{};
+            std::copy(messages.begin() + i, messages.end(), lanes.begin());
+            detail::SHA2::SHA256_x8_avx2(lanes.data(), digests.data());
+            std::move(digests.begin(), digests.begin() + (messages.size() - i), r.begin() + i);
+            i = messages.size();
+        }
+    }
+
+    // With the SHA extensions a single message is hashed faster than eight messages with AVX2.
+    for (; i != messages.size(); ++i) {
+        auto hash = SHA256{};
+        hash.add(messages[i]);
+        r[i] = hash.get_bytes();
+    }
+    return r;
+}
+
+} // namespace tt
@@ -7,14 +7,43 @@
 #include "../byte_string.hpp"
 #include "../required.hpp"
 #include "../assert.hpp"
+#include "../file_view.hpp"
+#include "../file_mapping.hpp"
+#include "../file.hpp"
+#include "../URL.hpp"
 #include <bit>
 #include <array>
+#include <vector>
+#include <memory>
+#include <algorithm>
 #include <cstdint>
 #include <span>
+#include <type_traits>
 
 namespace tt {
 namespace detail::SHA2 {
 
+/** The CPU has the SHA extensions, for SHA-224 and SHA-256.
+ */
+[[nodiscard]] bool has_sha_ni() noexcept;
+
+/** The CPU has AVX2, used to hash eight messages at once.
+ */
+[[nodiscard]] bool has_avx2() noexcept;
+
+/** Add whole 64 byte blocks to a SHA-224 or SHA-256 state using the SHA extensions.
+ * Only call this function when `has_sha_ni()` is true.
+ */
+void sha256_blocks_sha_ni(std::array<uint32_t, 8> &state, std::byte const *ptr, size_t nr_blocks) noexcept;
+
+/** Calculate the SHA-256 of eight messages at once, one message in each 32 bit lane of AVX2.
+ * Only call this function when `has_avx2()` is true.
+ *
+ * @param messages Pointer to eight messages.
+ * @param digests Pointer to eight byte strings which are set to the digests.
+ */
+void SHA256_x8_avx2(std::span<std::byte const> const *messages, bstring *digests) noexcept;
+
 template<typename T>
 struct state {
     T a;
@@ -315,6 +344,16 @@ public:
             }
         }
 
+        if constexpr (std::is_same_v<T, uint32_t>) {
+            if (not std::is_constant_evaluated() and detail::SHA2::has_sha_ni()) {
+                ttlet nr_blocks = narrow_cast<size_t>(last - ptr) / block_type::size;
+                auto words = std::array<uint32_t, 8>{state.a, state.b, state.c, state.d, state.e, state.f, state.g, state.h};
+                detail::SHA2::sha256_blocks_sha_ni(words, ptr, nr_blocks);
+                state = state_type{words[0], words[1], words[2], words[3], words[4], words[5], words[6], words[7]};
+                ptr += nr_blocks * block_type::size;
+            }
+        }
+
         while (ptr + block_type::size <= last) {
             add(block_type{ptr});
             ptr += block_type::size;
@@ -418,5 +457,43 @@ public:
         ) {}
 };
 
+/** Calculate the SHA-256 of many independent messages.
+ * Without the SHA extensions eight messages are hashed at a time with AVX2.
+ *
+ * @param messages The messages to hash.
+ * @return The digest of each message.
+ */
+[[nodiscard]] std::vector<bstring> SHA256_multi(std::span<std::span<std::byte const> const> messages) noexcept;
+
+/** Calculate the hash of a file.
+ * The file is mapped into memory one chunk at a time, so that large files are hashed
+ * without mapping the whole file at once.
+ *
+ * @tparam Hash The hash algorithm, for example SHA256.
+ * @param location The location of the file.
+ * @param chunk_size The number of bytes to map at a time, a multiple of the block size and the page size.
+ * @return The digest of the file.
+ */
+template<typename Hash>
+[[nodiscard]] bstring hash_file(URL const &location, size_t chunk_size = 0x400'0000)
+{
+    auto hash = Hash{};
+
+    ttlet size = file::file_size(location);
+    if (size == 0) {
+        hash.add(bstring_view{});
+        return hash.get_bytes();
+    }
+
+    ttlet mapping = std::make_shared<file_mapping>(location, access_mode::open_for_read, size);
+    for (size_t offset = 0; offset != size;) {
+        ttlet chunk = std::min(chunk_size, size - offset);
+        ttlet view = file_view(mapping, offset, chunk);
+        view.hint(file_view_hint::sequential);
+        offset += chunk;
+        hash.add(view.bytes(), offset == size);
+    }
+    return hash.get_bytes();
 }
 
+}
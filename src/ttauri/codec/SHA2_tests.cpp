@@ -6,6 +6,8 @@
 #include "ttauri/codec/base_n.hpp"
 #include "ttauri/required.hpp"
 #include "ttauri/strings.hpp"
+#include "ttauri/file_view.hpp"
+#include "ttauri/URL.hpp"
 #include <gtest/gtest.h>
 #include <iostream>
 
@@ -163,3 +165,48 @@ TEST(SHA2, NESSIE512Set1) {
         "DE0FF244877EA60A4CB0432CE577C31B"
         "EB009C5C2C49AA2E4EADB217AD8CC09B");
 }
+
+TEST(SHA2, SHA256Multi) {
+    auto strings = std::vector<bstring>{};
+    for (size_t size = 0; size < 300; size += 7) {
+        strings.push_back(to_bstring(std::string(size, static_cast<char>('a' + size % 26))));
+    }
+    strings.push_back(to_bstring("abc"));
+
+    auto messages = std::vector<std::span<std::byte const>>{};
+    for (ttlet &str : strings) {
+        messages.emplace_back(str.data(), str.size());
+    }
+
+    ttlet digests = SHA256_multi(messages);
+    ASSERT_EQ(digests.size(), strings.size());
+    for (size_t i = 0; i != strings.size(); ++i) {
+        ASSERT_EQ(digests[i], SHA256().add(strings[i]).get_bytes());
+    }
+    ASSERT_CASEEQ(base16::encode(digests.back()), "BA7816BF8F01CFEA414140DE5DAE2223B00361A396177A9CB410FF61F20015AD");
+
+    if (detail::SHA2::has_avx2()) {
+        // Test the AVX2 code directly, since it is not used when the SHA extensions are available.
+        auto x8_digests = std::array<bstring, 8>{};
+        for (size_t i = 0; i + 8 <= messages.size(); i += 8) {
+            detail::SHA2::SHA256_x8_avx2(messages.data() + i, x8_digests.data());
+            for (size_t j = 0; j != 8; ++j) {
+                ASSERT_EQ(x8_digests[j], digests[i + j]);
+            }
+        }
+    }
+}
+
+TEST(SHA2, HashFile) {
+    ttlet view = file_view(URL("file:BidiTest.txt"));
+    auto hash = SHA256();
+    hash.add(view.bytes());
+    ttlet expected = hash.get_bytes();
+
+    ASSERT_EQ(hash_file<SHA256>(URL("file:BidiTest.txt")), expected);
+    ASSERT_EQ(hash_file<SHA256>(URL("file:BidiTest.txt"), 0x100000), expected);
+
+    ASSERT_CASEEQ(
+        base16::encode(hash_file<SHA256>(URL("file:gzip_test1.bin"))),
+        "E3B0C44298FC1C149AFBF4C8996FB92427AE41E4649B934CA495991B7852B855");
+}
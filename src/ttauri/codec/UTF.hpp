@@ -5,14 +5,59 @@
 #pragma once
 
 #include "../required.hpp"
+#include "../os_detect.hpp"
 #include "../endian.hpp"
 #include "../CP1252.hpp"
 #include <type_traits>
 #include <iterator>
 #include <bit>
+#include <cstring>
+#if TT_PROCESSOR == TT_CPU_X64
+#include <emmintrin.h>
+#endif
 
 namespace tt {
 
+/** Get the number of ASCII code-units at the start of a UTF-8 string.
+ *
+ * Most text is ASCII, which does not need to be decoded and can be converted by widening each code-unit.
+ * On x64 sixteen code-units are checked at a time using SSE2.
+ *
+ * @param first A pointer to the first code-unit of the string.
+ * @param last A pointer one beyond the last code-unit of the string.
+ * @return The number of code-units before the first non-ASCII code-unit.
+ */
+[[nodiscard]] inline size_t utf8_ascii_prefix_size(char8_t const *first, char8_t const *last) noexcept
+{
+    auto it = first;
+
+#if TT_PROCESSOR == TT_CPU_X64
+    for (; last - it >= 16; it += 16) {
+        ttlet chunk = _mm_loadu_si128(reinterpret_cast<__m128i const *>(it));
+        // The top bit of each code-unit is set for non-ASCII code-units.
+        ttlet mask = static_cast<unsigned int>(_mm_movemask_epi8(chunk));
+        if (mask != 0) {
+            return static_cast<size_t>(it - first) + std::countr_zero(mask);
+        }
+    }
+#else
+    for (; last - it >= 8; it += 8) {
+        uint64_t chunk;
+        std::memcpy(&chunk, it, sizeof(chunk));
+        if ((chunk & 0x8080'8080'8080'8080) != 0) {
+            break;
+        }
+    }
+#endif
+
+    for (; it != last; ++it) {
+        if (*it > 0x7f) {
+            break;
+        }
+    }
+    return static_cast<size_t>(it - first);
+}
+
 /** Convert a UTF-16 encoded code-point to a UTF-32 encoded code-point
  *
  * It is undefined behavior when the iterator does not point to a valid
@@ -91,7 +136,7 @@ template<typename Iterator>
         cp |= static_cast<char32_t>(*(it++) & 0x3f);
         cp <<= 6;
         cp |= static_cast<char32_t>(*(it++) & 0x3f);
-        tt_axiom(cp >= 0x100000 && cp <= 0x10ffff, "UTF-8 Overlong encoding");
+        tt_axiom(cp >= 0x010000 && cp <= 0x10ffff, "UTF-8 Overlong encoding");
         return cp;
     }
 }
@@ -153,7 +198,7 @@ constexpr bool utf8_to_utf32(Iterator &it, Iterator last, char32_t &code_point)
         }
 
         code_point <<= 6;
-        code_point = *(it++) & 0x3f;
+        code_point |= *(it++) & 0x3f;
     }
 
     if ((code_point >= 0xd800 && code_point <= 0xdfff) || // Surrogate pair
@@ -381,13 +426,16 @@ template<typename Container>
 {
     auto r = std::move(rhs);
 
-    ttlet first = begin(rhs);
-    ttlet last = end(rhs);
+    ttlet first = begin(r);
+    ttlet last = end(r);
+
+    // Skip over the ASCII code-units, which are always valid.
+    ttlet ascii_size = utf8_ascii_prefix_size(r.data(), r.data() + r.size());
 
     auto code_point = char32_t{};
     auto valid = true;
     auto old_it = first;
-    for (auto it = first; valid && it != last;) {
+    for (auto it = first + ascii_size; valid && it != last;) {
         old_it = it;
         valid &= utf8_to_utf32(it, last, code_point);
     }
@@ -525,9 +573,17 @@ template<typename StringT>
     r.reserve(rhs.size());
     auto r_it = std::back_inserter(r);
 
-    for (auto it = std::begin(rhs); it != std::end(rhs);) {
-        ttlet c32 = utf8_to_utf32(it);
-        utf32_to_utf16(c32, r_it);
+    ttlet last = rhs.data() + rhs.size();
+    for (auto it = rhs.data(); it != last;) {
+        // Widen runs of ASCII code-units without decoding.
+        ttlet ascii_size = utf8_ascii_prefix_size(it, last);
+        r.append(it, it + ascii_size);
+        it += ascii_size;
+
+        if (it != last) {
+            ttlet c32 = utf8_to_utf32(it);
+            utf32_to_utf16(c32, r_it);
+        }
     }
     return r;
 }
@@ -561,8 +617,16 @@ template<typename StringT>
     auto r = std::u32string{};
     r.reserve(rhs.size());
 
-    for (auto it = std::begin(rhs); it != std::end(rhs);) {
-        r += utf8_to_utf32(it);
+    ttlet last = rhs.data() + rhs.size();
+    for (auto it = rhs.data(); it != last;) {
+        // Widen runs of ASCII code-units without decoding.
+        ttlet ascii_size = utf8_ascii_prefix_size(it, last);
+        r.append(it, it + ascii_size);
+        it += ascii_size;
+
+        if (it != last) {
+            r += utf8_to_utf32(it);
+        }
     }
     return r;
 }
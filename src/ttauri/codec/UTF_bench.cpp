@@ -0,0 +1,60 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/codec/UTF.hpp"
+#include <benchmark/benchmark.h>
+#include <string>
+
+using namespace std;
+using namespace tt;
+
+/** Text of about nr_bytes long, ASCII only or mixed with multi-byte code-units.
+ */
+[[nodiscard]] static std::string make_UTF_bench_text(int64_t nr_bytes, bool ascii) noexcept
+{
+    ttlet sentence = ascii ? std::string{"The quick brown fox jumps over the lazy dog. "} :
+                             std::string{"Zwölf Boxkämpfer jagen Viktor quer über den großen Sylter Deich. 素早い茶色の狐。 "};
+
+    auto r = std::string{};
+    while (std::ssize(r) < nr_bytes) {
+        r += sentence;
+    }
+    return r;
+}
+
+static void UTF8_to_UTF32(benchmark::State &state)
+{
+    ttlet text = make_UTF_bench_text(state.range(0), static_cast<bool>(state.range(1)));
+
+    for (auto _ : state) {
+        ttlet result = to_u32string(text);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetBytesProcessed(state.iterations() * std::ssize(text));
+}
+BENCHMARK(UTF8_to_UTF32)->Args({4096, 1})->Args({4096, 0});
+
+static void UTF32_to_UTF8(benchmark::State &state)
+{
+    ttlet text = to_u32string(make_UTF_bench_text(state.range(0), static_cast<bool>(state.range(1))));
+
+    for (auto _ : state) {
+        ttlet result = to_string(text);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * std::ssize(text));
+}
+BENCHMARK(UTF32_to_UTF8)->Args({4096, 1})->Args({4096, 0});
+
+static void UTF8_to_UTF16(benchmark::State &state)
+{
+    ttlet text = make_UTF_bench_text(state.range(0), static_cast<bool>(state.range(1)));
+
+    for (auto _ : state) {
+        ttlet result = to_u16string(text);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetBytesProcessed(state.iterations() * std::ssize(text));
+}
+BENCHMARK(UTF8_to_UTF16)->Args({4096, 1})->Args({4096, 0});
@@ -0,0 +1,45 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/codec/UTF.hpp"
+#include <gtest/gtest.h>
+#include <iostream>
+#include <string>
+
+using namespace std;
+using namespace tt;
+
+TEST(UTF, utf8_ascii_prefix_size)
+{
+    ttlet ascii = u8"The quick brown fox jumps over the lazy dog"s;
+    ASSERT_EQ(utf8_ascii_prefix_size(ascii.data(), ascii.data() + ascii.size()), ascii.size());
+
+    for (size_t i = 0; i != ascii.size(); ++i) {
+        auto text = ascii;
+        text[i] = char8_t{0xc3};
+        ASSERT_EQ(utf8_ascii_prefix_size(text.data(), text.data() + text.size()), i);
+    }
+}
+
+TEST(UTF, to_u32string)
+{
+    ASSERT_TRUE(to_u32string(u8"Hello World"sv) == U"Hello World"s);
+    ASSERT_TRUE(to_u32string(u8"Café au lait, the quick brown € fox \U0001f600"sv) == U"Café au lait, the quick brown € fox \U0001f600"s);
+}
+
+TEST(UTF, to_u16string)
+{
+    ASSERT_TRUE(to_u16string(u8"Hello World"sv) == u"Hello World"s);
+    ASSERT_TRUE(to_u16string(u8"Café au lait, the quick brown € fox \U0001f600"sv) == u"Café au lait, the quick brown € fox \U0001f600"s);
+}
+
+TEST(UTF, sanitize_u8string)
+{
+    ASSERT_TRUE(sanitize_u8string(u8"Café au lait, the quick brown € fox"s) == u8"Café au lait, the quick brown € fox"s);
+
+    // An invalid code-unit is interpreted as CP-1252; 0xe9 is 'e' with an acute accent.
+    auto invalid = u8"The quick brown fox, Caf"s;
+    invalid += char8_t{0xe9};
+    ASSERT_TRUE(sanitize_u8string(std::move(invalid)) == u8"The quick brown fox, Café"s);
+}
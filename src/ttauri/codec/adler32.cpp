@@ -0,0 +1,88 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "adler32.hpp"
+#include "../required.hpp"
+#include <immintrin.h>
+#include <algorithm>
+
+namespace tt {
+
+constexpr uint32_t adler32_base = 65521;
+
+/** The maximum number of bytes that can be added before the sums overflow 32 bits.
+ */
+constexpr size_t adler32_nmax = 5552;
+
+/** The number of bytes added at a time by the SIMD loop.
+ */
+constexpr size_t adler32_block_size = 32;
+
+[[nodiscard]] static uint32_t adler32_horizontal_sum(__m128i v) noexcept
+{
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0b01'00'11'10));
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0b10'11'00'01));
+    return static_cast<uint32_t>(_mm_cvtsi128_si32(v));
+}
+
+/** Add blocks of 32 bytes to the sums.
+ *
+ * For each block the second sum is incremented by 32 times the first sum
+ * at the start of the block, plus each byte weighted by its distance to the end of the block.
+ */
+static void adler32_blocks(uint8_t const *ptr, size_t nr_blocks, uint32_t &a, uint32_t &b) noexcept
+{
+    ttlet weights_lo = _mm_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17);
+    ttlet weights_hi = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    ttlet ones = _mm_set1_epi16(1);
+    ttlet zero = _mm_setzero_si128();
+
+    // The sum of the first sums at the start of each block, excluding the initial value of `a`.
+    auto prefix_sum = zero;
+    auto sum_a = zero;
+    auto sum_b = zero;
+    for (size_t i = 0; i != nr_blocks; ++i, ptr += adler32_block_size) {
+        ttlet lo = _mm_loadu_si128(reinterpret_cast<__m128i const *>(ptr));
+        ttlet hi = _mm_loadu_si128(reinterpret_cast<__m128i const *>(ptr + 16));
+
+        prefix_sum = _mm_add_epi32(prefix_sum, sum_a);
+        sum_a = _mm_add_epi32(sum_a, _mm_add_epi32(_mm_sad_epu8(lo, zero), _mm_sad_epu8(hi, zero)));
+        sum_b = _mm_add_epi32(sum_b, _mm_madd_epi16(_mm_maddubs_epi16(lo, weights_lo), ones));
+        sum_b = _mm_add_epi32(sum_b, _mm_madd_epi16(_mm_maddubs_epi16(hi, weights_hi), ones));
+    }
+
+    b += a * static_cast<uint32_t>(nr_blocks * adler32_block_size);
+    b += adler32_horizontal_sum(_mm_add_epi32(sum_b, _mm_slli_epi32(prefix_sum, 5)));
+    a += adler32_horizontal_sum(sum_a);
+}
+
+[[nodiscard]] uint32_t adler32(std::span<std::byte const> bytes, uint32_t adler) noexcept
+{
+    auto a = adler & 0xffff;
+    auto b = adler >> 16;
+
+    auto ptr = reinterpret_cast<uint8_t const *>(bytes.data());
+    auto size = bytes.size();
+
+    while (size >= adler32_block_size) {
+        ttlet nr_blocks = std::min(size, adler32_nmax) / adler32_block_size;
+        adler32_blocks(ptr, nr_blocks, a, b);
+        a %= adler32_base;
+        b %= adler32_base;
+
+        ptr += nr_blocks * adler32_block_size;
+        size -= nr_blocks * adler32_block_size;
+    }
+
+    for (; size != 0; --size) {
+        a += *ptr++;
+        b += a;
+    }
+    a %= adler32_base;
+    b %= adler32_base;
+
+    return (b << 16) | a;
+}
+
+} // namespace tt
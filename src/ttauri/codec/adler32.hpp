@@ -0,0 +1,21 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <span>
+#include <cstddef>
+#include <cstdint>
+
+namespace tt {
+
+/** Calculate the Adler-32 checksum of data, as used by zlib.
+ *
+ * @param bytes The data.
+ * @param adler The checksum of the data preceding `bytes`, to calculate the checksum in parts.
+ * @return The checksum of the preceding data and `bytes`.
+ */
+[[nodiscard]] uint32_t adler32(std::span<std::byte const> bytes, uint32_t adler = 1) noexcept;
+
+} // namespace tt
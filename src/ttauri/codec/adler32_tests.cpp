@@ -0,0 +1,50 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/codec/adler32.hpp"
+#include "ttauri/byte_string.hpp"
+#include "ttauri/required.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace std;
+using namespace tt;
+
+[[nodiscard]] static uint32_t adler32_reference(std::span<std::byte const> bytes) noexcept
+{
+    uint32_t a = 1;
+    uint32_t b = 0;
+    for (ttlet c : bytes) {
+        a = (a + static_cast<uint8_t>(c)) % 65521;
+        b = (b + a) % 65521;
+    }
+    return (b << 16) | a;
+}
+
+TEST(Adler32, KnownValues) {
+    ASSERT_EQ(adler32(to_bstring("")), 0x0000'0001);
+    ASSERT_EQ(adler32(to_bstring("a")), 0x0062'0062);
+    ASSERT_EQ(adler32(to_bstring("Wikipedia")), 0x11e6'0398);
+}
+
+TEST(Adler32, BlockSizes) {
+    auto bytes = std::vector<std::byte>(1000);
+    for (size_t i = 0; i != bytes.size(); ++i) {
+        bytes[i] = static_cast<std::byte>(i * 7 + (i >> 3));
+    }
+
+    for (size_t size = 0; size != bytes.size(); ++size) {
+        ttlet part = std::span<std::byte const>(bytes).first(size);
+        ASSERT_EQ(adler32(part), adler32_reference(part)) << "size " << size;
+    }
+}
+
+TEST(Adler32, Overflow) {
+    // The largest byte values give the largest sums before reduction.
+    ttlet bytes = std::vector<std::byte>(100'000, std::byte{0xff});
+    ASSERT_EQ(adler32(bytes), adler32_reference(bytes));
+
+    ttlet first = adler32(std::span<std::byte const>(bytes).first(12'345));
+    ASSERT_EQ(adler32(std::span<std::byte const>(bytes).subspan(12'345), first), adler32_reference(bytes));
+}
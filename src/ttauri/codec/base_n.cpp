@@ -0,0 +1,91 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "base_n.hpp"
+#include <immintrin.h>
+#include <cstring>
+
+namespace tt {
+namespace detail {
+
+[[nodiscard]] ssize_t base64_encode_ssse3(std::byte const *ptr, ssize_t size, char *output, char c62, char c63) noexcept
+{
+    // Duplicate the bytes so that each 32 bit lane holds the three bytes of a block, as [b1, b0, b2, b1].
+    ttlet shuffle = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+
+    // The offset to add to each 6 bit index, selected by the range the index is in.
+    ttlet offsets = _mm_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        static_cast<char>(c62 - 62), static_cast<char>(c63 - 63), 'A', 0, 0);
+
+    ssize_t i = 0;
+    for (; i + 12 <= size; i += 12) {
+        uint64_t lo;
+        uint32_t hi;
+        std::memcpy(&lo, ptr + i, sizeof(lo));
+        std::memcpy(&hi, ptr + i + 8, sizeof(hi));
+        auto in = _mm_insert_epi32(_mm_cvtsi64_si128(static_cast<long long>(lo)), static_cast<int>(hi), 2);
+        in = _mm_shuffle_epi8(in, shuffle);
+
+        // Move the four 6 bit indices of each block into separate bytes.
+        ttlet t0 = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+        ttlet t1 = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+        ttlet indices = _mm_or_si128(t0, t1);
+
+        // 0-25 -> 13, 26-51 -> 0, 52-61 -> 1-10, 62 -> 11, 63 -> 12
+        auto range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+
+        ttlet chars = _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, range));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output), chars);
+        output += 16;
+    }
+    return i;
+}
+
+[[nodiscard]] ssize_t base64_decode_ssse3(char const *ptr, ssize_t size, std::byte *output, char c62, char c63) noexcept
+{
+    auto in_range = [](__m128i v, char first, char last) {
+        return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(first - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8(last + 1)));
+    };
+
+    ssize_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        ttlet in = _mm_loadu_si128(reinterpret_cast<__m128i const *>(ptr + i));
+
+        ttlet is_upper = in_range(in, 'A', 'Z');
+        ttlet is_lower = in_range(in, 'a', 'z');
+        ttlet is_digit = in_range(in, '0', '9');
+        ttlet is_62 = _mm_cmpeq_epi8(in, _mm_set1_epi8(c62));
+        ttlet is_63 = _mm_cmpeq_epi8(in, _mm_set1_epi8(c63));
+
+        ttlet is_valid = _mm_or_si128(_mm_or_si128(_mm_or_si128(is_upper, is_lower), is_digit), _mm_or_si128(is_62, is_63));
+        if (_mm_movemask_epi8(is_valid) != 0xffff) {
+            // Padding, white-space or an invalid character is handled by the caller.
+            break;
+        }
+
+        auto offset = _mm_and_si128(is_upper, _mm_set1_epi8(-'A'));
+        offset = _mm_or_si128(offset, _mm_and_si128(is_lower, _mm_set1_epi8(26 - 'a')));
+        offset = _mm_or_si128(offset, _mm_and_si128(is_digit, _mm_set1_epi8(52 - '0')));
+        offset = _mm_or_si128(offset, _mm_and_si128(is_62, _mm_set1_epi8(static_cast<char>(62 - c62))));
+        offset = _mm_or_si128(offset, _mm_and_si128(is_63, _mm_set1_epi8(static_cast<char>(63 - c63))));
+        ttlet indices = _mm_add_epi8(in, offset);
+
+        // Merge the four 6 bit indices of each block into 24 bits, then bring the bytes in big-endian order.
+        ttlet pairs = _mm_maddubs_epi16(indices, _mm_set1_epi32(0x01400140));
+        ttlet blocks = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+        ttlet bytes = _mm_shuffle_epi8(blocks, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+        ttlet lo = static_cast<uint64_t>(_mm_cvtsi128_si64(bytes));
+        ttlet hi = static_cast<uint32_t>(_mm_extract_epi32(bytes, 2));
+        std::memcpy(output, &lo, sizeof(lo));
+        std::memcpy(output + 8, &hi, sizeof(hi));
+        output += 12;
+    }
+    return i;
+}
+
+} // namespace detail
+} // namespace tt
@@ -13,10 +13,8 @@
 #include <string>
 #include <cstdint>
 #include <array>
-#include <string>
 #include <string_view>
-
-#pragma once
+#include <type_traits>
 
 namespace tt {
 namespace detail {
@@ -85,7 +83,23 @@ struct base_n_alphabet {
 
     constexpr int8_t int_from_char(char c) const noexcept
     {
-        return int_from_char_table[narrow_cast<size_t>(c)];
+        return int_from_char_table[static_cast<uint8_t>(c)];
+    }
+
+    /** The alphabet has the layout of base64: 'A'-'Z', 'a'-'z', '0'-'9' and two other characters.
+     */
+    constexpr bool is_base64_layout() const noexcept
+    {
+        if (radix != 64) {
+            return false;
+        }
+        for (int i = 0; i != 62; ++i) {
+            ttlet expected = i < 26 ? 'A' + i : i < 52 ? 'a' + (i - 26) : '0' + (i - 52);
+            if (char_from_int_table[i] != expected) {
+                return false;
+            }
+        }
+        return true;
     }
 };
 
@@ -113,6 +127,29 @@ constexpr auto base85_rfc1924_alphabet =
 constexpr auto base85_btoa_alphabet =
     base_n_alphabet{"!\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstu"};
 
+/** Encode whole blocks of base64 using SSSE3.
+ *
+ * @param ptr The bytes to encode.
+ * @param size The number of bytes.
+ * @param output The buffer to write the characters to, 4 characters for each 3 bytes encoded.
+ * @param c62 The character for the value 62.
+ * @param c63 The character for the value 63.
+ * @return The number of bytes encoded, a multiple of 12.
+ */
+[[nodiscard]] ssize_t base64_encode_ssse3(std::byte const *ptr, ssize_t size, char *output, char c62, char c63) noexcept;
+
+/** Decode whole blocks of base64 using SSSE3.
+ * Decoding stops before the first 16 characters that include padding, white-space or an invalid character.
+ *
+ * @param ptr The characters to decode.
+ * @param size The number of characters.
+ * @param output The buffer to write the bytes to, 3 bytes for each 4 characters decoded.
+ * @param c62 The character for the value 62.
+ * @param c63 The character for the value 63.
+ * @return The number of characters decoded, a multiple of 16.
+ */
+[[nodiscard]] ssize_t base64_decode_ssse3(char const *ptr, ssize_t size, std::byte *output, char c62, char c63) noexcept;
+
 } // namespace detail
 
 template<detail::base_n_alphabet Alphabet, int CharsPerBlock, int BytesPerBlock>
@@ -126,6 +163,10 @@ public:
     static_assert(bytes_per_block != 0, "radix must be 16, 32, 64 or 85");
     static_assert(chars_per_block != 0, "radix must be 16, 32, 64 or 85");
 
+    /** Whole blocks are encoded and decoded with SIMD, when using pointers to bytes and characters.
+     */
+    static constexpr bool has_simd = alphabet.is_base64_layout() && chars_per_block == 4 && bytes_per_block == 3;
+
     template<typename T>
     static constexpr T int_from_char(char c) noexcept
     {
@@ -138,6 +179,149 @@ public:
         return alphabet.char_from_int(narrow_cast<int8_t>(x));
     }
 
+    /** An encoder for data that is available in chunks.
+     *
+     * Bytes are encoded with `write()`, which may be called many times. After the last
+     * bytes are written, `close()` encodes the final partial block.
+     */
+    class encoder {
+    public:
+        constexpr encoder() noexcept : _block(0), _byte_index_in_block(0) {}
+
+        /** Encode bytes.
+         *
+         * @param ptr An iterator pointing to the first byte to encode.
+         * @param last An iterator pointing to one beyond the last byte to encode.
+         * @param output An output iterator to write the characters to.
+         * @return The output iterator beyond the written characters.
+         */
+        template<typename ItIn, typename ItOut>
+        constexpr ItOut write(ItIn ptr, ItIn last, ItOut output)
+        {
+            if constexpr (has_simd && is_pointer_to<ItIn, std::byte> && is_pointer_to<ItOut, char>) {
+                if (not std::is_constant_evaluated() && _byte_index_in_block == 0) {
+                    ttlet n = detail::base64_encode_ssse3(ptr, last - ptr, output, char_from_int(62), char_from_int(63));
+                    ptr += n;
+                    output += n / bytes_per_block * chars_per_block;
+                }
+            }
+
+            while (ptr != last) {
+                // Construct a block in big endian.
+                ttlet shift = 8 * ((bytes_per_block - 1) - _byte_index_in_block);
+                _block |= static_cast<long long>(*(ptr++)) << shift;
+
+                if (++_byte_index_in_block == bytes_per_block) {
+                    output = encode_block(_block, bytes_per_block, output);
+                    _block = 0;
+                    _byte_index_in_block = 0;
+                }
+            }
+            return output;
+        }
+
+        /** Encode the final partial block.
+         *
+         * @param output An output iterator to write the characters to.
+         * @return The output iterator beyond the written characters.
+         */
+        template<typename ItOut>
+        constexpr ItOut close(ItOut output)
+        {
+            if (_byte_index_in_block != 0) {
+                output = encode_block(_block, _byte_index_in_block, output);
+                _block = 0;
+                _byte_index_in_block = 0;
+            }
+            return output;
+        }
+
+    private:
+        long long _block;
+        long long _byte_index_in_block;
+    };
+
+    /** A decoder for text that is available in chunks.
+     *
+     * Text is decoded with `write()`, which may be called many times. After the last
+     * text is written, `close()` decodes the final partial block.
+     */
+    class decoder {
+    public:
+        constexpr decoder() noexcept : _block(0), _char_index_in_block(0) {}
+
+        /** Decode text.
+         *
+         * @param [in,out] ptr An iterator to the start of the base-n encoded text.
+         *                     On return this points to the first invalid character, or to last.
+         * @param last An iterator beyond the encoded text.
+         * @param output An output iterator to write the bytes to.
+         * @return The output iterator beyond the written bytes.
+         */
+        template<typename ItIn, typename ItOut>
+        constexpr ItOut write(ItIn &ptr, ItIn last, ItOut output)
+        {
+            while (ptr != last) {
+                if constexpr (has_simd && is_pointer_to<ItIn, char> && is_pointer_to<ItOut, std::byte>) {
+                    if (not std::is_constant_evaluated() && _char_index_in_block == 0) {
+                        ttlet n = detail::base64_decode_ssse3(ptr, last - ptr, output, char_from_int(62), char_from_int(63));
+                        ptr += n;
+                        output += n / chars_per_block * bytes_per_block;
+                        if (ptr == last) {
+                            break;
+                        }
+                    }
+                }
+
+                ttlet digit = int_from_char<long long>(*ptr);
+                if (digit == -1) {
+                    // Whitespace is ignored.
+                    ++ptr;
+                    continue;
+
+                } else if (digit == -2) {
+                    // Other character means end
+                    break;
+                }
+
+                ++ptr;
+                _block *= radix;
+                _block += digit;
+
+                if (++_char_index_in_block == chars_per_block) {
+                    output = decode_block(_block, chars_per_block, output);
+                    _block = 0;
+                    _char_index_in_block = 0;
+                }
+            }
+            return output;
+        }
+
+        /** Decode the final partial block.
+         *
+         * @param output An output iterator to write the bytes to.
+         * @return The output iterator beyond the written bytes.
+         */
+        template<typename ItOut>
+        constexpr ItOut close(ItOut output)
+        {
+            if (_char_index_in_block != 0) {
+                // pad the block with zeros.
+                for (auto i = _char_index_in_block; i != chars_per_block; ++i) {
+                    _block *= radix;
+                }
+                output = decode_block(_block, _char_index_in_block, output);
+                _block = 0;
+                _char_index_in_block = 0;
+            }
+            return output;
+        }
+
+    private:
+        long long _block;
+        long long _char_index_in_block;
+    };
+
     /** Encode bytes into a string.
      *
      * @param ptr Pointer
@@ -147,24 +331,8 @@ public:
     template<typename ItIn, typename ItOut>
     static constexpr void encode(ItIn ptr, ItIn last, ItOut output)
     {
-        long long byte_index_in_block = 0;
-        long long block = 0;
-
-        while (ptr != last) {
-            // Construct a block in big endian.
-            ttlet shift = 8 * ((bytes_per_block - 1) - byte_index_in_block);
-            block |= static_cast<long long>(*(ptr++)) << shift;
-
-            if (++byte_index_in_block == bytes_per_block) {
-                encode_block(block, bytes_per_block, output);
-                block = 0;
-                byte_index_in_block = 0;
-            }
-        }
-
-        if (byte_index_in_block != 0) {
-            encode_block(block, byte_index_in_block, output);
-        }
+        auto e = encoder{};
+        e.close(e.write(ptr, last, output));
     }
 
     /** Encode bytes into a string.
@@ -188,7 +356,14 @@ public:
      */
     static constexpr std::string encode(std::span<std::byte const> bytes) noexcept
     {
-        return encode(begin(bytes), end(bytes));
+        auto r = std::string{};
+        r.resize(narrow_cast<size_t>((std::ssize(bytes) + bytes_per_block - 1) / bytes_per_block * chars_per_block));
+
+        ttlet first = bytes.data();
+        auto e = encoder{};
+        ttlet last = e.close(e.write(first, first + bytes.size(), r.data()));
+        r.resize(narrow_cast<size_t>(last - r.data()));
+        return r;
     }
 
     /** Decodes a UTF-8 string into bytes.
@@ -201,77 +376,62 @@ public:
     template<typename ItIn, typename ItOut>
     static constexpr ItIn decode(ItIn ptr, ItIn last, ItOut output) noexcept
     {
-        int char_index_in_block = 0;
-        long long block = 0;
-
-        for (; ptr != last; ++ptr) {
-            ttlet digit = int_from_char<long long>(*ptr);
-            if (digit == -1) {
-                // Whitespace is ignored.
-                continue;
-
-            } else if (digit == -2) {
-                // Other character means end
-                return ptr;
-
-            } else {
-                block *= radix;
-                block += digit;
-
-                if (++char_index_in_block == chars_per_block) {
-                    decode_block(block, chars_per_block, output);
-                    block = 0;
-                    char_index_in_block = 0;
-                }
-            }
-        }
-
-        if (char_index_in_block != 0) {
-            // pad the block with zeros.
-            for (auto i = char_index_in_block; i != chars_per_block; ++i) {
-                block *= radix;
-            }
-            decode_block(block, char_index_in_block, output);
-        }
+        auto d = decoder{};
+        d.close(d.write(ptr, last, output));
         return ptr;
     }
 
     static bstring decode(std::string_view str)
     {
         auto r = bstring{};
-        auto i = decode(begin(str), end(str), std::back_inserter(r));
-        tt_parse_check(i == end(str));
+        r.resize((str.size() + chars_per_block - 1) / chars_per_block * bytes_per_block);
+
+        auto ptr = str.data();
+        ttlet last = ptr + str.size();
+        auto d = decoder{};
+        ttlet output = d.close(d.write(ptr, last, r.data()));
+        tt_parse_check(ptr == last);
+
+        r.resize(narrow_cast<size_t>(output - r.data()));
         return r;
     }
 
 private:
+    template<typename It, typename T>
+    static constexpr bool is_pointer_to =
+        std::is_pointer_v<It> && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<It>>, T>;
+
     template<typename ItOut>
-    static void encode_block(long long block, long long nr_bytes, ItOut output) noexcept
+    static constexpr ItOut encode_block(long long block, long long nr_bytes, ItOut output) noexcept
     {
         ttlet padding = bytes_per_block - nr_bytes;
 
         // Construct a block in little-endian, using easy division/modulo.
-        auto char_block = std::string{};
+        char char_block[chars_per_block] = {};
+        long long nr_chars = 0;
         for (long long i = 0; i != chars_per_block; ++i) {
             ttlet v = block % radix;
             block /= radix;
 
             if (i < padding) {
-                tt_assume(v != 0);
+                tt_axiom(v == 0);
                 if (padding_char != 0) {
-                    char_block += padding_char;
+                    char_block[nr_chars++] = padding_char;
                 }
             } else {
-                char_block += char_from_int(v);
+                char_block[nr_chars++] = char_from_int(v);
             }
         }
 
         // A block should be output as a big-endian radix-number.
-        std::copy(rbegin(char_block), rend(char_block), output);
+        for (auto i = nr_chars; i != 0; --i) {
+            *(output++) = char_block[i - 1];
+        }
+        return output;
     }
 
     template<typename ItOut>
-    static constexpr void decode_block(long long block, long long nr_chars, ItOut output) noexcept
+    static constexpr ItOut decode_block(long long block, long long nr_chars, ItOut output) noexcept
     {
         ttlet padding = chars_per_block - nr_chars;
 
@@ -284,6 +444,7 @@ private:
         }
 
         // The output data will not contain the padding.
+        return output;
     }
 };
 
@@ -57,3 +57,81 @@ TEST(base_n, base64_decode) {
     ASSERT_EQ(base64::decode("SGVsb G8g\nV29ybGQK"), to_bstring("Hello World\n"));
     ASSERT_THROW(base64::decode("SGVsbG8g,V29ybGQK"), parse_error);
 }
+
+[[nodiscard]] static bstring make_test_bytes(size_t size)
+{
+    auto r = bstring{};
+    auto x = uint32_t{12345};
+    for (size_t i = 0; i != size; ++i) {
+        x = x * 1103515245 + 12345;
+        r += static_cast<std::byte>(x >> 24);
+    }
+    return r;
+}
+
+TEST(base_n, base64_simd)
+{
+    for (size_t size = 0; size != 200; ++size) {
+        ttlet bytes = make_test_bytes(size);
+
+        // The generic iterator version does not use SIMD.
+        ttlet expected = base64::encode(bytes.begin(), bytes.end());
+        ttlet encoded = base64::encode(bytes);
+        ASSERT_EQ(encoded, expected);
+        ASSERT_EQ(base64::decode(encoded), bytes);
+
+        auto decoded = bstring{};
+        base64::decode(encoded.begin(), encoded.end(), std::back_inserter(decoded));
+        ASSERT_EQ(decoded, bytes);
+
+        ttlet url_encoded = base64url::encode(bytes);
+        ASSERT_EQ(url_encoded, base64url::encode(bytes.begin(), bytes.end()));
+        ASSERT_EQ(base64url::decode(url_encoded), bytes);
+    }
+}
+
+TEST(base_n, base64_decode_line_breaks)
+{
+    ttlet bytes = make_test_bytes(1000);
+    ttlet encoded = base64::encode(bytes);
+
+    // Like MIME, break the text into lines of 76 characters.
+    auto text = std::string{};
+    for (size_t i = 0; i < encoded.size(); i += 76) {
+        text += encoded.substr(i, 76);
+        text += "\r\n";
+    }
+    ASSERT_EQ(base64::decode(text), bytes);
+
+    text[500] = ',';
+    ASSERT_THROW(base64::decode(text), parse_error);
+}
+
+TEST(base_n, base64_stream)
+{
+    ttlet bytes = make_test_bytes(1000);
+    ttlet expected = base64::encode(bytes);
+
+    auto encoded = std::string{};
+    auto encoder = base64::encoder{};
+    for (size_t i = 0; i < bytes.size(); i += 7) {
+        ttlet first = bytes.data() + i;
+        ttlet last = bytes.data() + std::min(i + 7, bytes.size());
+        encoder.write(first, last, std::back_inserter(encoded));
+    }
+    encoder.close(std::back_inserter(encoded));
+    ASSERT_EQ(encoded, expected);
+
+    auto decoded = bstring(bytes.size(), std::byte{0});
+    auto output = decoded.data();
+    auto decoder = base64::decoder{};
+    for (size_t i = 0; i < encoded.size(); i += 37) {
+        auto first = encoded.data() + i;
+        ttlet last = encoded.data() + std::min(i + 37, encoded.size());
+        output = decoder.write(first, last, output);
+        ASSERT_EQ(first, last);
+    }
+    output = decoder.close(output);
+    ASSERT_EQ(output, decoded.data() + decoded.size());
+    ASSERT_EQ(decoded, bytes);
+}
@@ -0,0 +1,111 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "crc32.hpp"
+#include "../required.hpp"
+#include <immintrin.h>
+#include <array>
+
+namespace tt {
+
+[[nodiscard]] static constexpr std::array<uint32_t, 256> crc32_make_table() noexcept
+{
+    auto r = std::array<uint32_t, 256>{};
+    for (uint32_t i = 0; i != 256; ++i) {
+        auto c = i;
+        for (int j = 0; j != 8; ++j) {
+            c = (c & 1) ? (c >> 1) ^ 0xedb8'8320 : c >> 1;
+        }
+        r[i] = c;
+    }
+    return r;
+}
+
+constexpr auto crc32_table = crc32_make_table();
+
+[[nodiscard]] static uint32_t crc32_bytes(uint8_t const *ptr, size_t size, uint32_t crc) noexcept
+{
+    for (; size != 0; --size) {
+        crc = crc32_table[(crc ^ *ptr++) & 0xff] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+/** Calculate the CRC-32 by folding 16 byte blocks with carry-less multiplication.
+ *
+ * Four blocks are folded in parallel, then folded into a single block which is
+ * reduced with a Barrett reduction. The constants are powers of x modulo the
+ * bit-reflected CRC-32 polynomial, see "Fast CRC Computation for Generic Polynomials
+ * Using PCLMULQDQ Instruction" by Intel.
+ *
+ * @param ptr The data.
+ * @param size The size of the data, at least 64 and a multiple of 16.
+ * @param crc The inverted CRC-32 of the preceding data.
+ * @return The inverted CRC-32.
+ */
+[[nodiscard]] static uint32_t crc32_fold(uint8_t const *ptr, size_t size, uint32_t crc) noexcept
+{
+    auto load = [&ptr]() noexcept {
+        ttlet r = _mm_loadu_si128(reinterpret_cast<__m128i const *>(ptr));
+        ptr += 16;
+        return r;
+    };
+
+    auto fold = [](__m128i x, __m128i k, __m128i next) noexcept {
+        return _mm_xor_si128(
+            _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11)), next);
+    };
+
+    auto x0 = _mm_xor_si128(load(), _mm_cvtsi32_si128(static_cast<int>(crc)));
+    auto x1 = load();
+    auto x2 = load();
+    auto x3 = load();
+    size -= 64;
+
+    ttlet k1k2 = _mm_set_epi64x(0x0'01c6'e415'96, 0x0'0154'442b'd4);
+    for (; size >= 64; size -= 64) {
+        x0 = fold(x0, k1k2, load());
+        x1 = fold(x1, k1k2, load());
+        x2 = fold(x2, k1k2, load());
+        x3 = fold(x3, k1k2, load());
+    }
+
+    ttlet k3k4 = _mm_set_epi64x(0x0'00cc'aa00'9e, 0x0'0175'1997'd0);
+    x0 = fold(x0, k3k4, x1);
+    x0 = fold(x0, k3k4, x2);
+    x0 = fold(x0, k3k4, x3);
+    for (; size >= 16; size -= 16) {
+        x0 = fold(x0, k3k4, load());
+    }
+
+    // Fold 128 bits to 64 bits.
+    ttlet mask32 = _mm_setr_epi32(-1, 0, -1, 0);
+    x0 = _mm_xor_si128(_mm_clmulepi64_si128(x0, k3k4, 0x10), _mm_srli_si128(x0, 8));
+
+    ttlet k5 = _mm_set_epi64x(0, 0x0'0163'cd61'24);
+    x0 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x0, mask32), k5, 0x00), _mm_srli_si128(x0, 4));
+
+    // Barrett reduction to 32 bits.
+    ttlet poly = _mm_set_epi64x(0x0'01f7'0116'41, 0x0'01db'7106'41);
+    auto t = _mm_clmulepi64_si128(_mm_and_si128(x0, mask32), poly, 0x10);
+    t = _mm_clmulepi64_si128(_mm_and_si128(t, mask32), poly, 0x00);
+    return static_cast<uint32_t>(_mm_extract_epi32(_mm_xor_si128(x0, t), 1));
+}
+
+[[nodiscard]] uint32_t crc32(std::span<std::byte const> bytes, uint32_t crc) noexcept
+{
+    auto ptr = reinterpret_cast<uint8_t const *>(bytes.data());
+    auto size = bytes.size();
+
+    crc = ~crc;
+    if (size >= 64) {
+        ttlet fold_size = size & ~size_t{15};
+        crc = crc32_fold(ptr, fold_size, crc);
+        ptr += fold_size;
+        size -= fold_size;
+    }
+    return ~crc32_bytes(ptr, size, crc);
+}
+
+} // namespace tt
@@ -0,0 +1,23 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <span>
+#include <cstddef>
+#include <cstdint>
+
+namespace tt {
+
+/** Calculate the CRC-32 of data, as used by gzip and png.
+ *
+ * Large blocks of data are folded with carry-less multiplication.
+ *
+ * @param bytes The data.
+ * @param crc The CRC-32 of the data preceding `bytes`, to calculate the CRC-32 in parts.
+ * @return The CRC-32 of the preceding data and `bytes`.
+ */
+[[nodiscard]] uint32_t crc32(std::span<std::byte const> bytes, uint32_t crc = 0) noexcept;
+
+} // namespace tt
@@ -0,0 +1,53 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/codec/crc32.hpp"
+#include "ttauri/byte_string.hpp"
+#include "ttauri/required.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace std;
+using namespace tt;
+
+[[nodiscard]] static uint32_t crc32_reference(std::span<std::byte const> bytes) noexcept
+{
+    auto crc = ~uint32_t{0};
+    for (ttlet b : bytes) {
+        crc ^= static_cast<uint8_t>(b);
+        for (int i = 0; i != 8; ++i) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xedb8'8320 : crc >> 1;
+        }
+    }
+    return ~crc;
+}
+
+TEST(CRC32, KnownValues) {
+    ASSERT_EQ(crc32(to_bstring("")), 0x0000'0000);
+    ASSERT_EQ(crc32(to_bstring("a")), 0xe8b7'be43);
+    ASSERT_EQ(crc32(to_bstring("123456789")), 0xcbf4'3926);
+    ASSERT_EQ(crc32(to_bstring("The quick brown fox jumps over the lazy dog")), 0x414f'a339);
+}
+
+TEST(CRC32, FoldSizes) {
+    auto bytes = std::vector<std::byte>(1000);
+    for (size_t i = 0; i != bytes.size(); ++i) {
+        bytes[i] = static_cast<std::byte>(i * 7 + (i >> 3));
+    }
+
+    for (size_t size = 0; size != bytes.size(); ++size) {
+        ttlet part = std::span<std::byte const>(bytes).first(size);
+        ASSERT_EQ(crc32(part), crc32_reference(part)) << "size " << size;
+    }
+}
+
+TEST(CRC32, Parts) {
+    auto bytes = std::vector<std::byte>(1000, std::byte{0xa5});
+    ttlet whole = crc32(bytes);
+
+    for (size_t split = 0; split <= bytes.size(); split += 37) {
+        ttlet first = crc32(std::span<std::byte const>(bytes).first(split));
+        ASSERT_EQ(crc32(std::span<std::byte const>(bytes).subspan(split), first), whole);
+    }
+}
@@ -0,0 +1,285 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "deflate.hpp"
+#include "../endian.hpp"
+#include "../cast.hpp"
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace tt {
+
+/** Bits of a code, in the order they are written, with the number of bits.
+ */
+struct deflate_code {
+    uint32_t bits;
+    int nr_bits;
+};
+
+[[nodiscard]] constexpr uint32_t deflate_reverse_bits(uint32_t code, int nr_bits) noexcept
+{
+    uint32_t r = 0;
+    for (int i = 0; i != nr_bits; ++i) {
+        r = (r << 1) | ((code >> i) & 1);
+    }
+    return r;
+}
+
+/** The fixed Huffman code of a literal/length symbol.
+ * Huffman codes are written starting at the most significant bit.
+ */
+[[nodiscard]] constexpr deflate_code deflate_fixed_literal_code(int symbol) noexcept
+{
+    if (symbol <= 143) {
+        return {deflate_reverse_bits(0x30 + symbol, 8), 8};
+    } else if (symbol <= 255) {
+        return {deflate_reverse_bits(0x190 + symbol - 144, 9), 9};
+    } else if (symbol <= 279) {
+        return {deflate_reverse_bits(symbol - 256, 7), 7};
+    } else {
+        return {deflate_reverse_bits(0xc0 + symbol - 280, 8), 8};
+    }
+}
+
+constexpr auto deflate_length_base = std::array{3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+                                                31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+
+constexpr auto deflate_distance_base = std::array{1,   2,   3,   4,   5,   7,    9,    13,   17,   25,
+                                                  33,  49,  65,  97,  129, 193,  257,  385,  513,  769,
+                                                  1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+
+[[nodiscard]] constexpr int deflate_length_extra(int symbol) noexcept
+{
+    return symbol < 8 || symbol == 28 ? 0 : symbol / 4 - 1;
+}
+
+[[nodiscard]] constexpr int deflate_distance_extra(int symbol) noexcept
+{
+    return symbol < 4 ? 0 : symbol / 2 - 1;
+}
+
+constexpr auto deflate_literal_codes = [] {
+    auto r = std::array<deflate_code, 256>{};
+    for (int i = 0; i != 256; ++i) {
+        r[i] = deflate_fixed_literal_code(i);
+    }
+    return r;
+}();
+
+/** The fixed Huffman code followed by the extra bits of each match length.
+ */
+constexpr auto deflate_length_codes = [] {
+    auto r = std::array<deflate_code, 259>{};
+    int symbol = 0;
+    for (int length = 3; length <= 258; ++length) {
+        if (symbol + 1 < std::ssize(deflate_length_base) && deflate_length_base[symbol + 1] <= length) {
+            ++symbol;
+        }
+
+        ttlet code = deflate_fixed_literal_code(257 + symbol);
+        ttlet extra = static_cast<uint32_t>(length - deflate_length_base[symbol]);
+        r[length] = {code.bits | (extra << code.nr_bits), code.nr_bits + deflate_length_extra(symbol)};
+    }
+    return r;
+}();
+
+/** The distance symbol of the distances 1 to 256, followed by the distance symbol of
+ * every 128 distances from 257 to 32768, the same as zlib does it.
+ */
+constexpr auto deflate_distance_symbols = [] {
+    auto r = std::array<uint8_t, 512>{};
+    int symbol = 0;
+    for (int distance = 1; distance <= 0x8000; ++distance) {
+        if (symbol + 1 < std::ssize(deflate_distance_base) && deflate_distance_base[symbol + 1] <= distance) {
+            ++symbol;
+        }
+
+        if (distance <= 256) {
+            r[distance - 1] = static_cast<uint8_t>(symbol);
+        } else if ((distance - 1) % 128 == 0) {
+            r[256 + ((distance - 1) >> 7)] = static_cast<uint8_t>(symbol);
+        }
+    }
+    return r;
+}();
+
+/** The fixed Huffman code followed by the extra bits of a distance.
+ */
+[[nodiscard]] static deflate_code deflate_distance_code(int distance) noexcept
+{
+    ttlet symbol = distance <= 256 ? deflate_distance_symbols[distance - 1] : deflate_distance_symbols[256 + ((distance - 1) >> 7)];
+    ttlet extra = static_cast<uint32_t>(distance - deflate_distance_base[symbol]);
+    return {deflate_reverse_bits(symbol, 5) | (extra << 5), 5 + deflate_distance_extra(symbol)};
+}
+
+/** Write bits LSB first, the same order as `bit_reader`.
+ *
+ * Bits are collected in a 64 bit buffer, which is written with a single unaligned store
+ * when it holds at least 32 bits. Eight bytes must be available beyond the written data.
+ */
+class deflate_bit_writer {
+public:
+    deflate_bit_writer(std::byte *ptr) noexcept : _ptr(ptr), _buffer(0), _nr_bits(0) {}
+
+    /** Write bits.
+     *
+     * @param code The bits and the number of bits, at most 32.
+     */
+    void put(deflate_code code) noexcept
+    {
+        tt_axiom(code.nr_bits <= 32);
+        _buffer |= static_cast<uint64_t>(code.bits) << _nr_bits;
+        _nr_bits += code.nr_bits;
+        if (_nr_bits >= 32) {
+            store();
+        }
+    }
+
+    /** Write zero bits up to the next byte boundary.
+     */
+    void align() noexcept
+    {
+        _nr_bits = (_nr_bits + 7) & ~7;
+        store();
+    }
+
+    /** Write the remaining bits, padded with zero bits to a byte boundary.
+     *
+     * @return One beyond the last byte written.
+     */
+    [[nodiscard]] std::byte *finish() noexcept
+    {
+        align();
+        tt_axiom(_nr_bits == 0);
+        return _ptr;
+    }
+
+private:
+    std::byte *_ptr;
+    uint64_t _buffer;
+    int _nr_bits;
+
+    void store() noexcept
+    {
+        ttlet value = native_to_little(_buffer);
+        std::memcpy(_ptr, &value, sizeof(value));
+
+        ttlet nr_bytes = _nr_bits / 8;
+        _ptr += nr_bytes;
+        _buffer = nr_bytes == 8 ? 0 : _buffer >> (nr_bytes * 8);
+        _nr_bits -= nr_bytes * 8;
+    }
+};
+
+/** The maximum size of the compressed data.
+ * A literal is at most 9 bits, a match of at least 4 bytes is at most 31 bits. Space is
+ * added for the block headers, end-of-block symbol, stored block and the bit writer.
+ */
+[[nodiscard]] static size_t deflate_bound(size_t size) noexcept
+{
+    return (size * 9 + 7) / 8 + 24;
+}
+
+constexpr int deflate_hash_bits = 14;
+constexpr ssize_t deflate_window_size = 0x8000;
+constexpr ssize_t deflate_min_match = 4;
+constexpr ssize_t deflate_max_match = 258;
+
+[[nodiscard]] static uint32_t deflate_load32(std::byte const *ptr) noexcept
+{
+    uint32_t r;
+    std::memcpy(&r, ptr, sizeof(r));
+    return r;
+}
+
+[[nodiscard]] static uint32_t deflate_hash(uint32_t value) noexcept
+{
+    return (value * 0x9e37'79b1) >> (32 - deflate_hash_bits);
+}
+
+/** The number of bytes that are equal, comparing eight bytes at a time.
+ */
+[[nodiscard]] static ssize_t deflate_match_length(std::byte const *lhs, std::byte const *rhs, ssize_t max_length) noexcept
+{
+    ssize_t length = 0;
+    for (; length + 8 <= max_length; length += 8) {
+        uint64_t lhs_value;
+        uint64_t rhs_value;
+        std::memcpy(&lhs_value, lhs + length, sizeof(lhs_value));
+        std::memcpy(&rhs_value, rhs + length, sizeof(rhs_value));
+        if (ttlet difference = little_to_native(lhs_value) ^ little_to_native(rhs_value)) {
+            return length + std::countr_zero(difference) / 8;
+        }
+    }
+    while (length < max_length && lhs[length] == rhs[length]) {
+        ++length;
+    }
+    return length;
+}
+
+void deflate(std::span<std::byte const> bytes, bstring &output, bool final) noexcept
+{
+    ttlet offset = output.size();
+    output.resize(offset + deflate_bound(bytes.size()));
+
+    auto writer = deflate_bit_writer{output.data() + offset};
+
+    // BFINAL, followed by BTYPE=01 for the fixed Huffman codes.
+    writer.put({final ? 0b011u : 0b010u, 3});
+
+    // The position + 1 of the last 4 bytes with the same hash, zero when empty.
+    auto hash_table = std::vector<uint32_t>(size_t{1} << deflate_hash_bits, 0);
+
+    ttlet *data = bytes.data();
+    ttlet size = std::ssize(bytes);
+    ssize_t i = 0;
+    while (i + deflate_min_match <= size) {
+        ttlet value = deflate_load32(data + i);
+        auto &entry = hash_table[deflate_hash(value)];
+        ttlet candidate = static_cast<ssize_t>(entry) - 1;
+        entry = narrow_cast<uint32_t>(i + 1);
+
+        if (candidate >= 0 && i - candidate <= deflate_window_size && deflate_load32(data + candidate) == value) {
+            ttlet max_length = std::min(deflate_max_match, size - i);
+            ttlet length = deflate_min_match +
+                deflate_match_length(data + candidate + deflate_min_match, data + i + deflate_min_match, max_length - deflate_min_match);
+
+            writer.put(deflate_length_codes[length]);
+            writer.put(deflate_distance_code(narrow_cast<int>(i - candidate)));
+            i += length;
+
+        } else {
+            writer.put(deflate_literal_codes[static_cast<uint8_t>(data[i])]);
+            ++i;
+        }
+    }
+    for (; i != size; ++i) {
+        writer.put(deflate_literal_codes[static_cast<uint8_t>(data[i])]);
+    }
+
+    // End-of-block.
+    writer.put(deflate_fixed_literal_code(256));
+
+    if (not final) {
+        // An empty stored block: BFINAL=0, BTYPE=00, aligned LEN=0x0000 and NLEN=0xffff.
+        writer.put({0, 3});
+        writer.align();
+        writer.put({0xffff'0000, 32});
+    }
+
+    ttlet end = writer.finish();
+    output.resize(narrow_cast<size_t>(end - output.data()));
+}
+
+[[nodiscard]] bstring deflate(std::span<std::byte const> bytes) noexcept
+{
+    auto r = bstring{};
+    deflate(bytes, r, true);
+    return r;
+}
+
+} // namespace tt
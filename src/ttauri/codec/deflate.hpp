@@ -0,0 +1,36 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../required.hpp"
+#include "../byte_string.hpp"
+#include <span>
+#include <cstddef>
+
+namespace tt {
+
+/** Compress data with the deflate algorithm.
+ *
+ * This is a fast compressor, similar to level 1 of zlib: a match is searched with a single
+ * probe of a hash table and the data is encoded as a single block with the fixed Huffman codes.
+ *
+ * A part that is not final is terminated with an empty stored block, so that it ends on a byte
+ * boundary. Parts of a deflate stream that are compressed independently, for example on
+ * multiple threads, can therefore be concatenated. Back-references never cross the start of a part.
+ *
+ * @param bytes The data to compress.
+ * @param[in,out] output The string to append the compressed data to.
+ * @param final True if this is the last part of the deflate stream.
+ */
+void deflate(std::span<std::byte const> bytes, bstring &output, bool final = true) noexcept;
+
+/** Compress data with the deflate algorithm.
+ *
+ * @param bytes The data to compress.
+ * @return The compressed data as a complete deflate stream.
+ */
+[[nodiscard]] bstring deflate(std::span<std::byte const> bytes) noexcept;
+
+} // namespace tt
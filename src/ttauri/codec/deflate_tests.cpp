@@ -0,0 +1,109 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/codec/deflate.hpp"
+#include "ttauri/codec/inflate.hpp"
+#include "ttauri/codec/zlib.hpp"
+#include "ttauri/required.hpp"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace std;
+using namespace tt;
+
+[[nodiscard]] static bstring deflate_round_trip(bstring const &original)
+{
+    ttlet compressed = deflate(original);
+
+    auto offset = ssize_t{0};
+    auto decompressed = inflate(compressed, offset);
+    EXPECT_EQ(offset, std::ssize(compressed));
+    return decompressed;
+}
+
+[[nodiscard]] static bstring random_bytes(size_t size, int nr_symbols)
+{
+    auto engine = std::mt19937{42};
+    auto distribution = std::uniform_int_distribution<int>{0, nr_symbols - 1};
+
+    auto r = bstring{};
+    for (size_t i = 0; i != size; ++i) {
+        r.push_back(static_cast<std::byte>(distribution(engine)));
+    }
+    return r;
+}
+
+TEST(Deflate, Empty)
+{
+    ASSERT_EQ(deflate_round_trip(bstring{}), bstring{});
+}
+
+TEST(Deflate, Short)
+{
+    for (size_t size = 1; size != 10; ++size) {
+        ttlet original = random_bytes(size, 256);
+        ASSERT_EQ(deflate_round_trip(original), original);
+    }
+}
+
+TEST(Deflate, Text)
+{
+    ttlet original = to_bstring(
+        "It was the best of times, it was the worst of times, it was the age of wisdom, "
+        "it was the age of foolishness, it was the epoch of belief, it was the epoch of incredulity.");
+
+    ttlet compressed = deflate(original);
+    ASSERT_LT(compressed.size(), original.size());
+
+    auto offset = ssize_t{0};
+    ASSERT_EQ(inflate(compressed, offset), original);
+}
+
+TEST(Deflate, Repeated)
+{
+    // Matches of every length, including overlapping and maximum length matches.
+    auto original = bstring{};
+    for (int length = 1; length < 600; length += 7) {
+        original.append(narrow_cast<size_t>(length), static_cast<std::byte>(length));
+    }
+
+    ttlet compressed = deflate(original);
+    ASSERT_LT(compressed.size(), original.size() / 10);
+
+    auto offset = ssize_t{0};
+    ASSERT_EQ(inflate(compressed, offset), original);
+}
+
+TEST(Deflate, Random)
+{
+    // Incompressible data, and data with many short matches at all distances.
+    ttlet incompressible = random_bytes(100'000, 256);
+    ASSERT_EQ(deflate_round_trip(incompressible), incompressible);
+
+    ttlet compressible = random_bytes(200'000, 4);
+    ASSERT_EQ(deflate_round_trip(compressible), compressible);
+}
+
+TEST(Deflate, Parts)
+{
+    ttlet original = random_bytes(100'000, 8);
+
+    // Parts that are compressed independently are concatenated into a single deflate stream.
+    auto compressed = bstring{};
+    auto bytes = std::span<std::byte const>{original};
+    deflate(bytes.subspan(0, 10'000), compressed, false);
+    deflate(bytes.subspan(10'000, 0), compressed, false);
+    deflate(bytes.subspan(10'000, 50'000), compressed, false);
+    deflate(bytes.subspan(60'000), compressed, true);
+
+    auto offset = ssize_t{0};
+    ASSERT_EQ(inflate(compressed, offset), original);
+    ASSERT_EQ(offset, std::ssize(compressed));
+}
+
+TEST(Deflate, Zlib)
+{
+    ttlet original = random_bytes(100'000, 16);
+    ASSERT_EQ(zlib_decompress(zlib_compress(original)), original);
+}
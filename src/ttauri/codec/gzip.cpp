@@ -4,8 +4,10 @@
 
 #include "gzip.hpp"
 #include "inflate.hpp"
+#include "crc32.hpp"
 #include "../endian.hpp"
 #include "../placement.hpp"
+#include <optional>
 
 namespace tt {
 
@@ -19,8 +21,19 @@ struct GZIPMemberHeader {
     uint8_t OS;
 };
 
-static bstring gzip_decompress_member(std::span<std::byte const> bytes, ssize_t &offset, ssize_t max_size)
+/** Get the size of a gzip member header.
+ *
+ * @param bytes The bytes starting at the member header.
+ * @return The size of the header, or empty when `bytes` does not contain the complete header.
+ * @throw parse_error When the header is invalid.
+ */
+[[nodiscard]] static std::optional<ssize_t> gzip_member_header_size(std::span<std::byte const> bytes)
 {
+    ssize_t offset = 0;
+
+    if (not check_placement_ptr<GZIPMemberHeader>(bytes, offset)) {
+        return {};
+    }
     ttlet header = make_placement_ptr<GZIPMemberHeader>(bytes, offset);
 
     tt_parse_check(header->ID1 == 31, "GZIP Member header ID1 must be 31");
@@ -35,6 +48,9 @@ static bstring gzip_decompress_member(std::span<std::byte const> bytes, ssize_t
     ttlet FCOMMENT = static_cast<bool>(header->FLG & 16);
 
     if (FEXTRA) {
+        if (not check_placement_ptr<little_uint16_buf_t>(bytes, offset)) {
+            return {};
+        }
         ttlet XLEN = make_placement_ptr<little_uint16_buf_t>(bytes, offset);
         offset += XLEN->value();
     }
@@ -42,7 +58,9 @@ static bstring gzip_decompress_member(std::span<std::byte const> bytes, ssize_t
     if (FNAME) {
         std::byte c;
         do {
-            tt_parse_check(offset < std::ssize(bytes), "GZIP Member header FNAME reading beyond end of buffer");
+            if (offset >= std::ssize(bytes)) {
+                return {};
+            }
             c = bytes[offset++];
         } while (c != std::byte{0});
     }
@@ -50,19 +68,36 @@ static bstring gzip_decompress_member(std::span<std::byte const> bytes, ssize_t
     if (FCOMMENT) {
         std::byte c;
         do {
-            tt_parse_check(offset < std::ssize(bytes), "GZIP Member header FCOMMENT reading beyond end of buffer");
+            if (offset >= std::ssize(bytes)) {
+                return {};
+            }
             c = bytes[offset++];
         } while (c != std::byte{0});
     }
 
     if (FHCRC) {
-        [[maybe_unused]] ttlet CRC16 = make_placement_ptr<little_uint16_buf_t>(bytes, offset);
+        // CRC16
+        offset += 2;
     }
 
+    if (offset > std::ssize(bytes)) {
+        return {};
+    }
+    return offset;
+}
+
+static bstring gzip_decompress_member(std::span<std::byte const> bytes, ssize_t &offset, ssize_t max_size)
+{
+    ttlet header_size = gzip_member_header_size(bytes.subspan(offset));
+    tt_parse_check(header_size, "GZIP Member header is truncated");
+    offset += *header_size;
+
     auto r = inflate(bytes, offset, max_size);
 
-    [[maybe_unused]] auto CRC32 = make_placement_ptr<little_uint32_buf_t>(bytes, offset);
-    [[maybe_unused]] auto ISIZE = make_placement_ptr<little_uint32_buf_t>(bytes, offset);
+    ttlet CRC32 = make_placement_ptr<little_uint32_buf_t>(bytes, offset);
+    ttlet ISIZE = make_placement_ptr<little_uint32_buf_t>(bytes, offset);
+
+    tt_parse_check(CRC32->value() == crc32(r), "GZIP Member CRC32 does not match the inflated data.");
 
     tt_parse_check(
         ISIZE->value() == (size(r) & 0xffffffff),
@@ -70,6 +105,82 @@ static bstring gzip_decompress_member(std::span<std::byte const> bytes, ssize_t
     return r;
 }
 
+void gzip_stream::write(std::span<std::byte const> bytes) noexcept
+{
+    if (_in_member) {
+        _inflate.write(bytes);
+    } else {
+        _header.append(bytes.data(), bytes.size());
+    }
+}
+
+void gzip_stream::close() noexcept
+{
+    _closed = true;
+    if (_in_member) {
+        _inflate.close();
+    }
+}
+
+[[nodiscard]] ssize_t gzip_stream::read(std::span<std::byte> output)
+{
+    auto n = ssize_t{0};
+
+    while (true) {
+        if (not _in_member) {
+            if (_header.empty()) {
+                return n;
+            }
+
+            ttlet header_size = gzip_member_header_size(_header);
+            if (not header_size) {
+                tt_parse_check(not _closed, "GZIP Member header is truncated");
+                return n;
+            }
+
+            _inflate = inflate_stream{};
+            _inflate.write(std::span<std::byte const>{_header}.subspan(narrow_cast<size_t>(*header_size)));
+            if (_closed) {
+                _inflate.close();
+            }
+            _header.clear();
+            _in_member = true;
+            _member_size = 0;
+            _member_crc = 0;
+        }
+
+        ttlet member_n = _inflate.read(output.subspan(narrow_cast<size_t>(n)));
+        _member_crc = crc32(output.subspan(narrow_cast<size_t>(n), narrow_cast<size_t>(member_n)), _member_crc);
+        n += member_n;
+        _member_size += narrow_cast<uint32_t>(member_n & 0xffffffff);
+        if (not _inflate.done()) {
+            return n;
+        }
+
+        ttlet trailer = _inflate.remaining_input();
+        if (std::ssize(trailer) < 8) {
+            tt_parse_check(not _closed, "GZIP Member trailer is truncated");
+            return n;
+        }
+
+        ttlet CRC32 = make_placement_ptr<little_uint32_buf_t>(trailer, 0);
+        ttlet ISIZE = make_placement_ptr<little_uint32_buf_t>(trailer, 4);
+        tt_parse_check(CRC32->value() == _member_crc, "GZIP Member CRC32 does not match the inflated data.");
+        tt_parse_check(
+            ISIZE->value() == _member_size,
+            "GZIP Member header ISIZE must be same as the lower 32 bits of the inflated size.");
+
+        // The next member starts directly after the trailer.
+        _header.assign(trailer.data() + 8, trailer.size() - 8);
+        _in_member = false;
+    }
+}
+
+[[nodiscard]] bool gzip_stream::done() const noexcept
+{
+    return _closed && not _in_member && _header.empty();
+}
+
 bstring gzip_decompress(std::span<std::byte const> bytes, ssize_t max_size)
 {
     auto r = bstring{};
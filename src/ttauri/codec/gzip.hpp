@@ -7,10 +7,55 @@
 #include "../URL.hpp"
 #include "../byte_string.hpp"
 #include "../resource_view.hpp"
+#include "inflate.hpp"
 #include <cstddef>
+#include <cstdint>
 
 namespace tt {
 
+/** A resumable decoder for data in the gzip format.
+ * The data may consist of multiple gzip members.
+ * @see inflate_stream
+ */
+class gzip_stream {
+public:
+    /** Add compressed data.
+     */
+    void write(std::span<std::byte const> bytes) noexcept;
+
+    /** Mark the end of the compressed data.
+     */
+    void close() noexcept;
+
+    /** Decompress data.
+     *
+     * @param output The buffer to decompress into.
+     * @return The number of bytes written into `output`.
+     * @throw parse_error When the compressed data is invalid, or truncated after `close()`.
+     */
+    [[nodiscard]] ssize_t read(std::span<std::byte> output);
+
+    /** The end of the last member has been reached after `close()`.
+     */
+    [[nodiscard]] bool done() const noexcept;
+
+private:
+    /** The bytes of the next member, until its header is complete.
+     */
+    bstring _header;
+    bool _in_member = false;
+    bool _closed = false;
+    inflate_stream _inflate;
+
+    /** The lower 32 bits of the size of the decompressed member.
+     */
+    uint32_t _member_size = 0;
+
+    /** The CRC-32 of the decompressed member.
+     */
+    uint32_t _member_crc = 0;
+};
+
 bstring gzip_decompress(std::span<std::byte const> bytes, ssize_t max_size=0x01000000);
 
 inline bstring gzip_decompress(URL const &url, ssize_t max_size=0x01000000) {
@@ -0,0 +1,26 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/codec/gzip.hpp"
+#include "ttauri/file_view.hpp"
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+using namespace std;
+using namespace tt;
+
+static void gzip_decompress_file(benchmark::State &state)
+{
+    ttlet view = file_view(URL(fmt::format("file:gzip_test{}.bin.gz", state.range(0))));
+    ttlet bytes = view.bytes();
+
+    auto nr_bytes = int64_t{0};
+    for (auto _ : state) {
+        ttlet decompressed = gzip_decompress(bytes);
+        nr_bytes += std::ssize(decompressed);
+        benchmark::DoNotOptimize(decompressed.data());
+    }
+    state.SetBytesProcessed(nr_bytes);
+}
+BENCHMARK(gzip_decompress_file)->Arg(3)->Arg(4)->Arg(7);
@@ -116,3 +116,60 @@ TEST(GZip, UnzipXargs1) {
         ASSERT_EQ(decompressed[i], original_bytes[i]);
     }
 }
+
+TEST(GZip, StreamSmallChunks) {
+    ttlet compressed = file_view(URL("file:gzip_test7.bin.gz"));
+    ttlet compressed_bytes = compressed.bytes();
+    ttlet original = file_view(URL("file:gzip_test7.bin"));
+    ttlet original_bytes = original.bytes();
+
+    // Feed the compressed data in small chunks and read into a small buffer,
+    // so that decoding is suspended inside headers, symbols and back-references.
+    auto stream = gzip_stream{};
+    auto buffer = std::array<std::byte, 100>{};
+    auto decompressed = bstring{};
+    for (ssize_t i = 0; i < std::ssize(compressed_bytes); i += 7) {
+        stream.write(compressed_bytes.subspan(i, std::min(ssize_t{7}, std::ssize(compressed_bytes) - i)));
+        while (ttlet n = stream.read(buffer)) {
+            decompressed.append(buffer.data(), n);
+        }
+    }
+    stream.close();
+    while (not stream.done()) {
+        ttlet n = stream.read(buffer);
+        decompressed.append(buffer.data(), n);
+    }
+
+    ASSERT_EQ(std::ssize(decompressed), std::ssize(original_bytes));
+    for (ssize_t i = 0; i != std::ssize(decompressed); ++i) {
+        ASSERT_EQ(decompressed[i], original_bytes[i]);
+    }
+}
+
+TEST(GZip, StreamTruncated) {
+    ttlet compressed = file_view(URL("file:gzip_test7.bin.gz"));
+    ttlet compressed_bytes = compressed.bytes();
+
+    auto stream = gzip_stream{};
+    auto buffer = std::array<std::byte, 1024>{};
+    stream.write(compressed_bytes.first(std::ssize(compressed_bytes) / 2));
+    while (stream.read(buffer)) {}
+
+    stream.close();
+    ASSERT_THROW(while (not stream.done()) { (void)stream.read(buffer); }, parse_error);
+}
+
+TEST(GZip, CorruptCRC32) {
+    ttlet compressed = file_view(URL("file:gzip_test7.bin.gz"));
+    auto compressed_bytes = bstring{compressed.bytes().data(), compressed.bytes().size()};
+
+    // The CRC32 is the first field of the trailer, before the ISIZE.
+    compressed_bytes[compressed_bytes.size() - 8] ^= std::byte{1};
+    ASSERT_THROW(gzip_decompress(compressed_bytes), parse_error);
+
+    auto stream = gzip_stream{};
+    auto buffer = std::array<std::byte, 1024>{};
+    stream.write(compressed_bytes);
+    stream.close();
+    ASSERT_THROW(while (not stream.done()) { (void)stream.read(buffer); }, parse_error);
+}
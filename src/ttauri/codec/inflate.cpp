@@ -1,32 +1,18 @@
-// Copyright Take Vos 2020.
+// Copyright Take Vos 2020-2021.
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #include "inflate.hpp"
 #include "../bits.hpp"
-#include "../placement.hpp"
 #include "../huffman.hpp"
 #include <array>
+#include <algorithm>
+#include <cstring>
 
 namespace tt {
 
-static void inflate_copy_block(std::span<std::byte const> bytes, ssize_t &bit_offset, ssize_t max_size, bstring &r)
-{
-    auto offset = (bit_offset + 7) / 8;
-
-    auto LEN = make_placement_ptr<little_uint16_buf_t>(bytes, offset);
-    [[maybe_unused]] auto NLEN = make_placement_ptr<little_uint16_buf_t>(bytes, offset);
-
-    tt_parse_check((offset + LEN->value()) <= std::ssize(bytes), "input buffer overrun");
-    tt_parse_check((std::ssize(r) + LEN->value()) <= max_size, "output buffer overrun");
-    r.append(&bytes[offset], LEN->value());
-
-    bit_offset = offset * 8;
-}
-
 [[nodiscard]] static int inflate_decode_length(
-    std::span<std::byte const> bytes,
-    ssize_t &bit_offset,
+    bit_reader &reader,
     int symbol)
 {
     switch (symbol) {
@@ -38,26 +24,26 @@ static void inflate_copy_block(std::span<std::byte const> bytes, ssize_t &bit_of
     case 262: return 8;
     case 263: return 9;
     case 264: return 10;
-    case 265: return get_bits(bytes, bit_offset, 1) + 11;
-    case 266: return get_bits(bytes, bit_offset, 1) + 13;
-    case 267: return get_bits(bytes, bit_offset, 1) + 15;
-    case 268: return get_bits(bytes, bit_offset, 1) + 17;
-    case 269: return get_bits(bytes, bit_offset, 2) + 19;
-    case 270: return get_bits(bytes, bit_offset, 2) + 23;
-    case 271: return get_bits(bytes, bit_offset, 2) + 27;
-    case 272: return get_bits(bytes, bit_offset, 2) + 31;
-    case 273: return get_bits(bytes, bit_offset, 3) + 35;
-    case 274: return get_bits(bytes, bit_offset, 3) + 43;
-    case 275: return get_bits(bytes, bit_offset, 3) + 51;
-    case 276: return get_bits(bytes, bit_offset, 3) + 59;
-    case 277: return get_bits(bytes, bit_offset, 4) + 67;
-    case 278: return get_bits(bytes, bit_offset, 4) + 83;
-    case 279: return get_bits(bytes, bit_offset, 4) + 99;
-    case 280: return get_bits(bytes, bit_offset, 4) + 115;
-    case 281: return get_bits(bytes, bit_offset, 5) + 131;
-    case 282: return get_bits(bytes, bit_offset, 5) + 163;
-    case 283: return get_bits(bytes, bit_offset, 5) + 195;
-    case 284: return get_bits(bytes, bit_offset, 5) + 227;
+    case 265: return reader.get(1) + 11;
+    case 266: return reader.get(1) + 13;
+    case 267: return reader.get(1) + 15;
+    case 268: return reader.get(1) + 17;
+    case 269: return reader.get(2) + 19;
+    case 270: return reader.get(2) + 23;
+    case 271: return reader.get(2) + 27;
+    case 272: return reader.get(2) + 31;
+    case 273: return reader.get(3) + 35;
+    case 274: return reader.get(3) + 43;
+    case 275: return reader.get(3) + 51;
+    case 276: return reader.get(3) + 59;
+    case 277: return reader.get(4) + 67;
+    case 278: return reader.get(4) + 83;
+    case 279: return reader.get(4) + 99;
+    case 280: return reader.get(4) + 115;
+    case 281: return reader.get(5) + 131;
+    case 282: return reader.get(5) + 163;
+    case 283: return reader.get(5) + 195;
+    case 284: return reader.get(5) + 227;
     case 285: return 258;
     default:
         throw parse_error("Literal/Length symbol out of range {}", symbol);
@@ -65,8 +51,7 @@ static void inflate_copy_block(std::span<std::byte const> bytes, ssize_t &bit_of
 }
 
 [[nodiscard]] static int inflate_decode_distance(
-    std::span<std::byte const> bytes,
-    ssize_t &bit_offset,
+    bit_reader &reader,
     int symbol)
 {
     switch (symbol) {
@@ -74,88 +59,38 @@ static void inflate_copy_block(std::span<std::byte const> bytes, ssize_t &bit_of
     case 1: return 2;
     case 2: return 3;
     case 3: return 4;
-    case 4: return get_bits(bytes, bit_offset, 1) + 5;
-    case 5: return get_bits(bytes, bit_offset, 1) + 7;
-    case 6: return get_bits(bytes, bit_offset, 2) + 9;
-    case 7: return get_bits(bytes, bit_offset, 2) + 13;
-    case 8: return get_bits(bytes, bit_offset, 3) + 17;
-    case 9: return get_bits(bytes, bit_offset, 3) + 25;
-    case 10: return get_bits(bytes, bit_offset, 4) + 33;
-    case 11: return get_bits(bytes, bit_offset, 4) + 49;
-    case 12: return get_bits(bytes, bit_offset, 5) + 65;
-    case 13: return get_bits(bytes, bit_offset, 5) + 97;
-    case 14: return get_bits(bytes, bit_offset, 6) + 129;
-    case 15: return get_bits(bytes, bit_offset, 6) + 193;
-    case 16: return get_bits(bytes, bit_offset, 7) + 257;
-    case 17: return get_bits(bytes, bit_offset, 7) + 385;
-    case 18: return get_bits(bytes, bit_offset, 8) + 513;
-    case 19: return get_bits(bytes, bit_offset, 8) + 769;
-    case 20: return get_bits(bytes, bit_offset, 9) + 1025;
-    case 21: return get_bits(bytes, bit_offset, 9) + 1537;
-    case 22: return get_bits(bytes, bit_offset, 10) + 2049;
-    case 23: return get_bits(bytes, bit_offset, 10) + 3073;
-    case 24: return get_bits(bytes, bit_offset, 11) + 4097;
-    case 25: return get_bits(bytes, bit_offset, 11) + 6145;
-    case 26: return get_bits(bytes, bit_offset, 12) + 8193;
-    case 27: return get_bits(bytes, bit_offset, 12) + 12289;
-    case 28: return get_bits(bytes, bit_offset, 13) + 16385;
-    case 29: return get_bits(bytes, bit_offset, 13) + 24577;
+    case 4: return reader.get(1) + 5;
+    case 5: return reader.get(1) + 7;
+    case 6: return reader.get(2) + 9;
+    case 7: return reader.get(2) + 13;
+    case 8: return reader.get(3) + 17;
+    case 9: return reader.get(3) + 25;
+    case 10: return reader.get(4) + 33;
+    case 11: return reader.get(4) + 49;
+    case 12: return reader.get(5) + 65;
+    case 13: return reader.get(5) + 97;
+    case 14: return reader.get(6) + 129;
+    case 15: return reader.get(6) + 193;
+    case 16: return reader.get(7) + 257;
+    case 17: return reader.get(7) + 385;
+    case 18: return reader.get(8) + 513;
+    case 19: return reader.get(8) + 769;
+    case 20: return reader.get(9) + 1025;
+    case 21: return reader.get(9) + 1537;
+    case 22: return reader.get(10) + 2049;
+    case 23: return reader.get(10) + 3073;
+    case 24: return reader.get(11) + 4097;
+    case 25: return reader.get(11) + 6145;
+    case 26: return reader.get(12) + 8193;
+    case 27: return reader.get(12) + 12289;
+    case 28: return reader.get(13) + 16385;
+    case 29: return reader.get(13) + 24577;
     default:
         throw parse_error("Distance symbol out of range {}", symbol);
     }
 }
 
-static void inflate_block(
-    std::span<std::byte const> bytes,
-    ssize_t &bit_offset,
-    ssize_t max_size,
-    huffman_tree<int16_t> const &literal_tree,
-    huffman_tree<int16_t> const &distance_tree,
-    bstring &r)
-{
-    while (true) {
-        // Test only every get_symbol, the trailer is at least 32 bits (Checksum)
-        // - 15 bits maximum huffman code.
-        // -  5 bits extra length.
-        // -  7 bits rounding up to byte.
-        tt_parse_check(((bit_offset + 27) >> 3) <= std::ssize(bytes), "Input buffer overrun");
-
-        auto literal_symbol = literal_tree.get_symbol(bytes, bit_offset);
-
-        if (literal_symbol <= 255) {
-            tt_parse_check(std::ssize(r) < max_size, "Output buffer overrun");
-            r.push_back(static_cast<std::byte>(literal_symbol));
-
-        } else if (literal_symbol == 256) {
-            // End-of-block.
-            return;
-
-        } else {
-            auto length = inflate_decode_length(bytes, bit_offset, literal_symbol);
-            tt_parse_check(std::ssize(r) + length <= max_size, "Output buffer overrun");
-
-            // Test only every get_symbol, the trailer is at least 32 bits (Checksum)
-            // - 15 bits maximum huffman code.
-            // -  7 bits rounding up to byte.
-            tt_parse_check(((bit_offset + 22) >> 3) <= std::ssize(bytes), "Input buffer overrun");
-            auto distance_symbol = distance_tree.get_symbol(bytes, bit_offset);
-
-            // Test only every inflate_decode_distance, the trailer is at least 32 bits (Checksum)
-            // - 13 bits extra length.
-            // -  7 bits rounding up to byte.
-            tt_parse_check(((bit_offset + 20) >> 3) <= std::ssize(bytes), "Input buffer overrun");
-            auto distance = inflate_decode_distance(bytes, bit_offset, distance_symbol);
-
-            tt_parse_check(distance <= std::ssize(r), "Distance beyond start of decompressed data");
-            auto src_i = std::ssize(r) - distance;
-            for (auto i = 0; i != length; ++i) {
-                r.push_back(r[src_i++]);
-            }
-        }
-    }
-}
-
-huffman_tree<int16_t> deflate_fixed_literal_tree = []() {
+static huffman_table const deflate_fixed_literal_table = []() {
     std::vector<int> lengths;
 
     for (int i = 0; i <= 143; ++i) {
@@ -171,76 +106,61 @@ huffman_tree<int16_t> deflate_fixed_literal_tree = []() {
         lengths.push_back(8);
     }
 
-    return huffman_tree<int16_t>::from_lengths(lengths);
+    return huffman_table::from_lengths(lengths);
 }();
 
-huffman_tree<int16_t> deflate_fixed_distance_tree = []() {
+static huffman_table const deflate_fixed_distance_table = []() {
     std::vector<int> lengths;
 
     for (int i = 0; i <= 31; ++i) {
         lengths.push_back(5);
     }
 
-    return huffman_tree<int16_t>::from_lengths(lengths);
+    return huffman_table::from_lengths(lengths);
 }();
 
-
-
-static void inflate_fixed_block(std::span<std::byte const> bytes, ssize_t &bit_offset, ssize_t max_size, bstring &r)
-{
-    inflate_block(bytes, bit_offset, max_size, deflate_fixed_literal_tree, deflate_fixed_distance_tree, r);
-}
-
-[[nodiscard]] static huffman_tree<int16_t> inflate_code_lengths(std::span<std::byte const> bytes, ssize_t &bit_offset, int nr_symbols)
+[[nodiscard]] static huffman_table inflate_code_lengths(bit_reader &reader, int nr_symbols)
 {
     // The symbols are in different order in the table.
     constexpr auto symbols = std::array{
         16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
     };
 
-    tt_parse_check(((bit_offset + (3 * static_cast<ssize_t>(nr_symbols)) + 7) >> 3) <= std::ssize(bytes), "Input buffer overrun");
-
     auto lengths = std::vector<int>(std::ssize(symbols), 0);
     for (int i = 0; i != nr_symbols; ++i) {
         ttlet symbol = symbols[i];
-        lengths[symbol] = get_bits(bytes, bit_offset, 3);
+        lengths[symbol] = reader.get(3);
     }
-    return huffman_tree<int16_t>::from_lengths(std::move(lengths));
+    return huffman_table::from_lengths(std::move(lengths));
 }
 
-std::vector<int> inflate_lengths(
-    std::span<std::byte const> bytes,
-    ssize_t &bit_offset,
+[[nodiscard]] static std::vector<int> inflate_lengths(
+    bit_reader &reader,
     int nr_symbols,
-    huffman_tree<int16_t> const &code_length_tree)
+    huffman_table const &code_length_table)
 {
     auto r = std::vector<int>{};
     r.reserve(nr_symbols);
 
     auto prev_length = 0;
     while (std::ssize(r) < nr_symbols) {
-        // Test only every get_symbol, the trailer is at least 32 bits (Checksum)
-        // -  7 bits maximum huffman code.
-        // -  7 bits extra length.
-        // -  7 bits rounding up to byte.
-        tt_parse_check(((bit_offset + 21) >> 3) <= std::ssize(bytes), "Input buffer overrun");
-        auto symbol = code_length_tree.get_symbol(bytes, bit_offset);
+        auto symbol = code_length_table.get_symbol(reader);
 
         switch (symbol) {
         case 16: {
-                auto copy_length = get_bits(bytes, bit_offset, 2) + 3;
+                auto copy_length = reader.get(2) + 3;
                 while (copy_length--) {
                     r.push_back(prev_length);
                 }
             } break;
         case 17: {
-                auto copy_length = get_bits(bytes, bit_offset, 3) + 3;
+                auto copy_length = reader.get(3) + 3;
                 while (copy_length--) {
                     r.push_back(0);
                 }
             } break;
         case 18: {
-                auto copy_length = get_bits(bytes, bit_offset, 7) + 11;
+                auto copy_length = reader.get(7) + 11;
                 while (copy_length--) {
                     r.push_back(0);
                 }
@@ -253,62 +173,283 @@ std::vector<int> inflate_lengths(
     return r;
 }
 
-void inflate_dynamic_block(std::span<std::byte const> bytes, ssize_t &bit_offset, ssize_t max_size, bstring &r)
+inflate_stream::inflate_stream() noexcept :
+    _state(state_type::block_header),
+    _closed(false),
+    _final_block(false),
+    _input(),
+    _bit_offset(0),
+    _stored_size(0),
+    _literal_table(),
+    _distance_table(),
+    _fixed_tables(false),
+    _copy_length(0),
+    _copy_distance(0),
+    _window(window_size, std::byte{0}),
+    _total_out(0)
 {
-    // Test all lengths, the trailer is at least 32 bits (Checksum)
-    // - 14 bits lengths
-    // -  7 bits rounding up to byte.
-    tt_parse_check(((bit_offset + 21) >> 3) <= std::ssize(bytes), "Input buffer overrun");
-    ttlet HLIT = get_bits(bytes, bit_offset, 5);
-    ttlet HDIST = get_bits(bytes, bit_offset, 5);
-    ttlet HCLEN = get_bits(bytes, bit_offset, 4);
+}
 
-    ttlet code_length_tree = inflate_code_lengths(bytes, bit_offset, HCLEN + 4);
+void inflate_stream::write(std::span<std::byte const> bytes) noexcept
+{
+    // Discard the compressed data that was already decoded.
+    ttlet consumed = _bit_offset / 8;
+    _input.erase(0, narrow_cast<size_t>(consumed));
+    _bit_offset -= consumed * 8;
 
-    ttlet lengths = inflate_lengths(bytes, bit_offset, HLIT + HDIST + 258, code_length_tree);
-    tt_parse_check(lengths[256] != 0, "The end-of-block symbol must be in the table");
+    _input.append(bytes.data(), bytes.size());
+}
 
-    ttlet lengths_ptr = lengths.data();
-    ttlet literal_tree = huffman_tree<int16_t>::from_lengths(lengths_ptr, HLIT + 257);
-    ttlet distance_tree = huffman_tree<int16_t>::from_lengths(&lengths_ptr[HLIT + 257], HDIST + 1);
+void inflate_stream::close() noexcept
+{
+    _closed = true;
+}
 
-    inflate_block(bytes, bit_offset, max_size, literal_tree, distance_tree, r);
+[[nodiscard]] std::span<std::byte const> inflate_stream::remaining_input() const noexcept
+{
+    ttlet offset = std::min((_bit_offset + 7) / 8, std::ssize(_input));
+    return std::span<std::byte const>{_input.data() + offset, _input.size() - narrow_cast<size_t>(offset)};
 }
 
-bstring inflate(std::span<std::byte const> bytes, ssize_t &offset, ssize_t max_size)
+[[nodiscard]] bool inflate_stream::need_more_input(bit_reader const &reader) const
 {
-    ssize_t bit_offset = offset * 8;
+    if (reader.bit_offset() <= available_bits()) {
+        return false;
+    }
 
-    auto r = bstring{};
+    tt_parse_check(not _closed, "Unexpected end of compressed data");
+    return true;
+}
 
-    bool BFINAL;
-    do {
-        // Test all lengths, the trailer is at least 32 bits (Checksum)
-        // - 3 bits header
-        // - 7 bits rounding up to byte.
-        tt_parse_check(((bit_offset + 10) >> 3) <= std::ssize(bytes), "Input buffer overrun");
+[[nodiscard]] bool inflate_stream::need_more_input(bit_reader const &reader, parse_error const &e) const
+{
+    // The error may be caused by the zero bits that are read beyond the compressed data;
+    // a symbol is decoded by looking at up to 15 bits ahead.
+    if (_closed || reader.bit_offset() + huffman_table::max_code_length <= available_bits()) {
+        throw e;
+    }
+    return true;
+}
+
+[[nodiscard]] bool inflate_stream::decode_block_header()
+{
+    auto reader = bit_reader(_input, _bit_offset);
 
-        BFINAL = get_bits(bytes, bit_offset, 1);
-        ttlet BTYPE = get_bits(bytes, bit_offset, 2);
+    try {
+        _final_block = static_cast<bool>(reader.get(1));
+        ttlet BTYPE = reader.get(2);
 
         switch (BTYPE) {
-        case 0:
-            inflate_copy_block(bytes, bit_offset, max_size - std::ssize(r), r);
-            break;
+        case 0: {
+            reader.align();
+            ttlet LEN = reader.get(16);
+            ttlet NLEN = reader.get(16);
+            if (need_more_input(reader)) {
+                return false;
+            }
+            tt_parse_check(LEN == (~NLEN & 0xffff), "Stored block length does not match its complement");
+            _stored_size = LEN;
+            _state = state_type::stored_block;
+        } break;
+
         case 1:
-            inflate_fixed_block(bytes, bit_offset, max_size - std::ssize(r), r);
-            break;
-        case 2:
-            inflate_dynamic_block(bytes, bit_offset, max_size - std::ssize(r), r);
+            if (need_more_input(reader)) {
+                return false;
+            }
+            _fixed_tables = true;
+            _state = state_type::huffman_block;
             break;
+
+        case 2: {
+            ttlet HLIT = reader.get(5);
+            ttlet HDIST = reader.get(5);
+            ttlet HCLEN = reader.get(4);
+
+            ttlet code_length_table = inflate_code_lengths(reader, HCLEN + 4);
+
+            ttlet lengths = inflate_lengths(reader, HLIT + HDIST + 258, code_length_table);
+            tt_parse_check(lengths[256] != 0, "The end-of-block symbol must be in the table");
+
+            ttlet lengths_ptr = lengths.data();
+            auto literal_table = huffman_table::from_lengths(lengths_ptr, HLIT + 257);
+            auto distance_table = huffman_table::from_lengths(&lengths_ptr[HLIT + 257], HDIST + 1, 8);
+
+            if (need_more_input(reader)) {
+                return false;
+            }
+            _literal_table = std::move(literal_table);
+            _distance_table = std::move(distance_table);
+            _fixed_tables = false;
+            _state = state_type::huffman_block;
+        } break;
+
         default:
+            if (need_more_input(reader)) {
+                return false;
+            }
             throw parse_error("Reserved block type");
         }
 
-    } while (!BFINAL);
+    } catch (parse_error const &e) {
+        if (need_more_input(reader, e)) {
+            return false;
+        }
+    }
+
+    _bit_offset = reader.bit_offset();
+    return true;
+}
+
+[[nodiscard]] bool inflate_stream::decode_stored_block(std::span<std::byte> output, ssize_t &n)
+{
+    if (_stored_size == 0) {
+        _state = _final_block ? state_type::done : state_type::block_header;
+        return true;
+    }
+
+    tt_axiom(_bit_offset % 8 == 0);
+    ttlet offset = _bit_offset / 8;
+    ttlet size = std::min({_stored_size, std::ssize(_input) - offset, std::ssize(output) - n});
+    if (size == 0) {
+        tt_parse_check(not _closed || offset < std::ssize(_input), "Unexpected end of compressed data");
+        return false;
+    }
+
+    std::memcpy(output.data() + n, _input.data() + offset, narrow_cast<size_t>(size));
+    n += size;
+    _bit_offset += size * 8;
+    _stored_size -= size;
+    return true;
+}
+
+[[nodiscard]] bool inflate_stream::decode_huffman_block(std::span<std::byte> output, ssize_t &n)
+{
+    ttlet &literal_table = _fixed_tables ? deflate_fixed_literal_table : _literal_table;
+    ttlet &distance_table = _fixed_tables ? deflate_fixed_distance_table : _distance_table;
+
+    auto reader = bit_reader(_input, _bit_offset);
+
+    try {
+        while (true) {
+            // Rewind to the start of the symbol when it is incomplete, or when there is no room for a literal.
+            _bit_offset = reader.bit_offset();
+
+            ttlet literal_symbol = literal_table.get_symbol(reader);
+
+            if (literal_symbol <= 255) {
+                if (n == std::ssize(output) || need_more_input(reader)) {
+                    return false;
+                }
+                output[n++] = static_cast<std::byte>(literal_symbol);
+
+            } else if (literal_symbol == 256) {
+                // End-of-block.
+                if (need_more_input(reader)) {
+                    return false;
+                }
+                _bit_offset = reader.bit_offset();
+                _state = _final_block ? state_type::done : state_type::block_header;
+                return true;
+
+            } else {
+                ttlet length = inflate_decode_length(reader, literal_symbol);
+                ttlet distance_symbol = distance_table.get_symbol(reader);
+                ttlet distance = inflate_decode_distance(reader, distance_symbol);
+                if (need_more_input(reader)) {
+                    return false;
+                }
+
+                tt_parse_check(
+                    distance <= std::min(_total_out + n, window_size), "Distance beyond start of decompressed data");
+                _bit_offset = reader.bit_offset();
+                _copy_length = length;
+                _copy_distance = distance;
+                return true;
+            }
+        }
+
+    } catch (parse_error const &e) {
+        return not need_more_input(reader, e);
+    }
+}
+
+void inflate_stream::decode_copy(std::span<std::byte> output, ssize_t &n) noexcept
+{
+    auto size = std::min(_copy_length, std::ssize(output) - n);
+    _copy_length -= size;
+
+    // Copy from before the start of the output from the window.
+    for (; size != 0 && _copy_distance > n; --size, ++n) {
+        output[n] = _window[(_total_out + n - _copy_distance) & (window_size - 1)];
+    }
+
+    // The source and destination may overlap, so that a short sequence is repeated.
+    auto *dst = output.data() + n;
+    auto const *src = dst - _copy_distance;
+    for (; size != 0; --size, ++n) {
+        *dst++ = *src++;
+    }
+}
+
+void inflate_stream::update_window(std::span<std::byte const> output) noexcept
+{
+    ttlet size = std::min(std::ssize(output), window_size);
+    for (auto i = std::ssize(output) - size; i != std::ssize(output); ++i) {
+        _window[(_total_out + i) & (window_size - 1)] = output[i];
+    }
+    _total_out += std::ssize(output);
+}
+
+[[nodiscard]] bool inflate_stream::decode(std::span<std::byte> output, ssize_t &n)
+{
+    if (_copy_length != 0) {
+        decode_copy(output, n);
+        if (_copy_length != 0) {
+            return false;
+        }
+    }
+
+    switch (_state) {
+    case state_type::block_header: return decode_block_header();
+    case state_type::stored_block: return decode_stored_block(output, n);
+    case state_type::huffman_block: return decode_huffman_block(output, n);
+    case state_type::done: return false;
+    default: tt_no_default();
+    }
+}
 
-    offset = (bit_offset + 7) / 8;
+[[nodiscard]] ssize_t inflate_stream::read(std::span<std::byte> output)
+{
+    auto n = ssize_t{0};
+    while (decode(output, n)) {}
+
+    update_window(output.first(n));
+    return n;
+}
+
+bstring inflate(std::span<std::byte const> bytes, ssize_t &offset, ssize_t max_size)
+{
+    auto stream = inflate_stream{};
+    stream.write(bytes.subspan(offset));
+    stream.close();
+
+    auto r = bstring{};
+    r.resize(narrow_cast<size_t>(std::min(max_size, std::max(ssize_t{0x1000}, std::ssize(bytes) * 4))));
+
+    auto n = ssize_t{0};
+    while (true) {
+        n += stream.read(std::span{r.data() + n, r.size() - narrow_cast<size_t>(n)});
+        if (stream.done()) {
+            break;
+        }
+
+        tt_parse_check(n < max_size, "Output buffer overrun");
+        r.resize(narrow_cast<size_t>(std::min(max_size, std::ssize(r) * 2)));
+    }
+    r.resize(narrow_cast<size_t>(n));
+
+    offset = std::ssize(bytes) - std::ssize(stream.remaining_input());
     return r;
 }
 
-}
\ No newline at end of file
+}
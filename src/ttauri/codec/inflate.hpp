@@ -1,4 +1,4 @@
-// Copyright Take Vos 2020.
+// Copyright Take Vos 2020-2021.
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
@@ -7,23 +7,146 @@
 #include "../required.hpp"
 #include "../byte_string.hpp"
 #include "../endian.hpp"
+#include "../huffman.hpp"
 #include <span>
 
 namespace tt {
 
-/** Inflate compressed data using the deflate algorithm
- * `bytes` should include at least 32 bit of trailer, for the overflow check which
- * will slightly overrun the actual compressed data for performance reasons.
+/** A resumable decoder for data compressed with the deflate algorithm.
+ *
+ * Compressed data is added in chunks with `write()` and the decompressed
+ * data is retrieved in chunks with `read()`. Only the last 32 KiB of decompressed
+ * data is retained, which is the maximum distance a deflate stream refers back to.
+ *
+ * Example:
+ * ```
+ * auto stream = inflate_stream{};
+ * while (ttlet chunk = receive()) {
+ *     stream.write(chunk);
+ *     while (ttlet n = stream.read(buffer)) {
+ *         process(buffer.first(n));
+ *     }
+ * }
+ * stream.close();
+ * while (not stream.done()) {
+ *     ttlet n = stream.read(buffer);
+ *     process(buffer.first(n));
+ * }
+ * ```
+ */
+class inflate_stream {
+public:
+    inflate_stream() noexcept;
+    inflate_stream(inflate_stream const &) noexcept = default;
+    inflate_stream(inflate_stream &&) noexcept = default;
+    inflate_stream &operator=(inflate_stream const &) noexcept = default;
+    inflate_stream &operator=(inflate_stream &&) noexcept = default;
+    ~inflate_stream() = default;
+
+    /** Add compressed data.
+     */
+    void write(std::span<std::byte const> bytes) noexcept;
+
+    /** Mark the end of the compressed data.
+     * After this call running out of compressed data is an error.
+     */
+    void close() noexcept;
+
+    /** Decompress data.
+     *
+     * @param output The buffer to decompress into.
+     * @return The number of bytes written into `output`. Fewer bytes than the size of
+     *         `output` are returned when more compressed data needs to be written, or
+     *         when the end of the stream is reached.
+     * @throw parse_error When the compressed data is invalid, or truncated after `close()`.
+     */
+    [[nodiscard]] ssize_t read(std::span<std::byte> output);
+
+    /** The end of the last block of the deflate stream has been reached.
+     */
+    [[nodiscard]] bool done() const noexcept
+    {
+        return _state == state_type::done;
+    }
+
+    /** The compressed data that was written, but not yet decompressed.
+     * After `done()` this is the data following the deflate stream, starting at a byte boundary.
+     */
+    [[nodiscard]] std::span<std::byte const> remaining_input() const noexcept;
+
+private:
+    enum class state_type { block_header, stored_block, huffman_block, done };
+
+    static constexpr ssize_t window_size = 0x8000;
+
+    state_type _state;
+    bool _closed;
+    bool _final_block;
+
+    bstring _input;
+    ssize_t _bit_offset;
+
+    /** Number of bytes of a stored block that still needs to be copied.
+     */
+    ssize_t _stored_size;
+
+    huffman_table _literal_table;
+    huffman_table _distance_table;
+    bool _fixed_tables;
+
+    /** Length and distance of a back-reference that still needs to be copied.
+     */
+    ssize_t _copy_length;
+    ssize_t _copy_distance;
+
+    /** The last 32 KiB of decompressed data, as a ring-buffer.
+     * The window is updated at the end of `read()`; back-references into data
+     * decompressed during the current `read()` are copied from the output buffer.
+     */
+    bstring _window;
+    ssize_t _total_out;
+
+    [[nodiscard]] ssize_t available_bits() const noexcept
+    {
+        return std::ssize(_input) * 8;
+    }
+
+    /** Check if the bits of the last symbol or header were available.
+     *
+     * @return true if more compressed data is needed.
+     * @throw parse_error When the compressed data is truncated after `close()`.
+     */
+    [[nodiscard]] bool need_more_input(bit_reader const &reader) const;
+
+    /** Handle a parse error while decoding a symbol or header.
+     * A parse error caused by reading beyond the compressed data written so far is
+     * not an error when more data will follow.
+     *
+     * @return true if more compressed data is needed.
+     */
+    [[nodiscard]] bool need_more_input(bit_reader const &reader, parse_error const &e) const;
+
+    [[nodiscard]] bool decode(std::span<std::byte> output, ssize_t &n);
+    [[nodiscard]] bool decode_block_header();
+    [[nodiscard]] bool decode_stored_block(std::span<std::byte> output, ssize_t &n);
+    [[nodiscard]] bool decode_huffman_block(std::span<std::byte> output, ssize_t &n);
+    void decode_copy(std::span<std::byte> output, ssize_t &n) noexcept;
+    void update_window(std::span<std::byte const> output) noexcept;
+};
+
+/** Inflate compressed data using the deflate algorithm.
  *
  * - gzip has a CRC32+ISIZE trailer.
- *   Since gzip has no end-of-segment indicator, we need to include the trailer
- *   in the byte array passed to inflate anyway.
  * - zlib has a 32 bit check value.
- *   Since zlib has no end-of-segment indicator, we need to include the trailer
- *   in the byte array passed to inflate anyway.
  * - png IDAT chunks include the full zlib-format, including the 32 bit check value.
+ *
+ * @param bytes The compressed data, optionally followed by a trailer.
+ * @param[in,out] offset The offset of the compressed data in `bytes`, set to the offset
+ *                       of the first byte after the compressed data.
+ * @param max_size The maximum size of the decompressed data.
+ * @return The decompressed data.
+ * @throw parse_error When the compressed data is invalid or decompresses to more than `max_size`.
  */
 bstring inflate(std::span<std::byte const> bytes, ssize_t &offset, ssize_t max_size=0x0100'0000);
 
 }
-
@@ -4,11 +4,22 @@
 
 #include "png.hpp"
 #include "zlib.hpp"
+#include "deflate.hpp"
+#include "adler32.hpp"
+#include "crc32.hpp"
+#include "../file.hpp"
+#include "../float16.hpp"
 #include "../endian.hpp"
 #include "../placement.hpp"
 #include "../color/sRGB.hpp"
 #include "../color/Rec2100.hpp"
 #include "../color/color_space.hpp"
+#include "../thread.hpp"
+#include <immintrin.h>
+#include <cstring>
+#include <thread>
+#include <atomic>
+#include <algorithm>
 
 namespace tt {
 
@@ -70,11 +81,11 @@ void png::read_header(std::span<std::byte const> bytes, ssize_t &offset)
 
 void png::generate_sRGB_transfer_function() noexcept
 {
-    ttlet value_range = _bit_depth == 8 ? 256 : 65536;
-    ttlet value_range_f = narrow_cast<float>(value_range);
-    for (int i = 0; i != value_range; ++i) {
-        auto u = narrow_cast<float>(i) / value_range_f;
-        _transfer_function.push_back(sRGB_gamma_to_linear(u));
+    if (_bit_depth == 8) {
+        _transfer_function.assign(sRGB_gamma8_to_linear_table.begin(), sRGB_gamma8_to_linear_table.end());
+    } else {
+        ttlet &table = sRGB_gamma16_to_linear_table();
+        _transfer_function.assign(table.begin(), table.end());
     }
 }
 
@@ -223,6 +234,17 @@ void png::read_chunks(std::span<std::byte const> bytes, ssize_t &offset)
         tt_parse_check(length < 0x8000'0000, "Chunk length must be smaller than 2GB");
         tt_parse_check(offset + length + ssizeof(uint32_t) <= std::ssize(bytes), "Chuck extents beyond file.");
 
+        // The crc32 covers the chunk type and data.
+        ttlet type_and_data = bytes.subspan(offset - ssizeof(header->type), length + ssizeof(header->type));
+        ttlet crc = make_placement_ptr<big_uint32_buf_t>(bytes, offset + length);
+        if (crc->value() != crc32(type_and_data)) {
+            // Like libpng, ancillary chunks with a corrupt crc32 are ignored.
+            ttlet is_critical = (header->type[0] & 0x20) == 0;
+            tt_parse_check(not is_critical, "Chunk CRC32 does not match the chunk data.");
+            offset += length + ssizeof(uint32_t);
+            continue;
+        }
+
         switch (fourcc(header->type)) {
         case fourcc("IDAT"):
             _idat_chunk_data.push_back(bytes.subspan(offset, length));
@@ -255,9 +277,8 @@ void png::read_chunks(std::span<std::byte const> bytes, ssize_t &offset)
         default:;
         }
 
-        // Skip over the data, and extract the crc32.
-        offset += length;
-        [[maybe_unused]] ttlet crc = make_placement_ptr<big_uint32_buf_t>(bytes, offset);
+        // Skip over the data and the crc32.
+        offset += length + ssizeof(uint32_t);
     }
 
     tt_parse_check(!IHDR_bytes.empty(), "Missing IHDR chunk.");
@@ -300,83 +321,136 @@ png::png(std::unique_ptr<resource_view> view) :
     read_chunks(bytes, offset);
 }
 
-bstring png::decompress_IDATs(ssize_t image_data_size) const {
-    if (std::ssize(_idat_chunk_data) == 1) {
-        return zlib_decompress(_idat_chunk_data[0], image_data_size);
-    } else {
-        // Merge all idat chunks together.
-        ttlet compressed_data_size = std::accumulate(
-            _idat_chunk_data.cbegin(), _idat_chunk_data.cend(), ssize_t{0},
-            [](ttlet &a, ttlet &b) {
-            return a + std::ssize(b);
-        }
-        );
+/** Load the bytes of a pixel into the low bytes of an SSE register.
+ */
+template<int BytesPerPixel>
+[[nodiscard]] static __m128i load_pixel(uint8_t const *ptr) noexcept
+{
+    auto value = uint64_t{0};
+    std::memcpy(&value, ptr, BytesPerPixel);
+    return _mm_cvtsi64_si128(static_cast<int64_t>(value));
+}
 
-        bstring compressed_data;
-        compressed_data.reserve(compressed_data_size);
-        for (ttlet &chunk_data : _idat_chunk_data) {
-            std::copy(chunk_data.begin(), chunk_data.end(), std::back_inserter(compressed_data));
-        }
+/** Store the low bytes of an SSE register as a pixel.
+ */
+template<int BytesPerPixel>
+static void store_pixel(uint8_t *ptr, __m128i pixel) noexcept
+{
+    ttlet value = static_cast<uint64_t>(_mm_cvtsi128_si64(pixel));
+    std::memcpy(ptr, &value, BytesPerPixel);
+}
 
-        return zlib_decompress(compressed_data, image_data_size);
+template<int BytesPerPixel>
+static void unfilter_line_sub(std::span<uint8_t> line) noexcept
+{
+    // Each pixel depends on the pixel to the left; all bytes of a pixel are handled at once.
+    auto left = _mm_setzero_si128();
+    for (ssize_t i = 0; i != std::ssize(line); i += BytesPerPixel) {
+        left = _mm_add_epi8(load_pixel<BytesPerPixel>(&line[i]), left);
+        store_pixel<BytesPerPixel>(&line[i], left);
     }
 }
 
-void png::unfilter_line_sub(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
+template<int BytesPerPixel>
+static void unfilter_line_average(std::span<uint8_t> line, std::span<uint8_t const> prev_line) noexcept
 {
-    for (int i = 0; i != _bytes_per_line; ++i) {
-        int j = i - _bytes_per_pixel;
+    ttlet one = _mm_set1_epi8(1);
 
-        uint8_t prev_raw = j >= 0 ? line[j] : 0;
-        line[i] += prev_raw;
+    auto left = _mm_setzero_si128();
+    for (ssize_t i = 0; i != std::ssize(line); i += BytesPerPixel) {
+        ttlet up = load_pixel<BytesPerPixel>(&prev_line[i]);
+
+        // _mm_avg_epu8() rounds up, the average filter rounds down.
+        ttlet average = _mm_sub_epi8(_mm_avg_epu8(left, up), _mm_and_si128(_mm_xor_si128(left, up), one));
+
+        left = _mm_add_epi8(load_pixel<BytesPerPixel>(&line[i]), average);
+        store_pixel<BytesPerPixel>(&line[i], left);
     }
 }
 
-void png::unfilter_line_up(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
+template<int BytesPerPixel>
+static void unfilter_line_paeth(std::span<uint8_t> line, std::span<uint8_t const> prev_line) noexcept
 {
-    for (int i = 0; i != _bytes_per_line; ++i) {
-        line[i] += prev_line[i];
+    ttlet zero = _mm_setzero_si128();
+
+    // The predictor is calculated with 16 bit lanes.
+    auto left = _mm_setzero_si128();
+    auto left_up = _mm_setzero_si128();
+    for (ssize_t i = 0; i != std::ssize(line); i += BytesPerPixel) {
+        ttlet up = _mm_unpacklo_epi8(load_pixel<BytesPerPixel>(&prev_line[i]), zero);
+
+        // With p = left + up - left_up:
+        //  - |p - left| = |up - left_up|
+        //  - |p - up| = |left - left_up|
+        //  - |p - left_up| = |(up - left_up) + (left - left_up)|
+        ttlet p_left = _mm_sub_epi16(up, left_up);
+        ttlet p_up = _mm_sub_epi16(left, left_up);
+        ttlet distance_left = _mm_abs_epi16(p_left);
+        ttlet distance_up = _mm_abs_epi16(p_up);
+        ttlet distance_left_up = _mm_abs_epi16(_mm_add_epi16(p_left, p_up));
+        ttlet smallest = _mm_min_epi16(distance_left_up, _mm_min_epi16(distance_left, distance_up));
+
+        // On a tie the order of preference is left, up, left_up.
+        auto predictor = _mm_blendv_epi8(left_up, up, _mm_cmpeq_epi16(distance_up, smallest));
+        predictor = _mm_blendv_epi8(predictor, left, _mm_cmpeq_epi16(distance_left, smallest));
+
+        ttlet pixel = _mm_add_epi8(load_pixel<BytesPerPixel>(&line[i]), _mm_packus_epi16(predictor, predictor));
+        store_pixel<BytesPerPixel>(&line[i], pixel);
+
+        left = _mm_unpacklo_epi8(pixel, zero);
+        left_up = up;
     }
 }
 
-void png::unfilter_line_average(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
+void png::unfilter_line_sub(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
 {
-    for (int i = 0; i != _bytes_per_line; ++i) {
-        int j = i - _bytes_per_pixel;
-
-        uint8_t prev_raw = j >= 0 ? line[j] : 0;
-        line[i] += (prev_raw + prev_line[i]) / 2;
+    switch (_bytes_per_pixel) {
+    case 1: return tt::unfilter_line_sub<1>(line);
+    case 2: return tt::unfilter_line_sub<2>(line);
+    case 3: return tt::unfilter_line_sub<3>(line);
+    case 4: return tt::unfilter_line_sub<4>(line);
+    case 6: return tt::unfilter_line_sub<6>(line);
+    case 8: return tt::unfilter_line_sub<8>(line);
+    default: tt_no_default();
     }
 }
 
-static uint8_t paeth_predictor(uint8_t _a, uint8_t _b, uint8_t _c) noexcept {
-    auto a = static_cast<int>(_a);
-    auto b = static_cast<int>(_b);
-    auto c = static_cast<int>(_c);
-
-    auto p = a + b - c;
-    auto pa = std::abs(p - a);
-    auto pb = std::abs(p - b);
-    auto pc = std::abs(p - c);
+void png::unfilter_line_up(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
+{
+    ssize_t i = 0;
+    for (; i + 16 <= _bytes_per_line; i += 16) {
+        ttlet x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&line[i]));
+        ttlet up = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&prev_line[i]));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&line[i]), _mm_add_epi8(x, up));
+    }
+    for (; i != _bytes_per_line; ++i) {
+        line[i] += prev_line[i];
+    }
+}
 
-    if (pa <= pb && pa <= pc) {
-        return static_cast<uint8_t>(a);
-    } else if (pb <= pc) {
-        return static_cast<uint8_t>(b);
-    } else {
-        return static_cast<uint8_t>(c);
+void png::unfilter_line_average(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
+{
+    switch (_bytes_per_pixel) {
+    case 1: return tt::unfilter_line_average<1>(line, prev_line);
+    case 2: return tt::unfilter_line_average<2>(line, prev_line);
+    case 3: return tt::unfilter_line_average<3>(line, prev_line);
+    case 4: return tt::unfilter_line_average<4>(line, prev_line);
+    case 6: return tt::unfilter_line_average<6>(line, prev_line);
+    case 8: return tt::unfilter_line_average<8>(line, prev_line);
+    default: tt_no_default();
     }
 }
 
 void png::unfilter_line_paeth(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
 {
-    for (int i = 0; i != _bytes_per_line; ++i) {
-        int j = i - _bytes_per_pixel;
-
-        uint8_t up = prev_line[i];
-        uint8_t left = j >= 0 ? line[j] : 0;
-        uint8_t left_up = j >= 0 ? prev_line[j] : 0;
-        line[i] += paeth_predictor(left, up, left_up);
+    switch (_bytes_per_pixel) {
+    case 1: return tt::unfilter_line_paeth<1>(line, prev_line);
+    case 2: return tt::unfilter_line_paeth<2>(line, prev_line);
+    case 3: return tt::unfilter_line_paeth<3>(line, prev_line);
+    case 4: return tt::unfilter_line_paeth<4>(line, prev_line);
+    case 6: return tt::unfilter_line_paeth<6>(line, prev_line);
+    case 8: return tt::unfilter_line_paeth<8>(line, prev_line);
+    default: tt_no_default();
     }
 }
 
@@ -393,108 +467,403 @@ void png::unfilter_line(std::span<uint8_t> line, std::span<uint8_t const> prev_l
     }
 }
 
-void png::unfilter_lines(bstring &image_data) const
+void png::decompress_and_unfilter(std::span<std::byte> image_data, std::atomic<int> &nr_lines_ready) const
 {
     auto image_bytes = std::span(reinterpret_cast<uint8_t *>(image_data.data()), std::ssize(image_data));
     auto zero_line = bstring(_bytes_per_line, std::byte{0});
+    auto prev_line = std::span(reinterpret_cast<uint8_t const *>(zero_line.data()), std::ssize(zero_line));
+
+    // Decompress a band of lines at a time, so that the lines become available to
+    // the threads converting them while the rest of the image is decompressed.
+    ttlet read_size = static_cast<ssize_t>(_stride) * lines_per_band;
+
+    auto stream = zlib_stream{};
+    ssize_t size = 0;
+    int y = 0;
+    auto decompress = [&] {
+        while (size != std::ssize(image_data)) {
+            ttlet request = std::min(read_size, std::ssize(image_data) - size);
+            ttlet n = stream.read(image_data.subspan(size, request));
+            size += n;
+
+            // Lines can only be unfiltered when they are completely decompressed and
+            // in order, since the filters refer to the previous line.
+            ttlet nr_complete_lines = narrow_cast<int>(size / _stride);
+            if (nr_complete_lines != y) {
+                for (; y != nr_complete_lines; ++y) {
+                    auto line = image_bytes.subspan(y * _stride, _stride);
+                    unfilter_line(line, prev_line);
+                    prev_line = line.subspan(1, _bytes_per_line);
+                }
+                nr_lines_ready.store(y, std::memory_order::release);
+                nr_lines_ready.notify_all();
+            }
+
+            if (n != request) {
+                // More compressed data is needed.
+                return;
+            }
+        }
+    };
 
-    auto prev_line = std::span(reinterpret_cast<uint8_t *>(zero_line.data()), std::ssize(zero_line));
-    for (int y = 0; y != _height; ++y) {
-        auto line = image_bytes.subspan(y * _stride, _stride);
-        unfilter_line(line, prev_line);
-        prev_line = line.subspan(1, _bytes_per_line);
+    for (ttlet &chunk_data : _idat_chunk_data) {
+        stream.write(chunk_data);
+        decompress();
     }
+    stream.close();
+    decompress();
+
+    tt_parse_check(size == std::ssize(image_data), "Uncompressed image data has incorrect size.");
+    auto trailing = std::byte{};
+    tt_parse_check(stream.read(std::span(&trailing, 1)) == 0, "Uncompressed image data has incorrect size.");
 }
 
-static uint16_t get_sample(std::span<std::byte const> bytes, ssize_t &offset, bool two_bytes)
+template<int BitDepth>
+[[nodiscard]] static int get_sample(uint8_t const *ptr) noexcept
 {
-    uint16_t value = static_cast<uint8_t>(bytes[offset++]);
-    if (two_bytes) {
-        value <<= 8;
-        value |= static_cast<uint8_t>(bytes[offset++]);
+    if constexpr (BitDepth == 16) {
+        return (static_cast<int>(ptr[0]) << 8) | ptr[1];
+    } else {
+        return ptr[0];
     }
-    return value;
 }
 
-u16x4 png::extract_pixel_from_line(std::span<std::byte const> bytes, int x) const noexcept
+template<int BitDepth, bool IsColor, bool HasAlpha>
+void png::data_to_image_line(std::span<std::byte const> bytes, pixel_row<sfloat_rgba16> &line) const noexcept
 {
-    tt_axiom(_bit_depth == 8 || _bit_depth == 16);
-    tt_axiom(!_is_palletted);
-
-    uint16_t r = 0;
-    uint16_t g = 0;
-    uint16_t b = 0;
-    uint16_t a = 0;
-
-    ssize_t offset = x * _bytes_per_pixel;
-    if (_is_color) {
-        r = get_sample(bytes, offset, _bit_depth == 16);
-        g = get_sample(bytes, offset, _bit_depth == 16);
-        b = get_sample(bytes, offset, _bit_depth == 16);
-    } else {
-        r = g = b = get_sample(bytes, offset, _bit_depth == 16);
+    constexpr int bytes_per_sample = BitDepth / 8;
+    constexpr int bytes_per_pixel = bytes_per_sample * ((IsColor ? 3 : 1) + (HasAlpha ? 1 : 0));
+    constexpr float alpha_mul = BitDepth == 16 ? 1.0f / 65535.0f : 1.0f / 255.0f;
+
+    ttlet *transfer_function = _transfer_function.data();
+    ttlet *src = reinterpret_cast<uint8_t const *>(bytes.data());
+    auto *dst = line.data();
+
+    auto linear_pixel = [&](int x) noexcept {
+        ttlet *ptr = src + x * bytes_per_pixel;
+
+        ttlet r = get_sample<BitDepth>(ptr);
+        ttlet g = IsColor ? get_sample<BitDepth>(ptr + bytes_per_sample) : r;
+        ttlet b = IsColor ? get_sample<BitDepth>(ptr + 2 * bytes_per_sample) : r;
+        ttlet a = HasAlpha ? static_cast<float>(get_sample<BitDepth>(ptr + bytes_per_pixel - bytes_per_sample)) * alpha_mul : 1.0f;
+        return _mm_setr_ps(transfer_function[r], transfer_function[g], transfer_function[b], a);
+    };
+
+    // The columns of the matrix, duplicated for two pixels. Alpha is passed unchanged by the 4th column.
+    ttlet is_identity = _color_to_sRGB == matrix3{};
+    auto duplicate = [](f32x4 const &column) noexcept {
+        ttlet tmp = to_m128(column);
+        return _mm256_set_m128(tmp, tmp);
+    };
+    ttlet col0 = duplicate(get<0>(_color_to_sRGB));
+    ttlet col1 = duplicate(get<1>(_color_to_sRGB));
+    ttlet col2 = duplicate(get<2>(_color_to_sRGB));
+    ttlet col3 = duplicate(get<3>(_color_to_sRGB));
+
+    auto convert = [&](__m256 linear) noexcept {
+        if (is_identity) {
+            return linear;
+        }
+        auto r = _mm256_mul_ps(col0, _mm256_permute_ps(linear, 0b00'00'00'00));
+        r = _mm256_add_ps(r, _mm256_mul_ps(col1, _mm256_permute_ps(linear, 0b01'01'01'01)));
+        r = _mm256_add_ps(r, _mm256_mul_ps(col2, _mm256_permute_ps(linear, 0b10'10'10'10)));
+        return _mm256_add_ps(r, _mm256_mul_ps(col3, _mm256_permute_ps(linear, 0b11'11'11'11)));
+    };
+
+    // Two pixels are converted at a time into eight binary16 values.
+    int x = 0;
+    for (; x + 2 <= _width; x += 2) {
+        ttlet linear = _mm256_set_m128(linear_pixel(x + 1), linear_pixel(x));
+        ttlet pixels = _mm256_cvtps_ph(convert(linear), _MM_FROUND_CUR_DIRECTION);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + x), pixels);
     }
-    if (_has_alpha) {
-        a = get_sample(bytes, offset, _bit_depth == 16);
-    } else {
-        a = (_bit_depth == 16) ? 65535 : 255;
+    if (x != _width) {
+        ttlet linear = _mm256_castps128_ps256(linear_pixel(x));
+        ttlet pixels = _mm256_cvtps_ph(convert(linear), _MM_FROUND_CUR_DIRECTION);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + x), pixels);
     }
+}
 
-    return {r, g, b, a};
+void png::data_to_image(std::span<std::byte const> bytes, pixel_map<sfloat_rgba16> &image, int first, int last) const noexcept
+{
+    for (int y = first; y != last; ++y) {
+        // The lines of a png image are stored top to bottom, while the pixel-map is bottom to top.
+        auto bytes_line = bytes.subspan(y * _stride + 1, _bytes_per_line);
+        auto pixel_line = image[_height - y - 1];
+
+        if (_bit_depth == 16) {
+            if (_is_color) {
+                _has_alpha ? data_to_image_line<16, true, true>(bytes_line, pixel_line) :
+                             data_to_image_line<16, true, false>(bytes_line, pixel_line);
+            } else {
+                _has_alpha ? data_to_image_line<16, false, true>(bytes_line, pixel_line) :
+                             data_to_image_line<16, false, false>(bytes_line, pixel_line);
+            }
+        } else {
+            if (_is_color) {
+                _has_alpha ? data_to_image_line<8, true, true>(bytes_line, pixel_line) :
+                             data_to_image_line<8, true, false>(bytes_line, pixel_line);
+            } else {
+                _has_alpha ? data_to_image_line<8, false, true>(bytes_line, pixel_line) :
+                             data_to_image_line<8, false, false>(bytes_line, pixel_line);
+            }
+        }
+    }
 }
 
-void png::data_to_image_line(std::span<std::byte const> bytes, pixel_row<sfloat_rgba16> &line) const noexcept
+void png::decode_image(pixel_map<sfloat_rgba16> &image) const
 {
-    ttlet alpha_mul = _bit_depth == 16 ? 1.0f/65535.0f : 1.0f/255.0f;
-    for (int x = 0; x != _width; ++x) {
-        ttlet value = extract_pixel_from_line(bytes, x);
+    // There is a filter selection byte in front of every line.
+    auto image_data = bstring(narrow_cast<size_t>(_stride * _height), std::byte{0});
+    auto image_span = std::span(image_data);
+    auto nr_lines_ready = std::atomic<int>{0};
+
+    ttlet nr_bands = (_height + lines_per_band - 1) / lines_per_band;
+    ttlet nr_threads = static_cast<ssize_t>(_width) * _height < minimum_nr_pixels_for_threads ?
+        1u :
+        std::clamp(std::thread::hardware_concurrency(), 1u, std::min(maximum_nr_decode_threads, narrow_cast<unsigned int>(nr_bands)));
+
+    if (nr_threads == 1) {
+        decompress_and_unfilter(image_span, nr_lines_ready);
+        data_to_image(image_span, image, 0, _height);
+        return;
+    }
 
-        ttlet linear_color = color(
-            _transfer_function[value.x()],
-            _transfer_function[value.y()],
-            _transfer_function[value.z()]
-        );
+    // Decompressing and unfiltering is sequential, but each line can be converted to pixels
+    // as soon as it is unfiltered. Bands of lines are converted in order on multiple threads.
+    auto failed = std::atomic<bool>{false};
+    auto next_band = std::atomic<int>{0};
+    auto convert_loop = [&] {
+        for (auto band = next_band.fetch_add(1, std::memory_order::relaxed); band < nr_bands;
+             band = next_band.fetch_add(1, std::memory_order::relaxed)) {
+            ttlet first = band * lines_per_band;
+            ttlet last = std::min(first + lines_per_band, _height);
+
+            for (auto ready = nr_lines_ready.load(std::memory_order::acquire); ready < last;
+                 ready = nr_lines_ready.load(std::memory_order::acquire)) {
+                nr_lines_ready.wait(ready, std::memory_order::acquire);
+            }
+            if (failed.load(std::memory_order::relaxed)) {
+                return;
+            }
+
+            data_to_image(image_span, image, first, last);
+        }
+    };
+
+    auto threads = std::vector<std::jthread>{};
+    for (unsigned int i = 1; i < nr_threads; ++i) {
+        threads.emplace_back([&convert_loop] {
+            set_thread_name("png_decode");
+            convert_loop();
+        });
+    }
 
-        auto lesRGB_color = _color_to_sRGB * linear_color;
-        lesRGB_color.a() = static_cast<float>(value.w()) * alpha_mul;
+    try {
+        decompress_and_unfilter(image_span, nr_lines_ready);
+    } catch (...) {
+        // Release the waiting threads, which are joined when they are destroyed.
+        failed.store(true, std::memory_order::relaxed);
+        nr_lines_ready.store(_height, std::memory_order::release);
+        nr_lines_ready.notify_all();
+        throw;
+    }
 
-        line[x] = lesRGB_color;
+    // The current thread helps converting, then waits for the other threads by destroying them.
+    convert_loop();
+}
+
+pixel_map<sfloat_rgba16> png::load(URL const &url)
+{
+    ttlet png_data = png(url);
+    auto image = pixel_map<sfloat_rgba16>{narrow_cast<ssize_t>(png_data.width()), narrow_cast<ssize_t>(png_data.height())};
+    png_data.decode_image(image);
+    return image;
+}
+
+/** Convert a line of pixels to 8 bit sRGB samples with alpha.
+ */
+static void png_encode_line(pixel_row<sfloat_rgba16> const &row, std::span<uint8_t> line) noexcept
+{
+    static_assert(sizeof(sfloat_rgba16) == 4 * sizeof(float16));
+    ttlet *src = reinterpret_cast<float16 const *>(row.data());
+
+    for (ssize_t x = 0; x != row.width(); ++x) {
+        auto *dst = line.data() + x * 4;
+        dst[0] = sRGB_linear16_to_gamma8(src[x * 4]);
+        dst[1] = sRGB_linear16_to_gamma8(src[x * 4 + 1]);
+        dst[2] = sRGB_linear16_to_gamma8(src[x * 4 + 2]);
+        dst[3] = static_cast<uint8_t>(std::clamp(static_cast<float>(src[x * 4 + 3]), 0.0f, 1.0f) * 255.0f + 0.5f);
     }
 }
 
-void png::data_to_image(bstring bytes, pixel_map<sfloat_rgba16> &image) const noexcept
+/** Filter a line with the Sub or Up filter, whichever has the smallest sum of absolute differences.
+ *
+ * @param line The samples of the line.
+ * @param prev_line The samples of the previous line, or empty for the first line of the image.
+ * @param tmp A buffer the size of a line.
+ * @param dst The filter type followed by the filtered line.
+ */
+static void png_filter_line(
+    std::span<uint8_t const> line,
+    std::span<uint8_t const> prev_line,
+    std::span<uint8_t> tmp,
+    uint8_t *dst) noexcept
 {
-    auto bytes_span = std::span(bytes);
+    constexpr ssize_t bytes_per_pixel = 4;
+    ttlet size = std::ssize(line);
+
+    auto *sub = dst + 1;
+    auto sub_cost = ssize_t{0};
+    for (ssize_t i = 0; i != size; ++i) {
+        sub[i] = static_cast<uint8_t>(line[i] - (i >= bytes_per_pixel ? line[i - bytes_per_pixel] : 0));
+        sub_cost += std::abs(static_cast<int8_t>(sub[i]));
+    }
+    dst[0] = 1;
 
-    for (int y = 0; y != _height; ++y) {
-        int inv_y = _height - y - 1;
+    if (prev_line.empty()) {
+        return;
+    }
 
-        auto bytes_line = bytes_span.subspan(inv_y * _stride + 1, _bytes_per_line);
-        auto pixel_line = image[y];
-        data_to_image_line(bytes_line, pixel_line);
+    auto up_cost = ssize_t{0};
+    for (ssize_t i = 0; i != size; ++i) {
+        tmp[i] = static_cast<uint8_t>(line[i] - prev_line[i]);
+        up_cost += std::abs(static_cast<int8_t>(tmp[i]));
+    }
+    if (up_cost < sub_cost) {
+        std::memcpy(sub, tmp.data(), tmp.size());
+        dst[0] = 2;
     }
 }
 
-void png::decode_image(pixel_map<sfloat_rgba16> &image) const
+static void png_append_chunk(bstring &r, char const type[5], std::span<std::byte const> data) noexcept
 {
+    auto length = big_uint32_buf_t{};
+    length = narrow_cast<uint32_t>(data.size());
+    r.append(length._value, sizeof(length._value));
+
+    // The crc32 covers the chunk type and data.
+    ttlet offset = r.size();
+    r.append(reinterpret_cast<std::byte const *>(type), 4);
+    r.append(data.data(), data.size());
+
+    auto crc = big_uint32_buf_t{};
+    crc = crc32(std::span<std::byte const>{r}.subspan(offset));
+    r.append(crc._value, sizeof(crc._value));
+}
+
+bstring png::encode(pixel_map<sfloat_rgba16> const &image) noexcept
+{
+    tt_axiom(image.width() > 0 && image.height() > 0);
+
+    ttlet width = image.width();
+    ttlet height = image.height();
+    ttlet bytes_per_line = width * 4;
     // There is a filter selection byte in front of every line.
-    ttlet image_data_size = _stride * _height;
+    ttlet stride = bytes_per_line + 1;
+
+    // The bands do not depend on the number of threads, so that the encoded image is always the same.
+    ttlet lines_per_encode_band = std::max(ssize_t{1}, encode_band_size / stride);
+    ttlet nr_bands = (height + lines_per_encode_band - 1) / lines_per_encode_band;
+
+    auto filtered = std::vector<bstring>(narrow_cast<size_t>(nr_bands));
+    auto compressed = std::vector<bstring>(narrow_cast<size_t>(nr_bands));
+
+    // The zlib header: CM=8 (deflate), CINFO=7 (32 KiB window), FLEVEL=0 (fastest) and FCHECK.
+    compressed.front() = bstring{std::byte{0x78}, std::byte{0x01}};
+
+    auto encode_band = [&](ssize_t band) noexcept {
+        ttlet first = band * lines_per_encode_band;
+        ttlet last = std::min(first + lines_per_encode_band, height);
+
+        auto line = std::vector<uint8_t>(narrow_cast<size_t>(bytes_per_line));
+        auto prev_line = std::vector<uint8_t>(narrow_cast<size_t>(bytes_per_line));
+        auto tmp = std::vector<uint8_t>(narrow_cast<size_t>(bytes_per_line));
+
+        // The lines of a png image are stored top to bottom, while the pixel-map is bottom to top.
+        if (first != 0) {
+            png_encode_line(image[height - first], prev_line);
+        }
+
+        auto &data = filtered[narrow_cast<size_t>(band)];
+        data.resize(narrow_cast<size_t>((last - first) * stride));
+        auto *dst = reinterpret_cast<uint8_t *>(data.data());
+        for (auto y = first; y != last; ++y, dst += stride) {
+            png_encode_line(image[height - y - 1], line);
+            png_filter_line(line, y == 0 ? std::span<uint8_t const>{} : std::span<uint8_t const>{prev_line}, tmp, dst);
+            std::swap(line, prev_line);
+        }
+
+        deflate(data, compressed[narrow_cast<size_t>(band)], band == nr_bands - 1);
+    };
 
-    auto image_data = decompress_IDATs(image_data_size);
-    tt_parse_check(std::ssize(image_data) == image_data_size, "Uncompressed image data has incorrect size.");
+    ttlet nr_threads = width * height < minimum_nr_pixels_for_threads ?
+        1u :
+        std::clamp(std::thread::hardware_concurrency(), 1u, std::min(maximum_nr_encode_threads, narrow_cast<unsigned int>(nr_bands)));
 
-    unfilter_lines(image_data);
+    auto next_band = std::atomic<ssize_t>{0};
+    auto encode_loop = [&] {
+        for (auto band = next_band.fetch_add(1, std::memory_order::relaxed); band < nr_bands;
+             band = next_band.fetch_add(1, std::memory_order::relaxed)) {
+            encode_band(band);
+        }
+    };
+
+    {
+        auto threads = std::vector<std::jthread>{};
+        for (unsigned int i = 1; i < nr_threads; ++i) {
+            threads.emplace_back([&encode_loop] {
+                set_thread_name("png_encode");
+                encode_loop();
+            });
+        }
+
+        // The current thread helps encoding, then waits for the other threads by destroying them.
+        encode_loop();
+    }
 
-    data_to_image(image_data, image);
+    auto adler = uint32_t{1};
+    for (ttlet &data : filtered) {
+        adler = adler32(data, adler);
+    }
+    auto ADLER32 = big_uint32_buf_t{};
+    ADLER32 = adler;
+    compressed.back().append(ADLER32._value, sizeof(ADLER32._value));
+
+    auto r = bstring{std::byte{137}, std::byte{80}, std::byte{78}, std::byte{71}, std::byte{13}, std::byte{10}, std::byte{26}, std::byte{10}};
+
+    auto ihdr = IHDR{};
+    ihdr.width = narrow_cast<uint32_t>(width);
+    ihdr.height = narrow_cast<uint32_t>(height);
+    ihdr.bit_depth = 8;
+    // Color with alpha.
+    ihdr.color_type = 6;
+    ihdr.compression_method = 0;
+    ihdr.filter_method = 0;
+    ihdr.interlace_method = 0;
+    png_append_chunk(r, "IHDR", std::as_bytes(std::span{&ihdr, 1}));
+
+    auto srgb = sRGB{};
+    // Perceptual rendering intent.
+    srgb.rendering_intent = 0;
+    png_append_chunk(r, "sRGB", std::as_bytes(std::span{&srgb, 1}));
+
+    // The zlib stream is split into an IDAT chunk for each band.
+    for (ttlet &data : compressed) {
+        png_append_chunk(r, "IDAT", std::span<std::byte const>{data});
+    }
 
+    png_append_chunk(r, "IEND", std::span<std::byte const>{});
+    return r;
 }
 
-pixel_map<sfloat_rgba16> png::load(URL const &url)
+void png::save(URL const &url, pixel_map<sfloat_rgba16> const &image)
 {
-    ttlet png_data = png(url);
-    auto image = pixel_map<sfloat_rgba16>{narrow_cast<ssize_t>(png_data.width()), narrow_cast<ssize_t>(png_data.height())};
-    png_data.decode_image(image);
-    return image;
+    ttlet bytes = encode(image);
+
+    auto file = tt::file(url, access_mode::truncate_or_create_for_write);
+    file.write(std::span<std::byte const>{bytes});
+    file.flush();
 }
 
 
@@ -17,6 +17,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <numeric>
+#include <atomic>
 
 namespace tt {
 
@@ -39,10 +40,60 @@ public:
         return _height;
     }
 
+    /** Decode the image into a pixel-map.
+     *
+     * Large images are decoded on multiple threads; the image data is decompressed and
+     * unfiltered on the current thread while bands of lines are converted to pixels on
+     * the other threads.
+     *
+     * @param image The pixel-map with the same width and height as the image.
+     * @throw parse_error When the image data is invalid.
+     */
     void decode_image(pixel_map<sfloat_rgba16> &image) const;
 
     [[nodiscard]] static pixel_map<sfloat_rgba16> load(URL const &url);
 
+    /** Encode an image as PNG.
+     *
+     * The pixels are stored as 8 bit sRGB samples with alpha. Each line is filtered with
+     * either the Sub or the Up filter. Bands of lines are compressed independently with the
+     * fast `deflate()` compressor, on multiple threads for large images; the encoded image is
+     * the same for any number of threads.
+     *
+     * @param image The image to encode, with a width and height of at least one pixel.
+     * @return The data of the PNG file.
+     */
+    [[nodiscard]] static bstring encode(pixel_map<sfloat_rgba16> const &image) noexcept;
+
+    /** Save an image as a PNG file.
+     *
+     * @param url The location of the file, which is overwritten when it exists.
+     * @param image The image to save.
+     * @throw io_error When the file could not be written.
+     * @see encode()
+     */
+    static void save(URL const &url, pixel_map<sfloat_rgba16> const &image);
+
+    /** The maximum number of threads converting lines of an image to pixels.
+     */
+    static constexpr unsigned int maximum_nr_decode_threads = 16;
+
+    /** The maximum number of threads filtering and compressing bands of lines of an image.
+     */
+    static constexpr unsigned int maximum_nr_encode_threads = 16;
+
+    /** Images with fewer pixels are decoded and encoded on the current thread only.
+     */
+    static constexpr ssize_t minimum_nr_pixels_for_threads = 512 * 512;
+
+    /** The number of lines converted at a time by a thread.
+     */
+    static constexpr int lines_per_band = 32;
+
+    /** The approximate number of bytes of filtered image data compressed at a time by a thread.
+     */
+    static constexpr ssize_t encode_band_size = 0x40000;
+
 private:
     /** Matrix to convert png color values to sRGB.
      * The default are sRGB color primaries and white-point.
@@ -89,16 +140,35 @@ private:
     void generate_sRGB_transfer_function() noexcept;
     void generate_Rec2100_transfer_function() noexcept;
     void generate_gamma_transfer_function(float gamma) noexcept;
-    [[nodiscard]] bstring decompress_IDATs(ssize_t image_data_size) const;
-    void unfilter_lines(bstring &image_data) const;
+
+    /** Decompress the image data and unfilter the lines.
+     *
+     * @param image_data The buffer for the image data, with the exact size of the uncompressed data.
+     * @param[out] nr_lines_ready The number of lines that are unfiltered, updated while decompressing.
+     * @throw parse_error When the compressed data is invalid or has the incorrect size.
+     */
+    void decompress_and_unfilter(std::span<std::byte> image_data, std::atomic<int> &nr_lines_ready) const;
+
     void unfilter_line(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const;
     void unfilter_line_sub(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept;
     void unfilter_line_up(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept;
     void unfilter_line_average(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept;
     void unfilter_line_paeth(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept;
-    void data_to_image(bstring bytes, pixel_map<sfloat_rgba16> &image) const noexcept;
+
+    /** Convert unfiltered lines to pixels.
+     *
+     * @param bytes The unfiltered image data.
+     * @param image The pixel-map to write to.
+     * @param first The first line to convert, counted from the top of the image.
+     * @param last One beyond the last line to convert.
+     */
+    void data_to_image(std::span<std::byte const> bytes, pixel_map<sfloat_rgba16> &image, int first, int last) const noexcept;
+
+    /** Convert a line of samples to pixels.
+     * Only bit depths of 8 and 16 are supported; palettes are not supported.
+     */
+    template<int BitDepth, bool IsColor, bool HasAlpha>
     void data_to_image_line(std::span<std::byte const> bytes, pixel_row<sfloat_rgba16> &row) const noexcept;
-    u16x4 extract_pixel_from_line(std::span<std::byte const> bytes, int x) const noexcept;
 
 };
 
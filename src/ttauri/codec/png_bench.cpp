@@ -0,0 +1,50 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/codec/png.hpp"
+#include "ttauri/file_view.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace std;
+using namespace tt;
+
+static void png_decode(benchmark::State &state)
+{
+    ttlet view = file_view(URL("file:ttauri_demo.png"));
+    ttlet png_data = png(view.bytes());
+    auto image = pixel_map<sfloat_rgba16>{narrow_cast<ssize_t>(png_data.width()), narrow_cast<ssize_t>(png_data.height())};
+
+    for (auto _ : state) {
+        png_data.decode_image(image);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * image.width() * image.height());
+}
+BENCHMARK(png_decode);
+
+static void png_parse_and_decode(benchmark::State &state)
+{
+    ttlet view = file_view(URL("file:ttauri_demo.png"));
+
+    for (auto _ : state) {
+        ttlet png_data = png(view.bytes());
+        auto image = pixel_map<sfloat_rgba16>{narrow_cast<ssize_t>(png_data.width()), narrow_cast<ssize_t>(png_data.height())};
+        png_data.decode_image(image);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * narrow_cast<int64_t>(view.size()));
+}
+BENCHMARK(png_parse_and_decode);
+
+static void png_encode(benchmark::State &state)
+{
+    ttlet image = png::load(URL("file:ttauri_demo.png"));
+
+    for (auto _ : state) {
+        auto bytes = png::encode(image);
+        benchmark::DoNotOptimize(bytes);
+    }
+    state.SetItemsProcessed(state.iterations() * image.width() * image.height());
+}
+BENCHMARK(png_encode);
@@ -0,0 +1,68 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/codec/png.hpp"
+#include "ttauri/color/sRGB.hpp"
+#include "ttauri/required.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+
+using namespace std;
+using namespace tt;
+
+[[nodiscard]] static pixel_map<sfloat_rgba16> png_test_image(ssize_t width, ssize_t height)
+{
+    auto image = pixel_map<sfloat_rgba16>{width, height};
+    for (ssize_t y = 0; y != height; ++y) {
+        auto row = image[y];
+        for (ssize_t x = 0; x != width; ++x) {
+            // Gradients, with a noisy band to check both filters.
+            ttlet noise = static_cast<float>((x * 7919 + y * 104729) % 251) / 250.0f;
+            ttlet r = static_cast<float>(x) / static_cast<float>(width);
+            ttlet g = static_cast<float>(y) / static_cast<float>(height);
+            ttlet b = y % 64 < 32 ? noise : 0.5f;
+            ttlet a = x % 3 == 0 ? 1.0f : noise;
+            row[x] = f32x4{sRGB_gamma_to_linear(r), sRGB_gamma_to_linear(g), sRGB_gamma_to_linear(b), a};
+        }
+    }
+    return image;
+}
+
+static void png_round_trip(ssize_t width, ssize_t height)
+{
+    ttlet original = png_test_image(width, height);
+    ttlet bytes = png::encode(original);
+
+    ttlet png_data = png(bytes);
+    ASSERT_EQ(png_data.width(), narrow_cast<size_t>(width));
+    ASSERT_EQ(png_data.height(), narrow_cast<size_t>(height));
+
+    auto decoded = pixel_map<sfloat_rgba16>{width, height};
+    png_data.decode_image(decoded);
+
+    // The color is stored as 8 bit sRGB, compare the values in gamma space.
+    for (ssize_t y = 0; y != height; ++y) {
+        for (ssize_t x = 0; x != width; ++x) {
+            ttlet expected = static_cast<f32x4>(original[y][x]);
+            ttlet result = static_cast<f32x4>(decoded[y][x]);
+            for (size_t i = 0; i != 3; ++i) {
+                ASSERT_NEAR(sRGB_linear_to_gamma(result[i]), sRGB_linear_to_gamma(expected[i]), 1.5f / 255.0f);
+            }
+            ASSERT_NEAR(result[3], expected[3], 0.6f / 255.0f);
+        }
+    }
+}
+
+TEST(PNG, EncodeSmall)
+{
+    png_round_trip(1, 1);
+    png_round_trip(3, 2);
+    png_round_trip(37, 19);
+}
+
+TEST(PNG, EncodeBands)
+{
+    // Large enough for multiple threads and many bands.
+    png_round_trip(811, 677);
+}
@@ -4,6 +4,8 @@
 
 #include "zlib.hpp"
 #include "inflate.hpp"
+#include "deflate.hpp"
+#include "adler32.hpp"
 #include "../endian.hpp"
 #include "../placement.hpp"
 
@@ -14,29 +16,92 @@ struct zlib_header {
     uint8_t FLG;
 };
 
-bstring zlib_decompress(std::span<std::byte const> bytes, ssize_t max_size)
+static void zlib_check_header(zlib_header const &header)
 {
-    ssize_t offset = 0;
+    ttlet header_chksum = header.CMF * 256 + header.FLG;
+    tt_parse_check(header_chksum % 31 == 0, "zlib header checksum failed.");
 
-    ttlet header = make_placement_ptr<zlib_header>(bytes, offset);
+    tt_parse_check((header.CMF & 0xf) == 8, "zlib compression method must be 8");
+    tt_parse_check(((header.CMF >> 4) & 0xf) <= 7, "zlib LZ77 window too large");
+    tt_parse_check((header.FLG & 0x20) == 0, "zlib must not use a preset dicationary");
+}
 
-    ttlet header_chksum = header->CMF * 256 + header->FLG;
-    tt_parse_check(header_chksum % 31 == 0, "zlib header checksum failed.");
+void zlib_stream::write(std::span<std::byte const> bytes) noexcept
+{
+    if (_header_done) {
+        _inflate.write(bytes);
+    } else {
+        _header.append(bytes.data(), bytes.size());
+    }
+}
+
+void zlib_stream::close() noexcept
+{
+    _closed = true;
+    if (_header_done) {
+        _inflate.close();
+    }
+}
+
+[[nodiscard]] ssize_t zlib_stream::read(std::span<std::byte> output)
+{
+    if (not _header_done) {
+        if (std::ssize(_header) < static_cast<ssize_t>(sizeof(zlib_header))) {
+            tt_parse_check(not _closed, "zlib header is truncated");
+            return 0;
+        }
+
+        zlib_check_header(*make_placement_ptr<zlib_header>(std::span<std::byte const>{_header}));
 
-    tt_parse_check((header->CMF & 0xf) == 8, "zlib compression method must be 8");
-    tt_parse_check(((header->CMF >> 4) & 0xf) <= 7, "zlib LZ77 window too large");
-    tt_parse_check((header->FLG & 0x20) == 0, "zlib must not use a preset dicationary");
+        _inflate.write(std::span<std::byte const>{_header}.subspan(sizeof(zlib_header)));
+        if (_closed) {
+            _inflate.close();
+        }
+        _header.clear();
+        _header_done = true;
+    }
 
-    if (header->FLG & 0x20) {
-        [[maybe_unused]] auto FDICT = make_placement_ptr<big_uint32_buf_t>(bytes, offset);
+    ttlet n = _inflate.read(output);
+    _adler = adler32(output.first(narrow_cast<size_t>(n)), _adler);
+    if (done()) {
+        ttlet ADLER32 = make_placement_ptr<big_uint32_buf_t>(_inflate.remaining_input());
+        tt_parse_check(ADLER32->value() == _adler, "zlib check value does not match the decompressed data");
+    } else if (_inflate.done()) {
+        tt_parse_check(not _closed, "zlib check value is truncated");
     }
+    return n;
+}
+
+[[nodiscard]] bool zlib_stream::done() const noexcept
+{
+    return _inflate.done() && std::ssize(_inflate.remaining_input()) >= static_cast<ssize_t>(sizeof(big_uint32_buf_t));
+}
+
+bstring zlib_decompress(std::span<std::byte const> bytes, ssize_t max_size)
+{
+    ssize_t offset = 0;
+
+    ttlet header = make_placement_ptr<zlib_header>(bytes, offset);
+    zlib_check_header(*header);
 
     auto r = inflate(bytes, offset, max_size);
 
-    [[maybe_unused]] auto ADLER32 = make_placement_ptr<big_uint32_buf_t>(bytes, offset);
+    ttlet ADLER32 = make_placement_ptr<big_uint32_buf_t>(bytes, offset);
+    tt_parse_check(ADLER32->value() == adler32(r), "zlib check value does not match the decompressed data");
 
     return r;
 }
 
+[[nodiscard]] bstring zlib_compress(std::span<std::byte const> bytes) noexcept
+{
+    // CM=8 (deflate), CINFO=7 (32 KiB window), FLEVEL=0 (fastest) and FCHECK.
+    auto r = bstring{std::byte{0x78}, std::byte{0x01}};
+    deflate(bytes, r);
+
+    auto ADLER32 = big_uint32_buf_t{};
+    ADLER32 = adler32(bytes);
+    r.append(ADLER32._value, sizeof(ADLER32._value));
+    return r;
+}
 
-}
\ No newline at end of file
+}
@@ -7,14 +7,59 @@
 #include "../URL.hpp"
 #include "../byte_string.hpp"
 #include "../file_view.hpp"
+#include "inflate.hpp"
 #include <cstddef>
 
 namespace tt {
 
+/** A resumable decoder for data in the zlib format.
+ * @see inflate_stream
+ */
+class zlib_stream {
+public:
+    /** Add compressed data.
+     */
+    void write(std::span<std::byte const> bytes) noexcept;
+
+    /** Mark the end of the compressed data.
+     */
+    void close() noexcept;
+
+    /** Decompress data.
+     *
+     * @param output The buffer to decompress into.
+     * @return The number of bytes written into `output`.
+     * @throw parse_error When the compressed data is invalid, or truncated after `close()`.
+     */
+    [[nodiscard]] ssize_t read(std::span<std::byte> output);
+
+    /** The end of the compressed data and its check value has been reached.
+     */
+    [[nodiscard]] bool done() const noexcept;
+
+private:
+    bstring _header;
+    bool _header_done = false;
+    bool _closed = false;
+    inflate_stream _inflate;
+
+    /** The Adler-32 checksum of the data decompressed so far.
+     */
+    uint32_t _adler = 1;
+};
+
 bstring zlib_decompress(std::span<std::byte const> bytes, ssize_t max_size=0x01000000);
 
 inline bstring zlib_decompress(URL const &url, ssize_t max_size=0x01000000) {
     return zlib_decompress(file_view(url), max_size);
 }
 
+/** Compress data in the zlib format.
+ *
+ * @param bytes The data to compress.
+ * @return The zlib header, the compressed data and the Adler-32 check value.
+ * @see deflate
+ */
+[[nodiscard]] bstring zlib_compress(std::span<std::byte const> bytes) noexcept;
+
 }
@@ -7,6 +7,8 @@
 #include "../geometry/numeric_array.hpp"
 #include "../geometry/matrix.hpp"
 #include "../geometry/scale.hpp"
+#include "color.hpp"
+#include <span>
 
 namespace tt {
 
@@ -30,4 +32,19 @@ color_primaries_to_RGBtoXYZ(float wx, float wy, float rx, float ry, float gx, fl
     return C * S;
 }
 
+/** Convert colors to another color space.
+ * The alpha channel is not changed.
+ *
+ * @param M The matrix to convert between the linear color spaces, for example `XYZ_to_sRGB * Rec2020_to_XYZ`.
+ * @param colors The colors to convert in place.
+ */
+inline void convert_color_space(matrix3 const &M, std::span<color> colors) noexcept
+{
+    // Copy the matrix so that writing the colors does not cause it to be reloaded.
+    ttlet M_ = M;
+    for (auto &c : colors) {
+        c = M_ * c;
+    }
+}
+
 } // namespace tt
@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 #include <iostream>
 #include <string>
+#include <vector>
 
 using namespace tt;
 
@@ -20,3 +21,14 @@ TEST(color_space, color_primaries_to_RGBtoXYZ)
     ASSERT_NEAR_VEC(get<2>(BT709_to_XYZ), f32x4(0.1805f, 0.0722f, 0.9505f), 0.001);
     ASSERT_NEAR_VEC(get<3>(BT709_to_XYZ), f32x4(0.0, 0.0, 0.0, 1.0), 0.001);
 }
+
+TEST(color_space, convert_color_space)
+{
+    auto BT709_to_XYZ = color_primaries_to_RGBtoXYZ(0.3127f, 0.3290f, 0.64f, 0.33f, 0.30f, 0.60f, 0.15f, 0.06f);
+
+    auto colors = std::vector<color>{color{1.0f, 0.0f, 0.0f, 0.5f}, color{1.0f, 1.0f, 1.0f, 1.0f}};
+    convert_color_space(BT709_to_XYZ, colors);
+
+    ASSERT_NEAR_VEC(static_cast<f32x4>(colors[0]), f32x4(0.4124f, 0.2126f, 0.0193f, 0.5f), 0.001);
+    ASSERT_NEAR_VEC(static_cast<f32x4>(colors[1]), f32x4(0.9505f, 1.0f, 1.0890f, 1.0f), 0.001);
+}
@@ -7,9 +7,12 @@
 #include "../float16.hpp"
 #include "../geometry/matrix.hpp"
 #include "../codec/base_n.hpp"
+#include "../cast.hpp"
 #include "color.hpp"
 #include <cmath>
 #include <array>
+#include <memory>
+#include <span>
 
 namespace tt {
 
@@ -32,7 +35,7 @@ constexpr matrix3 XYZ_to_sRGB =
     if (u <= 0.0031308) {
         return 12.92f * u;
     } else {
-        return 1.055f * std::pow(u, 0.416f) - 0.055f;
+        return 1.055f * std::pow(u, 1.0f / 2.4f) - 0.055f;
     }
 }
 
@@ -45,6 +48,66 @@ constexpr matrix3 XYZ_to_sRGB =
     }
 }
 
+/** Convert four linear values to sRGB gamma, without calling std::pow().
+ *
+ * The curve is evaluated as a 5th degree polynomial of `u^(1/4)`, with an absolute error below 0.00002.
+ * Values above 1.0 are rare and are calculated exactly with the scalar function.
+ */
+[[nodiscard]] inline f32x4 sRGB_linear_to_gamma(f32x4 u) noexcept
+{
+    if (gt(u, f32x4::broadcast(1.0f)) != 0) {
+        [[unlikely]] return f32x4{
+            sRGB_linear_to_gamma(u.x()), sRGB_linear_to_gamma(u.y()), sRGB_linear_to_gamma(u.z()), sRGB_linear_to_gamma(u.w())};
+    }
+
+    // (u^(1/4))^(5/3) == u^(1/2.4)
+    ttlet t = sqrt(sqrt(u));
+    auto p = t * -5.948719577e-02f + 2.585329324e-01f;
+    p = p * t - 5.284887669e-01f;
+    p = p * t + 1.179349759e+00f;
+    p = p * t + 1.563734600e-01f;
+    p = p * t - 6.284081175e-03f;
+    ttlet curve = p * 1.055f - 0.055f;
+    ttlet linear = u * 12.92f;
+
+    auto r = f32x4{};
+    for (size_t i = 0; i != 4; ++i) {
+        r[i] = u[i] <= 0.0031308f ? linear[i] : curve[i];
+    }
+    return r;
+}
+
+/** Convert four sRGB gamma values to linear, without calling std::pow().
+ *
+ * With `x = (u + 0.055) / 1.055` the curve is evaluated as `x^2` times a 5th degree polynomial
+ * of `sqrt(x)`, with a relative error below 0.00003.
+ * Values above 1.0 are rare and are calculated exactly with the scalar function.
+ */
+[[nodiscard]] inline f32x4 sRGB_gamma_to_linear(f32x4 u) noexcept
+{
+    if (gt(u, f32x4::broadcast(1.0f)) != 0) {
+        [[unlikely]] return f32x4{
+            sRGB_gamma_to_linear(u.x()), sRGB_gamma_to_linear(u.y()), sRGB_gamma_to_linear(u.z()), sRGB_gamma_to_linear(u.w())};
+    }
+
+    // x^2 * sqrt(x)^0.8 == x^2.4
+    ttlet x = (u + 0.055f) * (1.0f / 1.055f);
+    ttlet t = sqrt(x);
+    auto p = t * 8.797514900e-02f - 3.724940359e-01f;
+    p = p * t + 6.784268898e-01f;
+    p = p * t - 7.536025212e-01f;
+    p = p * t + 1.322428747e+00f;
+    p = p * t + 3.726972582e-02f;
+    ttlet curve = x * x * p;
+    ttlet linear = u * (1.0f / 12.92f);
+
+    auto r = f32x4{};
+    for (size_t i = 0; i != 4; ++i) {
+        r[i] = u[i] <= 0.04045f ? linear[i] : curve[i];
+    }
+    return r;
+}
+
 [[nodiscard]] inline auto sRGB_linear16_to_gamma8_table_generator() noexcept
 {
     std::array<uint8_t,65536> r{};
@@ -85,6 +148,37 @@ inline auto sRGB_gamma8_to_linear16_table = sRGB_gamma8_to_linear16_table_genera
     return sRGB_gamma8_to_linear16_table[u];
 }
 
+[[nodiscard]] inline auto sRGB_gamma8_to_linear_table_generator() noexcept
+{
+    std::array<float, 256> r{};
+
+    for (int i = 0; i != 256; ++i) {
+        r[i] = sRGB_gamma_to_linear(i / 255.0f);
+    }
+
+    return r;
+}
+
+inline auto sRGB_gamma8_to_linear_table = sRGB_gamma8_to_linear_table_generator();
+
+/** A table to convert 16-bit sRGB gamma values to linear floats.
+ * The table is 256 kByte, and is therefor only generated on first use.
+ */
+[[nodiscard]] inline std::array<float, 65536> const &sRGB_gamma16_to_linear_table() noexcept
+{
+    static auto const table = [] {
+        auto r = std::make_unique<std::array<float, 65536>>();
+        for (int i = 0; i != 65536; i += 4) {
+            ttlet u = f32x4{narrow_cast<float>(i), narrow_cast<float>(i + 1), narrow_cast<float>(i + 2), narrow_cast<float>(i + 3)};
+            ttlet linear = sRGB_gamma_to_linear(u * (1.0f / 65535.0f));
+            std::copy(linear.begin(), linear.end(), r->begin() + i);
+        }
+        return r;
+    }();
+
+    return *table;
+}
+
 [[nodiscard]] inline color color_from_sRGB(float r, float g, float b, float a) noexcept
 {
     return color{
@@ -96,7 +190,41 @@ inline auto sRGB_gamma8_to_linear16_table = sRGB_gamma8_to_linear16_table_genera
 
 [[nodiscard]] inline color color_from_sRGB(uint8_t r, uint8_t g, uint8_t b, uint8_t a) noexcept
 {
-    return color_from_sRGB(r / 255.0f, g / 255.0f, b / 255.0f, a / 255.0f);
+    return color{
+        sRGB_gamma8_to_linear_table[r], sRGB_gamma8_to_linear_table[g], sRGB_gamma8_to_linear_table[b], a / 255.0f};
+}
+
+/** Convert sRGB gamma encoded values to linear colors.
+ * The alpha channel is copied unchanged.
+ *
+ * @param src The gamma encoded red, green, blue and alpha values.
+ * @param dst The linear colors, must be the same size as src.
+ */
+inline void color_from_sRGB(std::span<f32x4 const> src, std::span<color> dst) noexcept
+{
+    tt_axiom(src.size() == dst.size());
+    for (size_t i = 0; i != src.size(); ++i) {
+        auto tmp = sRGB_gamma_to_linear(src[i]);
+        tmp.w() = src[i].w();
+        dst[i] = color{tmp};
+    }
+}
+
+/** Convert linear colors to sRGB gamma encoded values.
+ * The alpha channel is copied unchanged.
+ *
+ * @param src The linear colors.
+ * @param dst The gamma encoded red, green, blue and alpha values, must be the same size as src.
+ */
+inline void color_to_sRGB(std::span<color const> src, std::span<f32x4> dst) noexcept
+{
+    tt_axiom(src.size() == dst.size());
+    for (size_t i = 0; i != src.size(); ++i) {
+        ttlet linear = static_cast<f32x4>(src[i]);
+        auto tmp = sRGB_linear_to_gamma(linear);
+        tmp.w() = linear.w();
+        dst[i] = tmp;
+    }
 }
 
 [[nodiscard]] inline color color_from_sRGB(std::string_view str)
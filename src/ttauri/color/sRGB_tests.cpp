@@ -0,0 +1,76 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/color/sRGB.hpp"
+#include <gtest/gtest.h>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace tt;
+
+TEST(sRGB, gamma_to_linear_f32x4)
+{
+    for (int i = 0; i <= 1200; i += 3) {
+        ttlet u = f32x4{i / 1000.0f, (i + 1) / 1000.0f, (i + 2) / 1000.0f, 0.0f};
+        ttlet r = sRGB_gamma_to_linear(u);
+        for (size_t j = 0; j != 4; ++j) {
+            ASSERT_NEAR(r[j], sRGB_gamma_to_linear(u[j]), 0.0001f) << "u=" << u[j];
+        }
+    }
+}
+
+TEST(sRGB, linear_to_gamma_f32x4)
+{
+    for (int i = 0; i <= 1200; i += 3) {
+        ttlet u = f32x4{i / 1000.0f, (i + 1) / 1000.0f, (i + 2) / 1000.0f, 0.0f};
+        ttlet r = sRGB_linear_to_gamma(u);
+        for (size_t j = 0; j != 4; ++j) {
+            ASSERT_NEAR(r[j], sRGB_linear_to_gamma(u[j]), 0.0001f) << "u=" << u[j];
+        }
+    }
+}
+
+TEST(sRGB, round_trip)
+{
+    for (int i = 0; i != 256; ++i) {
+        ttlet u = i / 255.0f;
+        ASSERT_NEAR(sRGB_linear_to_gamma(sRGB_gamma_to_linear(u)), u, 0.0001f);
+    }
+}
+
+TEST(sRGB, gamma8_to_linear_table)
+{
+    for (int i = 0; i != 256; ++i) {
+        ASSERT_NEAR(sRGB_gamma8_to_linear_table[i], sRGB_gamma_to_linear(i / 255.0f), 0.000001f);
+    }
+
+    ttlet &table = sRGB_gamma16_to_linear_table();
+    ASSERT_EQ(table[0], 0.0f);
+    ASSERT_NEAR(table[65535], 1.0f, 0.0001f);
+    ASSERT_NEAR(table[32768], sRGB_gamma_to_linear(32768.0f / 65535.0f), 0.0001f);
+}
+
+TEST(sRGB, batch_conversion)
+{
+    auto gamma = std::vector<f32x4>{};
+    for (int i = 0; i != 100; ++i) {
+        gamma.emplace_back(i / 99.0f, 1.0f - i / 99.0f, 0.5f, i / 198.0f);
+    }
+
+    auto linear = std::vector<color>(gamma.size());
+    color_from_sRGB(gamma, linear);
+
+    auto gamma2 = std::vector<f32x4>(gamma.size());
+    color_to_sRGB(linear, gamma2);
+
+    for (size_t i = 0; i != gamma.size(); ++i) {
+        ASSERT_NEAR(linear[i].r(), sRGB_gamma_to_linear(gamma[i].x()), 0.0001f);
+        ASSERT_NEAR(linear[i].g(), sRGB_gamma_to_linear(gamma[i].y()), 0.0001f);
+        ASSERT_EQ(linear[i].a(), gamma[i].w());
+        for (size_t j = 0; j != 4; ++j) {
+            ASSERT_NEAR(gamma2[i][j], gamma[i][j], 0.0001f);
+        }
+    }
+}
@@ -12,6 +12,8 @@
 #include <immintrin.h>
 #include <emmintrin.h>
 #include <algorithm>
+#include <array>
+#include <span>
 
 namespace tt {
 
@@ -89,49 +91,139 @@ public:
     }
 };
 
+/** Convert pixels to sfloat_rgba16, two pixels per instruction.
+ *
+ * @param src The pixels to convert.
+ * @param dst The converted pixels, must be the same size as src.
+ */
+inline void to_sfloat_rgba16(std::span<f32x4 const> src, std::span<sfloat_rgba16> dst) noexcept
+{
+    static_assert(sizeof(f32x4) == 4 * sizeof(float));
+    static_assert(sizeof(sfloat_rgba16) == 4 * sizeof(float16));
+    tt_axiom(src.size() == dst.size());
+
+    float_to_float16(
+        std::span{reinterpret_cast<float const *>(src.data()), src.size() * 4},
+        std::span{reinterpret_cast<float16 *>(dst.data()), dst.size() * 4});
+}
+
+/** Convert sfloat_rgba16 pixels to f32x4, two pixels per instruction.
+ *
+ * @param src The pixels to convert.
+ * @param dst The converted pixels, must be the same size as src.
+ */
+inline void to_f32x4(std::span<sfloat_rgba16 const> src, std::span<f32x4> dst) noexcept
+{
+    static_assert(sizeof(f32x4) == 4 * sizeof(float));
+    static_assert(sizeof(sfloat_rgba16) == 4 * sizeof(float16));
+    tt_axiom(src.size() == dst.size());
+
+    float16_to_float(
+        std::span{reinterpret_cast<float16 const *>(src.data()), src.size() * 4},
+        std::span{reinterpret_cast<float *>(dst.data()), dst.size() * 4});
+}
+
 inline void fill(pixel_map<sfloat_rgba16> &image, f32x4 color) noexcept
 {
+    // Convert the color only once.
+    ttlet color_ = sfloat_rgba16{color};
     for (ssize_t y = 0; y != image.height(); ++y) {
         auto row = image[y];
-        for (ssize_t x = 0; x != image.width(); ++x) {
-            row[x] = color;
-        }
+        std::fill_n(row.data(), row.width(), color_);
     }
 }
 
+/** The number of pixels that are converted to f32x4 at a time while compositing.
+ */
+constexpr ssize_t sfloat_rgba16_chunk_size = 64;
+
 inline void composit(pixel_map<sfloat_rgba16> &under, pixel_map<sfloat_rgba16> const &over) noexcept
 {
     tt_assert(over.height() >= under.height());
     tt_assert(over.width() >= under.width());
 
+    auto underPixels = std::array<f32x4, sfloat_rgba16_chunk_size>{};
+    auto overPixels = std::array<f32x4, sfloat_rgba16_chunk_size>{};
+
     for (ssize_t rowNr = 0; rowNr != under.height(); ++rowNr) {
         ttlet overRow = over.at(rowNr);
         auto underRow = under.at(rowNr);
-        for (ssize_t columnNr = 0; columnNr != under.width(); ++columnNr) {
-            ttlet &overPixel = overRow[columnNr];
-            auto &underPixel = underRow[columnNr];
-
-            underPixel = composit(static_cast<f32x4>(underPixel), static_cast<f32x4>(overPixel));
+        for (ssize_t columnNr = 0; columnNr < under.width(); columnNr += sfloat_rgba16_chunk_size) {
+            ttlet size = narrow_cast<size_t>(std::min(sfloat_rgba16_chunk_size, under.width() - columnNr));
+            ttlet underChunk = std::span{underRow.data() + columnNr, size};
+            ttlet under_ = std::span{underPixels.data(), size};
+            ttlet over_ = std::span{overPixels.data(), size};
+
+            to_f32x4(underChunk, under_);
+            to_f32x4(std::span{overRow.data() + columnNr, size}, over_);
+            for (size_t i = 0; i != size; ++i) {
+                under_[i] = composit(under_[i], over_[i]);
+            }
+            to_sfloat_rgba16(under_, underChunk);
         }
     }
 }
 
+/** Composit a color through a mask over an image.
+ *
+ * The mask is handled in chunks; chunks which are fully transparent are skipped, and when the
+ * color is opaque, chunks which are fully covered are filled without converting the image to float.
+ *
+ * @param under The image to draw on.
+ * @param over The color to draw.
+ * @param mask The coverage of each pixel, 0 is transparent, 255 is fully covered.
+ */
 inline void composit(pixel_map<sfloat_rgba16> &under, color over, pixel_map<uint8_t> const &mask) noexcept
 {
     tt_assert(mask.height() >= under.height());
     tt_assert(mask.width() >= under.width());
 
-    auto maskPixel = color{1.0f, 1.0f, 1.0f, 1.0f};
+    ttlet over_ = static_cast<f32x4>(over);
+    if (over_.is_transparent()) {
+        return;
+    }
+
+    ttlet over_is_opaque = over_.is_opaque();
+    ttlet over_color = over_.xyz1();
+    ttlet over_pixel = sfloat_rgba16{over_};
+    ttlet mask_to_alpha = over_.w() / 255.0f;
+
+    auto underPixels = std::array<f32x4, sfloat_rgba16_chunk_size>{};
 
     for (ssize_t rowNr = 0; rowNr != under.height(); ++rowNr) {
         ttlet maskRow = mask.at(rowNr);
         auto underRow = under.at(rowNr);
-        for (ssize_t columnNr = 0; columnNr != under.width(); ++columnNr) {
-            ttlet maskValue = maskRow[columnNr] / 255.0f;
-            maskPixel.a() = maskValue;
-
-            auto &pixel = underRow[columnNr];
-            pixel = composit(static_cast<color>(pixel), over * maskPixel);
+        for (ssize_t columnNr = 0; columnNr < under.width(); columnNr += sfloat_rgba16_chunk_size) {
+            ttlet size = narrow_cast<size_t>(std::min(sfloat_rgba16_chunk_size, under.width() - columnNr));
+            ttlet maskChunk = std::span{maskRow.data() + columnNr, size};
+            ttlet underChunk = std::span{underRow.data() + columnNr, size};
+
+            if (std::all_of(maskChunk.begin(), maskChunk.end(), [](ttlet m) { return m == 0; })) {
+                continue;
+            }
+            if (over_is_opaque && std::all_of(maskChunk.begin(), maskChunk.end(), [](ttlet m) { return m == 255; })) {
+                std::fill_n(underChunk.begin(), size, over_pixel);
+                continue;
+            }
+
+            ttlet under_ = std::span{underPixels.data(), size};
+            to_f32x4(underChunk, under_);
+            for (size_t i = 0; i != size; ++i) {
+                ttlet m = maskChunk[i];
+                if (m == 0) {
+                    continue;
+                } else if (m == 255 && over_is_opaque) {
+                    under_[i] = over_;
+                    continue;
+                }
+
+                // The same as `composit(under, over * color{1.0f, 1.0f, 1.0f, m / 255.0f})`.
+                ttlet over_alpha = f32x4::broadcast(mask_to_alpha * m);
+                ttlet under_alpha = under_[i].wwww();
+                ttlet output_color = over_color * over_alpha + under_[i].xyz1() * under_alpha * (1.0f - over_alpha);
+                under_[i] = output_color / output_color.www1();
+            }
+            to_sfloat_rgba16(under_, underChunk);
         }
     }
 }
@@ -48,6 +48,7 @@ enum class command {
     gui_activate,
     gui_enter,
     gui_escape,
+    gui_toggle_performance_overlay,
 };
 
 constexpr char const *to_const_string(command rhs) noexcept
@@ -89,6 +90,7 @@ constexpr char const *to_const_string(command rhs) noexcept
     case command::gui_activate: return "gui_activate";
     case command::gui_enter: return "gui_enter";
     case command::gui_escape: return "gui_escape";
+    case command::gui_toggle_performance_overlay: return "gui_toggle_performance_overlay";
     default:
         tt_no_default();
     }
@@ -174,6 +176,8 @@ constexpr command to_command(std::string_view name) noexcept
         return command::gui_enter;
     } else if (name == "gui_escape") {
         return command::gui_escape;
+    } else if (name == "gui_toggle_performance_overlay") {
+        return command::gui_toggle_performance_overlay;
     } else {
         return command::unknown;
     }
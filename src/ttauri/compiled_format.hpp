@@ -0,0 +1,268 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "fixed_string.hpp"
+#include "exception.hpp"
+#include "required.hpp"
+#include <fmt/format.h>
+#include <array>
+#include <algorithm>
+#include <tuple>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <iterator>
+#include <cstdint>
+#include <cstddef>
+
+namespace tt {
+namespace detail {
+
+/** A segment of a format string; either literal text or a replacement field.
+ */
+struct format_segment {
+    /** The index of the argument of a replacement field, or -1 for literal text.
+     */
+    int arg_index = -1;
+
+    /** The offset of the literal text in the format string.
+     * For a replacement field the offset of the format-spec, including the leading ':'.
+     */
+    size_t first = 0;
+
+    /** The offset one beyond the literal text or the format-spec.
+     */
+    size_t last = 0;
+
+    [[nodiscard]] constexpr bool is_literal() const noexcept
+    {
+        return arg_index < 0;
+    }
+
+    [[nodiscard]] constexpr size_t size() const noexcept
+    {
+        return last - first;
+    }
+};
+
+/** Split a format string into literal text and replacement fields.
+ *
+ * The syntax is that of `fmt::format()`; escaped braces become a literal segment of
+ * the single brace. Nested replacement fields, such as a dynamic width, and named
+ * arguments are not supported.
+ *
+ * When called during constant evaluation an error in the format string is a compile error.
+ *
+ * @param fmt The format string.
+ * @param segments An array for the segments, or nullptr to only count the segments.
+ * @return The number of segments.
+ * @throws parse_error When the format string is invalid.
+ */
+constexpr size_t parse_format(std::string_view fmt, format_segment *segments = nullptr)
+{
+    size_t nr_segments = 0;
+    ttlet add = [&](int arg_index, size_t first, size_t last) {
+        if (segments != nullptr) {
+            segments[nr_segments] = format_segment{arg_index, first, last};
+        }
+        ++nr_segments;
+    };
+
+    auto next_arg_index = 0;
+    auto uses_auto_index = false;
+    auto uses_manual_index = false;
+
+    auto literal_first = size_t{0};
+    auto i = size_t{0};
+    while (i != fmt.size()) {
+        ttlet c = fmt[i];
+        if (c != '{' and c != '}') {
+            ++i;
+            continue;
+        }
+
+        if (literal_first != i) {
+            add(-1, literal_first, i);
+        }
+
+        if (i + 1 != fmt.size() and fmt[i + 1] == c) {
+            // An escaped brace.
+            add(-1, i, i + 1);
+            literal_first = i += 2;
+            continue;
+
+        } else if (c == '}') {
+            throw parse_error("Unmatched '}' in format string.");
+        }
+
+        // The optional argument index.
+        ++i;
+        auto arg_index = -1;
+        while (i != fmt.size() and fmt[i] >= '0' and fmt[i] <= '9') {
+            arg_index = (arg_index < 0 ? 0 : arg_index * 10) + (fmt[i++] - '0');
+        }
+
+        if (arg_index < 0) {
+            uses_auto_index = true;
+            arg_index = next_arg_index++;
+        } else {
+            uses_manual_index = true;
+        }
+        if (uses_auto_index and uses_manual_index) {
+            throw parse_error("Mixing automatic and manual argument indexing in format string.");
+        }
+
+        // The optional format-spec.
+        ttlet spec_first = i;
+        if (i != fmt.size() and fmt[i] == ':') {
+            while (i != fmt.size() and fmt[i] != '}') {
+                if (fmt[i] == '{') {
+                    throw parse_error("Nested replacement fields are not supported in format string.");
+                }
+                ++i;
+            }
+        }
+
+        if (i == fmt.size() or fmt[i] != '}') {
+            throw parse_error("Invalid replacement field in format string.");
+        }
+
+        add(arg_index, spec_first, i);
+        literal_first = ++i;
+    }
+
+    if (literal_first != i) {
+        add(-1, literal_first, i);
+    }
+    return nr_segments;
+}
+
+template<basic_fixed_string Fmt>
+[[nodiscard]] constexpr auto parse_format()
+{
+    constexpr auto fmt = std::string_view{Fmt.data(), Fmt.size()};
+
+    auto r = std::array<format_segment, parse_format(fmt)>{};
+    parse_format(fmt, r.data());
+    return r;
+}
+
+/** The format string for a single argument: "{" format-spec "}".
+ */
+template<basic_fixed_string Fmt, format_segment Segment>
+constexpr auto field_format = [] {
+    auto r = std::array<char, Segment.size() + 2>{};
+    r.front() = '{';
+    for (size_t i = 0; i != Segment.size(); ++i) {
+        r[i + 1] = Fmt.data()[Segment.first + i];
+    }
+    r.back() = '}';
+    return r;
+}();
+
+template<typename T>
+constexpr bool is_formatted_as_string_v = std::is_same_v<T, std::string> or std::is_same_v<T, std::string_view> or
+    std::is_same_v<T, char const *> or std::is_same_v<T, char *>;
+
+template<typename T>
+constexpr bool is_formatted_as_integer_v = std::is_integral_v<T> and not std::is_same_v<T, bool> and
+    not std::is_same_v<T, char> and not std::is_same_v<T, char8_t> and not std::is_same_v<T, char16_t> and
+    not std::is_same_v<T, char32_t> and not std::is_same_v<T, wchar_t>;
+
+} // namespace detail
+
+/** A format string that is parsed at compile time.
+ *
+ * The format string is split at compile time into literal text and replacement fields, so that
+ * an invalid format string, or a replacement field without an argument, is a compile error.
+ * Formatting appends the literal text directly and formats each argument on its own;
+ * strings and integers without a format-spec are appended without calling `fmt::format()`.
+ *
+ * The format-spec of a replacement field is checked against the type of the argument
+ * by `fmt::format()` when the argument is formatted.
+ *
+ * @tparam Fmt The format string, in the syntax of `fmt::format()`.
+ */
+template<basic_fixed_string Fmt>
+class compiled_format {
+public:
+    static_assert(std::is_same_v<typename decltype(Fmt)::value_type, char>, "Fmt must be a basic_fixed_string<char>");
+
+    /** The segments of the format string.
+     */
+    static constexpr auto segments = detail::parse_format<Fmt>();
+
+    /** The number of arguments used by the format string.
+     */
+    static constexpr size_t nr_arguments = [] {
+        auto r = size_t{0};
+        for (ttlet &segment : segments) {
+            if (not segment.is_literal()) {
+                r = std::max(r, static_cast<size_t>(segment.arg_index) + 1);
+            }
+        }
+        return r;
+    }();
+
+    /** Format the arguments and append them to a string.
+     *
+     * @param out The string to append to.
+     * @param args The arguments to format.
+     */
+    template<typename... Args>
+    static void format_to(std::string &out, Args const &...args)
+    {
+        static_assert(sizeof...(Args) >= nr_arguments, "Not enough arguments for the format string.");
+
+        ttlet arg_refs = std::tie(args...);
+        [&]<size_t... I>(std::index_sequence<I...>)
+        {
+            (format_segment_to<segments[I]>(out, arg_refs), ...);
+        }
+        (std::make_index_sequence<segments.size()>{});
+    }
+
+    /** Format the arguments.
+     *
+     * @param args The arguments to format.
+     * @return The formatted string.
+     */
+    template<typename... Args>
+    [[nodiscard]] static std::string format(Args const &...args)
+    {
+        auto r = std::string{};
+        format_to(r, args...);
+        return r;
+    }
+
+private:
+    template<detail::format_segment Segment, typename ArgRefs>
+    static void format_segment_to(std::string &out, ArgRefs const &arg_refs)
+    {
+        if constexpr (Segment.is_literal()) {
+            out.append(Fmt.data() + Segment.first, Segment.size());
+
+        } else {
+            ttlet &arg = std::get<Segment.arg_index>(arg_refs);
+            using arg_type = std::remove_cvref_t<decltype(arg)>;
+
+            if constexpr (Segment.size() == 0 and detail::is_formatted_as_string_v<arg_type>) {
+                out.append(arg);
+
+            } else if constexpr (Segment.size() == 0 and detail::is_formatted_as_integer_v<arg_type>) {
+                ttlet str = fmt::format_int(arg);
+                out.append(str.data(), str.size());
+
+            } else {
+                constexpr auto &field_fmt = detail::field_format<Fmt, Segment>;
+                fmt::vformat_to(
+                    std::back_inserter(out), fmt::string_view{field_fmt.data(), field_fmt.size()}, fmt::make_format_args(arg));
+            }
+        }
+    }
+};
+
+} // namespace tt
@@ -0,0 +1,74 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "compiled_format.hpp"
+#include "delayed_format.hpp"
+#include <gtest/gtest.h>
+#include <iostream>
+#include <string>
+
+using namespace std::literals;
+
+TEST(compiled_format, segments)
+{
+    using format = tt::compiled_format<"a{}bc{:x}{{d}}">;
+    static_assert(format::segments.size() == 7);
+    static_assert(format::nr_arguments == 2);
+
+    static_assert(format::segments[0].is_literal() and format::segments[0].size() == 1);
+    static_assert(format::segments[1].arg_index == 0 and format::segments[1].size() == 0);
+    static_assert(format::segments[2].is_literal() and format::segments[2].size() == 2);
+    static_assert(format::segments[3].arg_index == 1 and format::segments[3].size() == 2);
+    static_assert(format::segments[4].is_literal() and format::segments[4].size() == 1);
+    static_assert(format::segments[5].is_literal() and format::segments[5].size() == 1);
+    static_assert(format::segments[6].is_literal() and format::segments[6].size() == 1);
+
+    static_assert(tt::compiled_format<"">::segments.size() == 0);
+    static_assert(tt::compiled_format<"{1}{0}">::nr_arguments == 2);
+}
+
+TEST(compiled_format, parse_errors)
+{
+    ASSERT_THROW(tt::detail::parse_format("{"), tt::parse_error);
+    ASSERT_THROW(tt::detail::parse_format("}"), tt::parse_error);
+    ASSERT_THROW(tt::detail::parse_format("{:x"), tt::parse_error);
+    ASSERT_THROW(tt::detail::parse_format("{a}"), tt::parse_error);
+    ASSERT_THROW(tt::detail::parse_format("{}{0}"), tt::parse_error);
+    ASSERT_THROW(tt::detail::parse_format("{:{}}"), tt::parse_error);
+    ASSERT_EQ(tt::detail::parse_format("{{}}"), 2);
+}
+
+TEST(compiled_format, format)
+{
+    ASSERT_EQ(tt::compiled_format<"hello world">::format(), "hello world"s);
+    ASSERT_EQ(tt::compiled_format<"{} {}">::format("hello"s, "world"), "hello world"s);
+    ASSERT_EQ(tt::compiled_format<"{1} {0}">::format("world"sv, "hello"), "hello world"s);
+    ASSERT_EQ(tt::compiled_format<"{{{}}}">::format(42), "{42}"s);
+    ASSERT_EQ(tt::compiled_format<"{} {} {}">::format(-5, 7u, true), "-5 7 true"s);
+    ASSERT_EQ(tt::compiled_format<"{:x} {:>4} {:.2f}">::format(255, "ab", 1.5), "ff   ab 1.50"s);
+    ASSERT_EQ(tt::compiled_format<"{}{}">::format('a', 2.5), "a2.5"s);
+}
+
+TEST(compiled_format, same_as_fmt)
+{
+    ttlet expected = fmt::format("x={:5} y={:<3}| z={:08.3f} {}", 12, "ab", 3.14159, 'c');
+    ASSERT_EQ(tt::compiled_format<"x={:5} y={:<3}| z={:08.3f} {}">::format(12, "ab", 3.14159, 'c'), expected);
+}
+
+TEST(compiled_format, format_to)
+{
+    auto r = "prefix "s;
+    tt::compiled_format<"{}-{}">::format_to(r, 1, 2);
+    ASSERT_EQ(r, "prefix 1-2"s);
+}
+
+TEST(compiled_format, delayed_format)
+{
+    auto f = tt::delayed_format<"{} {:03}", char const *, int>("hello", 7);
+    ASSERT_EQ(f(), "hello 007"s);
+
+    auto r = "> "s;
+    f.format_to(r);
+    ASSERT_EQ(r, "> hello 007"s);
+}
@@ -4,10 +4,15 @@
 
 #pragma once
 
+#include "required.hpp"
+#include "assert.hpp"
 #include <ranges>
 #include <concepts>
 #include <coroutine>
 #include <optional>
+#include <exception>
+#include <mutex>
+#include <condition_variable>
 
 namespace tt {
 
@@ -159,5 +164,291 @@ private:
     handle_type _coroutine;
 };
 
-} // namespace tt
+template<typename T>
+class task;
+
+namespace detail {
+
+template<typename T>
+class task_promise_base {
+public:
+    static std::suspend_always initial_suspend() noexcept
+    {
+        return {};
+    }
+
+    /** At the end of the task resume the coroutine that awaits it.
+     */
+    class final_awaiter {
+    public:
+        [[nodiscard]] static bool await_ready() noexcept
+        {
+            return false;
+        }
+
+        template<typename Promise>
+        [[nodiscard]] std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+        {
+            auto &promise = handle.promise();
+            if (promise._detached) {
+                handle.destroy();
+                return std::noop_coroutine();
+            } else if (promise._continuation) {
+                return promise._continuation;
+            } else {
+                return std::noop_coroutine();
+            }
+        }
+
+        static void await_resume() noexcept {}
+    };
 
+    static final_awaiter final_suspend() noexcept
+    {
+        return {};
+    }
+
+    void unhandled_exception() noexcept
+    {
+        // A detached task has no one to receive the exception.
+        tt_axiom(!_detached);
+        _exception = std::current_exception();
+    }
+
+protected:
+    std::coroutine_handle<> _continuation;
+    std::exception_ptr _exception;
+    bool _detached = false;
+
+    void rethrow_exception() const
+    {
+        if (_exception) {
+            std::rethrow_exception(_exception);
+        }
+    }
+
+    friend class task<T>;
+};
+
+template<typename T>
+class task_promise : public task_promise_base<T> {
+public:
+    task<T> get_return_object() noexcept;
+
+    template<typename U = T> requires(std::convertible_to<U, T>)
+    void return_value(U &&value) noexcept(std::is_nothrow_constructible_v<T, U>)
+    {
+        _value.emplace(std::forward<U>(value));
+    }
+
+    T result()
+    {
+        this->rethrow_exception();
+        tt_axiom(_value);
+        return std::move(*_value);
+    }
+
+private:
+    std::optional<T> _value;
+};
+
+template<>
+class task_promise<void> : public task_promise_base<void> {
+public:
+    task<void> get_return_object() noexcept;
+
+    void return_void() noexcept {}
+
+    void result()
+    {
+        this->rethrow_exception();
+    }
+};
+
+} // namespace detail
+
+/** A return value for a task-function.
+ * A task-function is a coroutine which co_returns a single value, and may co_await
+ * other tasks and awaitables, such as those in awaitable.hpp.
+ *
+ * A task is lazy, the task-function is started when the task is co_awaited, passed to
+ * `sync_wait()` or detached. When the task-function finishes the coroutine that
+ * awaits the task is resumed on the same thread.
+ */
+template<typename T = void>
+class task {
+public:
+    using value_type = T;
+    using promise_type = detail::task_promise<T>;
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    explicit task(handle_type coroutine) noexcept : _coroutine(coroutine) {}
+
+    task() = default;
+    ~task()
+    {
+        if (_coroutine) {
+            _coroutine.destroy();
+        }
+    }
+
+    task(task const &) = delete;
+    task &operator=(task const &) = delete;
+
+    task(task &&other) noexcept : _coroutine{other._coroutine}
+    {
+        tt_axiom(&other != this);
+        other._coroutine = {};
+    }
+
+    task &operator=(task &&other) noexcept
+    {
+        tt_return_on_self_assignment(other);
+        if (_coroutine) {
+            _coroutine.destroy();
+        }
+        _coroutine = other._coroutine;
+        other._coroutine = {};
+        return *this;
+    }
+
+    /** Check if the task-function has finished.
+     */
+    [[nodiscard]] bool done() const noexcept
+    {
+        return !_coroutine || _coroutine.done();
+    }
+
+    [[nodiscard]] bool await_ready() const noexcept
+    {
+        tt_axiom(_coroutine);
+        return _coroutine.done();
+    }
+
+    /** Start the task-function, which resumes the awaiting coroutine when it is finished.
+     */
+    [[nodiscard]] std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+    {
+        _coroutine.promise()._continuation = awaiting;
+        return _coroutine;
+    }
+
+    /** Retrieve the value co_returned by the task-function.
+     * @throws The exception thrown by the task-function.
+     */
+    T await_resume()
+    {
+        return _coroutine.promise().result();
+    }
+
+    /** Start the task-function without waiting for it.
+     * The task-function destroys itself when it is finished, it must not throw.
+     */
+    void detach() && noexcept
+    {
+        tt_axiom(_coroutine and not _coroutine.done());
+        auto coroutine = std::exchange(_coroutine, {});
+        coroutine.promise()._detached = true;
+        coroutine.resume();
+    }
+
+private:
+    handle_type _coroutine;
+};
+
+template<typename T>
+task<T> detail::task_promise<T>::get_return_object() noexcept
+{
+    return task<T>{task<T>::handle_type::from_promise(*this)};
+}
+
+inline task<void> detail::task_promise<void>::get_return_object() noexcept
+{
+    return task<void>{task<void>::handle_type::from_promise(*this)};
+}
+
+namespace detail {
+
+/** A coroutine that is started directly and signals when it finishes.
+ * Used by `sync_wait()` to block on a task.
+ */
+class sync_wait_coroutine {
+public:
+    class promise_type {
+    public:
+        sync_wait_coroutine get_return_object() noexcept
+        {
+            return {};
+        }
+
+        static std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        static std::suspend_never final_suspend() noexcept
+        {
+            return {};
+        }
+
+        static void return_void() noexcept {}
+
+        [[noreturn]] static void unhandled_exception() noexcept
+        {
+            tt_no_default();
+        }
+    };
+};
+
+} // namespace detail
+
+/** Block the current thread until a task is finished.
+ *
+ * @param task The task to start and wait for.
+ * @return The value co_returned by the task-function.
+ * @throws The exception thrown by the task-function.
+ */
+template<typename T>
+T sync_wait(task<T> task)
+{
+    auto mutex = std::mutex{};
+    auto condition = std::condition_variable{};
+    auto done = false;
+
+    // Only wait for the task to finish, the exception is retrieved from the task below.
+    auto wait_for = [](tt::task<T> &task, std::mutex &mutex, std::condition_variable &condition, bool &done)
+        -> detail::sync_wait_coroutine {
+        struct completion {
+            tt::task<T> &task;
+
+            [[nodiscard]] bool await_ready() const noexcept
+            {
+                return task.await_ready();
+            }
+
+            [[nodiscard]] std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+            {
+                return task.await_suspend(awaiting);
+            }
+
+            static void await_resume() noexcept {}
+        };
+
+        co_await completion{task};
+
+        // Notify while holding the lock, so that the waiting thread can not destroy
+        // the condition variable before the notify is finished.
+        ttlet lock = std::scoped_lock(mutex);
+        done = true;
+        condition.notify_one();
+    };
+    wait_for(task, mutex, condition, done);
+
+    auto lock = std::unique_lock(mutex);
+    condition.wait(lock, [&done] {
+        return done;
+    });
+    return task.await_resume();
+}
+
+} // namespace tt
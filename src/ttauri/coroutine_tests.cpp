@@ -5,6 +5,7 @@
 #include "ttauri/coroutine.hpp"
 #include <gtest/gtest.h>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 
 using namespace std;
@@ -53,3 +54,46 @@ TEST(concepts, generator_temporary)
     }
 }
 
+
+task<int> add_task(int a, int b)
+{
+    co_return a + b;
+}
+
+task<int> sum_task(int n)
+{
+    auto sum = 0;
+    for (int i = 0; i != n; ++i) {
+        sum += co_await add_task(i, 1);
+    }
+    co_return sum;
+}
+
+task<void> throw_task()
+{
+    co_await add_task(1, 2);
+    throw std::runtime_error("task failed");
+}
+
+TEST(concepts, task)
+{
+    auto test = sum_task(100);
+    ASSERT_FALSE(test.done());
+    ASSERT_EQ(sync_wait(std::move(test)), 5050);
+}
+
+TEST(concepts, task_exception)
+{
+    ASSERT_THROW(sync_wait(throw_task()), std::runtime_error);
+}
+
+TEST(concepts, task_detach)
+{
+    auto count = 0;
+    auto counting_task = [](int &count) -> task<void> {
+        count += co_await add_task(1, 2);
+    };
+
+    counting_task(count).detach();
+    ASSERT_EQ(count, 3);
+}
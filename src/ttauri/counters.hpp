@@ -11,17 +11,73 @@
 #include "os_detect.hpp"
 #include "fixed_string.hpp"
 #include "statistics.hpp"
+#include "thread.hpp"
 #include <span>
 #include <typeinfo>
 #include <typeindex>
 #include <string>
+#include <string_view>
+#include <map>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
 
 namespace tt {
 
 constexpr int MAX_NR_COUNTERS = 1024;
 
+/** The number of shards of each counter.
+ */
+constexpr size_t NR_COUNTER_SHARDS = 16;
+
+/** A counter that is split into cache-line sized shards.
+ *
+ * Each thread adds to the shard selected by its thread id, so that threads
+ * that update the same counter do not bounce a single cache line between cores.
+ * Reading the counter sums all the shards.
+ */
+class sharded_counter {
+public:
+    constexpr sharded_counter() noexcept = default;
+    sharded_counter(sharded_counter const &) = delete;
+    sharded_counter(sharded_counter &&) = delete;
+    sharded_counter &operator=(sharded_counter const &) = delete;
+    sharded_counter &operator=(sharded_counter &&) = delete;
+
+    void add(int64_t value) noexcept
+    {
+        _shards[shard_index()].value.fetch_add(value, std::memory_order::relaxed);
+    }
+
+    [[nodiscard]] int64_t read() const noexcept
+    {
+        int64_t r = 0;
+        for (ttlet &shard : _shards) {
+            r += shard.value.load(std::memory_order::relaxed);
+        }
+        return r;
+    }
+
+private:
+    struct alignas(hardware_destructive_interference_size) shard_type {
+        std::atomic<int64_t> value = 0;
+    };
+
+    std::array<shard_type, NR_COUNTER_SHARDS> _shards;
+
+    [[nodiscard]] static size_t shard_index() noexcept
+    {
+        static_assert(std::has_single_bit(NR_COUNTER_SHARDS));
+        constexpr auto shift = 64 - std::bit_width(NR_COUNTER_SHARDS - 1);
+
+        // Thread ids are aligned addresses or multiples of four, so mix all the bits into the top bits.
+        return static_cast<size_t>((static_cast<uint64_t>(current_thread_id()) * 0x9e37'79b9'7f4a'7c15ULL) >> shift);
+    }
+};
+
 struct counter_map_value_type {
-    std::atomic<int64_t> *counter;
+    sharded_counter *counter;
     int64_t previous_value;
 };
 
@@ -33,38 +89,57 @@ inline counter_map_type counter_map;
 
 template<basic_fixed_string Tag>
 struct counter_functor {
-    // Make sure non of the counters are false sharing cache-lines.
-    alignas(hardware_destructive_interference_size) inline static std::atomic<int64_t> counter = 0;
+    inline static sharded_counter counter;
+
+    /** Set when the counter was added to the map.
+     * This flag is only written once, so after that the cache line is shared between the cores.
+     */
+    inline static std::atomic<bool> is_in_map = false;
 
     tt_no_inline void add_to_map() const noexcept
     {
-        counter_map.insert(Tag, counter_map_value_type{&counter, 0});
-        statistics_start();
+        if (not is_in_map.exchange(true, std::memory_order::relaxed)) {
+            counter_map.insert(Tag, counter_map_value_type{&counter, 0});
+            statistics_start();
+        }
+    }
+
+    void increment() const noexcept
+    {
+        add(1);
     }
 
-    int64_t increment() const noexcept
+    /** Add a value to the counter.
+     * This is also used for counters that track an amount of resources, such as bytes of memory,
+     * which may go up and down.
+     */
+    void add(int64_t value) const noexcept
     {
-        ttlet value = counter.fetch_add(1, std::memory_order::relaxed);
+        counter.add(value);
 
-        if (value == 0) {
+        if (not is_in_map.load(std::memory_order::relaxed)) {
             [[unlikely]] add_to_map();
         }
-
-        return value + 1;
     }
 
     [[nodiscard]] int64_t read() const noexcept
     {
-        return counter.load(std::memory_order::relaxed);
+        return counter.read();
     }
 
     // Don't implement readAndSet, a set to zero would cause the counters to be reinserted.
 };
 
 template<basic_fixed_string Tag>
-inline int64_t increment_counter() noexcept
+inline void increment_counter() noexcept
+{
+    counter_functor<Tag>{}.increment();
+}
+
+template<basic_fixed_string Tag>
+inline void add_to_counter(int64_t value) noexcept
 {
-    return counter_functor<Tag>{}.increment();
+    counter_functor<Tag>{}.add(value);
 }
 
 template<basic_fixed_string Tag>
@@ -81,10 +156,82 @@ template<basic_fixed_string Tag>
     auto &item = counter_map[tag];
 
     ttlet *const count_ptr = item.counter;
-    ttlet count = count_ptr != nullptr ? item.counter->load(std::memory_order::relaxed) : 0;
+    ttlet count = count_ptr != nullptr ? count_ptr->read() : 0;
     ttlet count_since_last_read = count - item.previous_value;
     item.previous_value = count;
     return {count, count_since_last_read};
 }
 
+/** The values of all counters at a point in time.
+ *
+ * Taking a snapshot does not modify the counters, so that multiple readers can each
+ * calculate the change since their own previous snapshot.
+ */
+class counter_snapshot {
+public:
+    using container_type = std::map<std::string, int64_t, std::less<>>;
+    using const_iterator = container_type::const_iterator;
+
+    counter_snapshot() noexcept = default;
+
+    /** Take a snapshot of all counters.
+     */
+    [[nodiscard]] static counter_snapshot take() noexcept
+    {
+        auto r = counter_snapshot{};
+        r._time_point = std::chrono::steady_clock::now();
+        for (ttlet &tag : counter_map.keys()) {
+            ttlet *const counter = counter_map.get(tag, counter_map_value_type{nullptr, 0}).counter;
+            r._values[tag] = counter != nullptr ? counter->read() : 0;
+        }
+        return r;
+    }
+
+    /** The time when the snapshot was taken.
+     */
+    [[nodiscard]] std::chrono::steady_clock::time_point time_point() const noexcept
+    {
+        return _time_point;
+    }
+
+    /** Get the value of a counter.
+     * @return The value, or zero if the counter was not used when the snapshot was taken.
+     */
+    [[nodiscard]] int64_t operator[](std::string_view tag) const noexcept
+    {
+        ttlet it = _values.find(tag);
+        return it != _values.end() ? it->second : 0;
+    }
+
+    /** Get the change of a counter since a previous snapshot.
+     */
+    [[nodiscard]] int64_t delta(counter_snapshot const &previous, std::string_view tag) const noexcept
+    {
+        return (*this)[tag] - previous[tag];
+    }
+
+    /** Get the rate of change of a counter since a previous snapshot.
+     * @return The change per second.
+     */
+    [[nodiscard]] double rate(counter_snapshot const &previous, std::string_view tag) const noexcept
+    {
+        ttlet duration = std::chrono::duration<double>(_time_point - previous._time_point);
+        return duration.count() > 0.0 ? static_cast<double>(delta(previous, tag)) / duration.count() : 0.0;
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+        return _values.begin();
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+        return _values.end();
+    }
+
+private:
+    std::chrono::steady_clock::time_point _time_point = {};
+    container_type _values;
+};
+
 } // namespace tt
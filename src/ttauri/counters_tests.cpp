@@ -7,6 +7,8 @@
 #include <gtest/gtest.h>
 #include <iostream>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace std;
 using namespace tt;
@@ -30,3 +32,48 @@ TEST(Counters, RunTimeRead) {
     ASSERT_EQ(read_counter("foo_b").first, 1);
     ASSERT_EQ(read_counter("bar_b").first, 2);
 }
+
+TEST(Counters, Add) {
+    add_to_counter<"foo_c">(1024);
+    add_to_counter<"foo_c">(-1024);
+    add_to_counter<"foo_c">(512);
+
+    ASSERT_EQ(read_counter<"foo_c">(), 512);
+    ASSERT_EQ(read_counter("foo_c").first, 512);
+}
+
+TEST(Counters, Threads) {
+    auto threads = std::vector<std::thread>{};
+    for (auto i = 0; i != 8; ++i) {
+        threads.emplace_back([] {
+            for (auto j = 0; j != 1000; ++j) {
+                increment_counter<"foo_d">();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(read_counter<"foo_d">(), 8000);
+}
+
+TEST(Counters, Snapshot) {
+    increment_counter<"foo_e">();
+    ttlet previous = counter_snapshot::take();
+
+    increment_counter<"foo_e">();
+    increment_counter<"foo_e">();
+    add_to_counter<"bar_e">(5);
+    ttlet current = counter_snapshot::take();
+
+    ASSERT_EQ(previous["foo_e"], 1);
+    ASSERT_EQ(previous["bar_e"], 0);
+    ASSERT_EQ(current["foo_e"], 3);
+    ASSERT_EQ(current.delta(previous, "foo_e"), 2);
+    ASSERT_EQ(current.delta(previous, "bar_e"), 5);
+    ASSERT_EQ(current.delta(previous, "baz_e"), 0);
+
+    // Taking a snapshot does not change the counters.
+    ASSERT_EQ(read_counter<"foo_e">(), 3);
+}
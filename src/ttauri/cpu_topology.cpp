@@ -0,0 +1,251 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "cpu_topology.hpp"
+#include "thread.hpp"
+#if TT_PROCESSOR == TT_CPU_X64
+#include "cpu_id.hpp"
+#endif
+#include <algorithm>
+#include <bit>
+#include <map>
+#include <optional>
+#include <tuple>
+#include <unordered_set>
+
+namespace tt {
+
+#if TT_PROCESSOR == TT_CPU_X64
+struct x2apic_topology {
+    uint32_t apic_id = 0;
+
+    /** The number of bits of the APIC id which select the logical CPU within a core.
+     */
+    unsigned int smt_shift = 0;
+
+    /** The number of bits of the APIC id which select the logical CPU within a package.
+     */
+    unsigned int package_shift = 0;
+};
+
+[[nodiscard]] static x2apic_topology get_x2apic_topology() noexcept
+{
+    ttlet max_leaf = cpu_id_x64(0)[0];
+
+    // Leaf 0x1f is the newer version of leaf 0xb which also enumerates modules, tiles and dies.
+    for (ttlet leaf : {uint32_t{0x1f}, uint32_t{0x0b}}) {
+        if (max_leaf < leaf) {
+            continue;
+        }
+
+        auto r = x2apic_topology{};
+        auto found = false;
+        for (uint32_t sub_leaf = 0; sub_leaf != 8; ++sub_leaf) {
+            ttlet info = cpu_id_x64(leaf, sub_leaf);
+            ttlet level_type = (info[2] >> 8) & 0xff;
+            if (level_type == 0) {
+                break;
+            }
+
+            ttlet shift = info[0] & 0x1f;
+            if (level_type == 1) {
+                r.smt_shift = shift;
+            }
+            r.package_shift = shift;
+            r.apic_id = info[3];
+            found = true;
+        }
+
+        if (found) {
+            return r;
+        }
+    }
+
+    // Legacy topology, without the ability to tell hyper-threads apart.
+    ttlet info = cpu_id_x64(1);
+    auto r = x2apic_topology{};
+    r.apic_id = info[1] >> 24;
+    if (info[3] & (uint32_t{1} << 28)) {
+        ttlet nr_logical_cpus = (info[1] >> 16) & 0xff;
+        r.package_shift = narrow_cast<unsigned int>(std::bit_width(nr_logical_cpus - 1));
+    }
+    return r;
+}
+
+/** Get the number of bits of the APIC id which select the logical CPU within the cache of a level.
+ */
+[[nodiscard]] static std::optional<unsigned int> get_cache_shift(uint32_t level) noexcept
+{
+    // Intel uses leaf 4, AMD uses the same format in leaf 0x8000001d.
+    auto leaf = uint32_t{4};
+    if (cpu_id_x64(0)[0] < 4 or (cpu_id_x64(4, 0)[0] & 0x1f) == 0) {
+        if (cpu_id_x64(0x8000'0000)[0] < 0x8000'001d) {
+            return {};
+        }
+        leaf = 0x8000'001d;
+    }
+
+    for (uint32_t sub_leaf = 0; sub_leaf != 16; ++sub_leaf) {
+        ttlet info = cpu_id_x64(leaf, sub_leaf);
+        ttlet cache_type = info[0] & 0x1f;
+        if (cache_type == 0) {
+            break;
+        }
+
+        // Skip instruction caches.
+        ttlet cache_level = (info[0] >> 5) & 0x7;
+        if (cache_level == level and cache_type != 2) {
+            ttlet nr_sharing = ((info[0] >> 14) & 0xfff) + 1;
+            return narrow_cast<unsigned int>(std::bit_width(nr_sharing - 1));
+        }
+    }
+    return {};
+}
+
+[[nodiscard]] static cpu_core_type get_core_type() noexcept
+{
+    constexpr uint32_t hybrid_bit = uint32_t{1} << 15;
+
+    if ((cpu_id_leaf7[3] & hybrid_bit) == 0 or cpu_id_leaf0[0] < 0x1a) {
+        return cpu_core_type::unknown;
+    }
+
+    switch (cpu_id_x64(0x1a)[0] >> 24) {
+    case 0x20: return cpu_core_type::efficiency;
+    case 0x40: return cpu_core_type::performance;
+    default: return cpu_core_type::unknown;
+    }
+}
+#endif
+
+/** Get the topology of the CPU the current thread runs on.
+ * @pre The thread affinity is set to the single CPU `id`.
+ */
+[[nodiscard]] static cpu_info get_cpu_info(size_t id) noexcept
+{
+    auto r = cpu_info{};
+    r.id = id;
+#if TT_PROCESSOR == TT_CPU_X64
+    ttlet topology = get_x2apic_topology();
+    ttlet apic_id = topology.apic_id;
+    ttlet l2_shift = get_cache_shift(2).value_or(topology.smt_shift);
+    ttlet l3_shift = get_cache_shift(3).value_or(topology.package_shift);
+
+    r.package = apic_id >> topology.package_shift;
+    r.core = apic_id >> topology.smt_shift;
+    r.smt_index = apic_id & ((uint32_t{1} << topology.smt_shift) - 1);
+    r.l2_domain = apic_id >> l2_shift;
+    r.l3_domain = apic_id >> l3_shift;
+    r.type = get_core_type();
+#else
+    // Without knowledge of the topology, treat each CPU as a separate core in one package.
+    r.package = 0;
+    r.core = id;
+    r.smt_index = 0;
+    r.l2_domain = id;
+    r.l3_domain = 0;
+    r.type = cpu_core_type::unknown;
+#endif
+    return r;
+}
+
+[[nodiscard]] static std::vector<cpu_info> make_cpu_topology() noexcept
+{
+    auto r = std::vector<cpu_info>{};
+
+    // Keep track of the original thread affinity of this thread.
+    auto prev_mask = set_thread_affinity(current_cpu_id());
+
+    size_t next_cpu = 0;
+    size_t current_cpu = 0;
+    do {
+        current_cpu = advance_thread_affinity(next_cpu);
+        r.push_back(get_cpu_info(current_cpu));
+    } while (next_cpu > current_cpu);
+
+    // Set the thread affinity back to the original.
+    set_thread_affinity_mask(prev_mask);
+
+    std::ranges::sort(r, [](ttlet &lhs, ttlet &rhs) {
+        return lhs.id < rhs.id;
+    });
+    return r;
+}
+
+[[nodiscard]] std::vector<cpu_info> const &cpu_topology() noexcept
+{
+    static ttlet r = make_cpu_topology();
+    return r;
+}
+
+[[nodiscard]] size_t nr_physical_cores() noexcept
+{
+    auto cores = std::unordered_set<size_t>{};
+    for (ttlet &cpu : cpu_topology()) {
+        cores.insert(cpu.core);
+    }
+    return cores.size();
+}
+
+[[nodiscard]] std::vector<size_t> cpu_placement_order(cpu_core_type preferred_type) noexcept
+{
+    struct item {
+        cpu_info const *cpu;
+        size_t rank;
+
+        /** The number of CPUs before this one with the same rank, hyper-thread and cache domain.
+         */
+        size_t ordinal;
+    };
+
+    ttlet &topology = cpu_topology();
+
+    auto ordinals = std::map<std::tuple<size_t, size_t, size_t>, size_t>{};
+    auto items = std::vector<item>{};
+    items.reserve(topology.size());
+    for (ttlet &cpu : topology) {
+        ttlet rank = cpu.type == preferred_type ? 0_uz : cpu.type == cpu_core_type::unknown ? 1_uz : 2_uz;
+        items.push_back({&cpu, rank, ordinals[{rank, cpu.smt_index, cpu.l3_domain}]++});
+    }
+
+    std::ranges::sort(items, [](ttlet &lhs, ttlet &rhs) {
+        return std::tie(lhs.rank, lhs.cpu->smt_index, lhs.ordinal, lhs.cpu->l3_domain, lhs.cpu->id) <
+            std::tie(rhs.rank, rhs.cpu->smt_index, rhs.ordinal, rhs.cpu->l3_domain, rhs.cpu->id);
+    });
+
+    auto r = std::vector<size_t>{};
+    r.reserve(items.size());
+    for (ttlet &item : items) {
+        r.push_back(item.cpu->id);
+    }
+    return r;
+}
+
+[[nodiscard]] std::vector<bool> cpu_mask(cpu_core_type type) noexcept
+{
+    ttlet &topology = cpu_topology();
+
+    auto r = std::vector<bool>{};
+    if (topology.empty()) {
+        return r;
+    }
+    r.resize(topology.back().id + 1);
+
+    auto found = false;
+    for (ttlet &cpu : topology) {
+        if (cpu.type == type) {
+            r[cpu.id] = true;
+            found = true;
+        }
+    }
+
+    if (not found) {
+        for (ttlet &cpu : topology) {
+            r[cpu.id] = true;
+        }
+    }
+    return r;
+}
+
+} // namespace tt
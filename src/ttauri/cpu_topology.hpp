@@ -0,0 +1,95 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "required.hpp"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace tt {
+
+/** The kind of core of a hybrid CPU.
+ */
+enum class cpu_core_type : uint8_t {
+    /** The CPU is not hybrid, or the type of core could not be determined.
+     */
+    unknown = 0,
+
+    /** A high performance core, such as Intel's "Core".
+     */
+    performance = 1,
+
+    /** A power efficient core, such as Intel's "Atom".
+     */
+    efficiency = 2
+};
+
+/** The location of a logical CPU in the topology of the system.
+ *
+ * The package, core and cache domains are numbers that are equal for CPUs that share
+ * that resource; they are not contiguous.
+ */
+struct cpu_info {
+    /** The logical CPU id, as used by `set_thread_affinity()` and `time_stamp_count::cpu_id()`.
+     */
+    size_t id;
+
+    /** The physical package (socket).
+     */
+    size_t package;
+
+    /** The physical core; the SMT siblings of a core share this number.
+     */
+    size_t core;
+
+    /** The index of this logical CPU within its core, zero for the first hyper-thread.
+     */
+    size_t smt_index;
+
+    /** The CPUs that share a level 2 cache.
+     */
+    size_t l2_domain;
+
+    /** The CPUs that share the last level cache.
+     */
+    size_t l3_domain;
+
+    cpu_core_type type;
+};
+
+/** Get the topology of the CPUs that this process is allowed to run on.
+ *
+ * The topology is determined once, by running the current thread on each CPU in turn.
+ *
+ * @return The CPUs ordered by id.
+ */
+[[nodiscard]] std::vector<cpu_info> const &cpu_topology() noexcept;
+
+/** The number of physical cores this process is allowed to run on.
+ */
+[[nodiscard]] size_t nr_physical_cores() noexcept;
+
+/** Get the CPUs in the order threads should be placed on them.
+ *
+ * CPUs of the preferred type come first; then the first hyper-thread of each core
+ * before its siblings, and consecutive CPUs are spread over the last level cache
+ * domains. Placing threads on a prefix of this list avoids sharing a core's
+ * execution units while free cores exist.
+ *
+ * @param preferred_type The type of core to place threads on first.
+ * @return The logical CPU ids.
+ */
+[[nodiscard]] std::vector<size_t> cpu_placement_order(cpu_core_type preferred_type = cpu_core_type::performance) noexcept;
+
+/** Get the affinity mask of the CPUs of a type of core.
+ *
+ * @param type The type of core.
+ * @return A mask for `set_thread_affinity_mask()`, or all the available CPUs
+ *         if there are no CPUs of the given type.
+ */
+[[nodiscard]] std::vector<bool> cpu_mask(cpu_core_type type) noexcept;
+
+} // namespace tt
@@ -0,0 +1,59 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/cpu_topology.hpp"
+#include "ttauri/thread.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+using namespace tt;
+
+TEST(CPUTopology, AvailableCPUs)
+{
+    ttlet available_cpus = process_affinity_mask();
+    ttlet &topology = cpu_topology();
+
+    auto nr_available_cpus = 0_uz;
+    for (ttlet available : available_cpus) {
+        nr_available_cpus += available ? 1 : 0;
+    }
+    ASSERT_EQ(topology.size(), nr_available_cpus);
+
+    for (ttlet &cpu : topology) {
+        ASSERT_LT(cpu.id, available_cpus.size());
+        ASSERT_TRUE(available_cpus[cpu.id]);
+    }
+
+    ASSERT_GE(nr_physical_cores(), 1);
+    ASSERT_LE(nr_physical_cores(), topology.size());
+}
+
+TEST(CPUTopology, PlacementOrder)
+{
+    ttlet &topology = cpu_topology();
+    ttlet order = cpu_placement_order();
+    ASSERT_EQ(order.size(), topology.size());
+
+    // Each CPU is placed exactly once.
+    auto sorted_order = order;
+    std::ranges::sort(sorted_order);
+    for (size_t i = 0; i != topology.size(); ++i) {
+        ASSERT_EQ(sorted_order[i], topology[i].id);
+    }
+
+    // The first hyper-thread of every core comes before any of the siblings.
+    ttlet first_sibling = std::ranges::find_if(order, [&](ttlet id) {
+        return std::ranges::find(topology, id, &cpu_info::id)->smt_index != 0;
+    });
+    ttlet nr_first_threads = std::ranges::count(topology, 0_uz, &cpu_info::smt_index);
+    ASSERT_EQ(std::distance(order.begin(), first_sibling), nr_first_threads);
+}
+
+TEST(CPUTopology, Mask)
+{
+    ttlet mask = cpu_mask(cpu_core_type::performance);
+    ASSERT_NE(std::ranges::count(mask, true), 0);
+}
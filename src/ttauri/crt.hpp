@@ -27,6 +27,7 @@
 #include "cast.hpp"
 #include "console.hpp"
 #include "time_stamp_count.hpp"
+#include "startup_profiler.hpp"
 
 #if TT_OPERATING_SYSTEM == TT_OS_WINDOWS
 #include "application_win32.hpp"
@@ -125,7 +126,10 @@ int WINAPI WinMain(
 
     // Make sure the console is in a valid state to write text to it.
     tt::console_start();
-    tt::time_stamp_count::start_subsystem();
+    {
+        ttlet phase = tt::startup_phase{"time_stamp_count::start_subsystem"};
+        tt::time_stamp_count::start_subsystem();
+    }
     tt::start_system();
 
     ttlet r = tt_main(tt::narrow_cast<int>(arguments.size() - 1), arguments.data(), hInstance);
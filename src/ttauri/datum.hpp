@@ -14,10 +14,16 @@
 #include "algorithm.hpp"
 #include "byte_string.hpp"
 #include "codec/base_n.hpp"
+#include "os_detect.hpp"
+#if TT_PROCESSOR == TT_CPU_X64
+#include <emmintrin.h>
+#endif
 #include <date/date.h>
 #include <vector>
+#include <array>
 #include <unordered_map>
 #include <memory>
+#include <atomic>
 #include <cstring>
 #include <cstdint>
 #include <variant>
@@ -340,14 +346,190 @@ private:
         return static_cast<int64_t>(u64 << 16) >> 16;
     }
 
+    /** Check if all items are stored as the same physical type.
+     * On x64 the type ids of two items are compared at a time with SSE2.
+     *
+     * @param items The items to check.
+     * @param is_float true to check for floats, false to check for small integers.
+     */
+    [[nodiscard]] static bool all_phy(std::vector<datum_impl> const &items, bool is_float) noexcept
+    {
+        static_assert(sizeof(datum_impl) == sizeof(uint64_t));
+
+        auto first = items.data();
+        ttlet last = first + items.size();
+
+#if TT_PROCESSOR == TT_CPU_X64
+        ttlet id_mask = _mm_set1_epi64x(is_float ? 0x7ff0 : 0xffff);
+        ttlet id = _mm_set1_epi64x(is_float ? 0x7ff0 : phy_integer_id);
+        ttlet tag_mask = _mm_set1_epi64x(0x000f);
+        for (; last - first >= 2; first += 2) {
+            ttlet type_ids = _mm_srli_epi64(_mm_loadu_si128(reinterpret_cast<__m128i const *>(first)), 48);
+            ttlet is_id = _mm_cmpeq_epi32(_mm_and_si128(type_ids, id_mask), id);
+            if (is_float) {
+                // A float has not all exponent bits set, or is infinite with a zero tag.
+                ttlet is_infinite = _mm_cmpeq_epi32(_mm_and_si128(type_ids, tag_mask), _mm_setzero_si128());
+                if (_mm_movemask_epi8(_mm_andnot_si128(is_infinite, is_id)) != 0) {
+                    return false;
+                }
+            } else if (_mm_movemask_epi8(is_id) != 0xffff) {
+                return false;
+            }
+        }
+#endif
+
+        for (; first != last; ++first) {
+            if (is_float ? !first->is_phy_float() : !first->is_phy_integer()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** Sum items that are all stored as floats.
+     * On x64 four floats are added at a time in two SSE2 registers.
+     */
+    [[nodiscard]] static double sum_phy_float(std::vector<datum_impl> const &items) noexcept
+    {
+        auto first = items.data();
+        ttlet last = first + items.size();
+        auto r = 0.0;
+
+#if TT_PROCESSOR == TT_CPU_X64
+        auto sum0 = _mm_setzero_pd();
+        auto sum1 = _mm_setzero_pd();
+        for (; last - first >= 4; first += 4) {
+            sum0 = _mm_add_pd(sum0, _mm_loadu_pd(&first[0].f64));
+            sum1 = _mm_add_pd(sum1, _mm_loadu_pd(&first[2].f64));
+        }
+        sum0 = _mm_add_pd(sum0, sum1);
+        r = _mm_cvtsd_f64(_mm_add_sd(sum0, _mm_unpackhi_pd(sum0, sum0)));
+#endif
+
+        for (; first != last; ++first) {
+            r += first->f64;
+        }
+        return r;
+    }
+
+    /** Sum items that are all stored as small integers.
+     * On x64 two integers are sign extended and added at a time with SSE2.
+     */
+    [[nodiscard]] static long long sum_phy_integer(std::vector<datum_impl> const &items) noexcept
+    {
+        auto first = items.data();
+        ttlet last = first + items.size();
+        auto r = 0LL;
+
+#if TT_PROCESSOR == TT_CPU_X64
+        // Flipping the sign bit of the 48 bit integer and subtracting it again sign extends to 64 bit.
+        ttlet value_mask = _mm_set1_epi64x(0x0000'ffff'ffff'ffffLL);
+        ttlet sign_bit = _mm_set1_epi64x(0x0000'8000'0000'0000LL);
+        auto sum = _mm_setzero_si128();
+        for (; last - first >= 2; first += 2) {
+            ttlet values = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<__m128i const *>(first)), value_mask);
+            sum = _mm_add_epi64(sum, _mm_sub_epi64(_mm_xor_si128(values, sign_bit), sign_bit));
+        }
+        r = _mm_cvtsi128_si64(sum) + _mm_cvtsi128_si64(_mm_unpackhi_epi64(sum, sum));
+#endif
+
+        for (; first != last; ++first) {
+            r += first->get_signed_integer();
+        }
+        return r;
+    }
+
+    /** A string, vector or map that is shared by copies of a datum.
+     *
+     * The object is copied when it is modified while it is shared, see `get_unique_pointer()`.
+     * The reference count is atomic, so that copies of a datum may be used by different threads.
+     */
+    template<typename O>
+    struct shared_box {
+        O value;
+        std::atomic<uint32_t> count;
+
+        template<typename... Args>
+        explicit shared_box(Args &&...args) : value(std::forward<Args>(args)...), count(1)
+        {
+        }
+    };
+
+    template<typename O>
+    static constexpr bool is_shared_object() noexcept
+    {
+        return std::is_same_v<O, std::string> || std::is_same_v<O, datum_impl::vector> || std::is_same_v<O, datum_impl::map>;
+    }
+
+    template<typename O>
+    shared_box<O> *get_box() const
+    {
+        static_assert(is_shared_object<O>());
+        return std::launder(reinterpret_cast<shared_box<O> *>(get_signed_integer()));
+    }
+
     /** Extract a pointer for an existing object from datum's storage.
      * Canonical pointers on x86 and ARM are at most 48 bit and are sign extended to 64 bit.
      * Since the pointer is stored as a 48 bit integer, this function will launder it.
+     *
+     * A string, vector or map may be shared with other datums and must not be modified
+     * through this pointer, use `get_unique_pointer()` instead.
      */
     template<typename O>
     O *get_pointer() const
     {
-        return std::launder(reinterpret_cast<O *>(get_signed_integer()));
+        if constexpr (is_shared_object<O>()) {
+            return &get_box<O>()->value;
+        } else {
+            return std::launder(reinterpret_cast<O *>(get_signed_integer()));
+        }
+    }
+
+    /** Extract a pointer to a string, vector or map for modification.
+     * When the object is shared with other datums, this datum first gets its own copy.
+     */
+    template<typename O>
+    O *get_unique_pointer()
+    {
+        auto *const box = get_box<O>();
+        if (box->count.load(std::memory_order::acquire) == 1) {
+            return &box->value;
+        }
+
+        shared_box<O> *copy;
+        uint64_t mask;
+        if constexpr (std::is_same_v<O, datum_impl::vector>) {
+            copy = new_vector(std::as_const(box->value));
+            mask = vector_ptr_mask;
+        } else if constexpr (std::is_same_v<O, datum_impl::map>) {
+            copy = new_map(std::as_const(box->value));
+            mask = map_ptr_mask;
+        } else {
+            copy = new shared_box<O>(std::as_const(box->value));
+            mask = string_ptr_mask;
+        }
+
+        release_box<O>();
+        u64 = make_pointer(mask, copy);
+        return &copy->value;
+    }
+
+    /** Release the reference of this datum to a string, vector or map.
+     * The object is deleted when this was the last reference.
+     */
+    template<typename O>
+    void release_box() noexcept
+    {
+        auto *const box = get_box<O>();
+        if (box->count.fetch_sub(1, std::memory_order::acq_rel) == 1) {
+            if constexpr (std::is_same_v<O, datum_impl::vector>) {
+                delete_vector(box);
+            } else if constexpr (std::is_same_v<O, datum_impl::map>) {
+                delete_map(box);
+            } else {
+                delete box;
+            }
+        }
     }
 
     /** Delete the object that the datum is pointing to.
@@ -358,10 +540,10 @@ private:
         if constexpr (HasLargeObjects) {
             switch (type_id()) {
             case phy_integer_ptr_id: delete get_pointer<int64_t>(); break;
-            case phy_string_ptr_id: delete get_pointer<std::string>(); break;
+            case phy_string_ptr_id: release_box<std::string>(); break;
             case phy_url_ptr_id: delete get_pointer<URL>(); break;
-            case phy_vector_ptr_id: delete get_pointer<datum_impl::vector>(); break;
-            case phy_map_ptr_id: delete get_pointer<datum_impl::map>(); break;
+            case phy_vector_ptr_id: release_box<datum_impl::vector>(); break;
+            case phy_map_ptr_id: release_box<datum_impl::map>(); break;
             case phy_decimal_ptr_id: delete get_pointer<decimal>(); break;
             case phy_bytes_ptr_id: delete get_pointer<bstring>(); break;
             default: tt_no_default();
@@ -371,6 +553,7 @@ private:
 
     /** Copy the object pointed to by the other datum into this datum.
      * Other datum must point to an object. This datum must not point to an object.
+     * A string, vector or map is shared with the other datum instead of copied.
      *
      * @param other The other datum which holds a pointer to an object.
      */
@@ -383,25 +566,25 @@ private:
                 u64 = make_pointer(integer_ptr_mask, p);
             } break;
 
-            case phy_string_ptr_id: {
-                auto *const p = new std::string(*other.get_pointer<std::string>());
-                u64 = make_pointer(string_ptr_mask, p);
-            } break;
+            case phy_string_ptr_id:
+                other.get_box<std::string>()->count.fetch_add(1, std::memory_order::relaxed);
+                u64 = other.u64;
+                break;
 
             case phy_url_ptr_id: {
                 auto *const p = new URL(*other.get_pointer<URL>());
                 u64 = make_pointer(url_ptr_mask, p);
             } break;
 
-            case phy_vector_ptr_id: {
-                auto *const p = new datum_impl::vector(*other.get_pointer<datum_impl::vector>());
-                u64 = make_pointer(vector_ptr_mask, p);
-            } break;
+            case phy_vector_ptr_id:
+                other.get_box<datum_impl::vector>()->count.fetch_add(1, std::memory_order::relaxed);
+                u64 = other.u64;
+                break;
 
-            case phy_map_ptr_id: {
-                auto *const p = new datum_impl::map(*other.get_pointer<datum_impl::map>());
-                u64 = make_pointer(map_ptr_mask, p);
-            } break;
+            case phy_map_ptr_id:
+                other.get_box<datum_impl::map>()->count.fetch_add(1, std::memory_order::relaxed);
+                u64 = other.u64;
+                break;
 
             case phy_decimal_ptr_id: {
                 auto *const p = new decimal(*other.get_pointer<decimal>());
@@ -430,6 +613,118 @@ public:
     struct _break {
     };
 
+    /** A scope in which the vectors and maps of datums are recycled.
+     *
+     * While an arena is alive, the vector and map objects of datums that are destroyed
+     * on this thread are cleared and kept, instead of deleted; new vectors and maps are
+     * taken from the arena, which keeps the capacity of the vector and the buckets of
+     * the map. This reduces the number of allocations when a large number of
+     * temporary datums are created, like in parsing and template evaluation.
+     *
+     * Datums may outlive the arena in which they were created; the objects kept by the
+     * arena are ordinary heap objects. Arenas on the same thread must be destroyed in
+     * reverse order of construction.
+     */
+    class arena {
+    public:
+        arena() noexcept : _previous(_arena), _nr_vectors(0), _nr_maps(0)
+        {
+            _arena = this;
+        }
+
+        ~arena()
+        {
+            tt_axiom(_arena == this);
+            _arena = _previous;
+
+            for (ssize_t i = 0; i != _nr_vectors; ++i) {
+                delete _vectors[i];
+            }
+            for (ssize_t i = 0; i != _nr_maps; ++i) {
+                delete _maps[i];
+            }
+        }
+
+        arena(arena const &) = delete;
+        arena(arena &&) = delete;
+        arena &operator=(arena const &) = delete;
+        arena &operator=(arena &&) = delete;
+
+    private:
+        static constexpr ssize_t capacity = 64;
+
+        arena *_previous;
+        ssize_t _nr_vectors;
+        ssize_t _nr_maps;
+        std::array<shared_box<vector> *, capacity> _vectors;
+        std::array<shared_box<map> *, capacity> _maps;
+
+        friend datum_impl;
+    };
+
+private:
+    inline static thread_local arena *_arena = nullptr;
+
+    /** Allocate a vector, from the current arena if possible.
+     *
+     * @param args Zero arguments for an empty vector, or a vector to copy or move from.
+     */
+    template<typename... Args>
+    [[nodiscard]] static shared_box<vector> *new_vector(Args &&...args)
+    {
+        if (_arena != nullptr && _arena->_nr_vectors != 0) {
+            auto *const p = _arena->_vectors[--_arena->_nr_vectors];
+            ((p->value = std::forward<Args>(args)), ...);
+            p->count.store(1, std::memory_order::relaxed);
+            return p;
+        } else {
+            return new shared_box<vector>(std::forward<Args>(args)...);
+        }
+    }
+
+    /** Allocate a map, from the current arena if possible.
+     *
+     * @param args Zero arguments for an empty map, or a map to copy or move from.
+     */
+    template<typename... Args>
+    [[nodiscard]] static shared_box<map> *new_map(Args &&...args)
+    {
+        if (_arena != nullptr && _arena->_nr_maps != 0) {
+            auto *const p = _arena->_maps[--_arena->_nr_maps];
+            ((p->value = std::forward<Args>(args)), ...);
+            p->count.store(1, std::memory_order::relaxed);
+            return p;
+        } else {
+            return new shared_box<map>(std::forward<Args>(args)...);
+        }
+    }
+
+    /** Delete a vector, or return it to the current arena.
+     */
+    static void delete_vector(shared_box<vector> *p) noexcept
+    {
+        // Clear before checking the arena, destroying the items may return objects to the arena.
+        p->value.clear();
+        if (_arena != nullptr && _arena->_nr_vectors != arena::capacity) {
+            _arena->_vectors[_arena->_nr_vectors++] = p;
+        } else {
+            delete p;
+        }
+    }
+
+    /** Delete a map, or return it to the current arena.
+     */
+    static void delete_map(shared_box<map> *p) noexcept
+    {
+        p->value.clear();
+        if (_arena != nullptr && _arena->_nr_maps != arena::capacity) {
+            _arena->_maps[_arena->_nr_maps++] = p;
+        } else {
+            delete p;
+        }
+    }
+
+public:
     datum_impl() noexcept : u64(undefined_mask) {}
 
     ~datum_impl() noexcept
@@ -479,9 +774,18 @@ public:
     datum_impl &operator=(datum_impl &&other) noexcept
     {
         tt_return_on_self_assignment(other);
+
+        // Take the value first, `other` may be owned by the object this datum points to.
         // We do a memcpy, because we don't know the type in the union.
-        std::memcpy(this, &other, sizeof(*this));
+        uint64_t tmp;
+        static_assert(sizeof(tmp) == sizeof(*this));
+        std::memcpy(&tmp, &other, sizeof(tmp));
         other.u64 = undefined_mask;
+
+        if (is_phy_pointer()) {
+            [[unlikely]] delete_pointer();
+        }
+        std::memcpy(this, &tmp, sizeof(tmp));
         return *this;
     }
 
@@ -573,7 +877,7 @@ public:
     {
         if (u64 == 0) {
             if constexpr (HasLargeObjects) {
-                auto *const p = new std::string(value);
+                auto *const p = new shared_box<std::string>(value);
                 u64 = make_pointer(string_ptr_mask, p);
             } else {
                 throw std::overflow_error(fmt::format("Constructing string {} to datum, larger than 6 characters", value));
@@ -601,28 +905,28 @@ public:
     template<bool P = HasLargeObjects, std::enable_if_t<P, int> = 0>
     datum_impl(datum_impl::vector const &value) noexcept
     {
-        auto *const p = new datum_impl::vector(value);
+        auto *const p = new_vector(value);
         u64 = make_pointer(vector_ptr_mask, p);
     }
 
     template<bool P = HasLargeObjects, std::enable_if_t<P, int> = 0>
     datum_impl(datum_impl::vector &&value) noexcept
     {
-        auto *const p = new datum_impl::vector(std::move(value));
+        auto *const p = new_vector(std::move(value));
         u64 = make_pointer(vector_ptr_mask, p);
     }
 
     template<bool P = HasLargeObjects, std::enable_if_t<P, int> = 0>
     datum_impl(datum_impl::map const &value) noexcept
     {
-        auto *const p = new datum_impl::map(value);
+        auto *const p = new_map(value);
         u64 = make_pointer(map_ptr_mask, p);
     }
 
     template<bool P = HasLargeObjects, std::enable_if_t<P, int> = 0>
     datum_impl(datum_impl::map &&value) noexcept
     {
-        auto *const p = new datum_impl::map(std::move(value));
+        auto *const p = new_map(std::move(value));
         u64 = make_pointer(map_ptr_mask, p);
     }
 
@@ -821,7 +1125,7 @@ public:
         u64 = make_string(rhs);
         if (u64 == 0) {
             if constexpr (HasLargeObjects) {
-                auto *const p = new std::string(rhs);
+                auto *const p = new shared_box<std::string>(rhs);
                 u64 = make_pointer(string_ptr_mask, p);
             } else {
                 throw std::overflow_error(fmt::format("Assigning string {} to datum, larger than 6 characters", rhs));
@@ -873,7 +1177,7 @@ public:
             [[unlikely]] delete_pointer();
         }
 
-        auto *const p = new datum_impl::vector(rhs);
+        auto *const p = new_vector(rhs);
         u64 = make_pointer(vector_ptr_mask, p);
 
         return *this;
@@ -886,7 +1190,7 @@ public:
             [[unlikely]] delete_pointer();
         }
 
-        auto *const p = new datum_impl::vector(std::move(rhs));
+        auto *const p = new_vector(std::move(rhs));
         u64 = make_pointer(vector_ptr_mask, p);
 
         return *this;
@@ -899,7 +1203,7 @@ public:
             [[unlikely]] delete_pointer();
         }
 
-        auto *const p = new datum_impl::map(rhs);
+        auto *const p = new_map(rhs);
         u64 = make_pointer(map_ptr_mask, p);
 
         return *this;
@@ -912,7 +1216,7 @@ public:
             [[unlikely]] delete_pointer();
         }
 
-        auto *const p = new datum_impl::map(std::move(rhs));
+        auto *const p = new_map(std::move(rhs));
         u64 = make_pointer(map_ptr_mask, p);
 
         return *this;
@@ -1302,18 +1606,18 @@ public:
     {
         if (is_undefined()) {
             // When accessing a name on an undefined it means we need replace it with an empty map.
-            auto *p = new datum_impl::map();
+            auto *p = new_map();
             u64 = map_ptr_mask | (reinterpret_cast<uint64_t>(p) & pointer_mask);
         }
 
         if (is_map()) {
-            auto &m = *get_pointer<datum_impl::map>();
+            auto &m = *get_unique_pointer<datum_impl::map>();
             auto [i, did_insert] = m.try_emplace(rhs);
             return i->second;
 
         } else if (is_vector() && rhs.is_integer()) {
             auto index = static_cast<int64_t>(rhs);
-            auto &v = *get_pointer<datum_impl::vector>();
+            auto &v = *get_unique_pointer<datum_impl::vector>();
 
             if (index < 0) {
                 index = std::ssize(v) + index;
@@ -1331,6 +1635,28 @@ public:
         }
     }
 
+    /** Index into a datum::map or datum::vector.
+     * When a new item is inserted into the map, the key is moved into the map.
+     *
+     * @param rhs An index into the map or vector.
+     */
+    template<bool P = HasLargeObjects, std::enable_if_t<P, int> = 0>
+    datum_impl &operator[](datum_impl &&rhs)
+    {
+        if (is_undefined()) {
+            auto *p = new_map();
+            u64 = map_ptr_mask | (reinterpret_cast<uint64_t>(p) & pointer_mask);
+        }
+
+        if (is_map()) {
+            auto &m = *get_unique_pointer<datum_impl::map>();
+            auto [i, did_insert] = m.try_emplace(std::move(rhs));
+            return i->second;
+        } else {
+            return (*this)[std::as_const(rhs)];
+        }
+    }
+
     /** Index into a datum::map or datum::vector.
      * This datum must hold a vector, map or undefined.
      * When this datum holds undefined it is treated as if datum holds an empty map.
@@ -1410,12 +1736,12 @@ public:
     {
         if (is_undefined()) {
             // When appending on undefined it means we need replace it with an empty vector.
-            auto *p = new datum_impl::vector();
+            auto *p = new_vector();
             u64 = vector_ptr_mask | (reinterpret_cast<uint64_t>(p) & pointer_mask);
         }
 
         if (is_vector()) {
-            auto *v = get_pointer<datum_impl::vector>();
+            auto *v = get_unique_pointer<datum_impl::vector>();
             v->emplace_back();
             return v->back();
 
@@ -1429,12 +1755,12 @@ public:
     {
         if (is_undefined()) {
             // When appending on undefined it means we need replace it with an empty vector.
-            auto *p = new datum_impl::vector();
+            auto *p = new_vector();
             u64 = vector_ptr_mask | (reinterpret_cast<uint64_t>(p) & pointer_mask);
         }
 
         if (is_vector()) {
-            auto *v = get_pointer<datum_impl::vector>();
+            auto *v = get_unique_pointer<datum_impl::vector>();
             v->emplace_back(std::forward<Args>(args)...);
 
         } else {
@@ -1447,12 +1773,12 @@ public:
     {
         if (is_undefined()) {
             // When appending on undefined it means we need replace it with an empty vector.
-            auto *p = new datum_impl::vector();
+            auto *p = new_vector();
             u64 = vector_ptr_mask | (reinterpret_cast<uint64_t>(p) & pointer_mask);
         }
 
         if (is_vector()) {
-            auto *v = get_pointer<datum_impl::vector>();
+            auto *v = get_unique_pointer<datum_impl::vector>();
             v->push_back(std::forward<Arg>(arg));
 
         } else {
@@ -1463,7 +1789,7 @@ public:
     void pop_back()
     {
         if (is_vector()) {
-            auto *v = get_pointer<datum_impl::vector>();
+            auto *v = get_unique_pointer<datum_impl::vector>();
             v->pop_back();
 
         } else {
@@ -1522,7 +1848,7 @@ public:
     datum_impl &front()
     {
         if (is_vector()) {
-            auto *v = get_pointer<datum_impl::vector>();
+            auto *v = get_unique_pointer<datum_impl::vector>();
             return v->front();
 
         } else {
@@ -1544,7 +1870,7 @@ public:
     datum_impl &back()
     {
         if (is_vector()) {
-            auto *v = get_pointer<datum_impl::vector>();
+            auto *v = get_unique_pointer<datum_impl::vector>();
             return v->back();
 
         } else {
@@ -1894,7 +2220,17 @@ public:
         if (this->is_vector()) {
             this->push_back(rhs);
         } else {
-            *this = *this + rhs;
+            *this = std::move(*this) + rhs;
+        }
+        return *this;
+    }
+
+    datum_impl &operator+=(datum_impl &&rhs)
+    {
+        if (this->is_vector()) {
+            this->push_back(std::move(rhs));
+        } else {
+            *this = std::move(*this) + rhs;
         }
         return *this;
     }
@@ -2000,9 +2336,11 @@ public:
         case datum_impl::phy_url_ptr_id:
             return (rhs.is_url() || rhs.is_string()) && static_cast<URL>(lhs) == static_cast<URL>(rhs);
         case datum_impl::phy_vector_ptr_id:
-            return rhs.is_vector() && *lhs.get_pointer<datum_impl::vector>() == *rhs.get_pointer<datum_impl::vector>();
+            return rhs.is_vector() &&
+                (lhs.u64 == rhs.u64 || *lhs.get_pointer<datum_impl::vector>() == *rhs.get_pointer<datum_impl::vector>());
         case datum_impl::phy_map_ptr_id:
-            return rhs.is_map() && *lhs.get_pointer<datum_impl::map>() == *rhs.get_pointer<datum_impl::map>();
+            return rhs.is_map() &&
+                (lhs.u64 == rhs.u64 || *lhs.get_pointer<datum_impl::map>() == *rhs.get_pointer<datum_impl::map>());
         case datum_impl::phy_bytes_ptr_id: return (rhs.is_bytes() && static_cast<bstring>(lhs) == static_cast<bstring>(rhs));
         default:
             if (lhs.is_phy_float()) {
@@ -2162,6 +2500,35 @@ public:
         }
     }
 
+    /** Add to a temporary.
+     * A vector, map or large string in `lhs` is reused for the result, instead of being copied.
+     */
+    friend datum_impl operator+(datum_impl &&lhs, datum_impl const &rhs)
+    {
+        if (lhs.is_vector() && rhs.is_vector() && &lhs != &rhs) {
+            auto &lhs_ = *(lhs.get_unique_pointer<datum_impl::vector>());
+            ttlet &rhs_ = *(rhs.get_pointer<datum_impl::vector>());
+            lhs_.insert(lhs_.end(), rhs_.begin(), rhs_.end());
+            return std::move(lhs);
+
+        } else if (lhs.is_map() && rhs.is_map()) {
+            // Items in lhs have priority, the same as when adding two constant maps.
+            auto &lhs_ = *(lhs.get_unique_pointer<datum_impl::map>());
+            ttlet &rhs_ = *(rhs.get_pointer<datum_impl::map>());
+            for (ttlet &item : rhs_) {
+                lhs_.try_emplace(item.first, item.second);
+            }
+            return std::move(lhs);
+
+        } else if (lhs.is_phy_string_ptr() && rhs.is_string()) {
+            *(lhs.get_unique_pointer<std::string>()) += static_cast<std::string>(rhs);
+            return std::move(lhs);
+
+        } else {
+            return std::as_const(lhs) + rhs;
+        }
+    }
+
     friend datum_impl operator-(datum_impl const &lhs, datum_impl const &rhs)
     {
         if (lhs.is_float() || rhs.is_float()) {
@@ -2414,6 +2781,97 @@ public:
         }
     }
 
+    /** Sum the items of a vector.
+     *
+     * A vector of which all items are floats, or all items are small integers, is summed
+     * directly from the storage of the items, without a type dispatch for each item; the
+     * order in which the floats are added is not specified. Other vectors are summed with
+     * `operator+()` starting at the first item.
+     *
+     * @param rhs A vector datum.
+     * @return The sum, or integer zero for an empty vector.
+     */
+    [[nodiscard]] friend datum_impl sum(datum_impl const &rhs)
+    {
+        if (!rhs.is_vector()) {
+            throw operation_error("Can't sum value {} of type {}", rhs.repr(), rhs.type_name());
+        }
+
+        ttlet &items = *rhs.get_pointer<datum_impl::vector>();
+        if (items.empty()) {
+            return datum_impl{0};
+        } else if (all_phy(items, true)) {
+            return datum_impl{sum_phy_float(items)};
+        } else if (all_phy(items, false)) {
+            return datum_impl{sum_phy_integer(items)};
+        }
+
+        auto r = items.front();
+        for (auto i = items.begin() + 1; i != items.end(); ++i) {
+            r = r + *i;
+        }
+        return r;
+    }
+
+    /** The smallest or largest item of a vector.
+     *
+     * A vector of which all items are floats is searched two items at a time with SSE2 on x64,
+     * one of which all items are small integers without a type dispatch for each item.
+     * Other vectors are searched with `operator<()`.
+     *
+     * @param rhs A vector datum.
+     * @param largest true to find the largest item, false to find the smallest.
+     * @throws operation_error When the vector is empty.
+     */
+    [[nodiscard]] friend datum_impl min_or_max(datum_impl const &rhs, bool largest)
+    {
+        if (!rhs.is_vector()) {
+            throw operation_error(
+                "Can't find the {} item in value {} of type {}", largest ? "largest" : "smallest", rhs.repr(), rhs.type_name());
+        }
+
+        ttlet &items = *rhs.get_pointer<datum_impl::vector>();
+        if (items.empty()) {
+            throw operation_error("Can't find the {} item of an empty vector", largest ? "largest" : "smallest");
+        }
+
+        auto first = items.data();
+        ttlet last = first + items.size();
+
+        if (all_phy(items, true)) {
+            auto r = first->f64;
+#if TT_PROCESSOR == TT_CPU_X64
+            auto r2 = _mm_set1_pd(r);
+            for (; last - first >= 2; first += 2) {
+                ttlet values = _mm_loadu_pd(&first->f64);
+                r2 = largest ? _mm_max_pd(r2, values) : _mm_min_pd(r2, values);
+            }
+            r2 = largest ? _mm_max_sd(r2, _mm_unpackhi_pd(r2, r2)) : _mm_min_sd(r2, _mm_unpackhi_pd(r2, r2));
+            r = _mm_cvtsd_f64(r2);
+#endif
+            for (; first != last; ++first) {
+                r = largest ? std::max(r, first->f64) : std::min(r, first->f64);
+            }
+            return datum_impl{r};
+
+        } else if (all_phy(items, false)) {
+            auto r = first->get_signed_integer();
+            for (; first != last; ++first) {
+                ttlet value = first->get_signed_integer();
+                r = largest ? std::max(r, value) : std::min(r, value);
+            }
+            return datum_impl{static_cast<long long>(r)};
+        }
+
+        auto r = items.front();
+        for (auto i = items.begin() + 1; i != items.end(); ++i) {
+            if (largest ? r < *i : *i < r) {
+                r = *i;
+            }
+        }
+        return r;
+    }
+
     /** Merge two datums together, such that the second will override values on the first.
      * This will merge map-datums together by recursively deep merging matching items.
      *
@@ -2423,34 +2881,45 @@ public:
      */
     friend datum_impl deep_merge(datum_impl const &lhs, datum_impl const &rhs) noexcept
     {
-        datum_impl result;
+        if ((lhs.is_map() && rhs.is_map()) || (lhs.is_vector() && rhs.is_vector())) {
+            return deep_merge(datum_impl{lhs}, rhs);
+        } else {
+            return rhs;
+        }
+    }
 
+    /** Merge a datum into a temporary, such that the second will override values on the first.
+     * The items of `lhs` are merged in place, without copying them.
+     *
+     * @param lhs First datum.
+     * @param rhs Second datum that will override the first datum.
+     * @return
+     */
+    friend datum_impl deep_merge(datum_impl &&lhs, datum_impl const &rhs) noexcept
+    {
         if (lhs.is_map() && rhs.is_map()) {
-            result = lhs;
-
-            auto result_map = result.get_pointer<datum_impl::map>();
+            auto result_map = lhs.get_unique_pointer<datum_impl::map>();
             for (auto rhs_i = rhs.map_begin(); rhs_i != rhs.map_end(); rhs_i++) {
                 auto result_i = result_map->find(rhs_i->first);
                 if (result_i == result_map->end()) {
                     result_map->insert(*rhs_i);
                 } else {
-                    result_i->second = deep_merge(result_i->second, rhs_i->second);
+                    result_i->second = deep_merge(std::move(result_i->second), rhs_i->second);
                 }
             }
+            return std::move(lhs);
 
-        } else if (lhs.is_vector() && rhs.is_vector()) {
-            result = lhs;
+        } else if (lhs.is_vector() && rhs.is_vector() && &lhs != &rhs) {
+            auto result_vector = lhs.get_unique_pointer<datum_impl::vector>();
+            result_vector->insert(result_vector->end(), rhs.vector_begin(), rhs.vector_end());
+            return std::move(lhs);
 
-            auto result_vector = result.get_pointer<datum_impl::vector>();
-            for (auto rhs_i = rhs.vector_begin(); rhs_i != rhs.vector_end(); rhs_i++) {
-                result_vector->push_back(*rhs_i);
-            }
+        } else if (lhs.is_vector() && rhs.is_vector()) {
+            return deep_merge(std::as_const(lhs), rhs);
 
         } else {
-            result = rhs;
+            return rhs;
         }
-
-        return result;
     }
 
     template<typename Alternative>
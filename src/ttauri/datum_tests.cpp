@@ -143,3 +143,112 @@ TEST(Datum, ArrayOperations) {
     ASSERT_EQ(v[-2], 14);
     ASSERT_EQ(v[-1], 15);
 }
+
+TEST(Datum, MoveOperations) {
+    auto v = datum{datum::vector{1, 2}};
+    auto w = std::move(v) + datum{datum::vector{3}};
+    ASSERT_TRUE(v.is_undefined());
+    ASSERT_EQ(w.size(), 3);
+    ASSERT_EQ(w[2], 3);
+
+    w += datum{datum::vector{4}};
+    ASSERT_EQ(w.size(), 4);
+
+    auto s = datum{"Hello"} + datum{" World"};
+    s = std::move(s) + datum{"!"};
+    ASSERT_EQ(static_cast<std::string>(s), "Hello World!"s);
+
+    auto m = datum{};
+    m[datum{"a long key"}] = 1;
+    m[datum{"a long key"}] = 2;
+    ASSERT_EQ(m.size(), 1);
+    ASSERT_EQ(m["a long key"], 2);
+
+    // Move-assigning an item of a vector into the vector.
+    w = std::move(w[1]);
+    ASSERT_EQ(w, 2);
+}
+
+TEST(Datum, Arena) {
+    auto arena = datum::arena{};
+
+    auto a = datum{datum::vector{1, 2, 3}};
+    a = datum::undefined{};
+
+    // The vector of `b` is recycled, and must be empty.
+    auto b = datum{};
+    b.push_back(4);
+    ASSERT_EQ(b.size(), 1);
+    ASSERT_EQ(b[0], 4);
+
+    auto c = datum{datum::map{}};
+    c["x"] = datum{datum::vector{5, 6}};
+    c = datum::undefined{};
+
+    auto d = datum{};
+    d["y"] = 7;
+    ASSERT_EQ(d.size(), 1);
+    ASSERT_EQ(d["y"], 7);
+}
+
+TEST(Datum, Aggregates) {
+    auto integers = datum::vector{};
+    auto floats = datum::vector{};
+    for (int i = -50; i != 51; ++i) {
+        integers.emplace_back(i * 3);
+        floats.emplace_back(i * 0.5);
+    }
+
+    // Negative small integers are sign extended from the storage of the datum.
+    ASSERT_EQ(sum(datum{integers}), 0);
+    ASSERT_TRUE(sum(datum{integers}).is_integer());
+    ASSERT_EQ(min_or_max(datum{integers}, false), -150);
+    ASSERT_EQ(min_or_max(datum{integers}, true), 150);
+
+    ASSERT_EQ(sum(datum{floats}), 0.0);
+    ASSERT_TRUE(sum(datum{floats}).is_float());
+    ASSERT_EQ(min_or_max(datum{floats}, false), -25.0);
+    ASSERT_EQ(min_or_max(datum{floats}, true), 25.0);
+
+    // Mixed vectors are handled one item at a time.
+    auto mixed = datum::vector{1, 2.5, 3};
+    ASSERT_EQ(sum(datum{mixed}), 6.5);
+    ASSERT_EQ(min_or_max(datum{mixed}, true), 3);
+
+    ASSERT_EQ(sum(datum{datum::vector{}}), 0);
+    ASSERT_THROW((void)min_or_max(datum{datum::vector{}}, true), operation_error);
+    ASSERT_THROW((void)sum(datum{1}), operation_error);
+}
+
+TEST(Datum, SharedCopies) {
+    auto a = datum{datum::vector{1, 2, datum::vector{3, 4}}};
+    auto b = a;
+    ASSERT_EQ(a, b);
+
+    // Modifying a copy does not modify the original.
+    b.push_back(5);
+    ASSERT_EQ(a.size(), 3);
+    ASSERT_EQ(b.size(), 4);
+
+    auto c = a;
+    c[2][0] = 30;
+    ASSERT_EQ(a[2][0], 3);
+    ASSERT_EQ(c[2][0], 30);
+    ASSERT_EQ(b[2][0], 3);
+
+    auto m = datum{datum::map{}};
+    m["x"] = "a string that is too long to be stored inside the datum";
+    auto n = m;
+    n["x"] = n["x"] + datum{" and then some"};
+    ASSERT_EQ(m["x"], "a string that is too long to be stored inside the datum");
+    ASSERT_EQ(n["x"], "a string that is too long to be stored inside the datum and then some");
+
+    // Destroying the original keeps the copy alive.
+    auto d = datum{datum::map{}};
+    {
+        auto e = datum{datum::map{}};
+        e["y"] = datum{datum::vector{6, 7}};
+        d = e;
+    }
+    ASSERT_EQ(d["y"][1], 7);
+}
@@ -6,6 +6,9 @@
 #include "unfair_mutex.hpp"
 #include "exception.hpp"
 #include "thread.hpp"
+#include "counters.hpp"
+#include "logger.hpp"
+#include <bit>
 #include <mutex>
 
 namespace tt {
@@ -113,4 +116,32 @@ void dead_lock_detector::remove_object(void *object) noexcept
     });
 }
 
+[[nodiscard]] uint8_t lock_order_detector::assign_id(char const *name) noexcept
+{
+    ttlet id = nr_ids.fetch_add(1, std::memory_order::relaxed);
+    if (id >= max_nr_objects) {
+        return untracked_id;
+    }
+
+    names[id].store(name, std::memory_order::relaxed);
+    return static_cast<uint8_t>(id);
+}
+
+void lock_order_detector::add_order(uint8_t id, uint64_t held_ids) noexcept
+{
+    ttlet new_ids = held_ids & ~before[id].fetch_or(held_ids, std::memory_order::relaxed);
+
+    for (auto ids = new_ids; ids != 0; ids &= ids - 1) {
+        ttlet other_id = std::countr_zero(ids);
+
+        if (before[other_id].load(std::memory_order::relaxed) & (uint64_t{1} << id)) {
+            increment_counter<"lock_order_inversion">();
+            tt_log_error(
+                "Lock order inversion: '{}' was locked while holding '{}', but earlier in the reverse order",
+                names[id].load(std::memory_order::relaxed),
+                names[other_id].load(std::memory_order::relaxed));
+        }
+    }
+}
+
 } // namespace tt
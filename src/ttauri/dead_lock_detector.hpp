@@ -8,6 +8,9 @@
 #include "os_detect.hpp"
 #include <vector>
 #include <algorithm>
+#include <atomic>
+#include <array>
+#include <cstdint>
 #include <tuple>
 
 
@@ -60,4 +63,89 @@ private:
     [[nodiscard]] static void *check_graph(void *object) noexcept;
 };
 
+/** A lock-order checker that is cheap enough to be used in release builds.
+ *
+ * Unlike the `dead_lock_detector` this does not keep a stack of locked objects; it only checks
+ * that two objects are always locked in the same order. Each object gets a small id on its first
+ * lock. A thread keeps a bitmap of the ids it holds, and for each id a global bitmap holds the ids
+ * that have been seen locked before it.
+ *
+ * Locking an object while no other tracked object is held costs a check of the thread-local bitmap;
+ * otherwise it costs one relaxed load, unless a new order is found. A reversed order is reported
+ * once through the log and the "lock_order_inversion" counter.
+ *
+ * Only the first `max_nr_objects` objects are tracked, so only long-lived named mutexes take part.
+ */
+class lock_order_detector {
+public:
+    static constexpr size_t max_nr_objects = 64;
+
+    /** The initial value of an object's id.
+     */
+    static constexpr uint8_t unassigned_id = 0xff;
+
+    /** The id of an object that could not get an id.
+     */
+    static constexpr uint8_t untracked_id = 0xfe;
+
+    /** Get a new id for an object.
+     * Objects that can be locked by multiple threads at the same time, such as a
+     * shared mutex, must get their id up front.
+     *
+     * @return The id, or `untracked_id` when all ids are in use.
+     */
+    [[nodiscard]] static uint8_t assign_id(char const *name) noexcept;
+
+    /** Check and record the lock order, after the object was locked.
+     *
+     * @param id The id of the object, owned by the object and initialized to `unassigned_id`.
+     *           It may only be accessed while the object is locked.
+     * @param name The name of the object, used for reporting.
+     */
+    static void lock(uint8_t &id, char const *name) noexcept
+    {
+        if (id >= max_nr_objects) {
+            if (id == unassigned_id) {
+                id = assign_id(name);
+            }
+            if (id >= max_nr_objects) {
+                return;
+            }
+        }
+
+        ttlet held_ids = held;
+        if (held_ids != 0) {
+            // Nothing new when all held objects are already known to be locked before this object.
+            if ((before[id].load(std::memory_order::relaxed) & held_ids) != held_ids) {
+                [[unlikely]] add_order(id, held_ids);
+            }
+        }
+        held = held_ids | (uint64_t{1} << id);
+    }
+
+    /** Forget the object, before it is unlocked.
+     */
+    static void unlock(uint8_t id) noexcept
+    {
+        if (id < max_nr_objects) {
+            held &= ~(uint64_t{1} << id);
+        }
+    }
+
+private:
+    /** The ids of the objects held by this thread.
+     */
+    thread_local inline static uint64_t held = 0;
+
+    /** For each id, the ids of the objects that were seen locked before it.
+     */
+    inline static std::array<std::atomic<uint64_t>, max_nr_objects> before = {};
+
+    inline static std::array<std::atomic<char const *>, max_nr_objects> names = {};
+
+    inline static std::atomic<size_t> nr_ids = 0;
+
+    static void add_order(uint8_t id, uint64_t held_ids) noexcept;
+};
+
 }
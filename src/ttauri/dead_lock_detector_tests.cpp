@@ -3,9 +3,12 @@
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #include "ttauri/dead_lock_detector.hpp"
+#include "ttauri/unfair_mutex.hpp"
+#include "ttauri/counters.hpp"
 #include "ttauri/required.hpp"
 #include "ttauri/exception.hpp"
 #include <gtest/gtest.h>
+#include <mutex>
 #include <iostream>
 #include <string>
 #include <thread>
@@ -358,3 +361,39 @@ TEST(dead_lock_detector, good_lock4)
     dead_lock_detector::remove_object(&c);
 }
 
+
+TEST(lock_order_detector, inversion)
+{
+    auto a = unfair_mutex_impl<false, "lock_order_test_a">{};
+    auto b = unfair_mutex_impl<false, "lock_order_test_b">{};
+    auto c = unfair_mutex_impl<false, "lock_order_test_c">{};
+
+    ttlet nr_inversions = read_counter<"lock_order_inversion">();
+
+    // Establish the order a, b, c.
+    {
+        ttlet lock_a = std::scoped_lock(a);
+        ttlet lock_b = std::scoped_lock(b);
+        ttlet lock_c = std::scoped_lock(c);
+    }
+    {
+        ttlet lock_a = std::scoped_lock(a);
+        ttlet lock_c = std::scoped_lock(c);
+    }
+    ASSERT_EQ(read_counter<"lock_order_inversion">(), nr_inversions);
+
+    // Reverse the order on another thread.
+    auto t = std::thread([&]() {
+        ttlet lock_c = std::scoped_lock(c);
+        ttlet lock_a = std::scoped_lock(a);
+    });
+    t.join();
+    ASSERT_EQ(read_counter<"lock_order_inversion">(), nr_inversions + 1);
+
+    // An inversion is only reported once.
+    {
+        ttlet lock_c = std::scoped_lock(c);
+        ttlet lock_a = std::scoped_lock(a);
+    }
+    ASSERT_EQ(read_counter<"lock_order_inversion">(), nr_inversions + 1);
+}
@@ -7,8 +7,11 @@
 #include "exception.hpp"
 #include "int_overflow.hpp"
 #include "math.hpp"
+#include "charconv.hpp"
 #include <fmt/ostream.h>
 #include <limits>
+#include <array>
+#include <algorithm>
 #include <string_view>
 #include <string>
 #include <charconv>
@@ -29,6 +32,11 @@ public:
     constexpr static int exponent_max = 127;
     constexpr static int exponent_min = -128;
 
+    /** The maximum number of characters written by `to_chars()`.
+     * A sign, the 17 digits of the largest mantissa and the trailing zeros of the largest exponent.
+     */
+    constexpr static size_t max_chars = 1 + 17 + exponent_max;
+
     constexpr decimal() noexcept : value(0) {}
     constexpr decimal(decimal const &other) noexcept = default;
     constexpr decimal(decimal &&other) noexcept = default;
@@ -347,31 +355,141 @@ public:
         return {lhs_e - rhs_e, lhs_m % rhs_m};
     }
 
-    [[nodiscard]] friend std::string to_string(decimal x) noexcept
-    {
-        auto [e, m] = x.exponent_mantissa();
-        auto s = std::to_string(std::abs(m));
+    /** Convert a decimal to text.
+     * The text is written the same way as `to_string()`, without a terminating nul.
+     *
+     * @param first The first character of the buffer.
+     * @param last One beyond the last character of the buffer.
+     * @param x The decimal to convert.
+     * @return One beyond the last character written, or `std::errc::value_too_large` together with
+     *         @a last when the buffer is smaller than needed; at most `decimal::max_chars`.
+     */
+    [[nodiscard]] friend std::to_chars_result to_chars(char *first, char *last, decimal x) noexcept
+    {
+        ttlet[e, m] = x.exponent_mantissa();
+
+        // The mantissa has at most 17 digits.
+        auto digits = std::array<char, 20>{};
+        ttlet abs_m = m < 0 ? 0ULL - static_cast<unsigned long long>(m) : static_cast<unsigned long long>(m);
+        ttlet digits_first = digits.data();
+        ttlet digits_last = std::to_chars(digits_first, digits_first + digits.size(), abs_m).ptr;
+        ttlet nr_digits = static_cast<int>(digits_last - digits_first);
+
+        ttlet nr_integer_digits = e >= 0 ? nr_digits + e : std::max(nr_digits + e, 1);
+        ttlet nr_fraction_digits = e < 0 ? -e : 0;
+        ttlet size = (m < 0 ? 1 : 0) + nr_integer_digits + (nr_fraction_digits > 0 ? nr_fraction_digits + 1 : 0);
+        if (last - first < size) {
+            return {last, std::errc::value_too_large};
+        }
 
-        auto decimal_position = -e;
-        auto leading_zeros = (decimal_position - std::ssize(s)) + 1;
-        if (leading_zeros > 0) {
-            s.insert(0, leading_zeros, '0');
+        auto ptr = first;
+        if (m < 0) {
+            *ptr++ = '-';
         }
 
-        auto trailing_zeros = e;
-        if (trailing_zeros > 0) {
-            s.append(trailing_zeros, '0');
+        if (e >= 0) {
+            ptr = std::copy(digits_first, digits_last, ptr);
+            ptr = std::fill_n(ptr, e, '0');
+        } else if (nr_digits > -e) {
+            ttlet point = digits_last + e;
+            ptr = std::copy(digits_first, point, ptr);
+            *ptr++ = '.';
+            ptr = std::copy(point, digits_last, ptr);
+        } else {
+            *ptr++ = '0';
+            *ptr++ = '.';
+            ptr = std::fill_n(ptr, -e - nr_digits, '0');
+            ptr = std::copy(digits_first, digits_last, ptr);
         }
+        return {ptr, std::errc{}};
+    }
 
-        if (decimal_position > 0) {
-            s.insert(s.size() - decimal_position, 1, '.');
+    /** Convert text to a decimal.
+     * The text is an optional '-' followed by digits, optionally with a '.' between them.
+     * A thousand separator (`'` or `,`) between two digits is skipped.
+     *
+     * Digits are scanned eight at a time when the text is long enough.
+     *
+     * @param first The first character of the text.
+     * @param last One beyond the last character of the text.
+     * @param[out] x The parsed decimal, unmodified on error.
+     * @return One beyond the last character of the number. `std::errc::invalid_argument` together
+     *         with @a first when there are no digits, or `std::errc::result_out_of_range` when
+     *         the digits do not fit in a 64 bit integer.
+     */
+    friend std::from_chars_result from_chars(char const *first, char const *last, decimal &x) noexcept
+    {
+        auto ptr = first;
+        ttlet negative = ptr != last and *ptr == '-';
+        if (negative) {
+            ++ptr;
         }
 
-        if (m < 0) {
-            s.insert(0, 1, '-');
+        ttlet limit = static_cast<unsigned long long>(std::numeric_limits<long long>::max()) + (negative ? 1 : 0);
+        unsigned long long m = 0;
+        int nr_digits = 0;
+        int nr_fraction_digits = 0;
+        bool has_point = false;
+        bool out_of_range = false;
+
+        ttlet is_digit = [](char c) {
+            return c >= '0' and c <= '9';
+        };
+
+        while (ptr != last) {
+            if (last - ptr >= 8) {
+                ttlet chars = load_eight_chars(ptr);
+                if (is_eight_digits(chars)) {
+                    ttlet chunk = parse_eight_digits(chars);
+                    if (m > (limit - chunk) / 100'000'000) {
+                        [[unlikely]] out_of_range = true;
+                    }
+                    m = m * 100'000'000 + chunk;
+                    nr_digits += 8;
+                    nr_fraction_digits += has_point ? 8 : 0;
+                    ptr += 8;
+                    continue;
+                }
+            }
+
+            ttlet c = *ptr;
+            if (is_digit(c)) {
+                ttlet digit = static_cast<unsigned long long>(c - '0');
+                if (m > (limit - digit) / 10) {
+                    [[unlikely]] out_of_range = true;
+                }
+                m = m * 10 + digit;
+                ++nr_digits;
+                nr_fraction_digits += has_point ? 1 : 0;
+
+            } else if (c == '.' and not has_point) {
+                has_point = true;
+
+            } else if ((c == '\'' or c == ',') and nr_digits != 0 and ptr + 1 != last and is_digit(ptr[1])) {
+                // Skip thousand separators.
+
+            } else {
+                break;
+            }
+            ++ptr;
         }
 
-        return s;
+        if (nr_digits == 0) {
+            return {first, std::errc::invalid_argument};
+        } else if (out_of_range) {
+            return {ptr, std::errc::result_out_of_range};
+        }
+
+        x = decimal{-nr_fraction_digits, static_cast<long long>(negative ? 0ULL - m : m)};
+        return {ptr, std::errc{}};
+    }
+
+    [[nodiscard]] friend std::string to_string(decimal x) noexcept
+    {
+        auto buffer = std::array<char, max_chars>{};
+        ttlet[last, ec] = to_chars(buffer.data(), buffer.data() + buffer.size(), x);
+        tt_axiom(ec == std::errc{});
+        return std::string(buffer.data(), last);
     }
 
     friend std::ostream &operator<<(std::ostream &lhs, decimal rhs)
@@ -541,40 +659,19 @@ private:
         return {e10, m};
     }
 
-    [[nodiscard]] std::pair<int, long long> to_exponent_mantissa(std::string_view str)
+    [[nodiscard]] static std::pair<int, long long> to_exponent_mantissa(std::string_view str)
     {
-        std::string mantissa_str;
-
-        int nr_digits = 0;
-        int nr_digits_in_front_of_point = -1;
-        for (ttlet c : str) {
-            if (c >= '0' && c <= '9') {
-                mantissa_str += c;
-                nr_digits++;
-            } else if (c == '.') {
-                nr_digits_in_front_of_point = nr_digits;
-            } else if (c == '\'' || c == ',') {
-                // Ignore thousand separators.
-            } else if (c == '-') {
-                mantissa_str += c;
-            } else {
-                throw parse_error("Unexpected character in decimal number '{}'", str);
-            }
-        }
+        ttlet first = str.data();
+        ttlet last = first + str.size();
 
-        int exponent = (nr_digits_in_front_of_point >= 0) ? (nr_digits_in_front_of_point - nr_digits) : 0;
-
-        auto first = mantissa_str.data();
-        auto last = first + mantissa_str.size();
-        long long mantissa;
-        auto result = std::from_chars(first, last, mantissa, 10);
-        if (result.ptr == first) {
-            throw parse_error("Could not parse mantissa '{}'", mantissa_str);
-        } else if (result.ec == std::errc::result_out_of_range) {
-            throw parse_error("Mantissa '{}' out of range ", mantissa_str);
-        } else {
-            return {exponent, mantissa};
+        auto r = decimal{};
+        ttlet[ptr, ec] = from_chars(first, last, r);
+        if (ec == std::errc::result_out_of_range) {
+            throw parse_error("Mantissa of decimal number '{}' out of range", str);
+        } else if (ec != std::errc{} or ptr != last) {
+            throw parse_error("Unexpected character in decimal number '{}'", str);
         }
+        return r.exponent_mantissa();
     }
 };
 
@@ -6,6 +6,8 @@
 #include <gtest/gtest.h>
 #include <iostream>
 #include <string>
+#include <array>
+#include <random>
 
 using namespace std;
 using namespace std::literals;
@@ -174,3 +176,113 @@ TEST(Decimal, Div) {
     ASSERT_EQ(decimal(-2, 42) / decimal(0, 55), decimal(-17, 763636363636363));
     ASSERT_EQ(decimal(-2, 42) / decimal(2, 55), decimal(-19, 763636363636363));
 }
+
+/** The conversion to string as it was implemented before to_chars(), used as a reference.
+ */
+static std::string reference_to_string(decimal x)
+{
+    auto [e, m] = x.exponent_mantissa();
+    auto s = std::to_string(std::abs(m));
+
+    auto decimal_position = -e;
+    auto leading_zeros = (decimal_position - std::ssize(s)) + 1;
+    if (leading_zeros > 0) {
+        s.insert(0, leading_zeros, '0');
+    }
+
+    auto trailing_zeros = e;
+    if (trailing_zeros > 0) {
+        s.append(trailing_zeros, '0');
+    }
+
+    if (decimal_position > 0) {
+        s.insert(s.size() - decimal_position, 1, '.');
+    }
+
+    if (m < 0) {
+        s.insert(0, 1, '-');
+    }
+    return s;
+}
+
+TEST(Decimal, ToChars)
+{
+    auto buffer = std::array<char, decimal::max_chars>{};
+    ttlet first = buffer.data();
+
+    ttlet [last, ec] = to_chars(first, first + buffer.size(), decimal(-3, -1'000'000'421));
+    ASSERT_EQ(ec, std::errc{});
+    ASSERT_EQ(std::string(first, last), "-1000000.421");
+
+    // The buffer is one character too small.
+    ttlet [last2, ec2] = to_chars(first, first + 11, decimal(-3, -1'000'000'421));
+    ASSERT_EQ(ec2, std::errc::value_too_large);
+    ASSERT_EQ(last2, first + 11);
+
+    ttlet [last3, ec3] = to_chars(first, first + buffer.size(), decimal(decimal::exponent_max, -36'028'797'018'963'967));
+    ASSERT_EQ(ec3, std::errc{});
+    ASSERT_EQ(last3, first + decimal::max_chars);
+}
+
+TEST(Decimal, FromChars)
+{
+    auto x = decimal{};
+
+    ttlet text = "-12345678901234.5678 rest"sv;
+    ttlet [ptr, ec] = from_chars(text.data(), text.data() + text.size(), x);
+    ASSERT_EQ(ec, std::errc{});
+    ASSERT_EQ(ptr, text.data() + 20);
+    // The mantissa is rounded to fit in 56 bits.
+    ASSERT_EQ(x.mantissa(), -12'345'678'901'234'567);
+    ASSERT_EQ(x.exponent(), -3);
+
+    // A separator is only skipped between digits.
+    ttlet separator = "1'000,"sv;
+    ttlet [ptr2, ec2] = from_chars(separator.data(), separator.data() + separator.size(), x);
+    ASSERT_EQ(ec2, std::errc{});
+    ASSERT_EQ(ptr2, separator.data() + 5);
+    ASSERT_EQ(x.mantissa(), 1000);
+
+    ttlet no_digits = "-.x"sv;
+    ttlet [ptr3, ec3] = from_chars(no_digits.data(), no_digits.data() + no_digits.size(), x);
+    ASSERT_EQ(ec3, std::errc::invalid_argument);
+    ASSERT_EQ(ptr3, no_digits.data());
+    ASSERT_EQ(x.mantissa(), 1000);
+
+    ttlet too_large = "99999999999999999999.5"sv;
+    ttlet [ptr4, ec4] = from_chars(too_large.data(), too_large.data() + too_large.size(), x);
+    ASSERT_EQ(ec4, std::errc::result_out_of_range);
+    ASSERT_EQ(x.mantissa(), 1000);
+
+    ASSERT_THROW(decimal("1.2.3"), parse_error);
+    ASSERT_THROW(decimal(""), parse_error);
+    ASSERT_THROW(decimal("12345678a"), parse_error);
+    ASSERT_THROW(decimal("99999999999999999999"), parse_error);
+}
+
+TEST(Decimal, RoundTrip)
+{
+    auto engine = std::mt19937_64{42};
+    auto exponent_distribution = std::uniform_int_distribution<int>{-30, 2};
+    auto digits_distribution = std::uniform_int_distribution<int>{0, 16};
+
+    for (int i = 0; i != 100'000; ++i) {
+        auto m = static_cast<long long>(engine() % 10'000'000'000'000'000ULL);
+        for (auto nr_digits = digits_distribution(engine); nr_digits != 16; ++nr_digits) {
+            m /= 10;
+        }
+        if (engine() % 2) {
+            m = -m;
+        }
+        ttlet x = decimal{exponent_distribution(engine), m};
+
+        ttlet s = to_string(x);
+        ASSERT_EQ(s, reference_to_string(x));
+
+        ttlet y = decimal{s};
+        ASSERT_EQ(y, x);
+        if (x.exponent() <= 0) {
+            ASSERT_EQ(y.exponent_mantissa(), x.exponent_mantissa());
+        }
+    }
+}
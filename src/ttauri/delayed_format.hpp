@@ -6,6 +6,7 @@
 #include <tuple>
 #include "forward_value.hpp"
 #include "fixed_string.hpp"
+#include "compiled_format.hpp"
 
 #pragma once
 
@@ -14,11 +15,13 @@ namespace tt {
 /** Delayed formatting.
  * This class will capture all the arguments so that it may be passed
  * to another thread. Then call the function operator to do the actual formatting.
+ *
+ * The format string is parsed at compile time, see `compiled_format`.
  */
 template<basic_fixed_string Fmt, typename... Values>
 class delayed_format {
 public:
-    static_assert(std::is_same_v<decltype(Fmt)::value_type, char>, "Fmt must be a basic_fixed_string<char>");
+    static_assert(std::is_same_v<typename decltype(Fmt)::value_type, char>, "Fmt must be a basic_fixed_string<char>");
 
     delayed_format(delayed_format &&) noexcept = default;
     delayed_format(delayed_format const &) noexcept = default;
@@ -48,8 +51,21 @@ public:
      */
     [[nodiscard]] std::string operator()() const noexcept
     {
-        auto tmp = std::tuple_cat(std::tuple{static_cast<char const *>(Fmt)}, _values);
-        return std::apply(fmt::format<char const *,Values const &...>, std::move(tmp));
+        auto r = std::string{};
+        format_to(r);
+        return r;
+    }
+
+    /** Format now.
+     * @param out The string to append the formatted text to.
+     */
+    void format_to(std::string &out) const noexcept
+    {
+        std::apply(
+            [&out](Values const &...values) {
+                compiled_format<Fmt>::format_to(out, values...);
+            },
+            _values);
     }
 
     /** Format now.
@@ -61,6 +77,13 @@ public:
         tt_not_implemented();
     }
 
+    /** The captured arguments.
+     */
+    [[nodiscard]] std::tuple<Values...> const &values() const noexcept
+    {
+        return _values;
+    }
+
 private:
     std::tuple<Values...> _values;
 };
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include "../unfair_mutex.hpp"
 #include "../notifier.hpp"
@@ -125,6 +126,17 @@ public:
         _notifier.unsubscribe(callback_ptr);
     }
 
+    /** Coalesce the notifications of changes in value.
+     * When enabled, a change marks the observable as modified and the listeners
+     * are notified once per frame, see `deliver_posted_notifications()`.
+     *
+     * @param flag True to coalesce the notifications, false to notify on each change.
+     */
+    void coalesce_notifications(bool flag) noexcept
+    {
+        _coalesce.store(flag, std::memory_order::relaxed);
+    }
+
 protected:
     mutable unfair_mutex _mutex;
 
@@ -139,13 +151,18 @@ protected:
             _previous_value = old_value;
             _last_modified = hires_utc_clock::now();
         }
-        _notifier();
+        if (_coalesce.load(std::memory_order::relaxed)) {
+            _notifier.post();
+        } else {
+            _notifier();
+        }
     }
 
 private:
     value_type _previous_value;
     time_point _last_modified;
     notifier_type _notifier;
+    std::atomic<bool> _coalesce = false;
 };
 
 } // namespace tt::detail
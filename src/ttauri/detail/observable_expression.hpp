@@ -0,0 +1,219 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "observable_base.hpp"
+#include <memory>
+#include <concepts>
+#include <functional>
+#include <type_traits>
+
+namespace tt {
+
+template<typename T>
+class observable;
+
+}
+
+namespace tt::detail {
+
+/** A leaf of an expression of observables.
+ * The value of the observable is cached by the leaf, and updated when the observable notifies
+ * the expression of a change.
+ */
+template<typename T>
+struct observable_leaf {
+    using operand_type = observable_base<T>;
+
+    std::shared_ptr<operand_type> operand;
+    T cache = {};
+    typename operand_type::callback_ptr_type callback = {};
+
+    [[nodiscard]] T evaluate() const noexcept
+    {
+        return cache;
+    }
+
+    bool store(T const &new_value) noexcept
+    {
+        return operand->store(new_value);
+    }
+
+    template<typename Function>
+    void for_each_leaf(Function &&function) noexcept
+    {
+        function(*this);
+    }
+};
+
+/** The logical-not of a sub-expression.
+ * Storing a value is forwarded, inverted, to the sub-expression.
+ */
+template<typename Operand>
+struct observable_not_expression {
+    Operand operand;
+
+    [[nodiscard]] bool evaluate() const noexcept
+    {
+        return !operand.evaluate();
+    }
+
+    bool store(bool const &new_value) noexcept
+    {
+        using operand_value_type = decltype(operand.evaluate());
+        return operand.store(static_cast<operand_value_type>(!new_value));
+    }
+
+    template<typename Function>
+    void for_each_leaf(Function &&function) noexcept
+    {
+        operand.for_each_leaf(function);
+    }
+};
+
+/** A binary operator on two sub-expressions.
+ * A value can not be stored into an expression of two operands.
+ */
+template<typename Operator, typename LHS, typename RHS>
+struct observable_binary_expression {
+    LHS lhs;
+    RHS rhs;
+
+    [[nodiscard]] auto evaluate() const noexcept
+    {
+        return Operator{}(lhs.evaluate(), rhs.evaluate());
+    }
+
+    template<typename T>
+    bool store(T const &) noexcept
+    {
+        return false;
+    }
+
+    template<typename Function>
+    void for_each_leaf(Function &&function) noexcept
+    {
+        lhs.for_each_leaf(function);
+        rhs.for_each_leaf(function);
+    }
+};
+
+template<typename T>
+constexpr bool is_observable_expression_v = false;
+
+template<typename Operand>
+constexpr bool is_observable_expression_v<observable_not_expression<Operand>> = true;
+
+template<typename Operator, typename LHS, typename RHS>
+constexpr bool is_observable_expression_v<observable_binary_expression<Operator, LHS, RHS>> = true;
+
+template<typename T>
+constexpr bool is_observable_v = false;
+
+template<typename T>
+constexpr bool is_observable_v<observable<T>> = true;
+
+/** An observable or an expression of observables.
+ */
+template<typename T>
+concept observable_operand = is_observable_v<T> || is_observable_expression_v<T>;
+
+/** Get the node of a sub-expression.
+ * The node of an observable is a leaf, found through argument dependent lookup.
+ */
+template<typename Expression>
+requires is_observable_expression_v<Expression>
+[[nodiscard]] Expression make_observable_node(Expression const &expression) noexcept
+{
+    return expression;
+}
+
+template<typename Operator, observable_operand LHS, observable_operand RHS>
+[[nodiscard]] auto make_observable_binary_expression(LHS const &lhs, RHS const &rhs) noexcept
+{
+    using lhs_node_type = decltype(make_observable_node(lhs));
+    using rhs_node_type = decltype(make_observable_node(rhs));
+    return observable_binary_expression<Operator, lhs_node_type, rhs_node_type>{make_observable_node(lhs), make_observable_node(rhs)};
+}
+
+template<observable_operand Operand>
+requires is_observable_expression_v<Operand>
+[[nodiscard]] auto operator!(Operand const &rhs) noexcept
+{
+    return observable_not_expression<Operand>{rhs};
+}
+
+template<observable_operand LHS, observable_operand RHS>
+requires(is_observable_expression_v<LHS> || is_observable_expression_v<RHS>)
+[[nodiscard]] auto operator&&(LHS const &lhs, RHS const &rhs) noexcept
+{
+    return make_observable_binary_expression<std::logical_and<>>(lhs, rhs);
+}
+
+template<observable_operand LHS, observable_operand RHS>
+requires(is_observable_expression_v<LHS> || is_observable_expression_v<RHS>)
+[[nodiscard]] auto operator||(LHS const &lhs, RHS const &rhs) noexcept
+{
+    return make_observable_binary_expression<std::logical_or<>>(lhs, rhs);
+}
+
+/** An observable that evaluates a whole expression of observables.
+ *
+ * Instead of a chain of observables, one for each operator, the expression is evaluated
+ * by a single node which subscribes once to each leaf of the expression. When a leaf changes
+ * only the cached value of that leaf is updated, and the listeners are only notified when
+ * the value of the expression has changed.
+ *
+ * @tparam T The type of the value of the observable.
+ * @tparam Expression The tree of sub-expressions with `observable_leaf` nodes at the leaves.
+ */
+template<typename T, typename Expression>
+class observable_expression final : public observable_base<T> {
+public:
+    observable_expression(Expression const &expression) noexcept : observable_base<T>(), _expression(expression)
+    {
+        _expression.for_each_leaf([this](auto &leaf) {
+            leaf.cache = leaf.operand->load();
+            leaf.callback = leaf.operand->subscribe([this, &leaf]() {
+                update(leaf);
+            });
+        });
+    }
+
+    T load() const noexcept override
+    {
+        ttlet lock = std::scoped_lock(this->_mutex);
+        return static_cast<T>(_expression.evaluate());
+    }
+
+    bool store(T const &new_value) noexcept override
+    {
+        return _expression.store(new_value);
+    }
+
+private:
+    Expression _expression;
+
+    template<typename Leaf>
+    void update(Leaf &leaf) noexcept
+    {
+        ttlet leaf_value = leaf.operand->load();
+
+        this->_mutex.lock();
+        ttlet old_value = static_cast<T>(_expression.evaluate());
+        leaf.cache = leaf_value;
+        ttlet new_value = static_cast<T>(_expression.evaluate());
+        this->_mutex.unlock();
+
+        if constexpr (std::equality_comparable<T>) {
+            if (new_value == old_value) {
+                return;
+            }
+        }
+        this->notify(old_value, new_value);
+    }
+};
+
+} // namespace tt::detail
@@ -9,7 +9,9 @@
 #include "URL.hpp"
 #include "required.hpp"
 #include "unfair_mutex.hpp"
+#include "thread.hpp"
 #include <mutex>
+#include <thread>
 
 namespace tt {
 
@@ -37,4 +39,32 @@ std::shared_ptr<file_mapping> file_view::findOrCreateFileMappingObject(URL const
     return _file_mapping_object;
 }
 
+void file_view::prefetch_async(size_t offset, size_t size) const noexcept
+{
+    if (offset >= this->size()) {
+        return;
+    }
+    size = std::min(size, this->size() - offset);
+
+    hint(file_view_hint::will_need, offset, size);
+
+    try {
+        std::thread([view = *this, offset, size]() {
+            set_thread_name("file_prefetch");
+
+            // Read one byte of each page, the sum is only used to keep the reads from being optimized away.
+            constexpr size_t page_size = 4096;
+            ttlet bytes = view.bytes().subspan(offset, size);
+            uint8_t sum = 0;
+            for (size_t i = 0; i < bytes.size(); i += page_size) {
+                sum += static_cast<uint8_t>(bytes[i]);
+            }
+            [[maybe_unused]] volatile uint8_t dummy = sum;
+        }).detach();
+
+    } catch (std::system_error const &e) {
+        tt_log_warning("Could not start prefetch of {}. \"{}\"", location(), e.what());
+    }
+}
+
 }
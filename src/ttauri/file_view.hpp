@@ -7,9 +7,37 @@
 #include "file_mapping.hpp"
 #include "resource_view.hpp"
 #include <span>
+#include <limits>
 
 namespace tt {
 
+/** How the memory of a file_view will be accessed.
+ * These are hints to the operating system, which may ignore them.
+ */
+enum class file_view_hint {
+    /** Default read-ahead.
+     */
+    normal,
+
+    /** The memory will be read from start to end; read-ahead aggressively.
+     */
+    sequential,
+
+    /** The memory will be read in random order; do not read-ahead.
+     */
+    random,
+
+    /** The memory will be needed soon; start reading it into memory.
+     */
+    will_need,
+
+    /** Back the memory with large pages when possible.
+     * This reduces TLB misses for large read-only caches. Only available on Linux
+     * with transparent huge pages for file mappings, otherwise it is ignored.
+     */
+    large_pages
+};
+
 /*! Map a file into virtual memory.
  */
 class file_view : public resource_view {
@@ -74,6 +102,24 @@ public:
      */
     void flush(void* base, size_t size);
 
+    /** Tell the operating system how a part of the view will be accessed.
+     * The part is extended to whole pages. A hint that can not be given is ignored.
+     *
+     * @param hint How the memory will be accessed.
+     * @param offset Offset from the start of the view.
+     * @param size Number of bytes, clamped to the end of the view.
+     */
+    void hint(file_view_hint hint, size_t offset = 0, size_t size = std::numeric_limits<size_t>::max()) const noexcept;
+
+    /** Read a part of the view into memory on a background thread.
+     * The memory is touched page by page, so that later accesses do not stall on page-faults.
+     * The thread holds a copy of the view, so that the memory stays mapped while prefetching.
+     *
+     * @param offset Offset from the start of the view.
+     * @param size Number of bytes, clamped to the end of the view.
+     */
+    void prefetch_async(size_t offset = 0, size_t size = std::numeric_limits<size_t>::max()) const noexcept;
+
     /*! Load a view of a resource.
      * This is used when the resource that needs to be opened is a file.
      */
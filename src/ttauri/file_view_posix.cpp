@@ -10,6 +10,7 @@
 #include "required.hpp"
 #include <mutex>
 #include <sys/mman.h>
+#include <unistd.h>
 
 namespace tt {
 
@@ -96,4 +97,36 @@ void file_view::flush(void *base, size_t size)
     }
 }
 
+void file_view::hint(file_view_hint hint, size_t offset, size_t size) const noexcept
+{
+    if (offset >= this->size()) {
+        return;
+    }
+    size = std::min(size, this->size() - offset);
+
+    int advice;
+    switch (hint) {
+    case file_view_hint::normal: advice = MADV_NORMAL; break;
+    case file_view_hint::sequential: advice = MADV_SEQUENTIAL; break;
+    case file_view_hint::random: advice = MADV_RANDOM; break;
+    case file_view_hint::will_need: advice = MADV_WILLNEED; break;
+    case file_view_hint::large_pages:
+#if defined(MADV_HUGEPAGE)
+        advice = MADV_HUGEPAGE;
+        break;
+#else
+        return;
+#endif
+    default: tt_no_default();
+    }
+
+    // madvise() requires an address at the start of a page.
+    ttlet page_size = static_cast<uintptr_t>(::sysconf(_SC_PAGESIZE));
+    ttlet first = reinterpret_cast<uintptr_t>(_bytes->data() + offset);
+    ttlet aligned_first = first & ~(page_size - 1);
+
+    // The hint is advisory, failure is not an error.
+    [[maybe_unused]] ttlet r = ::madvise(reinterpret_cast<void *>(aligned_first), size + (first - aligned_first), advice);
+}
+
 } // namespace tt
@@ -17,3 +17,16 @@ TEST(file_view, read) {
     ttlet *test = reinterpret_cast<char const *>(view.bytes().data());
     ASSERT_TRUE(strncmp(test, "The quick brown", 15) == 0);
 }
+
+TEST(file_view, hint) {
+    ttlet view = file_view(URL("file:file_view.txt"));
+
+    view.hint(file_view_hint::sequential);
+    view.hint(file_view_hint::random, 4, 1'000'000);
+    view.hint(file_view_hint::large_pages);
+    view.hint(file_view_hint::will_need, view.size());
+    view.prefetch_async();
+
+    ttlet *test = reinterpret_cast<char const *>(view.bytes().data());
+    ASSERT_TRUE(strncmp(test, "The quick brown", 15) == 0);
+}
@@ -106,4 +106,33 @@ void file_view::flush(void* base, size_t size)
     }
 }
 
+void file_view::hint(file_view_hint hint, size_t offset, size_t size) const noexcept
+{
+    if (offset >= this->size()) {
+        return;
+    }
+    size = std::min(size, this->size() - offset);
+
+    switch (hint) {
+    case file_view_hint::normal:
+    case file_view_hint::random:
+        // Windows has no read-ahead hints for a mapped view.
+        return;
+
+    case file_view_hint::large_pages:
+        // Large pages are only available for page-file backed sections.
+        return;
+
+    case file_view_hint::sequential:
+    case file_view_hint::will_need: {
+        // The hint is advisory, failure is not an error.
+        auto range = WIN32_MEMORY_RANGE_ENTRY{_bytes->data() + offset, size};
+        [[maybe_unused]] ttlet r = PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+        return;
+    }
+
+    default: tt_no_default();
+    }
+}
+
 }
@@ -2,7 +2,9 @@
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
-
+#include <algorithm>
+#include <string>
+#include <string_view>
 
 #pragma once
 
@@ -36,10 +38,7 @@ struct basic_fixed_string {
     constexpr basic_fixed_string &operator=(basic_fixed_string const &) noexcept = default;
     constexpr basic_fixed_string &operator=(basic_fixed_string &&) noexcept = default;
 
-    [[nodiscard]] constexpr basic_fixed_string() noexcept : _str()
-    {
-        std::memset(&_str[0], 0, sizeof(CharT) * N);
-    }
+    [[nodiscard]] constexpr basic_fixed_string() noexcept : _str() {}
 
     [[nodiscard]] constexpr basic_fixed_string(value_type const (&str)[N + 1]) noexcept : _str()
     {
@@ -82,7 +81,7 @@ struct basic_fixed_string {
     }
 
     template<int M>
-    [[nodiscard]] constexpr auto operator+(basic_fixed_string<value_type, M> const &rhs) noexcept
+    [[nodiscard]] constexpr auto operator+(basic_fixed_string<value_type, M> const &rhs) const noexcept
     {
         auto r = basic_fixed_string<value_type, N+M>{};
         std::copy_n(data(), N, &r._str[0]);
@@ -96,6 +95,29 @@ struct basic_fixed_string {
 template<typename CharT, size_t N>
 basic_fixed_string(CharT const (&)[N]) -> basic_fixed_string<CharT, N - 1>;
 
+/** Convert a non-negative integer to a fixed string of decimal digits at compile time.
+ */
+template<auto Value>
+[[nodiscard]] constexpr auto to_fixed_string() noexcept
+{
+    static_assert(Value >= 0);
+
+    constexpr auto nr_digits = [] {
+        int r = 1;
+        for (auto v = Value; v >= 10; v /= 10) {
+            ++r;
+        }
+        return r;
+    }();
+
+    auto r = basic_fixed_string<char, nr_digits>{};
+    auto v = Value;
+    for (auto i = nr_digits; i != 0; --i) {
+        r._str[i - 1] = static_cast<char>('0' + v % 10);
+        v /= 10;
+    }
+    return r;
+}
 
 template<size_t N>
 using fixed_string = basic_fixed_string<char,N>;
@@ -7,6 +7,8 @@
 #include <emmintrin.h>
 #include <immintrin.h>
 #include <type_traits>
+#include <span>
+#include <cstdint>
 
 namespace tt {
 
@@ -59,4 +61,47 @@ public:
     }
 };
 
+/** Convert floats to float16 values.
+ * Eight values are converted per instruction, the remainder one at a time.
+ *
+ * @param src The floats to convert.
+ * @param dst The converted values, must be the same size as src.
+ */
+inline void float_to_float16(std::span<float const> src, std::span<float16> dst) noexcept
+{
+    static_assert(sizeof(float16) == sizeof(uint16_t));
+    tt_axiom(src.size() == dst.size());
+
+    ttlet size = src.size();
+    auto i = size_t{0};
+    for (; i + 8 <= size; i += 8) {
+        ttlet tmp = _mm256_cvtps_ph(_mm256_loadu_ps(src.data() + i), _MM_FROUND_CUR_DIRECTION);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst.data() + i), tmp);
+    }
+    for (; i != size; ++i) {
+        dst[i] = src[i];
+    }
+}
+
+/** Convert float16 values to floats.
+ * Eight values are converted per instruction, the remainder one at a time.
+ *
+ * @param src The float16 values to convert.
+ * @param dst The converted floats, must be the same size as src.
+ */
+inline void float16_to_float(std::span<float16 const> src, std::span<float> dst) noexcept
+{
+    tt_axiom(src.size() == dst.size());
+
+    ttlet size = src.size();
+    auto i = size_t{0};
+    for (; i + 8 <= size; i += 8) {
+        ttlet tmp = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src.data() + i));
+        _mm256_storeu_ps(dst.data() + i, _mm256_cvtph_ps(tmp));
+    }
+    for (; i != size; ++i) {
+        dst[i] = src[i];
+    }
+}
+
 }
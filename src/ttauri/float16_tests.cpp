@@ -0,0 +1,103 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/color/sfloat_rgba16.hpp"
+#include "ttauri/pixel_map.inl"
+#include <gtest/gtest.h>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace tt;
+
+TEST(float16, bulk_conversion)
+{
+    // Not a multiple of eight, so that both the vector and scalar path are used.
+    auto floats = std::vector<float>{};
+    for (auto i = 0; i != 21; ++i) {
+        floats.push_back(static_cast<float>(i) * 0.25f - 2.0f);
+    }
+
+    auto halfs = std::vector<float16>(floats.size());
+    float_to_float16(floats, halfs);
+    for (size_t i = 0; i != floats.size(); ++i) {
+        ASSERT_TRUE(halfs[i] == float16{floats[i]});
+    }
+
+    auto result = std::vector<float>(floats.size());
+    float16_to_float(halfs, result);
+    for (size_t i = 0; i != floats.size(); ++i) {
+        // These values are exactly representable as float16.
+        ASSERT_EQ(result[i], floats[i]);
+    }
+}
+
+TEST(float16, sfloat_rgba16_conversion)
+{
+    auto pixels = std::vector<f32x4>{};
+    for (auto i = 0; i != 5; ++i) {
+        pixels.emplace_back(static_cast<float>(i), 0.5f, -1.0f, 1.0f);
+    }
+
+    auto halfs = std::vector<sfloat_rgba16>(pixels.size());
+    to_sfloat_rgba16(pixels, halfs);
+    for (size_t i = 0; i != pixels.size(); ++i) {
+        ASSERT_TRUE(halfs[i] == sfloat_rgba16{pixels[i]});
+    }
+
+    auto result = std::vector<f32x4>(pixels.size());
+    to_f32x4(halfs, result);
+    for (size_t i = 0; i != pixels.size(); ++i) {
+        ASSERT_TRUE(result[i] == pixels[i]);
+    }
+}
+
+TEST(float16, sfloat_rgba16_fill_composit)
+{
+    // Wider than a chunk, and not a multiple of the chunk size.
+    auto under = pixel_map<sfloat_rgba16>(100, 2);
+    fill(under, f32x4{0.0f, 0.0f, 1.0f, 1.0f});
+
+    auto mask = pixel_map<uint8_t>(100, 2);
+    fill(mask);
+    mask[1][99] = 255;
+
+    composit(under, color{1.0f, 0.0f, 0.0f, 1.0f}, mask);
+    ASSERT_TRUE(static_cast<f32x4>(under[0][0]) == f32x4(0.0f, 0.0f, 1.0f, 1.0f));
+    ASSERT_TRUE(static_cast<f32x4>(under[1][98]) == f32x4(0.0f, 0.0f, 1.0f, 1.0f));
+    ASSERT_TRUE(static_cast<f32x4>(under[1][99]) == f32x4(1.0f, 0.0f, 0.0f, 1.0f));
+}
+
+TEST(float16, sfloat_rgba16_composit_mask)
+{
+    // Transparent, fully covered and partially covered chunks.
+    auto mask = pixel_map<uint8_t>(200, 3);
+    fill(mask);
+    for (ssize_t x = 64; x != 128; ++x) {
+        mask[0][x] = 255;
+    }
+    for (ssize_t x = 0; x != 200; ++x) {
+        mask[1][x] = static_cast<uint8_t>(x);
+        mask[2][x] = static_cast<uint8_t>(x % 2 == 0 ? 255 : x);
+    }
+
+    for (ttlet over : {color{1.0f, 0.5f, 0.0f, 1.0f}, color{1.0f, 0.5f, 0.0f, 0.5f}}) {
+        auto under = pixel_map<sfloat_rgba16>(200, 3);
+        fill(under, f32x4{0.0f, 0.0f, 1.0f, 0.75f});
+        composit(under, over, mask);
+
+        for (ssize_t y = 0; y != 3; ++y) {
+            for (ssize_t x = 0; x != 200; ++x) {
+                auto over_ = over;
+                over_.a() *= mask[y][x] / 255.0f;
+                ttlet expected = static_cast<f32x4>(composit(color{0.0f, 0.0f, 1.0f, 0.75f}, over_));
+                ttlet result = static_cast<f32x4>(under[y][x]);
+                for (size_t i = 0; i != 4; ++i) {
+                    ASSERT_NEAR(result[i], expected[i], 0.002f) << "x=" << x << " y=" << y;
+                }
+            }
+        }
+    }
+}
@@ -62,6 +62,21 @@ public:
         items.clear();
     }
 
+    /** Reset a single item and the margins on both sides of it.
+     *
+     * The margins are shared with the neighbouring items; after the reset `update()` must be
+     * called again for the items at `index - 1`, `index` and `index + 1`.
+     */
+    void clear(ssize_t index) noexcept
+    {
+        tt_axiom(index >= 0);
+        tt_axiom(index < std::ssize(items));
+
+        items[index] = {};
+        margins[index] = 0;
+        margins[index + 1] = 0;
+    }
+
     [[nodiscard]] size_t nr_items() const noexcept
     {
         return items.size();
@@ -147,17 +147,27 @@ static std::unique_ptr<formula_node> parse_operation_formula(
     */
 static std::unique_ptr<formula_node> parse_primary_formula(formula_parse_context& context)
 {
-    ttlet &location = context->location;
+    // Copy the location, the current token is replaced when advancing the context.
+    ttlet location = context->location;
 
     switch (context->name) {
-    case tokenizer_name_t::IntegerLiteral:
-        return std::make_unique<formula_literal_node>(location, static_cast<long long>(*context++));
+    case tokenizer_name_t::IntegerLiteral: {
+        ttlet value = static_cast<long long>(*context);
+        ++context;
+        return std::make_unique<formula_literal_node>(location, value);
+    }
 
-    case tokenizer_name_t::FloatLiteral:
-        return std::make_unique<formula_literal_node>(location, static_cast<double>(*context++));
+    case tokenizer_name_t::FloatLiteral: {
+        ttlet value = static_cast<double>(*context);
+        ++context;
+        return std::make_unique<formula_literal_node>(location, value);
+    }
 
-    case tokenizer_name_t::StringLiteral:
-        return std::make_unique<formula_literal_node>(location, static_cast<std::string>(*context++));
+    case tokenizer_name_t::StringLiteral: {
+        auto value = static_cast<std::string>(*context);
+        ++context;
+        return std::make_unique<formula_literal_node>(location, std::move(value));
+    }
 
     case tokenizer_name_t::Name:
         if (*context == "true") {
@@ -177,7 +187,9 @@ static std::unique_ptr<formula_node> parse_primary_formula(formula_parse_context
             return std::make_unique<formula_literal_node>(location, datum{});
 
         } else {
-            return std::make_unique<formula_name_node>(location, (context++)->value);
+            auto node = std::make_unique<formula_name_node>(location, context->value);
+            ++context;
+            return node;
         }
 
     case tokenizer_name_t::Operator:
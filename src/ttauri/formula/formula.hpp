@@ -27,7 +27,7 @@ inline std::unique_ptr<formula_node> parse_formula(std::string_view::const_itera
     auto e = parse_formula(parse_context);
 
     auto post_process_context = formula_post_process_context();
-    e->post_process(post_process_context);
+    post_process_context.post_process(e);
     return e;
 }
 
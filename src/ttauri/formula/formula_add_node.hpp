@@ -16,12 +16,16 @@ struct formula_add_node final : formula_binary_operator_node {
         auto lhs_ = lhs->evaluate(context);
         auto rhs_ = rhs->evaluate(context);
         try {
-            return lhs_ + rhs_;
+            return std::move(lhs_) + rhs_;
         } catch (std::exception const &e) {
             throw operation_error("{}: Can not evaluate add.\n{}", location, e.what());
         }
     }
 
+    uint16_t compile(formula_compile_context& context) const override {
+        return context.compile_binary(formula_opcode::add, *this, *lhs, *rhs);
+    }
+
     std::string string() const noexcept override {
         return fmt::format("({} + {})", *lhs, *rhs);
     }
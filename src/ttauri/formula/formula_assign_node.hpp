@@ -17,6 +17,10 @@ struct formula_assign_node final : formula_binary_operator_node {
         return lhs->assign(context, rhs_);
     }
 
+    uint16_t compile(formula_compile_context& context) const override {
+        return context.compile_assign(*this, *lhs, *rhs);
+    }
+
     std::string string() const noexcept override {
         return fmt::format("({} = {})", *lhs, *rhs);
     }
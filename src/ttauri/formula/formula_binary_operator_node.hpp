@@ -16,8 +16,12 @@ struct formula_binary_operator_node : formula_node {
         formula_node(std::move(location)), lhs(std::move(lhs)), rhs(std::move(rhs)) {}
 
     void post_process(formula_post_process_context& context) override {
-        lhs->post_process(context);
-        rhs->post_process(context);
+        context.post_process(lhs);
+        context.post_process(rhs);
+    }
+
+    bool is_constant() const override {
+        return lhs->is_constant() && rhs->is_constant();
     }
 
     std::string string() const noexcept override {
@@ -22,6 +22,10 @@ struct formula_bit_and_node final : formula_binary_operator_node {
         }
     }
 
+    uint16_t compile(formula_compile_context& context) const override {
+        return context.compile_binary(formula_opcode::bit_and, *this, *lhs, *rhs);
+    }
+
     std::string string() const noexcept override {
         return fmt::format("({} & {})", *lhs, *rhs);
     }
@@ -0,0 +1,600 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "formula_bytecode.hpp"
+#include "formula_compile_context.hpp"
+#include "formula_node.hpp"
+#include "../exception.hpp"
+#include <iterator>
+
+namespace tt {
+
+formula_bytecode::formula_bytecode(formula_node const &root)
+{
+    try {
+        auto context = formula_compile_context{};
+        [[maybe_unused]] ttlet r = root.compile(context);
+        tt_axiom(r == 0);
+        *this = std::move(context.code);
+
+    } catch (operation_error const &) {
+        // The formula does not fit in the registers or tables of the bytecode, evaluate it as a tree.
+        auto context = formula_compile_context{};
+        [[maybe_unused]] ttlet r = context.compile_evaluate(root);
+        *this = std::move(context.code);
+    }
+}
+
+[[nodiscard]] datum formula_bytecode::evaluate(formula_evaluation_context &context) const
+{
+    tt_axiom(not empty());
+
+    // The registers are a window on a stack in the context, so that a formula that
+    // is evaluated recursively, through a function call, gets its own registers.
+    auto &registers = context.registers;
+    ttlet base = registers.size();
+    registers.resize(base + _nr_registers);
+
+    try {
+        run(context, base);
+    } catch (...) {
+        context.registers.resize(base);
+        throw;
+    }
+
+    auto r = std::move(context.registers[base]);
+    context.registers.resize(base);
+    return r;
+}
+
+[[nodiscard]] char const *formula_bytecode::operator_name(formula_opcode op) noexcept
+{
+    switch (op) {
+    case formula_opcode::load_name: return "function";
+    case formula_opcode::load_member: return "member selection";
+    case formula_opcode::load_xvalue_member: return "member selection";
+    case formula_opcode::increment: return "increment";
+    case formula_opcode::decrement: return "decrement";
+    case formula_opcode::minus: return "unary-minus";
+    case formula_opcode::plus: return "unary-plus";
+    case formula_opcode::invert: return "binary-not";
+    case formula_opcode::logical_not: return "logical not";
+    case formula_opcode::add: return "add";
+    case formula_opcode::sub: return "subtract";
+    case formula_opcode::mul: return "multiply";
+    case formula_opcode::div: return "division";
+    case formula_opcode::mod: return "modulo";
+    case formula_opcode::pow: return "power-operator";
+    case formula_opcode::shl: return "shift-left";
+    case formula_opcode::shr: return "shift-right";
+    case formula_opcode::bit_and: return "binary-and";
+    case formula_opcode::bit_or: return "binary-or";
+    case formula_opcode::bit_xor: return "binary-xor";
+    case formula_opcode::eq:
+    case formula_opcode::ne:
+    case formula_opcode::lt:
+    case formula_opcode::gt:
+    case formula_opcode::le:
+    case formula_opcode::ge: return "comparison";
+    case formula_opcode::index: return "indexing operation";
+    case formula_opcode::inplace_add: return "inplace-add";
+    case formula_opcode::inplace_sub: return "inplace-subtract";
+    case formula_opcode::inplace_mul: return "inplace-multiply";
+    case formula_opcode::inplace_div: return "inplace-divide";
+    case formula_opcode::inplace_mod: return "inplace_modulo";
+    case formula_opcode::inplace_shl: return "inplace-shift-left";
+    case formula_opcode::inplace_shr: return "inplace-shift-right";
+    case formula_opcode::inplace_and: return "inplace-and";
+    case formula_opcode::inplace_or: return "inplace-or";
+    case formula_opcode::inplace_xor: return "inplace-xor";
+    default: return nullptr;
+    }
+}
+
+[[nodiscard]] datum formula_bytecode::execute(formula_opcode op, datum &&lhs, datum const &rhs)
+{
+    switch (op) {
+    case formula_opcode::minus: return -lhs;
+    case formula_opcode::plus: return +lhs;
+    case formula_opcode::invert: return ~lhs;
+    case formula_opcode::logical_not: return !lhs;
+    case formula_opcode::add: return std::move(lhs) + rhs;
+    case formula_opcode::sub: return lhs - rhs;
+    case formula_opcode::mul: return lhs * rhs;
+    case formula_opcode::div: return lhs / rhs;
+    case formula_opcode::mod: return lhs % rhs;
+    case formula_opcode::pow: return pow(lhs, rhs);
+    case formula_opcode::shl: return lhs << rhs;
+    case formula_opcode::shr: return lhs >> rhs;
+    case formula_opcode::bit_and: return lhs & rhs;
+    case formula_opcode::bit_or: return lhs | rhs;
+    case formula_opcode::bit_xor: return lhs ^ rhs;
+    case formula_opcode::eq: return lhs == rhs;
+    case formula_opcode::ne: return lhs != rhs;
+    case formula_opcode::lt: return lhs < rhs;
+    case formula_opcode::gt: return lhs > rhs;
+    case formula_opcode::le: return lhs <= rhs;
+    case formula_opcode::ge: return lhs >= rhs;
+    case formula_opcode::index:
+        if (!lhs.contains(rhs)) {
+            throw operation_error("Unknown key '{}'.", rhs);
+        }
+        return std::as_const(lhs)[rhs];
+    default: tt_no_default();
+    }
+}
+
+[[nodiscard]] static datum &execute_inplace(formula_opcode op, datum &lhs, datum &&rhs)
+{
+    switch (op) {
+    case formula_opcode::inplace_add: return lhs += std::move(rhs);
+    case formula_opcode::inplace_sub: return lhs -= rhs;
+    case formula_opcode::inplace_mul: return lhs *= rhs;
+    case formula_opcode::inplace_div: return lhs /= rhs;
+    case formula_opcode::inplace_mod: return lhs %= rhs;
+    case formula_opcode::inplace_shl: return lhs <<= rhs;
+    case formula_opcode::inplace_shr: return lhs >>= rhs;
+    case formula_opcode::inplace_and: return lhs &= rhs;
+    case formula_opcode::inplace_or: return lhs |= rhs;
+    case formula_opcode::inplace_xor: return lhs ^= rhs;
+    default: tt_no_default();
+    }
+}
+
+void formula_bytecode::run(formula_evaluation_context &context, size_t base) const
+{
+    ttlet *const first = _code.data();
+    ttlet *const last = first + _code.size();
+    auto *ip = first;
+
+    // Instructions that evaluate nodes of the tree may recursively evaluate bytecode,
+    // which may reallocate the registers; after those `r` is reloaded and values
+    // are moved out of the registers before they are passed.
+    auto *r = context.registers.data() + base;
+
+    try {
+        while (ip != last) {
+            ttlet &i = *ip++;
+
+            switch (i.op) {
+            case formula_opcode::load_constant: r[i.dst] = _constants[i.index]; break;
+
+            case formula_opcode::load_name: r[i.dst] = std::as_const(context).get(_names[i.index]); break;
+
+            case formula_opcode::load_member: {
+                ttlet &lhs = r[i.a];
+                ttlet &name = _constants[i.index];
+                if (!lhs.contains(name)) {
+                    throw operation_error("Unknown attribute .{}", name);
+                }
+                r[i.dst] = lhs[name];
+            } break;
+
+            case formula_opcode::load_xvalue_member: {
+                ttlet &lhs = std::as_const(context).get(_names[i.b]);
+                ttlet &name = _constants[i.index];
+                if (!lhs.contains(name)) {
+                    throw operation_error("Unknown attribute .{}", name);
+                }
+                r[i.dst] = lhs[name];
+            } break;
+
+            case formula_opcode::evaluate: {
+                auto tmp = _nodes[i.index]->evaluate(context);
+                r = context.registers.data() + base;
+                r[i.dst] = std::move(tmp);
+            } break;
+
+            case formula_opcode::call: {
+                ttlet args = datum::vector(std::make_move_iterator(r + i.a), std::make_move_iterator(r + i.a + i.b));
+                auto tmp = _nodes[i.index]->call(context, args);
+                r = context.registers.data() + base;
+                r[i.dst] = std::move(tmp);
+            } break;
+
+            case formula_opcode::assign: {
+                ttlet rhs = std::move(r[i.a]);
+                auto tmp = _nodes[i.index]->assign(context, rhs);
+                r = context.registers.data() + base;
+                r[i.dst] = std::move(tmp);
+            } break;
+
+            case formula_opcode::increment: {
+                auto tmp = ++_nodes[i.index]->evaluate_lvalue(context);
+                r = context.registers.data() + base;
+                r[i.dst] = std::move(tmp);
+            } break;
+
+            case formula_opcode::decrement: {
+                auto tmp = --_nodes[i.index]->evaluate_lvalue(context);
+                r = context.registers.data() + base;
+                r[i.dst] = std::move(tmp);
+            } break;
+
+            case formula_opcode::make_vector: {
+                auto tmp = datum::vector(std::make_move_iterator(r + i.a), std::make_move_iterator(r + i.a + i.b));
+                r[i.dst] = datum{std::move(tmp)};
+            } break;
+
+            case formula_opcode::make_map: {
+                auto tmp = datum::map{};
+                for (auto j = 0; j != i.b; ++j) {
+                    tmp[std::move(r[i.a + 2 * j])] = std::move(r[i.a + 2 * j + 1]);
+                }
+                r[i.dst] = datum{std::move(tmp)};
+            } break;
+
+            case formula_opcode::jump: ip = first + i.index; break;
+
+            case formula_opcode::jump_if_true:
+                if (r[i.a]) {
+                    ip = first + i.index;
+                }
+                break;
+
+            case formula_opcode::jump_if_false:
+                if (!r[i.a]) {
+                    ip = first + i.index;
+                }
+                break;
+
+            case formula_opcode::minus:
+            case formula_opcode::plus:
+            case formula_opcode::invert:
+            case formula_opcode::logical_not: r[i.dst] = execute(i.op, std::move(r[i.a]), datum{}); break;
+
+            case formula_opcode::inplace_add:
+            case formula_opcode::inplace_sub:
+            case formula_opcode::inplace_mul:
+            case formula_opcode::inplace_div:
+            case formula_opcode::inplace_mod:
+            case formula_opcode::inplace_shl:
+            case formula_opcode::inplace_shr:
+            case formula_opcode::inplace_and:
+            case formula_opcode::inplace_or:
+            case formula_opcode::inplace_xor: {
+                auto rhs = std::move(r[i.a]);
+                auto &lhs = _nodes[i.index]->evaluate_lvalue(context);
+                auto tmp = execute_inplace(i.op, lhs, std::move(rhs));
+                r = context.registers.data() + base;
+                r[i.dst] = std::move(tmp);
+            } break;
+
+            default: r[i.dst] = execute(i.op, std::move(r[i.a]), r[i.b]);
+            }
+        }
+
+    } catch (std::exception const &e) {
+        ttlet index = ip - first - 1;
+        if (ttlet name = operator_name(_code[index].op)) {
+            throw operation_error("{}: Can not evaluate {}.\n{}", _sources[index]->location, name, e.what());
+        } else {
+            throw;
+        }
+    }
+}
+
+[[nodiscard]] uint16_t formula_compile_context::allocate()
+{
+    if (nr_registers > std::numeric_limits<uint16_t>::max()) {
+        throw operation_error("Formula needs more than {} registers", nr_registers);
+    }
+
+    ttlet r = narrow_cast<uint16_t>(nr_registers++);
+    code._nr_registers = std::max(code._nr_registers, nr_registers);
+    return r;
+}
+
+void formula_compile_context::release(uint16_t r) noexcept
+{
+    tt_axiom(r <= nr_registers);
+    nr_registers = r;
+}
+
+ssize_t formula_compile_context::emit(formula_node const &source, formula_opcode op, uint16_t dst, uint16_t a, uint16_t b, uint32_t index)
+{
+    code._code.push_back({op, dst, a, b, index});
+    code._sources.push_back(&source);
+    return std::ssize(code._code) - 1;
+}
+
+[[nodiscard]] uint32_t formula_compile_context::label() noexcept
+{
+    fold_barrier = std::ssize(code._code);
+    return narrow_cast<uint32_t>(fold_barrier);
+}
+
+void formula_compile_context::patch_jump(ssize_t jump, uint32_t target) noexcept
+{
+    code._code[jump].index = target;
+}
+
+[[nodiscard]] uint32_t formula_compile_context::add_constant(datum value)
+{
+    code._constants.push_back(std::move(value));
+    return narrow_cast<uint32_t>(code._constants.size() - 1);
+}
+
+[[nodiscard]] uint32_t formula_compile_context::add_name(std::string const &name)
+{
+    if (code._names.size() > std::numeric_limits<uint16_t>::max()) {
+        throw operation_error("Formula uses more than {} names", code._names.size());
+    }
+
+    code._names.push_back(name);
+    return narrow_cast<uint32_t>(code._names.size() - 1);
+}
+
+[[nodiscard]] uint32_t formula_compile_context::add_node(formula_node const &node)
+{
+    code._nodes.push_back(&node);
+    return narrow_cast<uint32_t>(code._nodes.size() - 1);
+}
+
+[[nodiscard]] bool formula_compile_context::are_constants(uint16_t first, ssize_t n) const noexcept
+{
+    ttlet size = std::ssize(code._code);
+    if (n > size - fold_barrier) {
+        return false;
+    }
+
+    for (ssize_t i = 0; i != n; ++i) {
+        ttlet &instruction = code._code[size - n + i];
+        if (instruction.op != formula_opcode::load_constant || instruction.dst != first + i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+[[nodiscard]] datum const &formula_compile_context::constant(uint16_t r) const noexcept
+{
+    for (auto i = code._code.crbegin(); i != code._code.crend(); ++i) {
+        if (i->dst == r) {
+            tt_axiom(i->op == formula_opcode::load_constant);
+            return code._constants[i->index];
+        }
+    }
+    tt_no_default();
+}
+
+uint16_t formula_compile_context::fold(formula_node const &source, uint16_t first, ssize_t n, datum value)
+{
+    tt_axiom(are_constants(first, n));
+
+    for (ssize_t i = 0; i != n; ++i) {
+        // Remove the constants of the folded instructions, when they are not shared.
+        if (code._code.back().index + 1 == code._constants.size()) {
+            code._constants.pop_back();
+        }
+        code._code.pop_back();
+        code._sources.pop_back();
+    }
+
+    release(first);
+    return compile_constant(source, value);
+}
+
+uint16_t formula_compile_context::compile_evaluate(formula_node const &node)
+{
+    ttlet r = allocate();
+    emit(node, formula_opcode::evaluate, r, 0, 0, add_node(node));
+    return r;
+}
+
+uint16_t formula_compile_context::compile_constant(formula_node const &node, datum const &value)
+{
+    ttlet r = allocate();
+    emit(node, formula_opcode::load_constant, r, 0, 0, add_constant(value));
+    return r;
+}
+
+uint16_t formula_compile_context::compile_name(formula_node const &node, std::string const &name)
+{
+    ttlet r = allocate();
+    emit(node, formula_opcode::load_name, r, 0, 0, add_name(name));
+    return r;
+}
+
+uint16_t formula_compile_context::compile_member(formula_node const &node, formula_node const &lhs, std::string const &name)
+{
+    if (lhs.has_evaluate_xvalue()) {
+        // Select the member directly from the variable, without copying the variable into a register.
+        ttlet r = allocate();
+        emit(node, formula_opcode::load_xvalue_member, r, 0, narrow_cast<uint16_t>(add_name(lhs.get_name())), add_constant(datum{name}));
+        return r;
+
+    } else {
+        ttlet r = lhs.compile(*this);
+        emit(node, formula_opcode::load_member, r, r, 0, add_constant(datum{name}));
+        return r;
+    }
+}
+
+uint16_t formula_compile_context::compile_unary(formula_opcode op, formula_node const &node, formula_node const &rhs)
+{
+    ttlet a = rhs.compile(*this);
+
+    if (are_constants(a, 1)) {
+        try {
+            return fold(node, a, 1, formula_bytecode::execute(op, datum{constant(a)}, datum{}));
+        } catch (std::exception const &) {
+            // Leave the error for the evaluation, which reports it together with the data.
+        }
+    }
+
+    emit(node, op, a, a);
+    return a;
+}
+
+uint16_t formula_compile_context::compile_binary(formula_opcode op, formula_node const &node, formula_node const &lhs, formula_node const &rhs)
+{
+    ttlet a = lhs.compile(*this);
+    ttlet b = rhs.compile(*this);
+    tt_axiom(b == a + 1);
+
+    if (are_constants(a, 2)) {
+        try {
+            return fold(node, a, 2, formula_bytecode::execute(op, datum{constant(a)}, constant(b)));
+        } catch (std::exception const &) {
+            // Leave the error for the evaluation, which reports it together with the data.
+        }
+    }
+
+    emit(node, op, a, a, b);
+    release(b);
+    return a;
+}
+
+uint16_t formula_compile_context::compile_inplace(formula_opcode op, formula_node const &node, formula_node const &lhs, formula_node const &rhs)
+{
+    ttlet a = rhs.compile(*this);
+    emit(node, op, a, a, 0, add_node(lhs));
+    return a;
+}
+
+uint16_t formula_compile_context::compile_lvalue(formula_opcode op, formula_node const &node, formula_node const &rhs)
+{
+    ttlet r = allocate();
+    emit(node, op, r, 0, 0, add_node(rhs));
+    return r;
+}
+
+uint16_t formula_compile_context::compile_assign(formula_node const &node, formula_node const &lhs, formula_node const &rhs)
+{
+    ttlet a = rhs.compile(*this);
+    emit(node, formula_opcode::assign, a, a, 0, add_node(lhs));
+    return a;
+}
+
+uint16_t formula_compile_context::compile_logical(bool is_and, formula_node const &node, formula_node const &lhs, formula_node const &rhs)
+{
+    ttlet a = lhs.compile(*this);
+
+    if (are_constants(a, 1)) {
+        if (static_cast<bool>(constant(a)) == is_and) {
+            // The result is the right hand side.
+            code._code.pop_back();
+            code._sources.pop_back();
+            release(a);
+            return rhs.compile(*this);
+        } else {
+            return a;
+        }
+    }
+
+    ttlet jump = emit(node, is_and ? formula_opcode::jump_if_false : formula_opcode::jump_if_true, 0, a);
+
+    // The right hand side replaces the value of the left hand side in the same register.
+    release(a);
+    [[maybe_unused]] ttlet b = rhs.compile(*this);
+    tt_axiom(a == b);
+
+    patch_jump(jump, label());
+    return a;
+}
+
+uint16_t formula_compile_context::compile_ternary(
+    formula_node const &node,
+    formula_node const &condition,
+    formula_node const &rhs_true,
+    formula_node const &rhs_false)
+{
+    ttlet c = condition.compile(*this);
+
+    if (are_constants(c, 1)) {
+        ttlet value = static_cast<bool>(constant(c));
+        code._code.pop_back();
+        code._sources.pop_back();
+        release(c);
+        return value ? rhs_true.compile(*this) : rhs_false.compile(*this);
+    }
+
+    ttlet jump_false = emit(node, formula_opcode::jump_if_false, 0, c);
+
+    // Both branches leave their result in the register of the condition.
+    release(c);
+    [[maybe_unused]] ttlet t = rhs_true.compile(*this);
+    tt_axiom(t == c);
+    ttlet jump_end = emit(node, formula_opcode::jump, 0);
+
+    patch_jump(jump_false, label());
+    release(c);
+    [[maybe_unused]] ttlet f = rhs_false.compile(*this);
+    tt_axiom(f == c);
+
+    patch_jump(jump_end, label());
+    return c;
+}
+
+uint16_t formula_compile_context::compile_call(formula_node const &node, formula_node const &lhs, std::vector<std::unique_ptr<formula_node>> const &args)
+{
+    ttlet first = allocate();
+    release(first);
+
+    for (ttlet &arg : args) {
+        [[maybe_unused]] ttlet r = arg->compile(*this);
+    }
+    if (args.empty()) {
+        [[maybe_unused]] ttlet r = allocate();
+    }
+
+    emit(node, formula_opcode::call, first, first, narrow_cast<uint16_t>(args.size()), add_node(lhs));
+    release(first + 1);
+    return first;
+}
+
+uint16_t formula_compile_context::compile_vector(formula_node const &node, std::vector<std::unique_ptr<formula_node>> const &values)
+{
+    ttlet first = allocate();
+    release(first);
+
+    for (ttlet &value : values) {
+        [[maybe_unused]] ttlet r = value->compile(*this);
+    }
+
+    ttlet n = std::ssize(values);
+    if (are_constants(first, n)) {
+        auto tmp = datum::vector{};
+        for (ssize_t i = 0; i != n; ++i) {
+            tmp.push_back(constant(narrow_cast<uint16_t>(first + i)));
+        }
+        return fold(node, first, n, datum{std::move(tmp)});
+    }
+
+    emit(node, formula_opcode::make_vector, first, first, narrow_cast<uint16_t>(n));
+    release(first + 1);
+    return first;
+}
+
+uint16_t formula_compile_context::compile_map(
+    formula_node const &node,
+    std::vector<std::unique_ptr<formula_node>> const &keys,
+    std::vector<std::unique_ptr<formula_node>> const &values)
+{
+    tt_axiom(keys.size() == values.size());
+
+    ttlet first = allocate();
+    release(first);
+
+    for (size_t i = 0; i != keys.size(); ++i) {
+        [[maybe_unused]] ttlet k = keys[i]->compile(*this);
+        [[maybe_unused]] ttlet v = values[i]->compile(*this);
+    }
+
+    ttlet n = std::ssize(keys);
+    if (are_constants(first, n * 2)) {
+        auto tmp = datum::map{};
+        for (ssize_t i = 0; i != n; ++i) {
+            tmp[constant(narrow_cast<uint16_t>(first + 2 * i))] = constant(narrow_cast<uint16_t>(first + 2 * i + 1));
+        }
+        return fold(node, first, n * 2, datum{std::move(tmp)});
+    }
+
+    emit(node, formula_opcode::make_map, first, first, narrow_cast<uint16_t>(n));
+    release(first + 1);
+    return first;
+}
+
+} // namespace tt
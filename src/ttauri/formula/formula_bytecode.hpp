@@ -0,0 +1,162 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "formula_evaluation_context.hpp"
+#include "../required.hpp"
+#include "../datum.hpp"
+#include <vector>
+#include <string>
+#include <cstdint>
+
+namespace tt {
+
+struct formula_node;
+
+enum class formula_opcode : uint8_t {
+    load_constant, ///< dst = constants[index]
+    load_name, ///< dst = context.get(names[index])
+    load_member, ///< dst = regs[a][constants[index]]
+    load_xvalue_member, ///< dst = context.get(names[b])[constants[index]]
+    evaluate, ///< dst = nodes[index]->evaluate(context)
+    call, ///< dst = nodes[index]->call(context, regs[a] ... regs[a + b - 1])
+    assign, ///< dst = nodes[index]->assign(context, regs[a])
+    increment, ///< dst = ++nodes[index]->evaluate_lvalue(context)
+    decrement, ///< dst = --nodes[index]->evaluate_lvalue(context)
+    make_vector, ///< dst = datum::vector{regs[a] ... regs[a + b - 1]}
+    make_map, ///< dst = datum::map{{regs[a], regs[a + 1]} ... {regs[a + 2b - 2], regs[a + 2b - 1]}}
+    jump, ///< goto index
+    jump_if_true, ///< if (regs[a]) goto index
+    jump_if_false, ///< if (!regs[a]) goto index
+
+    // Unary operators: dst = op regs[a]
+    minus,
+    plus,
+    invert,
+    logical_not,
+
+    // Binary operators: dst = regs[a] op regs[b]
+    add,
+    sub,
+    mul,
+    div,
+    mod,
+    pow,
+    shl,
+    shr,
+    bit_and,
+    bit_or,
+    bit_xor,
+    eq,
+    ne,
+    lt,
+    gt,
+    le,
+    ge,
+    index,
+
+    // Inplace operators: dst = (nodes[index]->evaluate_lvalue(context) op= regs[a])
+    inplace_add,
+    inplace_sub,
+    inplace_mul,
+    inplace_div,
+    inplace_mod,
+    inplace_shl,
+    inplace_shr,
+    inplace_and,
+    inplace_or,
+    inplace_xor,
+};
+
+/** A formula compiled into register bytecode.
+ *
+ * The formula tree is lowered once, after `post_process()`, into a flat list of
+ * instructions that operate on a window of registers in the evaluation context.
+ * Evaluating the bytecode is a single dispatch loop, instead of a virtual call and a
+ * returned datum for each node of the tree. Operators on literals are folded into
+ * constants during compilation.
+ *
+ * Nodes that do not have a bytecode equivalent are evaluated as a tree from a single
+ * instruction; the bytecode refers to these nodes, so it must not outlive the formula.
+ */
+class formula_bytecode {
+public:
+    struct instruction_type {
+        formula_opcode op;
+        uint16_t dst;
+        uint16_t a;
+        uint16_t b;
+        uint32_t index;
+    };
+
+    formula_bytecode() noexcept = default;
+    formula_bytecode(formula_bytecode const &) = default;
+    formula_bytecode(formula_bytecode &&) noexcept = default;
+    formula_bytecode &operator=(formula_bytecode const &) = default;
+    formula_bytecode &operator=(formula_bytecode &&) noexcept = default;
+
+    /** Compile a formula.
+     * The formula must be post-processed.
+     */
+    explicit formula_bytecode(formula_node const &root);
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _code.empty();
+    }
+
+    [[nodiscard]] ssize_t size() const noexcept
+    {
+        return std::ssize(_code);
+    }
+
+    [[nodiscard]] ssize_t nr_registers() const noexcept
+    {
+        return _nr_registers;
+    }
+
+    [[nodiscard]] instruction_type const &operator[](ssize_t i) const noexcept
+    {
+        tt_axiom(i >= 0 && i < size());
+        return _code[i];
+    }
+
+    /** Evaluate the compiled formula.
+     */
+    [[nodiscard]] datum evaluate(formula_evaluation_context &context) const;
+
+    [[nodiscard]] datum evaluate_without_output(formula_evaluation_context &context) const
+    {
+        context.disable_output();
+        auto r = evaluate(context);
+        context.enable_output();
+        return r;
+    }
+
+    /** Execute a unary or binary operator.
+     * This is used by the dispatch loop and for constant folding.
+     */
+    [[nodiscard]] static datum execute(formula_opcode op, datum &&lhs, datum const &rhs);
+
+    [[nodiscard]] static char const *operator_name(formula_opcode op) noexcept;
+
+private:
+    std::vector<instruction_type> _code;
+
+    /** For each instruction, the node it was compiled from; used for the location in error messages.
+     */
+    std::vector<formula_node const *> _sources;
+
+    std::vector<datum> _constants;
+    std::vector<std::string> _names;
+    std::vector<formula_node const *> _nodes;
+    ssize_t _nr_registers = 0;
+
+    void run(formula_evaluation_context &context, size_t base) const;
+
+    friend struct formula_compile_context;
+};
+
+} // namespace tt
@@ -5,6 +5,8 @@
 #pragma once
 
 #include "formula_node.hpp"
+#include "formula_name_node.hpp"
+#include <algorithm>
 
 namespace tt {
 
@@ -12,6 +14,10 @@ struct formula_call_node final : formula_node {
     std::unique_ptr<formula_node> lhs;
     formula_vector args;
 
+    /** The function being called is a pure function; set during post-processing.
+     */
+    bool is_pure = false;
+
     formula_call_node(
         parse_location location,
         std::unique_ptr<formula_node> lhs,
@@ -27,10 +33,20 @@ struct formula_call_node final : formula_node {
     void post_process(formula_post_process_context& context) override {
         lhs->resolve_function_pointer(context);
         for (auto &arg: args) {
-            arg->post_process(context);
+            context.post_process(arg);
+        }
+
+        if (ttlet lhs_name = dynamic_cast<formula_name_node const *>(lhs.get())) {
+            is_pure = context.is_pure_function(lhs_name->name);
         }
     }
 
+    bool is_constant() const override {
+        return is_pure && std::all_of(args.cbegin(), args.cend(), [](ttlet &arg) {
+            return arg->is_constant();
+        });
+    }
+
     datum evaluate(formula_evaluation_context& context) const override {
         ttlet args_ = transform<datum::vector>(args, [&](ttlet& x) {
             return x->evaluate(context);
@@ -59,6 +75,10 @@ struct formula_call_node final : formula_node {
         return r;
     }
 
+    uint16_t compile(formula_compile_context& context) const override {
+        return context.compile_call(*this, *lhs, args);
+    }
+
     std::string string() const noexcept override {
         auto s = fmt::format("({}(", *lhs);
         int i = 0;
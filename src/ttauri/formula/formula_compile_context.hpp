@@ -0,0 +1,88 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "formula_bytecode.hpp"
+#include "../required.hpp"
+#include "../datum.hpp"
+#include <string>
+
+namespace tt {
+
+struct formula_node;
+
+/** State while compiling a formula tree into bytecode.
+ *
+ * Registers are allocated as a stack; compiling a node leaves its result in a newly
+ * allocated register on top of the stack, every other register it used is released.
+ */
+struct formula_compile_context {
+    formula_bytecode code;
+
+    /** The number of registers that are in use.
+     */
+    ssize_t nr_registers = 0;
+
+    /** Instructions before this index may be the target of a jump and may not be folded.
+     */
+    ssize_t fold_barrier = 0;
+
+    [[nodiscard]] uint16_t allocate();
+
+    /** Release a register and every register allocated after it.
+     */
+    void release(uint16_t r) noexcept;
+
+    ssize_t emit(formula_node const &source, formula_opcode op, uint16_t dst, uint16_t a = 0, uint16_t b = 0, uint32_t index = 0);
+
+    /** The index of the next instruction, as the target of a jump.
+     */
+    [[nodiscard]] uint32_t label() noexcept;
+
+    void patch_jump(ssize_t jump, uint32_t target) noexcept;
+
+    [[nodiscard]] uint32_t add_constant(datum value);
+    [[nodiscard]] uint32_t add_name(std::string const &name);
+    [[nodiscard]] uint32_t add_node(formula_node const &node);
+
+    /** Check if the last `n` instructions load constants into the `n` registers starting at `first`.
+     */
+    [[nodiscard]] bool are_constants(uint16_t first, ssize_t n) const noexcept;
+
+    /** Get the value of a register that was loaded with a constant by the last instructions.
+     */
+    [[nodiscard]] datum const &constant(uint16_t r) const noexcept;
+
+    /** Replace the instructions that loaded `n` registers starting at `first`, with loading a single constant.
+     */
+    uint16_t fold(formula_node const &source, uint16_t first, ssize_t n, datum value);
+
+    /** Compile a node that is evaluated as a tree by the bytecode.
+     */
+    uint16_t compile_evaluate(formula_node const &node);
+
+    uint16_t compile_constant(formula_node const &node, datum const &value);
+    uint16_t compile_name(formula_node const &node, std::string const &name);
+    uint16_t compile_member(formula_node const &node, formula_node const &lhs, std::string const &name);
+    uint16_t compile_unary(formula_opcode op, formula_node const &node, formula_node const &rhs);
+    uint16_t compile_binary(formula_opcode op, formula_node const &node, formula_node const &lhs, formula_node const &rhs);
+    uint16_t compile_inplace(formula_opcode op, formula_node const &node, formula_node const &lhs, formula_node const &rhs);
+    uint16_t compile_lvalue(formula_opcode op, formula_node const &node, formula_node const &rhs);
+    uint16_t compile_assign(formula_node const &node, formula_node const &lhs, formula_node const &rhs);
+    uint16_t compile_logical(bool is_and, formula_node const &node, formula_node const &lhs, formula_node const &rhs);
+    uint16_t compile_ternary(
+        formula_node const &node,
+        formula_node const &condition,
+        formula_node const &rhs_true,
+        formula_node const &rhs_false);
+    uint16_t compile_call(formula_node const &node, formula_node const &lhs, std::vector<std::unique_ptr<formula_node>> const &args);
+    uint16_t compile_vector(formula_node const &node, std::vector<std::unique_ptr<formula_node>> const &values);
+    uint16_t compile_map(
+        formula_node const &node,
+        std::vector<std::unique_ptr<formula_node>> const &keys,
+        std::vector<std::unique_ptr<formula_node>> const &values);
+};
+
+} // namespace tt
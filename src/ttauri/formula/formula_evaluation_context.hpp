@@ -10,16 +10,100 @@
 #include <unordered_map>
 #include <vector>
 #include <string_view>
+#include <string>
+#include <functional>
+#include <algorithm>
+#include <iterator>
+#include <utility>
 
 namespace tt {
 
 struct formula_evaluation_context {
-    using scope = std::unordered_map<std::string, datum>;
+    /** The local variables of a function call.
+     *
+     * The names of a function which are resolved during post-processing each have a slot
+     * in a flat vector, other names are kept in a map. A slot that holds an undefined
+     * datum is a local variable that has not been assigned yet.
+     */
+    struct scope {
+        /** The names of the slots, owned by the function; or nullptr when the scope has no slots.
+         */
+        std::vector<std::string> const *slot_names = nullptr;
+        std::vector<datum> slots;
+        std::unordered_map<std::string, datum> variables;
+
+        scope() noexcept = default;
+
+        explicit scope(std::vector<std::string> const *slot_names) :
+            slot_names(slot_names), slots(slot_names != nullptr ? slot_names->size() : 0) {}
+
+        [[nodiscard]] ssize_t find_slot(std::string const &name) const noexcept {
+            if (slot_names != nullptr) {
+                ttlet i = std::find(slot_names->cbegin(), slot_names->cend(), name);
+                if (i != slot_names->cend()) {
+                    return std::distance(slot_names->cbegin(), i);
+                }
+            }
+            return -1;
+        }
+
+        /** Find an assigned local variable.
+         * @return A pointer to the variable, or nullptr when the variable was not assigned.
+         */
+        [[nodiscard]] datum const *find(std::string const &name) const noexcept {
+            if (ttlet slot = find_slot(name); slot >= 0) {
+                return slots[slot].is_undefined() ? nullptr : &slots[slot];
+            }
+            ttlet i = variables.find(name);
+            return i != variables.end() ? &i->second : nullptr;
+        }
+
+        [[nodiscard]] datum *find(std::string const &name) noexcept {
+            return const_cast<datum *>(std::as_const(*this).find(name));
+        }
+
+        /** Get a local variable, creating it when needed.
+         */
+        [[nodiscard]] datum &operator[](std::string const &name) {
+            if (ttlet slot = find_slot(name); slot >= 0) {
+                return slots[slot];
+            }
+            return variables[name];
+        }
+    };
     using stack = std::vector<scope>;
 
+    /** Recycle the vectors and maps of temporaries created during evaluation.
+     * Declared first, so that it is destroyed after the scopes below.
+     */
+    datum::arena arena;
+
+    using output_sink_type = std::function<void(std::string_view)>;
+
     ssize_t output_disable_count = 0;
+
+    /** The output that was not yet passed to the output sink.
+     */
     std::string output;
 
+    /** When set, the output is passed in chunks to the sink during evaluation.
+     * For example to write into a file or a network buffer, instead of keeping
+     * all the output in memory.
+     */
+    output_sink_type output_sink;
+
+    /** The output is passed to the output sink when it has grown to this size.
+     */
+    ssize_t output_chunk_size = 65536;
+
+    /** While output is held, it may still be reset by `set_output_size()` and is not passed to the output sink.
+     */
+    ssize_t output_hold_count = 0;
+
+    /** The number of bytes that have been passed to the output sink.
+     */
+    ssize_t output_flushed_size = 0;
+
     stack local_stack;
 
     struct loop_info {
@@ -42,32 +126,65 @@ struct formula_evaluation_context {
         }
     };
     std::vector<loop_info> loop_stack;
-    scope globals;
+    std::unordered_map<std::string, datum> globals;
+
+    /** The registers used by formula_bytecode.
+     */
+    std::vector<datum> registers;
 
     formula_evaluation_context() {};
 
     /** Write data to the output.
+    * @throw Any exception thrown by the output sink.
     */
-    void write(std::string_view text) noexcept {
+    void write(std::string_view text) {
         if (output_disable_count == 0) {
             output += text;
+            if (std::ssize(output) >= output_chunk_size) {
+                flush_output();
+            }
+        }
+    }
+
+    /** Pass the output to the output sink.
+    * Nothing is passed while the output is held, or when there is no output sink.
+    * @throw Any exception thrown by the output sink.
+    */
+    void flush_output() {
+        if (output_sink && output_hold_count == 0 && !output.empty()) {
+            output_sink(output);
+            output_flushed_size += std::ssize(output);
+            output.clear();
         }
     }
 
-    /** Get the size of the output.
+    /** Get the size of the output, including the output passed to the output sink.
     * Used if you need to reset the output to a previous position.
     */
     ssize_t output_size() const noexcept {
-        return std::ssize(output);
+        return output_flushed_size + std::ssize(output);
     }
 
     /** Set the size of the output.
     * Used if you need to reset the output to a previous position.
+    * Output that was already passed to the output sink can not be reset, hold
+    * the output when it may need to be reset.
     */
     void set_output_size(ssize_t new_size) noexcept {
-        tt_assert(new_size > 0);
+        tt_assert(new_size >= 0);
         tt_assert(new_size <= output_size());
-        output.resize(new_size);
+        output.resize(std::max(new_size - output_flushed_size, ssize_t{0}));
+    }
+
+    /** Hold the output, so that it can be reset to a previous position.
+    */
+    void hold_output() noexcept {
+        output_hold_count++;
+    }
+
+    void release_output() noexcept {
+        tt_assert(output_hold_count > 0);
+        output_hold_count--;
     }
 
     void enable_output() noexcept {
@@ -88,8 +205,12 @@ struct formula_evaluation_context {
         loop_stack.pop_back();
     }
 
-    void push() {
-        local_stack.emplace_back();
+    /** Push a scope for the local variables of a function call.
+     *
+     * @param slot_names The names of the local variables resolved to slots during post-processing.
+     */
+    void push(std::vector<std::string> const *slot_names = nullptr) {
+        local_stack.emplace_back(slot_names);
         loop_push();
     }
 
@@ -158,36 +279,55 @@ struct formula_evaluation_context {
         }
 
         if (has_locals()) {
-            ttlet i = locals().find(name);
-            if (i != locals().end()) {
-                return i->second;
+            if (ttlet value = locals().find(name)) {
+                return *value;
             }
         }
 
-        ttlet j = globals.find(name);
-        if (j != globals.end()) {
-            return j->second;
-        }
-
-        throw operation_error("Could not find {} in local or global scope.", name);
+        return get_global(name);
     }
 
     [[nodiscard]] datum &get(std::string const &name) {
         tt_assert(name.size() > 0);
 
         if (has_locals()) {
-            ttlet i = locals().find(name);
-            if (i != locals().end()) {
-                return i->second;
+            if (ttlet value = locals().find(name)) {
+                return *value;
             }
         }
 
-        ttlet j = globals.find(name);
-        if (j != globals.end()) {
-            return j->second;
+        return const_cast<datum &>(get_global(name));
+    }
+
+    /** Get a variable that was resolved to a slot during post-processing.
+     *
+     * @param slot The slot of the variable in the scope of the current function, or -1 when not resolved.
+     * @param name The name of the variable, for when the slot was not assigned.
+     */
+    [[nodiscard]] datum const &get(ssize_t slot, std::string const &name) const {
+        if (slot < 0 || !has_locals()) {
+            return get(name);
         }
 
-        throw operation_error("Could not find {} in local or global scope.", name);
+        ttlet &scope = locals();
+        tt_axiom(scope.slot_names != nullptr && slot < std::ssize(scope.slots) && (*scope.slot_names)[slot] == name);
+        if (ttlet &value = scope.slots[slot]; !value.is_undefined()) {
+            return value;
+        }
+
+        ttlet i = scope.variables.find(name);
+        if (i != scope.variables.end()) {
+            return i->second;
+        }
+
+        return get_global(name);
+    }
+
+    [[nodiscard]] datum &get(ssize_t slot, std::string const &name) {
+        if (slot < 0 || !has_locals()) {
+            return get(name);
+        }
+        return const_cast<datum &>(std::as_const(*this).get(slot, name));
     }
 
     template<typename T>
@@ -207,6 +347,29 @@ struct formula_evaluation_context {
             return globals[name] = value;
         }
     }
+
+    /** Set a variable that was resolved to a slot during post-processing.
+     * @see get(ssize_t, std::string const &)
+     */
+    datum &set(ssize_t slot, std::string const &name, datum const &value) {
+        if (slot < 0 || !has_locals()) {
+            return set(name, value);
+        }
+
+        auto &scope = locals();
+        tt_axiom(scope.slot_names != nullptr && slot < std::ssize(scope.slots) && (*scope.slot_names)[slot] == name);
+        return scope.slots[slot] = value;
+    }
+
+private:
+    [[nodiscard]] datum const &get_global(std::string const &name) const {
+        ttlet i = globals.find(name);
+        if (i != globals.end()) {
+            return i->second;
+        }
+
+        throw operation_error("Could not find {} in local or global scope.", name);
+    }
 };
 
 }
\ No newline at end of file
@@ -16,6 +16,10 @@ struct formula_gt_node final : formula_binary_operator_node {
         return lhs->evaluate(context) > rhs->evaluate(context);
     }
 
+    uint16_t compile(formula_compile_context& context) const override {
+        return context.compile_binary(formula_opcode::gt, *this, *lhs, *rhs);
+    }
+
     std::string string() const noexcept override {
         return fmt::format("({} > {})", *lhs, *rhs);
     }
@@ -13,9 +13,20 @@ struct formula_index_node final : formula_binary_operator_node {
         formula_binary_operator_node(std::move(location), std::move(lhs), std::move(rhs)) {}
 
     datum evaluate(formula_evaluation_context& context) const override {
-        auto lhs_ = lhs->evaluate(context);
-        auto rhs_ = rhs->evaluate(context);
+        if (lhs->has_evaluate_xvalue() && (rhs->is_constant() || rhs->has_evaluate_xvalue())) {
+            // The index has no side effects, so the container can be indexed without being copied.
+            ttlet rhs_ = rhs->evaluate(context);
+            ttlet &lhs_ = lhs->evaluate_xvalue(context);
+            return evaluate_index(lhs_, rhs_);
+
+        } else {
+            ttlet lhs_ = lhs->evaluate(context);
+            ttlet rhs_ = rhs->evaluate(context);
+            return evaluate_index(lhs_, rhs_);
+        }
+    }
 
+    datum evaluate_index(datum const &lhs_, datum const &rhs_) const {
         if (!lhs_.contains(rhs_)) {
             throw operation_error("{}: Unknown key '{}'.", location, rhs_);
         }
@@ -37,6 +48,10 @@ struct formula_index_node final : formula_binary_operator_node {
         }
     }
 
+    uint16_t compile(formula_compile_context& context) const override {
+        return context.compile_binary(formula_opcode::index, *this, *lhs, *rhs);
+    }
+
     std::string string() const noexcept override {
         return fmt::format("({}[{}])", *lhs, *rhs);
     }
@@ -17,12 +17,16 @@ struct formula_inplace_add_node final : formula_binary_operator_node {
         auto &lhs_ = lhs->evaluate_lvalue(context);
 
         try {
-            return lhs_ += rhs_;
+            return lhs_ += std::move(rhs_);
         } catch (std::exception const &e) {
             throw operation_error("{}: Can not evaluate inplace-add.\n{}", location, e.what());
         }
     }
 
+    uint16_t compile(formula_compile_context& context) const override {
+        return context.compile_inplace(formula_opcode::inplace_add, *this, *lhs, *rhs);
+    }
+
     std::string string() const noexcept override {
         return fmt::format("({} += {})", *lhs, *rhs);
     }
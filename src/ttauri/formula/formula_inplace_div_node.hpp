@@ -23,6 +23,10 @@ struct formula_inplace_div_node final : formula_binary_operator_node {
         }
     }
 
+    uint16_t compile(formula_compile_context& context) const override {
+        return context.compile_inplace(formula_opcode::inplace_div, *this, *lhs, *rhs);
+    }
+
     std::string string() const noexcept override {
         return fmt::format("({} /= {})", *lhs, *rhs);
     }
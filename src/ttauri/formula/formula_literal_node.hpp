@@ -18,6 +18,14 @@ struct formula_literal_node final : formula_node {
         return value;
     }
 
+    bool is_constant() const override {
+        return true;
+    }
+
+    uint16_t compile(formula_compile_context& context) const override {
+        return context.compile_constant(*this, value);
+    }
+
     std::string string() const noexcept override {
         return value.repr();
     }
@@ -21,6 +21,10 @@ struct formula_logical_or_node final : formula_binary_operator_node {
         }
     }
 
+    uint16_t compile(formula_compile_context& context) const override {
+        return context.compile_logical(false, *this, *lhs, *rhs);
+    }
+
     std::string string() const noexcept override {
         return fmt::format("({} || {})", *lhs, *rhs);
     }
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "formula_node.hpp"
+#include <algorithm>
 
 namespace tt {
 
@@ -17,14 +18,21 @@ struct formula_map_literal_node final : formula_node {
 
     void post_process(formula_post_process_context& context) override {
         for (auto &key: keys) {
-            key->post_process(context);
+            context.post_process(key);
         }
 
         for (auto &value: values) {
-            value->post_process(context);
+            context.post_process(value);
         }
     }
 
+    bool is_constant() const override {
+        ttlet is_constant_ = [](ttlet &x) {
+            return x->is_constant();
+        };
+        return std::all_of(keys.cbegin(), keys.cend(), is_constant_) && std::all_of(values.cbegin(), values.cend(), is_constant_);
+    }
+
     datum evaluate(formula_evaluation_context& context) const override {
         tt_assert(keys.size() == values.size());
 
@@ -38,6 +46,10 @@ struct formula_map_literal_node final : formula_node {
         return datum{std::move(r)};
     }
 
+    uint16_t compile(formula_compile_context& context) const override {
+        return context.compile_map(*this, keys, values);
+    }
+
     std::string string() const noexcept override {
         tt_assert(keys.size() == values.size());
 
@@ -28,6 +28,10 @@ struct formula_member_node final : formula_binary_operator_node {
         }
     }
 
+    bool is_constant() const override {
+        return lhs->is_constant();
+    }
+
     datum evaluate(formula_evaluation_context& context) const override {
         if (lhs->has_evaluate_xvalue()) {
             ttlet &lhs_ = lhs->evaluate_xvalue(context);
@@ -73,6 +77,10 @@ struct formula_member_node final : formula_binary_operator_node {
         }
     }
 
+    uint16_t compile(formula_compile_context& context) const override {
+        return context.compile_member(*this, *lhs, rhs_name->name);
+    }
+
     std::string string() const noexcept override {
         return fmt::format("({} . {})", *lhs, *rhs);
     }
@@ -6,6 +6,7 @@
 
 #include "formula_post_process_context.hpp"
 #include "formula_evaluation_context.hpp"
+#include "formula_compile_context.hpp"
 #include "../required.hpp"
 #include "../parse_location.hpp"
 #include "../datum.hpp"
@@ -35,6 +36,21 @@ struct formula_node {
     */
     virtual void resolve_function_pointer(formula_post_process_context& context) {}
 
+    /** Check if the node always evaluates to the same value, without side effects.
+    * After post-processing a constant node is replaced by a literal.
+    */
+    virtual bool is_constant() const {
+        return false;
+    }
+
+    /** Compile this node into bytecode.
+    * The default implementation compiles an instruction that evaluates the node as a tree.
+    * @return The register with the result, which is the last allocated register.
+    */
+    virtual uint16_t compile(formula_compile_context& context) const {
+        return context.compile_evaluate(*this);
+    }
+
     /** Evaluate an rvalue.
     */
     virtual datum evaluate(formula_evaluation_context& context) const = 0;
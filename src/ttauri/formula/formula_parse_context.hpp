@@ -12,29 +12,28 @@
 namespace tt {
 
 struct formula_parse_context {
-    using const_iterator = typename std::vector<token_t>::const_iterator;
-
     std::string_view::const_iterator first;
     std::string_view::const_iterator last;
 
-    std::vector<token_t> tokens;
-    const_iterator token_it;
+    /** Tokens are pulled from the tokenizer while parsing, the parser only looks at the current token.
+     */
+    tokenizer tokens;
+    token_t token;
 
     formula_parse_context(std::string_view::const_iterator first, std::string_view::const_iterator last) :
-        first(first), last(last), tokens(parseTokens(first, last)), token_it(tokens.begin()) {}
+        first(first), last(last), tokens(first, last), token(tokens.next()) {}
 
     [[nodiscard]] token_t const& operator*() const noexcept {
-        return *token_it;
+        return token;
     }
 
     [[nodiscard]] token_t const *operator->() const noexcept {
-        return &(*token_it);
+        return &token;
     }
 
     formula_parse_context& operator++() noexcept {
-        tt_axiom(token_it != tokens.end());
-        tt_axiom(*token_it != tokenizer_name_t::End);
-        ++token_it;
+        tt_axiom(token != tokenizer_name_t::End);
+        tokens.next(token);
         return *this;
     }
 
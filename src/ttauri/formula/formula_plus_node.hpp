@@ -21,6 +21,10 @@ struct formula_plus_node final : formula_unary_operator_node {
         }
     }
 
+    uint16_t compile(formula_compile_context& context) const override {
+        return context.compile_unary(formula_opcode::plus, *this, *rhs);
+    }
+
     std::string string() const noexcept override {
         return fmt::format("(+ {})", *rhs);
     }
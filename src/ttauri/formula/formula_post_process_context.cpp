@@ -3,10 +3,30 @@
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #include "formula_post_process_context.hpp"
+#include "formula_node.hpp"
+#include "formula_literal_node.hpp"
 #include "../url_parser.hpp"
 
 namespace tt {
 
+void formula_post_process_context::post_process(std::unique_ptr<formula_node> &node)
+{
+    node->post_process(*this);
+
+    if (!fold_constants || !node->is_constant() || dynamic_cast<formula_literal_node const *>(node.get()) != nullptr) {
+        return;
+    }
+
+    try {
+        auto evaluation_context = formula_evaluation_context{};
+        auto value = node->evaluate(evaluation_context);
+        node = std::make_unique<formula_literal_node>(node->location, value);
+
+    } catch (std::exception const &) {
+        // Evaluate the node as a tree, which will throw with the location of the error.
+    }
+}
+
 static datum function_float(formula_evaluation_context &context, datum::vector const &args)
 {
     if (args.size() != 1) {
@@ -145,6 +165,32 @@ static datum function_sort(formula_evaluation_context &context, datum::vector co
 }
 
 
+static datum function_sum(formula_evaluation_context &context, datum::vector const &args)
+{
+    if (args.size() != 1) {
+        throw operation_error("Expecting 1 argument for sum() function, got {}", args.size());
+    }
+
+    return sum(args[0]);
+}
+
+static datum function_min(formula_evaluation_context &context, datum::vector const &args)
+{
+    if (args.size() != 1) {
+        throw operation_error("Expecting 1 argument for min() function, got {}", args.size());
+    }
+
+    return min_or_max(args[0], false);
+}
+
+static datum function_max(formula_evaluation_context &context, datum::vector const &args)
+{
+    if (args.size() != 1) {
+        throw operation_error("Expecting 1 argument for max() function, got {}", args.size());
+    }
+
+    return min_or_max(args[0], true);
+}
 
 static datum method_contains(formula_evaluation_context &context, datum &self, datum::vector const &args)
 {
@@ -238,8 +284,28 @@ formula_post_process_context::function_table formula_post_process_context::globa
     {"keys"s, function_keys},
     {"values"s, function_values},
     {"items"s, function_items},
-    {"sort"s, function_sort}
+    {"sort"s, function_sort},
+    {"sum"s, function_sum},
+    {"min"s, function_min},
+    {"max"s, function_max}
+};
+std::unordered_set<std::string> formula_post_process_context::pure_global_functions = {
+    "float"s,
+    "integer"s,
+    "decimal"s,
+    "string"s,
+    "boolean"s,
+    "url"s,
+    "size"s,
+    "keys"s,
+    "values"s,
+    "items"s,
+    "sort"s,
+    "sum"s,
+    "min"s,
+    "max"s
 };
+
 formula_post_process_context::method_table formula_post_process_context::global_methods = {
     {"append"s, method_append},
     {"contains"s, method_contains},
@@ -10,12 +10,18 @@
 #include "../strings.hpp"
 #include <functional>
 #include <unordered_map>
+#include <unordered_set>
+#include <memory>
 #include <vector>
 #include <string>
 #include <string_view>
+#include <algorithm>
+#include <iterator>
 
 namespace tt {
 
+struct formula_node;
+
 struct formula_post_process_context {
     using filter_type = std::function<std::string(std::string_view)>;
     using filter_table = std::unordered_map<std::string,filter_type>;
@@ -26,8 +32,23 @@ struct formula_post_process_context {
     using method_table = std::unordered_map<std::string,method_type>;
 
     function_table functions;
+
+    /** Replace constant sub-formulas by literals during post-processing.
+     */
+    bool fold_constants = false;
+
     function_stack super_stack;
+
+    /** The names of the local variables of each function being post-processed.
+     * The index of a name is the slot of the variable in the scope of a call to the function.
+     */
+    std::vector<std::vector<std::string> *> scope_stack;
+
     static function_table global_functions;
+
+    /** Names of global functions that return the same value for the same arguments, without side effects.
+     */
+    static std::unordered_set<std::string> pure_global_functions;
     static method_table global_methods;
     static filter_table global_filters;
 
@@ -53,6 +74,12 @@ struct formula_post_process_context {
         return {};
     }
 
+    /** Check if a call to a function can be folded when its arguments are constant.
+     */
+    [[nodiscard]] bool is_pure_function(std::string const &name) const noexcept {
+        return name != "super" && !functions.contains(name) && pure_global_functions.contains(name);
+    }
+
     [[nodiscard]] function_type set_function(std::string const &name, function_type func) noexcept {
         using namespace std;
 
@@ -60,6 +87,39 @@ struct formula_post_process_context {
         return func;
     }
 
+    /** Start resolving the names inside a function to slots.
+     * @param slot_names The names of the local variables of the function, names are added while resolving.
+     */
+    void push_scope(std::vector<std::string> &slot_names) noexcept {
+        scope_stack.push_back(&slot_names);
+    }
+
+    void pop_scope() noexcept {
+        tt_axiom(!scope_stack.empty());
+        scope_stack.pop_back();
+    }
+
+    /** Resolve a name to a slot in the scope of the current function.
+     * A name only used for reading also gets a slot, when the slot is not assigned
+     * during evaluation the name is looked up in the global scope.
+     *
+     * @return The slot of the variable, or -1 when outside of a function or for a loop variable.
+     */
+    [[nodiscard]] ssize_t get_slot(std::string const &name) {
+        if (scope_stack.empty() || name.empty() || name[0] == '$') {
+            return -1;
+        }
+
+        auto &slot_names = *scope_stack.back();
+        ttlet i = std::find(slot_names.cbegin(), slot_names.cend(), name);
+        if (i != slot_names.cend()) {
+            return std::distance(slot_names.cbegin(), i);
+        }
+
+        slot_names.push_back(name);
+        return std::ssize(slot_names) - 1;
+    }
+
     void push_super(function_type func) noexcept {
         super_stack.push_back(func);
     }
@@ -68,6 +128,14 @@ struct formula_post_process_context {
         super_stack.pop_back();
     }
 
+    /** Post-process a formula node.
+     * When folding constants and the node is constant after post-processing, it is evaluated
+     * and replaced by a literal.
+     * A constant node that fails to evaluate is kept, so that the error is reported when the
+     * formula is evaluated.
+     */
+    void post_process(std::unique_ptr<formula_node> &node);
+
     [[nodiscard]] filter_type get_filter(std::string const &name) const noexcept {
         ttlet i = global_filters.find(name);
         if (i != global_filters.end()) {
@@ -26,9 +26,13 @@ struct formula_ternary_operator_node final : formula_node {
     }
 
     void post_process(formula_post_process_context& context) override {
-        lhs->post_process(context);
-        rhs_true->post_process(context);
-        rhs_false->post_process(context);
+        context.post_process(lhs);
+        context.post_process(rhs_true);
+        context.post_process(rhs_false);
+    }
+
+    bool is_constant() const override {
+        return lhs->is_constant() && rhs_true->is_constant() && rhs_false->is_constant();
     }
 
     datum evaluate(formula_evaluation_context& context) const override {
@@ -40,6 +44,10 @@ struct formula_ternary_operator_node final : formula_node {
         }
     }
 
+    uint16_t compile(formula_compile_context& context) const override {
+        return context.compile_ternary(*this, *lhs, *rhs_true, *rhs_false);
+    }
+
     std::string string() const noexcept override {
         return fmt::format("({} ? {} : {})", *lhs, *rhs_true, *rhs_false);
     }
@@ -3,9 +3,11 @@
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #include "formula.hpp"
+#include "formula_bytecode.hpp"
 #include <gtest/gtest.h>
 #include <iostream>
 #include <string>
+#include <chrono>
 
 using namespace std;
 using namespace std::literals;
@@ -462,3 +464,141 @@ TEST(Formula, Map) {
     ASSERT_NO_THROW(e = parse_formula("{1: 1.1, 2: 2.2, }"));
     ASSERT_EQ(e->string(), "{1: 1.1, 2: 2.2}");
 }
+
+static std::unique_ptr<formula_node> parse_and_fold_formula(std::string_view text) {
+    auto parse_context = formula_parse_context(text.cbegin(), text.cend());
+    auto e = parse_formula(parse_context);
+
+    auto post_process_context = formula_post_process_context();
+    post_process_context.fold_constants = true;
+    post_process_context.post_process(e);
+    return e;
+}
+
+TEST(Formula, FoldConstants) {
+    std::unique_ptr<formula_node> e;
+    formula_evaluation_context context;
+    context.set_global("foo", datum::vector{1, 2, 3});
+    context.set_global("bar", 2);
+
+    ASSERT_NO_THROW(e = parse_and_fold_formula("4 - 2 - 1"));
+    ASSERT_EQ(e->string(), "1");
+
+    ASSERT_NO_THROW(e = parse_and_fold_formula("bar * (2 + 3) - 1"));
+    ASSERT_EQ(e->string(), "((bar * 5) - 1)");
+    ASSERT_EQ(e->evaluate(context), 9);
+
+    ASSERT_NO_THROW(e = parse_and_fold_formula("[1, 2 + 3, {\"a\": -1}]"));
+    ASSERT_EQ(e->string(), "[1, 5, {\"a\": -1}]");
+
+    ASSERT_NO_THROW(e = parse_and_fold_formula("{\"a\": [1, 2]}.a[bar - 1]"));
+    ASSERT_EQ(e->string(), "([1, 2][(bar - 1)])");
+    ASSERT_EQ(e->evaluate(context), 2);
+
+    ASSERT_NO_THROW(e = parse_and_fold_formula("float(2) + size(\"abc\")"));
+    ASSERT_EQ(e->string(), "5.0");
+
+    // Calls to functions with side effects, names and methods are not folded.
+    ASSERT_NO_THROW(e = parse_and_fold_formula("foo.append(1 + 1)"));
+    ASSERT_EQ(e->string(), "((foo . append)(2))");
+
+    ASSERT_NO_THROW(e = parse_and_fold_formula("foo[1] + 1"));
+    ASSERT_EQ(e->string(), "((foo[1]) + 1)");
+    ASSERT_EQ(e->evaluate(context), 3);
+
+    // Constant formulas that fail are kept, so that the error is thrown during evaluation.
+    ASSERT_NO_THROW(e = parse_and_fold_formula("1 + [2]"));
+    ASSERT_EQ(e->string(), "(1 + [2])");
+    ASSERT_THROW(e->evaluate(context), operation_error);
+}
+
+TEST(Formula, Bytecode) {
+    auto formulas = std::vector<std::string>{
+        "4 - 2 - 1",
+        "1 + 2 * 3",
+        "-(5 % 3) + ~1",
+        "x * 2 + y",
+        "x < y ? x : y",
+        "x > y ? x : y",
+        "x && y",
+        "0 && y",
+        "x || y",
+        "false || y",
+        "!x",
+        "s + \" world\"",
+        "[x, y, 3]",
+        "{\"a\": x, \"b\": 2}",
+        "v[1] + v[-1]",
+        "m.a + m.b",
+        "[1, 2][0]",
+        "float(x) / 4",
+        "z = x + y",
+        "x += 3",
+        "++y",
+        "v.append(x)"
+    };
+
+    for (ttlet &formula : formulas) {
+        auto tree_context = formula_evaluation_context{};
+        auto bytecode_context = formula_evaluation_context{};
+        for (auto context : {&tree_context, &bytecode_context}) {
+            context->set_global("x", 5);
+            context->set_global("y", 7);
+            context->set_global("s", "hello");
+            context->set_global("v", datum::vector{1, 2, 3});
+            context->set_global("m", datum::map{{"a", 1}, {"b", 2}});
+        }
+
+        ttlet e = parse_formula(formula);
+        ttlet bytecode = formula_bytecode{*e};
+
+        ASSERT_EQ(bytecode.evaluate(bytecode_context), e->evaluate(tree_context)) << formula;
+        ASSERT_EQ(bytecode_context.globals, tree_context.globals) << formula;
+        ASSERT_TRUE(bytecode_context.registers.empty());
+    }
+}
+
+TEST(Formula, BytecodeConstantFolding) {
+    ttlet e = parse_formula("(1 + 2 * 3 > 5) ? [\"a\", 4 ** 2] : [1]");
+    ttlet bytecode = formula_bytecode{*e};
+    ASSERT_EQ(bytecode.size(), 1);
+    ASSERT_EQ(bytecode[0].op, formula_opcode::load_constant);
+
+    auto context = formula_evaluation_context{};
+    ttlet expected = datum{datum::vector{"a", 16}};
+    ASSERT_EQ(bytecode.evaluate(context), expected);
+
+    // Errors during folding are reported during evaluation.
+    ttlet f = parse_formula("1 + [2]");
+    ttlet f_bytecode = formula_bytecode{*f};
+    ASSERT_THROW((void)f_bytecode.evaluate(context), operation_error);
+    ASSERT_TRUE(context.registers.empty());
+}
+
+TEST(Formula, DISABLED_BytecodeBenchmark) {
+    ttlet e = parse_formula("(x * 2 + y) % 7 < 3 ? v[1] + m.a : (x - y) * (x + y) + 1 + 2");
+    ttlet bytecode = formula_bytecode{*e};
+
+    auto context = formula_evaluation_context{};
+    context.set_global("v", datum::vector{1, 2, 3});
+    context.set_global("m", datum::map{{"a", 1}, {"b", 2}});
+    context.set_global("y", 7);
+
+    constexpr int count = 1'000'000;
+    auto benchmark = [&](auto &&evaluate) {
+        ttlet start = std::chrono::steady_clock::now();
+        long long sum = 0;
+        for (int i = 0; i != count; ++i) {
+            context.set_global("x", i);
+            sum += static_cast<long long>(evaluate());
+        }
+        ttlet duration = std::chrono::steady_clock::now() - start;
+        std::cout << std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() / count << " ns/evaluate (sum "
+                  << sum << ")\n";
+    };
+
+    std::cout << "tree: ";
+    benchmark([&] { return e->evaluate(context); });
+    std::cout << "bytecode: ";
+    benchmark([&] { return bytecode.evaluate(context); });
+}
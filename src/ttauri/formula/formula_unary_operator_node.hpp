@@ -15,7 +15,11 @@ struct formula_unary_operator_node : formula_node {
         formula_node(std::move(location)), rhs(std::move(rhs)) {}
 
     void post_process(formula_post_process_context& context) override {
-        rhs->post_process(context);
+        context.post_process(rhs);
+    }
+
+    bool is_constant() const override {
+        return rhs->is_constant();
     }
 
     std::string string() const noexcept override {
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "formula_node.hpp"
+#include <algorithm>
 
 namespace tt {
 
@@ -16,10 +17,16 @@ struct formula_vector_literal_node final : formula_node {
 
     void post_process(formula_post_process_context& context) override {
         for (auto &value: values) {
-            value->post_process(context);
+            context.post_process(value);
         }
     }
 
+    bool is_constant() const override {
+        return std::all_of(values.cbegin(), values.cend(), [](ttlet &value) {
+            return value->is_constant();
+        });
+    }
+
     datum evaluate(formula_evaluation_context& context) const override {
         datum::vector r;
         for (ttlet &value: values) {
@@ -55,6 +62,10 @@ struct formula_vector_literal_node final : formula_node {
         }
     }
 
+    uint16_t compile(formula_compile_context& context) const override {
+        return context.compile_vector(*this, values);
+    }
+
     std::string string() const noexcept override {
         std::string r = "[";
         int i = 0;
@@ -0,0 +1,105 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "wfree_message_queue.hpp"
+#include "polymorphic_optional.hpp"
+#include "required.hpp"
+#include <type_traits>
+#include <utility>
+
+namespace tt {
+namespace detail {
+
+class function_fifo_item_base {
+public:
+    function_fifo_item_base() noexcept = default;
+    virtual ~function_fifo_item_base() = default;
+    function_fifo_item_base(function_fifo_item_base const &) = delete;
+    function_fifo_item_base(function_fifo_item_base &&) = delete;
+    function_fifo_item_base &operator=(function_fifo_item_base const &) = delete;
+    function_fifo_item_base &operator=(function_fifo_item_base &&) = delete;
+
+    virtual void operator()() = 0;
+};
+
+template<typename Func>
+class function_fifo_item final : public function_fifo_item_base {
+public:
+    template<typename F>
+    function_fifo_item(F &&func) noexcept : _func(std::forward<F>(func))
+    {
+    }
+
+    void operator()() override
+    {
+        _func();
+    }
+
+private:
+    Func _func;
+};
+
+} // namespace detail
+
+/** A fifo of functions, written by many threads and run by a single thread.
+ *
+ * Functions are constructed in place in the slots of a wait-free message queue,
+ * so move-only functions are allowed and functions that fit in a slot are not allocated.
+ *
+ * @tparam SlotSize The size of the buffer in each slot, larger functions are allocated on the heap.
+ * @tparam Capacity The number of slots.
+ */
+template<size_t SlotSize = 64, size_t Capacity = 1024>
+class function_fifo {
+public:
+    function_fifo() noexcept = default;
+    function_fifo(function_fifo const &) = delete;
+    function_fifo(function_fifo &&) = delete;
+    function_fifo &operator=(function_fifo const &) = delete;
+    function_fifo &operator=(function_fifo &&) = delete;
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _queue.empty();
+    }
+
+    /** Add a function to the fifo.
+     * This is wait-free, except when the fifo is full.
+     *
+     * @param func The function, called without arguments.
+     * @return false when the fifo is full and the function was not added.
+     */
+    template<typename Func>
+    [[nodiscard]] bool try_add(Func &&func) noexcept
+    {
+        if (_queue.full()) {
+            [[unlikely]] return false;
+        }
+
+        auto op = _queue.write();
+        op->template emplace<detail::function_fifo_item<std::decay_t<Func>>>(std::forward<Func>(func));
+        return true;
+    }
+
+    /** Run all functions that are completely written, in the order they were added.
+     * May only be called from a single thread at a time.
+     *
+     * @return The number of functions run.
+     */
+    size_t run_all()
+    {
+        return _queue.read_all([](auto &item) {
+            (*item)();
+            // Release the captured resources now, instead of when the slot is reused.
+            item.reset();
+        });
+    }
+
+private:
+    wfree_message_queue<polymorphic_optional<detail::function_fifo_item_base, SlotSize>, Capacity> _queue;
+};
+
+} // namespace tt
@@ -0,0 +1,100 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/function_fifo.hpp"
+#include <gtest/gtest.h>
+#include <array>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace tt;
+
+TEST(FunctionFifo, RunAll)
+{
+    auto fifo = function_fifo<>{};
+    auto order = std::vector<int>{};
+
+    for (int i = 0; i != 10; ++i) {
+        ASSERT_TRUE(fifo.try_add([i, &order] {
+            order.push_back(i);
+        }));
+    }
+    ASSERT_FALSE(fifo.empty());
+
+    ASSERT_EQ(fifo.run_all(), 10);
+    ASSERT_TRUE(fifo.empty());
+    ASSERT_EQ(order, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    ASSERT_EQ(fifo.run_all(), 0);
+}
+
+TEST(FunctionFifo, MoveOnlyAndLarge)
+{
+    auto fifo = function_fifo<>{};
+    auto result = 0;
+
+    auto value = std::make_unique<int>(42);
+    ASSERT_TRUE(fifo.try_add([value = std::move(value), &result] {
+        result += *value;
+    }));
+
+    // Too large for a slot, so allocated on the heap.
+    auto large = std::array<int, 64>{};
+    large[63] = 1;
+    ASSERT_TRUE(fifo.try_add([large, &result] {
+        result += large[63];
+    }));
+
+    ASSERT_EQ(fifo.run_all(), 2);
+    ASSERT_EQ(result, 43);
+}
+
+TEST(FunctionFifo, Full)
+{
+    auto fifo = function_fifo<64, 64>{};
+    auto count = 0;
+
+    auto nr_added = 0;
+    while (fifo.try_add([&count] {
+        ++count;
+    })) {
+        ++nr_added;
+    }
+    ASSERT_GT(nr_added, 0);
+    ASSERT_LT(nr_added, 64);
+
+    ASSERT_EQ(fifo.run_all(), nr_added);
+    ASSERT_EQ(count, nr_added);
+}
+
+TEST(FunctionFifo, ManyWriters)
+{
+    auto fifo = function_fifo<>{};
+    auto count = 0;
+    auto done = std::atomic<int>{0};
+
+    auto writers = std::vector<std::thread>{};
+    for (int i = 0; i != 4; ++i) {
+        writers.emplace_back([&] {
+            for (int j = 0; j != 10000; ++j) {
+                while (!fifo.try_add([&count] {
+                    ++count;
+                })) {
+                    std::this_thread::yield();
+                }
+            }
+            done.fetch_add(1);
+        });
+    }
+
+    // Only this thread runs the functions, so count needs no synchronization.
+    while (done.load() != 4 || !fifo.empty()) {
+        fifo.run_all();
+    }
+    for (auto &writer : writers) {
+        writer.join();
+    }
+    ASSERT_EQ(count, 40000);
+}
@@ -9,23 +9,25 @@
 #include "memory.hpp"
 #include "cast.hpp"
 #include <memory>
+#include <memory_resource>
 #include <algorithm>
 #include <string>
 #include <type_traits>
+#include <iterator>
 
 namespace tt {
 
 template<typename T, typename Allocator>
 class gap_buffer;
 
-template<typename T>
+template<typename T, typename Allocator = std::allocator<std::remove_cv_t<T>>>
 class gap_buffer_iterator;
 
 template<typename T, typename Allocator>
-gap_buffer_iterator<T> make_gap_buffer_iterator(gap_buffer<T, Allocator> *buffer, ptrdiff_t index);
+gap_buffer_iterator<T, Allocator> make_gap_buffer_iterator(gap_buffer<T, Allocator> *buffer, ptrdiff_t index);
 
 template<typename T, typename Allocator>
-gap_buffer_iterator<T const> make_gap_buffer_iterator(gap_buffer<T, Allocator> const *buffer, ptrdiff_t index);
+gap_buffer_iterator<T const, Allocator> make_gap_buffer_iterator(gap_buffer<T, Allocator> const *buffer, ptrdiff_t index);
 
 /** Gap Buffer
  * This container is similar to a std::vector, optimized
@@ -56,8 +58,8 @@ public:
     using const_reference = T const &;
     using pointer = T *;
     using const_pointer = T const *;
-    using iterator = gap_buffer_iterator<T>;
-    using const_iterator = gap_buffer_iterator<T const>;
+    using iterator = gap_buffer_iterator<T, Allocator>;
+    using const_iterator = gap_buffer_iterator<T const, Allocator>;
 
     /** Construct an empty buffer.
      */
@@ -69,12 +71,17 @@ public:
     /** Construct a buffer with the given initializer list.
      */
     gap_buffer(std::initializer_list<T> init, allocator_type const &allocator = allocator_type{}) :
-        _begin(_allocator.allocate(init.size() + _grow_size)),
-        _it_end(_begin + init.size()),
-        _gap_begin(_begin + init.size()),
-        _gap_size(_grow_size),
+        _begin(nullptr),
+        _it_end(nullptr),
+        _gap_begin(nullptr),
+        _gap_size(0),
         _allocator(allocator)
     {
+        // The allocator is the last member to be initialized.
+        _begin = _allocator.allocate(init.size() + _grow_size);
+        _it_end = _begin + init.size();
+        _gap_begin = _begin + init.size();
+        _gap_size = _grow_size;
         placement_copy(std::begin(init), std::end(init), _begin);
     }
 
@@ -91,7 +98,7 @@ public:
         tt_axiom(&other != this);
         tt_axiom(other.is_valid());
 
-        if (other._ptr != nullptr) {
+        if (other._begin != nullptr) {
             _begin = _allocator.allocate(other.capacity());
             _it_end = _begin + other.size();
             _gap_begin = _begin + other.left_size();
@@ -115,6 +122,7 @@ public:
         clear();
         if (_gap_size >= other.size()) {
             // Reuse memory.
+            _it_end = _begin + other.size();
             _gap_begin = _begin + other.left_size();
             _gap_size = capacity() - other.size();
 
@@ -137,13 +145,14 @@ public:
 
                 _begin = _allocator.allocate(new_capacity);
                 _it_end = _begin + other.size();
-                _gap_begin = _begin + other.left_begin_ptr();
+                _gap_begin = _begin + other.left_size();
                 _gap_size = new_capacity - other.size();
 
                 placement_copy(other.left_begin_ptr(), other.left_end_ptr(), left_begin_ptr());
                 placement_copy(other.right_begin_ptr(), other.right_end_ptr(), right_begin_ptr());
             }
         }
+        return *this;
     }
 
     /** Move constructor.
@@ -179,7 +188,7 @@ public:
             std::swap(_begin, other._begin);
             std::swap(_it_end, other._it_end);
             std::swap(_gap_begin, other._gap_begin);
-            std::swap(_gap_size, other._size);
+            std::swap(_gap_size, other._gap_size);
             return *this;
 
         } else if (capacity() >= other.size()) {
@@ -241,6 +250,11 @@ public:
         }
     }
 
+    [[nodiscard]] allocator_type get_allocator() const noexcept
+    {
+        return _allocator;
+    }
+
     /** Index operator.
      * Return a reference to the item at index.
      *
@@ -273,7 +287,7 @@ public:
      */
     [[nodiscard]] reference at(size_type index)
     {
-        if (index < size()) {
+        if (index >= size()) {
             throw std::out_of_range("gap_buffer::at");
         }
         return *get_pointer_from_index(index);
@@ -287,7 +301,7 @@ public:
      */
     [[nodiscard]] const_reference at(size_type index) const
     {
-        if (index < size()) {
+        if (index >= size()) {
             throw std::out_of_range("gap_buffer::at");
         }
         return *get_pointer_from_index(index);
@@ -296,25 +310,25 @@ public:
     [[nodiscard]] reference front() noexcept
     {
         tt_axiom(size() != 0);
-        return *get_pointer_from_it_ptr(_begin);
+        return *get_pointer_from_it(_begin);
     }
 
     [[nodiscard]] const_reference front() const noexcept
     {
         tt_axiom(size() != 0);
-        return *get_pointer_from_it_ptr(_begin);
+        return *get_pointer_from_it(_begin);
     }
 
     [[nodiscard]] reference back() noexcept
     {
         tt_axiom(size() != 0);
-        return *get_pointer_from_it_ptr(_it_end - 1);
+        return *get_pointer_from_it(_it_end - 1);
     }
 
     [[nodiscard]] const_reference back() const noexcept
     {
         tt_axiom(size() != 0);
-        return *get_pointer_from_it_ptr(_it_end - 1);
+        return *get_pointer_from_it(_it_end - 1);
     }
 
     void pop_back() noexcept
@@ -365,8 +379,7 @@ public:
 
     void reserve(size_t new_capacity) noexcept
     {
-        ttlet extra_capacity = static_cast<ssize_t>(new_capacity) - capacity();
-        if (extra_capacity <= 0) {
+        if (new_capacity <= capacity()) {
             return;
         }
 
@@ -423,8 +436,7 @@ public:
     template<typename... Args>
     void emplace_back(Args &&...args) noexcept
     {
-        set_gap_offset(_it_end);
-        grow_to_insert(1);
+        make_gap(_it_end, 1);
 
         new (left_end_ptr()) value_type(std::forward<Args>(args)...);
         ++_it_end;
@@ -448,8 +460,7 @@ public:
     template<typename... Args>
     void emplace_front(Args &&...args) noexcept
     {
-        set_gap_offset(_begin);
-        grow_to_insert(1);
+        make_gap(_begin, 1);
 
         new (right_begin_ptr() - 1) value_type(std::forward<Args>(args)...);
         ++_it_end;
@@ -477,8 +488,7 @@ public:
     iterator emplace_before(iterator position, Args &&...args) noexcept
     {
         tt_axiom(position.buffer() == this);
-        set_gap_offset(position.it_ptr());
-        grow_to_insert(1);
+        make_gap(position.it_ptr(), 1);
 
         new (right_begin_ptr() - 1) value_type(std::forward<Args>(args)...);
         ++_it_end;
@@ -486,7 +496,7 @@ public:
 #if TT_BUILT_TYPE == TT_BT_DEBUG
         ++_version;
 #endif
-        return gap_buffer_iterator<T>(this, _gap_begin);
+        return iterator(this, _gap_begin);
     }
 
     /** Place the gap at the position and emplace at the end of the gap.
@@ -508,6 +518,8 @@ public:
     }
 
     /** Insert items
+     * The gap is placed at the position and made large enough for all items at once,
+     * after which the items are copied to the end of the gap.
      * If an insert requires a reallocation then all current
      * iterators become invalid.
      *
@@ -516,14 +528,20 @@ public:
      * @param last The one beyond last item to insert.
      * @return The iterator pointing to the first item inserted.
      */
-    template<typename It>
+    template<std::forward_iterator It>
     iterator insert_before(iterator position, It first, It last) noexcept
     {
-        auto it = last;
-        while (it != first) {
-            position = insert_before(position, *(--it));
-        }
-        return position;
+        tt_axiom(position.buffer() == this);
+        ttlet n = narrow_cast<size_type>(std::distance(first, last));
+        make_gap(position.it_ptr(), n);
+
+        std::uninitialized_copy(first, last, right_begin_ptr() - n);
+        _it_end += n;
+        _gap_size -= n;
+#if TT_BUILT_TYPE == TT_BT_DEBUG
+        ++_version;
+#endif
+        return iterator(this, _gap_begin);
     }
 
     /** Place the gap after the position and emplace at the beginning of the gap.
@@ -534,8 +552,7 @@ public:
     iterator emplace_after(iterator position, Args &&...args) noexcept
     {
         tt_axiom(position.buffer() == this);
-        set_gap_offset(position.it_ptr() + 1);
-        grow_to_insert(1);
+        make_gap(position.it_ptr() + 1, 1);
 
         new (left_end_ptr()) value_type(std::forward<Args>(args)...);
         ++_it_end;
@@ -544,7 +561,7 @@ public:
 #if TT_BUILT_TYPE == TT_BT_DEBUG
         ++_version;
 #endif
-        return gap_buffer_iterator<T>(this, _gap_begin - 1);
+        return iterator(this, _gap_begin - 1);
     }
 
     /** Place the gap after the position and emplace at the beginning of the gap.
@@ -566,19 +583,63 @@ public:
     }
 
     /** Insert items
+     * The gap is placed after the position and made large enough for all items at once,
+     * after which the items are copied to the beginning of the gap.
+     * If an insert requires a reallocation then all current
+     * iterators become invalid.
      *
      * @param position Location to insert after.
      * @param first The first item to insert.
      * @param last The one beyond last item to insert.
      * @return The iterator pointing to the last item inserted.
      */
-    template<typename It>
+    template<std::forward_iterator It>
     iterator insert_after(iterator position, It first, It last) noexcept
     {
-        for (auto it = first; it != last; ++it) {
-            position = insert_after(position, *it);
-        }
-        return position;
+        tt_axiom(position.buffer() == this);
+        ttlet n = narrow_cast<size_type>(std::distance(first, last));
+        make_gap(position.it_ptr() + 1, n);
+
+        std::uninitialized_copy(first, last, left_end_ptr());
+        _it_end += n;
+        _gap_begin += n;
+        _gap_size -= n;
+#if TT_BUILT_TYPE == TT_BT_DEBUG
+        ++_version;
+#endif
+        return iterator(this, _gap_begin - 1);
+    }
+
+    /** Replace items
+     * The items are erased, which leaves the gap at their location, and the new
+     * items are copied into the gap.
+     * If the replacement requires a reallocation then all current
+     * iterators become invalid.
+     *
+     * @param first Location of first item to replace.
+     * @param last Location beyond last item to replace.
+     * @param r_first The first item to insert.
+     * @param r_last The one beyond last item to insert.
+     * @return The iterator pointing to the first item inserted.
+     */
+    template<std::forward_iterator It>
+    iterator replace(iterator first, iterator last, It r_first, It r_last) noexcept
+    {
+        return insert_before(erase(first, last), r_first, r_last);
+    }
+
+    /** Replace items
+     * @see replace(iterator, iterator, It, It)
+     *
+     * @param first Location of first item to replace.
+     * @param last Location beyond last item to replace.
+     * @param range The items to insert.
+     * @return The iterator pointing to the first item inserted.
+     */
+    template<typename Range>
+    iterator replace(iterator first, iterator last, Range const &range) noexcept
+    {
+        return replace(first, last, std::begin(range), std::end(range));
     }
 
     /** Erase items
@@ -677,14 +738,61 @@ private:
             (_begin <= _gap_begin && _gap_begin <= _it_end);
     }
 
-    /** Grow the gap_buffer based on the size to be inserted.
+    /** Move the gap to a location and make sure it has room for the items to be inserted.
+     *
+     * When the buffer needs to grow, the items are moved directly to their location on
+     * either side of the gap in the new allocation, instead of first moving the gap and
+     * then moving all items to the new allocation. The capacity grows by at least half,
+     * to keep the number of reallocations logarithmic in the size.
+     *
+     * @param new_gap_begin The iterator-pointer where the gap should start.
+     * @param n The number of items, to be inserted, that the gap should fit.
      */
-    void grow_to_insert(size_type n) noexcept
+    void make_gap(value_type *new_gap_begin, size_type n) noexcept
     {
         tt_axiom(is_valid());
-        if (n > _gap_size) [[unlikely]] {
-            auto new_capacity = size() + n + narrow_cast<size_type>(_grow_size);
-            reserve(ceil(new_capacity, hardware_constructive_interference_size));
+        if (n <= _gap_size) [[likely]] {
+            set_gap_offset(new_gap_begin);
+            return;
+        }
+
+        ttlet offset = static_cast<size_type>(new_gap_begin - _begin);
+        ttlet new_capacity = ceil(
+            std::max(size() + n, capacity() + capacity() / 2) + narrow_cast<size_type>(_grow_size),
+            hardware_constructive_interference_size);
+
+        ttlet new_begin = _allocator.allocate(new_capacity);
+        ttlet new_gap_size = new_capacity - size();
+        if (_begin != nullptr) {
+            move_items(0, offset, new_begin);
+            move_items(offset, size(), new_begin + offset + new_gap_size);
+            _allocator.deallocate(_begin, capacity());
+        }
+
+        _it_end = new_begin + size();
+        _begin = new_begin;
+        _gap_begin = new_begin + offset;
+        _gap_size = new_gap_size;
+    }
+
+    /** Move items out of the buffer.
+     * The items are destroyed; the caller is responsible for updating the buffer.
+     *
+     * @param first The index of the first item to move.
+     * @param last The index beyond the last item to move.
+     * @param dst The memory to move the items to, outside of this buffer's allocation.
+     */
+    void move_items(size_type first, size_type last, value_type *dst) noexcept
+    {
+        ttlet split = left_size();
+        if (first < split) {
+            ttlet left_last = std::min(last, split);
+            placement_move(_begin + first, _begin + left_last, dst);
+            dst += left_last - first;
+            first = left_last;
+        }
+        if (first < last) {
+            placement_move(right_begin_ptr() + (first - split), right_begin_ptr() + (last - split), dst);
         }
     }
 
@@ -817,13 +925,13 @@ private:
         _gap_begin = new_gap_begin;
     }
 
-    template<typename IT>
+    template<typename IT, typename ItAllocator>
     friend class gap_buffer_iterator;
 };
 
 /** A continues iterator over a gap_buffer.
  */
-template<typename T>
+template<typename T, typename Allocator>
 class gap_buffer_iterator {
 public:
     static_assert(
@@ -841,7 +949,7 @@ public:
     using const_reference = value_type const &;
     using iterator_category = std::random_access_iterator_tag;
 
-    using gap_buffer_type = std::conditional_t<is_const, gap_buffer<value_type> const, gap_buffer<value_type>>;
+    using gap_buffer_type = std::conditional_t<is_const, gap_buffer<value_type, Allocator> const, gap_buffer<value_type, Allocator>>;
 
     ~gap_buffer_iterator() noexcept = default;
     gap_buffer_iterator(gap_buffer_iterator const &) noexcept = default;
@@ -886,6 +994,18 @@ public:
         return *(_buffer->get_const_pointer_from_it(_it_ptr));
     }
 
+    pointer operator->() noexcept requires(!is_const)
+    {
+        tt_axiom(is_valid());
+        return _buffer->get_pointer_from_it(_it_ptr);
+    }
+
+    const_pointer operator->() const noexcept
+    {
+        tt_axiom(is_valid());
+        return _buffer->get_const_pointer_from_it(_it_ptr);
+    }
+
     reference operator[](std::integral auto index) noexcept requires(!is_const)
     {
         tt_axiom(is_valid());
@@ -960,7 +1080,7 @@ public:
 
     template<typename R>
     requires(std::is_same_v<std::remove_cv_t<T>, std::remove_cv_t<R>>) friend difference_type
-    operator-(gap_buffer_iterator const &lhs, gap_buffer_iterator<R> const &rhs) noexcept
+    operator-(gap_buffer_iterator const &lhs, gap_buffer_iterator<R, Allocator> const &rhs) noexcept
     {
         tt_axiom(lhs.is_valid(rhs));
         return lhs._it_ptr - rhs._it_ptr;
@@ -968,7 +1088,7 @@ public:
 
     template<typename R>
     requires(std::is_same_v<std::remove_cv_t<T>, std::remove_cv_t<R>>) friend bool
-    operator==(gap_buffer_iterator const &lhs, gap_buffer_iterator<R> const &rhs) noexcept
+    operator==(gap_buffer_iterator const &lhs, gap_buffer_iterator<R, Allocator> const &rhs) noexcept
     {
         tt_axiom(lhs.is_valid(rhs));
         return lhs._it_ptr == rhs.it_ptr();
@@ -976,7 +1096,7 @@ public:
 
     template<typename R>
     requires(std::is_same_v<std::remove_cv_t<T>, std::remove_cv_t<R>>) friend auto
-    operator<=>(gap_buffer_iterator const &lhs, gap_buffer_iterator<R> const &rhs) noexcept
+    operator<=>(gap_buffer_iterator const &lhs, gap_buffer_iterator<R, Allocator> const &rhs) noexcept
     {
         tt_axiom(lhs.is_valid(rhs));
         return lhs._it_ptr <=> rhs.it_ptr();
@@ -1003,20 +1123,29 @@ private:
 
     template<typename O>
     requires(std::is_same_v<std::remove_cv_t<T>, std::remove_cv_t<O>>)
-    [[nodiscard]] bool is_valid(gap_buffer_iterator<O> const &other) const noexcept
+    [[nodiscard]] bool is_valid(gap_buffer_iterator<O, Allocator> const &other) const noexcept
     {
         return is_valid() && other.is_valid() && _buffer == other._buffer;
     }
 };
 
+namespace pmr {
+
+/** A gap_buffer that allocates from a std::pmr::memory_resource.
+ */
+template<typename T>
+using gap_buffer = tt::gap_buffer<T, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+
 template<typename T, typename Allocator>
-gap_buffer_iterator<T> make_gap_buffer_iterator(gap_buffer<T, Allocator> *buffer, T *it_ptr)
+gap_buffer_iterator<T, Allocator> make_gap_buffer_iterator(gap_buffer<T, Allocator> *buffer, T *it_ptr)
 {
     return {buffer, it_ptr};
 }
 
 template<typename T, typename Allocator>
-gap_buffer_iterator<T const> make_gap_buffer_iterator(gap_buffer<T, Allocator> const *buffer, T *it_ptr)
+gap_buffer_iterator<T const, Allocator> make_gap_buffer_iterator(gap_buffer<T, Allocator> const *buffer, T *it_ptr)
 {
     return {buffer, it_ptr};
 }
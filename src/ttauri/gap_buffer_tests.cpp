@@ -6,7 +6,11 @@
 #include "required.hpp"
 #include "hash.hpp"
 #include <gtest/gtest.h>
+#include <array>
 #include <iostream>
+#include <memory_resource>
+#include <string>
+#include <vector>
 
 using namespace std;
 using namespace tt;
@@ -207,3 +211,96 @@ TEST(gap_buffer, insert_after_reserve)
         ASSERT_TRUE(e.capacity() == e_cap);
     }
 }
+
+TEST(gap_buffer, front_back_after_erase)
+{
+    auto tmp = gap_buffer<int>{};
+    for (int i = 0; i != 10; ++i) {
+        tmp.push_back(i);
+    }
+
+    // Move the gap into the middle of the buffer.
+    tmp.erase(tmp.begin() + 3, tmp.begin() + 5);
+    ASSERT_EQ(tmp.size(), 8);
+    ASSERT_EQ(tmp.front(), 0);
+    ASSERT_EQ(tmp.back(), 9);
+    ASSERT_EQ(tmp.begin()[3], 5);
+    ASSERT_EQ(tmp.at(7), 9);
+    ASSERT_THROW((void)tmp.at(8), std::out_of_range);
+
+    // Reserving less than the capacity must keep the items.
+    ttlet cap = tmp.capacity();
+    tmp.reserve(1);
+    ASSERT_EQ(tmp.capacity(), cap);
+    ASSERT_EQ(tmp, (std::vector<int>{0, 1, 2, 5, 6, 7, 8, 9}));
+}
+
+TEST(gap_buffer, pmr)
+{
+    auto buffer = std::array<std::byte, 8192>{};
+    auto resource = std::pmr::monotonic_buffer_resource{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+
+    auto tmp = tt::pmr::gap_buffer<int>{{1, 2, 3}, &resource};
+    tmp.push_back(4);
+    ASSERT_EQ(tmp.size(), 4);
+    ASSERT_EQ(tmp[3], 4);
+
+    auto copy = tmp;
+    ASSERT_EQ(copy, tmp);
+    ASSERT_EQ(copy.get_allocator().resource(), &resource);
+}
+
+TEST(gap_buffer, insert_range)
+{
+    auto tmp = gap_buffer<int>{};
+    auto e = std::vector<int>{};
+
+    // Insert ranges of different sizes to force reallocations with the gap in the middle.
+    for (size_t i = 0; i != 100; ++i) {
+        auto range = std::vector<int>{};
+        for (size_t j = 0; j != i * 7 % 53; ++j) {
+            range.push_back(narrow_cast<int>(i * 1000 + j));
+        }
+
+        ttlet index = hash_mix_two(i, i) % (e.size() + 1);
+        ttlet it = tmp.insert_before(tmp.begin() + index, range.begin(), range.end());
+        e.insert(e.begin() + index, range.begin(), range.end());
+        ASSERT_EQ(tmp, e);
+        ASSERT_EQ(it - tmp.begin(), narrow_cast<ptrdiff_t>(index));
+    }
+
+    for (size_t i = 0; i != 100; ++i) {
+        auto range = std::vector<int>{};
+        for (size_t j = 0; j != i * 5 % 31; ++j) {
+            range.push_back(narrow_cast<int>(i * 1000 + j));
+        }
+
+        ttlet index = hash_mix_two(i, i) % e.size();
+        ttlet it = tmp.insert_after(tmp.begin() + index, range.begin(), range.end());
+        e.insert(e.begin() + index + 1, range.begin(), range.end());
+        ASSERT_EQ(tmp, e);
+        ASSERT_EQ(it - tmp.begin(), narrow_cast<ptrdiff_t>(index + range.size()));
+    }
+}
+
+TEST(gap_buffer, replace)
+{
+    auto tmp = gap_buffer<std::string>{};
+    auto e = std::vector<std::string>{};
+
+    for (size_t i = 0; i != 200; ++i) {
+        auto range = std::vector<std::string>{};
+        for (size_t j = 0; j != i * 7 % 13; ++j) {
+            range.push_back(std::to_string(i * 1000 + j) + " a string that is too long for the small string optimization");
+        }
+
+        ttlet first = hash_mix_two(i, i) % (e.size() + 1);
+        ttlet last = first + hash_mix_two(i, first) % (e.size() - first + 1);
+
+        ttlet it = tmp.replace(tmp.begin() + first, tmp.begin() + last, range);
+        e.erase(e.begin() + first, e.begin() + last);
+        e.insert(e.begin() + first, range.begin(), range.end());
+        ASSERT_EQ(tmp, e);
+        ASSERT_EQ(it - tmp.begin(), narrow_cast<ptrdiff_t>(first));
+    }
+}
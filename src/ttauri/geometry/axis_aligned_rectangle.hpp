@@ -225,6 +225,16 @@ public:
         return ge(static_cast<f32x4>(rhs).xyxy(), v) == 0b0011;
     }
 
+    /** Check if a rectangle is fully inside the rectangle.
+     *
+     * @param rhs The rectangle to test.
+     */
+    [[nodiscard]] bool contains(axis_aligned_rectangle const &rhs) const noexcept
+    {
+        // this.p0 <= rhs.p0 & rhs.p3 <= this.p3
+        return (le(v, rhs.v) & 0b0011) == 0b0011 && (le(rhs.v, v) & 0b1100) == 0b1100;
+    }
+
     /** Align a rectangle within another rectangle.
      * @param haystack The outside rectangle
      * @param needle The inside rectangle; to be aligned.
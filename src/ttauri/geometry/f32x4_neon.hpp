@@ -0,0 +1,143 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <arm_neon.h>
+
+namespace tt {
+
+using f32x4_raw = std::array<float, 4>;
+
+[[nodiscard]] inline f32x4_raw to_f32x4_raw(float32x4_t const &rhs) noexcept
+{
+    f32x4_raw r;
+    vst1q_f32(r.data(), rhs);
+    return r;
+}
+
+[[nodiscard]] inline float32x4_t to_float32x4(f32x4_raw const &rhs) noexcept
+{
+    return vld1q_f32(rhs.data());
+}
+
+/** Convert the result of a NEON comparison to a mask with a bit for each element.
+ */
+[[nodiscard]] inline unsigned int f32x4_neon_to_mask(uint32x4_t const &rhs) noexcept
+{
+    constexpr uint32_t bits[4] = {1, 2, 4, 8};
+    return vaddvq_u32(vandq_u32(rhs, vld1q_u32(bits)));
+}
+
+[[nodiscard]] inline f32x4_raw f32x4_neon_add(f32x4_raw const &lhs, f32x4_raw const &rhs) noexcept
+{
+    return to_f32x4_raw(vaddq_f32(to_float32x4(lhs), to_float32x4(rhs)));
+}
+
+[[nodiscard]] inline f32x4_raw f32x4_neon_sub(f32x4_raw const &lhs, f32x4_raw const &rhs) noexcept
+{
+    return to_f32x4_raw(vsubq_f32(to_float32x4(lhs), to_float32x4(rhs)));
+}
+
+[[nodiscard]] inline f32x4_raw f32x4_neon_mul(f32x4_raw const &lhs, f32x4_raw const &rhs) noexcept
+{
+    return to_f32x4_raw(vmulq_f32(to_float32x4(lhs), to_float32x4(rhs)));
+}
+
+[[nodiscard]] inline f32x4_raw f32x4_neon_div(f32x4_raw const &lhs, f32x4_raw const &rhs) noexcept
+{
+    return to_f32x4_raw(vdivq_f32(to_float32x4(lhs), to_float32x4(rhs)));
+}
+
+/** The minimum of each element, `lhs < rhs ? lhs : rhs`.
+ * vminq_f32() is not used, since it handles NaN differently from the scalar and SSE code.
+ */
+[[nodiscard]] inline f32x4_raw f32x4_neon_min(f32x4_raw const &lhs, f32x4_raw const &rhs) noexcept
+{
+    auto lhs_ = to_float32x4(lhs);
+    auto rhs_ = to_float32x4(rhs);
+    return to_f32x4_raw(vbslq_f32(vcltq_f32(lhs_, rhs_), lhs_, rhs_));
+}
+
+/** The maximum of each element, `lhs > rhs ? lhs : rhs`.
+ */
+[[nodiscard]] inline f32x4_raw f32x4_neon_max(f32x4_raw const &lhs, f32x4_raw const &rhs) noexcept
+{
+    auto lhs_ = to_float32x4(lhs);
+    auto rhs_ = to_float32x4(rhs);
+    return to_f32x4_raw(vbslq_f32(vcgtq_f32(lhs_, rhs_), lhs_, rhs_));
+}
+
+[[nodiscard]] inline f32x4_raw f32x4_neon_sqrt(f32x4_raw const &rhs) noexcept
+{
+    return to_f32x4_raw(vsqrtq_f32(to_float32x4(rhs)));
+}
+
+/** An approximation of the reciprocal of each element.
+ * The estimate is refined with one Newton-Raphson step, to be as accurate as `_mm_rcp_ps()`.
+ */
+[[nodiscard]] inline f32x4_raw f32x4_neon_rcp(f32x4_raw const &rhs) noexcept
+{
+    auto rhs_ = to_float32x4(rhs);
+    auto estimate = vrecpeq_f32(rhs_);
+    return to_f32x4_raw(vmulq_f32(estimate, vrecpsq_f32(rhs_, estimate)));
+}
+
+[[nodiscard]] inline f32x4_raw f32x4_neon_floor(f32x4_raw const &rhs) noexcept
+{
+    return to_f32x4_raw(vrndmq_f32(to_float32x4(rhs)));
+}
+
+[[nodiscard]] inline f32x4_raw f32x4_neon_ceil(f32x4_raw const &rhs) noexcept
+{
+    return to_f32x4_raw(vrndpq_f32(to_float32x4(rhs)));
+}
+
+/** Round each of the elements in the current rounding direction.
+ */
+[[nodiscard]] inline f32x4_raw f32x4_neon_round(f32x4_raw const &rhs) noexcept
+{
+    return to_f32x4_raw(vrndiq_f32(to_float32x4(rhs)));
+}
+
+[[nodiscard]] inline unsigned int f32x4_neon_eq_mask(f32x4_raw const &lhs, f32x4_raw const &rhs) noexcept
+{
+    return f32x4_neon_to_mask(vceqq_f32(to_float32x4(lhs), to_float32x4(rhs)));
+}
+
+[[nodiscard]] inline unsigned int f32x4_neon_ne_mask(f32x4_raw const &lhs, f32x4_raw const &rhs) noexcept
+{
+    return f32x4_neon_eq_mask(lhs, rhs) ^ 0xf;
+}
+
+[[nodiscard]] inline unsigned int f32x4_neon_lt_mask(f32x4_raw const &lhs, f32x4_raw const &rhs) noexcept
+{
+    return f32x4_neon_to_mask(vcltq_f32(to_float32x4(lhs), to_float32x4(rhs)));
+}
+
+[[nodiscard]] inline unsigned int f32x4_neon_gt_mask(f32x4_raw const &lhs, f32x4_raw const &rhs) noexcept
+{
+    return f32x4_neon_to_mask(vcgtq_f32(to_float32x4(lhs), to_float32x4(rhs)));
+}
+
+[[nodiscard]] inline unsigned int f32x4_neon_le_mask(f32x4_raw const &lhs, f32x4_raw const &rhs) noexcept
+{
+    return f32x4_neon_to_mask(vcleq_f32(to_float32x4(lhs), to_float32x4(rhs)));
+}
+
+[[nodiscard]] inline unsigned int f32x4_neon_ge_mask(f32x4_raw const &lhs, f32x4_raw const &rhs) noexcept
+{
+    return f32x4_neon_to_mask(vcgeq_f32(to_float32x4(lhs), to_float32x4(rhs)));
+}
+
+/** Compare if all elements are equal.
+ */
+[[nodiscard]] inline bool f32x4_neon_eq(f32x4_raw const &lhs, f32x4_raw const &rhs) noexcept
+{
+    return vminvq_u32(vceqq_f32(to_float32x4(lhs), to_float32x4(rhs))) != 0;
+}
+
+} // namespace tt
@@ -54,6 +54,20 @@ using f32x4_raw = std::array<float, 4>;
     return to_f32x4_raw(_mm_rcp_ps(to_m128(rhs)));
 }
 
+/** Take the square root of each element in the SSE register.
+ */
+[[nodiscard]] inline f32x4_raw f32x4_sse_sqrt(f32x4_raw const &rhs) noexcept
+{
+    return to_f32x4_raw(_mm_sqrt_ps(to_m128(rhs)));
+}
+
+/** Take the approximate reciprocal of the square root of each element in the SSE register.
+ */
+[[nodiscard]] inline f32x4_raw f32x4_sse_rcp_sqrt(f32x4_raw const &rhs) noexcept
+{
+    return to_f32x4_raw(_mm_rsqrt_ps(to_m128(rhs)));
+}
+
 /** Clear elements of an SSE register.
  *
  * @tparam Mask '1': 0.0, '0': original value.
@@ -0,0 +1,106 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <array>
+#include <immintrin.h>
+
+namespace tt {
+
+using f32x8_raw = std::array<float, 8>;
+
+[[nodiscard]] inline f32x8_raw to_f32x8_raw(__m256 const &rhs) noexcept
+{
+    f32x8_raw r;
+    _mm256_storeu_ps(r.data(), rhs);
+    return r;
+}
+
+[[nodiscard]] inline __m256 to_m256(f32x8_raw const &rhs) noexcept
+{
+    return _mm256_loadu_ps(rhs.data());
+}
+
+[[nodiscard]] inline f32x8_raw f32x8_avx_add(f32x8_raw const &lhs, f32x8_raw const &rhs) noexcept
+{
+    return to_f32x8_raw(_mm256_add_ps(to_m256(lhs), to_m256(rhs)));
+}
+
+[[nodiscard]] inline f32x8_raw f32x8_avx_sub(f32x8_raw const &lhs, f32x8_raw const &rhs) noexcept
+{
+    return to_f32x8_raw(_mm256_sub_ps(to_m256(lhs), to_m256(rhs)));
+}
+
+[[nodiscard]] inline f32x8_raw f32x8_avx_mul(f32x8_raw const &lhs, f32x8_raw const &rhs) noexcept
+{
+    return to_f32x8_raw(_mm256_mul_ps(to_m256(lhs), to_m256(rhs)));
+}
+
+[[nodiscard]] inline f32x8_raw f32x8_avx_div(f32x8_raw const &lhs, f32x8_raw const &rhs) noexcept
+{
+    return to_f32x8_raw(_mm256_div_ps(to_m256(lhs), to_m256(rhs)));
+}
+
+/** The minimum of each element, `lhs < rhs ? lhs : rhs`.
+ */
+[[nodiscard]] inline f32x8_raw f32x8_avx_min(f32x8_raw const &lhs, f32x8_raw const &rhs) noexcept
+{
+    return to_f32x8_raw(_mm256_min_ps(to_m256(lhs), to_m256(rhs)));
+}
+
+/** The maximum of each element, `lhs > rhs ? lhs : rhs`.
+ */
+[[nodiscard]] inline f32x8_raw f32x8_avx_max(f32x8_raw const &lhs, f32x8_raw const &rhs) noexcept
+{
+    return to_f32x8_raw(_mm256_max_ps(to_m256(lhs), to_m256(rhs)));
+}
+
+[[nodiscard]] inline f32x8_raw f32x8_avx_sqrt(f32x8_raw const &rhs) noexcept
+{
+    return to_f32x8_raw(_mm256_sqrt_ps(to_m256(rhs)));
+}
+
+/** An approximation of the reciprocal of each element.
+ */
+[[nodiscard]] inline f32x8_raw f32x8_avx_rcp(f32x8_raw const &rhs) noexcept
+{
+    return to_f32x8_raw(_mm256_rcp_ps(to_m256(rhs)));
+}
+
+[[nodiscard]] inline f32x8_raw f32x8_avx_floor(f32x8_raw const &rhs) noexcept
+{
+    return to_f32x8_raw(_mm256_floor_ps(to_m256(rhs)));
+}
+
+[[nodiscard]] inline f32x8_raw f32x8_avx_ceil(f32x8_raw const &rhs) noexcept
+{
+    return to_f32x8_raw(_mm256_ceil_ps(to_m256(rhs)));
+}
+
+/** Round each of the elements in the current rounding direction.
+ */
+[[nodiscard]] inline f32x8_raw f32x8_avx_round(f32x8_raw const &rhs) noexcept
+{
+    return to_f32x8_raw(_mm256_round_ps(to_m256(rhs), _MM_FROUND_CUR_DIRECTION));
+}
+
+/** Compare each element and return a mask.
+ *
+ * @tparam Predicate One of the _CMP_ predicates of `_mm256_cmp_ps()`.
+ */
+template<int Predicate>
+[[nodiscard]] inline unsigned int f32x8_avx_cmp_mask(f32x8_raw const &lhs, f32x8_raw const &rhs) noexcept
+{
+    return static_cast<unsigned int>(_mm256_movemask_ps(_mm256_cmp_ps(to_m256(lhs), to_m256(rhs), Predicate)));
+}
+
+/** Compare if all elements are equal.
+ */
+[[nodiscard]] inline bool f32x8_avx_eq(f32x8_raw const &lhs, f32x8_raw const &rhs) noexcept
+{
+    return f32x8_avx_cmp_mask<_CMP_EQ_OQ>(lhs, rhs) == 0xff;
+}
+
+} // namespace tt
@@ -0,0 +1,99 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <array>
+#include <immintrin.h>
+
+namespace tt {
+
+using f64x4_raw = std::array<double, 4>;
+
+[[nodiscard]] inline f64x4_raw to_f64x4_raw(__m256d const &rhs) noexcept
+{
+    f64x4_raw r;
+    _mm256_storeu_pd(r.data(), rhs);
+    return r;
+}
+
+[[nodiscard]] inline __m256d to_m256d(f64x4_raw const &rhs) noexcept
+{
+    return _mm256_loadu_pd(rhs.data());
+}
+
+[[nodiscard]] inline f64x4_raw f64x4_avx_add(f64x4_raw const &lhs, f64x4_raw const &rhs) noexcept
+{
+    return to_f64x4_raw(_mm256_add_pd(to_m256d(lhs), to_m256d(rhs)));
+}
+
+[[nodiscard]] inline f64x4_raw f64x4_avx_sub(f64x4_raw const &lhs, f64x4_raw const &rhs) noexcept
+{
+    return to_f64x4_raw(_mm256_sub_pd(to_m256d(lhs), to_m256d(rhs)));
+}
+
+[[nodiscard]] inline f64x4_raw f64x4_avx_mul(f64x4_raw const &lhs, f64x4_raw const &rhs) noexcept
+{
+    return to_f64x4_raw(_mm256_mul_pd(to_m256d(lhs), to_m256d(rhs)));
+}
+
+[[nodiscard]] inline f64x4_raw f64x4_avx_div(f64x4_raw const &lhs, f64x4_raw const &rhs) noexcept
+{
+    return to_f64x4_raw(_mm256_div_pd(to_m256d(lhs), to_m256d(rhs)));
+}
+
+/** The minimum of each element, `lhs < rhs ? lhs : rhs`.
+ */
+[[nodiscard]] inline f64x4_raw f64x4_avx_min(f64x4_raw const &lhs, f64x4_raw const &rhs) noexcept
+{
+    return to_f64x4_raw(_mm256_min_pd(to_m256d(lhs), to_m256d(rhs)));
+}
+
+/** The maximum of each element, `lhs > rhs ? lhs : rhs`.
+ */
+[[nodiscard]] inline f64x4_raw f64x4_avx_max(f64x4_raw const &lhs, f64x4_raw const &rhs) noexcept
+{
+    return to_f64x4_raw(_mm256_max_pd(to_m256d(lhs), to_m256d(rhs)));
+}
+
+[[nodiscard]] inline f64x4_raw f64x4_avx_sqrt(f64x4_raw const &rhs) noexcept
+{
+    return to_f64x4_raw(_mm256_sqrt_pd(to_m256d(rhs)));
+}
+
+[[nodiscard]] inline f64x4_raw f64x4_avx_floor(f64x4_raw const &rhs) noexcept
+{
+    return to_f64x4_raw(_mm256_floor_pd(to_m256d(rhs)));
+}
+
+[[nodiscard]] inline f64x4_raw f64x4_avx_ceil(f64x4_raw const &rhs) noexcept
+{
+    return to_f64x4_raw(_mm256_ceil_pd(to_m256d(rhs)));
+}
+
+/** Round each of the elements in the current rounding direction.
+ */
+[[nodiscard]] inline f64x4_raw f64x4_avx_round(f64x4_raw const &rhs) noexcept
+{
+    return to_f64x4_raw(_mm256_round_pd(to_m256d(rhs), _MM_FROUND_CUR_DIRECTION));
+}
+
+/** Compare each element and return a mask.
+ *
+ * @tparam Predicate One of the _CMP_ predicates of `_mm256_cmp_pd()`.
+ */
+template<int Predicate>
+[[nodiscard]] inline unsigned int f64x4_avx_cmp_mask(f64x4_raw const &lhs, f64x4_raw const &rhs) noexcept
+{
+    return static_cast<unsigned int>(_mm256_movemask_pd(_mm256_cmp_pd(to_m256d(lhs), to_m256d(rhs), Predicate)));
+}
+
+/** Compare if all elements are equal.
+ */
+[[nodiscard]] inline bool f64x4_avx_eq(f64x4_raw const &lhs, f64x4_raw const &rhs) noexcept
+{
+    return f64x4_avx_cmp_mask<_CMP_EQ_OQ>(lhs, rhs) == 0xf;
+}
+
+} // namespace tt
@@ -0,0 +1,82 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <immintrin.h>
+
+namespace tt {
+
+using i32x8_raw = std::array<int32_t, 8>;
+
+[[nodiscard]] inline i32x8_raw to_i32x8_raw(__m256i const &rhs) noexcept
+{
+    i32x8_raw r;
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(r.data()), rhs);
+    return r;
+}
+
+[[nodiscard]] inline __m256i to_m256i(i32x8_raw const &rhs) noexcept
+{
+    return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(rhs.data()));
+}
+
+[[nodiscard]] inline i32x8_raw i32x8_avx2_add(i32x8_raw const &lhs, i32x8_raw const &rhs) noexcept
+{
+    return to_i32x8_raw(_mm256_add_epi32(to_m256i(lhs), to_m256i(rhs)));
+}
+
+[[nodiscard]] inline i32x8_raw i32x8_avx2_sub(i32x8_raw const &lhs, i32x8_raw const &rhs) noexcept
+{
+    return to_i32x8_raw(_mm256_sub_epi32(to_m256i(lhs), to_m256i(rhs)));
+}
+
+/** Multiply each element, keeping the low 32 bits of the result.
+ */
+[[nodiscard]] inline i32x8_raw i32x8_avx2_mul(i32x8_raw const &lhs, i32x8_raw const &rhs) noexcept
+{
+    return to_i32x8_raw(_mm256_mullo_epi32(to_m256i(lhs), to_m256i(rhs)));
+}
+
+[[nodiscard]] inline i32x8_raw i32x8_avx2_min(i32x8_raw const &lhs, i32x8_raw const &rhs) noexcept
+{
+    return to_i32x8_raw(_mm256_min_epi32(to_m256i(lhs), to_m256i(rhs)));
+}
+
+[[nodiscard]] inline i32x8_raw i32x8_avx2_max(i32x8_raw const &lhs, i32x8_raw const &rhs) noexcept
+{
+    return to_i32x8_raw(_mm256_max_epi32(to_m256i(lhs), to_m256i(rhs)));
+}
+
+[[nodiscard]] inline i32x8_raw i32x8_avx2_abs(i32x8_raw const &rhs) noexcept
+{
+    return to_i32x8_raw(_mm256_abs_epi32(to_m256i(rhs)));
+}
+
+/** Compare if equal elements and return a mask.
+ */
+[[nodiscard]] inline unsigned int i32x8_avx2_eq_mask(i32x8_raw const &lhs, i32x8_raw const &rhs) noexcept
+{
+    auto tmp = _mm256_cmpeq_epi32(to_m256i(lhs), to_m256i(rhs));
+    return static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(tmp)));
+}
+
+/** Compare if greater-than elements and return a mask.
+ */
+[[nodiscard]] inline unsigned int i32x8_avx2_gt_mask(i32x8_raw const &lhs, i32x8_raw const &rhs) noexcept
+{
+    auto tmp = _mm256_cmpgt_epi32(to_m256i(lhs), to_m256i(rhs));
+    return static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(tmp)));
+}
+
+/** Compare if all elements are equal.
+ */
+[[nodiscard]] inline bool i32x8_avx2_eq(i32x8_raw const &lhs, i32x8_raw const &rhs) noexcept
+{
+    return i32x8_avx2_eq_mask(lhs, rhs) == 0xff;
+}
+
+} // namespace tt
@@ -10,6 +10,15 @@
 #include "../type_traits.hpp"
 #if TT_PROCESSOR == TT_CPU_X64
 #include "f32x4_sse.hpp"
+#if defined(__AVX__)
+#include "f32x8_avx.hpp"
+#include "f64x4_avx.hpp"
+#endif
+#if defined(__AVX2__)
+#include "i32x8_avx2.hpp"
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include "f32x4_neon.hpp"
 #endif
 
 #include <cstdint>
@@ -545,6 +554,12 @@ public:
 
     [[nodiscard]] friend constexpr numeric_array abs(numeric_array const &rhs) noexcept
     {
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_i32x8 && has_avx2) {
+                return numeric_array{i32x8_avx2_abs(rhs.v)};
+            }
+        }
+
         auto neg_rhs = -rhs;
 
         auto r = numeric_array{};
@@ -556,8 +571,14 @@ public:
 
     [[nodiscard]] friend constexpr numeric_array rcp(numeric_array const &rhs) noexcept
     {
-        if (is_f32x4 && has_sse && !std::is_constant_evaluated()) {
-            return numeric_array{f32x4_sse_rcp(rhs.v)};
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x8 && has_avx) {
+                return numeric_array{f32x8_avx_rcp(rhs.v)};
+            } else if constexpr (is_f32x4 && has_neon) {
+                return numeric_array{f32x4_neon_rcp(rhs.v)};
+            } else if constexpr (is_f32x4 && has_sse) {
+                return numeric_array{f32x4_sse_rcp(rhs.v)};
+            }
         }
 
         auto r = numeric_array{};
@@ -569,8 +590,16 @@ public:
 
     [[nodiscard]] friend constexpr numeric_array sqrt(numeric_array const &rhs) noexcept
     {
-        if (is_f32x4 && has_sse && !std::is_constant_evaluated()) {
-            return numeric_array{f32x4_sse_sqrt(rhs.v)};
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x8 && has_avx) {
+                return numeric_array{f32x8_avx_sqrt(rhs.v)};
+            } else if constexpr (is_f64x4 && has_avx) {
+                return numeric_array{f64x4_avx_sqrt(rhs.v)};
+            } else if constexpr (is_f32x4 && has_neon) {
+                return numeric_array{f32x4_neon_sqrt(rhs.v)};
+            } else if constexpr (is_f32x4 && has_sse) {
+                return numeric_array{f32x4_sse_sqrt(rhs.v)};
+            }
         }
 
         auto r = numeric_array{};
@@ -582,8 +611,10 @@ public:
 
     [[nodiscard]] friend constexpr numeric_array rcp_sqrt(numeric_array const &rhs) noexcept
     {
-        if (is_f32x4 && has_sse && !std::is_constant_evaluated()) {
-            return numeric_array{f32x4_sse_rcp_sqrt(rhs.v)};
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x4 && has_sse) {
+                return numeric_array{f32x4_sse_rcp_sqrt(rhs.v)};
+            }
         }
 
         auto r = numeric_array{};
@@ -595,8 +626,16 @@ public:
 
     [[nodiscard]] friend constexpr numeric_array floor(numeric_array const &rhs) noexcept
     {
-        if (is_f32x4 && has_sse && !std::is_constant_evaluated()) {
-            return numeric_array{f32x4_sse_floor(rhs.v)};
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x8 && has_avx) {
+                return numeric_array{f32x8_avx_floor(rhs.v)};
+            } else if constexpr (is_f64x4 && has_avx) {
+                return numeric_array{f64x4_avx_floor(rhs.v)};
+            } else if constexpr (is_f32x4 && has_neon) {
+                return numeric_array{f32x4_neon_floor(rhs.v)};
+            } else if constexpr (is_f32x4 && has_sse) {
+                return numeric_array{f32x4_sse_floor(rhs.v)};
+            }
         }
 
         auto r = numeric_array{};
@@ -608,8 +647,16 @@ public:
 
     [[nodiscard]] friend constexpr numeric_array ceil(numeric_array const &rhs) noexcept
     {
-        if (is_f32x4 && has_sse && !std::is_constant_evaluated()) {
-            return numeric_array{f32x4_sse_ceil(rhs.v)};
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x8 && has_avx) {
+                return numeric_array{f32x8_avx_ceil(rhs.v)};
+            } else if constexpr (is_f64x4 && has_avx) {
+                return numeric_array{f64x4_avx_ceil(rhs.v)};
+            } else if constexpr (is_f32x4 && has_neon) {
+                return numeric_array{f32x4_neon_ceil(rhs.v)};
+            } else if constexpr (is_f32x4 && has_sse) {
+                return numeric_array{f32x4_sse_ceil(rhs.v)};
+            }
         }
 
         auto r = numeric_array{};
@@ -621,8 +668,16 @@ public:
 
     [[nodiscard]] friend constexpr numeric_array round(numeric_array const &rhs) noexcept
     {
-        if (is_f32x4 && has_sse && !std::is_constant_evaluated()) {
-            return numeric_array{f32x4_sse_round(rhs.v)};
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x8 && has_avx) {
+                return numeric_array{f32x8_avx_round(rhs.v)};
+            } else if constexpr (is_f64x4 && has_avx) {
+                return numeric_array{f64x4_avx_round(rhs.v)};
+            } else if constexpr (is_f32x4 && has_neon) {
+                return numeric_array{f32x4_neon_round(rhs.v)};
+            } else if constexpr (is_f32x4 && has_sse) {
+                return numeric_array{f32x4_sse_round(rhs.v)};
+            }
         }
 
         auto r = numeric_array{};
@@ -632,6 +687,54 @@ public:
         return r;
     }
 
+    // There are no instructions for the following functions, the loops are simple enough for
+    // the compiler to vectorize them with its vector math library.
+
+    [[nodiscard]] friend numeric_array cos(numeric_array const &rhs) noexcept
+    {
+        auto r = numeric_array{};
+        for (ssize_t i = 0; i != N; ++i) {
+            r.v[i] = std::cos(rhs.v[i]);
+        }
+        return r;
+    }
+
+    [[nodiscard]] friend numeric_array acos(numeric_array const &rhs) noexcept
+    {
+        auto r = numeric_array{};
+        for (ssize_t i = 0; i != N; ++i) {
+            r.v[i] = std::acos(rhs.v[i]);
+        }
+        return r;
+    }
+
+    [[nodiscard]] friend numeric_array cbrt(numeric_array const &rhs) noexcept
+    {
+        auto r = numeric_array{};
+        for (ssize_t i = 0; i != N; ++i) {
+            r.v[i] = std::cbrt(rhs.v[i]);
+        }
+        return r;
+    }
+
+    /** Select elements from two arrays.
+     *
+     * @param mask A bit mask, as returned by the comparison functions, where '1' selects
+     *             the element from @a lhs and '0' the element from @a rhs.
+     * @param lhs The elements selected by a '1'.
+     * @param rhs The elements selected by a '0'.
+     */
+    [[nodiscard]] friend constexpr numeric_array
+    select(unsigned int mask, numeric_array const &lhs, numeric_array const &rhs) noexcept
+        requires(N <= sizeof(unsigned int) * CHAR_BIT)
+    {
+        auto r = numeric_array{};
+        for (ssize_t i = 0; i != N; ++i) {
+            r.v[i] = static_cast<bool>(mask & (1_uz << i)) ? lhs.v[i] : rhs.v[i];
+        }
+        return r;
+    }
+
     /** Take a dot product.
      *
      * @tparam Mask A mask for which elements participate in the dot product.
@@ -642,8 +745,10 @@ public:
     template<ssize_t Mask>
     [[nodiscard]] friend constexpr T dot(numeric_array const &lhs, numeric_array const &rhs) noexcept
     {
-        if (is_f32x4 && has_sse && !std::is_constant_evaluated()) {
-            return f32x4_sse_dot<Mask>(lhs.v, rhs.v);
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x4 && has_sse) {
+                return f32x4_sse_dot<Mask>(lhs.v, rhs.v);
+            }
         }
 
         auto r = T{};
@@ -665,8 +770,10 @@ public:
     template<ssize_t Mask>
     [[nodiscard]] friend constexpr T hypot(numeric_array const &rhs) noexcept
     {
-        if (is_f32x4 && has_sse && !std::is_constant_evaluated()) {
-            return f32x4_sse_hypot<Mask>(rhs.v);
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x4 && has_sse) {
+                return f32x4_sse_hypot<Mask>(rhs.v);
+            }
         }
         return std::sqrt(dot<Mask>(rhs, rhs));
     }
@@ -693,8 +800,10 @@ public:
     template<ssize_t Mask>
     [[nodiscard]] friend constexpr T rcp_hypot(numeric_array const &rhs) noexcept
     {
-        if (is_f32x4 && has_sse && !std::is_constant_evaluated()) {
-            return f32x4_sse_rcp_hypot<Mask>(rhs.v);
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x4 && has_sse) {
+                return f32x4_sse_rcp_hypot<Mask>(rhs.v);
+            }
         }
 
         return 1.0f / hypot<Mask>(rhs);
@@ -713,8 +822,10 @@ public:
     {
         tt_axiom(rhs.is_vector());
 
-        if (is_f32x4 && has_sse && !std::is_constant_evaluated()) {
-            return numeric_array{f32x4_sse_normalize<Mask>(rhs.v)};
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x4 && has_sse) {
+                return numeric_array{f32x4_sse_normalize<Mask>(rhs.v)};
+            }
         }
 
         ttlet rcp_hypot_ = rcp_hypot<Mask>(rhs);
@@ -731,85 +842,137 @@ public:
     [[nodiscard]] friend constexpr unsigned int eq(numeric_array const &lhs, numeric_array const &rhs) noexcept
         requires(N <= sizeof(unsigned int) * CHAR_BIT)
     {
-        if (is_f32x4 && has_sse && !std::is_constant_evaluated()) {
-            return f32x4_sse_eq_mask(lhs.v, rhs.v);
-        } else {
-            unsigned int r = 0;
-            for (ssize_t i = 0; i != N; ++i) {
-                r |= static_cast<unsigned int>(lhs.v[i] == rhs.v[i]) << i;
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x8 && has_avx) {
+                return f32x8_avx_cmp_mask<_CMP_EQ_OQ>(lhs.v, rhs.v);
+            } else if constexpr (is_f64x4 && has_avx) {
+                return f64x4_avx_cmp_mask<_CMP_EQ_OQ>(lhs.v, rhs.v);
+            } else if constexpr (is_i32x8 && has_avx2) {
+                return i32x8_avx2_eq_mask(lhs.v, rhs.v);
+            } else if constexpr (is_f32x4 && has_neon) {
+                return f32x4_neon_eq_mask(lhs.v, rhs.v);
+            } else if constexpr (is_f32x4 && has_sse) {
+                return f32x4_sse_eq_mask(lhs.v, rhs.v);
             }
-            return r;
         }
+
+        unsigned int r = 0;
+        for (ssize_t i = 0; i != N; ++i) {
+            r |= static_cast<unsigned int>(lhs.v[i] == rhs.v[i]) << i;
+        }
+        return r;
     }
 
     [[nodiscard]] friend constexpr unsigned int ne(numeric_array const &lhs, numeric_array const &rhs) noexcept
         requires(N <= sizeof(unsigned int) * CHAR_BIT)
     {
-        if (is_f32x4 && has_sse && !std::is_constant_evaluated()) {
-            return f32x4_sse_ne_mask(lhs.v, rhs.v);
-        } else {
-            unsigned int r = 0;
-            for (ssize_t i = 0; i != N; ++i) {
-                r |= static_cast<unsigned int>(lhs.v[i] != rhs.v[i]) << i;
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x8 && has_avx) {
+                return f32x8_avx_cmp_mask<_CMP_NEQ_UQ>(lhs.v, rhs.v);
+            } else if constexpr (is_f64x4 && has_avx) {
+                return f64x4_avx_cmp_mask<_CMP_NEQ_UQ>(lhs.v, rhs.v);
+            } else if constexpr (is_f32x4 && has_neon) {
+                return f32x4_neon_ne_mask(lhs.v, rhs.v);
+            } else if constexpr (is_f32x4 && has_sse) {
+                return f32x4_sse_ne_mask(lhs.v, rhs.v);
             }
-            return r;
         }
+
+        unsigned int r = 0;
+        for (ssize_t i = 0; i != N; ++i) {
+            r |= static_cast<unsigned int>(lhs.v[i] != rhs.v[i]) << i;
+        }
+        return r;
     }
 
     [[nodiscard]] friend constexpr unsigned int lt(numeric_array const &lhs, numeric_array const &rhs) noexcept
         requires(N <= sizeof(unsigned int) * CHAR_BIT)
     {
-        if (is_f32x4 && has_sse && !std::is_constant_evaluated()) {
-            return f32x4_sse_lt_mask(lhs.v, rhs.v);
-        } else {
-            unsigned int r = 0;
-            for (ssize_t i = 0; i != N; ++i) {
-                r |= static_cast<unsigned int>(lhs.v[i] < rhs.v[i]) << i;
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x8 && has_avx) {
+                return f32x8_avx_cmp_mask<_CMP_LT_OQ>(lhs.v, rhs.v);
+            } else if constexpr (is_f64x4 && has_avx) {
+                return f64x4_avx_cmp_mask<_CMP_LT_OQ>(lhs.v, rhs.v);
+            } else if constexpr (is_f32x4 && has_neon) {
+                return f32x4_neon_lt_mask(lhs.v, rhs.v);
+            } else if constexpr (is_f32x4 && has_sse) {
+                return f32x4_sse_lt_mask(lhs.v, rhs.v);
             }
-            return r;
         }
+
+        unsigned int r = 0;
+        for (ssize_t i = 0; i != N; ++i) {
+            r |= static_cast<unsigned int>(lhs.v[i] < rhs.v[i]) << i;
+        }
+        return r;
     }
 
     [[nodiscard]] friend constexpr unsigned int gt(numeric_array const &lhs, numeric_array const &rhs) noexcept
         requires(N <= sizeof(unsigned int) * CHAR_BIT)
     {
-        if (is_f32x4 && has_sse && !std::is_constant_evaluated()) {
-            return f32x4_sse_gt_mask(lhs.v, rhs.v);
-        } else {
-            unsigned int r = 0;
-            for (ssize_t i = 0; i != N; ++i) {
-                r |= static_cast<unsigned int>(lhs.v[i] > rhs.v[i]) << i;
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x8 && has_avx) {
+                return f32x8_avx_cmp_mask<_CMP_GT_OQ>(lhs.v, rhs.v);
+            } else if constexpr (is_f64x4 && has_avx) {
+                return f64x4_avx_cmp_mask<_CMP_GT_OQ>(lhs.v, rhs.v);
+            } else if constexpr (is_i32x8 && has_avx2) {
+                return i32x8_avx2_gt_mask(lhs.v, rhs.v);
+            } else if constexpr (is_f32x4 && has_neon) {
+                return f32x4_neon_gt_mask(lhs.v, rhs.v);
+            } else if constexpr (is_f32x4 && has_sse) {
+                return f32x4_sse_gt_mask(lhs.v, rhs.v);
             }
-            return r;
         }
+
+        unsigned int r = 0;
+        for (ssize_t i = 0; i != N; ++i) {
+            r |= static_cast<unsigned int>(lhs.v[i] > rhs.v[i]) << i;
+        }
+        return r;
     }
 
     [[nodiscard]] friend constexpr unsigned int le(numeric_array const &lhs, numeric_array const &rhs) noexcept
         requires(N <= sizeof(unsigned int) * CHAR_BIT)
     {
-        if (is_f32x4 && has_sse && !std::is_constant_evaluated()) {
-            return f32x4_sse_le_mask(lhs.v, rhs.v);
-        } else {
-            unsigned int r = 0;
-            for (ssize_t i = 0; i != N; ++i) {
-                r |= static_cast<unsigned int>(lhs.v[i] <= rhs.v[i]) << i;
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x8 && has_avx) {
+                return f32x8_avx_cmp_mask<_CMP_LE_OQ>(lhs.v, rhs.v);
+            } else if constexpr (is_f64x4 && has_avx) {
+                return f64x4_avx_cmp_mask<_CMP_LE_OQ>(lhs.v, rhs.v);
+            } else if constexpr (is_f32x4 && has_neon) {
+                return f32x4_neon_le_mask(lhs.v, rhs.v);
+            } else if constexpr (is_f32x4 && has_sse) {
+                return f32x4_sse_le_mask(lhs.v, rhs.v);
             }
-            return r;
         }
+
+        unsigned int r = 0;
+        for (ssize_t i = 0; i != N; ++i) {
+            r |= static_cast<unsigned int>(lhs.v[i] <= rhs.v[i]) << i;
+        }
+        return r;
     }
 
     [[nodiscard]] friend constexpr unsigned int ge(numeric_array const &lhs, numeric_array const &rhs) noexcept
         requires(N <= sizeof(unsigned int) * CHAR_BIT)
     {
-        if (is_f32x4 && has_sse && !std::is_constant_evaluated()) {
-            return f32x4_sse_ge_mask(lhs.v, rhs.v);
-        } else {
-            unsigned int r = 0;
-            for (ssize_t i = 0; i != N; ++i) {
-                r |= static_cast<unsigned int>(lhs.v[i] >= rhs.v[i]) << i;
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x8 && has_avx) {
+                return f32x8_avx_cmp_mask<_CMP_GE_OQ>(lhs.v, rhs.v);
+            } else if constexpr (is_f64x4 && has_avx) {
+                return f64x4_avx_cmp_mask<_CMP_GE_OQ>(lhs.v, rhs.v);
+            } else if constexpr (is_f32x4 && has_neon) {
+                return f32x4_neon_ge_mask(lhs.v, rhs.v);
+            } else if constexpr (is_f32x4 && has_sse) {
+                return f32x4_sse_ge_mask(lhs.v, rhs.v);
             }
-            return r;
         }
+
+        unsigned int r = 0;
+        for (ssize_t i = 0; i != N; ++i) {
+            r |= static_cast<unsigned int>(lhs.v[i] >= rhs.v[i]) << i;
+        }
+        return r;
     }
 
     [[nodiscard]] friend constexpr bool operator==(numeric_array const &lhs, numeric_array const &rhs) noexcept
@@ -818,6 +981,14 @@ public:
             if constexpr (is_f32x4 && has_sse) {
                 // MSVC cannot vectorize comparison.
                 return f32x4_sse_eq(lhs.v, rhs.v);
+            } else if constexpr (is_f32x8 && has_avx) {
+                return f32x8_avx_eq(lhs.v, rhs.v);
+            } else if constexpr (is_f64x4 && has_avx) {
+                return f64x4_avx_eq(lhs.v, rhs.v);
+            } else if constexpr (is_i32x8 && has_avx2) {
+                return i32x8_avx2_eq(lhs.v, rhs.v);
+            } else if constexpr (is_f32x4 && has_neon) {
+                return f32x4_neon_eq(lhs.v, rhs.v);
             }
         }
 
@@ -835,6 +1006,18 @@ public:
 
     [[nodiscard]] friend constexpr numeric_array operator+(numeric_array const &lhs, numeric_array const &rhs) noexcept
     {
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x8 && has_avx) {
+                return numeric_array{f32x8_avx_add(lhs.v, rhs.v)};
+            } else if constexpr (is_f64x4 && has_avx) {
+                return numeric_array{f64x4_avx_add(lhs.v, rhs.v)};
+            } else if constexpr (is_i32x8 && has_avx2) {
+                return numeric_array{i32x8_avx2_add(lhs.v, rhs.v)};
+            } else if constexpr (is_f32x4 && has_neon) {
+                return numeric_array{f32x4_neon_add(lhs.v, rhs.v)};
+            }
+        }
+
         auto r = numeric_array{};
         for (ssize_t i = 0; i != N; ++i) {
             r.v[i] = lhs.v[i] + rhs.v[i];
@@ -862,62 +1045,76 @@ public:
 
     [[nodiscard]] friend constexpr numeric_array hadd(numeric_array const &lhs, numeric_array const &rhs) noexcept
     {
-        if (is_f32x4 && has_sse && !std::is_constant_evaluated()) {
-            return numeric_array{f32x4_sse_hadd(lhs.v, rhs.v)};
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x4 && has_sse) {
+                return numeric_array{f32x4_sse_hadd(lhs.v, rhs.v)};
+            }
+        }
 
-        } else {
-            tt_axiom(N % 2 == 0);
+        tt_axiom(N % 2 == 0);
 
-            auto r = numeric_array{};
+        auto r = numeric_array{};
 
-            ssize_t src_i = 0;
-            ssize_t dst_i = 0;
-            while (src_i != N) {
-                auto tmp = lhs[src_i++];
-                tmp += lhs[src_i++];
-                r.v[dst_i++] = tmp;
-            }
+        ssize_t src_i = 0;
+        ssize_t dst_i = 0;
+        while (src_i != N) {
+            auto tmp = lhs[src_i++];
+            tmp += lhs[src_i++];
+            r.v[dst_i++] = tmp;
+        }
 
-            src_i = 0;
-            while (src_i != N) {
-                auto tmp = rhs[src_i++];
-                tmp += rhs[src_i++];
-                r.v[dst_i++] = tmp;
-            }
-            return r;
+        src_i = 0;
+        while (src_i != N) {
+            auto tmp = rhs[src_i++];
+            tmp += rhs[src_i++];
+            r.v[dst_i++] = tmp;
         }
+        return r;
     }
 
     [[nodiscard]] friend constexpr numeric_array hsub(numeric_array const &lhs, numeric_array const &rhs) noexcept
     {
-        if (is_f32x4 && has_sse && !std::is_constant_evaluated()) {
-            return numeric_array{f32x4_sse_hsub(lhs.v, rhs.v)};
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x4 && has_sse) {
+                return numeric_array{f32x4_sse_hsub(lhs.v, rhs.v)};
+            }
+        }
 
-        } else {
-            tt_axiom(N % 2 == 0);
+        tt_axiom(N % 2 == 0);
 
-            auto r = numeric_array{};
+        auto r = numeric_array{};
 
-            ssize_t src_i = 0;
-            ssize_t dst_i = 0;
-            while (src_i != N) {
-                auto tmp = lhs[src_i++];
-                tmp -= lhs[src_i++];
-                r.v[dst_i++] = tmp;
-            }
+        ssize_t src_i = 0;
+        ssize_t dst_i = 0;
+        while (src_i != N) {
+            auto tmp = lhs[src_i++];
+            tmp -= lhs[src_i++];
+            r.v[dst_i++] = tmp;
+        }
 
-            src_i = 0;
-            while (src_i != N) {
-                auto tmp = rhs[src_i++];
-                tmp -= rhs[src_i++];
-                r.v[dst_i++] = tmp;
-            }
-            return r;
+        src_i = 0;
+        while (src_i != N) {
+            auto tmp = rhs[src_i++];
+            tmp -= rhs[src_i++];
+            r.v[dst_i++] = tmp;
         }
+        return r;
     }
 
     [[nodiscard]] friend constexpr numeric_array operator-(numeric_array const &lhs, numeric_array const &rhs) noexcept
     {
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x8 && has_avx) {
+                return numeric_array{f32x8_avx_sub(lhs.v, rhs.v)};
+            } else if constexpr (is_f64x4 && has_avx) {
+                return numeric_array{f64x4_avx_sub(lhs.v, rhs.v)};
+            } else if constexpr (is_i32x8 && has_avx2) {
+                return numeric_array{i32x8_avx2_sub(lhs.v, rhs.v)};
+            } else if constexpr (is_f32x4 && has_neon) {
+                return numeric_array{f32x4_neon_sub(lhs.v, rhs.v)};
+            }
+        }
+
         auto r = numeric_array{};
         for (ssize_t i = 0; i != N; ++i) {
             r.v[i] = lhs.v[i] - rhs.v[i];
@@ -969,6 +1166,18 @@ public:
 
     [[nodiscard]] friend constexpr numeric_array operator*(numeric_array const &lhs, numeric_array const &rhs) noexcept
     {
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x8 && has_avx) {
+                return numeric_array{f32x8_avx_mul(lhs.v, rhs.v)};
+            } else if constexpr (is_f64x4 && has_avx) {
+                return numeric_array{f64x4_avx_mul(lhs.v, rhs.v)};
+            } else if constexpr (is_i32x8 && has_avx2) {
+                return numeric_array{i32x8_avx2_mul(lhs.v, rhs.v)};
+            } else if constexpr (is_f32x4 && has_neon) {
+                return numeric_array{f32x4_neon_mul(lhs.v, rhs.v)};
+            }
+        }
+
         auto r = numeric_array{};
         for (ssize_t i = 0; i != N; ++i) {
             r.v[i] = lhs.v[i] * rhs.v[i];
@@ -996,6 +1205,16 @@ public:
 
     [[nodiscard]] friend constexpr numeric_array operator/(numeric_array const &lhs, numeric_array const &rhs) noexcept
     {
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x8 && has_avx) {
+                return numeric_array{f32x8_avx_div(lhs.v, rhs.v)};
+            } else if constexpr (is_f64x4 && has_avx) {
+                return numeric_array{f64x4_avx_div(lhs.v, rhs.v)};
+            } else if constexpr (is_f32x4 && has_neon) {
+                return numeric_array{f32x4_neon_div(lhs.v, rhs.v)};
+            }
+        }
+
         auto r = numeric_array{};
         for (ssize_t i = 0; i != N; ++i) {
             r.v[i] = lhs.v[i] / rhs.v[i];
@@ -1050,6 +1269,18 @@ public:
 
     [[nodiscard]] friend constexpr numeric_array min(numeric_array const &lhs, numeric_array const &rhs) noexcept
     {
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x8 && has_avx) {
+                return numeric_array{f32x8_avx_min(lhs.v, rhs.v)};
+            } else if constexpr (is_f64x4 && has_avx) {
+                return numeric_array{f64x4_avx_min(lhs.v, rhs.v)};
+            } else if constexpr (is_i32x8 && has_avx2) {
+                return numeric_array{i32x8_avx2_min(lhs.v, rhs.v)};
+            } else if constexpr (is_f32x4 && has_neon) {
+                return numeric_array{f32x4_neon_min(lhs.v, rhs.v)};
+            }
+        }
+
         auto r = numeric_array{};
         for (ssize_t i = 0; i != N; ++i) {
             // std::min() causes vectorization failure with msvc
@@ -1060,6 +1291,18 @@ public:
 
     [[nodiscard]] friend constexpr numeric_array max(numeric_array const &lhs, numeric_array const &rhs) noexcept
     {
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x8 && has_avx) {
+                return numeric_array{f32x8_avx_max(lhs.v, rhs.v)};
+            } else if constexpr (is_f64x4 && has_avx) {
+                return numeric_array{f64x4_avx_max(lhs.v, rhs.v)};
+            } else if constexpr (is_i32x8 && has_avx2) {
+                return numeric_array{i32x8_avx2_max(lhs.v, rhs.v)};
+            } else if constexpr (is_f32x4 && has_neon) {
+                return numeric_array{f32x4_neon_max(lhs.v, rhs.v)};
+            }
+        }
+
         auto r = numeric_array{};
         for (ssize_t i = 0; i != N; ++i) {
             // std::max() causes vectorization failure with msvc
@@ -1099,12 +1342,13 @@ public:
     [[nodiscard]] friend constexpr float cross_2D(numeric_array const &lhs, numeric_array const &rhs) noexcept
         requires(N >= 2)
     {
-        if (is_f32x4 && has_sse && !std::is_constant_evaluated()) {
-            return f32x4_sse_viktor_cross(lhs.v, rhs.v);
-
-        } else {
-            return lhs.x() * rhs.y() - lhs.y() * rhs.x();
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x4 && has_sse) {
+                return f32x4_sse_viktor_cross(lhs.v, rhs.v);
+            }
         }
+
+        return lhs.x() * rhs.y() - lhs.y() * rhs.x();
     }
 
     // x=a.y*b.z - a.z*b.y
@@ -1174,16 +1418,17 @@ public:
 
         auto r = std::array<numeric_array, N>{};
 
-        if (is_f32x4 && has_sse && !std::is_constant_evaluated()) {
-            auto tmp = f32x4_sse_transpose(columns.v...);
-            for (int i = 0; i != N; ++i) {
-                r[i] = numeric_array{tmp[i]};
+        if (!std::is_constant_evaluated()) {
+            if constexpr (is_f32x4 && has_sse) {
+                auto tmp = f32x4_sse_transpose(columns.v...);
+                for (int i = 0; i != N; ++i) {
+                    r[i] = numeric_array{tmp[i]};
+                }
             }
-
-        } else {
-            transpose_detail<0, Columns...>(columns..., r);
         }
 
+        transpose_detail<0, Columns...>(columns..., r);
+
         return r;
     }
 
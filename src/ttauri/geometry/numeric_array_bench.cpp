@@ -0,0 +1,99 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/geometry/numeric_array.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace std;
+using namespace tt;
+
+/** Vectors with varying values, so that the compiler can not fold the kernels into constants.
+ */
+[[nodiscard]] static std::vector<f32x4> make_numeric_array_bench_vectors() noexcept
+{
+    auto r = std::vector<f32x4>{};
+    r.reserve(1024);
+    for (int i = 0; i != 1024; ++i) {
+        ttlet f = static_cast<float>(i);
+        r.push_back(f32x4{f + 1.0f, f * 0.5f + 1.0f, f * 0.25f + 1.0f, 0.0f});
+    }
+    return r;
+}
+
+static void f32x4_dot(benchmark::State &state)
+{
+    ttlet vectors = make_numeric_array_bench_vectors();
+
+    for (auto _ : state) {
+        auto sum = 0.0f;
+        for (ttlet &v : vectors) {
+            sum += dot<0b0111>(v, v);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * std::ssize(vectors));
+}
+BENCHMARK(f32x4_dot);
+
+static void f32x4_hypot(benchmark::State &state)
+{
+    ttlet vectors = make_numeric_array_bench_vectors();
+
+    for (auto _ : state) {
+        auto sum = 0.0f;
+        for (ttlet &v : vectors) {
+            sum += hypot<0b0111>(v);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * std::ssize(vectors));
+}
+BENCHMARK(f32x4_hypot);
+
+static void f32x4_normalize(benchmark::State &state)
+{
+    auto vectors = make_numeric_array_bench_vectors();
+
+    for (auto _ : state) {
+        for (auto &v : vectors) {
+            v = normalize<0b0111>(v);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * std::ssize(vectors));
+}
+BENCHMARK(f32x4_normalize);
+
+static void f32x4_rcp_sqrt(benchmark::State &state)
+{
+    auto vectors = make_numeric_array_bench_vectors();
+
+    for (auto _ : state) {
+        for (auto &v : vectors) {
+            v = rcp_sqrt(v + f32x4::broadcast(1.0f));
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * std::ssize(vectors));
+}
+BENCHMARK(f32x4_rcp_sqrt);
+
+static void f32x4_composit(benchmark::State &state)
+{
+    auto under = make_numeric_array_bench_vectors();
+    auto over = std::vector<f32x4>{};
+    for (ttlet &v : under) {
+        over.push_back(f32x4{v.x() * 0.001f, v.y() * 0.001f, v.z() * 0.001f, 0.5f});
+    }
+
+    for (auto _ : state) {
+        for (size_t i = 0; i != under.size(); ++i) {
+            under[i] = composit(under[i], over[i]);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * std::ssize(under));
+}
+BENCHMARK(f32x4_composit);
@@ -54,6 +54,57 @@ TEST(numeric_array, Arithmatic)
     }
 }
 
+TEST(numeric_array, ArithmaticF32x8)
+{
+    ttlet tmp1 = f32x8{9.0f, 6.0f, 4.0f, 14.0f, 1.0f, -2.5f, 0.0f, 100.0f};
+    ttlet tmp2 = f32x8{3.0f, -2.0f, 8.0f, 7.0f, 4.0f, 2.5f, 1.0f, 10.0f};
+
+    ASSERT_EQ(tmp1 + tmp2, f32x8(12.0f, 4.0f, 12.0f, 21.0f, 5.0f, 0.0f, 1.0f, 110.0f));
+    ASSERT_EQ(tmp1 - tmp2, f32x8(6.0f, 8.0f, -4.0f, 7.0f, -3.0f, -5.0f, -1.0f, 90.0f));
+    ASSERT_EQ(tmp1 * tmp2, f32x8(27.0f, -12.0f, 32.0f, 98.0f, 4.0f, -6.25f, 0.0f, 1000.0f));
+    ASSERT_EQ(tmp1 / tmp2, f32x8(3.0f, -3.0f, 0.5f, 2.0f, 0.25f, -1.0f, 0.0f, 10.0f));
+    ASSERT_EQ(min(tmp1, tmp2), f32x8(3.0f, -2.0f, 4.0f, 7.0f, 1.0f, -2.5f, 0.0f, 10.0f));
+    ASSERT_EQ(max(tmp1, tmp2), f32x8(9.0f, 6.0f, 8.0f, 14.0f, 4.0f, 2.5f, 1.0f, 100.0f));
+    ASSERT_EQ(floor(tmp1 / 4.0f), f32x8(2.0f, 1.0f, 1.0f, 3.0f, 0.0f, -1.0f, 0.0f, 25.0f));
+    ASSERT_EQ(ceil(tmp1 / 4.0f), f32x8(3.0f, 2.0f, 1.0f, 4.0f, 1.0f, -0.0f, 0.0f, 25.0f));
+    ASSERT_EQ(sqrt(f32x8{1.0f, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f, 49.0f, 64.0f}), f32x8(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f));
+    ASSERT_EQ(eq(tmp1, tmp1), 0xff);
+    ASSERT_EQ(lt(tmp1, tmp2), 0b0111'0100);
+    ASSERT_EQ(ge(tmp1, tmp2), 0b1000'1011);
+    ASSERT_FALSE(tmp1 == tmp2);
+}
+
+TEST(numeric_array, ArithmaticF64x4)
+{
+    ttlet tmp1 = f64x4{9.0, 6.0, 4.0, 14.0};
+    ttlet tmp2 = f64x4{3.0, -2.0, 8.0, 7.0};
+
+    ASSERT_EQ(tmp1 + tmp2, f64x4(12.0, 4.0, 12.0, 21.0));
+    ASSERT_EQ(tmp1 - tmp2, f64x4(6.0, 8.0, -4.0, 7.0));
+    ASSERT_EQ(tmp1 * tmp2, f64x4(27.0, -12.0, 32.0, 98.0));
+    ASSERT_EQ(tmp1 / tmp2, f64x4(3.0, -3.0, 0.5, 2.0));
+    ASSERT_EQ(min(tmp1, tmp2), f64x4(3.0, -2.0, 4.0, 7.0));
+    ASSERT_EQ(max(tmp1, tmp2), f64x4(9.0, 6.0, 8.0, 14.0));
+    ASSERT_EQ(round(f64x4{1.25, -1.75, 2.5, 3.5}), f64x4(1.0, -2.0, 2.0, 4.0));
+    ASSERT_EQ(gt(tmp1, tmp2), 0b1011);
+    ASSERT_EQ(ne(tmp1, tmp2), 0b1111);
+}
+
+TEST(numeric_array, ArithmaticI32x8)
+{
+    ttlet tmp1 = i32x8{9, 6, 4, 14, 1, -2, 0, 100};
+    ttlet tmp2 = i32x8{3, -2, 8, 7, 4, 2, 1, 10};
+
+    ASSERT_EQ(tmp1 + tmp2, i32x8(12, 4, 12, 21, 5, 0, 1, 110));
+    ASSERT_EQ(tmp1 - tmp2, i32x8(6, 8, -4, 7, -3, -4, -1, 90));
+    ASSERT_EQ(tmp1 * tmp2, i32x8(27, -12, 32, 98, 4, -4, 0, 1000));
+    ASSERT_EQ(min(tmp1, tmp2), i32x8(3, -2, 4, 7, 1, -2, 0, 10));
+    ASSERT_EQ(max(tmp1, tmp2), i32x8(9, 6, 8, 14, 4, 2, 1, 100));
+    ASSERT_EQ(abs(tmp1 - tmp2), i32x8(6, 8, 4, 7, 3, 4, 1, 90));
+    ASSERT_EQ(eq(tmp1, tmp1), 0xff);
+    ASSERT_EQ(gt(tmp1, tmp2), 0b1000'1011);
+}
+
 TEST(numeric_array, Length)
 {
     ttlet tmp = f32x4(2.0f, 3.0f, 4.0f, 0.0f);
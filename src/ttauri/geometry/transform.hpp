@@ -10,6 +10,8 @@
 #include "rotate.hpp"
 #include "scale.hpp"
 #include <type_traits>
+#include <span>
+#include <algorithm>
 
 namespace tt {
 namespace geo {
@@ -82,6 +84,97 @@ constexpr bool transform_v = transform<T>::value;
 template<typename T>
 concept transformer = transform_v<T>;
 
+/** Transform a span of points.
+ *
+ * The transform is copied before the loop, so that writing the points does not force the compiler
+ * to reload the transform, and four points are transformed per iteration.
+ *
+ * @param lhs The transform to apply.
+ * @param src The points to transform.
+ * @param dst The transformed points, must be the same size as src and may be the same span.
+ */
+template<transformer T, int D, int E>
+constexpr void transform_points(T const &lhs, std::span<point<D> const> src, std::span<point<E>> dst) noexcept
+{
+    tt_axiom(src.size() == dst.size());
+
+    ttlet transform = lhs;
+    ttlet size = src.size();
+    ttlet size4 = size - size % 4;
+
+    auto i = 0_uz;
+    for (; i != size4; i += 4) {
+        ttlet p0 = transform * src[i];
+        ttlet p1 = transform * src[i + 1];
+        ttlet p2 = transform * src[i + 2];
+        ttlet p3 = transform * src[i + 3];
+        dst[i] = point<E>{p0};
+        dst[i + 1] = point<E>{p1};
+        dst[i + 2] = point<E>{p2};
+        dst[i + 3] = point<E>{p3};
+    }
+    for (; i != size; ++i) {
+        dst[i] = point<E>{transform * src[i]};
+    }
+}
+
+/** Transform a span of points in place.
+ */
+template<transformer T, int D>
+constexpr void transform_points(T const &lhs, std::span<point<D>> points) noexcept
+{
+    transform_points(lhs, std::span<point<D> const>{points}, points);
+}
+
+/** Transform 2D points stored as separate x and y coordinates.
+ *
+ * Eight points are transformed per iteration using the affine part of the matrix:
+ * `x' = c0r0 * x + c1r0 * y + c3r0` and `y' = c0r1 * x + c1r1 * y + c3r1`.
+ *
+ * @param lhs The transformation matrix, the z-row and z-column are ignored.
+ * @param x The x-coordinates of the points, transformed in place.
+ * @param y The y-coordinates of the points, transformed in place; must be the same size as x.
+ */
+template<int D>
+void transform_points(matrix<D> const &lhs, std::span<float> x, std::span<float> y) noexcept
+{
+    tt_axiom(x.size() == y.size());
+
+    ttlet col0 = get<0>(lhs);
+    ttlet col1 = get<1>(lhs);
+    ttlet col3 = get<3>(lhs);
+
+    ttlet c0r0 = f32x8::broadcast(col0.x());
+    ttlet c0r1 = f32x8::broadcast(col0.y());
+    ttlet c1r0 = f32x8::broadcast(col1.x());
+    ttlet c1r1 = f32x8::broadcast(col1.y());
+    ttlet c3r0 = f32x8::broadcast(col3.x());
+    ttlet c3r1 = f32x8::broadcast(col3.y());
+
+    ttlet size = x.size();
+    ttlet size8 = size - size % 8;
+
+    auto i = 0_uz;
+    for (; i != size8; i += 8) {
+        auto x8 = f32x8{};
+        auto y8 = f32x8{};
+        std::copy_n(x.data() + i, 8, x8.begin());
+        std::copy_n(y.data() + i, 8, y8.begin());
+
+        ttlet new_x8 = c0r0 * x8 + c1r0 * y8 + c3r0;
+        ttlet new_y8 = c0r1 * x8 + c1r1 * y8 + c3r1;
+
+        std::copy_n(new_x8.begin(), 8, x.data() + i);
+        std::copy_n(new_y8.begin(), 8, y.data() + i);
+    }
+    for (; i != size; ++i) {
+        ttlet x1 = x[i];
+        ttlet y1 = y[i];
+        x[i] = col0.x() * x1 + col1.x() * y1 + col3.x();
+        y[i] = col0.y() * x1 + col1.y() * y1 + col3.y();
+    }
+}
+
 } // namespace geo
 
 } // namespace tt
\ No newline at end of file
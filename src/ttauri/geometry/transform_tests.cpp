@@ -91,3 +91,37 @@ TEST(geometry, translate_scale_point)
 }
 
 
+
+TEST(geometry, transform_points)
+{
+    ttlet M = translate<2>(-3, -4) * scale<2>(4.0, 6.0);
+
+    auto points = std::vector<point<2>>{};
+    for (auto i = 0; i != 11; ++i) {
+        points.emplace_back(static_cast<float>(i), static_cast<float>(i * 2));
+    }
+    ttlet original = points;
+
+    transform_points(M, std::span{points});
+    for (size_t i = 0; i != points.size(); ++i) {
+        ASSERT_TRUE(points[i] == M * original[i]);
+    }
+}
+
+TEST(geometry, transform_points_soa)
+{
+    ttlet M = tt::matrix3{translate<2>(-3, -4) * scale<2>(4.0, 6.0)};
+
+    auto x = std::vector<float>{};
+    auto y = std::vector<float>{};
+    for (auto i = 0; i != 19; ++i) {
+        x.push_back(static_cast<float>(i));
+        y.push_back(static_cast<float>(i * 2));
+    }
+
+    transform_points(M, std::span{x}, std::span{y});
+    for (size_t i = 0; i != x.size(); ++i) {
+        ASSERT_EQ(x[i], static_cast<float>(i) * 4.0f - 3.0f);
+        ASSERT_EQ(y[i], static_cast<float>(i * 2) * 6.0f - 4.0f);
+    }
+}
@@ -10,6 +10,7 @@
 #include <string>
 #include <string_view>
 #include <ostream>
+#include <bitset>
 
 namespace tt {
 
@@ -305,119 +306,6 @@ enum class glob_match_result_t {
     Match
 };
 
-inline glob_match_result_t matchGlob(glob_token_const_iterator index, glob_token_const_iterator end, std::string_view str)
-{
-    if (index == end) {
-        return (str.size() == 0) ?
-            glob_match_result_t::Match :
-            glob_match_result_t::No;
-
-    } else if (str.size() == 0) {
-        switch (index->type) {
-        case glob_token_type_t::Separator:
-            return glob_match_result_t::Partial;
-        case glob_token_type_t::AnyDirectory:
-            return glob_match_result_t::Partial;
-        case glob_token_type_t::AnyString:
-            return matchGlob(index + 1, end, str);
-        default:
-            return glob_match_result_t::No;
-        }
-    }
-
-#define MATCH_GLOB_RECURSE(out, next, end, str)\
-    switch (ttlet tmp = matchGlob(next, end, str)) {\
-    case glob_match_result_t::No: break;\
-    case glob_match_result_t::Match: return tmp;\
-    case glob_match_result_t::Partial: out = tmp; break;\
-    default: tt_no_default();\
-    }
-
-    // result may be assigned Partial by MATCH_GLOB_RECURSE.
-    auto result = glob_match_result_t::No;
-    bool found_slash = false;
-    ttlet next_index = index + 1;
-
-    switch (index->type) {
-    case glob_token_type_t::String:
-        if (str.starts_with(index->value)) {
-            MATCH_GLOB_RECURSE(result, next_index, end, str.substr(index->value.size()));
-        }
-        return result;
-
-    case glob_token_type_t::StringList:
-        for (ttlet &value: index->values) {
-            if (str.starts_with(value)) {
-                MATCH_GLOB_RECURSE(result, next_index, end, str.substr(value.size()));
-            }
-        }
-        return result;
-
-    case glob_token_type_t::CharacterList:
-        if (index->value.find(str.front()) != std::string::npos) {
-            MATCH_GLOB_RECURSE(result, next_index, end, str.substr(1));
-        }
-        return result;
-
-    case glob_token_type_t::InverseCharacterList:
-        if (index->value.find(str.front()) == std::string::npos) {
-            MATCH_GLOB_RECURSE(result, next_index, end, str.substr(1));
-        }
-        return result;
-
-    case glob_token_type_t::Separator:
-        if (str.front() == '/') {
-            return matchGlob(next_index, end, str.substr(1));
-        } else {
-            return glob_match_result_t::No;
-        }
-
-    case glob_token_type_t::AnyCharacter:
-        if (str.front() != '/') {
-            return matchGlob(next_index, end, str.substr(1));
-        } else {
-            return glob_match_result_t::No;
-        }
-
-    case glob_token_type_t::AnyString:
-        // Loop through each character in the string, including the end.
-        for (size_t i = 0; i <= str.size(); i++) {
-            MATCH_GLOB_RECURSE(result, next_index, end, str.substr(i));
-
-            // Don't continue beyond a slash.
-            if (i < str.size() && str[i] == '/') {
-                break;
-            }
-        }
-        return result;
-
-    case glob_token_type_t::AnyDirectory:
-        // Recurse after each slash.
-        found_slash = false;
-        for (size_t i = 0; i <= str.size(); i++) {
-            if (i == str.size() || str[i] == '/') {
-                MATCH_GLOB_RECURSE(result, next_index, end, str.substr(i));
-            }
-            //found_slash = i < str.size() && ';
-        }
-        return result;
-
-    default:
-        tt_no_default();
-    }
-#undef MATCH_GLOB_RECURSE
-}
-
-inline glob_match_result_t matchGlob(glob_token_list_t const &glob, std::string_view str)
-{
-    return matchGlob(glob.begin(), glob.end(), str);
-}
-
-inline glob_match_result_t matchGlob(std::string_view glob, std::string_view str)
-{
-    return matchGlob(parseGlob(glob), str);
-}
-
 inline std::string basePathOfGlob(glob_token_const_iterator first, glob_token_const_iterator last) {
     if (first == last) {
         return "";
@@ -428,13 +316,17 @@ inline std::string basePathOfGlob(glob_token_const_iterator first, glob_token_co
         return x.type == glob_token_type_t::String || x.type == glob_token_type_t::Separator;
     });
 
-    if (endOfBase != last) {
+    // The AnyDirectory place holder includes the separator in front of it.
+    if (endOfBase != last and endOfBase != first and endOfBase->type != glob_token_type_t::AnyDirectory) {
         // Backtrack until the last separator, and remove it.
         // Except when we included everything in the first loop because in that case there
         // are no placeholders at all and we want to include the filename.
-        endOfBase = rfind_if(first, endOfBase, [](ttlet &x) {
+        ttlet separator = rfind_if(first, endOfBase, [](ttlet &x) {
             return x.type == glob_token_type_t::Separator;
         });
+
+        // Without a separator the place holder is part of the first name; there is no base path.
+        endOfBase = separator != endOfBase ? separator : first;
     }
 
     // Add back the leading slash.
@@ -468,4 +360,223 @@ inline std::string basePathOfGlob(std::string_view glob)
     return basePathOfGlob(parseGlob(glob));
 }
 
+/** A glob pattern compiled into a non-deterministic finite automaton.
+ *
+ * The pattern is parsed and compiled once, after which a path is matched in a single pass
+ * over its characters, without backtracking. The state of the automaton can be kept between
+ * calls, so that the paths in a directory tree are matched incrementally: the state after
+ * the path of a directory is advanced with only the name of each entry in that directory.
+ */
+class glob_pattern {
+public:
+    /** The set of active nodes of the automaton.
+     */
+    using state_type = std::vector<bool>;
+
+    glob_pattern(std::string_view glob) : glob_pattern(parseGlob(glob)) {}
+
+    glob_pattern(glob_token_list_t const &tokens) : _base_path(basePathOfGlob(tokens))
+    {
+        for (ttlet &token : tokens) {
+            compile(token);
+        }
+        // The accepting node.
+        _nodes.emplace_back();
+    }
+
+    /** The literal path before the first place holder.
+     * Only paths starting with the base path can match.
+     */
+    [[nodiscard]] std::string const &base_path() const noexcept
+    {
+        return _base_path;
+    }
+
+    /** The state before any characters are matched.
+     */
+    [[nodiscard]] state_type start() const noexcept
+    {
+        auto r = state_type(_nodes.size(), false);
+        add(r, 0);
+        return r;
+    }
+
+    /** Advance the state of the automaton with the characters of str.
+     * @return The new state, where no node is active when the string can not match anymore.
+     */
+    [[nodiscard]] state_type advance(state_type state, std::string_view str) const noexcept
+    {
+        auto next = state_type(_nodes.size(), false);
+        for (ttlet c : str) {
+            auto active = false;
+            std::fill(next.begin(), next.end(), false);
+            for (size_t i = 0; i != _nodes.size(); ++i) {
+                if (state[i] and _nodes[i].characters[static_cast<uint8_t>(c)]) {
+                    add(next, _nodes[i].next);
+                    active = true;
+                }
+            }
+            std::swap(state, next);
+
+            if (not active) {
+                break;
+            }
+        }
+        return state;
+    }
+
+    /** The result of matching, for the string that brought the automaton in this state.
+     * @return Match if the string matches, Partial if a path starting with the string followed by a
+     *         slash may match, otherwise No.
+     */
+    [[nodiscard]] glob_match_result_t result(state_type const &state) const noexcept
+    {
+        if (state.back()) {
+            return glob_match_result_t::Match;
+        }
+
+        for (size_t i = 0; i != _nodes.size(); ++i) {
+            if (state[i] and _nodes[i].partial) {
+                return glob_match_result_t::Partial;
+            }
+        }
+        return glob_match_result_t::No;
+    }
+
+    /** Match a path.
+     */
+    [[nodiscard]] glob_match_result_t match(std::string_view str) const noexcept
+    {
+        return result(advance(start(), str));
+    }
+
+private:
+    struct node_type {
+        /** The characters which move the automaton from this node to `next`.
+         */
+        std::bitset<256> characters;
+        size_t next = 0;
+
+        /** The nodes which are active as well when this node is active.
+         */
+        std::vector<size_t> epsilon;
+
+        /** The string may be extended with a slash to continue matching.
+         */
+        bool partial = false;
+    };
+
+    std::vector<node_type> _nodes;
+    std::string _base_path;
+
+    void add(state_type &state, size_t index) const noexcept
+    {
+        if (not state[index]) {
+            state[index] = true;
+            for (ttlet epsilon : _nodes[index].epsilon) {
+                add(state, epsilon);
+            }
+        }
+    }
+
+    /** Add a node which matches one of the characters.
+     */
+    void add_node(std::bitset<256> characters, bool partial = false) noexcept
+    {
+        auto &node = _nodes.emplace_back();
+        node.characters = characters;
+        node.next = _nodes.size();
+        node.partial = partial;
+    }
+
+    [[nodiscard]] static std::bitset<256> make_characters(std::string_view str) noexcept
+    {
+        auto r = std::bitset<256>{};
+        for (ttlet c : str) {
+            r.set(static_cast<uint8_t>(c));
+        }
+        return r;
+    }
+
+    void compile(glob_token_t const &token) noexcept
+    {
+        ttlet slash = make_characters("/");
+
+        switch (token.type) {
+        case glob_token_type_t::String:
+            for (ttlet c : token.value) {
+                add_node(make_characters(std::string_view{&c, 1}));
+            }
+            break;
+
+        case glob_token_type_t::StringList: {
+            // A node which activates the start of each string, each string continues at the end node.
+            ttlet split = _nodes.size();
+            _nodes.emplace_back();
+
+            auto end = split + 1;
+            for (ttlet &value : token.values) {
+                end += value.size();
+            }
+
+            for (ttlet &value : token.values) {
+                if (value.empty()) {
+                    _nodes[split].epsilon.push_back(end);
+                } else {
+                    _nodes[split].epsilon.push_back(_nodes.size());
+                    for (ttlet c : value) {
+                        add_node(make_characters(std::string_view{&c, 1}));
+                    }
+                    _nodes.back().next = end;
+                }
+            }
+        } break;
+
+        case glob_token_type_t::CharacterList: add_node(make_characters(token.value)); break;
+
+        case glob_token_type_t::InverseCharacterList: add_node(~make_characters(token.value)); break;
+
+        case glob_token_type_t::Separator: add_node(slash, true); break;
+
+        case glob_token_type_t::AnyCharacter: add_node(~slash); break;
+
+        case glob_token_type_t::AnyString: {
+            // Loops on any character except the slash.
+            add_node(~slash);
+            auto &node = _nodes.back();
+            node.next = _nodes.size() - 1;
+            node.epsilon.push_back(_nodes.size());
+        } break;
+
+        case glob_token_type_t::AnyDirectory: {
+            // Either nothing, or a slash followed by any characters including slashes.
+            add_node(slash, true);
+            _nodes.back().epsilon.push_back(_nodes.size() + 1);
+
+            add_node(std::bitset<256>{}.set(), true);
+            auto &node = _nodes.back();
+            node.next = _nodes.size() - 1;
+            node.epsilon.push_back(_nodes.size());
+        } break;
+
+        default: tt_no_default();
+        }
+    }
+};
+
+inline glob_match_result_t matchGlob(glob_pattern const &glob, std::string_view str) noexcept
+{
+    return glob.match(str);
+}
+
+inline glob_match_result_t matchGlob(glob_token_list_t const &glob, std::string_view str)
+{
+    return glob_pattern{glob}.match(str);
+}
+
+inline glob_match_result_t matchGlob(std::string_view glob, std::string_view str)
+{
+    return glob_pattern{glob}.match(str);
+}
+
 }
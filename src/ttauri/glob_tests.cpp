@@ -457,3 +457,32 @@ TEST(Glob, BasePath) {
     ASSERT_EQ(basePathOfGlob("/foo*"), "/");
     ASSERT_EQ(basePathOfGlob("/*"), "/");
 }
+
+TEST(Glob, MatchIncremental) {
+    ttlet glob = glob_pattern("foo/**/ba[rz]/*.ttf");
+    ASSERT_EQ(glob.base_path(), "foo");
+
+    ttlet foo = glob.advance(glob.start(), "foo");
+    ASSERT_EQ(glob.result(foo), glob_match_result_t::Partial);
+
+    ttlet foo_a = glob.advance(foo, "/a");
+    ASSERT_EQ(glob.result(foo_a), glob_match_result_t::Partial);
+
+    ttlet foo_a_bar = glob.advance(foo_a, "/bar");
+    ASSERT_EQ(glob.result(foo_a_bar), glob_match_result_t::Partial);
+    ASSERT_EQ(glob.result(glob.advance(foo_a_bar, "/x.ttf")), glob_match_result_t::Match);
+    // The "**" may still match more directories.
+    ASSERT_EQ(glob.result(glob.advance(foo_a_bar, "/x.otf")), glob_match_result_t::Partial);
+
+    ASSERT_EQ(glob.result(glob.advance(glob.start(), "fox")), glob_match_result_t::No);
+    ASSERT_EQ(glob.match("foo/baz/y.ttf"), glob_match_result_t::Match);
+
+    ttlet flat = glob_pattern("foo/*.ttf");
+    ASSERT_EQ(flat.match("foo/x.otf"), glob_match_result_t::No);
+    ASSERT_EQ(flat.match("foo/bar"), glob_match_result_t::No);
+}
+
+TEST(Glob, MatchManyStars) {
+    // A backtracking matcher takes exponential time for this pattern.
+    ASSERT_EQ(matchGlob("*a*a*a*a*a*a*a*a*b", std::string(100, 'a')), glob_match_result_t::No);
+}
@@ -507,7 +507,7 @@ void composit(pixel_map<sfloat_rgba16>& dst, color color, graphic_path const &pa
     tt_assert(!path.hasLayers());
     tt_assert(!path.isContourOpen());
 
-    auto mask = pixel_map<uint8_t>(dst.width(), dst.height());
+    auto mask = pixel_map<uint8_t>(dst.width(), dst.height(), pixel_map_pool());
     fill(mask);
 
     ttlet curves = path.getBeziers();
@@ -219,13 +219,12 @@ struct graphic_path {
     /** Convert path to stroke-path.
      *
      * This function will create contours that are offset from the original path
-     * which creates a stroke. The path will first be subdivided until the curves
-     * are mostly flat, then the curves are converted into lines and offset, then
-     * the lines are connected to each other.
+     * which creates a stroke. The curves of the path are first flattened into
+     * lines, then the lines are offset and connected to each other.
      *
      * \param strokeWidth width of the stroke.
      * \param lineJoinStyle the style of how outside corners of a stroke are drawn.
-     * \param tolerance Tolerance of how flat the curves in the path need to be.
+     * \param tolerance The maximum distance between a curve and the lines it is flattened into.
      */
     [[nodiscard]] graphic_path toStroke(
         float strokeWidth = 1.0f,
@@ -245,9 +244,12 @@ struct graphic_path {
 
     friend graphic_path operator*(geo::transformer auto const &lhs, graphic_path const &rhs) noexcept
     {
+        // Copy the transform so that writing the points does not cause it to be reloaded.
+        ttlet transform = lhs;
+
         auto rhs_ = rhs;
         for (auto &&point : rhs_.points) {
-            point = lhs * point;
+            point.p = transform * point.p;
         }
         return rhs_;
     }
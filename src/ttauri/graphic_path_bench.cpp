@@ -0,0 +1,58 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/graphic_path.hpp"
+#include "ttauri/pixel_map.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace std;
+using namespace tt;
+
+/** A glyph-like shape of size x size pixels; a rounded outline with a hole.
+ */
+[[nodiscard]] static graphic_path make_graphic_path_bench_path(float size) noexcept
+{
+    auto path = graphic_path();
+    path.moveTo(point2{0.1f * size, 0.1f * size});
+    path.lineTo(point2{0.9f * size, 0.1f * size});
+    path.quadraticCurveTo(point2{0.9f * size, 0.5f * size}, point2{0.5f * size, 0.5f * size});
+    path.cubicCurveTo(point2{0.9f * size, 0.6f * size}, point2{0.9f * size, 0.9f * size}, point2{0.5f * size, 0.9f * size});
+    path.lineTo(point2{0.1f * size, 0.9f * size});
+    path.closeContour();
+
+    path.moveTo(point2{0.3f * size, 0.3f * size});
+    path.lineTo(point2{0.3f * size, 0.4f * size});
+    path.lineTo(point2{0.6f * size, 0.4f * size});
+    path.lineTo(point2{0.6f * size, 0.3f * size});
+    path.closeContour();
+    return path;
+}
+
+static void graphic_path_fill_sdf(benchmark::State &state)
+{
+    ttlet size = narrow_cast<ssize_t>(state.range(0));
+    ttlet path = make_graphic_path_bench_path(static_cast<float>(size));
+    auto image = pixel_map<sdf_r8>(size, size);
+
+    for (auto _ : state) {
+        fill(image, path);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(graphic_path_fill_sdf)->Arg(32)->Arg(64);
+
+static void graphic_path_composit(benchmark::State &state)
+{
+    ttlet size = narrow_cast<ssize_t>(state.range(0));
+    ttlet path = make_graphic_path_bench_path(static_cast<float>(size));
+    auto image = pixel_map<sfloat_rgba16>(size, size);
+
+    for (auto _ : state) {
+        composit(image, color{1.0f, 0.5f, 0.25f}, path);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(graphic_path_composit)->Arg(64)->Arg(256);
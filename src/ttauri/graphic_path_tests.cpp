@@ -4,9 +4,11 @@
 
 #include "ttauri/graphic_path.hpp"
 #include "ttauri/bezier_curve.hpp"
+#include "ttauri/pixel_map.hpp"
 #include <gtest/gtest.h>
 #include <iostream>
 #include <string>
+#include <chrono>
 
 using namespace std;
 using namespace tt;
@@ -43,3 +45,65 @@ TEST(grahpic_path, getbezier_pointsOfContour)
     ASSERT_EQ(points[2], bezier_point(point2( 2,2 ), bezier_point::Type::Anchor));
     ASSERT_EQ(points[3], bezier_point(point2( 1,2 ), bezier_point::Type::Anchor));
 }
+
+/** A path similar to a glyph, with an outer and inner contour of linear and quadratic curves.
+ */
+[[nodiscard]] static graphic_path make_sdf_test_path() noexcept
+{
+    auto path = graphic_path();
+    path.moveTo(point2{32.0f, 8.0f});
+    path.quadraticCurveTo(point2{56.0f, 8.0f}, point2{56.0f, 32.0f});
+    path.quadraticCurveTo(point2{56.0f, 56.0f}, point2{32.0f, 56.0f});
+    path.quadraticCurveTo(point2{8.0f, 56.0f}, point2{8.0f, 32.0f});
+    path.quadraticCurveTo(point2{8.0f, 8.0f}, point2{32.0f, 8.0f});
+    path.closeContour();
+
+    path.moveTo(point2{20.0f, 20.0f});
+    path.quadraticCurveTo(point2{32.0f, 12.0f}, point2{44.0f, 20.0f});
+    path.quadraticCurveTo(point2{52.0f, 32.0f}, point2{44.0f, 44.0f});
+    path.lineTo(point2{20.0f, 44.0f});
+    path.closeContour();
+    return path;
+}
+
+TEST(grahpic_path, fill_sdf_same_as_scalar)
+{
+    ttlet curves = make_sdf_test_path().getBeziers();
+
+    auto expected = pixel_map<sdf_r8>(64, 64);
+    fill_scalar(expected, curves);
+
+    auto result = pixel_map<sdf_r8>(64, 64);
+    fill(result, curves);
+
+    for (ssize_t y = 0; y != result.height(); ++y) {
+        for (ssize_t x = 0; x != result.width(); ++x) {
+            ASSERT_EQ(static_cast<float>(result[y][x]), static_cast<float>(expected[y][x])) << "x=" << x << " y=" << y;
+        }
+    }
+}
+
+TEST(grahpic_path, fill_sdf_benchmark)
+{
+    ttlet curves = make_sdf_test_path().getBeziers();
+    auto pixels = pixel_map<sdf_r8>(64, 64);
+
+    constexpr int nr_iterations = 20;
+
+    ttlet scalar_start = std::chrono::steady_clock::now();
+    for (int i = 0; i != nr_iterations; ++i) {
+        fill_scalar(pixels, curves);
+    }
+    ttlet scalar_duration = std::chrono::steady_clock::now() - scalar_start;
+
+    ttlet start = std::chrono::steady_clock::now();
+    for (int i = 0; i != nr_iterations; ++i) {
+        fill(pixels, curves);
+    }
+    ttlet duration = std::chrono::steady_clock::now() - start;
+
+    std::cout << "fill(pixel_map<sdf_r8>) scalar: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(scalar_duration).count() / nr_iterations
+              << " us, pruned: " << std::chrono::duration_cast<std::chrono::microseconds>(duration).count() / nr_iterations
+              << " us per glyph" << std::endl;
+}
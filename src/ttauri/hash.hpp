@@ -1,4 +1,4 @@
-// Copyright Take Vos 2020.
+// Copyright Take Vos 2020-2021.
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
@@ -6,16 +6,25 @@
 
 
 #include "required.hpp"
+#include "os_detect.hpp"
+#if TT_PROCESSOR == TT_CPU_X64
 #include <emmintrin.h>
 #include <wmmintrin.h>
+#endif
 #include <utility>
 #include <array>
 #include <type_traits>
+#include <span>
+#include <string_view>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
 
 namespace tt {
 
 [[nodiscard]] inline size_t hash_mix_two(size_t hash1, size_t hash2) noexcept
 {
+#if TT_PROCESSOR == TT_CPU_X64
     ttlet round = _mm_set_epi64x(0x123456789abcdef0ULL, 0x0fedcba987654321ULL);
 
     auto hash = _mm_set_epi64x(hash1, hash2);
@@ -25,6 +34,111 @@ namespace tt {
     std::array<uint64_t,2> buffer;
     _mm_storeu_si64(buffer.data(), hash);
     return buffer[0];
+#else
+    return hash1 ^ (hash2 + 0x9e37'79b9'7f4a'7c15 + (hash1 << 6) + (hash1 >> 2));
+#endif
+}
+
+/** Hash a block of memory.
+ *
+ * On x64 the bytes are absorbed 16 at a time with a single AES round, alternating between two
+ * states so that two rounds are in flight at once; the last block overlaps the one before it
+ * instead of being padded. Afterwards both states are mixed with two more rounds and combined.
+ * On other processors 8 bytes at a time are mixed with a multiply.
+ *
+ * The hash is fast but not cryptographic, and is different between processor types.
+ *
+ * @param data A pointer to the first byte.
+ * @param size The number of bytes.
+ * @param seed A value to start the hash with, for example the hash of a previous block.
+ * @return The hash value.
+ */
+[[nodiscard]] inline size_t hash_bytes(void const *data, size_t size, size_t seed = 0) noexcept
+{
+    auto ptr = static_cast<std::byte const *>(data);
+
+#if TT_PROCESSOR == TT_CPU_X64
+    ttlet load = [](std::byte const *p) {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+    };
+
+    ttlet round = _mm_set_epi64x(0x123456789abcdef0ULL, 0x0fedcba987654321ULL);
+
+    // The size is part of the initial state, so that zero padding does not cause collisions.
+    auto a = _mm_xor_si128(_mm_set_epi64x(static_cast<int64_t>(size), static_cast<int64_t>(seed)), round);
+    auto b = _mm_xor_si128(_mm_set_epi64x(static_cast<int64_t>(seed), static_cast<int64_t>(size)), round);
+
+    auto remaining = size;
+    while (remaining > 32) {
+        a = _mm_aesenc_si128(a, load(ptr));
+        b = _mm_aesenc_si128(b, load(ptr + 16));
+        ptr += 32;
+        remaining -= 32;
+    }
+
+    if (size >= 16) {
+        if (remaining > 16) {
+            a = _mm_aesenc_si128(a, load(ptr));
+        }
+        b = _mm_aesenc_si128(b, load(ptr + remaining - 16));
+
+    } else if (size > 0) {
+        auto buffer = std::array<std::byte, 16>{};
+        std::memcpy(buffer.data(), ptr, size);
+        a = _mm_aesenc_si128(a, load(buffer.data()));
+    }
+
+    // The last block absorbed by each state passed through a single round only, in which a
+    // difference in a byte stays in its column. Two rounds for each state fully diffuse the
+    // differences before the states are combined, so that they can not cancel each other.
+    a = _mm_aesenc_si128(_mm_aesenc_si128(a, round), round);
+    b = _mm_aesenc_si128(_mm_aesenc_si128(b, round), round);
+    a = _mm_aesenc_si128(a, b);
+    a = _mm_aesenc_si128(a, round);
+    return static_cast<size_t>(_mm_cvtsi128_si64(a));
+
+#else
+    ttlet mix = [](uint64_t h, uint64_t word) {
+        h = (h ^ word) * 0xff51'afd7'ed55'8ccd;
+        return h ^ (h >> 32);
+    };
+
+    auto h = static_cast<uint64_t>(seed) ^ (static_cast<uint64_t>(size) * 0x9e37'79b9'7f4a'7c15);
+
+    auto remaining = size;
+    for (; remaining >= 8; remaining -= 8, ptr += 8) {
+        uint64_t word;
+        std::memcpy(&word, ptr, sizeof(word));
+        h = mix(h, word);
+    }
+
+    if (remaining > 0) {
+        uint64_t word = 0;
+        std::memcpy(&word, ptr, remaining);
+        h = mix(h, word);
+    }
+
+    h ^= h >> 33;
+    h *= 0xc4ce'b9fe'1a85'ec53;
+    h ^= h >> 33;
+    return static_cast<size_t>(h);
+#endif
+}
+
+/** Hash a span of bytes.
+ * @see hash_bytes(void const *, size_t, size_t)
+ */
+[[nodiscard]] inline size_t hash_bytes(std::span<std::byte const> bytes, size_t seed = 0) noexcept
+{
+    return hash_bytes(bytes.data(), bytes.size(), seed);
+}
+
+/** Hash the characters of a string.
+ * @see hash_bytes(void const *, size_t, size_t)
+ */
+[[nodiscard]] inline size_t hash_bytes(std::string_view str, size_t seed = 0) noexcept
+{
+    return hash_bytes(str.data(), str.size(), seed);
 }
 
 template<typename First, typename Second, typename... Args>
@@ -43,4 +157,4 @@ template<typename First, typename Second, typename... Args>
 }
 
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,60 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/hash.hpp"
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace tt;
+
+TEST(Hash, Equal)
+{
+    auto text = std::string{};
+    for (int i = 0; i != 100; ++i) {
+        ttlet copy = text;
+        ASSERT_EQ(hash_bytes(text), hash_bytes(copy));
+        ASSERT_EQ(hash_bytes(std::as_bytes(std::span{text})), hash_bytes(text));
+        text += static_cast<char>('a' + i % 26);
+    }
+}
+
+TEST(Hash, Size)
+{
+    // Buffers of zeros only differ in their size, which must still give different hashes.
+    auto zeros = std::vector<std::byte>(100);
+
+    auto hashes = std::set<size_t>{};
+    for (size_t size = 0; size != zeros.size(); ++size) {
+        hashes.insert(hash_bytes(zeros.data(), size));
+    }
+    ASSERT_EQ(hashes.size(), zeros.size());
+}
+
+TEST(Hash, BitFlip)
+{
+    // Every bit of every byte must influence the hash, including the bytes of the
+    // overlapping and padded last blocks.
+    for (size_t size = 1; size != 70; ++size) {
+        auto bytes = std::vector<std::byte>(size);
+        ttlet original = hash_bytes(bytes.data(), size);
+
+        auto hashes = std::set<size_t>{original};
+        for (size_t i = 0; i != size * 8; ++i) {
+            bytes[i / 8] ^= static_cast<std::byte>(1 << (i % 8));
+            hashes.insert(hash_bytes(bytes.data(), size));
+            bytes[i / 8] ^= static_cast<std::byte>(1 << (i % 8));
+        }
+        ASSERT_EQ(hashes.size(), size * 8 + 1);
+    }
+}
+
+TEST(Hash, Seed)
+{
+    ASSERT_NE(hash_bytes("hello world", 0), hash_bytes("hello world", 1));
+    ASSERT_NE(hash_bytes("", 0), hash_bytes("", 1));
+}
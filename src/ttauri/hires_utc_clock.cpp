@@ -7,9 +7,11 @@
 #include "application.hpp"
 #include "logger.hpp"
 #include "thread.hpp"
+#include "int_carry.hpp"
 #include <fmt/ostream.h>
 #include <fmt/format.h>
 #include <bit>
+#include <cstdlib>
 #include <iterator>
 
 namespace tt {
@@ -29,6 +31,41 @@ std::string format_engineering(hires_utc_clock::duration duration)
     }
 }
 
+void iso8601_formatter::format_to(std::string &out, hires_utc_clock::time_point utc_timestamp) noexcept
+{
+    ttlet ns = utc_timestamp.time_since_epoch().count();
+    auto second = ns / 1'000'000'000;
+    auto nanoseconds = ns % 1'000'000'000;
+    if (nanoseconds < 0) {
+        --second;
+        nanoseconds += 1'000'000'000;
+    }
+
+    if (second != _second) {
+        ttlet str = format_iso8601(hires_utc_clock::time_point{hires_utc_clock::duration{second * 1'000'000'000}});
+        ttlet dot = str.find('.');
+        if (dot == std::string::npos || str.size() < dot + 10) {
+            // Could not format the time, don't cache the error message.
+            out += str;
+            return;
+        }
+
+        _prefix = str.substr(0, dot + 1);
+        _suffix = str.substr(dot + 10);
+        _second = second;
+    }
+
+    auto digits = std::array<char, 9>{};
+    for (auto i = digits.size(); i != 0; --i) {
+        digits[i - 1] = static_cast<char>('0' + nanoseconds % 10);
+        nanoseconds /= 10;
+    }
+
+    out += _prefix;
+    out.append(digits.data(), digits.size());
+    out += _suffix;
+}
+
 [[nodiscard]] hires_utc_clock::time_point hires_utc_clock::now(time_stamp_count &tsc) noexcept
 {
     auto shortest_diff = std::numeric_limits<uint64_t>::max();
@@ -72,9 +109,14 @@ std::string format_engineering(hires_utc_clock::duration duration)
 {
     auto i = tsc.cpu_id();
     if (i >= 0) {
-        ttlet tsc_epoch = tsc_epochs[i].load(std::memory_order::relaxed);
-        if (tsc_epoch != hires_utc_clock::time_point{}) {
-            return tsc_epoch + tsc.time_since_epoch();
+        ttlet segment = tsc_segments[i].load();
+        if (segment.period != 0) {
+            // The time stamp count may have been taken before the start of the segment.
+            ttlet forward = tsc.count() >= segment.tsc;
+            ttlet cycles = forward ? tsc.count() - segment.tsc : segment.tsc - tsc.count();
+            ttlet [lo, hi] = wide_mul(cycles, segment.period);
+            ttlet ns = static_cast<int64_t>((hi << 32) | (lo >> 32));
+            return time_point{duration{forward ? segment.utc + ns : segment.utc - ns}};
         }
     }
 
@@ -85,6 +127,97 @@ std::string format_engineering(hires_utc_clock::duration duration)
     return ref_tp - diff_ns;
 }
 
+[[nodiscard]] hires_utc_clock::duration hires_utc_clock::calibration_error() noexcept
+{
+    auto r = int64_t{0};
+    auto calibrated = false;
+    for (ttlet &segment : tsc_segments) {
+        ttlet value = segment.load();
+        if (value.period != 0) {
+            r = std::max(r, value.error);
+            calibrated = true;
+        }
+    }
+    return calibrated ? duration{r} : duration::max();
+}
+
+/** The samples of a single CPU, used to fit the period of the next segment.
+ * Only accessed from the calibration thread.
+ */
+struct tsc_utc_history {
+    static constexpr size_t capacity = 16;
+
+    std::array<uint64_t, capacity> tsc;
+    std::array<int64_t, capacity> utc;
+    size_t head = 0;
+    size_t size = 0;
+
+    void clear() noexcept
+    {
+        head = 0;
+        size = 0;
+    }
+
+    void push(uint64_t new_tsc, int64_t new_utc) noexcept
+    {
+        tsc[head] = new_tsc;
+        utc[head] = new_utc;
+        head = (head + 1) % capacity;
+        size = std::min(size + 1, capacity);
+    }
+
+    /** The index of the oldest sample.
+     */
+    [[nodiscard]] size_t oldest() const noexcept
+    {
+        return (head + capacity - size) % capacity;
+    }
+};
+
+void hires_utc_clock::calibrate(size_t cpu_id, time_stamp_count const &tsc, time_point tp) noexcept
+{
+    // A difference larger than this between the mapping and the UTC clock is treated as
+    // an adjustment of the UTC clock, instead of drift of the time stamp counter.
+    constexpr auto step_threshold = int64_t{1'000'000};
+
+    static auto histories = std::array<tsc_utc_history, maximum_num_cpus>{};
+
+    tt_axiom(cpu_id < maximum_num_cpus);
+    auto &history = histories[cpu_id];
+    auto &segment = tsc_segments[cpu_id];
+
+    ttlet utc = tp.time_since_epoch().count();
+    ttlet previous = segment.load();
+
+    auto error = int64_t{0};
+    if (previous.period != 0) {
+        error = std::abs(make(tsc).time_since_epoch().count() - utc);
+        if (error > step_threshold) {
+            // The UTC clock was stepped; the samples from before the step would skew the period.
+            tt_log_info("UTC clock adjustment of {} ns detected on CPU {}", error, cpu_id);
+            history.clear();
+        }
+    }
+    history.push(tsc.count(), utc);
+
+    // Use the period of the time_stamp_count until there are enough samples to fit a better one.
+    auto period = previous.period != 0 ? previous.period : time_stamp_count::period();
+    if (history.size >= 2) {
+        ttlet oldest = history.oldest();
+        ttlet cycles = tsc.count() - history.tsc[oldest];
+        ttlet ns = utc - history.utc[oldest];
+        if (cycles != 0 and ns > 0) {
+            ttlet ns_ = static_cast<uint64_t>(ns);
+            period = wide_div(ns_ << 32, ns_ >> 32, cycles);
+        }
+    }
+
+    // Exponential moving average, which immediately follows an increase of the error.
+    ttlet smoothed_error = std::max(error, (previous.error * 7 + error) / 8);
+
+    segment.store({tsc.count(), utc, period, smoothed_error});
+}
+
 void hires_utc_clock::subsystem_proc_frequency_calibration(std::stop_token stop_token) noexcept
 {
     // Calibrate the TSC frequency to within 1 ppm.
@@ -145,7 +278,7 @@ void hires_utc_clock::subsystem_proc(std::stop_token stop_token) noexcept
         ttlet tp = hires_utc_clock::now(tsc);
         tt_axiom(tsc.cpu_id() == narrow_cast<ssize_t>(current_cpu));
 
-        tsc_epochs[current_cpu].store(tp - tsc.time_since_epoch(), std::memory_order::relaxed);        
+        calibrate(current_cpu, tsc, tp);
     }
 }
 
@@ -11,10 +11,87 @@
 #include <atomic>
 #include <chrono>
 #include <thread>
+#include <string>
+#include <limits>
 
 namespace tt {
 class time_stamp_count;
 
+namespace detail {
+
+/** A linear mapping from the time stamp count of a single CPU to UTC.
+ *
+ * The mapping is piecewise linear: each calibration starts a new segment at the latest
+ * TSC/UTC sample, with a period fitted over the previous samples. The segment is written
+ * by the calibration thread and read wait-free through a sequence lock.
+ */
+class tsc_utc_segment {
+public:
+    struct value_type {
+        uint64_t tsc = 0;
+        int64_t utc = 0;
+
+        /** The period in nanoseconds/cycle as Q32.32.
+         */
+        uint64_t period = 0;
+
+        /** The estimated error in nanoseconds of the time calculated from this segment.
+         */
+        int64_t error = 0;
+    };
+
+    /** Read the segment.
+     * @return The segment, where period is zero when the CPU has not been calibrated.
+     */
+    [[nodiscard]] value_type load() const noexcept
+    {
+        while (true) {
+            ttlet sequence = _sequence.load(std::memory_order::acquire);
+            if (sequence & 1) {
+                // A write is in progress.
+                continue;
+            }
+
+            auto r = value_type{
+                _tsc.load(std::memory_order::relaxed),
+                _utc.load(std::memory_order::relaxed),
+                _period.load(std::memory_order::relaxed),
+                _error.load(std::memory_order::relaxed)};
+
+            std::atomic_thread_fence(std::memory_order::acquire);
+            if (_sequence.load(std::memory_order::relaxed) == sequence) {
+                return r;
+            }
+        }
+    }
+
+    /** Write the segment.
+     * @pre Only a single thread may write to the segment.
+     */
+    void store(value_type const &value) noexcept
+    {
+        ttlet sequence = _sequence.load(std::memory_order::relaxed);
+        _sequence.store(sequence + 1, std::memory_order::relaxed);
+        std::atomic_thread_fence(std::memory_order::release);
+
+        _tsc.store(value.tsc, std::memory_order::relaxed);
+        _utc.store(value.utc, std::memory_order::relaxed);
+        _period.store(value.period, std::memory_order::relaxed);
+        _error.store(value.error, std::memory_order::relaxed);
+
+        _sequence.store(sequence + 2, std::memory_order::release);
+    }
+
+private:
+    std::atomic<uint32_t> _sequence = 0;
+    std::atomic<uint64_t> _tsc = 0;
+    std::atomic<int64_t> _utc = 0;
+    std::atomic<uint64_t> _period = 0;
+    std::atomic<int64_t> _error = 0;
+};
+
+} // namespace detail
+
 /** Timestamp
  */
 struct hires_utc_clock {
@@ -37,12 +114,20 @@ struct hires_utc_clock {
      * This function will work in two modes:
      *  - subsystem off: Uses now() and the time_stamp_count frequency to
      *    estimate a timepoint from the given tsc.
-     *  - subsystem on: Uses the calibrated TSC offset and more accurate
-     *    frequency to estimate a timepoint from the given tsc.
-     *    this is much faster and a lot more accurate.
+     *  - subsystem on: Uses the calibrated mapping of the CPU that took the
+     *    time stamp count, which follows the drift of the TSC and adjustments
+     *    of the UTC clock. This is wait-free, a lot faster and more accurate.
      */
     [[nodiscard]] static time_point make(time_stamp_count const &tsc) noexcept;
 
+    /** The estimated error of `make()`.
+     * This is the largest difference between the calibrated mappings and the latest
+     * measurements of the UTC clock, over all CPUs.
+     *
+     * @return The estimated error, or the maximum duration when not calibrated.
+     */
+    [[nodiscard]] static duration calibration_error() noexcept;
+
     /** This will start the calibration subsystem.
      */
     static bool start_subsystem() noexcept;
@@ -51,21 +136,17 @@ struct hires_utc_clock {
      */
     static void stop_subsystem() noexcept;
 
-    /** A calibration step which will drift the per-cpu tsc-offset.
-     * This is a fast wait-free function that may be called from any
-     * thread. It is useful to call this from the render thread
-     * which means small adjustments to the calibrations are made at
-     * 60 fps.
-     */
-    static void adjust_for_drift() noexcept;
-
 private:
     static inline std::atomic<bool> subsystem_is_running = false;
     static inline std::jthread subsystem_thread;
     static inline unfair_mutex mutex;
-    static inline std::array<std::atomic<hires_utc_clock::time_point>, maximum_num_cpus> tsc_epochs = {};
+    static inline std::array<detail::tsc_utc_segment, maximum_num_cpus> tsc_segments = {};
 
     static void subsystem_proc_frequency_calibration(std::stop_token stop_token) noexcept;
+
+    /** Start a new segment of the mapping of a CPU from a new sample.
+     */
+    static void calibrate(size_t cpu_id, time_stamp_count const &tsc, time_point tp) noexcept;
     static void subsystem_proc(std::stop_token stop_token) noexcept;
 
     /** Subsystem initializer.
@@ -92,4 +173,32 @@ std::string format_iso8601_utc(hires_utc_clock::time_point utc_timestamp) noexce
  */
 std::string format_iso8601(hires_utc_clock::time_point utc_timestamp, date::time_zone const *time_zone = nullptr) noexcept;
 
+/** Formats ISO-8601 date-times of consecutive time points, such as those of log messages.
+ *
+ * The text before and after the nanoseconds is formatted once for each second, including
+ * the conversion to the calendar and the time zone offset, so that only the nanoseconds are
+ * formatted for the following time points in the same second.
+ *
+ * An object must only be used by a single thread.
+ */
+class iso8601_formatter {
+public:
+    /** Append a ISO-8601 formated date-time, the same as `format_iso8601()` of the current time zone.
+     * @param out The string to append to.
+     * @param utc_timestamp The time_point to format.
+     */
+    void format_to(std::string &out, hires_utc_clock::time_point utc_timestamp) noexcept;
+
+private:
+    int64_t _second = std::numeric_limits<int64_t>::min();
+
+    /** The date-time up to and including the decimal point of the seconds.
+     */
+    std::string _prefix;
+
+    /** The time zone offset after the nanoseconds.
+     */
+    std::string _suffix;
+};
+
 } // namespace tt
@@ -0,0 +1,29 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/hires_utc_clock.hpp"
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace std;
+using namespace tt;
+
+TEST(HiresUTCClock, ISO8601Formatter)
+{
+    auto formatter = iso8601_formatter{};
+
+    // Consecutive time points in the same second, the next second and the next minute.
+    for (ttlet ns : {
+             int64_t{1'600'000'000'123'456'789},
+             int64_t{1'600'000'000'999'999'999},
+             int64_t{1'600'000'001'000'000'000},
+             int64_t{1'600'000'001'000'000'007},
+             int64_t{1'600'000'061'500'000'000}}) {
+        ttlet time_point = hires_utc_clock::time_point{hires_utc_clock::duration{ns}};
+
+        auto r = std::string{};
+        formatter.format_to(r, time_point);
+        ASSERT_EQ(r, format_iso8601(time_point));
+    }
+}
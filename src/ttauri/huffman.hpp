@@ -1,162 +1,175 @@
-// Copyright Take Vos 2020.
+// Copyright Take Vos 2020-2021.
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
+#pragma once
+
 #include "required.hpp"
 #include "bits.hpp"
 #include "cast.hpp"
+#include "exception.hpp"
+#include "check.hpp"
 #include <span>
 #include <vector>
+#include <array>
+#include <algorithm>
+#include <cstdint>
 
 namespace tt {
 
-template<typename T>
-class huffman_tree {
-    static_assert(std::is_integral_v<T> && std::is_signed_v<T>);
-
-    using state_t = T const *;
-
-    /** The internal data structure holding the tree.
-     * A pair of values are added to the list for each tree-node.
-     * The values have the following meaning:
-     *  - negative number are relative offset from the current
-     *    position to the next tree node. So that it is possible
-     *    to simply add the negative value to the iterator.
-     *  - positive number is the symbol value + 1.
-     *  - zero was unused or not yet assigned.
+/** A table for decoding canonical huffman codes, as used by deflate.
+ *
+ * The table is indexed by the next `root_bits` bits of the stream,
+ * so that most symbols are decoded with a single lookup. Codes that are
+ * longer than `root_bits` are decoded with a second lookup in a sub-table.
+ *
+ * The codes are stored MSB first in the stream, while the bits are read LSB first;
+ * therefore the codes are bit-reversed when they are added to the table.
+ */
+class huffman_table {
+public:
+    /** The maximum length of a code.
      */
-    std::vector<T> tree;
+    static constexpr int max_code_length = 15;
 
-public:
-    huffman_tree() {
-        tree.push_back(0);
-        tree.push_back(0);
-    }
+    huffman_table() noexcept : _root_bits(0), _table(1) {}
 
-    /** Add a symbol to the huffman_tree.
-     * 
+    /** Decode a symbol.
+     *
+     * @param reader The bit reader to read the code from.
+     * @return The decoded symbol.
+     * @throw parse_error on a code that is not in the table.
      */
-    void add(int symbol, int code, int code_length) noexcept {
-        tt_axiom(code_length >= 1);
-
-        int offset = 0;
-        while (--code_length > 0) {
-            int select = (code >> code_length) & 1;
-            offset += select;
-          
-            int value = tree[offset];
-
-            // value may not be a leaf.
-            tt_axiom(value <= 0); 
-
-            if (value == 0) {
-                // Unused node entry. Point to the first of two new entries.
-                value = -(static_cast<int>(std::ssize(tree)) - offset);
-
-                tree[offset] = narrow_cast<T>(value);
-                tree.push_back(0);
-                tree.push_back(0);
-            }
+    [[nodiscard]] int get_symbol(bit_reader &reader) const
+    {
+        ttlet bits = reader.peek(max_code_length);
 
-            // Go to the next entry.
-            offset -= value;
+        auto entry = _table[bits & ((1 << _root_bits) - 1)];
+        if (entry.sub_bits != 0) {
+            entry = _table[entry.symbol + ((bits >> _root_bits) & ((1 << entry.sub_bits) - 1))];
         }
 
-        // place the symbol as a leaf.
-        int select = code & 1;
-        offset += select;
-
-        tt_axiom(tree[offset] == 0); 
-        tree[offset] = narrow_cast<T>(symbol + 1);
-    }
+        if (entry.length == 0) {
+            throw parse_error("Code not in huffman table.");
+        }
 
-    [[nodiscard]] state_t start() const noexcept {
-        return tree.data();
+        reader.skip(entry.length);
+        return entry.symbol;
     }
 
-    /** Get a symbol from the huffman-tree.
-     *
-     * Before `get()` is called use `start()` to create a state to
-     * pass between invocations. State is invalid after `get()` returns
-     * a symbol or throws.
+    /** Build a canonical-huffman table from a set of lengths.
      *
-     * @param code_bit The next bit from the huffman encoded stream.
-     * @param state The state carried between invocations @see start().
-     * @return Positive numbers are symbols, negative means more code_bits
-     *         are needed.
-     * @throw parse-error on invalid code-bit sequence.
+     * @param lengths The length of the code for each symbol, zero when the symbol is not used.
+     * @param nr_symbols The number of symbols.
+     * @param root_bits The number of bits to resolve in the first lookup.
+     * @throw parse_error when the lengths do not describe a valid huffman code.
      */
-    [[nodiscard]] int get(bool code_bit, state_t &state) const {
-        state += static_cast<ptrdiff_t>(code_bit);
+    [[nodiscard]] static huffman_table from_lengths(int const *lengths, ssize_t nr_symbols, int root_bits = 10)
+    {
+        auto count = std::array<int, max_code_length + 1>{};
+        auto max_length = 0;
+        for (ssize_t symbol = 0; symbol != nr_symbols; ++symbol) {
+            ttlet length = lengths[symbol];
+            tt_parse_check(length >= 0 && length <= max_code_length, "Huffman code length out of range");
+            ++count[length];
+            max_length = std::max(max_length, length);
+        }
+        count[0] = 0;
 
-        if (*state == 0) {
-            throw parse_error("Code not in huffman tree.");
+        // The first code of each length, where codes of the same length are ordered by symbol.
+        auto next_code = std::array<int, max_code_length + 2>{};
+        for (int length = 1; length <= max_code_length; ++length) {
+            next_code[length + 1] = (next_code[length] + count[length]) << 1;
+            tt_parse_check(next_code[length] + count[length] <= (1 << length), "Huffman code is over-subscribed");
         }
 
-        auto value = *state;
-        state -= static_cast<ptrdiff_t>(value);
-        return value - 1;
-    }
+        auto r = huffman_table{};
+        r._root_bits = std::min(root_bits, max_length);
+        r._table.assign(size_t{1} << r._root_bits, entry_type{});
 
-    [[nodiscard]] int get_symbol(std::span<std::byte const> bytes, ssize_t &bit_offset) const noexcept {
-        auto state = start();
-        while (true) {
-            int symbol;
-            if ((symbol = get(get_bit(bytes, bit_offset), state)) >= 0) {
-                return symbol;
+        auto codes = std::vector<int>(narrow_cast<size_t>(nr_symbols));
+        for (ssize_t symbol = 0; symbol != nr_symbols; ++symbol) {
+            if (ttlet length = lengths[symbol]) {
+                codes[symbol] = reverse_bits(next_code[length]++, length);
             }
         }
-    }
-    
-    /** Build a canonical-huffman table from a set of lengths.
-     */
-    [[nodiscard]] static huffman_tree from_lengths(int const *lengths, ssize_t nr_symbols) {
-        struct symbol_length_t {
-            int symbol;
-            int length;
 
-            symbol_length_t(int symbol, int length) : symbol(symbol), length(length) {}
-        };
-
-        std::vector<symbol_length_t> symbol_lengths;
-        symbol_lengths.reserve(nr_symbols);
-
-        for (int symbol = 0; symbol != nr_symbols; ++symbol) {
-            symbol_lengths.emplace_back(symbol, lengths[symbol]);
+        // Allocate a sub-table for each root entry that is the prefix of a long code,
+        // sized for the longest code with that prefix.
+        ttlet root_mask = (1 << r._root_bits) - 1;
+        for (ssize_t symbol = 0; symbol != nr_symbols; ++symbol) {
+            ttlet length = lengths[symbol];
+            if (length > r._root_bits) {
+                auto &link = r._table[codes[symbol] & root_mask];
+                link.sub_bits = narrow_cast<uint8_t>(std::max(static_cast<int>(link.sub_bits), length - r._root_bits));
+            }
         }
-
-        // Sort the table based on the length of the code, followed by symbol
-        std::sort(symbol_lengths.begin(), symbol_lengths.end(), [](ttlet &a, ttlet &b) {
-            if (a.length == b.length) {
-                return a.symbol < b.symbol;
-            } else {
-                return a.length < b.length;
+        for (auto i = 0; i <= root_mask; ++i) {
+            if (ttlet sub_bits = r._table[i].sub_bits) {
+                r._table[i].symbol = narrow_cast<uint16_t>(r._table.size());
+                r._table.resize(r._table.size() + (size_t{1} << sub_bits));
             }
-        });
+        }
 
-        auto r = huffman_tree{};
+        for (ssize_t symbol = 0; symbol != nr_symbols; ++symbol) {
+            ttlet length = lengths[symbol];
+            if (length == 0) {
+                continue;
+            }
 
-        int code = 0;
-        int prev_length = 0;
-        for (auto &&entry: symbol_lengths) {
-            if (entry.length != 0) {
-                code <<= (entry.length - prev_length);
+            ttlet leaf = entry_type{narrow_cast<uint16_t>(symbol), narrow_cast<uint8_t>(length), 0};
+            ttlet code = codes[symbol];
+            if (length <= r._root_bits) {
+                // Fill every entry where the unused high bits of the index have any value.
+                for (auto i = code; i <= root_mask; i += 1 << length) {
+                    r._table[i] = leaf;
+                }
 
-                r.add(entry.symbol, code, entry.length);
-                ++code;
+            } else {
+                ttlet link = r._table[code & root_mask];
+                ttlet sub_code = code >> r._root_bits;
+                ttlet sub_length = length - r._root_bits;
+                for (auto i = sub_code; i < (1 << link.sub_bits); i += 1 << sub_length) {
+                    r._table[link.symbol + i] = leaf;
+                }
             }
-
-            prev_length = entry.length;
         }
 
         return r;
     }
 
-    [[nodiscard]] static huffman_tree from_lengths(std::vector<int> const &lengths) {
-        return from_lengths(lengths.data(), std::ssize(lengths));
+    [[nodiscard]] static huffman_table from_lengths(std::vector<int> const &lengths, int root_bits = 10)
+    {
+        return from_lengths(lengths.data(), std::ssize(lengths), root_bits);
     }
-};
-
 
+private:
+    /** An entry in the table.
+     *
+     * A leaf has `sub_bits` zero; `symbol` is the decoded symbol and
+     * `length` the total length of its code, or zero for an unused code.
+     *
+     * A link to a sub-table has `sub_bits` non-zero; `symbol` is the index
+     * of the sub-table, which is indexed by the next `sub_bits` bits.
+     */
+    struct entry_type {
+        uint16_t symbol;
+        uint8_t length;
+        uint8_t sub_bits;
+    };
+
+    int _root_bits;
+    std::vector<entry_type> _table;
+
+    [[nodiscard]] static int reverse_bits(int code, int length) noexcept
+    {
+        auto r = 0;
+        for (int i = 0; i != length; ++i) {
+            r = (r << 1) | (code & 1);
+            code >>= 1;
+        }
+        return r;
+    }
+};
 
-}
+} // namespace tt
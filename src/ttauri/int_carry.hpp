@@ -12,6 +12,7 @@
 #include <span>
 #include <tuple>
 #include <concepts>
+#include <type_traits>
 
 #if TT_COMPILER == TT_CC_MSVC
 #include <intrin.h>
@@ -76,61 +77,105 @@ constexpr std::pair<T, T> add_carry(T lhs, T rhs, T carry = 0) noexcept
         return {static_cast<uint32_t>(r), static_cast<uint32_t>(r >> 32)};
 
     } else if constexpr (sizeof(T) == 8) {
-#if TT_COMPILER == TT_MSVC
-        uint64_t r;
-        auto carry_out = _addcarry_u64(static_cast<unsigned char>(carry), lhs, rhs, &r);
-        return {r, static_cast<uint64_t>(carry_out)};
+#if TT_COMPILER == TT_CC_MSVC && TT_PROCESSOR == TT_CPU_X64
+        if (not std::is_constant_evaluated()) {
+            uint64_t r;
+            auto carry_out = _addcarry_u64(static_cast<unsigned char>(carry), lhs, rhs, &r);
+            return {r, static_cast<uint64_t>(carry_out)};
+        }
 #elif TT_COMPILER == TT_CC_CLANG || TT_COMPILER == TT_CC_GCC
+        // The compiler emits an add-with-carry for the 128 bit addition.
         auto r = static_cast<__uint128_t>(lhs) + static_cast<__uint128_t>(rhs) + carry;
         return {static_cast<uint64_t>(r), static_cast<uint64_t>(r >> 64)};
-#else
+#endif
         uint64_t r1 = lhs + rhs;
         uint64_t c = (r1 < lhs) ? 1 : 0;
         uint64_t r2 = r1 + carry;
         c += (r2 < r1) ? 1 : 0;
         return {r2, c};
+    }
+}
+
+/** Subtract two numbers with borrow chain.
+ * @param lhs The left hand side
+ * @param rhs The right hand side
+ * @param borrow From the previous subtract in the chain
+ * @return (result, borrow) pair
+ */
+template<std::unsigned_integral T>
+constexpr std::pair<T, T> sub_borrow(T lhs, T rhs, T borrow = 0) noexcept
+{
+    tt_axiom(borrow == 0 || borrow == 1);
+
+    if constexpr (sizeof(T) == 8) {
+#if TT_COMPILER == TT_CC_MSVC && TT_PROCESSOR == TT_CPU_X64
+        if (not std::is_constant_evaluated()) {
+            uint64_t r;
+            auto borrow_out = _subborrow_u64(static_cast<unsigned char>(borrow), lhs, rhs, &r);
+            return {r, static_cast<uint64_t>(borrow_out)};
+        }
 #endif
     }
+
+    T r1 = static_cast<T>(lhs - rhs);
+    T b = (r1 > lhs) ? 1 : 0;
+    T r2 = static_cast<T>(r1 - borrow);
+    b += (r2 > r1) ? 1 : 0;
+    return {r2, b};
 }
 
-/** Multiply with carry.
- * The carry is a high-word of the multiplication result and has the same size
- * as the inputs. The accumulator is used when doing long-multiplication from the
- * previous row. This function does not overflow even if all the arguments are at max.
+/** Wide multiply.
+ * multiplies two numbers and returns a low, high pair.
  *
  * @param lhs The left hand side.
  * @param rhs The right hand side.
- * @param carry The carry-input; carry-output from the previous `mul_carry()`.
- * @param accumulator The column value during a long multiply.
+ * @return (low, high) result.
  */
 template<std::unsigned_integral T>
-constexpr std::pair<T, T> mul_carry(T lhs, T rhs, T carry = 0, T accumulator = 0) noexcept
+constexpr std::pair<T, T> wide_mul(T lhs, T rhs) noexcept
 {
     if constexpr (sizeof(T) == 1) {
-        uint16_t r = static_cast<uint16_t>(lhs) * static_cast<uint16_t>(rhs) + carry + accumulator;
+        uint16_t r = static_cast<uint16_t>(lhs) * static_cast<uint16_t>(rhs);
         return {static_cast<uint8_t>(r), static_cast<uint8_t>(r >> 8)};
 
     } else if constexpr (sizeof(T) == 2) {
-        uint32_t r = static_cast<uint32_t>(lhs) * static_cast<uint32_t>(rhs) + carry + accumulator;
+        uint32_t r = static_cast<uint32_t>(lhs) * static_cast<uint32_t>(rhs);
         return {static_cast<uint16_t>(r), static_cast<uint16_t>(r >> 16)};
 
     } else if constexpr (sizeof(T) == 4) {
-        uint64_t r = static_cast<uint64_t>(lhs) * static_cast<uint64_t>(rhs) + carry + accumulator;
+        uint64_t r = static_cast<uint64_t>(lhs) * static_cast<uint64_t>(rhs);
         return {static_cast<uint32_t>(r), static_cast<uint32_t>(r >> 32)};
 
     } else if constexpr (sizeof(T) == 8) {
 #if TT_COMPILER == TT_CC_MSVC
-        uint64_t hi = 0;
-        uint64_t lo = _umul128(lhs, rhs, &hi);
-        uint64_t c = 0;
-        std::tie(lo, c) = add_carry(lo, carry, uint64_t{0});
-        std::tie(hi, c) = add_carry(hi, uint64_t{0}, c);
-        std::tie(lo, c) = add_carry(lo, accumulator, uint64_t{0});
-        std::tie(hi, c) = add_carry(hi, uint64_t{0}, c);
-        return {lo, hi};
+        if (not std::is_constant_evaluated()) {
+            uint64_t hi = 0;
+#if defined(__AVX2__)
+            // mulx does not modify the flags, so it can be interleaved with an add-with-carry chain.
+            uint64_t lo = _mulx_u64(lhs, rhs, &hi);
+#else
+            uint64_t lo = _umul128(lhs, rhs, &hi);
+#endif
+            return {lo, hi};
+        }
+
+        // Long multiplication of 32 bit halves, when evaluated at compile time.
+        ttlet lhs_lo = lhs & 0xffff'ffff;
+        ttlet lhs_hi = lhs >> 32;
+        ttlet rhs_lo = rhs & 0xffff'ffff;
+        ttlet rhs_hi = rhs >> 32;
+
+        ttlet lo_lo = lhs_lo * rhs_lo;
+        ttlet hi_lo = lhs_hi * rhs_lo;
+        ttlet lo_hi = lhs_lo * rhs_hi;
+        ttlet hi_hi = lhs_hi * rhs_hi;
+
+        ttlet middle = (lo_lo >> 32) + (hi_lo & 0xffff'ffff) + lo_hi;
+        return {(middle << 32) | (lo_lo & 0xffff'ffff), hi_hi + (hi_lo >> 32) + (middle >> 32)};
 
 #elif TT_COMPILER == TT_CC_CLANG || TT_COMPILER == TT_CC_GCC
-        auto r = static_cast<__uint128_t>(lhs) * static_cast<__uint128_t>(rhs) + carry + accumulator;
+        // The compiler emits mulx when compiling for BMI2.
+        auto r = static_cast<__uint128_t>(lhs) * static_cast<__uint128_t>(rhs);
         return {static_cast<uint64_t>(r), static_cast<uint64_t>(r >> 64)};
 #else
 #error "Not implemented"
@@ -138,36 +183,43 @@ constexpr std::pair<T, T> mul_carry(T lhs, T rhs, T carry = 0, T accumulator = 0
     }
 }
 
-/** Wide multiply.
- * multiplies two numbers and returns a low, high pair.
+/** Multiply with carry.
+ * The carry is a high-word of the multiplication result and has the same size
+ * as the inputs. The accumulator is used when doing long-multiplication from the
+ * previous row. This function does not overflow even if all the arguments are at max.
  *
  * @param lhs The left hand side.
  * @param rhs The right hand side.
- * @return (low, high) result.
+ * @param carry The carry-input; carry-output from the previous `mul_carry()`.
+ * @param accumulator The column value during a long multiply.
  */
 template<std::unsigned_integral T>
-constexpr std::pair<T, T> wide_mul(T lhs, T rhs) noexcept
+constexpr std::pair<T, T> mul_carry(T lhs, T rhs, T carry = 0, T accumulator = 0) noexcept
 {
     if constexpr (sizeof(T) == 1) {
-        uint16_t r = static_cast<uint16_t>(lhs) * static_cast<uint16_t>(rhs);
+        uint16_t r = static_cast<uint16_t>(lhs) * static_cast<uint16_t>(rhs) + carry + accumulator;
         return {static_cast<uint8_t>(r), static_cast<uint8_t>(r >> 8)};
 
     } else if constexpr (sizeof(T) == 2) {
-        uint32_t r = static_cast<uint32_t>(lhs) * static_cast<uint32_t>(rhs);
+        uint32_t r = static_cast<uint32_t>(lhs) * static_cast<uint32_t>(rhs) + carry + accumulator;
         return {static_cast<uint16_t>(r), static_cast<uint16_t>(r >> 16)};
 
     } else if constexpr (sizeof(T) == 4) {
-        uint64_t r = static_cast<uint64_t>(lhs) * static_cast<uint64_t>(rhs);
+        uint64_t r = static_cast<uint64_t>(lhs) * static_cast<uint64_t>(rhs) + carry + accumulator;
         return {static_cast<uint32_t>(r), static_cast<uint32_t>(r >> 32)};
 
     } else if constexpr (sizeof(T) == 8) {
 #if TT_COMPILER == TT_CC_MSVC
-        uint64_t hi = 0;
-        uint64_t lo = _umul128(lhs, rhs, &hi);
+        auto [lo, hi] = wide_mul(lhs, rhs);
+        uint64_t c = 0;
+        std::tie(lo, c) = add_carry(lo, carry, uint64_t{0});
+        std::tie(hi, c) = add_carry(hi, uint64_t{0}, c);
+        std::tie(lo, c) = add_carry(lo, accumulator, uint64_t{0});
+        std::tie(hi, c) = add_carry(hi, uint64_t{0}, c);
         return {lo, hi};
 
 #elif TT_COMPILER == TT_CC_CLANG || TT_COMPILER == TT_CC_GCC
-        auto r = static_cast<__uint128_t>(lhs) * static_cast<__uint128_t>(rhs);
+        auto r = static_cast<__uint128_t>(lhs) * static_cast<__uint128_t>(rhs) + carry + accumulator;
         return {static_cast<uint64_t>(r), static_cast<uint64_t>(r >> 64)};
 #else
 #error "Not implemented"
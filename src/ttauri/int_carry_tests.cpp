@@ -132,3 +132,59 @@ TYPED_TEST(int_carry_test, Add)
     ASSERT_EQ(r.second, one);
 }
 
+
+TYPED_TEST(int_carry_test, Subtract)
+{
+    std::pair<TypeParam,TypeParam> r;
+
+    TypeParam zero = 0;
+    TypeParam one = 1;
+    TypeParam two = 2;
+    TypeParam maximum = numeric_limits<TypeParam>::max();
+    TypeParam high = maximum - 1;
+
+    r = sub_borrow(zero, zero, zero);
+    ASSERT_EQ(r.first, zero);
+    ASSERT_EQ(r.second, zero);
+
+    r = sub_borrow(zero, zero, one);
+    ASSERT_EQ(r.first, maximum);
+    ASSERT_EQ(r.second, one);
+
+    r = sub_borrow(two, one, zero);
+    ASSERT_EQ(r.first, one);
+    ASSERT_EQ(r.second, zero);
+
+    r = sub_borrow(two, one, one);
+    ASSERT_EQ(r.first, zero);
+    ASSERT_EQ(r.second, zero);
+
+    r = sub_borrow(zero, one, zero);
+    ASSERT_EQ(r.first, maximum);
+    ASSERT_EQ(r.second, one);
+
+    r = sub_borrow(zero, maximum, one);
+    ASSERT_EQ(r.first, zero);
+    ASSERT_EQ(r.second, one);
+
+    r = sub_borrow(maximum, maximum, one);
+    ASSERT_EQ(r.first, maximum);
+    ASSERT_EQ(r.second, one);
+
+    r = sub_borrow(maximum, high, one);
+    ASSERT_EQ(r.first, zero);
+    ASSERT_EQ(r.second, zero);
+}
+
+TYPED_TEST(int_carry_test, WideMultiply)
+{
+    TypeParam maximum = numeric_limits<TypeParam>::max();
+
+    ttlet [lo, hi] = wide_mul(maximum, maximum);
+    ASSERT_EQ(lo, TypeParam{1});
+    ASSERT_EQ(hi, static_cast<TypeParam>(maximum - 1));
+
+    constexpr auto lo_hi = wide_mul(numeric_limits<TypeParam>::max(), TypeParam{2});
+    static_assert(lo_hi.first == static_cast<TypeParam>(numeric_limits<TypeParam>::max() - 1));
+    static_assert(lo_hi.second == TypeParam{1});
+}
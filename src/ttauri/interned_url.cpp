@@ -0,0 +1,92 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "interned_url.hpp"
+#include "unfair_mutex.hpp"
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+
+namespace tt {
+namespace detail {
+
+interned_url_record::interned_url_record(URL url) noexcept :
+    url(std::move(url)),
+    value(to_string(this->url)),
+    scheme(this->url.scheme()),
+    path(this->url.path()),
+    filename(this->url.filename()),
+    extension(this->url.extension()),
+    segments(this->url.pathSegments()),
+    hash(this->url.hash()),
+    absolute(this->url.isAbsolute())
+{
+}
+
+/** The interned URLs.
+ * The records are owned by the table, which is never destroyed so that interned URLs stay valid
+ * during the destruction of static objects.
+ */
+struct interned_url_table {
+    unfair_mutex mutex;
+
+    /** The records by the normalized URL, the key points into the record.
+     */
+    std::unordered_map<std::string_view, std::unique_ptr<interned_url_record>> records;
+
+    /** The records by the string they were interned from, before normalization.
+     */
+    std::unordered_map<std::string, interned_url_record const *> strings;
+
+    [[nodiscard]] interned_url_record const *find_or_insert(URL const &url) noexcept
+    {
+        ttlet &value = to_string(url);
+        if (ttlet it = records.find(std::string_view{value}); it != records.end()) {
+            return it->second.get();
+        }
+
+        auto record = std::make_unique<interned_url_record>(url);
+        ttlet record_ptr = record.get();
+        records.emplace(std::string_view{record_ptr->value}, std::move(record));
+        return record_ptr;
+    }
+
+    [[nodiscard]] static interned_url_table &global() noexcept
+    {
+        static auto *table = new interned_url_table();
+        return *table;
+    }
+};
+
+} // namespace detail
+
+interned_url::interned_url(URL const &url) noexcept
+{
+    auto &table = detail::interned_url_table::global();
+    ttlet lock = std::scoped_lock(table.mutex);
+    _record = table.find_or_insert(url);
+}
+
+interned_url::interned_url(std::string_view url) noexcept
+{
+    auto &table = detail::interned_url_table::global();
+    auto lock = std::unique_lock(table.mutex);
+
+    // Heterogeneous lookup is not available for std::unordered_map; the key is copied.
+    auto key = std::string{url};
+    if (ttlet it = table.strings.find(key); it != table.strings.end()) {
+        _record = it->second;
+        return;
+    }
+
+    // Normalize the URL without holding the lock.
+    lock.unlock();
+    ttlet normalized = URL{url};
+    lock.lock();
+
+    _record = table.find_or_insert(normalized);
+    table.strings.emplace(std::move(key), _record);
+}
+
+} // namespace tt
@@ -0,0 +1,153 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "URL.hpp"
+#include "required.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <compare>
+#include <functional>
+
+namespace tt {
+namespace detail {
+
+/** The shared, immutable record of an interned URL.
+ * All accessors are parsed once, when the URL is interned.
+ */
+struct interned_url_record {
+    URL url;
+    std::string value;
+    std::string scheme;
+    std::string path;
+    std::string filename;
+    std::string extension;
+    std::vector<std::string> segments;
+    size_t hash;
+    bool absolute;
+
+    interned_url_record(URL url) noexcept;
+};
+
+} // namespace detail
+
+/** An interned URL.
+ *
+ * Each distinct normalized URL has a single record, which is shared by all interned_url instances.
+ * This makes copying, comparing for equality and hashing O(1), which makes an interned_url a cheap
+ * key for maps. The accessors return references to parts of the URL which were parsed once.
+ *
+ * Records are never freed; intern URLs that are used repeatedly, such as font, theme and
+ * resource locations, not URLs that are constructed once.
+ */
+class interned_url {
+public:
+    explicit interned_url(URL const &url) noexcept;
+
+    /** Intern the URL of a string.
+     * The string is also interned as is, so that the string is only normalized the first time.
+     */
+    explicit interned_url(std::string_view url) noexcept;
+
+    interned_url() noexcept : interned_url(URL{}) {}
+    interned_url(interned_url const &) noexcept = default;
+    interned_url(interned_url &&) noexcept = default;
+    interned_url &operator=(interned_url const &) noexcept = default;
+    interned_url &operator=(interned_url &&) noexcept = default;
+
+    [[nodiscard]] URL const &url() const noexcept
+    {
+        return _record->url;
+    }
+
+    operator URL const &() const noexcept
+    {
+        return _record->url;
+    }
+
+    [[nodiscard]] size_t hash() const noexcept
+    {
+        return _record->hash;
+    }
+
+    [[nodiscard]] std::string const &scheme() const noexcept
+    {
+        return _record->scheme;
+    }
+
+    [[nodiscard]] std::string const &path() const noexcept
+    {
+        return _record->path;
+    }
+
+    [[nodiscard]] std::string const &filename() const noexcept
+    {
+        return _record->filename;
+    }
+
+    [[nodiscard]] std::string const &extension() const noexcept
+    {
+        return _record->extension;
+    }
+
+    [[nodiscard]] std::vector<std::string> const &pathSegments() const noexcept
+    {
+        return _record->segments;
+    }
+
+    [[nodiscard]] bool isAbsolute() const noexcept
+    {
+        return _record->absolute;
+    }
+
+    [[nodiscard]] friend bool operator==(interned_url const &lhs, interned_url const &rhs) noexcept
+    {
+        return lhs._record == rhs._record;
+    }
+
+    /** Compare the URLs as strings, like URL.
+     */
+    [[nodiscard]] friend std::strong_ordering operator<=>(interned_url const &lhs, interned_url const &rhs) noexcept
+    {
+        if (lhs._record == rhs._record) {
+            return std::strong_ordering::equal;
+        }
+        return lhs._record->value <=> rhs._record->value;
+    }
+
+    [[nodiscard]] friend interned_url operator/(interned_url const &lhs, std::string_view const &rhs) noexcept
+    {
+        return interned_url{lhs.url() / rhs};
+    }
+
+    [[nodiscard]] friend std::string const &to_string(interned_url const &rhs) noexcept
+    {
+        return rhs._record->value;
+    }
+
+    friend std::ostream &operator<<(std::ostream &lhs, interned_url const &rhs)
+    {
+        return lhs << to_string(rhs);
+    }
+
+private:
+    detail::interned_url_record const *_record;
+};
+
+} // namespace tt
+
+namespace std {
+
+template<>
+class hash<tt::interned_url> {
+public:
+    size_t operator()(tt::interned_url const &url) const noexcept
+    {
+        return url.hash();
+    }
+};
+
+} // namespace std
@@ -0,0 +1,47 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/interned_url.hpp"
+#include <gtest/gtest.h>
+#include <unordered_set>
+#include <string>
+
+using namespace std;
+using namespace tt;
+
+TEST(interned_url, intern) {
+    ttlet a = interned_url("file:///foo/bar/baz.txt");
+    ttlet b = interned_url(URL("file:///foo/./bar//baz.txt"));
+    ttlet c = interned_url("file:///foo/bar/other.txt");
+
+    ASSERT_EQ(a, b);
+    ASSERT_NE(a, c);
+    ASSERT_EQ(a.hash(), URL("file:///foo/bar/baz.txt").hash());
+    ASSERT_EQ(a.url(), URL("file:///foo/bar/baz.txt"));
+    ASSERT_LT(a, c);
+}
+
+TEST(interned_url, accessors) {
+    ttlet a = interned_url("file:///foo/bar/baz.txt");
+
+    ASSERT_EQ(a.scheme(), "file");
+    ASSERT_EQ(a.path(), "/foo/bar/baz.txt");
+    ASSERT_EQ(a.filename(), "baz.txt");
+    ASSERT_EQ(a.extension(), "txt");
+    ASSERT_EQ(a.pathSegments().size(), 3);
+    ASSERT_EQ(a.pathSegments().at(1), "bar");
+    ASSERT_TRUE(a.isAbsolute());
+
+    ttlet d = interned_url("file:///foo") / "bar/baz.txt";
+    ASSERT_EQ(d, a);
+}
+
+TEST(interned_url, map_key) {
+    auto set = std::unordered_set<interned_url>{};
+    set.insert(interned_url("file:///foo"));
+    set.insert(interned_url("file:///foo/"));
+    set.insert(interned_url("file:///bar"));
+    ASSERT_EQ(set.count(interned_url("file:///foo")), 1);
+    ASSERT_EQ(set.count(interned_url("file:///baz")), 0);
+}
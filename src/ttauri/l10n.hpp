@@ -4,14 +4,22 @@
 
 #pragma once
 
+#include "text/translation_catalog.hpp"
+#include <string>
+#include <string_view>
+#include <cstdint>
+
 namespace tt {
 
 /** A localizable string.
  * Used by gettext to extract all msgids from the program into the .pot file.
+ *
+ * The hash of the msgid is calculated when the l10n is constructed, which the compiler can do
+ * for a string literal, so that looking up the translation does not hash the msgid again.
  */
 class l10n {
 public:
-    l10n() noexcept : msgid() {}
+    l10n() noexcept : msgid(), msgid_hash(translation_catalog::hash({})) {}
     l10n(l10n const &) noexcept = default;
     l10n(l10n &&) noexcept = default;
     l10n &operator=(l10n const &) noexcept = default;
@@ -22,14 +30,16 @@ public:
         return !msgid.empty();
     }
 
-    l10n(std::u8string_view msgid) noexcept : msgid(msgid) {}
+    l10n(std::u8string_view msgid) noexcept : msgid(msgid), msgid_hash(translation_catalog::hash(msgid)) {}
     l10n(std::string_view msgid) noexcept
     {
         this->msgid = std::u8string(reinterpret_cast<char8_t const *>(msgid.data()), msgid.size());
+        this->msgid_hash = translation_catalog::hash(this->msgid);
     }
 
 private:
     std::u8string msgid;
+    uint32_t msgid_hash;
 
     friend class label;
 };
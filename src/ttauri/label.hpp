@@ -79,6 +79,7 @@ public:
     label(tt::icon icon, l10n fmt, Args &&... args) noexcept :
         _icon(std::move(icon)),
         _msgid(std::move(fmt.msgid)),
+        _msgid_hash(fmt.msgid_hash),
         _args(std::make_unique<detail::label_arguments<std::remove_cvref_t<Args>...>>(std::forward<Args>(args)...))
     {
     }
@@ -93,7 +94,7 @@ public:
     label() noexcept : label(tt::icon{}, std::u8string_view{}) {}
 
     label(label const &other) noexcept :
-        _icon(other._icon), _msgid(other._msgid), _args(other._args->make_unique_copy())
+        _icon(other._icon), _msgid(other._msgid), _msgid_hash(other._msgid_hash), _args(other._args->make_unique_copy())
     {
     }
 
@@ -102,6 +103,7 @@ public:
         // Self-assignment is allowed.
         _icon = other._icon;
         _msgid = other._msgid;
+        _msgid_hash = other._msgid_hash;
         _args = other._args->make_unique_copy();
         return *this;
     }
@@ -126,7 +128,7 @@ public:
 
     [[nodiscard]] std::u8string text() const noexcept
     {
-        auto fmt = get_translation(_msgid);
+        auto fmt = get_translation(_msgid, _msgid_hash, 0, language::preferred_languages);
         tt_axiom(_args);
         return _args->format(fmt);
     }
@@ -155,6 +157,7 @@ public:
 private:
     tt::icon _icon;
     std::u8string _msgid;
+    uint32_t _msgid_hash;
     std::unique_ptr<detail::label_arguments_base> _args;
 };
 
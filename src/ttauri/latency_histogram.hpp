@@ -0,0 +1,149 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "required.hpp"
+#include "assert.hpp"
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+
+namespace tt {
+
+/** A lock-free log-linear histogram of durations.
+ *
+ * Each power of two of nanoseconds is split in `nr_sub_buckets` linear buckets, so that
+ * each recorded duration is off by at most 1/`nr_sub_buckets` of its value. Durations
+ * below `nr_sub_buckets` nanoseconds have a bucket each.
+ *
+ * Writes are a single relaxed atomic increment. The reader takes the counts and
+ * resets them at the same time, so that each read covers the interval since the previous read.
+ */
+class latency_histogram {
+public:
+    static constexpr int sub_bucket_bits = 3;
+    static constexpr size_t nr_sub_buckets = 1 << sub_bucket_bits;
+
+    /** Enough buckets for any non-negative int64_t number of nanoseconds.
+     */
+    static constexpr size_t nr_buckets = (64 - sub_bucket_bits + 1) * nr_sub_buckets;
+
+    /** The counts of a histogram taken by `read()`.
+     */
+    class result_type {
+    public:
+        /** The total number of durations.
+         */
+        [[nodiscard]] uint64_t count() const noexcept
+        {
+            return _count;
+        }
+
+        /** The duration at a percentile.
+         * @param fraction The percentile as a fraction between 0.0 and 1.0.
+         * @return The duration, or zero if there are no durations.
+         */
+        [[nodiscard]] std::chrono::nanoseconds percentile(double fraction) const noexcept
+        {
+            tt_axiom(fraction >= 0.0 && fraction <= 1.0);
+            if (_count == 0) {
+                return {};
+            }
+
+            // The number of durations at or below the percentile, at least one.
+            auto rank = static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(_count)));
+            if (rank == 0) {
+                rank = 1;
+            }
+
+            uint64_t cumulative = 0;
+            for (size_t i = 0; i != nr_buckets; ++i) {
+                cumulative += _buckets[i];
+                if (cumulative >= rank) {
+                    return std::chrono::nanoseconds{bucket_value(i)};
+                }
+            }
+            tt_no_default();
+        }
+
+    private:
+        std::array<uint64_t, nr_buckets> _buckets = {};
+        uint64_t _count = 0;
+
+        friend class latency_histogram;
+    };
+
+    constexpr latency_histogram() noexcept = default;
+    latency_histogram(latency_histogram const &) = delete;
+    latency_histogram(latency_histogram &&) = delete;
+    latency_histogram &operator=(latency_histogram const &) = delete;
+    latency_histogram &operator=(latency_histogram &&) = delete;
+
+    void write(std::chrono::nanoseconds duration) noexcept
+    {
+        ttlet ns = duration.count() > 0 ? static_cast<uint64_t>(duration.count()) : uint64_t{0};
+        _buckets[bucket_index(ns)].fetch_add(1, std::memory_order::relaxed);
+    }
+
+    /** Take the counts since the previous read and reset them.
+     */
+    [[nodiscard]] result_type read() noexcept
+    {
+        auto r = result_type{};
+        for (size_t i = 0; i != nr_buckets; ++i) {
+            ttlet count = _buckets[i].exchange(0, std::memory_order::relaxed);
+            r._buckets[i] = count;
+            r._count += count;
+        }
+        return r;
+    }
+
+    [[nodiscard]] static constexpr size_t bucket_index(uint64_t ns) noexcept
+    {
+        if (ns < nr_sub_buckets) {
+            return static_cast<size_t>(ns);
+        }
+
+        ttlet exponent = std::bit_width(ns) - 1;
+        ttlet sub_bucket = (ns >> (exponent - sub_bucket_bits)) & (nr_sub_buckets - 1);
+        return (exponent - sub_bucket_bits + 1) * nr_sub_buckets + sub_bucket;
+    }
+
+    /** The lowest duration in nanoseconds that is counted in a bucket.
+     */
+    [[nodiscard]] static constexpr uint64_t bucket_lower_bound(size_t index) noexcept
+    {
+        tt_axiom(index < nr_buckets);
+        if (index < nr_sub_buckets) {
+            return index;
+        }
+
+        ttlet exponent = index / nr_sub_buckets + sub_bucket_bits - 1;
+        ttlet sub_bucket = index % nr_sub_buckets;
+        return (nr_sub_buckets + sub_bucket) << (exponent - sub_bucket_bits);
+    }
+
+    /** The duration in nanoseconds that represents a bucket, halfway the bucket.
+     */
+    [[nodiscard]] static constexpr uint64_t bucket_value(size_t index) noexcept
+    {
+        ttlet lower = bucket_lower_bound(index);
+        if (index < nr_sub_buckets) {
+            return lower;
+        }
+
+        ttlet exponent = index / nr_sub_buckets + sub_bucket_bits - 1;
+        ttlet width = uint64_t{1} << (exponent - sub_bucket_bits);
+        return lower + width / 2;
+    }
+
+private:
+    std::array<std::atomic<uint64_t>, nr_buckets> _buckets = {};
+};
+
+} // namespace tt
@@ -0,0 +1,53 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/latency_histogram.hpp"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <limits>
+
+using namespace std;
+using namespace std::chrono_literals;
+using namespace tt;
+
+TEST(LatencyHistogram, BucketIndex)
+{
+    for (uint64_t ns = 0; ns != 100'000; ++ns) {
+        ttlet index = latency_histogram::bucket_index(ns);
+        ASSERT_LE(latency_histogram::bucket_lower_bound(index), ns);
+        if (index + 1 < latency_histogram::nr_buckets) {
+            ASSERT_GT(latency_histogram::bucket_lower_bound(index + 1), ns);
+        }
+    }
+
+    ASSERT_LT(latency_histogram::bucket_index(std::numeric_limits<uint64_t>::max()), latency_histogram::nr_buckets);
+}
+
+TEST(LatencyHistogram, Percentile)
+{
+    auto histogram = latency_histogram{};
+    for (auto i = 1; i <= 1000; ++i) {
+        histogram.write(i * 1us);
+    }
+
+    ttlet result = histogram.read();
+    ASSERT_EQ(result.count(), 1000);
+
+    // Each percentile is within the precision of the bucket size.
+    ASSERT_NEAR(static_cast<double>(result.percentile(0.5).count()), 500'000.0, 500'000.0 / latency_histogram::nr_sub_buckets);
+    ASSERT_NEAR(static_cast<double>(result.percentile(0.9).count()), 900'000.0, 900'000.0 / latency_histogram::nr_sub_buckets);
+    ASSERT_NEAR(static_cast<double>(result.percentile(0.99).count()), 990'000.0, 990'000.0 / latency_histogram::nr_sub_buckets);
+    ASSERT_EQ(result.percentile(0.0), result.percentile(0.001));
+}
+
+TEST(LatencyHistogram, ReadResets)
+{
+    auto histogram = latency_histogram{};
+    histogram.write(10ms);
+    ASSERT_EQ(histogram.read().count(), 1);
+
+    ttlet result = histogram.read();
+    ASSERT_EQ(result.count(), 0);
+    ASSERT_EQ(result.percentile(0.5), 0ns);
+}
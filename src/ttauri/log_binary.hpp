@@ -0,0 +1,229 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "required.hpp"
+#include "cast.hpp"
+#include "log_level.hpp"
+#include <fmt/format.h>
+#include <string>
+#include <string_view>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+
+namespace tt {
+
+/** The binary log format.
+ *
+ * A binary log starts with the 8 byte `log_binary_magic`, followed by records.
+ * Each record starts with a `uint32_t` size of the whole record and a `uint8_t` tag.
+ * A record with size zero marks the end of the log. Values are stored in native byte order.
+ *
+ * - `site` record: `uint32_t` id, `uint8_t` level, `uint32_t` source line,
+ *   then the source file, the format string and the argument type codes as strings.
+ * - `message` record: `uint32_t` site id, `int64_t` UTC nanoseconds since epoch,
+ *   then each argument encoded according to its type code.
+ *
+ * A string is stored as a `uint32_t` size followed by the characters.
+ */
+namespace log_binary {
+
+constexpr char magic[8] = {'T', 'T', 'B', 'L', 'O', 'G', '\0', '\1'};
+
+enum class record_tag : uint8_t { site = 'S', message = 'M' };
+
+/** The argument type codes.
+ * Arguments of other types are formatted with "{}" when written and stored as a string.
+ */
+enum class type_code : char {
+    boolean = 'b', ///< uint8_t
+    character = 'c', ///< char
+    signed_integer = 'i', ///< int64_t
+    unsigned_integer = 'u', ///< uint64_t
+    floating_point = 'f', ///< double
+    pointer = 'p', ///< uint64_t
+    string = 's', ///< string
+};
+
+template<typename T>
+[[nodiscard]] constexpr type_code get_type_code() noexcept
+{
+    if constexpr (std::is_same_v<T, bool>) {
+        return type_code::boolean;
+    } else if constexpr (std::is_same_v<T, char>) {
+        return type_code::character;
+    } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+        return type_code::signed_integer;
+    } else if constexpr (std::is_integral_v<T>) {
+        return type_code::unsigned_integer;
+    } else if constexpr (std::is_floating_point_v<T>) {
+        return type_code::floating_point;
+    } else if constexpr (std::is_pointer_v<T> && !std::is_same_v<T, char const *> && !std::is_same_v<T, char *>) {
+        return type_code::pointer;
+    } else {
+        return type_code::string;
+    }
+}
+
+/** The type codes of the arguments of a log message, as a nul terminated string.
+ */
+template<typename... Values>
+constexpr char type_codes[] = {static_cast<char>(get_type_code<Values>())..., '\0'};
+
+} // namespace log_binary
+
+/** Encodes log messages into the binary log format.
+ *
+ * The format string and source location of a log call is written only once as a site record;
+ * after that each message consists of the site id, the time stamp and the raw argument values,
+ * so that no formatting is done while logging.
+ *
+ * This object is only used by the logger while it holds the logger mutex.
+ */
+class log_binary_writer {
+public:
+    log_binary_writer() noexcept : _generation(++_nr_generations)
+    {
+        _buffer.append(log_binary::magic, sizeof(log_binary::magic));
+    }
+
+    log_binary_writer(log_binary_writer const &) = delete;
+    log_binary_writer(log_binary_writer &&) = delete;
+    log_binary_writer &operator=(log_binary_writer const &) = delete;
+    log_binary_writer &operator=(log_binary_writer &&) = delete;
+
+    /** The bytes that were encoded since the last `clear()`.
+     */
+    [[nodiscard]] std::string_view bytes() const noexcept
+    {
+        return _buffer;
+    }
+
+    void clear() noexcept
+    {
+        _buffer.clear();
+    }
+
+    /** Get the id of a log call site, writing its site record the first time.
+     *
+     * @param site_cache A variable owned by the log call site, initialized to zero.
+     * @return The id of the site in this binary log.
+     */
+    [[nodiscard]] uint32_t site(
+        uint64_t &site_cache,
+        log_level level,
+        char const *source_file,
+        int source_line,
+        char const *fmt,
+        char const *type_codes) noexcept
+    {
+        if ((site_cache >> 32) == _generation) {
+            [[likely]] return static_cast<uint32_t>(site_cache);
+        } else {
+            return add_site(site_cache, level, source_file, source_line, fmt, type_codes);
+        }
+    }
+
+    void message_begin(uint32_t site_id, int64_t utc_nanoseconds) noexcept
+    {
+        tt_axiom(_record_start == -1);
+        record_begin(log_binary::record_tag::message);
+        append(site_id);
+        append(utc_nanoseconds);
+    }
+
+    void message_end() noexcept
+    {
+        record_end();
+    }
+
+    template<typename T>
+    void argument(T const &value) noexcept
+    {
+        constexpr auto code = log_binary::get_type_code<T>();
+
+        if constexpr (code == log_binary::type_code::boolean) {
+            append(static_cast<uint8_t>(value));
+        } else if constexpr (code == log_binary::type_code::character) {
+            append(value);
+        } else if constexpr (code == log_binary::type_code::signed_integer) {
+            append(static_cast<int64_t>(value));
+        } else if constexpr (code == log_binary::type_code::unsigned_integer) {
+            append(static_cast<uint64_t>(value));
+        } else if constexpr (code == log_binary::type_code::floating_point) {
+            append(static_cast<double>(value));
+        } else if constexpr (code == log_binary::type_code::pointer) {
+            append(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value)));
+        } else if constexpr (std::is_convertible_v<T const &, std::string_view>) {
+            append_string(value);
+        } else {
+            append_string(fmt::format("{}", value));
+        }
+    }
+
+private:
+    /** The generation of this writer, in the upper 32 bits of a site cache.
+     * This makes the sites of a previous writer invalid, so they are written again.
+     */
+    uint64_t _generation;
+    uint32_t _nr_sites = 0;
+    std::string _buffer;
+    ssize_t _record_start = -1;
+
+    inline static uint64_t _nr_generations = 0;
+
+    template<typename T>
+    void append(T const &value) noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        _buffer.append(reinterpret_cast<char const *>(&value), sizeof(T));
+    }
+
+    void append_string(std::string_view str) noexcept
+    {
+        append(narrow_cast<uint32_t>(str.size()));
+        _buffer.append(str);
+    }
+
+    void record_begin(log_binary::record_tag tag) noexcept
+    {
+        _record_start = std::ssize(_buffer);
+        append(uint32_t{0});
+        append(tag);
+    }
+
+    void record_end() noexcept
+    {
+        tt_axiom(_record_start >= 0);
+        ttlet size = narrow_cast<uint32_t>(std::ssize(_buffer) - _record_start);
+        std::memcpy(_buffer.data() + _record_start, &size, sizeof(size));
+        _record_start = -1;
+    }
+
+    tt_no_inline uint32_t add_site(
+        uint64_t &site_cache,
+        log_level level,
+        char const *source_file,
+        int source_line,
+        char const *fmt,
+        char const *type_codes) noexcept
+    {
+        ttlet id = _nr_sites++;
+        site_cache = (_generation << 32) | id;
+
+        record_begin(log_binary::record_tag::site);
+        append(id);
+        append(level);
+        append(narrow_cast<uint32_t>(source_line));
+        append_string(source_file);
+        append_string(fmt);
+        append_string(type_codes);
+        record_end();
+        return id;
+    }
+};
+
+} // namespace tt
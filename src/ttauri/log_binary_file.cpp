@@ -0,0 +1,41 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "log_binary_file.hpp"
+#include "file.hpp"
+#include "file_mapping.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace tt {
+
+log_binary_file::log_binary_file(URL const &location) :
+    _file(std::make_shared<tt::file>(location, access_mode::truncate_or_create_for_write | access_mode::read))
+{
+    map_window(0);
+}
+
+void log_binary_file::map_window(size_t offset)
+{
+    // Creating a mapping larger than the file extends the file.
+    ttlet mapping = std::make_shared<file_mapping>(_file, offset + window_size);
+    _view.emplace(mapping, offset, window_size);
+    _position = 0;
+}
+
+void log_binary_file::write(std::string_view bytes)
+{
+    while (!bytes.empty()) {
+        if (_position == _view->size()) {
+            map_window(_view->offset() + _view->size());
+        }
+
+        ttlet size = std::min(bytes.size(), _view->size() - _position);
+        std::memcpy(_view->data() + _position, bytes.data(), size);
+        _position += size;
+        bytes = bytes.substr(size);
+    }
+}
+
+} // namespace tt
@@ -0,0 +1,53 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "file_view.hpp"
+#include "URL.hpp"
+#include <memory>
+#include <optional>
+#include <string_view>
+
+namespace tt {
+
+/** A binary log file that is written through a memory mapping.
+ *
+ * The file is mapped in windows of `window_size` bytes; when a window is full the
+ * file is extended and the next window is mapped. The part of the last window that
+ * was not written stays zero, which ends the log.
+ */
+class log_binary_file {
+public:
+    /** The size of a mapped window, a multiple of the allocation granularity of the operating systems.
+     */
+    static constexpr size_t window_size = 16 * 1024 * 1024;
+
+    /** Create or truncate the binary log file.
+     * @throws io_error When the file could not be created or mapped.
+     */
+    log_binary_file(URL const &location);
+
+    log_binary_file(log_binary_file const &) = delete;
+    log_binary_file(log_binary_file &&) = delete;
+    log_binary_file &operator=(log_binary_file const &) = delete;
+    log_binary_file &operator=(log_binary_file &&) = delete;
+
+    /** Copy bytes into the mapped file.
+     * @throws io_error When the next window could not be mapped.
+     */
+    void write(std::string_view bytes);
+
+private:
+    std::shared_ptr<tt::file> _file;
+    std::optional<file_view> _view;
+
+    /** The position of the next byte to write inside the current window.
+     */
+    size_t _position = 0;
+
+    void map_window(size_t offset);
+};
+
+} // namespace tt
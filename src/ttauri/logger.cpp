@@ -4,6 +4,7 @@
 
 #include "logger.hpp"
 #include "trace.hpp"
+#include "startup_profiler.hpp"
 #include "required.hpp"
 #include "URL.hpp"
 #include "strings.hpp"
@@ -12,6 +13,7 @@
 #include "timer.hpp"
 #include "unfair_recursive_mutex.hpp"
 #include "console.hpp"
+#include "log_binary_file.hpp"
 #include <fmt/ostream.h>
 #include <fmt/format.h>
 #include <exception>
@@ -20,6 +22,9 @@
 #include <ostream>
 #include <chrono>
 #include <thread>
+#include <mutex>
+#include <vector>
+#include <string>
 
 namespace tt {
 namespace detail {
@@ -35,20 +40,202 @@ static void logger_write(std::string const &str) noexcept
     console_output(str);
 }
 
-unfair_recursive_mutex logger_mutex;
+unfair_recursive_mutex_impl<"logger_mutex"> logger_mutex;
 std::jthread logger_thread;
 
+/** A binary log file with the writer that encodes the messages for it.
+ */
+struct logger_binary_sink_type {
+    log_binary_file file;
+    log_binary_writer writer;
+
+    logger_binary_sink_type(URL const &location) : file(location), writer() {}
+};
+
+/** The binary log, when it is open messages are encoded into it instead of formatted.
+ * Only used while logger_mutex is locked.
+ */
+std::unique_ptr<logger_binary_sink_type> logger_binary_sink;
+
+/** Format or encode a message.
+ *
+ * @param message The message to write.
+ * @param[out] text The formatted message is appended to it, when there is no binary log.
+ */
+static void logger_append(log_message_base const &message, std::string &text) noexcept
+{
+    if (logger_binary_sink) {
+        message.write_binary(logger_binary_sink->writer);
+    } else {
+        text += message.format();
+    }
+}
+
+/** Write the formatted messages to the console, and the encoded messages to the binary log.
+ */
+static void logger_write_all(std::string const &text) noexcept
+{
+    if (logger_binary_sink) {
+        try {
+            logger_binary_sink->file.write(logger_binary_sink->writer.bytes());
+            logger_binary_sink->writer.clear();
+        } catch (std::exception const &e) {
+            logger_binary_sink = nullptr;
+            logger_write(fmt::format("Could not write to the binary log, logging to the console: {}\n", e.what()));
+        }
+    }
+
+    if (!text.empty()) {
+        logger_write(text);
+    }
+}
+
+/** A log queue registered with the logger.
+ */
+struct log_queue_entry {
+    log_queue_type queue;
+
+    /** Set when the thread that owns the queue has exited.
+     * After the queue is drained it can be deallocated.
+     */
+    std::atomic<bool> abandoned = false;
+};
 
+/** Protects log_queues while threads are registered and the queues are flushed.
+ * When both are needed `logger_mutex` is locked first.
+ */
+std::mutex log_queues_mutex;
+std::vector<std::unique_ptr<log_queue_entry>> log_queues;
+
+/** Set when the current thread's log queue was released on thread exit.
+ */
+thread_local bool log_thread_queue_released = false;
+
+/** Releases the log queue of the thread on thread exit.
+ */
+struct log_thread_queue_owner {
+    log_queue_entry *entry;
+
+    ~log_thread_queue_owner()
+    {
+        log_thread_queue_ptr = nullptr;
+        log_thread_queue_released = true;
+        entry->abandoned.store(true, std::memory_order::release);
+    }
+};
+
+log_queue_type *log_thread_queue_register() noexcept
+{
+    if (log_thread_queue_released) {
+        return nullptr;
+    }
+
+    auto entry = std::make_unique<log_queue_entry>();
+    auto entry_ptr = entry.get();
+    {
+        ttlet lock = std::scoped_lock(log_queues_mutex);
+        log_queues.push_back(std::move(entry));
+    }
+
+    thread_local log_thread_queue_owner owner{entry_ptr};
+    return log_thread_queue_ptr = &entry_ptr->queue;
+}
+
+log_queue_item_type &log_queue_blocked(log_queue_type &queue) noexcept
+{
+    increment_counter<"logger_blocked">();
+
+    while (true) {
+        if (auto message = queue.try_write_start()) {
+            return *message;
+        }
+
+        if (logger_is_running.load(std::memory_order::relaxed)) {
+            std::this_thread::sleep_for(1ms);
+        } else {
+            // Degraded mode, there is no logger thread to drain the queue.
+            logger_flush();
+        }
+    }
+}
+
+void log_message_write(log_message_base const &message) noexcept
+{
+    ttlet lock = std::scoped_lock(logger_mutex);
+
+    // Write the messages that were logged in the queues before this one.
+    logger_flush();
+
+    auto text = std::string{};
+    logger_append(message, text);
+    logger_write_all(text);
+}
+
+/** Format the messages of all log queues in time-stamp order.
+ * Only the messages that are in the queues at the start are formatted,
+ * so that a busy thread can not keep the flush from finishing.
+ *
+ * @param[out] text The formatted messages are appended to it, when there is no binary log.
+ */
+static void logger_merge_queues(std::string &text) noexcept
+{
+    struct cursor_type {
+        log_queue_type *queue;
+        log_queue_type::index_type first;
+        log_queue_type::index_type last;
+    };
+
+    ttlet lock = std::scoped_lock(log_queues_mutex);
+
+    auto cursors = std::vector<cursor_type>{};
+    cursors.reserve(log_queues.size());
+    for (ttlet &entry : log_queues) {
+        ttlet first = entry->queue.read_first();
+        ttlet last = entry->queue.read_last();
+        if (first != last) {
+            cursors.push_back({&entry->queue, first, last});
+        }
+    }
+
+    while (!cursors.empty()) {
+        // There are only a few threads, so a linear search for the oldest message is fast enough.
+        auto oldest = cursors.begin();
+        auto oldest_count = (*oldest->queue)[oldest->first]->time_stamp().count();
+        for (auto it = oldest + 1; it != cursors.end(); ++it) {
+            ttlet count = (*it->queue)[it->first]->time_stamp().count();
+            if (count < oldest_count) {
+                oldest = it;
+                oldest_count = count;
+            }
+        }
+
+        auto &message = (*oldest->queue)[oldest->first];
+        logger_append(*message, text);
+
+        // Call the virtual-destructor of the `log_message_base`, so that it can skip this when
+        // adding messages to the queue.
+        message.reset();
+
+        if (++oldest->first == oldest->last) {
+            oldest->queue->read_finish(oldest->last);
+            cursors.erase(oldest);
+        }
+    }
+
+    // Deallocate the queues of threads that have exited, after all their messages are written.
+    std::erase_if(log_queues, [](ttlet &entry) {
+        return entry->abandoned.load(std::memory_order::acquire) && entry->queue.empty();
+    });
+}
 
 static void logger_thread_loop(std::stop_token stop_token) noexcept
 {
     set_thread_name("logger");
     tt_log_info("logger thread started");
 
-    while (!stop_token.stop_requested()) {
+    do {
         logger_flush();
-        std::this_thread::sleep_for(100ms);
-    }
+    } while (sleep_for(stop_token, 100ms));
 
     tt_log_info("logger thread finished");
 }
@@ -67,11 +254,12 @@ void logger_deinit() noexcept
 
 /** Initialize the log system.
  * This will start the logging threads which periodically
- * checks the log_queue for new messages and then
- * call log_flush_messages().
+ * checks the log queues for new messages and then
+ * call logger_flush().
  */
 bool logger_init() noexcept
 {
+    ttlet phase = startup_phase{"logger_start"};
     ttlet lock = std::scoped_lock(logger_mutex);
     logger_thread = std::jthread(logger_thread_loop);
     return true;
@@ -79,22 +267,33 @@ bool logger_init() noexcept
 
 }
 
-/** Flush all messages from the log_queue directly from this thread.
+/** Flush all messages from the log queues directly from this thread.
  */
 void logger_flush() noexcept
 {
     ttlet t = trace<"log_flush">{};
     ttlet lock = std::scoped_lock(detail::logger_mutex);
 
-    while (!detail::log_queue.empty()) {
-        auto message = detail::log_queue.read();
+    auto text = std::string{};
+    detail::logger_merge_queues(text);
+    detail::logger_write_all(text);
+}
 
-        detail::logger_write((*message)->format());
+void logger_open_binary_log(URL const &location)
+{
+    ttlet lock = std::scoped_lock(detail::logger_mutex);
 
-        // Call the virtual-destructor of the `log_message_base`, so that it can skip this when
-        // adding messages to the queue.
-        message->reset();
-    }
+    // The messages that were logged before are still written to the console.
+    logger_flush();
+    detail::logger_binary_sink = std::make_unique<detail::logger_binary_sink_type>(location);
+}
+
+void logger_close_binary_log() noexcept
+{
+    ttlet lock = std::scoped_lock(detail::logger_mutex);
+
+    logger_flush();
+    detail::logger_binary_sink = nullptr;
 }
 
 } // namespace tt
@@ -8,16 +8,18 @@
 #include "time_stamp_count.hpp"
 #include "hires_utc_clock.hpp"
 #include "polymorphic_optional.hpp"
-#include "wfree_message_queue.hpp"
+#include "spsc_message_queue.hpp"
 #include "atomic.hpp"
 #include "meta.hpp"
 #include "format.hpp"
 #include "source_location.hpp"
 #include "os_detect.hpp"
 #include "delayed_format.hpp"
+#include "compiled_format.hpp"
 #include "fixed_string.hpp"
 #include "subsystem.hpp"
 #include "log_level.hpp"
+#include "log_binary.hpp"
 #include <date/tz.h>
 #include <fmt/format.h>
 #include <fmt/ostream.h>
@@ -28,6 +30,8 @@
 #include <atomic>
 namespace tt {
 void trace_record() noexcept;
+void trace_recorder_fatal_dump() noexcept;
+class URL;
 }
 
 namespace tt {
@@ -35,7 +39,7 @@ namespace detail {
 
 class log_message_base {
 public:
-    log_message_base() noexcept = default;
+    log_message_base(time_stamp_count time_stamp) noexcept : _time_stamp(time_stamp) {}
     virtual ~log_message_base() = default;
 
     log_message_base(log_message_base const &) = delete;
@@ -43,50 +47,142 @@ public:
     log_message_base &operator=(log_message_base const &) = delete;
     log_message_base &operator=(log_message_base &&) = delete;
 
+    /** The time when the message was logged.
+     * Used to merge the messages from the per-thread queues in order.
+     */
+    [[nodiscard]] time_stamp_count time_stamp() const noexcept
+    {
+        return _time_stamp;
+    }
+
     virtual std::string format() const noexcept = 0;
+
+    /** Encode the message for the binary log, instead of formatting it.
+     */
+    virtual void write_binary(log_binary_writer &writer) const noexcept = 0;
+
+protected:
+    time_stamp_count _time_stamp;
+
+    /** Append the time of the message in ISO-8601 format.
+     * Each thread keeps its own formatter, which reuses the date and time of the previous
+     * message when it was logged in the same second.
+     */
+    void format_time_stamp_to(std::string &out) const noexcept
+    {
+        thread_local auto formatter = iso8601_formatter{};
+        formatter.format_to(out, hires_utc_clock::make(_time_stamp));
+    }
 };
 
 template<log_level Level, basic_fixed_string SourceFile, int SourceLine, basic_fixed_string Fmt, typename... Values>
 class log_message : public log_message_base {
 public:
-    static_assert(std::is_same_v<decltype(SourceFile)::value_type, char>, "SourceFile must be a basic_fixed_string<char>");
-    static_assert(std::is_same_v<decltype(Fmt)::value_type, char>, "Fmt must be a basic_fixed_string<char>");
+    static_assert(std::is_same_v<typename decltype(SourceFile)::value_type, char>, "SourceFile must be a basic_fixed_string<char>");
+    static_assert(std::is_same_v<typename decltype(Fmt)::value_type, char>, "Fmt must be a basic_fixed_string<char>");
 
     template<typename... Args>
     log_message(Args &&...args) noexcept :
-        _time_stamp(time_stamp_count::now(std::memory_order::relaxed)), _what(std::forward<Args>(args)...)
+        log_message_base(time_stamp_count::now(std::memory_order::relaxed)), _what(std::forward<Args>(args)...)
     {
     }
 
     std::string format() const noexcept override
     {
-        ttlet time_point = hires_utc_clock::make(_time_stamp);
-        ttlet local_timestring = format_iso8601(time_point);
-
+        auto r = std::string{};
+        format_time_stamp_to(r);
+        compiled_format<" {:5} ">::format_to(r, to_const_string(Level));
+        _what.format_to(r);
         if constexpr (static_cast<bool>(Level & log_level::statistics)) {
-            return fmt::format("{} {:5} {}\n", local_timestring, to_const_string(Level), _what());
+            r += '\n';
         } else {
-            return fmt::format("{} {:5} {} ({}:{})\n", local_timestring, to_const_string(Level), _what(), SourceFile, SourceLine);
+            compiled_format<" ({}:{})\n">::format_to(r, std::string_view{SourceFile}, SourceLine);
         }
+        return r;
+    }
+
+    void write_binary(log_binary_writer &writer) const noexcept override
+    {
+        ttlet site_id = writer.site(_binary_site, Level, SourceFile, SourceLine, Fmt, log_binary::type_codes<Values...>);
+        ttlet time_point = hires_utc_clock::make(_time_stamp);
+        writer.message_begin(site_id, time_point.time_since_epoch().count());
+        std::apply(
+            [&writer](auto const &...values) {
+                (writer.argument(values), ...);
+            },
+            _what.values());
+        writer.message_end();
     }
 
 private:
-    time_stamp_count _time_stamp;
     delayed_format<Fmt, Values...> _what;
+
+    /** The id of this log call in the current binary log, see `log_binary_writer::site()`.
+     */
+    inline static uint64_t _binary_site = 0;
 };
 
 //template<log_level Level, basic_fixed_string SourceFile, int SourceLine, basic_fixed_string Fmt, typename... Args>
 //log_message(time_stamp_count, Args &&...) -> log_message<Level, SourceFile, SourceLine, Fmt, forward_value_t<Args>...>;
 
 static constexpr size_t MAX_MESSAGE_SIZE = 224;
-static constexpr size_t MAX_NR_MESSAGES = 4096;
+static constexpr size_t MAX_NR_MESSAGES = 1024;
 
 using log_queue_item_type = polymorphic_optional<log_message_base, MAX_MESSAGE_SIZE>;
-using log_queue_type = wfree_message_queue<log_queue_item_type, MAX_NR_MESSAGES>;
 
-/** The global log queue contains messages to be displayed by the logger thread.
+/** Report a log message that does not fit in the log queue and is allocated on the heap.
+ * When build with TT_LOG_MESSAGE_SIZE_REPORT each such message causes a deprecation warning,
+ * which shows the size of the message and in its instantiation context the log call.
+ */
+template<size_t MessageSize, size_t MaxMessageSize>
+#if TT_LOG_MESSAGE_SIZE_REPORT
+[[deprecated("The log message is larger than MAX_MESSAGE_SIZE and is allocated on the heap.")]]
+#endif
+constexpr void log_message_is_allocated_on_heap() noexcept
+{
+}
+
+/** The counter tag for the log messages of a call that are allocated on the heap.
+ * The tag includes the source location and the size of the message, for sizing `MAX_MESSAGE_SIZE`.
+ */
+template<basic_fixed_string SourceFile, int SourceLine, size_t MessageSize>
+constexpr auto log_heap_counter_tag = basic_fixed_string("logger_heap:") + SourceFile + basic_fixed_string(":") +
+    to_fixed_string<SourceLine>() + basic_fixed_string(":") + to_fixed_string<MessageSize>();
+using log_queue_type = spsc_message_queue<log_queue_item_type, MAX_NR_MESSAGES>;
+
+/** The log queue of the current thread.
+ * nullptr until the first message is logged, and again after the thread's queue was released on thread exit.
  */
-inline log_queue_type log_queue;
+inline thread_local log_queue_type *log_thread_queue_ptr = nullptr;
+
+/** Allocate the log queue of the current thread and register it with the logger.
+ * @return The log queue, or nullptr when the thread is exiting and its queue was already released.
+ */
+tt_no_inline log_queue_type *log_thread_queue_register() noexcept;
+
+/** Get the log queue of the current thread.
+ * Every thread writes into its own single-producer queue, so that logging threads
+ * do not contend with each other; the logger thread merges the queues in time-stamp order.
+ *
+ * @return The log queue, or nullptr when the thread is exiting and its queue was already released.
+ */
+[[nodiscard]] inline log_queue_type *log_thread_queue() noexcept
+{
+    if (auto queue = log_thread_queue_ptr) {
+        [[likely]] return queue;
+    } else {
+        return log_thread_queue_register();
+    }
+}
+
+/** Wait until there is space in a full log queue.
+ * @return The message slot, as returned by `log_queue_type::try_write_start()`.
+ */
+tt_no_inline log_queue_item_type &log_queue_blocked(log_queue_type &queue) noexcept;
+
+/** Write a message directly from the current thread, bypassing the log queues.
+ */
+tt_no_inline void log_message_write(log_message_base const &message) noexcept;
 
 /** Deinitalize the logger system.
  */
@@ -94,8 +190,8 @@ tt_no_inline void logger_deinit() noexcept;
 
 /** Initialize the log system.
  * This will start the logging threads which periodically
- * checks the log_queue for new messages and then
- * call log_flush_messages().
+ * checks the log queues for new messages and then
+ * call logger_flush().
  */
 tt_no_inline bool logger_init() noexcept;
 
@@ -107,12 +203,27 @@ inline std::atomic<bool> logger_is_running = false;
  */
 [[nodiscard]] std::string get_last_error_message() noexcept;
 
-/** Flush all messages from the log_queue directly from this thread.
+/** Flush all messages from the log queues directly from this thread.
  * Flushing includes writing the message to a log file or displaying
  * them on the console.
+ *
+ * The messages of all threads are merged in time-stamp order and written
+ * in a single call.
  */
 tt_no_inline void logger_flush() noexcept;
 
+/** Write log messages to a binary log file, instead of the console.
+ * The messages are encoded without formatting; use the `decode_binary_log` tool to read the file.
+ *
+ * @param location The file to create or truncate.
+ * @throws io_error When the file could not be created.
+ */
+void logger_open_binary_log(URL const &location);
+
+/** Flush the log and close the binary log, messages are written to the console again.
+ */
+void logger_close_binary_log() noexcept;
+
 /** Start the logger system.
  * Initialize the logger system if it is not already initialized and while the system is not in shutdown-mode.
  * @return true if the logger system is initialized, false when the system is being shutdown.
@@ -145,15 +256,36 @@ void log(Args &&...args) noexcept
         return;
     }
 
-    // Add messages in the queue, block when full.
+    using message_type = detail::log_message<Level, SourceFile, SourceLine, Fmt, forward_value_t<Args>...>;
+
+    // Add messages in the queue of this thread, block when full.
     // * This reduces amount of instructions needed to be executed during logging.
     // * Simplifies logged_fatal_message logic.
     // * Will make sure everything gets logged.
-    // * Blocking is bad in a real time thread, so maybe count the number of times it is blocked.
+    // * Blocking is bad in a real time thread, so the number of times it is blocked is counted.
+    if (auto queue = detail::log_thread_queue()) {
+        auto message = queue->try_write_start();
+        if (message == nullptr) {
+            [[unlikely]] message = &detail::log_queue_blocked(*queue);
+        }
 
-    // Emplace a message directly on the queue.
-    detail::log_queue.write<"logger_blocked">()
-        ->emplace<detail::log_message<Level, SourceFile, SourceLine, Fmt, forward_value_t<Args>...>>(std::forward<Args>(args)...);
+        // Emplace a message directly on the queue.
+        message->emplace<message_type>(std::forward<Args>(args)...);
+        queue->write_finish();
+
+        // Count how often messages are stored in the queue, or allocated on the heap when they are too large.
+        if constexpr (detail::log_queue_item_type::fits_inline<message_type>) {
+            increment_counter<"logger_inline">();
+        } else {
+            detail::log_message_is_allocated_on_heap<sizeof(message_type), detail::MAX_MESSAGE_SIZE>();
+            increment_counter<"logger_heap">();
+            increment_counter<detail::log_heap_counter_tag<SourceFile, SourceLine, sizeof(message_type)>>();
+        }
+
+    } else {
+        // The thread is exiting and its queue was already released.
+        detail::log_message_write(message_type(std::forward<Args>(args)...));
+    }
 
     if (static_cast<bool>(Level & log_level::fatal) || !detail::logger_is_running.load(std::memory_order::relaxed)) {
         // If the logger did not start we will log in degraded mode and log from the current thread.
@@ -162,6 +294,7 @@ void log(Args &&...args) noexcept
     }
 
     if constexpr (static_cast<bool>(Level & log_level::fatal)) {
+        trace_recorder_fatal_dump();
         std::terminate();
 
     } else if constexpr (static_cast<bool>(Level & log_level::error)) {
@@ -0,0 +1,63 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/logger.hpp"
+#include "ttauri/allocation_tracker.hpp"
+#include "ttauri/URL.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace std;
+using namespace tt;
+
+/** Start the logger thread, writing to a binary log so that the console does not
+ * slow down the logger thread or pollute the benchmark output.
+ */
+static void start_logger_bench() noexcept
+{
+    static ttlet r = [] {
+        logger_start();
+        try {
+            logger_open_binary_log(URL("file:ttauri_bench.tlog"));
+        } catch (...) {
+        }
+        return true;
+    }();
+    (void)r;
+}
+
+static void logger_info(benchmark::State &state)
+{
+    start_logger_bench();
+    ttlet prev_level = log_level_global.exchange(make_log_level(log_level::debug));
+
+    auto i = 0;
+    ttlet scope = allocation_scope{};
+    for (auto _ : state) {
+        tt_log_info("Benchmark message {} {}", i++, 3.14);
+    }
+    state.SetItemsProcessed(state.iterations());
+    if constexpr (allocation_tracking_is_enabled) {
+        state.counters["allocations"] =
+            benchmark::Counter(static_cast<double>(scope.allocations().count), benchmark::Counter::kAvgIterations);
+    }
+
+    logger_flush();
+    log_level_global.store(prev_level);
+}
+BENCHMARK(logger_info)->Threads(1)->Threads(4);
+
+static void logger_filtered(benchmark::State &state)
+{
+    start_logger_bench();
+    ttlet prev_level = log_level_global.exchange(make_log_level(log_level::warning));
+
+    auto i = 0;
+    for (auto _ : state) {
+        tt_log_debug("Benchmark message {} {}", i++, 3.14);
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    log_level_global.store(prev_level);
+}
+BENCHMARK(logger_filtered);
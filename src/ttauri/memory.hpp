@@ -8,6 +8,8 @@
 #include "assert.hpp"
 #include "concepts"
 #include <memory>
+#include <cstring>
+#include <type_traits>
 #include <vector>
 #include <map>
 #include <unordered_map>
@@ -96,7 +98,13 @@ void placement_move_within_array(T *src_first, T *src_last, T *dst_first)
 {
     tt_axiom(src_last >= src_first);
 
-    if (src_first < dst_first) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        // Trivially copyable objects are relocated with a single memmove, which handles the overlap.
+        if (src_first != dst_first and src_first != src_last) {
+            std::memmove(dst_first, src_first, static_cast<size_t>(src_last - src_first) * sizeof(T));
+        }
+
+    } else if (src_first < dst_first) {
         auto dst_last = dst_first + (src_last - src_first);
 
         auto src = src_last;
@@ -130,8 +138,14 @@ void placement_move(T *src, T *src_last, T *dst)
 {
     tt_axiom(src_last >= src);
 
-    while (src != src_last) {
-        placement_move(src++, dst++);
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        if (src != src_last) {
+            std::memcpy(dst, src, static_cast<size_t>(src_last - src) * sizeof(T));
+        }
+    } else {
+        while (src != src_last) {
+            placement_move(src++, dst++);
+        }
     }
 }
 
@@ -0,0 +1,174 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "required.hpp"
+#include "assert.hpp"
+#include "counters.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+namespace tt {
+
+/** A monotonic memory resource for allocations that only live until the next reset.
+ *
+ * Memory is handed out by bumping a pointer and deallocation does nothing. All the
+ * memory is reclaimed at once by `reset()`, which keeps the memory for reuse.
+ *
+ * When more memory was needed than the first chunk could hold, the chunks are replaced by a
+ * single chunk of their combined size on the next allocation after the reset. After a few resets
+ * with a steady amount of allocation the arena makes no more calls to its upstream resource;
+ * the `monotonic_arena:upstream` counter counts these calls.
+ *
+ * This class is not thread-safe.
+ */
+class monotonic_arena final : public std::pmr::memory_resource {
+public:
+    /**
+     * @param initial_size The size of the first chunk allocated from upstream.
+     * @param upstream The resource to allocate the chunks from.
+     */
+    explicit monotonic_arena(
+        size_t initial_size = 65536,
+        std::pmr::memory_resource *upstream = std::pmr::new_delete_resource()) noexcept :
+        _upstream(upstream), _next_chunk_size(std::max(initial_size, min_chunk_size))
+    {
+        tt_axiom(upstream != nullptr);
+    }
+
+    ~monotonic_arena()
+    {
+        release();
+    }
+
+    monotonic_arena(monotonic_arena const &) = delete;
+    monotonic_arena(monotonic_arena &&) = delete;
+    monotonic_arena &operator=(monotonic_arena const &) = delete;
+    monotonic_arena &operator=(monotonic_arena &&) = delete;
+
+    /** The number of bytes allocated since the last reset.
+     */
+    [[nodiscard]] size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    /** The number of bytes of all the chunks, including their headers.
+     */
+    [[nodiscard]] size_t capacity() const noexcept
+    {
+        auto r = size_t{0};
+        for (auto *c = _chunks; c != nullptr; c = c->previous) {
+            r += c->size;
+        }
+        return r;
+    }
+
+    /** Reclaim all the memory that was allocated from the arena.
+     * All the objects allocated from the arena must have been destroyed.
+     */
+    void reset() noexcept
+    {
+        if (_chunks != nullptr && _chunks->previous != nullptr) {
+            // Get a single chunk that can hold all the allocations on the next use.
+            _next_chunk_size = std::max(_next_chunk_size, capacity());
+            release();
+
+        } else if (_chunks != nullptr) {
+            _ptr = _chunks->data();
+        }
+        _size = 0;
+    }
+
+    /** Return all the memory to the upstream resource.
+     */
+    void release() noexcept
+    {
+        while (_chunks != nullptr) {
+            auto *previous = _chunks->previous;
+            ttlet size = _chunks->size;
+            _chunks->~chunk();
+            _upstream->deallocate(_chunks, size, alignof(chunk));
+            _chunks = previous;
+        }
+        _ptr = nullptr;
+        _end = nullptr;
+    }
+
+protected:
+    void *do_allocate(size_t bytes, size_t alignment) override
+    {
+        auto *p = align(_ptr, alignment);
+        if (p == nullptr || bytes > static_cast<size_t>(_end - p)) {
+            [[unlikely]] p = grow(bytes, alignment);
+        }
+
+        _ptr = p + bytes;
+        _size += bytes;
+        return p;
+    }
+
+    void do_deallocate(void *, size_t, size_t) override {}
+
+    [[nodiscard]] bool do_is_equal(std::pmr::memory_resource const &other) const noexcept override
+    {
+        return this == &other;
+    }
+
+private:
+    static constexpr size_t min_chunk_size = 4096;
+
+    struct alignas(std::max_align_t) chunk {
+        chunk *previous;
+        size_t size;
+
+        [[nodiscard]] std::byte *data() noexcept
+        {
+            return reinterpret_cast<std::byte *>(this + 1);
+        }
+
+        [[nodiscard]] std::byte *end() noexcept
+        {
+            return reinterpret_cast<std::byte *>(this) + size;
+        }
+    };
+
+    std::pmr::memory_resource *_upstream;
+
+    /** The most recently allocated chunk, the older chunks are linked through `chunk::previous`.
+     */
+    chunk *_chunks = nullptr;
+    std::byte *_ptr = nullptr;
+    std::byte *_end = nullptr;
+    size_t _size = 0;
+    size_t _next_chunk_size;
+
+    [[nodiscard]] static std::byte *align(std::byte *p, size_t alignment) noexcept
+    {
+        ttlet i = reinterpret_cast<uintptr_t>(p);
+        return reinterpret_cast<std::byte *>((i + alignment - 1) & ~(alignment - 1));
+    }
+
+    tt_no_inline std::byte *grow(size_t bytes, size_t alignment)
+    {
+        increment_counter<"monotonic_arena:upstream">();
+
+        ttlet needed = sizeof(chunk) + bytes + alignment;
+        ttlet size = std::max(_next_chunk_size, needed);
+        _next_chunk_size = size * 2;
+
+        auto *c = new (_upstream->allocate(size, alignof(chunk))) chunk{_chunks, size};
+        _chunks = c;
+        _end = c->end();
+
+        auto *p = align(c->data(), alignment);
+        tt_axiom(bytes <= static_cast<size_t>(_end - p));
+        return p;
+    }
+};
+
+} // namespace tt
@@ -0,0 +1,56 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/monotonic_arena.hpp"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+using namespace std;
+using namespace tt;
+
+TEST(MonotonicArena, Alignment)
+{
+    auto arena = monotonic_arena{};
+
+    for (size_t alignment = 1; alignment <= 64; alignment *= 2) {
+        auto *p = arena.allocate(3, alignment);
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(p) % alignment, 0);
+    }
+}
+
+TEST(MonotonicArena, LargeAllocation)
+{
+    auto arena = monotonic_arena{4096};
+
+    auto *p = static_cast<std::byte *>(arena.allocate(100'000, 16));
+    std::fill(p, p + 100'000, std::byte{1});
+    ASSERT_GE(arena.capacity(), 100'000);
+    ASSERT_EQ(arena.size(), 100'000);
+}
+
+TEST(MonotonicArena, SteadyState)
+{
+    auto arena = monotonic_arena{4096};
+
+    auto frame = [&arena] {
+        arena.reset();
+        auto v = std::pmr::vector<int>{&arena};
+        for (int i = 0; i != 10'000; ++i) {
+            v.push_back(i);
+        }
+        ASSERT_EQ(v[9'999], 9'999);
+    };
+
+    // The first frames grow the arena until a single chunk holds a whole frame.
+    frame();
+    frame();
+
+    ttlet upstream = read_counter<"monotonic_arena:upstream">();
+    for (int i = 0; i != 10; ++i) {
+        frame();
+    }
+    ASSERT_EQ(read_counter<"monotonic_arena:upstream">(), upstream);
+}
@@ -6,6 +6,12 @@
 
 #pragma once
 
+#include "../required.hpp"
+#include "../assert.hpp"
+#include "packet_pool.hpp"
+#include <cstddef>
+#include <span>
+
 namespace tt {
 
 /** A network message or stream buffer.
@@ -19,24 +25,27 @@ class packet {
 
 public:
     /** Allocate an empty packet of a certain size.
+     * The buffer comes from the packet pool, so the packet may be larger than requested.
      */
     packet(ssize_t nrBytes) noexcept {
-        data = new std::byte [nrBytes];
-        data_end = data + nrBytes;
+        ttlet buffer = packet_pool::allocate(static_cast<size_t>(nrBytes));
+        data = buffer.data();
+        data_end = data + buffer.size();
         first = data;
         last = data;
     }
 
     ~packet() noexcept {
-        delete [] data;
+        packet_pool::deallocate({data, data_end});
     }
 
     packet(packet const &rhs) noexcept = delete;
     packet operator=(packet const &rhs) noexcept = delete;
 
     packet(packet &&rhs) noexcept :
-        data(rhs.data), data_end(rhs.data_end), first(rhs.first), last(rhs.last) {
+        data(rhs.data), data_end(rhs.data_end), first(rhs.first), last(rhs.last), _pushed(rhs._pushed) {
         rhs.data = nullptr;
+        rhs.data_end = nullptr;
     }
 
 
@@ -48,6 +57,12 @@ public:
         return last;
     }
 
+    /** The bytes that can be read from this buffer.
+     */
+    [[nodiscard]] std::span<std::byte const> readSpan() const noexcept {
+        return {first, last};
+    }
+
     /** How many bytes can be read from this buffer.
      */
     [[nodiscard]] ssize_t readSize() const noexcept {
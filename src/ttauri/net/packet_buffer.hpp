@@ -5,12 +5,28 @@
 
 #pragma once
 
+#include "packet.hpp"
+#include "../check.hpp"
+#include <list>
+#include <span>
+#include <string_view>
+#include <algorithm>
+#include <limits>
+#include <cstring>
+
 namespace tt {
 
+/** A buffer of data to be send to, or received from, a socket.
+ *
+ * The data is stored in a list of packets, so that data is never moved when the buffer grows.
+ * The packets can be passed to the socket with a single scatter/gather system call, and parsers can
+ * consume the data directly from the packets using `spans()`; only `peek()` and `peekLine()` copy data
+ * when it spans multiple packets.
+ */
 class packet_buffer {
     std::list<packet> packets;
-    ssize_t _totalNrBytes;
-    bool _closed;
+    ssize_t _totalNrBytes = 0;
+    bool _closed = false;
 
 public:
     /** Connection is closed.
@@ -32,7 +48,7 @@ public:
      * than zero when data is available.
      */
     ssize_t nrpackets() const noexcept {
-        return packets.size();
+        return std::ssize(packets);
     }
 
     /** Close the connection on this side.
@@ -47,9 +63,9 @@ public:
     std::span<std::byte> getNewpacket(ssize_t nrBytes) noexcept {
         tt_assert(!closed());
         packets.emplace_back(nrBytes);
-        return {packets.back().end(), nrBytes};
+        return {packets.back().end(), static_cast<size_t>(nrBytes)};
     }
-   
+
     /** Get a packet to write a stream of bytes into.
      * @return a pointer to an byte array with at least nrBytes of data available.
      */
@@ -58,9 +74,9 @@ public:
         if (packets.empty() || (packets.back().writeSize() < nrBytes)) {
             packets.emplace_back(nrBytes);
         }
-        return {packets.back().end(), nrBytes};
+        return {packets.back().end(), static_cast<size_t>(nrBytes)};
     }
-   
+
     /** Write the data added to the packet.
      * This function will write the data added into the buffers returned
      * by `getNewpacket()` and `getpacket()`.
@@ -77,87 +93,127 @@ public:
         _totalNrBytes += nrBytes;
     }
 
+    /** Get the data as a list of contiguous spans, without copying.
+     * Use this to pass the data to a scatter/gather system call, or to a parser that
+     * does not need the data to be contiguous.
+     *
+     * @param spans The spans to fill in, one for each packet.
+     * @param nrBytes The maximum number of bytes.
+     * @return The number of spans that were filled in.
+     */
+    size_t spans(std::span<std::span<std::byte const>> spans, ssize_t nrBytes = std::numeric_limits<ssize_t>::max()) const noexcept {
+        return spansAt(0, spans, nrBytes);
+    }
+
+    /** Get the data after an offset as a list of contiguous spans, without copying.
+     * This lets a parser continue where it stopped, without scanning the data again.
+     *
+     * @param offset The number of bytes to skip.
+     * @param spans The spans to fill in, one for each packet.
+     * @param nrBytes The maximum number of bytes.
+     * @return The number of spans that were filled in.
+     */
+    size_t spansAt(ssize_t offset, std::span<std::span<std::byte const>> spans, ssize_t nrBytes = std::numeric_limits<ssize_t>::max()) const noexcept {
+        auto r = 0_uz;
+        for (auto it = packets.begin(); it != packets.end() and r != spans.size() and nrBytes > 0; ++it) {
+            auto span = it->readSpan();
+            if (offset >= std::ssize(span)) {
+                offset -= std::ssize(span);
+                continue;
+            }
+            span = span.subspan(static_cast<size_t>(offset));
+            offset = 0;
+
+            if (std::ssize(span) > nrBytes) {
+                span = span.first(static_cast<size_t>(nrBytes));
+            }
+            nrBytes -= std::ssize(span);
+            spans[r++] = span;
+        }
+        return r;
+    }
+
     /** Peek into the data without consuming.
+     * When the data spans multiple packets, the packets are merged into the first packet.
+     *
      * @param nrBytes the minimum amount of data required.
      * @return empty if not enough bytes available; otherwise the data.
      *         The returned size may be larger than requested and
      *         this data may be consumed using `read()`.
      */
     std::span<std::byte const> peek(ssize_t nrBytes) {
-        if (packets.empty() || size() < nrBytes) {
+        if (packets.empty() || nrBytes > _totalNrBytes) {
             return {};
         }
 
-        while (true) {
-            if (packets.front().readSize() >= nrBytes) {
-                return {packets.front().readSize(), std::ssize(packets)};
+        if (packets.front().readSize() < nrBytes) {
+            // Merge the data of the first packets into a new packet.
+            auto merged = packet{nrBytes};
+            while (merged.readSize() < nrBytes) {
+                auto &front = packets.front();
+                ttlet n = std::min(front.readSize(), nrBytes - merged.readSize());
+                std::memcpy(merged.end(), front.begin(), static_cast<size_t>(n));
+                merged.write(n);
+                front.read(n);
+                if (front.readSize() == 0) {
+                    packets.pop_front();
+                }
             }
-
-            // Check if we can merge packets.
-            tt_assert(packets.front().size() >= nrBytes);
-
-            // Merge data from next packet.
+            packets.push_front(std::move(merged));
         }
+
+        return packets.front().readSpan();
     }
 
     /** Peek into the data a single text-line without consuming.
      * Throws parse_error when the line is longer than nrBytes.
      *
+     * Each call scans from the start of the buffer; use a `line_framer` for long lines that arrive slowly.
+     *
      * @param nrBytes maximum line size
      * @return empty if there are no lines; otherwise a line of data.
      *         The line-feed or nul is included at the end of the string.
      */
     std::string_view peekLine(ssize_t nrBytes=1024) {
-        ssize_t packetNr = 0;
         ssize_t byteNr = 0;
-        ssize_t i = 0;
-        while (packetNr < nrpackets()) {
-            tt_parse_check(byteNr < nrBytes, "New-line not found within {} bytes", nrBytes);
-
-            if (i == std::ssize(packets[packetNr])) {
-                // Advance to next packet.
-                ++packetNr;
-                i = 0;
+        for (auto &packet_ : packets) {
+            for (ttlet c : packet_.readSpan()) {
+                tt_parse_check(byteNr < nrBytes, "New-line not found within {} bytes", nrBytes);
+                ++byteNr;
+
+                if (c == std::byte{'\n'} || c == std::byte{'\0'}) {
+                    // Found end-of-line
+                    ttlet bspan = peek(byteNr);
+                    return {reinterpret_cast<char const *>(bspan.data()), static_cast<size_t>(byteNr)};
+                }
             }
-
-            ttlet c = packets[packetNr][i]
-            if (c == '\n' || c == '\0') {
-                // Found end-of-line
-                ttlet bspan = peek(byteNr + 1);
-                return {reinterpret_cast<char *>(bspan.data(), byteNr + 1};
-            }
-            ++i;
-            ++byteNr;
         }
 
         // Not enough bytes read yet.
-        return {}
+        return {};
     }
 
     /** Consume the data from the buffer.
-     * This function will consume the data read using `peek()` and
-     * `peekLine()`.
+     * This function will consume the data read using `peek()`, `peekLine()` and `spans()`.
      *
      * @param nrBytes The number of bytes to consume.
      */
     void read(ssize_t nrBytes) noexcept {
-        peekBuffer.clear();
+        tt_axiom(nrBytes <= _totalNrBytes);
+        _totalNrBytes -= nrBytes;
 
         while (nrBytes) {
-            ttlet packet_size = std::ssize(packets.front());
-            if (nrBytes >= packet_size) {
+            auto &front = packets.front();
+            ttlet n = std::min(front.readSize(), nrBytes);
+            front.read(n);
+            nrBytes -= n;
+
+            // Keep the last packet when it can hold more data.
+            if (front.readSize() == 0 and (std::ssize(packets) > 1 or front.writeSize() == 0)) {
                 packets.pop_front();
-            } else {
-                packets.front().read(nrBytes);
-                tt_axiom(std::ssize(packets.front()) > 0);
             }
-            nrBytes -= std::ssize(packets_size);
         }
     }
-
-
 };
 
-
 }
-
@@ -0,0 +1,364 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "packet_buffer.hpp"
+#include "../codec/UTF.hpp"
+#include "../codec/BON8.hpp"
+#include "../os_detect.hpp"
+#include "../check.hpp"
+#include "../exception.hpp"
+#include <array>
+#include <span>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#if TT_PROCESSOR == TT_CPU_X64
+#include <emmintrin.h>
+#endif
+
+namespace tt {
+
+/** Find the end of a line.
+ * On x64 sixteen bytes are compared at a time using SSE2.
+ *
+ * @return The index of the first line-feed or nul, or `last - first` if there is none.
+ */
+[[nodiscard]] inline size_t find_line_end(std::byte const *first, std::byte const *last) noexcept
+{
+    auto it = first;
+
+#if TT_PROCESSOR == TT_CPU_X64
+    ttlet line_feed = _mm_set1_epi8('\n');
+    ttlet nul = _mm_setzero_si128();
+    for (; last - it >= 16; it += 16) {
+        ttlet chunk = _mm_loadu_si128(reinterpret_cast<__m128i const *>(it));
+        ttlet found = _mm_or_si128(_mm_cmpeq_epi8(chunk, line_feed), _mm_cmpeq_epi8(chunk, nul));
+        ttlet mask = static_cast<unsigned int>(_mm_movemask_epi8(found));
+        if (mask != 0) {
+            return static_cast<size_t>(it - first) + std::countr_zero(mask);
+        }
+    }
+#endif
+
+    for (; it != last; ++it) {
+        if (*it == std::byte{'\n'} or *it == std::byte{'\0'}) {
+            return static_cast<size_t>(it - first);
+        }
+    }
+    return static_cast<size_t>(last - first);
+}
+
+/** Finds the messages in a stream of bytes in a packet_buffer.
+ *
+ * A framer remembers how far it has scanned the buffer, so that data that arrives
+ * a little at a time is only scanned once. Usage:
+ *
+ * ```
+ * while (ttlet size = framer.find(readBuffer)) {
+ *     handle_message(readBuffer, size);
+ *     framer.consume(readBuffer, size);
+ * }
+ * ```
+ *
+ * The message can be read with `packet_buffer::spans()` without copying, or with `packet_buffer::peek()`.
+ */
+class packet_framer {
+public:
+    /** Remove a message found by `find()` from the buffer.
+     */
+    void consume(packet_buffer &buffer, ssize_t frameSize) noexcept {
+        tt_axiom(frameSize == _frameSize);
+        buffer.read(frameSize);
+        reset();
+    }
+
+protected:
+    /** The number of bytes at the start of the buffer that have been scanned.
+     */
+    ssize_t _position = 0;
+
+    /** The size of the message that was found, returned by `find()` until it is consumed.
+     */
+    ssize_t _frameSize = 0;
+
+    void reset() noexcept {
+        _position = 0;
+        _frameSize = 0;
+    }
+
+    /** Scan the bytes that were not scanned before.
+     *
+     * @param scanner Called with each span of new bytes; returns the number of bytes it handled.
+     *                The scanner sets `_frameSize` when it found the end of the message.
+     */
+    template<typename Scanner>
+    void scan(packet_buffer const &buffer, Scanner &&scanner) {
+        auto spans = std::array<std::span<std::byte const>, 16>{};
+        while (_frameSize == 0 and _position < buffer.nrBytes()) {
+            ttlet nrSpans = buffer.spansAt(_position, spans);
+            for (auto i = 0_uz; i != nrSpans and _frameSize == 0; ++i) {
+                _position += scanner(spans[i]);
+            }
+        }
+    }
+};
+
+/** Finds lines ending in a line-feed or a nul.
+ */
+class line_framer : public packet_framer {
+public:
+    /** @param maxSize The maximum size of a line, including the line-feed.
+     */
+    line_framer(ssize_t maxSize = 1024) noexcept : _maxSize(maxSize) {}
+
+    /** Find the next line.
+     * @return The size of the line including the line-feed or nul, or zero if the line is not complete yet.
+     * @throw parse_error When the line is longer than the maximum size.
+     */
+    [[nodiscard]] ssize_t find(packet_buffer const &buffer) {
+        scan(buffer, [this](std::span<std::byte const> span) {
+            ttlet end = find_line_end(span.data(), span.data() + span.size());
+            if (end != span.size()) {
+                _frameSize = _position + narrow_cast<ssize_t>(end) + 1;
+                return narrow_cast<ssize_t>(end) + 1;
+            }
+            return std::ssize(span);
+        });
+
+        if (_frameSize != 0 ? _frameSize > _maxSize : _position >= _maxSize) {
+            throw parse_error("New-line not found within {} bytes", _maxSize);
+        }
+        return _frameSize;
+    }
+
+private:
+    ssize_t _maxSize;
+};
+
+/** Finds messages that start with their size, as a big-endian unsigned integer.
+ */
+class length_prefix_framer : public packet_framer {
+public:
+    /** @param prefixSize The number of bytes of the size, 1, 2, 4 or 8.
+     * @param maxSize The maximum size of a message, excluding the prefix.
+     */
+    length_prefix_framer(ssize_t prefixSize = 4, ssize_t maxSize = 16 * 1024 * 1024) noexcept :
+        _prefixSize(prefixSize), _maxSize(maxSize) {
+        tt_axiom(prefixSize == 1 or prefixSize == 2 or prefixSize == 4 or prefixSize == 8);
+    }
+
+    /** The number of bytes of the size at the start of each message.
+     */
+    [[nodiscard]] ssize_t prefixSize() const noexcept {
+        return _prefixSize;
+    }
+
+    /** Find the next message.
+     * @return The size of the message including the prefix, or zero if the message is not complete yet.
+     * @throw parse_error When the message is larger than the maximum size.
+     */
+    [[nodiscard]] ssize_t find(packet_buffer const &buffer) {
+        if (_frameSize == 0 and buffer.nrBytes() >= _prefixSize) {
+            // The prefix is decoded only once for each message.
+            if (_payloadSize < 0) {
+                auto spans = std::array<std::span<std::byte const>, 8>{};
+                ttlet nrSpans = buffer.spans(spans, _prefixSize);
+
+                uint64_t size = 0;
+                for (auto i = 0_uz; i != nrSpans; ++i) {
+                    for (ttlet c : spans[i]) {
+                        size = (size << 8) | static_cast<uint64_t>(c);
+                    }
+                }
+                if (size > static_cast<uint64_t>(_maxSize)) {
+                    throw parse_error("Message of {} bytes is larger than {} bytes", size, _maxSize);
+                }
+                _payloadSize = static_cast<ssize_t>(size);
+            }
+
+            if (buffer.nrBytes() >= _prefixSize + _payloadSize) {
+                _frameSize = _prefixSize + _payloadSize;
+            }
+        }
+        return _frameSize;
+    }
+
+    void consume(packet_buffer &buffer, ssize_t frameSize) noexcept {
+        packet_framer::consume(buffer, frameSize);
+        _payloadSize = -1;
+    }
+
+private:
+    ssize_t _prefixSize;
+    ssize_t _maxSize;
+    ssize_t _payloadSize = -1;
+};
+
+/** Finds BON8 encoded messages.
+ *
+ * BON8 values are self delimiting, the framer tracks the nesting of containers and the length of
+ * multi-byte values without decoding them. A string at the top level ends at an end-of-text code or at
+ * the first byte of a value that is not a string; a sender should end a top-level string with end-of-text.
+ */
+class BON8_framer : public packet_framer {
+public:
+    /** @param maxSize The maximum size of a message.
+     */
+    BON8_framer(ssize_t maxSize = 16 * 1024 * 1024) noexcept : _maxSize(maxSize) {}
+
+    /** Find the next message.
+     * @return The size of the message, or zero if the message is not complete yet.
+     * @throw parse_error When the message is larger than the maximum size, or when a container is closed that was not opened.
+     */
+    [[nodiscard]] ssize_t find(packet_buffer const &buffer) {
+        scan(buffer, [this](std::span<std::byte const> span) {
+            auto i = 0_uz;
+            while (i != span.size() and _frameSize == 0) {
+                if (_skip == 0 and not _needSecondByte and static_cast<uint8_t>(span[i]) <= 0x7f) {
+                    // Skip over a run of ASCII characters of a string.
+                    _inString = true;
+                    i += utf8_ascii_prefix_size(
+                        reinterpret_cast<char8_t const *>(span.data() + i), reinterpret_cast<char8_t const *>(span.data() + span.size()));
+                    continue;
+                }
+
+                // If the message ends before the current byte the framer stops; the byte is part of the next message.
+                ttlet frameSize = step(static_cast<uint8_t>(span[i]), _position + narrow_cast<ssize_t>(i));
+                if (frameSize != 0) {
+                    _frameSize = frameSize;
+                    return narrow_cast<ssize_t>(i);
+                }
+                ++i;
+            }
+            return narrow_cast<ssize_t>(i);
+        });
+
+        if (_frameSize != 0 ? _frameSize > _maxSize : _position >= _maxSize) {
+            throw parse_error("BON8 message larger than {} bytes", _maxSize);
+        }
+        return _frameSize;
+    }
+
+    void consume(packet_buffer &buffer, ssize_t frameSize) noexcept {
+        packet_framer::consume(buffer, frameSize);
+        _depth = 0;
+        _skip = 0;
+        _leadCount = 0;
+        _tokenStart = 0;
+        _needSecondByte = false;
+        _endAfterToken = false;
+        _inString = false;
+    }
+
+private:
+    ssize_t _maxSize;
+
+    /** The number of open containers.
+     */
+    ssize_t _depth = 0;
+
+    /** The number of bytes left of the current multi-byte value.
+     */
+    ssize_t _skip = 0;
+
+    /** The number of bytes of the current UTF-8 like value, and the position of its first byte.
+     */
+    ssize_t _leadCount = 0;
+    ssize_t _tokenStart = 0;
+
+    /** The second byte determines if a UTF-8 like value is a character or an integer.
+     */
+    bool _needSecondByte = false;
+
+    /** The message ends with the last byte of the current multi-byte value.
+     */
+    bool _endAfterToken = false;
+
+    /** The last value was (part of) a string.
+     */
+    bool _inString = false;
+
+    /** Handle a single byte.
+     * @param c The byte.
+     * @param position The position of the byte in the buffer.
+     * @return The size of the message when it was completed, or zero.
+     */
+    [[nodiscard]] ssize_t step(uint8_t c, ssize_t position) {
+        if (_skip != 0) {
+            --_skip;
+            return (_skip == 0 and _endAfterToken) ? position + 1 : 0;
+        }
+
+        if (_needSecondByte) {
+            _needSecondByte = false;
+            if (c >= 0x80 and c <= 0xbf) {
+                // UTF-8 character.
+                _inString = true;
+                _endAfterToken = false;
+            } else {
+                // UTF-8 like integer; a string at the top-level ends before it.
+                if (_depth == 0 and _inString) {
+                    return _tokenStart;
+                }
+                _inString = false;
+                _endAfterToken = _depth == 0;
+            }
+            _skip = _leadCount - 2;
+            return (_skip == 0 and _endAfterToken) ? position + 1 : 0;
+        }
+
+        if (c <= 0x7f) {
+            _inString = true;
+            return 0;
+
+        } else if (c == detail::BON8_code_eot) {
+            _inString = false;
+            return _depth == 0 ? position + 1 : 0;
+
+        } else if (c >= 0xc2 and c <= 0xf7) {
+            _needSecondByte = true;
+            _leadCount = c <= 0xdf ? 2 : c <= 0xef ? 3 : 4;
+            _tokenStart = position;
+            return 0;
+        }
+
+        // All other codes are not strings; a string at the top-level ends before it.
+        if (_depth == 0 and _inString) {
+            return position;
+        }
+        _inString = false;
+
+        switch (c) {
+        case detail::BON8_code_array:
+        case detail::BON8_code_object:
+            ++_depth;
+            return 0;
+
+        case detail::BON8_code_eoc:
+            tt_parse_check(_depth > 0, "Unexpected end-of-container");
+            --_depth;
+            return _depth == 0 ? position + 1 : 0;
+
+        case detail::BON8_code_int32:
+        case detail::BON8_code_binary32:
+            _skip = 4;
+            _endAfterToken = _depth == 0;
+            return 0;
+
+        case detail::BON8_code_int64:
+        case detail::BON8_code_binary64:
+            _skip = 8;
+            _endAfterToken = _depth == 0;
+            return 0;
+
+        default:
+            // A single byte integer, float or other value.
+            return _depth == 0 ? position + 1 : 0;
+        }
+    }
+};
+
+} // namespace tt
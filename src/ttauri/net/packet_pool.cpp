@@ -0,0 +1,117 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "packet_pool.hpp"
+#include "../counters.hpp"
+#include "../assert.hpp"
+#include <vector>
+#include <mutex>
+#include <algorithm>
+
+namespace tt {
+
+/** The free buffers of one size class, shared between threads.
+ */
+struct packet_pool_free_list {
+    std::mutex mutex;
+    std::vector<std::byte *> buffers;
+};
+
+[[nodiscard]] static std::array<packet_pool_free_list, packet_pool_size_classes.size()> &packet_pool_free_lists() noexcept
+{
+    // The free lists are never destroyed, so that threads that exit after main() can return their buffers.
+    static auto *free_lists = new std::array<packet_pool_free_list, packet_pool_size_classes.size()>{};
+    return *free_lists;
+}
+
+/** The free buffers that a thread keeps for itself.
+ */
+struct packet_pool_thread_cache {
+    std::array<std::vector<std::byte *>, packet_pool_size_classes.size()> buffers;
+
+    packet_pool_thread_cache() noexcept
+    {
+        for (auto &item : buffers) {
+            item.reserve(packet_pool_thread_cache_size);
+        }
+    }
+
+    ~packet_pool_thread_cache()
+    {
+        auto &free_lists = packet_pool_free_lists();
+        for (auto i = 0_uz; i != buffers.size(); ++i) {
+            ttlet lock = std::scoped_lock(free_lists[i].mutex);
+            free_lists[i].buffers.insert(free_lists[i].buffers.end(), buffers[i].begin(), buffers[i].end());
+        }
+    }
+};
+
+static thread_local packet_pool_thread_cache packet_pool_cache;
+
+/** Get the size class of an allocation.
+ * @return The index of the size class, or `packet_pool_size_classes.size()` if it is too large for the pool.
+ */
+[[nodiscard]] static size_t packet_pool_size_class(size_t nrBytes) noexcept
+{
+    ttlet it = std::lower_bound(packet_pool_size_classes.begin(), packet_pool_size_classes.end(), nrBytes);
+    return static_cast<size_t>(std::distance(packet_pool_size_classes.begin(), it));
+}
+
+[[nodiscard]] std::span<std::byte> packet_pool::allocate(size_t nrBytes) noexcept
+{
+    ttlet size_class = packet_pool_size_class(nrBytes);
+    if (size_class == packet_pool_size_classes.size()) {
+        increment_counter<"net_packet_pool_miss">();
+        return {new std::byte[nrBytes], nrBytes};
+    }
+
+    ttlet size = packet_pool_size_classes[size_class];
+    auto &cache = packet_pool_cache.buffers[size_class];
+    if (cache.empty()) {
+        // Take up to half a cache worth of buffers from the shared free list.
+        auto &free_list = packet_pool_free_lists()[size_class];
+        ttlet lock = std::scoped_lock(free_list.mutex);
+        ttlet n = std::min(free_list.buffers.size(), packet_pool_thread_cache_size / 2);
+        cache.insert(cache.end(), free_list.buffers.end() - n, free_list.buffers.end());
+        free_list.buffers.resize(free_list.buffers.size() - n);
+    }
+
+    if (cache.empty()) {
+        [[unlikely]] increment_counter<"net_packet_pool_miss">();
+        return {new std::byte[size], size};
+    }
+
+    increment_counter<"net_packet_pool_hit">();
+    auto *buffer = cache.back();
+    cache.pop_back();
+    return {buffer, size};
+}
+
+void packet_pool::deallocate(std::span<std::byte> buffer) noexcept
+{
+    if (buffer.data() == nullptr) {
+        return;
+    }
+
+    ttlet size_class = packet_pool_size_class(buffer.size());
+    if (size_class == packet_pool_size_classes.size()) {
+        delete[] buffer.data();
+        return;
+    }
+
+    tt_axiom(buffer.size() == packet_pool_size_classes[size_class]);
+    auto &cache = packet_pool_cache.buffers[size_class];
+    if (cache.size() == packet_pool_thread_cache_size) {
+        // Give half of the cache to the shared free list, so that a thread that only frees does not grow without bound.
+        auto &free_list = packet_pool_free_lists()[size_class];
+        ttlet lock = std::scoped_lock(free_list.mutex);
+        ttlet n = packet_pool_thread_cache_size / 2;
+        free_list.buffers.insert(free_list.buffers.end(), cache.end() - n, cache.end());
+        cache.resize(cache.size() - n);
+    }
+
+    cache.push_back(buffer.data());
+}
+
+} // namespace tt
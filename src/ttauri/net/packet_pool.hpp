@@ -0,0 +1,49 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../required.hpp"
+#include <array>
+#include <span>
+#include <cstddef>
+
+namespace tt {
+
+/** The sizes of the buffers that are recycled by the packet pool.
+ * Larger packets are allocated directly from the heap.
+ */
+constexpr auto packet_pool_size_classes = std::array<size_t, 2>{4096, 65536};
+
+/** The number of free buffers of each size class that a thread keeps for itself.
+ */
+constexpr size_t packet_pool_thread_cache_size = 32;
+
+/** A pool of packet buffers.
+ *
+ * Each thread has a small cache of free buffers of each size class, so that allocating and freeing
+ * the packets of a connection does not take a lock. When a thread's cache is empty or full, half of it
+ * is exchanged with a shared free list.
+ *
+ * The `net_packet_pool_hit` and `net_packet_pool_miss` counters count the allocations that were served
+ * from a free list and the allocations that went to the heap.
+ */
+class packet_pool {
+public:
+    /** Allocate a buffer.
+     *
+     * @param nrBytes The minimum size of the buffer.
+     * @return A buffer, rounded up to the size class.
+     */
+    [[nodiscard]] static std::span<std::byte> allocate(size_t nrBytes) noexcept;
+
+    /** Free a buffer.
+     * The buffer may be freed from a different thread than it was allocated on.
+     *
+     * @param buffer A buffer returned by `allocate()`.
+     */
+    static void deallocate(std::span<std::byte> buffer) noexcept;
+};
+
+} // namespace tt
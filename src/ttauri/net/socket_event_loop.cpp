@@ -0,0 +1,165 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "socket_event_loop.hpp"
+#include "../logger.hpp"
+#include "../exception.hpp"
+#include "../assert.hpp"
+
+namespace tt {
+
+socket_event_loop::socket_event_loop(size_t number_of_threads)
+{
+    tt_axiom(number_of_threads > 0);
+    create_handle();
+    start_threads(number_of_threads);
+}
+
+socket_event_loop::~socket_event_loop()
+{
+    stop_threads();
+
+    {
+        ttlet lock = std::scoped_lock(_mutex);
+        for (ttlet &[socket, item] : _registrations) {
+            item->removed = true;
+            detach(*item->stream);
+        }
+        _registrations.clear();
+    }
+
+    destroy_handle();
+}
+
+void socket_event_loop::start_threads(size_t number_of_threads)
+{
+    for (auto i = 0_uz; i != number_of_threads; ++i) {
+        _threads.emplace_back([this](std::stop_token stop_token) {
+            thread_proc(stop_token);
+        });
+    }
+}
+
+void socket_event_loop::stop_threads() noexcept
+{
+    for (auto &thread : _threads) {
+        thread.request_stop();
+    }
+    for (auto &thread : _threads) {
+        thread.join();
+    }
+    _threads.clear();
+}
+
+void socket_event_loop::add(std::shared_ptr<Socketstream> stream)
+{
+    tt_axiom(stream);
+    auto item = std::make_shared<registration>();
+    item->stream = std::move(stream);
+
+    {
+        ttlet lock = std::scoped_lock(_mutex);
+        ttlet [it, inserted] = _registrations.emplace(item->stream->nativeHandle(), item);
+        tt_assert(inserted);
+    }
+
+    try {
+        attach(*item->stream);
+    } catch (...) {
+        ttlet lock = std::scoped_lock(_mutex);
+        _registrations.erase(item->stream->nativeHandle());
+        throw;
+    }
+
+    // Hold the handler mutex, so that the first event is not handled before the stream is armed.
+    ttlet lock = std::scoped_lock(item->mutex);
+    arm(*item);
+}
+
+void socket_event_loop::update(Socketstream &stream) noexcept
+{
+    if (auto item = find(stream.nativeHandle())) {
+        ttlet lock = std::scoped_lock(item->mutex);
+        if (not item->removed) {
+            arm(*item);
+        }
+    }
+}
+
+void socket_event_loop::remove(Socketstream &stream) noexcept
+{
+    auto item = std::shared_ptr<registration>{};
+    {
+        ttlet lock = std::scoped_lock(_mutex);
+        ttlet it = _registrations.find(stream.nativeHandle());
+        if (it == _registrations.end()) {
+            return;
+        }
+        item = std::move(it->second);
+        _registrations.erase(it);
+    }
+
+    // The handler mutex is not taken, since remove() may be called from inside a handler.
+    if (not item->removed.exchange(true)) {
+        detach(stream);
+    }
+}
+
+[[nodiscard]] size_t socket_event_loop::size() const noexcept
+{
+    ttlet lock = std::scoped_lock(_mutex);
+    return _registrations.size();
+}
+
+[[nodiscard]] std::shared_ptr<socket_event_loop::registration> socket_event_loop::find(socket_handle socket) const noexcept
+{
+    ttlet lock = std::scoped_lock(_mutex);
+    ttlet it = _registrations.find(socket);
+    return it != _registrations.end() ? it->second : nullptr;
+}
+
+void socket_event_loop::dispatch(socket_handle socket, bool readable, bool writable) noexcept
+{
+    // The registration keeps the stream alive while its handlers run, even when it is removed by a handler.
+    ttlet item = find(socket);
+    if (not item) {
+        return;
+    }
+
+    ttlet lock = std::scoped_lock(item->mutex);
+    if (item->removed) {
+        return;
+    }
+
+    if (readable) {
+        item->read_armed = false;
+    }
+    if (writable) {
+        item->write_armed = false;
+    }
+
+    auto &stream = *item->stream;
+    try {
+        if (writable and stream.isConnecting()) {
+            stream.handleConnect();
+            writable = false;
+        }
+        if (readable and not item->removed) {
+            stream.handleReadyToReadEvent();
+        }
+        if (writable and not item->removed) {
+            stream.handleReadyToWriteEvent();
+        }
+
+    } catch (std::exception const &e) {
+        tt_log_error("Closing socket stream after an error in its handler: {}", e.what());
+        remove(stream);
+    }
+
+    if (not item->removed) {
+        arm(*item);
+    }
+}
+
+} // namespace tt
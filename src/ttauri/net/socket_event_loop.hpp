@@ -0,0 +1,122 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "stream.hpp"
+#include "../os_detect.hpp"
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <stop_token>
+#include <unordered_map>
+#include <vector>
+
+namespace tt {
+
+/** Drives `Socketstream` objects from a small pool of I/O threads.
+ *
+ * Each stream is registered for the events it needs, as reported by `needToRead()` and `needToWrite()`;
+ * when the socket is ready one of the threads calls the stream's handler. The registration is removed
+ * after an event, and made again after the handler returns, so that a stream is only handled by one
+ * thread at a time and its handlers do not need to be thread-safe.
+ *
+ * The operating system's scalable notification mechanism is used: epoll on Linux, kqueue on macOS and
+ * an I/O completion port on Windows.
+ */
+class socket_event_loop {
+public:
+    /** Start the I/O threads.
+     * @param number_of_threads The number of I/O threads.
+     * @throw io_error When the notification mechanism could not be created.
+     */
+    socket_event_loop(size_t number_of_threads = 2);
+
+    /** Stop the I/O threads.
+     * The streams that are still registered are released.
+     */
+    ~socket_event_loop();
+
+    socket_event_loop(socket_event_loop const &) = delete;
+    socket_event_loop(socket_event_loop &&) = delete;
+    socket_event_loop &operator=(socket_event_loop const &) = delete;
+    socket_event_loop &operator=(socket_event_loop &&) = delete;
+
+    /** Add a stream.
+     * The event loop holds a reference to the stream until it is removed, or until one of its handlers throws.
+     * @throw io_error When the socket could not be registered.
+     */
+    void add(std::shared_ptr<Socketstream> stream);
+
+    /** Register the events for a stream again.
+     * Call this when `needToRead()` or `needToWrite()` changed outside of the stream's handlers,
+     * for example after data was added to the write buffer from another thread.
+     */
+    void update(Socketstream &stream) noexcept;
+
+    /** Remove a stream.
+     * This may be called from inside the stream's handlers.
+     */
+    void remove(Socketstream &stream) noexcept;
+
+    /** The number of streams.
+     */
+    [[nodiscard]] size_t size() const noexcept;
+
+private:
+    struct registration {
+        std::shared_ptr<Socketstream> stream;
+
+        /** Held while the handlers of the stream are called.
+         */
+        std::mutex mutex;
+        std::atomic<bool> removed = false;
+
+        /** A read or write event is registered and has not been delivered yet.
+         * On Windows each registration is a queued operation, which should not be made twice.
+         */
+        bool read_armed = false;
+        bool write_armed = false;
+    };
+
+    /** The epoll or kqueue file descriptor, or the I/O completion port.
+     */
+    os_handle _handle;
+
+    mutable std::mutex _mutex;
+    std::unordered_map<socket_handle, std::shared_ptr<registration>> _registrations;
+
+    std::vector<std::jthread> _threads;
+
+    [[nodiscard]] std::shared_ptr<registration> find(socket_handle socket) const noexcept;
+
+    /** Call the handlers of a stream, and register for the next events.
+     */
+    void dispatch(socket_handle socket, bool readable, bool writable) noexcept;
+
+    void start_threads(size_t number_of_threads);
+    void stop_threads() noexcept;
+
+    // The functions below are implemented for each operating system.
+
+    void create_handle();
+    void destroy_handle() noexcept;
+    void thread_proc(std::stop_token stop_token) noexcept;
+
+    /** Register a new socket.
+     */
+    void attach(Socketstream &stream);
+
+    /** Register the events that the stream needs.
+     * @pre The mutex of the registration is held.
+     */
+    void arm(registration &item) noexcept;
+
+    /** Unregister a socket.
+     */
+    void detach(Socketstream &stream) noexcept;
+};
+
+} // namespace tt
@@ -0,0 +1,98 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "socket_event_loop.hpp"
+#include "../logger.hpp"
+#include "../exception.hpp"
+#include "../thread.hpp"
+#include <sys/epoll.h>
+#include <unistd.h>
+#include <array>
+#include <cerrno>
+
+namespace tt {
+
+void socket_event_loop::create_handle()
+{
+    _handle = epoll_create1(EPOLL_CLOEXEC);
+    if (_handle == -1) {
+        throw io_error("Could not create epoll: '{}'", get_last_error_message());
+    }
+}
+
+void socket_event_loop::destroy_handle() noexcept
+{
+    close(_handle);
+}
+
+/** The events that a stream needs.
+ * Each registration is one-shot, so that only one thread receives the event; the stream is re-armed after it is handled.
+ */
+[[nodiscard]] static epoll_event socket_event_loop_events(Socketstream &stream) noexcept
+{
+    auto r = epoll_event{};
+    r.events = EPOLLONESHOT | EPOLLRDHUP;
+    if (stream.needToRead()) {
+        r.events |= EPOLLIN;
+    }
+    if (stream.isConnecting() or stream.needToWrite()) {
+        r.events |= EPOLLOUT;
+    }
+    r.data.fd = stream.nativeHandle();
+    return r;
+}
+
+void socket_event_loop::attach(Socketstream &stream)
+{
+    // Register without events, arm() enables the events.
+    auto event = epoll_event{};
+    event.events = EPOLLONESHOT;
+    event.data.fd = stream.nativeHandle();
+    if (epoll_ctl(_handle, EPOLL_CTL_ADD, stream.nativeHandle(), &event) == -1) {
+        throw io_error("Could not add socket to epoll: '{}'", get_last_error_message());
+    }
+}
+
+void socket_event_loop::arm(registration &item) noexcept
+{
+    auto &stream = *item.stream;
+    auto event = socket_event_loop_events(stream);
+    if (epoll_ctl(_handle, EPOLL_CTL_MOD, stream.nativeHandle(), &event) == -1) {
+        tt_log_error("Could not modify socket in epoll: '{}'", get_last_error_message());
+    }
+}
+
+void socket_event_loop::detach(Socketstream &stream) noexcept
+{
+    // The socket may already be closed, in which case the kernel has removed it.
+    epoll_ctl(_handle, EPOLL_CTL_DEL, stream.nativeHandle(), nullptr);
+}
+
+void socket_event_loop::thread_proc(std::stop_token stop_token) noexcept
+{
+    set_thread_name("socket_io");
+
+    auto events = std::array<epoll_event, 64>{};
+    while (not stop_token.stop_requested()) {
+        // The timeout is there to check for a stop request.
+        ttlet n = epoll_wait(_handle, events.data(), static_cast<int>(events.size()), 100);
+        if (n == -1) {
+            if (errno != EINTR) {
+                tt_log_error("Could not wait on epoll: '{}'", get_last_error_message());
+                return;
+            }
+            continue;
+        }
+
+        for (auto i = 0; i != n; ++i) {
+            ttlet &event = events[i];
+            ttlet hangup = (event.events & (EPOLLHUP | EPOLLRDHUP | EPOLLERR)) != 0;
+
+            // On a hang-up or error the read handler finds the end-of-stream or the error.
+            dispatch(event.data.fd, hangup or (event.events & EPOLLIN) != 0, (event.events & EPOLLOUT) != 0);
+        }
+    }
+}
+
+} // namespace tt
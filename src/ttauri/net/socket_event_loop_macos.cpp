@@ -0,0 +1,95 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "socket_event_loop.hpp"
+#include "../logger.hpp"
+#include "../exception.hpp"
+#include "../thread.hpp"
+#include <sys/types.h>
+#include <sys/event.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <array>
+#include <cerrno>
+
+namespace tt {
+
+void socket_event_loop::create_handle()
+{
+    _handle = kqueue();
+    if (_handle == -1) {
+        throw io_error("Could not create kqueue: '{}'", get_last_error_message());
+    }
+}
+
+void socket_event_loop::destroy_handle() noexcept
+{
+    close(_handle);
+}
+
+void socket_event_loop::attach(Socketstream &stream)
+{
+    // Add both filters disabled; EV_DISPATCH disables a filter again after it delivered an event.
+    auto changes = std::array<struct kevent, 2>{};
+    EV_SET(&changes[0], stream.nativeHandle(), EVFILT_READ, EV_ADD | EV_DISPATCH | EV_DISABLE, 0, 0, nullptr);
+    EV_SET(&changes[1], stream.nativeHandle(), EVFILT_WRITE, EV_ADD | EV_DISPATCH | EV_DISABLE, 0, 0, nullptr);
+    if (kevent(_handle, changes.data(), static_cast<int>(changes.size()), nullptr, 0, nullptr) == -1) {
+        throw io_error("Could not add socket to kqueue: '{}'", get_last_error_message());
+    }
+}
+
+void socket_event_loop::arm(registration &item) noexcept
+{
+    auto &stream = *item.stream;
+    ttlet read = stream.needToRead();
+    ttlet write = stream.isConnecting() or stream.needToWrite();
+
+    auto changes = std::array<struct kevent, 2>{};
+    EV_SET(&changes[0], stream.nativeHandle(), EVFILT_READ, read ? EV_ENABLE : EV_DISABLE, 0, 0, nullptr);
+    EV_SET(&changes[1], stream.nativeHandle(), EVFILT_WRITE, write ? EV_ENABLE : EV_DISABLE, 0, 0, nullptr);
+    if (kevent(_handle, changes.data(), static_cast<int>(changes.size()), nullptr, 0, nullptr) == -1) {
+        tt_log_error("Could not modify socket in kqueue: '{}'", get_last_error_message());
+    }
+}
+
+void socket_event_loop::detach(Socketstream &stream) noexcept
+{
+    // The socket may already be closed, in which case the kernel has removed its filters.
+    auto changes = std::array<struct kevent, 2>{};
+    EV_SET(&changes[0], stream.nativeHandle(), EVFILT_READ, EV_DELETE, 0, 0, nullptr);
+    EV_SET(&changes[1], stream.nativeHandle(), EVFILT_WRITE, EV_DELETE, 0, 0, nullptr);
+    kevent(_handle, changes.data(), static_cast<int>(changes.size()), nullptr, 0, nullptr);
+}
+
+void socket_event_loop::thread_proc(std::stop_token stop_token) noexcept
+{
+    set_thread_name("socket_io");
+
+    auto events = std::array<struct kevent, 64>{};
+    while (not stop_token.stop_requested()) {
+        // The timeout is there to check for a stop request.
+        ttlet timeout = timespec{0, 100'000'000};
+        ttlet n = kevent(_handle, nullptr, 0, events.data(), static_cast<int>(events.size()), &timeout);
+        if (n == -1) {
+            if (errno != EINTR) {
+                tt_log_error("Could not wait on kqueue: '{}'", get_last_error_message());
+                return;
+            }
+            continue;
+        }
+
+        // The read and write filters are reported separately, dispatch() serializes the handlers of a stream.
+        for (auto i = 0; i != n; ++i) {
+            ttlet &event = events[i];
+            ttlet socket = static_cast<socket_handle>(event.ident);
+            if (event.filter == EVFILT_READ) {
+                dispatch(socket, true, false);
+            } else if (event.filter == EVFILT_WRITE) {
+                dispatch(socket, false, true);
+            }
+        }
+    }
+}
+
+} // namespace tt
@@ -0,0 +1,122 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "socket_event_loop.hpp"
+#include "../logger.hpp"
+#include "../exception.hpp"
+#include "../thread.hpp"
+#include <WinSock2.h>
+#include <Windows.h>
+
+#pragma comment(lib, "ws2_32")
+
+namespace tt {
+
+/** An overlapped operation that signals readiness of a socket.
+ *
+ * An I/O completion port reports completed operations instead of readiness. Readability is detected
+ * with a zero byte receive, which completes when data arrives without consuming it. Writability is
+ * reported directly through the port, since writes to a socket are buffered by Winsock;
+ * a write handler that finds the buffer full gets `WSAEWOULDBLOCK` and is armed again.
+ *
+ * Each pending operation is allocated and freed when its completion is dequeued; closing the socket
+ * completes the pending receive with an error.
+ */
+struct socket_event_loop_overlapped : OVERLAPPED {
+    socket_handle socket;
+    bool writable;
+
+    socket_event_loop_overlapped(socket_handle socket, bool writable) noexcept : OVERLAPPED{}, socket(socket), writable(writable) {}
+};
+
+void socket_event_loop::create_handle()
+{
+    _handle = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 0);
+    if (_handle == nullptr) {
+        throw io_error("Could not create I/O completion port: '{}'", get_last_error_message());
+    }
+}
+
+void socket_event_loop::destroy_handle() noexcept
+{
+    // Free the operations that were still queued.
+    DWORD number_of_bytes;
+    ULONG_PTR key;
+    OVERLAPPED *overlapped;
+    while (GetQueuedCompletionStatus(_handle, &number_of_bytes, &key, &overlapped, 0) or overlapped != nullptr) {
+        delete static_cast<socket_event_loop_overlapped *>(overlapped);
+    }
+    CloseHandle(_handle);
+}
+
+void socket_event_loop::attach(Socketstream &stream)
+{
+    ttlet socket = reinterpret_cast<HANDLE>(stream.nativeHandle());
+    if (CreateIoCompletionPort(socket, _handle, static_cast<ULONG_PTR>(stream.nativeHandle()), 0) == nullptr) {
+        throw io_error("Could not add socket to I/O completion port: '{}'", get_last_error_message());
+    }
+}
+
+void socket_event_loop::arm(registration &item) noexcept
+{
+    auto &stream = *item.stream;
+    ttlet socket = stream.nativeHandle();
+
+    if (not item.read_armed and stream.needToRead()) {
+        item.read_armed = true;
+        auto *overlapped = new socket_event_loop_overlapped(socket, false);
+        auto buffer = WSABUF{0, nullptr};
+        DWORD flags = 0;
+        if (WSARecv(static_cast<SOCKET>(socket), &buffer, 1, nullptr, &flags, overlapped, nullptr) == SOCKET_ERROR and
+            WSAGetLastError() != WSA_IO_PENDING) {
+            // The error is found by the read handler.
+            if (not PostQueuedCompletionStatus(_handle, 0, static_cast<ULONG_PTR>(socket), overlapped)) {
+                delete overlapped;
+            }
+        }
+    }
+
+    if (not item.write_armed and (stream.isConnecting() or stream.needToWrite())) {
+        item.write_armed = true;
+        auto *overlapped = new socket_event_loop_overlapped(socket, true);
+        if (not PostQueuedCompletionStatus(_handle, 0, static_cast<ULONG_PTR>(socket), overlapped)) {
+            tt_log_error("Could not post to I/O completion port: '{}'", get_last_error_message());
+            delete overlapped;
+        }
+    }
+}
+
+void socket_event_loop::detach(Socketstream &stream) noexcept
+{
+    // A socket can not be removed from a completion port, the pending receive is cancelled instead.
+    CancelIoEx(reinterpret_cast<HANDLE>(stream.nativeHandle()), nullptr);
+}
+
+void socket_event_loop::thread_proc(std::stop_token stop_token) noexcept
+{
+    set_thread_name("socket_io");
+
+    while (not stop_token.stop_requested()) {
+        DWORD number_of_bytes;
+        ULONG_PTR key;
+        OVERLAPPED *overlapped = nullptr;
+
+        // The timeout is there to check for a stop request.
+        ttlet success = GetQueuedCompletionStatus(_handle, &number_of_bytes, &key, &overlapped, 100);
+        if (overlapped == nullptr) {
+            if (not success and GetLastError() != WAIT_TIMEOUT) {
+                tt_log_error("Could not wait on I/O completion port: '{}'", get_last_error_message());
+                return;
+            }
+            continue;
+        }
+
+        // A failed receive is dispatched as readable, so that the handler finds the error.
+        auto *operation = static_cast<socket_event_loop_overlapped *>(overlapped);
+        dispatch(operation->socket, not operation->writable, operation->writable);
+        delete operation;
+    }
+}
+
+} // namespace tt
@@ -5,11 +5,23 @@
 
 #pragma once
 
+#include "packet_buffer.hpp"
+#include "../os_detect.hpp"
+#include <cstdint>
+
 namespace tt {
 
+#if TT_OPERATING_SYSTEM == TT_OS_WINDOWS
+using socket_handle = uintptr_t;
+#else
+using socket_handle = int;
+#endif
+
 class Socketstream {
 
 protected:
+    socket_handle socket;
+
     bool connecting = false;
 
     /** Buffer with data read from the socket.
@@ -21,33 +33,73 @@ protected:
     packet_buffer writeBuffer;
 
 public:
+    /** Create a stream over a non-blocking socket.
+     * @param socket The socket, owned by the stream.
+     * @param connecting True when a non-blocking connect is in progress.
+     */
+    Socketstream(socket_handle socket, bool connecting) noexcept : socket(socket), connecting(connecting) {}
+
+    virtual ~Socketstream() = default;
+    Socketstream(Socketstream const &) = delete;
+    Socketstream(Socketstream &&) = delete;
+    Socketstream &operator=(Socketstream const &) = delete;
+    Socketstream &operator=(Socketstream &&) = delete;
+
+    [[nodiscard]] socket_handle nativeHandle() const noexcept {
+        return socket;
+    }
+
+    /** Check if a non-blocking connect is in progress.
+     */
+    [[nodiscard]] bool isConnecting() const noexcept {
+        return connecting;
+    }
 
     /** Handle connected event.
+     * Called when the socket becomes writable while connecting.
      */
-    void handleConnect();
+    virtual void handleConnect() {
+        connecting = false;
+    }
 
     /** Check if the socket-stream needs to read.
      */
-    virtual bool needToRead();
+    [[nodiscard]] virtual bool needToRead() = 0;
 
-    /** Check if the socket-stream needs to read.
+    /** Check if the socket-stream needs to write.
      */
-    virtual bool needToWrite();
+    [[nodiscard]] virtual bool needToWrite() = 0;
 
     /** Handle ready-to-read event.
-     *
+     * Called when data can be read from the socket without blocking, or when the connection was closed.
      */
-    [[nodiscard]] virtual void handleReadyToReadEvent();
+    virtual void handleReadyToReadEvent() = 0;
 
     /** Handle ready-to-write event.
-     *
+     * Called when data can be written to the socket without blocking.
      */
-    [[nodiscard]] virtual void handleReadyToWriteEvent();
-
+    virtual void handleReadyToWriteEvent() = 0;
 
-}
+protected:
+    /** The maximum number of packets passed to a single scatter/gather call.
+     */
+    static constexpr size_t maxNrGatherpackets = 64;
 
+    /** Write the data in the write buffer to the socket.
+     * The packets are passed directly to a single `writev()` or `WSASend()` call, without copying.
+     *
+     * @return True when all the data was written, false when the socket can not accept more data.
+     * @throw io_error When the connection failed.
+     */
+    bool flushWriteBuffer();
 
+    /** Read the data that is available on the socket into the read buffer.
+     *
+     * @param nrBytes The size of a new packet, when there is no room in the last packet.
+     * @return False when the other side closed the connection.
+     * @throw io_error When the connection failed.
+     */
+    bool fillReadBuffer(ssize_t nrBytes = 65536);
+};
 
 }
-
@@ -0,0 +1,68 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "stream.hpp"
+#include "../exception.hpp"
+#include "../logger.hpp"
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <array>
+#include <cerrno>
+
+namespace tt {
+
+bool Socketstream::flushWriteBuffer()
+{
+    while (writeBuffer.nrBytes() != 0) {
+        auto spans = std::array<std::span<std::byte const>, maxNrGatherpackets>{};
+        ttlet nrSpans = writeBuffer.spans(spans);
+
+        auto vectors = std::array<iovec, maxNrGatherpackets>{};
+        for (auto i = 0_uz; i != nrSpans; ++i) {
+            vectors[i].iov_base = const_cast<std::byte *>(spans[i].data());
+            vectors[i].iov_len = spans[i].size();
+        }
+
+        ttlet nrBytes = ::writev(socket, vectors.data(), static_cast<int>(nrSpans));
+        if (nrBytes == -1) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                return false;
+            } else if (errno == EINTR) {
+                continue;
+            }
+            throw io_error("Could not write to socket: '{}'", get_last_error_message());
+        }
+
+        writeBuffer.read(nrBytes);
+    }
+    return true;
+}
+
+bool Socketstream::fillReadBuffer(ssize_t nrBytes)
+{
+    while (true) {
+        // The last packet is reused while it has room for nrBytes.
+        ttlet buffer = readBuffer.getpacket(nrBytes);
+
+        ttlet nrRead = ::recv(socket, buffer.data(), buffer.size(), 0);
+        if (nrRead == -1) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                return true;
+            } else if (errno == EINTR) {
+                continue;
+            }
+            throw io_error("Could not read from socket: '{}'", get_last_error_message());
+
+        } else if (nrRead == 0) {
+            readBuffer.close();
+            return false;
+        }
+
+        readBuffer.write(nrRead);
+    }
+}
+
+} // namespace tt
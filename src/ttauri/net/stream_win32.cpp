@@ -0,0 +1,63 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "stream.hpp"
+#include "../exception.hpp"
+#include "../logger.hpp"
+#include "../cast.hpp"
+#include <WinSock2.h>
+#include <Windows.h>
+#include <array>
+
+namespace tt {
+
+bool Socketstream::flushWriteBuffer()
+{
+    while (writeBuffer.nrBytes() != 0) {
+        auto spans = std::array<std::span<std::byte const>, maxNrGatherpackets>{};
+        ttlet nrSpans = writeBuffer.spans(spans);
+
+        auto buffers = std::array<WSABUF, maxNrGatherpackets>{};
+        for (auto i = 0_uz; i != nrSpans; ++i) {
+            buffers[i].buf = reinterpret_cast<CHAR *>(const_cast<std::byte *>(spans[i].data()));
+            buffers[i].len = narrow_cast<ULONG>(spans[i].size());
+        }
+
+        DWORD nrBytes = 0;
+        if (WSASend(static_cast<SOCKET>(socket), buffers.data(), narrow_cast<DWORD>(nrSpans), &nrBytes, 0, nullptr, nullptr) ==
+            SOCKET_ERROR) {
+            if (WSAGetLastError() == WSAEWOULDBLOCK) {
+                return false;
+            }
+            throw io_error("Could not write to socket: '{}'", get_last_error_message());
+        }
+
+        writeBuffer.read(narrow_cast<ssize_t>(nrBytes));
+    }
+    return true;
+}
+
+bool Socketstream::fillReadBuffer(ssize_t nrBytes)
+{
+    while (true) {
+        // The last packet is reused while it has room for nrBytes.
+        ttlet buffer = readBuffer.getpacket(nrBytes);
+
+        ttlet nrRead = ::recv(static_cast<SOCKET>(socket), reinterpret_cast<char *>(buffer.data()), narrow_cast<int>(buffer.size()), 0);
+        if (nrRead == SOCKET_ERROR) {
+            if (WSAGetLastError() == WSAEWOULDBLOCK) {
+                return true;
+            }
+            throw io_error("Could not read from socket: '{}'", get_last_error_message());
+
+        } else if (nrRead == 0) {
+            readBuffer.close();
+            return false;
+        }
+
+        readBuffer.write(nrRead);
+    }
+}
+
+} // namespace tt
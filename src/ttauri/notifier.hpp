@@ -5,21 +5,119 @@
 #pragma once
 
 #include "required.hpp"
-#include "unfair_recursive_mutex.hpp"
+#include "assert.hpp"
+#include "unfair_mutex.hpp"
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <vector>
 #include <tuple>
 #include <functional>
 
 namespace tt {
+namespace detail {
+
+/** The part of the state of a notifier that is queued by `notifier::post()`.
+ */
+class notifier_posted_base {
+public:
+    virtual ~notifier_posted_base() = default;
+
+    /** Call the callbacks of the notifier.
+     */
+    virtual void deliver() const noexcept = 0;
+
+    /** Set while the notifier is on the queue of posted notifications.
+     */
+    std::atomic<bool> posted = false;
+};
+
+/** State of a notifier, shared with the queue of posted notifications.
+ */
+template<typename... Args>
+class notifier_state final : public notifier_posted_base {
+public:
+    using callback_type = std::function<void(Args const &...)>;
+    using callbacks_type = std::vector<std::weak_ptr<callback_type>>;
+
+    /** Serializes the writers of the callback list.
+     */
+    unfair_mutex mutex;
+
+    /** The current list of callbacks, it is replaced as a whole on each modification.
+     * A nullptr when no callback was ever subscribed.
+     */
+    std::atomic<std::shared_ptr<callbacks_type const>> callbacks;
+
+    void notify(Args const &...args) const noexcept
+    {
+        ttlet callbacks_ = callbacks.load(std::memory_order::acquire);
+        if (!callbacks_) {
+            return;
+        }
+
+        for (auto &callback : *callbacks_) {
+            if (auto callback_ = callback.lock()) {
+                (*callback_)(args...);
+            }
+        }
+    }
+
+    void deliver() const noexcept override
+    {
+        if constexpr (sizeof...(Args) == 0) {
+            notify();
+        } else {
+            tt_no_default();
+        }
+    }
+
+    /** Replace the list of callbacks with a modified copy.
+     * Expired callbacks are removed from the copy.
+     *
+     * @param func A function which modifies the copied `callbacks_type`.
+     */
+    template<typename Func>
+    void modify(Func &&func) noexcept
+    {
+        ttlet lock = std::scoped_lock(mutex);
+
+        auto new_callbacks = std::make_shared<callbacks_type>();
+        if (ttlet old_callbacks = callbacks.load(std::memory_order::relaxed)) {
+            new_callbacks->reserve(old_callbacks->size() + 1);
+            for (ttlet &callback : *old_callbacks) {
+                if (!callback.expired()) {
+                    new_callbacks->push_back(callback);
+                }
+            }
+        }
+
+        func(*new_callbacks);
+        callbacks.store(std::move(new_callbacks), std::memory_order::release);
+    }
+};
+
+inline unfair_mutex notifier_posted_mutex;
+inline std::vector<std::shared_ptr<notifier_posted_base>> notifier_posted_queue;
+
+/** Called after the first notification is posted on an empty queue.
+ * The GUI sets this to request a frame, in which the posted notifications are delivered.
+ */
+inline std::atomic<void (*)()> notifier_posted_wakeup = nullptr;
+
+} // namespace detail
 
 template<typename T>
 class notifier {
 };
 
 /** A notifier which can be used to call a set of registered callbacks.
- * This class is thread-safe; however you must not use this object
- * from within the callback.
+ *
+ * The list of callbacks is copied on each subscribe or unsubscribe, so that
+ * a notification never takes a lock and the callbacks may subscribe and
+ * unsubscribe callbacks of the same notifier.
+ *
+ * This class is thread-safe.
  *
  * @tparam Result The result of calling the callback.
  * @tparam Args The argument types of the callback function.
@@ -32,6 +130,13 @@ public:
     using callback_type = std::function<Result(Args const &...)>;
     using callback_ptr_type = std::shared_ptr<callback_type>;
 
+    notifier() noexcept : _state(std::make_shared<state_type>()) {}
+
+    notifier(notifier const &) = delete;
+    notifier(notifier &&) = delete;
+    notifier &operator=(notifier const &) = delete;
+    notifier &operator=(notifier &&) = delete;
+
     /** Add a callback to the notifier.
      * Ownership of the callback belongs with the caller of `subscribe()`. The
      * `notifier` will hold a weak_ptr to the callback so that when the callback is destroyed
@@ -41,15 +146,15 @@ public:
      */
     void subscribe_ptr(callback_ptr_type const &callback_ptr) noexcept
     {
-        auto lock = std::scoped_lock(_mutex);
+        _state->modify([&callback_ptr](auto &callbacks) {
+            ttlet i = std::find_if(callbacks.cbegin(), callbacks.cend(), [&callback_ptr](ttlet &item) {
+                return item.lock() == callback_ptr;
+            });
 
-        ttlet i = std::find_if(_callbacks.cbegin(), _callbacks.cend(), [&callback_ptr](ttlet &item) {
-            return item.lock() == callback_ptr;
+            if (i == callbacks.cend()) {
+                callbacks.emplace_back(callback_ptr);
+            }
         });
-
-        if (i == _callbacks.cend()) {
-            _callbacks.emplace_back(callback_ptr);
-        }
     }
 
     /** Add a callback to the notifier.
@@ -65,32 +170,37 @@ public:
     {
         auto callback_ptr = std::make_shared<callback_type>(std::forward<decltype(callback)>(callback));
 
-        auto lock = std::scoped_lock(_mutex);
-        _callbacks.emplace_back(callback_ptr);
+        _state->modify([&callback_ptr](auto &callbacks) {
+            callbacks.emplace_back(callback_ptr);
+        });
         return callback_ptr;
     }
 
     /** Remove a callback from the notifier.
+     * A notification that is already in progress may still call the callback.
+     *
      * @param callback_ptr A share_ptr to the callback function to unsubscribe.
      */
     void unsubscribe(callback_ptr_type const &callback_ptr) noexcept
     {
-        auto lock = std::scoped_lock(_mutex);
-
-        ttlet new_end = std::remove_if(_callbacks.begin(), _callbacks.end(), [&callback_ptr](ttlet &item) {
-            return item.expired() || item.lock() == callback_ptr;
+        _state->modify([&callback_ptr](auto &callbacks) {
+            std::erase_if(callbacks, [&callback_ptr](ttlet &item) {
+                return item.lock() == callback_ptr;
+            });
         });
-        _callbacks.erase(new_end, _callbacks.cend());
     }
 
     std::vector<std::weak_ptr<callback_type>> callbacks() const noexcept
     {
-        auto lock = std::scoped_lock(_mutex);
-
-        // Clean up all the callbacks that expired.
-        std::erase_if(_callbacks, [](auto &x){ return x.expired(); });
-
-        return _callbacks;
+        auto r = std::vector<std::weak_ptr<callback_type>>{};
+        if (ttlet callbacks_ = _state->callbacks.load(std::memory_order::acquire)) {
+            for (ttlet &callback : *callbacks_) {
+                if (!callback.expired()) {
+                    r.push_back(callback);
+                }
+            }
+        }
+        return r;
     }
 
     /** Call the subscribed callbacks with the given arguments.
@@ -98,17 +208,62 @@ public:
      */
     void operator()(Args const &...args) const noexcept
     {
-        auto callbacks_ = callbacks();
-        for (auto &callback : callbacks_) {
-            if (auto callback_ = callback.lock()) {
-                (*callback_)(args...);
+        _state->notify(args...);
+    }
+
+    /** Post a notification to be delivered later.
+     *
+     * The notification is delivered by `deliver_posted_notifications()`, which the GUI calls
+     * once per frame. Notifications that are posted more than once before being delivered
+     * result in a single call of the callbacks.
+     */
+    void post() const noexcept requires(sizeof...(Args) == 0)
+    {
+        if (_state->posted.exchange(true, std::memory_order::acq_rel)) {
+            // Already on the queue.
+            return;
+        }
+
+        bool was_empty;
+        {
+            ttlet lock = std::scoped_lock(detail::notifier_posted_mutex);
+            was_empty = detail::notifier_posted_queue.empty();
+            detail::notifier_posted_queue.push_back(_state);
+        }
+
+        if (was_empty) {
+            if (auto wakeup = detail::notifier_posted_wakeup.load(std::memory_order::acquire)) {
+                wakeup();
             }
-        };
+        }
     }
 
 private:
-    mutable unfair_recursive_mutex _mutex;
-    mutable std::vector<std::weak_ptr<callback_type>> _callbacks;
+    using state_type = detail::notifier_state<Args...>;
+
+    /** The state is shared with the queue of posted notifications, so that
+     * a notifier may be destroyed while its notification is queued.
+     */
+    std::shared_ptr<state_type> _state;
 };
 
+/** Deliver the notifications that were posted with `notifier::post()`.
+ *
+ * This is called by the GUI at the start of each frame, before the widgets are laid out.
+ * A notification that is posted while the callbacks are running is delivered on the next call.
+ */
+inline void deliver_posted_notifications() noexcept
+{
+    auto queue = [] {
+        ttlet lock = std::scoped_lock(detail::notifier_posted_mutex);
+        return std::exchange(detail::notifier_posted_queue, {});
+    }();
+
+    for (ttlet &state : queue) {
+        // Clear the flag before delivering, so that a change during the delivery is not lost.
+        state->posted.exchange(false, std::memory_order::acq_rel);
+        state->deliver();
+    }
+}
+
 } // namespace tt
@@ -0,0 +1,145 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/notifier.hpp"
+#include "ttauri/observable.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace tt;
+
+TEST(Notifier, SubscribeUnsubscribe)
+{
+    auto n = notifier<void(int)>{};
+    int total = 0;
+
+    auto a = n.subscribe([&](int x) {
+        total += x;
+    });
+    auto b = n.subscribe([&](int x) {
+        total += 10 * x;
+    });
+    n(1);
+    ASSERT_EQ(total, 11);
+
+    n.unsubscribe(a);
+    n(1);
+    ASSERT_EQ(total, 21);
+
+    // A destroyed callback is no longer called.
+    b = {};
+    n(1);
+    ASSERT_EQ(total, 21);
+    ASSERT_EQ(n.callbacks().size(), 0);
+}
+
+TEST(Notifier, SubscribeFromCallback)
+{
+    auto n = notifier<void()>{};
+    auto inner = notifier<void()>::callback_ptr_type{};
+    int inner_count = 0;
+
+    auto outer = n.subscribe([&] {
+        if (!inner) {
+            inner = n.subscribe([&] {
+                ++inner_count;
+            });
+        }
+    });
+
+    // The callback subscribed during a notification is called from the next notification.
+    n();
+    ASSERT_EQ(inner_count, 0);
+    n();
+    ASSERT_EQ(inner_count, 1);
+}
+
+TEST(Notifier, Post)
+{
+    auto n = notifier<void()>{};
+    int count = 0;
+    auto cb = n.subscribe([&] {
+        ++count;
+    });
+
+    for (int i = 0; i != 1000; ++i) {
+        n.post();
+    }
+    ASSERT_EQ(count, 0);
+
+    deliver_posted_notifications();
+    ASSERT_EQ(count, 1);
+
+    deliver_posted_notifications();
+    ASSERT_EQ(count, 1);
+
+    n.post();
+    deliver_posted_notifications();
+    ASSERT_EQ(count, 2);
+}
+
+TEST(Notifier, PostAndDestroy)
+{
+    int count = 0;
+    auto cb = notifier<void()>::callback_ptr_type{};
+    {
+        auto n = notifier<void()>{};
+        cb = n.subscribe([&] {
+            ++count;
+        });
+        n.post();
+    }
+
+    // The posted notification is still delivered after the notifier is destroyed.
+    deliver_posted_notifications();
+    ASSERT_EQ(count, 1);
+}
+
+TEST(Notifier, Threads)
+{
+    auto n = notifier<void()>{};
+    auto count = std::atomic<int>{0};
+    auto stop = std::atomic<bool>{false};
+
+    auto notify_thread = std::thread([&] {
+        while (!stop.load()) {
+            n();
+        }
+    });
+
+    for (int i = 0; i != 1000; ++i) {
+        auto cb = n.subscribe([&] {
+            count.fetch_add(1);
+        });
+        n.unsubscribe(cb);
+    }
+
+    stop.store(true);
+    notify_thread.join();
+    ASSERT_EQ(n.callbacks().size(), 0);
+}
+
+TEST(Notifier, CoalescedObservable)
+{
+    auto value = observable<int>{0};
+    value.coalesce_notifications();
+
+    int count = 0;
+    auto cb = value.subscribe([&] {
+        ++count;
+    });
+
+    for (int i = 1; i <= 1000; ++i) {
+        value = i;
+    }
+    ASSERT_EQ(count, 0);
+    ASSERT_EQ(*value, 1000);
+
+    deliver_posted_notifications();
+    ASSERT_EQ(count, 1);
+}
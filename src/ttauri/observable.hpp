@@ -9,7 +9,7 @@
 #include "cast.hpp"
 #include "notifier.hpp"
 #include "detail/observable_value.hpp"
-#include "detail/observable_not.hpp"
+#include "detail/observable_expression.hpp"
 #include <memory>
 #include <functional>
 #include <algorithm>
@@ -67,6 +67,21 @@ public:
     {
     }
 
+    /** Create an observable from an expression of observables.
+     * The whole expression is evaluated by a single node, see `detail::observable_expression`.
+     *
+     * ```
+     * observable<bool> enabled = a && !b;
+     * ```
+     */
+    template<typename Expression>
+    requires detail::is_observable_expression_v<Expression>
+    observable(Expression const &expression) noexcept :
+        observable(std::static_pointer_cast<detail::observable_base<value_type>>(
+            std::make_shared<detail::observable_expression<value_type, Expression>>(expression)))
+    {
+    }
+
     observable &operator=(value_type const &value) noexcept
     {
         store(value);
@@ -159,9 +174,41 @@ public:
         return notifier.unsubscribe(callback_ptr);
     }
 
-    [[nodiscard]] friend observable<bool> operator!(observable const &rhs) noexcept
+    /** Coalesce the notifications of changes in value.
+     * This is shared with all observables that are copied from this one.
+     *
+     * @param flag True to notify once per frame, false to notify on each change.
+     */
+    void coalesce_notifications(bool flag = true) noexcept
+    {
+        tt_axiom(pimpl);
+        pimpl->coalesce_notifications(flag);
+    }
+
+    /** The leaf node of this observable in an expression of observables.
+     */
+    [[nodiscard]] friend detail::observable_leaf<value_type> make_observable_node(observable const &rhs) noexcept
+    {
+        return {rhs.pimpl};
+    }
+
+    /** The logical-not of the observable, as an expression.
+     * Operators on expressions extend the expression, which is turned into a single
+     * observable when it is converted to `observable<bool>`.
+     */
+    [[nodiscard]] friend auto operator!(observable const &rhs) noexcept
+    {
+        return detail::observable_not_expression<detail::observable_leaf<value_type>>{make_observable_node(rhs)};
+    }
+
+    [[nodiscard]] friend auto operator&&(observable const &lhs, observable const &rhs) noexcept
+    {
+        return detail::make_observable_binary_expression<std::logical_and<>>(lhs, rhs);
+    }
+
+    [[nodiscard]] friend auto operator||(observable const &lhs, observable const &rhs) noexcept
     {
-        return std::static_pointer_cast<detail::observable_base<bool>>(std::make_shared<detail::observable_not<bool>>(rhs.pimpl));
+        return detail::make_observable_binary_expression<std::logical_or<>>(lhs, rhs);
     }
 
     [[nodiscard]] friend bool operator==(observable const &lhs, observable const &rhs) noexcept
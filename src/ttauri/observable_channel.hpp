@@ -0,0 +1,138 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "spsc_message_queue.hpp"
+#include "observable.hpp"
+#include "notifier.hpp"
+#include "required.hpp"
+#include "assert.hpp"
+#include <utility>
+#include <optional>
+
+namespace tt {
+
+/** How the values received by an `observable_channel` are stored in its observable.
+ */
+enum class observable_channel_mode {
+    /** The observable is set to the last value received during a frame.
+     */
+    last_value,
+
+    /** The values received during a frame are added to the observable.
+     */
+    accumulate
+};
+
+/** A channel for a worker thread to send values to an observable on the GUI thread.
+ *
+ * The worker sends values through a wait-free single-producer, single-consumer queue, without
+ * taking the `gui_system_mutex` or waiting for the GUI thread. The first value after a drain
+ * posts a notification, so that the GUI drains the channel once at the start of the next frame,
+ * see `deliver_posted_notifications()`; only this post briefly takes the lock of the queue of
+ * posted notifications. The queue is drained into the observable with a single store, so that
+ * the widgets that observe it are notified once per frame.
+ *
+ * The channel must be created and destroyed on the GUI thread, and must outlive the worker
+ * that sends into it.
+ *
+ * @tparam T The type of the values.
+ * @tparam Mode How the values of a frame are stored in the observable.
+ * @tparam Capacity The maximum number of values that are queued between frames, a power of two.
+ */
+template<typename T, observable_channel_mode Mode = observable_channel_mode::last_value, size_t Capacity = 64>
+class observable_channel {
+public:
+    using value_type = T;
+
+    static constexpr observable_channel_mode mode = Mode;
+    static constexpr size_t capacity = Capacity;
+
+    /**
+     * @param target The observable to store the received values in.
+     */
+    observable_channel(observable<value_type> target) noexcept : _target(std::move(target))
+    {
+        _drain_callback = _notifier.subscribe([this] {
+            drain();
+        });
+    }
+
+    observable_channel(observable_channel const &) = delete;
+    observable_channel(observable_channel &&) = delete;
+    observable_channel &operator=(observable_channel const &) = delete;
+    observable_channel &operator=(observable_channel &&) = delete;
+
+    ~observable_channel()
+    {
+        // A notification that is still posted will find the callback expired.
+        _notifier.unsubscribe(_drain_callback);
+    }
+
+    /** Send a value to the GUI thread.
+     * May only be called by the single producer thread.
+     *
+     * @param value The value to send.
+     * @return True when the value was queued, false when the queue is full and the value was dropped.
+     */
+    template<typename Arg>
+    bool try_send(Arg &&value) noexcept
+    {
+        auto *slot = _queue.try_write_start();
+        if (slot == nullptr) {
+            [[unlikely]] return false;
+        }
+
+        *slot = std::forward<Arg>(value);
+        _queue.write_finish();
+
+        // Only the first post before a drain queues the notification.
+        _notifier.post();
+        return true;
+    }
+
+    /** Store the queued values in the observable.
+     * This is called at the start of a frame, it may be called directly by the consumer
+     * when the channel is not used with the GUI.
+     *
+     * @return True when the value of the observable was changed.
+     */
+    bool drain() noexcept
+    {
+        ttlet first = _queue.read_first();
+        ttlet last = _queue.read_last();
+        if (first == last) {
+            return false;
+        }
+
+        auto value = std::optional<value_type>{};
+        if constexpr (mode == observable_channel_mode::accumulate) {
+            value = _target.load();
+        }
+
+        for (auto i = first; i != last; ++i) {
+            auto &message = _queue[i];
+            if constexpr (mode == observable_channel_mode::accumulate) {
+                *value = *value + message;
+            } else if (i + 1 == last) {
+                value = std::move(message);
+            }
+            // Reset the slot so that the producer does not keep a stale value alive.
+            message = value_type{};
+        }
+        _queue.read_finish(last);
+
+        return _target.store(*value);
+    }
+
+private:
+    spsc_message_queue<value_type, capacity> _queue;
+    observable<value_type> _target;
+
+    notifier<void()> _notifier;
+    typename notifier<void()>::callback_ptr_type _drain_callback;
+};
+
+} // namespace tt
@@ -0,0 +1,88 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/observable_channel.hpp"
+#include "ttauri/observable.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace std;
+using namespace tt;
+
+TEST(ObservableChannel, LastValue)
+{
+    auto value = observable<int>{0};
+    int count = 0;
+    auto cb = value.subscribe([&] {
+        ++count;
+    });
+
+    auto channel = observable_channel<int>{value};
+    ASSERT_TRUE(channel.try_send(1));
+    ASSERT_TRUE(channel.try_send(2));
+    ASSERT_TRUE(channel.try_send(3));
+    ASSERT_EQ(*value, 0);
+
+    deliver_posted_notifications();
+    ASSERT_EQ(*value, 3);
+    ASSERT_EQ(count, 1);
+
+    deliver_posted_notifications();
+    ASSERT_EQ(count, 1);
+}
+
+TEST(ObservableChannel, Accumulate)
+{
+    auto value = observable<int>{10};
+    auto channel = observable_channel<int, observable_channel_mode::accumulate>{value};
+
+    ASSERT_TRUE(channel.try_send(1));
+    ASSERT_TRUE(channel.try_send(2));
+    deliver_posted_notifications();
+    ASSERT_EQ(*value, 13);
+
+    ASSERT_TRUE(channel.try_send(4));
+    deliver_posted_notifications();
+    ASSERT_EQ(*value, 17);
+}
+
+TEST(ObservableChannel, Full)
+{
+    auto value = observable<int>{0};
+    auto channel = observable_channel<int, observable_channel_mode::accumulate, 4>{value};
+
+    for (int i = 0; i != 4; ++i) {
+        ASSERT_TRUE(channel.try_send(1));
+    }
+    ASSERT_FALSE(channel.try_send(1));
+
+    deliver_posted_notifications();
+    ASSERT_EQ(*value, 4);
+    ASSERT_TRUE(channel.try_send(1));
+    deliver_posted_notifications();
+    ASSERT_EQ(*value, 5);
+}
+
+TEST(ObservableChannel, Thread)
+{
+    auto value = observable<long long>{0};
+    auto channel = observable_channel<long long, observable_channel_mode::accumulate, 16>{value};
+
+    constexpr long long nr_values = 10'000;
+    auto producer = std::thread([&] {
+        for (long long i = 1; i <= nr_values;) {
+            if (channel.try_send(i)) {
+                ++i;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    while (*value != nr_values * (nr_values + 1) / 2) {
+        deliver_posted_notifications();
+        std::this_thread::yield();
+    }
+    producer.join();
+}
@@ -0,0 +1,75 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/observable.hpp"
+#include <gtest/gtest.h>
+
+using namespace std;
+using namespace tt;
+
+TEST(Observable, Not)
+{
+    auto a = observable<bool>{false};
+    observable<bool> not_a = !a;
+    ASSERT_TRUE(*not_a);
+
+    a = true;
+    ASSERT_FALSE(*not_a);
+
+    // Storing into the expression is forwarded, inverted, to the operand.
+    not_a = true;
+    ASSERT_FALSE(*a);
+
+    observable<bool> not_not_a = !!a;
+    ASSERT_FALSE(*not_not_a);
+    not_not_a = true;
+    ASSERT_TRUE(*a);
+    ASSERT_FALSE(*not_a);
+}
+
+TEST(Observable, Expression)
+{
+    auto a = observable<bool>{false};
+    auto b = observable<bool>{false};
+    auto c = observable<bool>{false};
+    observable<bool> expression = (a && !b) || !(a || c);
+    ASSERT_TRUE(*expression);
+
+    c = true;
+    ASSERT_FALSE(*expression);
+    a = true;
+    ASSERT_TRUE(*expression);
+    b = true;
+    ASSERT_FALSE(*expression);
+
+    // There are multiple operands, so the expression is read-only.
+    ASSERT_FALSE(expression.store(true));
+    ASSERT_FALSE(*expression);
+}
+
+TEST(Observable, ExpressionNotifications)
+{
+    auto a = observable<bool>{false};
+    auto b = observable<bool>{false};
+    observable<bool> expression = !a && !b;
+
+    int count = 0;
+    auto cb = expression.subscribe([&] {
+        ++count;
+    });
+
+    a = true;
+    ASSERT_EQ(count, 1);
+
+    // The value of the expression does not change, no notification.
+    b = true;
+    ASSERT_EQ(count, 1);
+    a = false;
+    ASSERT_EQ(count, 1);
+
+    b = false;
+    ASSERT_EQ(count, 2);
+    ASSERT_TRUE(*expression);
+    ASSERT_FALSE(expression.previous_value());
+}
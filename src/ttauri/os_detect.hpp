@@ -115,7 +115,7 @@ enum class CPPVersion {
 
 #if defined(__amd64__) || defined(__x86_64__) || defined(_M_AMD64)
 #define TT_PROCESSOR TT_CPU_X64
-#elif defined(__arm__) || defined(_M_ARM)
+#elif defined(__arm__) || defined(_M_ARM) || defined(__aarch64__) || defined(_M_ARM64)
 #define TT_PROCESSOR TT_CPU_ARM
 #else
 #error "Could not detect processor."
@@ -136,6 +136,7 @@ enum class Processor {
 #define tt_assume2(condition, msg) __assume(condition)
 #define tt_force_inline __forceinline
 #define tt_no_inline __declspec(noinline)
+#define tt_target(features)
 #define clang_suppress(a)
 #define msvc_suppress(a) _Pragma(tt_stringify(warning(disable:a)))
 
@@ -145,6 +146,7 @@ enum class Processor {
 #define tt_assume2(condition, msg) __builtin_assume(static_cast<bool>(condition))
 #define tt_force_inline inline __attribute__((always_inline))
 #define tt_no_inline __attribute__((noinline))
+#define tt_target(features) __attribute__((target(features)))
 #define clang_suppress(a) _Pragma(tt_stringify(clang diagnostic ignored a))
 #define msvc_suppress(a)
 
@@ -154,6 +156,7 @@ enum class Processor {
 #define tt_assume2(condition, msg) do { if (!(condition)) tt_unreachable(); } while (false)
 #define tt_force_inline inline __attribute__((always_inline))
 #define tt_no_inline __attribute__((noinline))
+#define tt_target(features) __attribute__((target(features)))
 #define clang_suppress(a)
 #define msvc_suppress(a)
 
@@ -163,6 +166,7 @@ enum class Processor {
 #define tt_assume2(condition, msg) static_assert(sizeof(condition) == 1, msg)
 #define tt_force_inline inline
 #define tt_no_inline
+#define tt_target(features)
 #define clang_suppress(a)
 #define msvc_suppress(a)
 
@@ -194,6 +198,30 @@ constexpr size_t hardware_constructive_interference_size = 64;
 
 constexpr bool has_sse = Processor::current == Processor::x64;
 
+/** AVX is enabled by the compiler flags, -mavx or /arch:AVX.
+ */
+#if defined(__AVX__)
+constexpr bool has_avx = true;
+#else
+constexpr bool has_avx = false;
+#endif
+
+/** AVX2 is enabled by the compiler flags, -mavx2 or /arch:AVX2.
+ */
+#if defined(__AVX2__)
+constexpr bool has_avx2 = true;
+#else
+constexpr bool has_avx2 = false;
+#endif
+
+/** 64-bit ARM with NEON, such as Apple Silicon.
+ */
+#if defined(__aarch64__) || defined(_M_ARM64)
+constexpr bool has_neon = true;
+#else
+constexpr bool has_neon = false;
+#endif
+
 #if TT_OPERATING_SYSTEM == TT_OS_WINDOWS
 using os_handle = void *;
 using file_handle = os_handle;
@@ -102,6 +102,10 @@ public:
         ++_column;
     }
 
+    void increment_column(int count) noexcept {
+        _column += count;
+    }
+
     void tab_column() noexcept {
         _column /= 8;
         _column += 1;
@@ -158,7 +162,11 @@ public:
     }
 
     friend std::string to_string(parse_location const &l) noexcept {
-        return fmt::format("{0}:{1}:{2}", l.file(), l.line(), l.column());
+        if (l.has_file()) {
+            return fmt::format("{0}:{1}:{2}", l.file(), l.line(), l.column());
+        } else {
+            return fmt::format("{0}:{1}", l.line(), l.column());
+        }
     }
 
     friend std::ostream& operator<<(std::ostream &os, parse_location const &l) {
@@ -8,6 +8,8 @@
 #include "geometry/extent.hpp"
 #include <algorithm>
 #include <cassert>
+#include <memory>
+#include <memory_resource>
 #include <span>
 #include <string>
 #include <vector>
@@ -95,30 +97,44 @@ private:
 /** A 2D canvas of pixels.
  * This class may either allocate its own memory, or gives access
  * to memory allocated by another API, such as a Vulkan texture.
+ *
+ * Its own memory is allocated from a std::pmr::memory_resource, so that
+ * temporary images can be allocated from an arena.
  */
 template<typename T>
 class pixel_map {
 public:
     /** Construct an empty pixel-map.
      */
-    pixel_map() noexcept : _pixels(nullptr), _width(0), _height(0), _stride(0), _self_allocated(true) {}
+    pixel_map() noexcept :
+        _pixels(nullptr), _width(0), _height(0), _stride(0), _self_allocated(true), _resource(std::pmr::get_default_resource())
+    {
+    }
 
     /** Construct an pixel-map from memory received from an API.
      * @param pixels A pointer to pixels received from the API.
      * @param width The width of the image.
      * @param height The height of the image.
      * @param stride Number of pixel elements until the next row.
+     * @param resource The memory resource to allocate from, when pixels is nullptr.
      */
-    pixel_map(T *pixels, ssize_t width, ssize_t height, ssize_t stride) noexcept :
-        _pixels(pixels), _width(width), _height(height), _stride(stride), _self_allocated(false)
+    pixel_map(
+        T *pixels,
+        ssize_t width,
+        ssize_t height,
+        ssize_t stride,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()) noexcept :
+        _pixels(pixels), _width(width), _height(height), _stride(stride), _self_allocated(false), _resource(resource)
     {
         tt_assert(_stride >= _width);
         tt_assert(_width >= 0);
         tt_assert(_height >= 0);
+        tt_axiom(_resource != nullptr);
 
         if (pixels == nullptr) {
             _self_allocated = true;
-            _pixels = new T[_height * _stride];
+            _pixels = static_cast<T *>(_resource->allocate(nr_elements() * sizeof(T), alignof(T)));
+            std::uninitialized_default_construct_n(_pixels, nr_elements());
         }
     }
 
@@ -144,11 +160,19 @@ public:
      */
     pixel_map(ssize_t width, ssize_t height) noexcept : pixel_map(nullptr, width, height, width) {}
 
+    /** Construct an pixel-map with memory allocated from a memory resource.
+     * @param width The width of the image.
+     * @param height The height of the image.
+     * @param resource The memory resource to allocate from.
+     */
+    pixel_map(ssize_t width, ssize_t height, std::pmr::memory_resource *resource) noexcept :
+        pixel_map(nullptr, width, height, width, resource)
+    {
+    }
+
     ~pixel_map()
     {
-        if (_self_allocated) {
-            delete[] _pixels;
-        }
+        deallocate();
     }
 
     /** Disallowing copying so that life-time of selfAllocated pixels is easy to understand.
@@ -158,14 +182,10 @@ public:
     pixel_map copy() const noexcept
     {
         if (_self_allocated) {
-            auto r = pixel_map(_width, _height);
+            auto r = pixel_map(_width, _height, _resource);
 
             for (ssize_t y = 0; y != _height; ++y) {
-                ttlet src_row = (*this)[y];
-                auto dst_row = r[y];
-                for (ssize_t x = 0; x != _width; ++x) {
-                    dst_row[x] = src_row[x];
-                }
+                std::copy_n((*this)[y].data(), _width, r[y].data());
             }
 
             return r;
@@ -179,7 +199,8 @@ public:
         _width(other._width),
         _height(other._height),
         _stride(other._stride),
-        _self_allocated(other._self_allocated)
+        _self_allocated(other._self_allocated),
+        _resource(other._resource)
     {
         tt_axiom(this != &other);
         other._self_allocated = false;
@@ -212,14 +233,17 @@ public:
     pixel_map &operator=(pixel_map &&other) noexcept
     {
         // Self assignment is allowed.
-        if (_self_allocated) {
-            delete[] _pixels;
+        if (this == &other) {
+            return *this;
         }
+
+        deallocate();
         _pixels = other._pixels;
         _width = other._width;
         _height = other._height;
         _stride = other._stride;
         _self_allocated = other._self_allocated;
+        _resource = other._resource;
         other._self_allocated = false;
         return *this;
     }
@@ -299,8 +323,43 @@ private:
     /** True if the memory was allocated by this class, false if the canvas was received from another API.
      */
     bool _self_allocated;
+
+    /** The memory resource the pixels were allocated from when self allocated.
+     */
+    std::pmr::memory_resource *_resource;
+
+    [[nodiscard]] size_t nr_elements() const noexcept
+    {
+        return narrow_cast<size_t>(_height * _stride);
+    }
+
+    void deallocate() noexcept
+    {
+        if (_self_allocated && _pixels != nullptr) {
+            std::destroy_n(_pixels, nr_elements());
+            _resource->deallocate(_pixels, nr_elements() * sizeof(T), alignof(T));
+        }
+    }
 };
 
+/** The largest allocation in bytes that is recycled by the pixel_map_pool().
+ * Larger images, such as texture atlases, are allocated directly from the default resource.
+ */
+constexpr size_t pixel_map_pool_largest_block = 1024 * 1024;
+
+/** A thread-safe memory resource that recycles the memory of temporary pixel maps.
+ *
+ * The allocations are rounded up to size classes and freed blocks are kept
+ * for reuse, so that rasterizing glyphs and icons into temporary pixel maps
+ * does not allocate from the heap each time.
+ */
+[[nodiscard]] std::pmr::memory_resource *pixel_map_pool() noexcept;
+
+/** The width and height of the square tiles in which images are rotated.
+ * A tile of 32 x 32 pixels of both the source and destination image fits in the L1 cache, even for 8 byte pixels.
+ */
+constexpr ssize_t pixel_map_tile_size = 32;
+
 template<typename T>
 void copy(pixel_map<T> const &src, pixel_map<T> &dst) noexcept
 {
@@ -308,11 +367,7 @@ void copy(pixel_map<T> const &src, pixel_map<T> &dst) noexcept
     ssize_t height = std::min(src.height(), dst.height());
 
     for (ssize_t y = 0; y != height; ++y) {
-        ttlet src_row = src[y];
-        auto dst_row = dst[y];
-        for (ssize_t x = 0; x != width; ++x) {
-            dst_row[x] = src_row[x];
-        }
+        std::copy_n(src[y].data(), width, dst[y].data());
     }
 }
 
@@ -31,7 +31,7 @@ inline void horizontalFilterRow(pixel_row<uint8_t> row, KERNEL kernel) noexcept
 
     // Execute the kernel on all the pixels upto the right edge.
     // The values are still looked up ahead.
-    ttlet lastX = row.width - LOOK_AHEAD_SIZE;
+    ttlet lastX = row.width() - LOOK_AHEAD_SIZE;
     for (; x < lastX; x++) {
         values <<= 8;
         values |= row[LOOK_AHEAD_SIZE + x];
@@ -40,8 +40,8 @@ inline void horizontalFilterRow(pixel_row<uint8_t> row, KERNEL kernel) noexcept
     }
 
     // Finish up to the right edge.
-    ttlet rightEdgeValue = row[row.width - 1];
-    for (; x < row.width; x++) {
+    ttlet rightEdgeValue = row[row.width() - 1];
+    for (; x < row.width(); x++) {
         values <<= 8;
         values |= rightEdgeValue;
 
@@ -52,7 +52,7 @@ inline void horizontalFilterRow(pixel_row<uint8_t> row, KERNEL kernel) noexcept
 template<int KERNEL_SIZE, typename T, typename KERNEL>
 inline void horizontalFilter(pixel_map<T>& pixels, KERNEL kernel) noexcept
 {
-    for (int rowNr = 0; rowNr < pixels.height; rowNr++) {
+    for (int rowNr = 0; rowNr < pixels.height(); rowNr++) {
         auto row = pixels.at(rowNr);
         horizontalFilterRow<KERNEL_SIZE>(row, kernel);
     }
@@ -71,11 +71,9 @@ inline void fill(pixel_map<T> &dst) noexcept
 template<typename T>
 inline void fill(pixel_map<T> &dst, T color) noexcept
 {
-    for (int rowNr = 0; rowNr < dst.height; rowNr++) {
+    for (int rowNr = 0; rowNr < dst.height(); rowNr++) {
         auto row = dst.at(rowNr);
-        for (int columnNr = 0; columnNr < row.width; columnNr++) {
-            row[columnNr] = color;
-        }
+        std::fill_n(row.data(), row.width(), color);
     }
 }
 
@@ -85,12 +83,21 @@ inline void rotate90(pixel_map<T> &dst, pixel_map<T> const &src) noexcept
     assert(dst.width() >= src.height());
     assert(dst.height() >= src.width());
 
-    for (int rowNr = 0; rowNr < src.height(); rowNr++) {
-        ttlet row = src.at(rowNr);
-        ttlet dstColumnNr = src.height() - rowNr - 1;
-        auto dstRowNr = 0;
-        for (int columnNr = 0; columnNr < row.width(); columnNr++) {
-            dst[dstRowNr++][dstColumnNr] = row[columnNr];
+    ttlet width = src.width();
+    ttlet height = src.height();
+
+    // Rotate a tile at a time, so that the rows of both the source and destination tile stay in the cache.
+    for (ssize_t tileY = 0; tileY < height; tileY += pixel_map_tile_size) {
+        ttlet tileYEnd = std::min(tileY + pixel_map_tile_size, height);
+        for (ssize_t tileX = 0; tileX < width; tileX += pixel_map_tile_size) {
+            ttlet tileXEnd = std::min(tileX + pixel_map_tile_size, width);
+
+            for (auto columnNr = tileX; columnNr != tileXEnd; ++columnNr) {
+                auto dstRow = dst[columnNr];
+                for (auto rowNr = tileY; rowNr != tileYEnd; ++rowNr) {
+                    dstRow[height - rowNr - 1] = src[rowNr][columnNr];
+                }
+            }
         }
     }
 }
@@ -101,12 +108,21 @@ inline void rotate270(pixel_map<T> &dst, pixel_map<T> const &src) noexcept
     assert(dst.width() >= src.height());
     assert(dst.height() >= src.width());
 
-    for (int rowNr = 0; rowNr < src.height(); rowNr++) {
-        ttlet row = src.at(rowNr);
-        ttlet dstColumnNr = rowNr;
-        auto dstRowNr = row.width() - 1;
-        for (int columnNr = 0; columnNr < row.width(); columnNr++) {
-            dst[dstRowNr--][dstColumnNr] = row[columnNr];
+    ttlet width = src.width();
+    ttlet height = src.height();
+
+    // Rotate a tile at a time, so that the rows of both the source and destination tile stay in the cache.
+    for (ssize_t tileY = 0; tileY < height; tileY += pixel_map_tile_size) {
+        ttlet tileYEnd = std::min(tileY + pixel_map_tile_size, height);
+        for (ssize_t tileX = 0; tileX < width; tileX += pixel_map_tile_size) {
+            ttlet tileXEnd = std::min(tileX + pixel_map_tile_size, width);
+
+            for (auto columnNr = tileX; columnNr != tileXEnd; ++columnNr) {
+                auto dstRow = dst[width - columnNr - 1];
+                for (auto rowNr = tileY; rowNr != tileYEnd; ++rowNr) {
+                    dstRow[rowNr] = src[rowNr][columnNr];
+                }
+            }
         }
     }
 }
@@ -5,8 +5,10 @@
 #include "ttauri/pixel_map.inl"
 #include "ttauri/graphic_path.hpp"
 #include "ttauri/bezier_curve.hpp"
+#include "ttauri/monotonic_arena.hpp"
 #include <gtest/gtest.h>
 #include <iostream>
+#include <chrono>
 #include <string>
 
 using namespace std;
@@ -34,6 +36,81 @@ TEST(pixel_map_tests, rotate270) {
     ASSERT_EQ(r[0][0], 2); ASSERT_EQ(r[0][1], 4);
 }
 
+TEST(pixel_map_tests, rotateTiled) {
+    // Larger than a tile and not a multiple of the tile size.
+    auto src = pixel_map<uint32_t>(70, 45);
+    for (ssize_t y = 0; y != src.height(); ++y) {
+        for (ssize_t x = 0; x != src.width(); ++x) {
+            src[y][x] = static_cast<uint32_t>(y * 1000 + x);
+        }
+    }
+
+    auto r90 = pixel_map<uint32_t>(45, 70);
+    rotate90(r90, src);
+    auto r270 = pixel_map<uint32_t>(45, 70);
+    rotate270(r270, src);
+
+    for (ssize_t y = 0; y != src.height(); ++y) {
+        for (ssize_t x = 0; x != src.width(); ++x) {
+            ASSERT_EQ(r90[x][src.height() - y - 1], src[y][x]);
+            ASSERT_EQ(r270[src.width() - x - 1][y], src[y][x]);
+        }
+    }
+}
+
+TEST(pixel_map_tests, mergeMaximum) {
+    auto dst = pixel_map<uint8_t>(37, 3);
+    auto src = pixel_map<uint8_t>(37, 3);
+    for (ssize_t y = 0; y != dst.height(); ++y) {
+        for (ssize_t x = 0; x != dst.width(); ++x) {
+            dst[y][x] = static_cast<uint8_t>(x * 7);
+            src[y][x] = static_cast<uint8_t>(255 - x * 5);
+        }
+    }
+
+    mergeMaximum(dst, src);
+    for (ssize_t y = 0; y != dst.height(); ++y) {
+        for (ssize_t x = 0; x != dst.width(); ++x) {
+            ASSERT_EQ(dst[y][x], std::max(static_cast<uint8_t>(x * 7), static_cast<uint8_t>(255 - x * 5)));
+        }
+    }
+}
+
+TEST(pixel_map_tests, atlas_benchmark) {
+    // The size of a page of the glyph atlas.
+    constexpr ssize_t size = 2048;
+    constexpr int nr_iterations = 4;
+
+    auto src = pixel_map<uint8_t>(size, size);
+    auto dst = pixel_map<uint8_t>(size, size);
+    fill(src, uint8_t{1});
+
+    ttlet rotate_start = std::chrono::steady_clock::now();
+    for (int i = 0; i != nr_iterations; ++i) {
+        rotate90(dst, src);
+    }
+    ttlet rotate_duration = std::chrono::steady_clock::now() - rotate_start;
+
+    ttlet merge_start = std::chrono::steady_clock::now();
+    for (int i = 0; i != nr_iterations; ++i) {
+        mergeMaximum(dst, src);
+    }
+    ttlet merge_duration = std::chrono::steady_clock::now() - merge_start;
+
+    ttlet copy_start = std::chrono::steady_clock::now();
+    for (int i = 0; i != nr_iterations; ++i) {
+        copy(src, dst);
+    }
+    ttlet copy_duration = std::chrono::steady_clock::now() - copy_start;
+
+    std::cout << "pixel_map<uint8_t> " << size << "x" << size
+              << " rotate90: " << std::chrono::duration_cast<std::chrono::microseconds>(rotate_duration).count() / nr_iterations
+              << " us, mergeMaximum: " << std::chrono::duration_cast<std::chrono::microseconds>(merge_duration).count() / nr_iterations
+              << " us, copy: " << std::chrono::duration_cast<std::chrono::microseconds>(copy_duration).count() / nr_iterations
+              << " us" << std::endl;
+    ASSERT_EQ(dst[size - 1][size - 1], 1);
+}
+
 TEST(pixel_map_tests, renderMaskFromPath) {
     auto mask = pixel_map<uint8_t>(9, 3);
     fill(mask);
@@ -81,3 +158,66 @@ TEST(pixel_map_tests, renderMaskFromPath) {
 }
 
 
+
+TEST(pixel_map_tests, renderMaskCoverage) {
+    auto mask = pixel_map<uint8_t>(16, 16);
+    fill(mask);
+
+    // A triangle with its left and right corner outside of the image.
+    auto path = graphic_path();
+    path.moveTo(point2{-4.0f, 2.0f});
+    path.lineTo(point2{20.0f, 2.0f});
+    path.lineTo(point2{8.0f, 14.0f});
+    path.closeContour();
+
+    fill(mask, path.getBeziers());
+
+    // The area inside the image is 16 * 12 minus the two corners cut off at the edges.
+    auto area = 0.0f;
+    for (ssize_t y = 0; y != mask.height(); ++y) {
+        for (ssize_t x = 0; x != mask.width(); ++x) {
+            area += static_cast<float>(mask[y][x]) / 255.0f;
+        }
+    }
+    ASSERT_NEAR(area, 144.0f - 2.0f * 8.0f, 0.5f);
+
+    // Pixels fully inside and outside of the triangle.
+    ASSERT_EQ(mask[1][8], 0);
+    ASSERT_EQ(mask[2][0], 255);
+    ASSERT_EQ(mask[2][15], 255);
+    ASSERT_EQ(mask[8][8], 255);
+    ASSERT_EQ(mask[15][8], 0);
+}
+
+TEST(pixel_map_tests, memory_resource) {
+    auto arena = monotonic_arena{};
+
+    auto mask = pixel_map<uint8_t>(4, 4, &arena);
+    fill(mask, uint8_t{7});
+    ASSERT_GE(arena.size(), 16);
+
+    // A copy of a pixel-map is allocated from the same resource.
+    ttlet size = arena.size();
+    auto copy = mask.copy();
+    ASSERT_EQ(copy[3][3], 7);
+    ASSERT_GE(arena.size(), size + 16);
+}
+
+TEST(pixel_map_tests, pool) {
+    uint8_t const *first = nullptr;
+    {
+        auto mask = pixel_map<uint8_t>(64, 64, pixel_map_pool());
+        fill(mask, uint8_t{7});
+        ASSERT_EQ(mask[63][63], 7);
+        first = mask[0].data();
+    }
+
+    // A temporary pixel-map of the same size class reuses the memory that was just released.
+    auto mask = pixel_map<uint8_t>(60, 64, pixel_map_pool());
+    ASSERT_EQ(mask[0].data(), first);
+
+    // An image larger than the largest block is still allocated correctly.
+    auto large = pixel_map<uint8_t>(2048, 1024, pixel_map_pool());
+    fill(large, uint8_t{5});
+    ASSERT_EQ(large[1023][2047], 5);
+}
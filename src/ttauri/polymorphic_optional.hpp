@@ -10,6 +10,7 @@
 #include <memory>
 #include <optional>
 #include <type_traits>
+#include <cstddef>
 
 namespace tt {
 
@@ -34,6 +35,13 @@ public:
 
     static constexpr size_t capacity = Capacity;
 
+    /** Check if an object of a sub-class is stored in the internal buffer.
+     * Objects that are larger than the capacity, or that need a larger alignment
+     * than the internal buffer, are allocated on the heap.
+     */
+    template<typename T>
+    static constexpr bool fits_inline = sizeof(T) <= capacity and alignof(T) <= alignof(std::max_align_t);
+
     /** Destroy any contained value.
      */
     ~polymorphic_optional()
@@ -86,7 +94,7 @@ public:
         reset();
 
         pointer r;
-        if (sizeof(T) <= capacity) {
+        if constexpr (fits_inline<T>) {
             r = new (_value.buffer.data()) T(std::forward<Args>(args)...);
             _state = state::internal;
 
@@ -199,7 +207,7 @@ private:
     state _state;
 
     union {
-        std::array<std::byte, capacity> buffer;
+        alignas(std::max_align_t) std::array<std::byte, capacity> buffer;
         pointer pointer;
     } _value;
 
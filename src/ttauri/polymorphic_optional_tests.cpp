@@ -47,3 +47,36 @@ TEST(polymorphic_optional, assignment) {
     ASSERT_EQ(values[2]->foo(), 3);
 }
 
+
+struct E : public A {
+    std::array<int, 16> values = {};
+
+    int foo() const noexcept override
+    {
+        return 5;
+    }
+};
+
+struct alignas(64) D : public A {
+    int foo() const noexcept override
+    {
+        return 4;
+    }
+};
+
+TEST(polymorphic_optional, fits_inline)
+{
+    using optional_type = polymorphic_optional<A, sizeof(B)>;
+    static_assert(optional_type::fits_inline<A>);
+    static_assert(optional_type::fits_inline<B>);
+    static_assert(not optional_type::fits_inline<E>);
+    static_assert(not optional_type::fits_inline<D>);
+
+    // Objects which are too large or over-aligned are allocated on the heap.
+    optional_type value;
+    value = E{};
+    ASSERT_EQ(value->foo(), 5);
+    value = D{};
+    ASSERT_EQ(value->foo(), 4);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(&*value) % alignof(D), 0);
+}
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "math.hpp"
+#include "geometry/numeric_array.hpp"
 #include <numbers>
 #include <array>
 
@@ -258,4 +259,84 @@ inline results<T,3> solvePolynomial(T const &a, T const &b, T const &c, T const
     }
 }
 
+/** Solve a depressed cubic function in each lane.
+ * The trigonometric and the Cardano solution are calculated for all lanes and selected per lane,
+ * so that lanes with a different number of real roots do not branch. A solution that is not
+ * needed by any of the lanes is skipped.
+ *
+ * A cubic function has at least one real root, lanes with fewer than three real roots repeat
+ * a root. This means that all three roots can be used without checking the number of roots.
+ *
+ * @param p The p coefficient of \f[t^{3}+pt+q=0\f] for each lane.
+ * @param q The q coefficient for each lane.
+ * @return Three roots for each lane, in ascending order when a lane has three real roots.
+ */
+template<std::floating_point T, ssize_t N>
+[[nodiscard]] std::array<numeric_array<T, N>, 3>
+solveDepressedCubic(numeric_array<T, N> const &p, numeric_array<T, N> const &q) noexcept
+{
+    constexpr T oneForth = static_cast<T>(1) / static_cast<T>(4);
+    constexpr T oneTwentySeventh = static_cast<T>(1) / static_cast<T>(27);
+    constexpr T oneThird = static_cast<T>(1) / static_cast<T>(3);
+    constexpr T pi2_3 = (static_cast<T>(2) / static_cast<T>(3)) * std::numbers::pi_v<T>;
+    constexpr T pi4_3 = (static_cast<T>(4) / static_cast<T>(3)) * std::numbers::pi_v<T>;
+    constexpr auto all_lanes = static_cast<unsigned int>((1_uz << N) - 1);
+
+    ttlet zero = numeric_array<T, N>{};
+    ttlet D = oneForth * q * q + oneTwentySeventh * p * p * p;
+    ttlet has_three_roots = lt(D, zero);
+
+    auto r = std::array<numeric_array<T, N>, 3>{};
+    if (has_three_roots != 0) {
+        // The trigonometric solution, the same calculation as solveDepressedCubicTrig().
+        ttlet U = oneThird * acos(((static_cast<T>(3) * q) / (static_cast<T>(2) * p)) * sqrt(static_cast<T>(-3) / p));
+        ttlet V = static_cast<T>(2) * sqrt(-oneThird * p);
+        r[0] = V * cos(U - pi4_3);
+        r[1] = V * cos(U - pi2_3);
+        r[2] = V * cos(U);
+    }
+
+    if (has_three_roots != all_lanes) {
+        // The Cardano solution, the same calculation as solveDepressedCubicCardano().
+        ttlet sqrtD = sqrt(D);
+        ttlet minusHalfQ = static_cast<T>(-0.5) * q;
+        ttlet root = cbrt(minusHalfQ + sqrtD) + cbrt(minusHalfQ - sqrtD);
+
+        // When D is zero the other root is a double root, otherwise the other two roots are complex.
+        ttlet other_root = select(eq(D, zero), static_cast<T>(-0.5) * root, root);
+
+        r[0] = select(has_three_roots, r[0], root);
+        r[1] = select(has_three_roots, r[1], other_root);
+        r[2] = select(has_three_roots, r[2], other_root);
+    }
+    return r;
+}
+
+/** Solve a cubic function in each lane.
+ * \f[ax^{3}+bx^{2}+cx+d=0\f]
+ *
+ * @pre a must not be zero in any lane, lanes where the function is of a lower degree
+ *      must be solved separately.
+ * @return Three roots for each lane, see solveDepressedCubic().
+ */
+template<std::floating_point T, ssize_t N>
+[[nodiscard]] std::array<numeric_array<T, N>, 3> solvePolynomial(
+    numeric_array<T, N> const &a,
+    numeric_array<T, N> const &b,
+    numeric_array<T, N> const &c,
+    numeric_array<T, N> const &d) noexcept
+{
+    ttlet p = (static_cast<T>(3) * a * c - b * b) / (static_cast<T>(3) * a * a);
+    ttlet q = (static_cast<T>(2) * b * b * b - static_cast<T>(9) * a * b * c + static_cast<T>(27) * a * a * d) /
+        (static_cast<T>(27) * a * a * a);
+
+    ttlet b_3a = b / (static_cast<T>(3) * a);
+
+    auto r = solveDepressedCubic(p, q);
+    for (auto &lane_roots : r) {
+        lane_roots = lane_roots - b_3a;
+    }
+    return r;
+}
+
 }
@@ -47,3 +47,47 @@ TEST(TTauriMath, SolveLinear) {
     ASSERT_RESULTS(solvePolynomial(2.0, -6.0), results1(3.0));
     ASSERT_RESULTS(solvePolynomial(3.0, 6.0), results1(-2.0));
 }
+
+template<typename T, tt::ssize_t N>
+static void test_solve_cubic_lanes(std::array<std::array<T, 4>, N> const &coefficients, T abs_error)
+{
+    auto a = numeric_array<T, N>{};
+    auto b = numeric_array<T, N>{};
+    auto c = numeric_array<T, N>{};
+    auto d = numeric_array<T, N>{};
+    for (tt::ssize_t i = 0; i != N; ++i) {
+        a[i] = coefficients[i][0];
+        b[i] = coefficients[i][1];
+        c[i] = coefficients[i][2];
+        d[i] = coefficients[i][3];
+    }
+
+    ttlet r = solvePolynomial(a, b, c, d);
+    for (tt::ssize_t i = 0; i != N; ++i) {
+        // Lanes with a single real root repeat it.
+        ttlet expected = solvePolynomial(a[i], b[i], c[i], d[i]);
+        ASSERT_NEAR(r[0][i], expected.value[0], abs_error) << "lane " << i;
+        ASSERT_NEAR(r[1][i], expected.value[expected.count == 3 ? 1 : 0], abs_error) << "lane " << i;
+        ASSERT_NEAR(r[2][i], expected.value[expected.count == 3 ? 2 : 0], abs_error) << "lane " << i;
+    }
+}
+
+TEST(TTauriMath, SolveCubicLanes) {
+    test_solve_cubic_lanes<double, 4>(
+        {{{1.0, -6.0, 14.0, -15.0}, {1.0, -5.0, -2.0, 24.0}, {1.0, 1.0, 1.0, -3.0}, {1.0, -6.0, 11.0, -6.0}}}, 0.000001);
+    test_solve_cubic_lanes<double, 4>(
+        {{{1.0, 0.0, -7.0, -6.0}, {1.0, -6.0, -6.0, -7.0}, {1.0, -4.0, -9.0, 36.0}, {1.0, 3.0, 3.0, 1.0}}}, 0.000001);
+    test_solve_cubic_lanes<double, 4>(
+        {{{1.0, 3.0, -6.0, -8.0}, {1.0, 4.0, 7.0, 6.0}, {1.0, 2.0, -21.0, 18.0}, {2.0, 9.0, 3.0, -4.0}}}, 0.000001);
+
+    test_solve_cubic_lanes<float, 8>(
+        {{{1.0f, -6.0f, 14.0f, -15.0f},
+          {1.0f, -5.0f, -2.0f, 24.0f},
+          {1.0f, 1.0f, 1.0f, -3.0f},
+          {1.0f, -6.0f, 11.0f, -6.0f},
+          {1.0f, 0.0f, -7.0f, -6.0f},
+          {1.0f, -6.0f, -6.0f, -7.0f},
+          {1.0f, 3.0f, -6.0f, -8.0f},
+          {2.0f, 9.0f, 3.0f, -4.0f}}},
+        0.0001f);
+}
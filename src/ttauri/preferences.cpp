@@ -7,9 +7,26 @@
 #include "file.hpp"
 #include "timer.hpp"
 #include "logger.hpp"
+#include "thread.hpp"
+#include <vector>
+#include <mutex>
 
 namespace tt {
 
+struct preferences_registry {
+    std::mutex mutex;
+    std::vector<preferences *> instances;
+};
+
+/** The instances of preferences, for `preferences::flush_all()`.
+ * The registry is never destroyed, because preferences may be destroyed during static destruction.
+ */
+[[nodiscard]] static preferences_registry &get_preferences_registry() noexcept
+{
+    static auto *r = new preferences_registry{};
+    return *r;
+}
+
 preferences::preferences(URL location) noexcept :
     _location(location), _deserializing(0), _modified(false)
 {
@@ -20,31 +37,98 @@ preferences::preferences(URL location) noexcept :
     _check_modified_ptr = timer::global->add_callback(5s, [this](auto...) {
         this->check_modified();
     });
+
+    _save_thread = std::jthread([this](std::stop_token stop_token) {
+        this->save_thread_loop(std::move(stop_token));
+    });
+
+    auto &registry = get_preferences_registry();
+    ttlet lock = std::scoped_lock(registry.mutex);
+    registry.instances.push_back(this);
 }
 
 preferences::~preferences()
 {
+    auto &registry = get_preferences_registry();
+    ttlet lock = std::scoped_lock(registry.mutex);
+    std::erase(registry.instances, this);
 }
 
 void preferences::save() const noexcept
 {
     ttlet lock = std::scoped_lock(mutex);
 
-    ttlet tmp_location = _location.urlByAppendingExtension(".tmp");
+    // Only take the snapshot while holding the lock, the save thread formats and writes it.
+    auto data = serialize();
+    _modified = false;
+
+    {
+        ttlet save_lock = std::scoped_lock(_save_mutex);
+        _save_data = std::move(data);
+    }
+    _save_condition.notify_all();
+}
+
+void preferences::flush() const noexcept
+{
+    auto lock = std::unique_lock(_save_mutex);
+    _save_condition.wait(lock, [this] {
+        return not _save_data and not _saving;
+    });
+}
+
+void preferences::flush_all() noexcept
+{
+    auto &registry = get_preferences_registry();
+    ttlet lock = std::scoped_lock(registry.mutex);
+    for (auto *instance : registry.instances) {
+        instance->check_modified();
+        instance->flush();
+    }
+}
+
+void preferences::save_thread_loop(std::stop_token stop_token) noexcept
+{
+    set_thread_name("preferences");
+
+    while (true) {
+        auto lock = std::unique_lock(_save_mutex);
+        _save_condition.wait(lock, stop_token, [this] {
+            return _save_data.has_value();
+        });
+
+        if (not _save_data) {
+            // Stop was requested and there is nothing left to write.
+            return;
+        }
+
+        auto data = std::move(*_save_data);
+        _save_data.reset();
+        _saving = true;
+        lock.unlock();
+
+        write(data);
+
+        lock.lock();
+        _saving = false;
+        lock.unlock();
+        _save_condition.notify_all();
+    }
+}
 
-    auto text = format_JSON(serialize());
+void preferences::write(datum const &data) const noexcept
+{
+    ttlet tmp_location = _location.urlByAppendingExtension(".tmp");
 
     try {
         auto file = tt::file(tmp_location, access_mode::truncate_or_create_for_write | access_mode::rename);
-        file.write(text);
+        format_JSON(data, file);
         file.flush();
         file.rename(_location, true);
 
     } catch (io_error const &e) {
         tt_log_error("Could not save preferences to file. \"{}\"", e.what());
     }
-
-    _modified = false;
 }
 
 void preferences::load() noexcept
@@ -6,6 +6,11 @@
 #include "datum.hpp"
 #include "timer.hpp"
 #include <typeinfo>
+#include <optional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <stop_token>
 
 #pragma once
 
@@ -20,6 +25,10 @@ namespace tt {
  * The saving if preferences is delayed to combine multiple modification into a single
  * save. By locking the mutex external to the preferences multiple modifications can
  * be stored atomically.
+ *
+ * Only a snapshot of the preferences is made while the mutex is locked; the snapshot
+ * is formatted and written to the file on a separate thread. Snapshots that are made
+ * while a previous one is being written are combined, only the latest is written.
  */
 class preferences {
 public:
@@ -37,9 +46,20 @@ public:
     [[nodiscard]] virtual void reset() noexcept {}
 
     /** Save the preferences.
+     * The file is written asynchronously, use `flush()` to wait until it is written.
      */
     void save() const noexcept;
 
+    /** Wait until the preferences that were saved are written to the file.
+     */
+    void flush() const noexcept;
+
+    /** Save the modified preferences of every instance, and wait until they are written.
+     * Used on a fast exit of the application, where the destructors of the preferences
+     * are not called.
+     */
+    static void flush_all() noexcept;
+
     /** Load the preferences.
      */
     void load() noexcept;
@@ -112,6 +132,32 @@ private:
 
     timer::callback_ptr_type _check_modified_ptr;
 
+    /** Protects `_save_data` and `_saving`.
+     */
+    mutable std::mutex _save_mutex;
+    mutable std::condition_variable_any _save_condition;
+
+    /** The latest snapshot of the preferences which still needs to be written.
+     */
+    mutable std::optional<datum> _save_data;
+
+    /** The save thread is writing a snapshot to the file.
+     */
+    mutable bool _saving = false;
+
+    /** The thread that writes the preferences.
+     * Declared last, so that it is joined before the other members are destroyed;
+     * a snapshot that is still pending is written before the thread stops.
+     */
+    std::jthread _save_thread;
+
+    void save_thread_loop(std::stop_token stop_token) noexcept;
+
+    /** Write a snapshot of the preferences to the file.
+     * The data is written to a temporary file first, which is then renamed over the old file.
+     */
+    void write(datum const &data) const noexcept;
+
     /** This function is called whenever data is modified.
      */
     void set_modified() noexcept
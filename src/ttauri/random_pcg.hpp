@@ -7,7 +7,9 @@
 #include "math.hpp"
 #include "byte_string.hpp"
 #include "cast.hpp"
+#include "geometry/numeric_array.hpp"
 #include <atomic>
+#include <span>
 
 namespace tt {
 
@@ -99,4 +101,112 @@ public:
 
 inline atomic_pcg32 global_pcg32 = atomic_pcg32();
 
+/** A PCG32 generator with N independent streams, to generate blocks of random numbers.
+ *
+ * The streams are advanced together, so that the state update and output permutation are
+ * done on all lanes of a `numeric_array` at once. Each stream has its own increment; stream zero
+ * uses the increment of `pcg32`, so that `pcg32xN<1>` produces the same numbers as `pcg32`
+ * with the same seed.
+ *
+ * The fill functions interleave the streams: element `k * N + i` is the k-th number of stream i.
+ *
+ * @tparam N The number of streams, 4 or 8 fill a SIMD register with 32 bit results.
+ */
+template<ssize_t N>
+class pcg32xN {
+public:
+    using state_type = numeric_array<uint64_t, N>;
+    using result_type = numeric_array<uint32_t, N>;
+
+    static constexpr ssize_t nr_streams = N;
+
+    pcg32xN(uint64_t seed = 0x4d595df4d0f33173) noexcept
+    {
+        for (ssize_t i = 0; i != N; ++i) {
+            // Flipping even bits of the increment keeps it odd, as required for a full period.
+            _increment[i] = increment ^ (static_cast<uint64_t>(i) * 0x9e37'79b9'7f4a'7c16);
+        }
+        _state = state_type::broadcast(seed) + _increment;
+        (*this)();
+    }
+
+    /** Get the next number of each stream.
+     */
+    [[nodiscard]] result_type operator()() noexcept
+    {
+        ttlet x = _state;
+        _state = x * state_type::broadcast(multiplier) + _increment;
+
+        auto r = result_type{};
+        for (ssize_t i = 0; i != N; ++i) {
+            ttlet xorshifted = static_cast<uint32_t>((x[i] ^ (x[i] >> 18)) >> 27);
+            r[i] = std::rotr(xorshifted, static_cast<int>(x[i] >> 59));
+        }
+        return r;
+    }
+
+    /** Fill a span with random 32 bit integers.
+     */
+    void fill(std::span<uint32_t> r) noexcept
+    {
+        fill(r, [](uint32_t x) {
+            return x;
+        });
+    }
+
+    /** Fill a span with random floats uniformly distributed between 0.0 and 1.0, excluding 1.0.
+     */
+    void fill(std::span<float> r) noexcept
+    {
+        fill(r, [](uint32_t x) {
+            // The 24 most significant bits fit exactly in the mantissa of a float.
+            return static_cast<float>(x >> 8) * 0x1p-24f;
+        });
+    }
+
+    /** Fill a span with random integers between first and last, excluding last.
+     *
+     * The integers are scaled from 32 bit random numbers with a multiply, without rejection of
+     * numbers, which gives a bias of at most `(last - first) / 2^32`.
+     */
+    void fill(std::span<int32_t> r, int32_t first, int32_t last) noexcept
+    {
+        tt_axiom(first < last);
+        ttlet range = static_cast<uint64_t>(static_cast<int64_t>(last) - static_cast<int64_t>(first));
+        fill(r, [first, range](uint32_t x) {
+            return static_cast<int32_t>(static_cast<int64_t>(first) + static_cast<int64_t>((x * range) >> 32));
+        });
+    }
+
+private:
+    static constexpr uint64_t multiplier = 6364136223846793005u;
+    static constexpr uint64_t increment = 1442695040888963407u;
+
+    state_type _state;
+    state_type _increment;
+
+    template<typename T, typename Func>
+    void fill(std::span<T> r, Func const &func) noexcept
+    {
+        auto it = r.begin();
+        ttlet nr_blocks = std::ssize(r) / N;
+        for (ssize_t i = 0; i != nr_blocks; ++i) {
+            ttlet x = (*this)();
+            for (ssize_t j = 0; j != N; ++j) {
+                *it++ = func(x[j]);
+            }
+        }
+
+        if (it != r.end()) {
+            ttlet x = (*this)();
+            for (ssize_t j = 0; it != r.end(); ++j) {
+                *it++ = func(x[j]);
+            }
+        }
+    }
+};
+
+using pcg32x4 = pcg32xN<4>;
+using pcg32x8 = pcg32xN<8>;
+
 }
\ No newline at end of file
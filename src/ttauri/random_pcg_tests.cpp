@@ -0,0 +1,77 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/random_pcg.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+using namespace tt;
+
+TEST(RandomPCG, ScalarStream)
+{
+    auto scalar = pcg32{42};
+    auto vector = pcg32xN<1>{42};
+
+    auto r = std::vector<uint32_t>(1000);
+    vector.fill(r);
+    for (ttlet x : r) {
+        ASSERT_EQ(x, scalar());
+    }
+}
+
+TEST(RandomPCG, IndependentStreams)
+{
+    auto generator = pcg32x4{42};
+    auto scalar = pcg32{42};
+
+    auto r = std::vector<uint32_t>(4 * 100 + 3);
+    generator.fill(r);
+
+    for (size_t i = 0; i != 100; ++i) {
+        // Stream zero is the scalar stream.
+        ASSERT_EQ(r[i * 4], scalar());
+
+        // The other streams are different.
+        ASSERT_NE(r[i * 4 + 1], r[i * 4]);
+        ASSERT_NE(r[i * 4 + 2], r[i * 4 + 1]);
+        ASSERT_NE(r[i * 4 + 3], r[i * 4 + 2]);
+    }
+}
+
+TEST(RandomPCG, Float)
+{
+    auto generator = pcg32x8{};
+
+    auto r = std::vector<float>(10'000);
+    generator.fill(r);
+
+    double sum = 0.0;
+    for (ttlet x : r) {
+        ASSERT_GE(x, 0.0f);
+        ASSERT_LT(x, 1.0f);
+        sum += x;
+    }
+    ASSERT_NEAR(sum / std::ssize(r), 0.5, 0.01);
+}
+
+TEST(RandomPCG, Integer)
+{
+    auto generator = pcg32x8{};
+
+    auto r = std::vector<int32_t>(10'000);
+    generator.fill(r, -3, 5);
+
+    auto counts = std::array<int, 8>{};
+    for (ttlet x : r) {
+        ASSERT_GE(x, -3);
+        ASSERT_LT(x, 5);
+        ++counts[x + 3];
+    }
+    for (ttlet count : counts) {
+        ASSERT_GT(count, 1000);
+    }
+}
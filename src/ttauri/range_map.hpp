@@ -1,4 +1,4 @@
-// Copyright Take Vos 2020.
+// Copyright Take Vos 2020-2021.
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
@@ -10,114 +10,294 @@
 #include <memory>
 #include <algorithm>
 #include <set>
+#include <limits>
+#include <bit>
+#include <cstdint>
+#include <cstddef>
 
 namespace tt {
 
+/** An immutable map from ranges of keys to values, optimized for lookups.
+ *
+ * The map is build from a list of ranges, each given by its first key and its value; a range
+ * ends at the first key of the next range, the last range ends at the maximum key. Keys below
+ * the first range are not in the map.
+ *
+ * The values are deduplicated in a table, and the first keys of the ranges are stored in a
+ * separate array together with a 16 bit index into this table. The array is ordered in Eytzinger
+ * (breadth-first) layout, so that a lookup is a branch-free descent of an implicit binary tree
+ * of which the top levels share the same cache lines.
+ *
+ * @tparam Key An ordered key type, such as `char32_t`.
+ * @tparam Value An ordered and copyable value type.
+ */
 template<typename Key, typename Value>
-class range_map {
-    using values = std::set<Value>;
+class frozen_range_map {
+public:
+    using key_type = Key;
+    using value_type = Value;
 
-    struct item {
-        Key first;
-        Key last;
-        std::shared_ptr<values> values;
+    constexpr frozen_range_map() noexcept = default;
+    frozen_range_map(frozen_range_map const &) = default;
+    frozen_range_map(frozen_range_map &&) noexcept = default;
+    frozen_range_map &operator=(frozen_range_map const &) = default;
+    frozen_range_map &operator=(frozen_range_map &&) noexcept = default;
 
-        item &operation+=(Value const &value) noexcept {
-            if (values->count(value) == 0) {
-                // When a value is added we need to create a new set.
-                auto tmp = *values;
-                tmp.insert(value)
-                values = std::make_shared<values>(std::move(tmp));
-            }
-            return *this;
+    /** Build the map from a list of ranges.
+     *
+     * @param ranges A range of pairs of the first key of a range and its value, ordered by key.
+     *               Adjacent ranges with the same value are merged.
+     */
+    template<typename Ranges>
+    explicit frozen_range_map(Ranges const &ranges) noexcept
+    {
+        for (ttlet &range : ranges) {
+            _values.push_back(range.second);
         }
+        std::sort(_values.begin(), _values.end());
+        _values.erase(std::unique(_values.begin(), _values.end()), _values.end());
+        _values.shrink_to_fit();
+        tt_assert(_values.size() < no_value, "Too many unique values in a frozen_range_map.");
 
-        [[nodiscard]] friend bool can_be_merged(item const &lhs, item const &rhs) noexcept {
-            return lhs.last == rhs.first && lhs.values == rhs.values;
+        // The first keys and value indices in key order, with adjacent ranges with the same value merged.
+        auto sorted_keys = std::vector<Key>{};
+        auto sorted_value_indices = std::vector<uint16_t>{};
+        for (ttlet &range : ranges) {
+            ttlet value_index = index_of_value(range.second);
+            tt_axiom(sorted_keys.empty() or sorted_keys.back() < range.first);
+            if (sorted_value_indices.empty() or sorted_value_indices.back() != value_index) {
+                sorted_keys.push_back(range.first);
+                sorted_value_indices.push_back(value_index);
+            }
         }
-    };
 
-    std::vector<item> items;
+        // Node zero is not used, so that the children of node k are 2k and 2k + 1.
+        _keys.resize(sorted_keys.size() + 1);
+        _value_indices.resize(sorted_keys.size() + 1);
+        build_eytzinger(sorted_keys, sorted_value_indices, 0, 1);
+        _last_value_index = sorted_value_indices.empty() ? no_value : sorted_value_indices.back();
+    }
 
-    /** Get iterator to the first item that contains value.
+    /** The number of ranges, after merging adjacent ranges with the same value.
      */
-    auto find(Key const &key) noexcept {
-        return std::lower_bound(items.begin(), items.end(), key, [](ttlet &a, ttlet &b) {
-            return a.first < b;
-        });
+    [[nodiscard]] size_t size() const noexcept
+    {
+        return _keys.empty() ? 0 : _keys.size() - 1;
     }
 
-public:
-    range_map() noexcept {
-        items.emplace_back(std::numeric_limits<Key>::min(), std::numeric_limits<Key>::max());
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size() == 0;
     }
 
-    /** Insert half open range of keys.
-     * Inserts may be slow, since it may require moves of large number of objects
-     * and allocations.
+    /** Find the value of the range that contains the key.
+     *
+     * @param key The key to look up.
+     * @return A pointer to the value, or nullptr when the key is below the first range.
      */
-    void insert(Key const &first, Key const &last, Value &&value) noexcept {
-        tt_assert(last > first);
+    [[nodiscard]] Value const *find(Key const &key) const noexcept
+    {
+        ttlet n = size();
 
-        // Find all (partially) overlapping items.
-        auto first_ = find(first);
-        auto last_ = find(last);
-        ttlet delta = std::distance(first_, last_);
-        tt_axiom(delta >= 0);
+        // Descent to the first key that is larger than the key.
+        size_t k = 1;
+        while (k <= n) {
+            k = 2 * k + static_cast<size_t>(_keys[k] <= key);
+        }
+        // Undo the right-turns after the last left-turn, zero when all keys are less or equal.
+        k >>= std::countr_one(k) + 1;
 
-        tt_axiom(first_ != items.end());
-        if (first_->first != first) {
-            // Split the first element.
-            ttlet tmp_last = first_->last;
-            first_->last = first;
+        ttlet value_index = k == 0 ? _last_value_index : _value_indices[k];
+        return value_index == no_value ? nullptr : &_values[value_index];
+    }
 
-            first_ = items.emplace(first_ + 1, first, tmp_last, first_->values);
-            last_ = first_ + delta;
-        }
+    /** Get the value of the range that contains the key.
+     *
+     * @pre The key must not be below the first range.
+     */
+    [[nodiscard]] Value const &operator[](Key const &key) const noexcept
+    {
+        ttlet value = find(key);
+        tt_axiom(value != nullptr);
+        return *value;
+    }
+
+private:
+    static constexpr uint16_t no_value = std::numeric_limits<uint16_t>::max();
 
-        tt_axiom(last_ != items.end());
-        if (last_->last != last) {
-            // Split the last element.
-            ttlet tmp_first = last_->first;
-            last_->first = last;
+    /** The first keys of the ranges in Eytzinger layout.
+     */
+    std::vector<Key> _keys;
 
-            last_ = items.emplace(last_, tmp_first, last, first_->values);
-            first_ = last_ - delta;
+    /** For each node in `_keys`, the index in `_values` of the range that ends at the key of the node.
+     */
+    std::vector<uint16_t> _value_indices;
+
+    /** The deduplicated values, in sort order.
+     */
+    std::vector<Value> _values;
+
+    /** The index in `_values` of the last range.
+     */
+    uint16_t _last_value_index = no_value;
+
+    [[nodiscard]] uint16_t index_of_value(Value const &value) const noexcept
+    {
+        ttlet it = std::lower_bound(_values.cbegin(), _values.cend(), value);
+        tt_axiom(it != _values.cend() and *it == value);
+        return static_cast<uint16_t>(std::distance(_values.cbegin(), it));
+    }
+
+    /** Fill the subtree at node k with the sorted ranges starting at index i, in-order.
+     * @return The index of the first range after the subtree.
+     */
+    size_t build_eytzinger(
+        std::vector<Key> const &sorted_keys,
+        std::vector<uint16_t> const &sorted_value_indices,
+        size_t i,
+        size_t k) noexcept
+    {
+        if (k < _keys.size()) {
+            i = build_eytzinger(sorted_keys, sorted_value_indices, i, 2 * k);
+            _keys[k] = sorted_keys[i];
+            _value_indices[k] = i == 0 ? no_value : sorted_value_indices[i - 1];
+            i = build_eytzinger(sorted_keys, sorted_value_indices, i + 1, 2 * k + 1);
         }
+        return i;
+    }
+};
+
+/** A map from half open ranges of keys to sets of values.
+ *
+ * Ranges may overlap; the set of a key contains the values of every range that was inserted
+ * with that key. Use `freeze()` to create a map that is optimized for lookups.
+ */
+template<typename Key, typename Value>
+class range_map {
+public:
+    using value_set = std::set<Value>;
 
-        tt_axiom(last_ != items.end());
-        ++last_;
-        for (auto i = first_; i != last_; ++i) {
+    range_map() noexcept
+    {
+        items.push_back({std::numeric_limits<Key>::min(), std::numeric_limits<Key>::max(), std::make_shared<value_set>()});
+    }
+
+    /** Insert half open range of keys.
+     * Inserts may be slow, since it may require moves of large number of objects
+     * and allocations.
+     */
+    void insert(Key const &first, Key const &last, Value const &value) noexcept
+    {
+        tt_assert(last > first);
+
+        split(first);
+        split(last);
+        for (auto i = find(first); i != items.end() and i->first < last; ++i) {
             *i += value;
         }
     }
 
     /** Optimize range_map for improved lookup performance and reduced memory footprint.
      */
-    void optimize() noexcept {
-        std::set<std::shared_ptr<values>,[](ttlet &lhs, ttlet &rhs) { return *lhs < *rhs; }> values_set;
+    void optimize() noexcept
+    {
+        auto values_set = std::set<std::shared_ptr<value_set>, value_set_ptr_less>{};
 
         auto p = items.begin();
-        values_set.insert(p->values);
-        for (auto i = p + 1; i != items.end(); p = i++) {
+        p->values = *values_set.insert(p->values).first;
+        for (auto i = p + 1; i != items.end(); ++i) {
             // De-duplicate value-sets.
-            ttlet [deduplicated_values, dummy] = values_set.insert(i->values);
-            i->values = *deduplicated_values;
+            i->values = *values_set.insert(i->values).first;
 
             if (can_be_merged(*p, *i)) {
-                // By merging p into i, we can erase p and directly get a new iterator to i.
-                i->first = p->first;
-                i = items.erase(p)
+                p->last = i->last;
+            } else {
+                *++p = std::move(*i);
             }
         }
 
+        items.erase(p + 1, items.end());
         items.shrink_to_fit();
     }
 
-    values const &operator[](Key const &key) const noexcept {
-        return *((find(key))->values);
+    /** Create an immutable copy of the map that is optimized for lookups.
+     */
+    [[nodiscard]] frozen_range_map<Key, value_set> freeze() const noexcept
+    {
+        auto ranges = std::vector<std::pair<Key, value_set>>{};
+        ranges.reserve(items.size());
+        for (ttlet &item : items) {
+            ranges.emplace_back(item.first, *item.values);
+        }
+        return frozen_range_map<Key, value_set>{ranges};
     }
-};
 
+    value_set const &operator[](Key const &key) const noexcept
+    {
+        return *(find(key)->values);
+    }
+
+private:
+    struct item {
+        Key first;
+        Key last;
+        std::shared_ptr<value_set> values;
+
+        item &operator+=(Value const &value) noexcept
+        {
+            if (values->count(value) == 0) {
+                // When a value is added we need to create a new set.
+                auto tmp = *values;
+                tmp.insert(value);
+                values = std::make_shared<value_set>(std::move(tmp));
+            }
+            return *this;
+        }
+
+        [[nodiscard]] friend bool can_be_merged(item const &lhs, item const &rhs) noexcept
+        {
+            return lhs.last == rhs.first && lhs.values == rhs.values;
+        }
+    };
+
+    struct value_set_ptr_less {
+        [[nodiscard]] bool operator()(std::shared_ptr<value_set> const &lhs, std::shared_ptr<value_set> const &rhs) const noexcept
+        {
+            return *lhs < *rhs;
+        }
+    };
+
+    /** The items, ordered by key; together they cover all keys.
+     */
+    std::vector<item> items;
+
+    /** Get iterator to the item that contains the key.
+     */
+    [[nodiscard]] auto find(Key const &key) noexcept
+    {
+        return std::upper_bound(items.begin(), items.end(), key, [](ttlet &a, ttlet &b) {
+                   return a < b.first;
+               }) - 1;
+    }
+
+    [[nodiscard]] auto find(Key const &key) const noexcept
+    {
+        return std::upper_bound(items.cbegin(), items.cend(), key, [](ttlet &a, ttlet &b) {
+                   return a < b.first;
+               }) - 1;
+    }
+
+    /** Split the item that contains the key, so that an item starts at key.
+     */
+    void split(Key const &key) noexcept
+    {
+        auto i = find(key);
+        if (i->first != key and i->last != key) {
+            ttlet last = i->last;
+            i->last = key;
+            items.insert(i + 1, item{key, last, i->values});
+        }
+    }
+};
 
-}
\ No newline at end of file
+} // namespace tt
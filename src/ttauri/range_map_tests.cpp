@@ -0,0 +1,94 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/range_map.hpp"
+#include <gtest/gtest.h>
+#include <array>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace tt;
+
+TEST(RangeMap, Insert)
+{
+    auto map = range_map<int, char>{};
+    map.insert(10, 20, 'a');
+    map.insert(15, 30, 'b');
+
+    ASSERT_EQ(map[9], set<char>{});
+    ASSERT_EQ(map[10], set<char>{'a'});
+    ASSERT_EQ(map[14], set<char>{'a'});
+    ASSERT_EQ(map[15], (set<char>{'a', 'b'}));
+    ASSERT_EQ(map[19], (set<char>{'a', 'b'}));
+    ASSERT_EQ(map[20], set<char>{'b'});
+    ASSERT_EQ(map[29], set<char>{'b'});
+    ASSERT_EQ(map[30], set<char>{});
+
+    map.insert(20, 30, 'a');
+    map.optimize();
+    ASSERT_EQ(map[14], set<char>{'a'});
+    ASSERT_EQ(map[15], (set<char>{'a', 'b'}));
+    ASSERT_EQ(map[29], (set<char>{'a', 'b'}));
+    ASSERT_EQ(map[30], set<char>{});
+
+    ttlet frozen = map.freeze();
+    // [min,10) [10,15) [15,30) [30,max)
+    ASSERT_EQ(frozen.size(), 4);
+    for (int key = -5; key != 40; ++key) {
+        ASSERT_EQ(frozen[key], map[key]);
+    }
+}
+
+TEST(FrozenRangeMap, Find)
+{
+    ttlet ranges = std::array{
+        std::pair<char32_t, int>{0x10, 1},
+        std::pair<char32_t, int>{0x20, 2},
+        std::pair<char32_t, int>{0x30, 2},
+        std::pair<char32_t, int>{0x40, 1}};
+
+    ttlet map = frozen_range_map<char32_t, int>{ranges};
+    ASSERT_EQ(map.size(), 3);
+    ASSERT_EQ(map.find(0x00), nullptr);
+    ASSERT_EQ(map.find(0x0f), nullptr);
+    ASSERT_EQ(map[0x10], 1);
+    ASSERT_EQ(map[0x1f], 1);
+    ASSERT_EQ(map[0x20], 2);
+    ASSERT_EQ(map[0x3f], 2);
+    ASSERT_EQ(map[0x40], 1);
+    ASSERT_EQ(map[0x10ffff], 1);
+
+    ttlet empty = frozen_range_map<char32_t, int>{};
+    ASSERT_EQ(empty.find(0x10), nullptr);
+}
+
+TEST(FrozenRangeMap, CompareWithBinarySearch)
+{
+    auto engine = std::mt19937{42};
+
+    for (size_t nr_ranges = 1; nr_ranges != 300; ++nr_ranges) {
+        auto ranges = std::vector<std::pair<int, int>>{};
+        auto key = 0;
+        for (size_t i = 0; i != nr_ranges; ++i) {
+            key += 1 + static_cast<int>(engine() % 10);
+            ranges.emplace_back(key, static_cast<int>(engine() % 8));
+        }
+
+        ttlet map = frozen_range_map<int, int>{ranges};
+        for (auto k = 0; k <= key + 1; ++k) {
+            ttlet it = std::upper_bound(ranges.cbegin(), ranges.cend(), k, [](ttlet &a, ttlet &b) {
+                return a < b.first;
+            });
+
+            if (it == ranges.cbegin()) {
+                ASSERT_EQ(map.find(k), nullptr);
+            } else {
+                ASSERT_NE(map.find(k), nullptr);
+                ASSERT_EQ(*map.find(k), (it - 1)->second);
+            }
+        }
+    }
+}
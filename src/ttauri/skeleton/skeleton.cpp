@@ -20,6 +20,11 @@
 #include "../formula/formula.hpp"
 #include "../strings.hpp"
 #include "../algorithm.hpp"
+#include <filesystem>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <utility>
 
 namespace tt {
 
@@ -65,6 +70,14 @@ static void parse_skeleton_hash(skeleton_parse_context &context)
 
         context.start_of_text_segment();
 
+    } else if (context.starts_with_and_advance_over("parallel for ")) {
+        auto name_expression = context.parse_expression_and_advance_over(":");
+        auto list_expression = context.parse_expression_and_advance_over("\n");
+
+        context.push<skeleton_for_node>(location, std::move(name_expression), std::move(list_expression), true);
+
+        context.start_of_text_segment();
+
     } else if (context.starts_with_and_advance_over("while ")) {
         auto expression = context.parse_expression_and_advance_over("\n");
 
@@ -216,8 +229,84 @@ static void parse_skeleton_escape(skeleton_parse_context &context)
     auto top = std::move(context.statement_stack.back());
     context.statement_stack.pop_back();
 
+    context.post_process_context.fold_constants = true;
     top->post_process(context.post_process_context);
     return top;
 }
 
+/** A skeleton in the cache, with the modification time of each file that it was parsed from.
+ */
+struct skeleton_cache_entry {
+    using stamp_type = std::optional<std::filesystem::file_time_type>;
+
+    std::shared_ptr<skeleton_node const> skeleton;
+    std::vector<std::pair<URL, stamp_type>> stamps;
+};
+
+static std::mutex skeleton_cache_mutex;
+static std::unordered_map<URL, skeleton_cache_entry> skeleton_cache;
+
+/** Get the modification time of a skeleton file.
+ * Non-file URLs, for example embedded resources, do not have a modification time and never change.
+ */
+[[nodiscard]] static skeleton_cache_entry::stamp_type skeleton_file_stamp(URL const &url) noexcept
+{
+    if (!url.isFileScheme()) {
+        return {};
+    }
+
+    auto ec = std::error_code{};
+    ttlet time = std::filesystem::last_write_time(std::filesystem::path{url.nativeWPath()}, ec);
+    if (ec) {
+        return {};
+    }
+    return time;
+}
+
+[[nodiscard]] std::shared_ptr<skeleton_node const> parse_skeleton_cached(URL const &url)
+{
+    {
+        ttlet lock = std::scoped_lock(skeleton_cache_mutex);
+
+        ttlet i = skeleton_cache.find(url);
+        if (i != skeleton_cache.end()) {
+            ttlet &stamps = i->second.stamps;
+            ttlet is_fresh = std::all_of(stamps.cbegin(), stamps.cend(), [](ttlet &item) {
+                return skeleton_file_stamp(item.first) == item.second;
+            });
+
+            if (is_fresh) {
+                return i->second.skeleton;
+            }
+        }
+    }
+
+    // Parse outside of the lock, so that other skeletons can be retrieved in the meantime.
+    // The stamp is taken before reading the file, so that a change during parsing causes a re-parse.
+    auto entry = skeleton_cache_entry{};
+    entry.stamps.emplace_back(url, skeleton_file_stamp(url));
+
+    ttlet view = url.loadView();
+    ttlet text = view->string_view();
+    auto context = skeleton_parse_context(url, text.cbegin(), text.cend());
+    entry.skeleton = parse_skeleton(context);
+
+    for (auto &dependency : context.dependencies) {
+        auto stamp = skeleton_file_stamp(dependency);
+        entry.stamps.emplace_back(std::move(dependency), std::move(stamp));
+    }
+
+    auto r = entry.skeleton;
+
+    ttlet lock = std::scoped_lock(skeleton_cache_mutex);
+    skeleton_cache.insert_or_assign(url, std::move(entry));
+    return r;
+}
+
+void clear_skeleton_cache() noexcept
+{
+    ttlet lock = std::scoped_lock(skeleton_cache_mutex);
+    skeleton_cache.clear();
+}
+
 }
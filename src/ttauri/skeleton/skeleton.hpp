@@ -7,6 +7,7 @@
 #include "skeleton_node.hpp"
 #include "skeleton_parse_context.hpp"
 #include "../resource_view.hpp"
+#include <memory>
 
 namespace tt {
 
@@ -31,4 +32,19 @@ namespace tt {
     return parse_skeleton(std::move(url), sv.cbegin(), sv.cend());
 }
 
+/** Parse a skeleton from a file, through a process-wide cache.
+ *
+ * The cached skeleton is re-parsed when the modification time of the file,
+ * or of any of the files it includes, has changed.
+ *
+ * @param url The location of the skeleton file.
+ * @return The parsed skeleton, shared with other callers; it can be evaluated concurrently.
+ */
+[[nodiscard]] std::shared_ptr<skeleton_node const> parse_skeleton_cached(URL const &url);
+
+/** Remove all skeletons from the cache.
+ * Skeletons that are still in use remain valid until they are released.
+ */
+void clear_skeleton_cache() noexcept;
+
 }
@@ -15,6 +15,10 @@ struct skeleton_block_node final: skeleton_node {
     formula_post_process_context::function_type function;
     formula_post_process_context::function_type super_function;
 
+    /** The names of the local variables; the index of a name is its slot.
+     */
+    std::vector<std::string> local_names;
+
     skeleton_block_node(parse_location location, formula_post_process_context &context, std::unique_ptr<formula_node> name_expression) noexcept :
         skeleton_node(std::move(location)), name(name_expression->get_name())
     {
@@ -43,13 +47,15 @@ struct skeleton_block_node final: skeleton_node {
         tt_assert(function);
 
         context.push_super(super_function);
+        context.push_scope(local_names);
         for (ttlet &child: children) {
             child->post_process(context);
         }
+        context.pop_scope();
         context.pop_super();
     }
 
-    datum evaluate(formula_evaluation_context &context) override {
+    datum evaluate(formula_evaluation_context &context) const override {
         datum tmp;
         try {
             tmp = function(context, datum::vector{});
@@ -72,8 +78,8 @@ struct skeleton_block_node final: skeleton_node {
         }
     }
 
-    datum evaluate_call(formula_evaluation_context &context, datum::vector const &arguments) {
-        context.push();
+    datum evaluate_call(formula_evaluation_context &context, datum::vector const &arguments) const {
+        context.push(&local_names);
         auto tmp = evaluate_children(context, children);
         context.pop();
 
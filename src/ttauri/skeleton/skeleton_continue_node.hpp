@@ -11,7 +11,7 @@ namespace tt {
 struct skeleton_continue_node final: skeleton_node {
     skeleton_continue_node(parse_location location) noexcept : skeleton_node(std::move(location)) {}
 
-    datum evaluate(formula_evaluation_context &context) override {
+    datum evaluate(formula_evaluation_context &context) const override {
         return datum::_continue{};
     }
 
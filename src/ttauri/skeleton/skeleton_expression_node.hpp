@@ -15,14 +15,14 @@ struct skeleton_expression_node final: skeleton_node {
         skeleton_node(std::move(location)), expression(std::move(expression)) {}
 
     void post_process(formula_post_process_context &context) override {
-        post_process_expression(context, *expression, location);
+        post_process_expression(context, expression, location);
     }
 
     std::string string() const noexcept override {
         return fmt::format("<expression {}>", *expression);
     }
 
-    datum evaluate(formula_evaluation_context &context) override {
+    datum evaluate(formula_evaluation_context &context) const override {
         ttlet tmp = evaluate_formula_without_output(context, *expression, location);
         if (tmp.is_break()) {
             throw operation_error("{}: Found #break not inside a loop statement.", location);
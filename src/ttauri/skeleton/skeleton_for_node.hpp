@@ -5,6 +5,10 @@
 #pragma once
 
 #include "skeleton_node.hpp"
+#include "../thread_pool.hpp"
+#include <future>
+#include <vector>
+#include <string>
 
 namespace tt {
 
@@ -15,8 +19,12 @@ struct skeleton_for_node final: skeleton_node {
     statement_vector children;
     statement_vector else_children;
 
-    skeleton_for_node(parse_location location, std::unique_ptr<formula_node> name_expression, std::unique_ptr<formula_node> list_expression) noexcept :
-        skeleton_node(std::move(location)), name_expression(std::move(name_expression)), list_expression(std::move(list_expression)) {}
+    /** The iterations are evaluated in chunks on the thread pool, see `evaluate_parallel()`.
+     */
+    bool is_parallel = false;
+
+    skeleton_for_node(parse_location location, std::unique_ptr<formula_node> name_expression, std::unique_ptr<formula_node> list_expression, bool is_parallel = false) noexcept :
+        skeleton_node(std::move(location)), name_expression(std::move(name_expression)), list_expression(std::move(list_expression)), is_parallel(is_parallel) {}
 
     /** Append a template-piece to the current template.
     */
@@ -46,8 +54,8 @@ struct skeleton_for_node final: skeleton_node {
             else_children.back()->left_align();
         }
 
-        post_process_expression(context, *name_expression, location);
-        post_process_expression(context, *list_expression, location);
+        post_process_expression(context, name_expression, location);
+        post_process_expression(context, list_expression, location);
 
         for (ttlet &child: children) {
             child->post_process(context);
@@ -57,7 +65,7 @@ struct skeleton_for_node final: skeleton_node {
         }
     }
 
-    datum evaluate(formula_evaluation_context &context) override {
+    datum evaluate(formula_evaluation_context &context) const override {
         auto list_data = evaluate_formula_without_output(context, *list_expression, location);
 
         if (!list_data.is_vector()) {
@@ -65,7 +73,10 @@ struct skeleton_for_node final: skeleton_node {
         }
 
         ttlet output_size = context.output_size();
-        if (list_data.size() > 0) {
+        if (is_parallel && list_data.size() > 1 && can_evaluate_parallel()) {
+            evaluate_parallel(context, list_data);
+
+        } else if (list_data.size() > 0) {
             ttlet loop_size = std::ssize(list_data);
             ssize_t loop_count = 0;
             for (auto i = list_data.vector_begin(); i != list_data.vector_end(); ++i) {
@@ -81,7 +92,9 @@ struct skeleton_for_node final: skeleton_node {
                 auto tmp = evaluate_children(context, children);
                 context.loop_pop();
 
-                if (tmp.is_break()) {
+                if (is_parallel && !tmp.is_undefined() && !tmp.is_continue()) {
+                    throw operation_error("{}: Unexpected #break or #return in a #parallel for loop.", location);
+                } else if (tmp.is_break()) {
                     break;
                 } else if (tmp.is_continue()) {
                     continue;
@@ -103,8 +116,71 @@ struct skeleton_for_node final: skeleton_node {
         return {};
     }
 
+    [[nodiscard]] static bool can_evaluate_parallel() noexcept {
+        return !thread_pool_is_worker() && thread_pool_start() && thread_pool_nr_workers() > 0;
+    }
+
+    /** Evaluate the iterations of the loop in chunks on the thread pool.
+     *
+     * Each chunk is evaluated with its own copy of the variables of the context, and the output
+     * of the chunks is written to the context in order. Therefor assignments inside the loop to
+     * variables outside of the loop are lost, and #break and #return are not allowed.
+     *
+     * A #parallel for loop inside another, or inside a task of the thread pool, is evaluated
+     * sequentially, since a worker which waits for other tasks could dead-lock the thread pool.
+     * The same rules apply to a #parallel for loop that is evaluated sequentially.
+     */
+    void evaluate_parallel(formula_evaluation_context &context, datum const &list_data) const {
+        ttlet loop_size = std::ssize(list_data);
+        ttlet nr_chunks = std::min(loop_size, narrow_cast<ssize_t>(thread_pool_nr_workers() * 4));
+        ttlet chunk_size = (loop_size + nr_chunks - 1) / nr_chunks;
+
+        ttlet evaluate_chunk = [&](ssize_t first, ssize_t last) {
+            auto chunk_context = formula_evaluation_context{};
+            chunk_context.output_disable_count = context.output_disable_count;
+            chunk_context.local_stack = context.local_stack;
+            chunk_context.loop_stack = context.loop_stack;
+            chunk_context.globals = context.globals;
+
+            for (auto loop_count = first; loop_count != last; ++loop_count) {
+                try {
+                    name_expression->assign_without_output(chunk_context, *(list_data.vector_begin() + loop_count));
+
+                } catch (std::exception const &e) {
+                    throw operation_error("{}: Could not evaluate for-loop expression.\n{}", location, e.what());
+                }
+
+                chunk_context.loop_push(loop_count, loop_size);
+                auto tmp = evaluate_children(chunk_context, children);
+                chunk_context.loop_pop();
+
+                if (!tmp.is_undefined() && !tmp.is_continue()) {
+                    throw operation_error("{}: Unexpected #break or #return in a #parallel for loop.", location);
+                }
+            }
+            return std::move(chunk_context.output);
+        };
+
+        auto futures = std::vector<std::future<std::string>>{};
+        futures.reserve(nr_chunks);
+        for (ssize_t first = 0; first < loop_size; first += chunk_size) {
+            ttlet last = std::min(first + chunk_size, loop_size);
+            futures.push_back(thread_pool_async([&evaluate_chunk, first, last] {
+                return evaluate_chunk(first, last);
+            }, thread_pool_priority::interactive));
+        }
+
+        // The chunks refer to the context and the list, wait for all of them before an exception is rethrown.
+        for (ttlet &future: futures) {
+            future.wait();
+        }
+        for (auto &future: futures) {
+            context.write(future.get());
+        }
+    }
+
     std::string string() const noexcept override {
-        std::string s = "<for ";
+        std::string s = is_parallel ? "<parallel for " : "<for ";
         s += to_string(*name_expression);
         s += ": ";
         s += to_string(*list_expression);
@@ -15,6 +15,10 @@ struct skeleton_function_node final: skeleton_node {
 
     formula_post_process_context::function_type super_function;
 
+    /** The names of the local variables, starting with the arguments; the index of a name is its slot.
+     */
+    std::vector<std::string> local_names;
+
     skeleton_function_node(parse_location location, formula_post_process_context &context, std::unique_ptr<formula_node> function_declaration_expression) noexcept :
         skeleton_node(std::move(location))
     {
@@ -26,12 +30,12 @@ struct skeleton_function_node final: skeleton_node {
         argument_names = std::move(name_and_arguments);
 
         super_function = context.set_function(name,
-            [this,&location](formula_evaluation_context &context, datum::vector const &arguments) {
+            [this](formula_evaluation_context &context, datum::vector const &arguments) {
             try {
                 return this->evaluate_call(context, arguments);
 
             } catch (std::exception const &e) {
-                throw operation_error("{}: Failed during handling of function call.\n{}", location, e.what());
+                throw operation_error("{}: Failed during handling of function call.\n{}", this->location, e.what());
             }
         }
         );
@@ -49,29 +53,37 @@ struct skeleton_function_node final: skeleton_node {
             children.back()->left_align();
         }
 
+        local_names = argument_names;
+
         context.push_super(super_function);
+        context.push_scope(local_names);
         for (ttlet &child: children) {
             child->post_process(context);
         }
+        context.pop_scope();
         context.pop_super();
     }
 
-    datum evaluate(formula_evaluation_context &context) override {
+    datum evaluate(formula_evaluation_context &context) const override {
         return {};
     }
 
-    datum evaluate_call(formula_evaluation_context &context, datum::vector const &arguments) {
-        context.push();
+    datum evaluate_call(formula_evaluation_context &context, datum::vector const &arguments) const {
+        context.push(&local_names);
         if (std::ssize(argument_names) != std::ssize(arguments)) {
             throw operation_error("{}: Invalid number of arguments to function {}() expecting {} got {}.", location, name, argument_names.size(), arguments.size());
         }
 
+        // The arguments are the first slots of the scope.
         for (ssize_t i = 0; i != std::ssize(argument_names); ++i) {
-            context.set(argument_names[i], arguments[i]);
+            context.set(i, argument_names[i], arguments[i]);
         }
 
+        // Hold the output of the function, it is reset below when the function returns a value.
         ttlet output_size = context.output_size();
+        context.hold_output();
         auto tmp = evaluate_children(context, children);
+        context.release_output();
         context.pop();
 
         if (tmp.is_break()) {
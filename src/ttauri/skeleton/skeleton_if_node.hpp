@@ -51,7 +51,7 @@ struct skeleton_if_node final: skeleton_node {
     void post_process(formula_post_process_context &context) override {
         tt_assert(std::ssize(expressions) == std::ssize(formula_locations));
         for (ssize_t i = 0; i != std::ssize(expressions); ++i) {
-            post_process_expression(context, *expressions[i], formula_locations[i]);
+            post_process_expression(context, expressions[i], formula_locations[i]);
         }
 
         for (ttlet &children: children_groups) {
@@ -65,7 +65,7 @@ struct skeleton_if_node final: skeleton_node {
         }
     }
 
-    datum evaluate(formula_evaluation_context &context) override {
+    datum evaluate(formula_evaluation_context &context) const override {
         tt_axiom(std::ssize(expressions) == std::ssize(formula_locations));
         for (ssize_t i = 0; i != std::ssize(expressions); ++i) {
             if (evaluate_formula_without_output(context, *expressions[i], formula_locations[i])) {
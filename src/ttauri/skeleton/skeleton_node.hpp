@@ -49,11 +49,11 @@ struct skeleton_node {
     *         datum::break when a \#break statement was encountered. datum::continue when a \#continue statement
     *         was encountered. Otherwise data returned from a \#return statement.
     */
-    [[nodiscard]] virtual datum evaluate(formula_evaluation_context &context) {
+    [[nodiscard]] virtual datum evaluate(formula_evaluation_context &context) const {
         tt_no_default();
     }
 
-    [[nodiscard]] std::string evaluate_output(formula_evaluation_context &context) {
+    [[nodiscard]] std::string evaluate_output(formula_evaluation_context &context) const {
         auto tmp = evaluate(context);
         if (tmp.is_break()) {
             throw operation_error("{}: Found #break not inside a loop statement.", location);
@@ -62,6 +62,7 @@ struct skeleton_node {
             throw operation_error("{}: Found #continue not inside a loop statement.", location);
 
         } else if (tmp.is_undefined()) {
+            context.flush_output();
             return std::move(context.output);
 
         } else {
@@ -69,11 +70,21 @@ struct skeleton_node {
         }
     }
 
-    [[nodiscard]] std::string evaluate_output() {
+    [[nodiscard]] std::string evaluate_output() const {
         auto context = formula_evaluation_context{};
         return evaluate_output(context);
     }
 
+    /** Evaluate the template, passing the output in chunks to a sink.
+    * @param context The context used by expressions inside the template.
+    * @param sink Called with each chunk of output, in order.
+    */
+    void evaluate_output(formula_evaluation_context &context, formula_evaluation_context::output_sink_type sink) const {
+        context.output_sink = std::move(sink);
+        ttlet remainder = evaluate_output(context);
+        tt_axiom(remainder.empty());
+    }
+
     [[nodiscard]] virtual std::string string() const noexcept {
         return "<skeleton_node>";
     }
@@ -111,9 +122,9 @@ struct skeleton_node {
         }
     }
 
-    static void post_process_expression(formula_post_process_context &context, formula_node &expression, parse_location const &location) {
+    static void post_process_expression(formula_post_process_context &context, std::unique_ptr<formula_node> &expression, parse_location const &location) {
         try {
-            return expression.post_process(context);
+            return context.post_process(expression);
 
         } catch (std::exception const &e) {
             throw operation_error("{}: Could not post-process expression.\n{}", location, e.what());
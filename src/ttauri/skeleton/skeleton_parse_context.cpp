@@ -8,6 +8,8 @@
 #include "skeleton_do_node.hpp"
 #include "skeleton_string_node.hpp"
 #include "skeleton.hpp"
+#include <iterator>
+#include <algorithm>
 
 namespace tt {
 
@@ -126,8 +128,16 @@ void skeleton_parse_context::include(parse_location _location, std::unique_ptr<f
 
     ttlet new_skeleton_path = current_skeleton_directory.urlByAppendingPath(static_cast<std::string>(argument));
 
+    ttlet view = new_skeleton_path.loadView();
+    ttlet text = view->string_view();
+    auto include_context = skeleton_parse_context(new_skeleton_path, text.cbegin(), text.cend());
+    auto include_skeleton = parse_skeleton(include_context);
+
+    dependencies.push_back(new_skeleton_path);
+    std::move(include_context.dependencies.begin(), include_context.dependencies.end(), std::back_inserter(dependencies));
+
     if (std::ssize(statement_stack) > 0) {
-        if (!statement_stack.back()->append(parse_skeleton(new_skeleton_path))) {
+        if (!statement_stack.back()->append(std::move(include_skeleton))) {
             throw parse_error("{}: Unexpected #include statement.", location);
         }
     } else {
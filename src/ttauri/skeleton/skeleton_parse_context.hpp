@@ -10,6 +10,7 @@
 #include <memory>
 #include <string_view>
 #include <optional>
+#include <vector>
 
 namespace tt {
 
@@ -32,6 +33,10 @@ struct skeleton_parse_context {
     */
     formula_post_process_context post_process_context;
 
+    /** The files that were included, directly or indirectly, while parsing the template.
+    */
+    std::vector<URL> dependencies;
+
     skeleton_parse_context() = delete;
     skeleton_parse_context(skeleton_parse_context const &other) = delete;
     skeleton_parse_context &operator=(skeleton_parse_context const &other) = delete;
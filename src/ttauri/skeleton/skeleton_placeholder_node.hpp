@@ -24,7 +24,7 @@ struct skeleton_placeholder_node final : skeleton_node {
     void post_process(formula_post_process_context &context) override
     {
         try {
-            expression->post_process(context);
+            context.post_process(expression);
 
         } catch (std::exception const &e) {
             throw operation_error("{}: Could not post process placeholder.\n{}", location, e.what());
@@ -36,7 +36,7 @@ struct skeleton_placeholder_node final : skeleton_node {
         return fmt::format("<placeholder {}>", *expression);
     }
 
-    datum evaluate(formula_evaluation_context &context) override
+    datum evaluate(formula_evaluation_context &context) const override
     {
         ttlet output_size = context.output_size();
 
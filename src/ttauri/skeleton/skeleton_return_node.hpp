@@ -15,10 +15,10 @@ struct skeleton_return_node final: skeleton_node {
         skeleton_node(std::move(location)), expression(std::move(expression)) {}
 
     void post_process(formula_post_process_context &context) override {
-        post_process_expression(context, *expression, location);
+        post_process_expression(context, expression, location);
     }
 
-    datum evaluate(formula_evaluation_context &context) override {
+    datum evaluate(formula_evaluation_context &context) const override {
         return evaluate_formula_without_output(context, *expression, location);
     }
 
@@ -38,7 +38,7 @@ struct skeleton_string_node final: skeleton_node {
         return fmt::format("<text {}>", text);
     }
 
-    datum evaluate(formula_evaluation_context &context) override {
+    datum evaluate(formula_evaluation_context &context) const override {
         context.write(text);
         return {};
     }
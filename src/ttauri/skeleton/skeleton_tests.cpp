@@ -3,9 +3,12 @@
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #include "ttauri/skeleton/skeleton.hpp"
+#include "ttauri/subsystem.hpp"
 #include <gtest/gtest.h>
 #include <iostream>
 #include <string>
+#include <filesystem>
+#include <chrono>
 
 using namespace std;
 using namespace tt;
@@ -185,6 +188,78 @@ TEST(skeleton, For) {
 
 }
 
+TEST(skeleton, ParallelFor) {
+    std::unique_ptr<skeleton_node> t;
+    std::string result;
+
+    start_system();
+
+    ASSERT_NO_THROW(t = parse_skeleton(URL("none:"),
+        "foo\n"
+        "#function double(x)\n"
+        "#return x * 2\n"
+        "#end\n"
+        "#parallel for a: [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39]\n"
+        "value ${$i} is ${double(a)}\n"
+        "#end\n"
+        "bar\n"
+    ));
+    ASSERT_NO_THROW(result = t->evaluate_output());
+    ASSERT_EQ(result,
+        "foo\n"
+        "value 0 is 0\n"
+        "value 1 is 2\n"
+        "value 2 is 4\n"
+        "value 3 is 6\n"
+        "value 4 is 8\n"
+        "value 5 is 10\n"
+        "value 6 is 12\n"
+        "value 7 is 14\n"
+        "value 8 is 16\n"
+        "value 9 is 18\n"
+        "value 10 is 20\n"
+        "value 11 is 22\n"
+        "value 12 is 24\n"
+        "value 13 is 26\n"
+        "value 14 is 28\n"
+        "value 15 is 30\n"
+        "value 16 is 32\n"
+        "value 17 is 34\n"
+        "value 18 is 36\n"
+        "value 19 is 38\n"
+        "value 20 is 40\n"
+        "value 21 is 42\n"
+        "value 22 is 44\n"
+        "value 23 is 46\n"
+        "value 24 is 48\n"
+        "value 25 is 50\n"
+        "value 26 is 52\n"
+        "value 27 is 54\n"
+        "value 28 is 56\n"
+        "value 29 is 58\n"
+        "value 30 is 60\n"
+        "value 31 is 62\n"
+        "value 32 is 64\n"
+        "value 33 is 66\n"
+        "value 34 is 68\n"
+        "value 35 is 70\n"
+        "value 36 is 72\n"
+        "value 37 is 74\n"
+        "value 38 is 76\n"
+        "value 39 is 78\n"
+        "bar\n"
+    );
+
+    ASSERT_NO_THROW(t = parse_skeleton(URL("none:"),
+        "#parallel for a: [1, 2, 3, 4]\n"
+        "#if a == 3\n"
+        "#break\n"
+        "#end\n"
+        "#end\n"
+    ));
+    ASSERT_THROW(result = t->evaluate_output(), operation_error);
+}
+
 TEST(skeleton, While) {
     std::unique_ptr<skeleton_node> t;
     std::string result;
@@ -379,6 +454,28 @@ TEST(skeleton, FunctionReplaceAndSuper) {
     );
 }
 
+TEST(skeleton, FunctionLocals) {
+    std::unique_ptr<skeleton_node> t;
+    std::string result;
+
+    ASSERT_NO_THROW(t = parse_skeleton(URL("none:"),
+        "# a = 1\n"
+        "# b = 2\n"
+        "#function count(n)\n"
+        "#if n == 0\n"
+        "#return b\n"
+        "#end\n"
+        "# b = count(n - 1)\n"
+        "#return b + a\n"
+        "#end\n"
+        "value is ${count(3)}, a is ${a}, b is ${b}\n"
+    ));
+    ASSERT_NO_THROW(result = t->evaluate_output());
+    // b is read from the global scope until it is assigned inside the function,
+    // the assignment creates a local variable which does not change the global.
+    ASSERT_EQ(result, "value is 5, a is 1, b is 2\n");
+}
+
 TEST(skeleton, FunctionReturn) {
     std::unique_ptr<skeleton_node> t;
     std::string result;
@@ -412,6 +509,42 @@ TEST(skeleton, FunctionReturn) {
     );
 }
 
+TEST(skeleton, OutputSink) {
+    std::unique_ptr<skeleton_node> t;
+    std::string result;
+
+    ASSERT_NO_THROW(t = parse_skeleton(URL("none:"),
+        "foo\n"
+        "#function foo(bar, baz)\n"
+        "    This text is ignored\n"
+        "    #return bar + baz\n"
+        "#end\n"
+        "#for a: [42, 43, 44, 45]\n"
+        "value is ${a} ${foo(a, 1)}\n"
+        "#end\n"
+        "bar\n"
+    ));
+    ASSERT_NO_THROW(result = t->evaluate_output());
+
+    auto chunks = std::vector<std::string>{};
+    auto context = formula_evaluation_context{};
+    context.output_chunk_size = 8;
+    ASSERT_NO_THROW(t->evaluate_output(context, [&](std::string_view chunk) {
+        chunks.emplace_back(chunk);
+    }));
+
+    ASSERT_GT(std::ssize(chunks), 4);
+    ASSERT_EQ(join(chunks), result);
+    ASSERT_EQ(result,
+        "foo\n"
+        "value is 42 43\n"
+        "value is 43 44\n"
+        "value is 44 45\n"
+        "value is 45 46\n"
+        "bar\n"
+    );
+}
+
 TEST(skeleton, Block) {
     std::unique_ptr<skeleton_node> t;
 
@@ -426,7 +559,7 @@ TEST(skeleton, Block) {
         "<top "
             "<text foo\n>"
             "<block foo"
-                "<text value is ><placeholder (1 + 2)><text \n>"
+                "<text value is ><placeholder 3><text \n>"
             ">"
             "<text bar\n>"
         ">"
@@ -447,3 +580,31 @@ TEST(skeleton, Include) {
         ">"
     );
 }
+
+TEST(skeleton, Cache) {
+    clear_skeleton_cache();
+
+    std::shared_ptr<skeleton_node const> t1;
+    std::shared_ptr<skeleton_node const> t2;
+    ASSERT_NO_THROW(t1 = parse_skeleton_cached(URL("file:includer.ttt")));
+    ASSERT_NO_THROW(t2 = parse_skeleton_cached(URL("file:includer.ttt")));
+    ASSERT_EQ(t1, t2);
+    ASSERT_EQ(normalize_lf(t1->evaluate_output()), "foo\nbaz\nbar\n");
+
+    // Touching an included file invalidates the cached skeleton.
+    ttlet includee_path = std::filesystem::path{URL("file:includee.tti").nativeWPath()};
+    ttlet includee_time = std::filesystem::last_write_time(includee_path);
+    std::filesystem::last_write_time(includee_path, includee_time + std::chrono::seconds{1});
+
+    ASSERT_NO_THROW(t2 = parse_skeleton_cached(URL("file:includer.ttt")));
+    std::filesystem::last_write_time(includee_path, includee_time);
+    ASSERT_NE(t1, t2);
+    ASSERT_EQ(normalize_lf(t2->evaluate_output()), "foo\nbaz\nbar\n");
+
+    // Skeletons that are in use remain valid after the cache is cleared.
+    clear_skeleton_cache();
+    ASSERT_NO_THROW(t2 = parse_skeleton_cached(URL("file:includer.ttt")));
+    ASSERT_NE(t1, t2);
+    ASSERT_EQ(normalize_lf(t1->evaluate_output()), "foo\nbaz\nbar\n");
+}
+
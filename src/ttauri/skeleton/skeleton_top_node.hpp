@@ -31,7 +31,7 @@ struct skeleton_top_node final: skeleton_node {
         }
     }
 
-    datum evaluate(formula_evaluation_context &context) override {
+    datum evaluate(formula_evaluation_context &context) const override {
         try {
             return evaluate_children(context, children);
 
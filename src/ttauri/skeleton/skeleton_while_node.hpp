@@ -27,13 +27,13 @@ struct skeleton_while_node final: skeleton_node {
             children.back()->left_align();
         }
 
-        post_process_expression(context, *expression, location);
+        post_process_expression(context, expression, location);
         for (ttlet &child: children) {
             child->post_process(context);
         }
     }
 
-    datum evaluate(formula_evaluation_context &context) override {
+    datum evaluate(formula_evaluation_context &context) const override {
         ttlet output_size = context.output_size();
 
         ssize_t loop_count = 0;
@@ -5,13 +5,25 @@
 #pragma once
 
 #include "required.hpp"
+#include "os_detect.hpp"
+#include "cast.hpp"
 #include <array>
 #include <utility>
 #include <optional>
 #include <type_traits>
+#include <bit>
+#include <cstdint>
+#if TT_PROCESSOR == TT_CPU_X64
+#include <emmintrin.h>
+#endif
 
 namespace tt {
 
+/** A map with a small fixed capacity, searched linearly.
+ *
+ * Keys that are integers or enums of 1, 2 or 4 bytes are also stored in a separate array,
+ * which on x64 is searched sixteen bytes at a time using SSE2.
+ */
 template<typename K, typename V, int N>
 class small_map {
 public:
@@ -25,15 +37,28 @@ public:
     using array_type = std::array<item_type, capacity>;
 
 private:
+    static constexpr bool has_key_array =
+        (std::is_integral_v<K> || std::is_enum_v<K>) && (sizeof(K) == 1 || sizeof(K) == 2 || sizeof(K) == 4);
+
+    static constexpr int nr_keys_per_chunk = 16 / sizeof(K);
+
+    /** The size of the key array, padded to whole chunks.
+     */
+    static constexpr int key_array_size = has_key_array ? (capacity + nr_keys_per_chunk - 1) / nr_keys_per_chunk * nr_keys_per_chunk : 0;
+
     typename array_type::iterator _end;
     array_type items = {};
 
+    /** A copy of the keys of the items, the keys after the last item are not valid.
+     */
+    alignas(16) std::array<K, key_array_size> _keys = {};
+
 public:
     small_map() {
         _end = items.begin();
     }
 
-    small_map(small_map const &other) {
+    small_map(small_map const &other) : _keys(other._keys) {
         tt_axiom(this != &other);
         _end = items.begin();
         for (ttlet &other_item: other) {
@@ -42,10 +67,10 @@ public:
         }
     }
 
-    small_map(small_map &&other) {
+    small_map(small_map &&other) : _keys(other._keys) {
         tt_axiom(this != &other);
         using std::swap;
-  
+
         _end = items.begin();
         for (auto &other_item: other) {
             auto &this_item = *(_end++);
@@ -56,6 +81,7 @@ public:
 
     small_map &operator=(small_map const &other) {
         tt_return_on_self_assignment(other);
+        _keys = other._keys;
         _end = items.begin();
         for (ttlet &other_item: other) {
             auto &this_item = *(_end++);
@@ -66,6 +92,7 @@ public:
 
     small_map &operator=(small_map &&other) {
         tt_return_on_self_assignment(other);
+        _keys = other._keys;
         _end = items.begin();
         for (ttlet &other_item: other) {
             auto &this_item = *(_end++);
@@ -84,13 +111,16 @@ public:
     decltype(auto) end() const { return _end; }
     decltype(auto) end() { return _end; }
 
-    
+    /** Find the item with the given key.
+     *
+     * @return An iterator to the item, or `end()` when the key is not in the map.
+     */
+    decltype(auto) find(K const &key) const noexcept { return begin() + find_index(key); }
+    decltype(auto) find(K const &key) noexcept { return begin() + find_index(key); }
 
     std::optional<V> get(K const &key) const noexcept {
-        for (auto i = begin(); i != end(); ++i) {
-            if (i->key == key) {
-                return i->value;
-            }
+        if (ttlet i = find(key); i != end()) {
+            return i->value;
         }
         return {};
     }
@@ -105,17 +135,16 @@ public:
 
     template<typename KK, typename VV>
     bool set(KK &&key, VV &&value) noexcept {
-        auto i = begin();
-        for (; i != end(); ++i) {
-            if (i->key == key) {
-                i->value = std::forward<VV>(value);
-                return true;
-            }
+        auto i = find(key);
+        if (i != end()) {
+            i->value = std::forward<VV>(value);
+            return true;
         }
         if (i != items.end()) {
             _end = i + 1;
             i->key = std::forward<KK>(key);
             i->value = std::forward<VV>(value);
+            set_key_array(i);
             return true;
         }
 
@@ -124,20 +153,82 @@ public:
 
     V increment(K const &key) noexcept {
         static_assert(std::is_arithmetic_v<V>, "Only increment on a artihmatic value");
-        auto i = begin();
-        for (; i != end(); ++i) {
-            if (i->key == key) {
-                return ++(i->value);
-            }
+        auto i = find(key);
+        if (i != end()) {
+            return ++(i->value);
         }
         if (i != items.end()) {
             _end = i + 1;
             i->key = key;
+            set_key_array(i);
             return i->value = V{1};
         }
 
         return 0;
     }
+
+private:
+    void set_key_array(typename array_type::iterator i) noexcept {
+        if constexpr (has_key_array) {
+            _keys[std::distance(items.begin(), i)] = i->key;
+        }
+    }
+
+    /** Find the index of the item with the given key.
+     *
+     * @return The index of the item, or `size()` when the key is not in the map.
+     */
+    [[nodiscard]] ptrdiff_t find_index(K const &key) const noexcept {
+        ttlet size_ = narrow_cast<ptrdiff_t>(size());
+
+#if TT_PROCESSOR == TT_CPU_X64
+        if constexpr (has_key_array) {
+            using uint_type = std::conditional_t<sizeof(K) == 1, uint8_t, std::conditional_t<sizeof(K) == 2, uint16_t, uint32_t>>;
+            ttlet key_ = std::bit_cast<uint_type>(key);
+
+            __m128i needle;
+            if constexpr (sizeof(K) == 1) {
+                needle = _mm_set1_epi8(static_cast<char>(key_));
+            } else if constexpr (sizeof(K) == 2) {
+                needle = _mm_set1_epi16(static_cast<short>(key_));
+            } else {
+                needle = _mm_set1_epi32(static_cast<int>(key_));
+            }
+
+            for (ptrdiff_t i = 0; i < size_; i += nr_keys_per_chunk) {
+                ttlet chunk = _mm_load_si128(reinterpret_cast<__m128i const *>(_keys.data() + i));
+
+                __m128i found;
+                if constexpr (sizeof(K) == 1) {
+                    found = _mm_cmpeq_epi8(chunk, needle);
+                } else if constexpr (sizeof(K) == 2) {
+                    found = _mm_cmpeq_epi16(chunk, needle);
+                } else {
+                    found = _mm_cmpeq_epi32(chunk, needle);
+                }
+
+                auto mask = static_cast<unsigned int>(_mm_movemask_epi8(found));
+
+                // Ignore the keys after the last item.
+                if (ttlet nr_keys = size_ - i; nr_keys < nr_keys_per_chunk) {
+                    mask &= (1U << (nr_keys * sizeof(K))) - 1;
+                }
+
+                if (mask != 0) {
+                    return i + std::countr_zero(mask) / narrow_cast<int>(sizeof(K));
+                }
+            }
+            return size_;
+        }
+#endif
+
+        for (ptrdiff_t i = 0; i != size_; ++i) {
+            if (items[i].key == key) {
+                return i;
+            }
+        }
+        return size_;
+    }
 };
 
 }
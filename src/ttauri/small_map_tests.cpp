@@ -44,3 +44,59 @@ TEST(SmallMap, Default) {
     ASSERT_EQ(items.get(40, 42), 400);
     ASSERT_EQ(items.get(50, 42), 42);
 }
+
+TEST(SmallMap, ManyKeys) {
+    // With one byte keys the search spans three chunks of the key array.
+    small_map<uint8_t,int,40> items;
+    for (int i = 0; i != 40; ++i) {
+        ASSERT_EQ(items.set(static_cast<uint8_t>(i * 3), i), true);
+    }
+    ASSERT_EQ(items.set(uint8_t{200}, 200), false);
+    ASSERT_EQ(items.size(), 40);
+
+    for (int i = 0; i != 40; ++i) {
+        ASSERT_EQ(items.get(static_cast<uint8_t>(i * 3)), std::optional<int>{i});
+        ASSERT_EQ(items.get(static_cast<uint8_t>(i * 3 + 1)), std::optional<int>{});
+    }
+
+    ttlet copy = items;
+    ASSERT_EQ(copy.get(uint8_t{117}), std::optional<int>{39});
+    ASSERT_EQ(copy.find(uint8_t{118}), copy.end());
+}
+
+TEST(SmallMap, UnusedKeys) {
+    // The keys after the last item are not part of the map, even when they are equal to the default key.
+    small_map<int,int,8> items;
+    ASSERT_EQ(items.get(0), std::optional<int>{});
+
+    ASSERT_EQ(items.set(1, 10), true);
+    ASSERT_EQ(items.get(0), std::optional<int>{});
+    ASSERT_EQ(items.set(0, 20), true);
+    ASSERT_EQ(items.get(0), std::optional<int>{20});
+    ASSERT_EQ(items.increment(0), 21);
+    ASSERT_EQ(items.increment(2), 1);
+    ASSERT_EQ(items.size(), 3);
+}
+
+TEST(SmallMap, EnumKeys) {
+    enum class tag : uint16_t { a, b, c, d = 0x1234 };
+
+    small_map<tag,int,4> items;
+    ASSERT_EQ(items.set(tag::d, 4), true);
+    ASSERT_EQ(items.set(tag::b, 2), true);
+    ASSERT_EQ(items.get(tag::d), std::optional<int>{4});
+    ASSERT_EQ(items.get(tag::b), std::optional<int>{2});
+    ASSERT_EQ(items.get(tag::a), std::optional<int>{});
+    ASSERT_EQ(items.get(tag::c, 42), 42);
+}
+
+TEST(SmallMap, StringKeys) {
+    small_map<std::string,int,4> items;
+    ASSERT_EQ(items.set("foo", 1), true);
+    ASSERT_EQ(items.set("bar", 2), true);
+    ASSERT_EQ(items.set("foo", 3), true);
+    ASSERT_EQ(items.size(), 2);
+    ASSERT_EQ(items.get("foo"), std::optional<int>{3});
+    ASSERT_EQ(items.get("bar"), std::optional<int>{2});
+    ASSERT_EQ(items.get("baz"), std::optional<int>{});
+}
@@ -0,0 +1,128 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "required.hpp"
+#include "assert.hpp"
+#include <array>
+#include <atomic>
+#include <bit>
+
+namespace tt {
+
+/** A single-producer, single-consumer ring buffer of messages.
+ *
+ * The producer and consumer each own one index, on its own cache line, and keep a
+ * cached copy of the other's index. The producer only touches the consumer's cache line
+ * when its cached copy says the queue is full, and the consumer only touches the producer's
+ * cache line when it wants to know how many messages are available.
+ *
+ * Messages are constructed in-place in the ring buffer; the consumer is responsible for
+ * resetting a message before it is released, so that the producer can reuse the slot.
+ *
+ * @tparam T The type of a message.
+ * @tparam Capacity The maximum number of messages in the queue, must be a power of two.
+ */
+template<typename T, size_t Capacity>
+class spsc_message_queue {
+public:
+    using value_type = T;
+    using index_type = size_t;
+
+    static constexpr index_type capacity = Capacity;
+    static_assert(std::has_single_bit(capacity), "The capacity of the message queue must be a power of two.");
+
+    spsc_message_queue() noexcept = default;
+    spsc_message_queue(spsc_message_queue const &) = delete;
+    spsc_message_queue(spsc_message_queue &&) = delete;
+    spsc_message_queue &operator=(spsc_message_queue const &) = delete;
+    spsc_message_queue &operator=(spsc_message_queue &&) = delete;
+    ~spsc_message_queue() = default;
+
+    /** Check if the queue is empty.
+     * May only be called by the consumer.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _head.load(std::memory_order::acquire) == _tail.load(std::memory_order::relaxed);
+    }
+
+    /** Start writing a message.
+     * May only be called by the producer. Every successful call must be followed
+     * by a call to `write_finish()`.
+     *
+     * @return A pointer to the message slot to construct into, or nullptr when the queue is full.
+     */
+    [[nodiscard]] value_type *try_write_start() noexcept
+    {
+        ttlet head = _head.load(std::memory_order::relaxed);
+        if (head - _tail_cache == capacity) {
+            _tail_cache = _tail.load(std::memory_order::acquire);
+            if (head - _tail_cache == capacity) {
+                [[unlikely]] return nullptr;
+            }
+        }
+        return &_messages[head % capacity];
+    }
+
+    /** Publish the message that was started with `try_write_start()`.
+     * May only be called by the producer.
+     */
+    void write_finish() noexcept
+    {
+        _head.store(_head.load(std::memory_order::relaxed) + 1, std::memory_order::release);
+    }
+
+    /** The index of the first message that is available to the consumer.
+     * May only be called by the consumer.
+     */
+    [[nodiscard]] index_type read_first() const noexcept
+    {
+        return _tail.load(std::memory_order::relaxed);
+    }
+
+    /** One past the index of the last message that is available to the consumer.
+     * May only be called by the consumer.
+     */
+    [[nodiscard]] index_type read_last() const noexcept
+    {
+        return _head.load(std::memory_order::acquire);
+    }
+
+    /** Get a message by index.
+     * May only be called by the consumer with an index between `read_first()` and `read_last()`.
+     */
+    [[nodiscard]] value_type &operator[](index_type index) noexcept
+    {
+        return _messages[index % capacity];
+    }
+
+    /** Release all messages before `last` back to the producer.
+     * May only be called by the consumer.
+     */
+    void read_finish(index_type last) noexcept
+    {
+        tt_axiom(last >= _tail.load(std::memory_order::relaxed));
+        _tail.store(last, std::memory_order::release);
+    }
+
+private:
+    std::array<value_type, capacity> _messages;
+
+    /** The index of the next message to write, owned by the producer.
+     * Head and tail are extremely large integers; they will never wrap around.
+     */
+    alignas(hardware_destructive_interference_size) std::atomic<index_type> _head = 0;
+
+    /** The producer's copy of the tail, only refreshed when the queue looks full.
+     */
+    index_type _tail_cache = 0;
+
+    /** The index of the next message to read, owned by the consumer.
+     */
+    alignas(hardware_destructive_interference_size) std::atomic<index_type> _tail = 0;
+};
+
+} // namespace tt
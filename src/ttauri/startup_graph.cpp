@@ -0,0 +1,168 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "startup_graph.hpp"
+#include "startup_profiler.hpp"
+#include "thread_pool.hpp"
+#include "exception.hpp"
+#include "cast.hpp"
+#include "assert.hpp"
+#include <algorithm>
+#include <exception>
+
+namespace tt {
+
+startup_graph::~startup_graph()
+{
+    if (not _started) {
+        return;
+    }
+
+    // The loads may refer to objects that are destroyed together with the graph.
+    for (ttlet &node : *_nodes) {
+        node->future.wait();
+    }
+}
+
+void startup_graph::add(std::string name, std::vector<std::string> dependencies, std::function<void()> load) noexcept
+{
+    tt_axiom(not _started);
+    tt_axiom(not contains(name));
+
+    auto node = std::make_unique<node_type>();
+    node->name = std::move(name);
+    node->dependency_names = std::move(dependencies);
+    node->load = std::move(load);
+    node->future = node->promise.get_future().share();
+    _nodes->push_back(std::move(node));
+}
+
+[[nodiscard]] bool startup_graph::contains(std::string_view name) const noexcept
+{
+    return std::ranges::any_of(*_nodes, [name](ttlet &node) {
+        return node->name == name;
+    });
+}
+
+[[nodiscard]] startup_graph::node_type const &startup_graph::find(std::string_view name) const
+{
+    ttlet it = std::ranges::find_if(*_nodes, [name](ttlet &node) {
+        return node->name == name;
+    });
+    if (it == _nodes->end()) {
+        throw operation_error("Startup resource '{}' does not exist", name);
+    }
+    return **it;
+}
+
+void startup_graph::start(bool parallel)
+{
+    tt_axiom(not _started);
+
+    auto &nodes = *_nodes;
+    for (size_t i = 0; i != nodes.size(); ++i) {
+        auto &node = *nodes[i];
+        for (ttlet &dependency_name : node.dependency_names) {
+            ttlet it = std::ranges::find_if(nodes, [&dependency_name](ttlet &item) {
+                return item->name == dependency_name;
+            });
+            if (it == nodes.end()) {
+                throw operation_error("Startup resource '{}' depends on '{}', which does not exist", node.name, dependency_name);
+            }
+
+            ttlet j = narrow_cast<size_t>(std::distance(nodes.begin(), it));
+            node.dependencies.push_back(j);
+            nodes[j]->dependents.push_back(i);
+        }
+        node.nr_waiting.store(node.dependencies.size(), std::memory_order::relaxed);
+    }
+
+    // Order the loads by their dependencies, so that a cycle is found before anything is run.
+    auto order = std::vector<size_t>{};
+    order.reserve(nodes.size());
+    auto nr_waiting = std::vector<size_t>{};
+    nr_waiting.reserve(nodes.size());
+    for (size_t i = 0; i != nodes.size(); ++i) {
+        nr_waiting.push_back(nodes[i]->dependencies.size());
+        if (nr_waiting.back() == 0) {
+            order.push_back(i);
+        }
+    }
+    for (size_t i = 0; i != order.size(); ++i) {
+        for (ttlet dependent : nodes[order[i]]->dependents) {
+            if (--nr_waiting[dependent] == 0) {
+                order.push_back(dependent);
+            }
+        }
+    }
+    if (order.size() != nodes.size()) {
+        throw operation_error("The dependencies of the startup resources form a cycle");
+    }
+
+    _started = true;
+    if (parallel) {
+        for (ttlet i : order) {
+            if (nodes[i]->dependencies.empty()) {
+                thread_pool_post(
+                    [nodes = _nodes, i] {
+                        run(nodes, i, true);
+                    },
+                    thread_pool_priority::interactive);
+            }
+        }
+    } else {
+        for (ttlet i : order) {
+            run(_nodes, i, false);
+        }
+    }
+}
+
+void startup_graph::wait(std::string_view name) const
+{
+    tt_axiom(_started);
+    find(name).future.get();
+}
+
+void startup_graph::wait_all() const
+{
+    tt_axiom(_started);
+    for (ttlet &node : *_nodes) {
+        node->future.wait();
+    }
+    for (ttlet &node : *_nodes) {
+        node->future.get();
+    }
+}
+
+void startup_graph::run(std::shared_ptr<nodes_type> const &nodes, size_t index, bool parallel) noexcept
+{
+    auto &node = *(*nodes)[index];
+
+    try {
+        // Rethrow the exception of a dependency that failed.
+        for (ttlet dependency : node.dependencies) {
+            (*nodes)[dependency]->future.get();
+        }
+
+        auto phase = startup_phase{node.name};
+        node.load();
+        node.promise.set_value();
+    } catch (...) {
+        node.promise.set_exception(std::current_exception());
+    }
+
+    if (parallel) {
+        for (ttlet dependent : node.dependents) {
+            if ((*nodes)[dependent]->nr_waiting.fetch_sub(1, std::memory_order::acq_rel) == 1) {
+                thread_pool_post(
+                    [nodes, dependent] {
+                        run(nodes, dependent, true);
+                    },
+                    thread_pool_priority::interactive);
+            }
+        }
+    }
+}
+
+} // namespace tt
@@ -0,0 +1,110 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "required.hpp"
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tt {
+
+/** The resources that are loaded at the startup of the application, with their dependencies.
+ *
+ * Each load is added with the names of the loads it depends on. When started in parallel,
+ * a load is posted on the thread pool as soon as its dependencies have finished, so that
+ * independent loads run at the same time; otherwise the loads are run in order of their
+ * dependencies on the thread that starts the graph.
+ *
+ * A subsystem waits only for the loads it needs. An exception thrown by a load is rethrown
+ * by `wait()` for that load and for every load that depends on it.
+ *
+ * ```
+ * auto graph = startup_graph{};
+ * graph.add("font_book", {}, [] { font_book::global = std::make_unique<font_book>(...); });
+ * graph.add("theme_book", {"font_book"}, [] { theme_book::global = std::make_unique<theme_book>(...); });
+ * graph.start(true);
+ * // ...
+ * graph.wait("theme_book");
+ * ```
+ */
+class startup_graph {
+public:
+    startup_graph() noexcept = default;
+    ~startup_graph();
+
+    startup_graph(startup_graph const &) = delete;
+    startup_graph(startup_graph &&) = delete;
+    startup_graph &operator=(startup_graph const &) = delete;
+    startup_graph &operator=(startup_graph &&) = delete;
+
+    /** Add a load to the graph.
+     * May only be called before `start()`.
+     *
+     * @param name The name of the load, also used as the name of its startup phase.
+     * @param dependencies The names of the loads that must finish before this load is run.
+     * @param load The function that loads the resource.
+     */
+    void add(std::string name, std::vector<std::string> dependencies, std::function<void()> load) noexcept;
+
+    /** Check if a load with the given name was added.
+     */
+    [[nodiscard]] bool contains(std::string_view name) const noexcept;
+
+    /** Start the loads.
+     *
+     * @param parallel True to run the loads on the thread pool, false to run them on this thread
+     *                 before returning.
+     * @throws operation_error When a dependency does not exist, or when the dependencies form a cycle.
+     */
+    void start(bool parallel);
+
+    /** Wait for a load to finish.
+     *
+     * @param name The name of the load.
+     * @throws operation_error When there is no load with this name.
+     * @throws The exception thrown by the load or by one of its dependencies.
+     */
+    void wait(std::string_view name) const;
+
+    /** Wait for all loads to finish.
+     * @throws The exception thrown by the first load, in order of `add()`, that failed.
+     */
+    void wait_all() const;
+
+private:
+    struct node_type {
+        std::string name;
+        std::vector<std::string> dependency_names;
+        std::function<void()> load;
+
+        std::vector<size_t> dependencies;
+        std::vector<size_t> dependents;
+
+        /** The number of dependencies that have not finished yet.
+         */
+        std::atomic<size_t> nr_waiting = 0;
+
+        std::promise<void> promise;
+        std::shared_future<void> future;
+    };
+
+    using nodes_type = std::vector<std::unique_ptr<node_type>>;
+
+    /** The nodes are shared with the loads on the thread pool, which may still be scheduling their
+     * dependents after the graph has seen the last load finish.
+     */
+    std::shared_ptr<nodes_type> _nodes = std::make_shared<nodes_type>();
+    bool _started = false;
+
+    [[nodiscard]] node_type const &find(std::string_view name) const;
+    static void run(std::shared_ptr<nodes_type> const &nodes, size_t index, bool parallel) noexcept;
+};
+
+} // namespace tt
@@ -0,0 +1,105 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/startup_graph.hpp"
+#include "ttauri/subsystem.hpp"
+#include "ttauri/exception.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+
+using namespace std;
+using namespace tt;
+
+static void add_diamond(startup_graph &graph, std::atomic<int> &a, std::atomic<int> &b, std::atomic<int> &c, std::atomic<int> &d)
+{
+    // Each load records the sum of its dependencies plus one.
+    graph.add("d", {"b", "c"}, [&] {
+        d = b + c + 1;
+    });
+    graph.add("b", {"a"}, [&] {
+        b = a + 1;
+    });
+    graph.add("c", {"a"}, [&] {
+        c = a + 1;
+    });
+    graph.add("a", {}, [&] {
+        a = 1;
+    });
+}
+
+TEST(StartupGraph, Sequential)
+{
+    auto a = std::atomic<int>{0};
+    auto b = std::atomic<int>{0};
+    auto c = std::atomic<int>{0};
+    auto d = std::atomic<int>{0};
+
+    auto graph = startup_graph{};
+    add_diamond(graph, a, b, c, d);
+    graph.start(false);
+
+    // All loads have finished when start() returns.
+    ASSERT_EQ(d, 5);
+    graph.wait_all();
+}
+
+TEST(StartupGraph, Parallel)
+{
+    start_system();
+
+    for (int i = 0; i != 100; ++i) {
+        auto a = std::atomic<int>{0};
+        auto b = std::atomic<int>{0};
+        auto c = std::atomic<int>{0};
+        auto d = std::atomic<int>{0};
+
+        auto graph = startup_graph{};
+        add_diamond(graph, a, b, c, d);
+        graph.start(true);
+
+        graph.wait("b");
+        ASSERT_EQ(b, 2);
+        graph.wait("d");
+        ASSERT_EQ(d, 5);
+    }
+}
+
+TEST(StartupGraph, Exception)
+{
+    auto count = std::atomic<int>{0};
+
+    auto graph = startup_graph{};
+    graph.add("a", {}, [] {
+        throw std::runtime_error("a");
+    });
+    graph.add("b", {"a"}, [&] {
+        ++count;
+    });
+    graph.add("c", {}, [&] {
+        ++count;
+    });
+    graph.start(true);
+
+    ASSERT_THROW(graph.wait("a"), std::runtime_error);
+    ASSERT_THROW(graph.wait("b"), std::runtime_error);
+    ASSERT_NO_THROW(graph.wait("c"));
+    ASSERT_THROW(graph.wait_all(), std::runtime_error);
+    ASSERT_THROW(graph.wait("x"), operation_error);
+    ASSERT_EQ(count, 1);
+}
+
+TEST(StartupGraph, InvalidDependencies)
+{
+    auto missing = startup_graph{};
+    missing.add("a", {"x"}, [] {});
+    ASSERT_THROW(missing.start(true), operation_error);
+
+    auto cycle = startup_graph{};
+    cycle.add("a", {"c"}, [] {});
+    cycle.add("b", {"a"}, [] {});
+    cycle.add("c", {"b"}, [] {});
+    cycle.add("d", {}, [] {});
+    ASSERT_THROW(cycle.start(true), operation_error);
+}
@@ -0,0 +1,118 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "startup_profiler.hpp"
+#include "hires_utc_clock.hpp"
+#include "unfair_mutex.hpp"
+#include "logger.hpp"
+#include "file.hpp"
+#include "URL.hpp"
+#include <fmt/format.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <utility>
+
+namespace tt {
+
+static unfair_mutex startup_phases_mutex;
+static std::vector<startup_phase_record> startup_phases_;
+static std::atomic<bool> startup_is_finished = false;
+
+startup_phase::startup_phase(std::string name) noexcept : _name(std::move(name)), _begin(time_stamp_count::now()) {}
+
+startup_phase::~startup_phase()
+{
+    stop();
+}
+
+void startup_phase::stop() noexcept
+{
+    if (std::exchange(_stopped, true)) {
+        return;
+    }
+
+    ttlet end = time_stamp_count::now();
+    if (startup_is_finished.load(std::memory_order::relaxed)) {
+        return;
+    }
+
+    ttlet lock = std::scoped_lock(startup_phases_mutex);
+    startup_phases_.push_back({std::move(_name), current_thread_id(), _begin, end});
+}
+
+[[nodiscard]] std::vector<startup_phase_record> startup_phases() noexcept
+{
+    auto r = [] {
+        ttlet lock = std::scoped_lock(startup_phases_mutex);
+        return startup_phases_;
+    }();
+
+    std::ranges::sort(r, [](ttlet &lhs, ttlet &rhs) {
+        return lhs.begin.count() < rhs.begin.count();
+    });
+    return r;
+}
+
+[[nodiscard]] std::string startup_phases_to_json() noexcept
+{
+    auto r = std::string{"{\"displayTimeUnit\":\"ns\",\"traceEvents\":["};
+
+    auto first_event = true;
+    for (ttlet &phase : startup_phases()) {
+        ttlet begin = hires_utc_clock::make(phase.begin).time_since_epoch();
+        ttlet duration = phase.end.time_since_epoch() - phase.begin.time_since_epoch();
+
+        if (not std::exchange(first_event, false)) {
+            r += ',';
+        }
+        r += fmt::format(
+            "\n{{\"name\":\"{}\",\"cat\":\"startup\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+            phase.name,
+            phase.thread,
+            static_cast<double>(begin.count()) / 1000.0,
+            static_cast<double>(duration.count()) / 1000.0);
+    }
+
+    r += "\n]}\n";
+    return r;
+}
+
+void startup_phases_dump(URL const &location)
+{
+    ttlet json = startup_phases_to_json();
+
+    auto file = tt::file(location, access_mode::truncate_or_create_for_write);
+    file.write(std::string_view{json});
+    file.close();
+}
+
+void startup_finish() noexcept
+{
+    if (startup_is_finished.exchange(true, std::memory_order::relaxed)) {
+        return;
+    }
+
+    ttlet phases = startup_phases();
+    if (phases.empty()) {
+        return;
+    }
+
+    ttlet first = phases.front().begin;
+    ttlet last = std::ranges::max(phases, {}, [](ttlet &phase) {
+                     return phase.end.count();
+                 }).end;
+
+    tt_log_info("Startup took {}:", format_engineering(last.time_since_epoch() - first.time_since_epoch()));
+    for (ttlet &phase : phases) {
+        tt_log_info(
+            "    +{} {} {} on thread {}",
+            format_engineering(phase.begin.time_since_epoch() - first.time_since_epoch()),
+            format_engineering(phase.end.time_since_epoch() - phase.begin.time_since_epoch()),
+            phase.name,
+            phase.thread);
+    }
+}
+
+} // namespace tt
@@ -0,0 +1,77 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "required.hpp"
+#include "time_stamp_count.hpp"
+#include "thread.hpp"
+#include <string>
+#include <vector>
+
+namespace tt {
+class URL;
+
+/** A phase of the startup of the application, as recorded by `startup_phase`.
+ */
+struct startup_phase_record {
+    std::string name;
+    thread_id thread;
+    time_stamp_count begin;
+    time_stamp_count end;
+};
+
+/** Measure a phase of the startup of the application.
+ *
+ * The phase begins on construction and ends on destruction or on `stop()`. Phases may
+ * overlap and may run on different threads. Phases that end after `startup_finish()` are
+ * not recorded, so that a subsystem that is started lazily later does not add to the report.
+ *
+ * ```
+ * {
+ *     auto phase = startup_phase{"font_book"};
+ *     font_book::global = std::make_unique<font_book>(...);
+ * }
+ * ```
+ */
+class startup_phase {
+public:
+    explicit startup_phase(std::string name) noexcept;
+    ~startup_phase();
+
+    startup_phase(startup_phase const &) = delete;
+    startup_phase(startup_phase &&) = delete;
+    startup_phase &operator=(startup_phase const &) = delete;
+    startup_phase &operator=(startup_phase &&) = delete;
+
+    /** End the phase before the end of the scope.
+     */
+    void stop() noexcept;
+
+private:
+    std::string _name;
+    time_stamp_count _begin;
+    bool _stopped = false;
+};
+
+/** Get the phases recorded so far, ordered by the time they began.
+ */
+[[nodiscard]] std::vector<startup_phase_record> startup_phases() noexcept;
+
+/** Get the recorded phases in the Chrome Trace Event JSON format.
+ * The result can be opened in chrome://tracing or https://ui.perfetto.dev.
+ */
+[[nodiscard]] std::string startup_phases_to_json() noexcept;
+
+/** Write the recorded phases to a file in the Chrome Trace Event JSON format.
+ * @throws io_error When the file could not be written.
+ */
+void startup_phases_dump(URL const &location);
+
+/** Finish the startup of the application.
+ * Stops recording phases and logs a report with the duration of each phase.
+ */
+void startup_finish() noexcept;
+
+} // namespace tt
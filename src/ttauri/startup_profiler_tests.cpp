@@ -0,0 +1,45 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/startup_profiler.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <thread>
+#include <string>
+
+using namespace std;
+using namespace tt;
+
+TEST(StartupProfiler, Phases)
+{
+    {
+        auto outer = startup_phase{"test:outer"};
+        auto inner = startup_phase{"test:inner"};
+        inner.stop();
+
+        auto thread = std::thread([] {
+            auto phase = startup_phase{"test:thread"};
+        });
+        thread.join();
+    }
+
+    ttlet phases = startup_phases();
+    ttlet outer = std::ranges::find(phases, "test:outer", &startup_phase_record::name);
+    ttlet inner = std::ranges::find(phases, "test:inner", &startup_phase_record::name);
+    ttlet thread = std::ranges::find(phases, "test:thread", &startup_phase_record::name);
+    ASSERT_NE(outer, phases.end());
+    ASSERT_NE(inner, phases.end());
+    ASSERT_NE(thread, phases.end());
+
+    // Phases are ordered by the time they began.
+    ASSERT_LT(outer, inner);
+    ASSERT_LE(outer->begin.count(), inner->begin.count());
+    ASSERT_LE(inner->end.count(), outer->end.count());
+    ASSERT_EQ(outer->thread, inner->thread);
+    ASSERT_NE(outer->thread, thread->thread);
+
+    ttlet json = startup_phases_to_json();
+    ASSERT_NE(json.find("\"name\":\"test:outer\",\"cat\":\"startup\",\"ph\":\"X\""), std::string::npos);
+    ASSERT_NE(json.find("\"name\":\"test:thread\""), std::string::npos);
+}
@@ -0,0 +1,86 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "static_resource_list.hpp"
+#include "codec/zlib.hpp"
+#include "byte_string.hpp"
+#include "check.hpp"
+#include "cast.hpp"
+#include <unordered_map>
+#include <vector>
+#include <mutex>
+#include <ranges>
+
+namespace tt {
+
+namespace detail {
+
+struct static_resource_entry {
+    static_resource_item const *item;
+
+    /** The decompressed bytes of a compressed resource.
+     */
+    bstring bytes;
+    bool decompressed = false;
+};
+
+struct static_resource_index {
+    std::mutex mutex;
+    std::unordered_map<std::string_view, static_resource_entry> entries;
+
+    /** The start of the list when the index was last updated.
+     */
+    static_resource_item const *head = nullptr;
+
+    /** Add the items that were added to the list since the last update.
+     */
+    void update() noexcept
+    {
+        ttlet new_head = static_resource_list.load();
+        if (new_head == head) {
+            return;
+        }
+
+        // Items are added to the front of the list. Insert the new items oldest first, so that
+        // the last added item with a filename is the one found, as is done when searching the list.
+        auto new_items = std::vector<static_resource_item const *>{};
+        for (auto ptr = new_head; ptr != head; ptr = ptr->next) {
+            new_items.push_back(ptr);
+        }
+        for (ttlet ptr : std::views::reverse(new_items)) {
+            entries.insert_or_assign(std::string_view{ptr->filename}, static_resource_entry{ptr});
+        }
+        head = new_head;
+    }
+};
+
+} // namespace detail
+
+std::span<std::byte const> static_resource_item::find(std::string_view filename)
+{
+    static auto index = detail::static_resource_index{};
+
+    ttlet lock = std::scoped_lock(index.mutex);
+    index.update();
+
+    ttlet it = index.entries.find(filename);
+    if (it == index.entries.end()) {
+        return {};
+    }
+
+    auto &entry = it->second;
+    if (entry.item->uncompressed_size == 0) {
+        return entry.item->bytes;
+    }
+
+    if (not entry.decompressed) {
+        entry.bytes = zlib_decompress(entry.item->bytes, narrow_cast<ssize_t>(entry.item->uncompressed_size));
+        tt_parse_check(
+            entry.bytes.size() == entry.item->uncompressed_size, "Static resource '{}' has the wrong size after decompression", filename);
+        entry.decompressed = true;
+    }
+    return entry.bytes;
+}
+
+} // namespace tt
@@ -9,6 +9,7 @@
 #include <cstddef>
 #include <atomic>
 #include <optional>
+#include <string_view>
 
 namespace tt {
 struct static_resource_item;
@@ -22,21 +23,25 @@ inline std::atomic<static_resource_item const *> static_resource_list = nullptr;
 struct static_resource_item {
     static_resource_item const *next;
     char const *filename;
+
+    /** The bytes of the resource, or the zlib compressed bytes when `uncompressed_size` is not zero.
+     */
     std::span<std::byte const> bytes;
 
+    /** The size of the resource after decompression, or zero when the resource is not compressed.
+     */
+    size_t uncompressed_size = 0;
+
     /** Search for a static resource item.
+     * The first search builds a hash table of the items in the list, which is rebuilt
+     * when items are added afterwards. A compressed resource is decompressed on first access
+     * and kept for the lifetime of the application.
+     *
      * @param filename The filename of the resource to search for.
      * @return A byte-span, or an empty byte-span when not found.
+     * @throw parse_error When a compressed resource can not be decompressed.
      */
-    [[nodiscard]] static std::span<std::byte const> find(std::string_view filename) noexcept
-    {
-        for (auto ptr = static_resource_list.load(); ptr != nullptr; ptr = ptr->next) {
-            if (filename == ptr->filename) {
-                return ptr->bytes;
-            }
-        }
-        return {};
-    }
+    [[nodiscard]] static std::span<std::byte const> find(std::string_view filename);
 
     /** Add a resource item to the list.
      * This function should be used to initialize a static global variable which
@@ -44,7 +49,7 @@ struct static_resource_item {
      * 
      * Example:
      * ```
-     * static static_resource_item tmp1 = {nullptr, "foo", foo_bytes};
+     * static static_resource_item tmp1 = {nullptr, "foo", foo_bytes, 0};
      * static static_resource_item const *tmp2 = static_resource_item::add(&tmp1);
      * ```
      * @param new_item A pointer to the new item to be added to the list.
@@ -57,6 +62,4 @@ struct static_resource_item {
     }
 };
 
-
-
 }
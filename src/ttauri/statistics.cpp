@@ -3,70 +3,191 @@
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #include "statistics.hpp"
+#include "statistics_exporter.hpp"
 #include "logger.hpp"
 #include "counters.hpp"
 #include "trace.hpp"
+#include "allocation_tracker.hpp"
+#include "startup_profiler.hpp"
+#include "subsystem.hpp"
+#include "thread.hpp"
+#include <mutex>
+#include <algorithm>
 
 namespace tt {
 
 std::jthread statistics_thread;
 
-static void statistics_flush_counters() noexcept
+static std::atomic<std::chrono::nanoseconds> statistics_interval = std::chrono::nanoseconds{std::chrono::minutes{1}};
+
+static std::mutex statistics_exporters_mutex;
+static std::vector<std::shared_ptr<statistics_exporter>> statistics_exporters;
+
+void statistics_register_exporter(std::shared_ptr<statistics_exporter> exporter) noexcept
 {
-    ttlet keys = counter_map.keys();
-    tt_log_statistics("{:>18} {:>9} {:>10} {:>10}", "total", "delta", "mean", "peak");
-    for (ttlet &tag : keys) {
-        ttlet[count, count_since_last_read] = read_counter(tag);
-        tt_log_statistics("{:>18} {:>+9} {:10} {:10} {}", count, count_since_last_read, "", "", tag);
-    }
+    tt_axiom(exporter);
+    ttlet lock = std::scoped_lock(statistics_exporters_mutex);
+    statistics_exporters.push_back(std::move(exporter));
 }
 
-static void statistics_flush_traces() noexcept
+void statistics_unregister_exporter(statistics_exporter const *exporter) noexcept
 {
-    ttlet keys = trace_statistics_map.keys();
-    for (ttlet &tag : keys) {
+    ttlet lock = std::scoped_lock(statistics_exporters_mutex);
+    std::erase_if(statistics_exporters, [exporter](ttlet &item) {
+        return item.get() == exporter;
+    });
+}
+
+void statistics_set_interval(std::chrono::nanoseconds interval) noexcept
+{
+    tt_axiom(interval > std::chrono::nanoseconds{0});
+    statistics_interval.store(interval, std::memory_order::relaxed);
+}
+
+/** The counters at the previous flush, used to log the change since then.
+ */
+static counter_snapshot statistics_previous_counters;
+
+[[nodiscard]] static statistics_report statistics_gather() noexcept
+{
+    auto r = statistics_report{};
+    r.counters = counter_snapshot::take();
+    r.previous_counters = std::exchange(statistics_previous_counters, r.counters);
+
+    for (ttlet &tag : trace_statistics_map.keys()) {
         auto *stat = trace_statistics_map.get(tag, nullptr);
         tt_assert(stat != nullptr);
         ttlet stat_result = stat->read();
 
-        if (stat_result.last_count <= 0) {
-            tt_log_statistics("{:18d} {:+9d} {:10} {:10} {}", stat_result.count, stat_result.last_count, "", "", tag);
+        r.traces.push_back(
+            {tag,
+             stat_result.count,
+             stat_result.last_count,
+             stat_result.duration,
+             stat_result.last_duration,
+             stat_result.peak_duration,
+             stat_result.p50,
+             stat_result.p90,
+             stat_result.p99,
+             stat_result.p999});
+    }
+
+    if constexpr (allocation_tracking_is_enabled) {
+        r.allocations = thread_allocations();
+    }
+    return r;
+}
+
+static void statistics_log_counters(statistics_report const &report) noexcept
+{
+    tt_log_statistics(
+        "{:>18} {:>9} {:>10} {:>10} {:>10} {:>10} {:>10} {:>10}", "total", "delta", "mean", "peak", "p50", "p90", "p99", "p999");
+    for (ttlet &[tag, count] : report.counters) {
+        ttlet count_since_last_read = report.counters.delta(report.previous_counters, tag);
+        tt_log_statistics(
+            "{:>18} {:>+9} {:10} {:10} {:10} {:10} {:10} {:10} {}", count, count_since_last_read, "", "", "", "", "", "", tag);
+    }
+}
+
+static void statistics_log_traces(statistics_report const &report) noexcept
+{
+    for (ttlet &trace : report.traces) {
+        if (trace.last_count <= 0) {
+            tt_log_statistics(
+                "{:18d} {:+9d} {:10} {:10} {:10} {:10} {:10} {:10} {}",
+                trace.count,
+                trace.last_count,
+                "",
+                "",
+                "",
+                "",
+                "",
+                "",
+                trace.tag);
 
         } else {
             // XXX not perfect at all.
-            ttlet duration_per_iter = format_engineering(stat_result.last_duration / stat_result.last_count);
-            ttlet duration_peak = format_engineering(stat_result.peak_duration);
+            ttlet duration_per_iter = format_engineering(trace.last_duration / trace.last_count);
+            ttlet duration_peak = format_engineering(trace.peak_duration);
             tt_log_statistics(
-                "{:18d} {:+9d} {:>10} {:>10} {}",
-                stat_result.count,
-                stat_result.last_count,
+                "{:18d} {:+9d} {:>10} {:>10} {:>10} {:>10} {:>10} {:>10} {}",
+                trace.count,
+                trace.last_count,
                 duration_per_iter,
                 duration_peak,
-                tag);
+                format_engineering(trace.p50),
+                format_engineering(trace.p90),
+                format_engineering(trace.p99),
+                format_engineering(trace.p999),
+                trace.tag);
         }
     }
 }
 
+static void statistics_log_allocations(statistics_report const &report) noexcept
+{
+    // Logged like the per-tag allocation counters, i.e. "<tag>:allocations".
+    for (ttlet &thread : report.allocations) {
+        tt_log_statistics(
+            "{:18d} {:9} {:10} {:10} {:10} {:10} {:10} {:10} thread-{}:allocations",
+            thread.allocations.count,
+            "",
+            "",
+            "",
+            "",
+            "",
+            "",
+            "",
+            thread.thread);
+        tt_log_statistics(
+            "{:18d} {:9} {:10} {:10} {:10} {:10} {:10} {:10} thread-{}:allocated_bytes",
+            thread.allocations.bytes,
+            "",
+            "",
+            "",
+            "",
+            "",
+            "",
+            "",
+            thread.thread);
+    }
+}
+
 static void statistics_flush() noexcept
 {
-    statistics_flush_counters();
-    statistics_flush_traces();
+    ttlet report = statistics_gather();
+    statistics_log_counters(report);
+    statistics_log_traces(report);
+    statistics_log_allocations(report);
+
+    ttlet lock = std::scoped_lock(statistics_exporters_mutex);
+    for (ttlet &exporter : statistics_exporters) {
+        exporter->export_statistics(report);
+    }
+}
+
+/** The next time to gather statistics, at a multiple of the interval since the epoch.
+ */
+[[nodiscard]] static hires_utc_clock::time_point statistics_next_time(hires_utc_clock::time_point current_time) noexcept
+{
+    ttlet interval = statistics_interval.load(std::memory_order::relaxed);
+    return current_time - (current_time.time_since_epoch() % interval) + interval;
 }
 
 static void statistics_loop(std::stop_token stop_token) noexcept
 {
     set_thread_name("statistics");
 
-    auto next_time = std::chrono::ceil<std::chrono::minutes>(hires_utc_clock::now());
+    auto next_time = statistics_next_time(hires_utc_clock::now());
 
     while (!stop_token.stop_requested()) {
         auto current_time = hires_utc_clock::now();
         if (current_time >= next_time) {
             statistics_flush();
-            next_time = std::chrono::ceil<std::chrono::minutes>(current_time + 1s);
+            next_time = statistics_next_time(current_time);
         }
 
-        std::this_thread::sleep_for(100ms);
+        sleep_for(stop_token, 100ms);
     }
 }
 
@@ -81,8 +202,14 @@ void statistics_deinit() noexcept
 
 bool statistics_init() noexcept
 {
+    ttlet phase = startup_phase{"statistics_start"};
     statistics_thread = std::jthread(statistics_loop);
     return true;
 }
 
+bool statistics_start()
+{
+    return start_subsystem(statistics_running, false, statistics_init, statistics_deinit);
+}
+
 }
@@ -4,7 +4,6 @@
 
 #pragma once
 
-#include "subsystem.hpp"
 #include <atomic>
 
 namespace tt {
@@ -15,9 +14,10 @@ bool statistics_init() noexcept;
 
 inline std::atomic<bool> statistics_running = false;
 
-inline bool statistics_start()
-{
-    return start_subsystem(statistics_running, false, statistics_init, statistics_deinit);
-}
+/** Start the statistics subsystem.
+ * This function is not inline, so that low level headers such as counters.hpp
+ * do not depend on subsystem.hpp and its mutex.
+ */
+bool statistics_start();
 
 } // namespace tt
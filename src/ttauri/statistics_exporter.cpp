@@ -0,0 +1,94 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "statistics_exporter.hpp"
+#include "file.hpp"
+#include "logger.hpp"
+#include <fmt/format.h>
+#include <utility>
+
+namespace tt {
+
+/** Escape a label value of the Prometheus text format.
+ */
+[[nodiscard]] static std::string prometheus_escape(std::string_view str) noexcept
+{
+    auto r = std::string{};
+    r.reserve(str.size());
+    for (ttlet c : str) {
+        switch (c) {
+        case '\\': r += "\\\\"; break;
+        case '"': r += "\\\""; break;
+        case '\n': r += "\\n"; break;
+        default: r += c;
+        }
+    }
+    return r;
+}
+
+[[nodiscard]] static double to_seconds(std::chrono::nanoseconds duration) noexcept
+{
+    return std::chrono::duration<double>(duration).count();
+}
+
+[[nodiscard]] std::string format_prometheus(statistics_report const &report) noexcept
+{
+    auto r = std::string{};
+
+    r += "# TYPE ttauri_counter gauge\n";
+    for (ttlet &[tag, count] : report.counters) {
+        r += fmt::format("ttauri_counter{{tag=\"{}\"}} {}\n", prometheus_escape(tag), count);
+    }
+
+    r += "# TYPE ttauri_trace_duration_seconds summary\n";
+    for (ttlet &trace : report.traces) {
+        ttlet tag = prometheus_escape(trace.tag);
+        for (ttlet [quantile, duration] : {
+                 std::pair{"0.5", trace.p50}, std::pair{"0.9", trace.p90}, std::pair{"0.99", trace.p99}, std::pair{"0.999", trace.p999}}) {
+            r += fmt::format(
+                "ttauri_trace_duration_seconds{{tag=\"{}\",quantile=\"{}\"}} {}\n", tag, quantile, to_seconds(duration));
+        }
+        r += fmt::format("ttauri_trace_duration_seconds_count{{tag=\"{}\"}} {}\n", tag, trace.count);
+        r += fmt::format("ttauri_trace_duration_seconds_sum{{tag=\"{}\"}} {}\n", tag, to_seconds(trace.duration));
+    }
+
+    r += "# TYPE ttauri_trace_peak_duration_seconds gauge\n";
+    for (ttlet &trace : report.traces) {
+        r += fmt::format(
+            "ttauri_trace_peak_duration_seconds{{tag=\"{}\"}} {}\n", prometheus_escape(trace.tag), to_seconds(trace.peak_duration));
+    }
+
+    if (not report.allocations.empty()) {
+        r += "# TYPE ttauri_allocations counter\n";
+        for (ttlet &thread : report.allocations) {
+            r += fmt::format("ttauri_allocations{{thread=\"{}\"}} {}\n", thread.thread, thread.allocations.count);
+        }
+
+        r += "# TYPE ttauri_allocated_bytes counter\n";
+        for (ttlet &thread : report.allocations) {
+            r += fmt::format("ttauri_allocated_bytes{{thread=\"{}\"}} {}\n", thread.thread, thread.allocations.bytes);
+        }
+    }
+
+    return r;
+}
+
+void prometheus_statistics_exporter::export_statistics(statistics_report const &report) noexcept
+{
+    ttlet text = format_prometheus(report);
+
+    try {
+        ttlet tmp_location = _location.urlByAppendingExtension("tmp");
+        auto file = tt::file(tmp_location, access_mode::truncate_or_create_for_write | access_mode::rename);
+        file.write(std::string_view{text});
+        file.flush();
+        file.rename(_location, true);
+        file.close();
+
+    } catch (std::exception const &e) {
+        tt_log_error("Could not export statistics to {}: {}", _location, e.what());
+    }
+}
+
+} // namespace tt
@@ -0,0 +1,98 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "counters.hpp"
+#include "allocation_tracker.hpp"
+#include "URL.hpp"
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tt {
+
+/** The statistics of a trace tag since the start of the application and since the previous report.
+ */
+struct trace_statistics_report {
+    std::string tag;
+    long long count;
+    long long last_count;
+    std::chrono::nanoseconds duration;
+    std::chrono::nanoseconds last_duration;
+    std::chrono::nanoseconds peak_duration;
+
+    /** Percentiles of the durations since the previous report.
+     */
+    std::chrono::nanoseconds p50;
+    std::chrono::nanoseconds p90;
+    std::chrono::nanoseconds p99;
+    std::chrono::nanoseconds p999;
+};
+
+/** All statistics gathered at one interval of the statistics thread.
+ */
+struct statistics_report {
+    counter_snapshot counters;
+
+    /** The counters at the previous report, to calculate the change or rate of a counter.
+     */
+    counter_snapshot previous_counters;
+
+    std::vector<trace_statistics_report> traces;
+
+    /** The allocations made by each thread since it started.
+     * Empty unless the library is build with allocation tracking.
+     */
+    std::vector<thread_allocation_count> allocations;
+};
+
+/** Receives the statistics at each interval of the statistics thread.
+ * Exporters are called from the statistics thread, one after another.
+ */
+class statistics_exporter {
+public:
+    virtual ~statistics_exporter() = default;
+
+    virtual void export_statistics(statistics_report const &report) noexcept = 0;
+};
+
+/** Add an exporter that is called by the statistics thread at each interval.
+ */
+void statistics_register_exporter(std::shared_ptr<statistics_exporter> exporter) noexcept;
+
+/** Remove an exporter that was added with `statistics_register_exporter()`.
+ */
+void statistics_unregister_exporter(statistics_exporter const *exporter) noexcept;
+
+/** Set the interval at which the statistics are written to the log and exporters.
+ * The statistics are gathered at multiples of the interval since the epoch; the default is one minute.
+ */
+void statistics_set_interval(std::chrono::nanoseconds interval) noexcept;
+
+/** Format statistics in the Prometheus text exposition format.
+ *
+ * Counters are exported as the `ttauri_counter` gauge and traces as the
+ * `ttauri_trace_duration_seconds` summary and `ttauri_trace_peak_duration_seconds` gauge,
+ * with the tag as the `tag` label. The quantiles of the summary cover the durations since the previous report.
+ * Allocations are exported as the `ttauri_allocations` and `ttauri_allocated_bytes` counters with the `thread` label.
+ */
+[[nodiscard]] std::string format_prometheus(statistics_report const &report) noexcept;
+
+/** Write the statistics in the Prometheus text exposition format to a file.
+ * The file is replaced atomically, so that it can be read at any time by a scraper
+ * such as the textfile-collector of the Prometheus node-exporter.
+ */
+class prometheus_statistics_exporter : public statistics_exporter {
+public:
+    prometheus_statistics_exporter(URL location) noexcept : _location(std::move(location)) {}
+
+    void export_statistics(statistics_report const &report) noexcept override;
+
+private:
+    URL _location;
+};
+
+} // namespace tt
@@ -5,27 +5,86 @@
 #include "pixel_map_stencil.hpp"
 #include "../GUI/draw_context.hpp"
 #include "../codec/png.hpp"
+#include "../hash.hpp"
+#include "../logger.hpp"
+#include "../thread_pool.hpp"
+#include <chrono>
+#include <string_view>
 
 namespace tt {
 
+/** Hash the size and the pixels of an image.
+ */
+[[nodiscard]] static uint64_t hash_pixels(pixel_map<sfloat_rgba16> const &pixels) noexcept
+{
+    auto r = hash_mix(pixels.width(), pixels.height());
+    for (ssize_t y = 0; y != pixels.height(); ++y) {
+        ttlet row = pixels[y];
+        ttlet bytes = std::string_view{
+            reinterpret_cast<char const *>(row.data()), narrow_cast<size_t>(row.width()) * sizeof(sfloat_rgba16)};
+        r = hash_mix_two(r, std::hash<std::string_view>{}(bytes));
+    }
+    return r;
+}
+
 pixel_map_stencil::pixel_map_stencil(tt::alignment alignment, pixel_map<sfloat_rgba16> &&pixel_map) :
-    image_stencil(alignment), _pixel_map(std::move(pixel_map))
+    image_stencil(alignment), _key(hash_pixels(pixel_map)), _pixel_map(std::move(pixel_map))
 {
 }
 
 pixel_map_stencil::pixel_map_stencil(tt::alignment alignment, pixel_map<sfloat_rgba16> const &pixel_map) :
-    image_stencil(alignment), _pixel_map(pixel_map.copy())
+    image_stencil(alignment), _key(hash_pixels(pixel_map)), _pixel_map(pixel_map.copy())
 {
 }
 
-pixel_map_stencil::pixel_map_stencil(tt::alignment alignment, URL const &url) : pixel_map_stencil(alignment, png::load(url)) {}
+pixel_map_stencil::pixel_map_stencil(tt::alignment alignment, URL const &url) :
+    image_stencil(alignment), _key(hash_mix(url.hash(), std::string_view{"url"})), _url(url)
+{
+}
 
 void pixel_map_stencil::draw(draw_context context, tt::color color, matrix3 transform) noexcept
 {
+    auto &image_pipeline = narrow_cast<gui_device_vulkan &>(context.device()).image_pipeline();
+
+    auto backing_is_modified = false;
     if (std::exchange(_data_is_modified, false)) {
-        _backing =
-            narrow_cast<gui_device_vulkan &>(context.device()).imagePipeline->makeImage(_pixel_map.width(), _pixel_map.height());
-        _backing.upload(_pixel_map);
+        _backing = image_pipeline.findSharedImage(_key);
+        if (not _backing and _url) {
+            // Decode on the thread pool, so that a large image does not block the frame.
+            _loading = thread_pool_async(
+                [url = *_url] {
+                    return png::load(url);
+                },
+                thread_pool_priority::interactive);
+        } else {
+            backing_is_modified = true;
+        }
+    }
+
+    if (_loading.valid()) {
+        if (_loading.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+            context.window().request_redraw(aarectangle{context.transform() * context.clipping_rectangle()});
+            return;
+        }
+
+        try {
+            _pixel_map = _loading.get();
+        } catch (std::exception const &e) {
+            tt_log_error("Could not load image {}: \"{}\"", *_url, e.what());
+        }
+
+        // Another stencil may have uploaded the same image while this one was decoding.
+        _backing = image_pipeline.findSharedImage(_key);
+        backing_is_modified = true;
+    }
+
+    if (backing_is_modified) {
+        if (not _backing) {
+            _backing = image_pipeline.makeSharedImage(_key, _pixel_map);
+        }
+
+        // The image is in the atlas now, the pixels are no longer needed.
+        _pixel_map = pixel_map<sfloat_rgba16>{};
         _size_is_modified = true;
         _position_is_modified = true;
     }
@@ -34,15 +93,15 @@ void pixel_map_stencil::draw(draw_context context, tt::color color, matrix3 tran
     layout_is_modified |= std::exchange(_position_is_modified, false);
     if (layout_is_modified) {
         _pixel_map_bounding_box =
-            aarectangle{extent2{narrow_cast<float>(_backing.width_in_px), narrow_cast<float>(_backing.height_in_px)}};
+            aarectangle{extent2{narrow_cast<float>(_backing->width_in_px), narrow_cast<float>(_backing->height_in_px)}};
         _pixel_map_transform = matrix2::uniform(_pixel_map_bounding_box, _rectangle, _alignment);
     }
 
-    switch (_backing.state) {
+    switch (_backing->state) {
     case pipeline_image::Image::State::Drawing:
         context.window().request_redraw(aarectangle{context.transform() * context.clipping_rectangle()});
         break;
-    case pipeline_image::Image::State::Uploaded: context.draw_image(_backing, transform * _pixel_map_transform); break;
+    case pipeline_image::Image::State::Uploaded: context.draw_image(*_backing, transform * _pixel_map_transform); break;
     default:;
     }
 }
@@ -9,9 +9,18 @@
 #include "../pixel_map.hpp"
 #include "../color/sfloat_rgba16.hpp"
 #include "../URL.hpp"
+#include <memory>
+#include <optional>
+#include <future>
 
 namespace tt {
 
+/** A stencil drawing an image.
+ *
+ * Stencils with the same URL or with the same pixels share a single image in the atlas.
+ * An image from a URL is decoded on the thread pool after the first draw, and only when no other
+ * stencil has uploaded it. Nothing is drawn until the decoded image is swapped in.
+ */
 class pixel_map_stencil : public image_stencil {
 public:
     pixel_map_stencil(tt::alignment alignment, pixel_map<sfloat_rgba16> &&pixel_map);
@@ -21,8 +30,23 @@ public:
     void draw(draw_context context, tt::color color, matrix3 transform) noexcept override;
 
 private:
+    /** The hash of the URL or of the pixels, used to find the shared image.
+     */
+    uint64_t _key;
+
+    /** The URL to load the image from, when the stencil was not constructed from pixels.
+     */
+    std::optional<URL> _url;
+
+    /** The pixels to upload, released after the upload.
+     */
     pixel_map<sfloat_rgba16> _pixel_map;
-    pipeline_image::Image _backing;
+
+    /** The image being decoded from the URL.
+     */
+    std::future<pixel_map<sfloat_rgba16>> _loading;
+
+    std::shared_ptr<pipeline_image::Image> _backing;
     aarectangle _pixel_map_bounding_box;
     matrix2 _pixel_map_transform;
 };
@@ -39,6 +39,7 @@ void text_stencil::draw(draw_context context, tt::color color, matrix3 transform
 
     if (std::exchange(_size_is_modified, false) || data_is_modified) {
         _shaped_text = shaped_text(_text, _style, _rectangle.width(), _alignment);
+        _glyph_run.clear();
         _position_is_modified = true;
     }
 
@@ -46,7 +47,7 @@ void text_stencil::draw(draw_context context, tt::color color, matrix3 transform
         _shaped_text_transform = _shaped_text.translate_base_line(point2{_rectangle.left(), _base_line_position});
     }
 
-    context.draw_text(_shaped_text, color, transform * _shaped_text_transform);
+    context.draw_text(_shaped_text, _glyph_run, color, transform * _shaped_text_transform);
 }
 
 } // namespace tt
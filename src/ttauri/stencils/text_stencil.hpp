@@ -7,6 +7,7 @@
 #include "stencil.hpp"
 #include "../text/shaped_text.hpp"
 #include "../text/text_style.hpp"
+#include "../GUI/pipeline_SDF_glyph_run.hpp"
 #include <string_view>
 
 namespace tt {
@@ -29,6 +30,10 @@ private:
     text_style _style;
     shaped_text _shaped_text;
     matrix2 _shaped_text_transform;
+
+    /** The glyphs of `_shaped_text` resolved in the atlas.
+     */
+    pipeline_SDF::glyph_run _glyph_run;
 };
 
 } // namespace tt
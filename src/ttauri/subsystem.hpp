@@ -12,6 +12,8 @@
 #include <bit>
 #include <type_traits>
 #include <mutex>
+#include <cstdio>
+#include <cstdlib>
 
 namespace tt {
 namespace detail {
@@ -148,4 +150,21 @@ inline void shutdown_system() noexcept
     detail::subsystem_mutex.unlock();
 }
 
+/** Shutdown the system and exit the process immediately.
+ * The deinit functions are called the same as with `shutdown_system()`, which
+ * flushes the log and stops the background threads of the subsystems.
+ *
+ * The process then exits without calling the destructors of objects with
+ * static storage duration; memory, GPU objects and other handles are reclaimed
+ * by the operating system.
+ *
+ * @param exit_code The exit code of the process.
+ */
+[[noreturn]] inline void fast_shutdown_system(int exit_code) noexcept
+{
+    shutdown_system();
+    std::fflush(nullptr);
+    std::quick_exit(exit_code);
+}
+
 } // namespace tt
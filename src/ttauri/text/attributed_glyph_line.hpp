@@ -25,6 +25,21 @@ struct attributed_glyph_line {
     float xHeight;
     float y;
 
+    /** The width of the line from its start up to the end of the glyph, for each glyph.
+     * Calculated by `calculateBreakOpportunities()`.
+     */
+    std::vector<float> advanceWidths;
+
+    /** The width of the line from its start up to the end of the last visible glyph, for each glyph.
+     * Calculated by `calculateBreakOpportunities()`.
+     */
+    std::vector<float> visibleWidths;
+
+    /** The indices of the glyphs that follow white-space, where the line may be wrapped.
+     * Calculated by `calculateBreakOpportunities()`.
+     */
+    std::vector<ssize_t> breakOpportunities;
+
     /** This constructor will move the data from first to last.
     */
     attributed_glyph_line(iterator first, iterator last) noexcept :
@@ -44,39 +59,82 @@ struct attributed_glyph_line {
             std::ssize(line) >= (line.back().isParagraphSeparator() ? 3 : 2);
     }
 
-    [[nodiscard]] attributed_glyph_line wrap(float maximum_width) noexcept {
-        tt_axiom(shouldWrap(maximum_width));
+    /** Calculate where the line may be wrapped.
+     * This is done once for each paragraph, so that wrapping a paragraph to a new width
+     * does not need to walk each glyph again.
+     */
+    void calculateBreakOpportunities() noexcept {
+        advanceWidths.clear();
+        advanceWidths.reserve(line.size());
+        visibleWidths.clear();
+        visibleWidths.reserve(line.size());
+        breakOpportunities.clear();
 
-        auto word_end = line.begin();
         auto line_width = 0.0f;
         auto line_valid_width = 0.0f;
+        for (ssize_t i = 0; i != std::ssize(line); ++i) {
+            ttlet &g = line[i];
 
-        auto i = line.begin();
-        for (; i != line.end(); ++i) {
-            line_width += i->metrics.advance.x();
-            if (i->isVisible()) {
+            line_width += g.metrics.advance.x();
+            if (g.isVisible()) {
                 line_valid_width = line_width;
             }
-
-            if (line_valid_width > maximum_width) {
-                // Found position where to wrap.
-                break;
-
-            } else if (i->isWhiteSpace()) {
+            if (g.isWhiteSpace()) {
                 // Include the whitespace in the word, as it should belong at the end of the line.
-                word_end = i + 1;
+                breakOpportunities.push_back(i + 1);
             }
+
+            advanceWidths.push_back(line_width);
+            visibleWidths.push_back(line_valid_width);
+        }
+    }
+
+    /** Find the positions where the line should be wrapped.
+     * The line is wrapped at a word boundary when possible, otherwise at a
+     * character boundary; each piece will have at least one character.
+     *
+     * @param maximum_width The maximum width of each piece of the line.
+     * @return The indices of the glyphs that start a new piece of the line.
+     */
+    [[nodiscard]] std::vector<ssize_t> wrapPositions(float maximum_width) noexcept {
+        tt_axiom(std::ssize(line) >= 1);
+
+        auto r = std::vector<ssize_t>{};
+        if (not shouldWrap(maximum_width)) {
+            return r;
         }
 
-        auto split_position =
-            (word_end != line.begin()) ? word_end : // Wrap at word boundary
-            (i != line.begin()) ? i : // Wrap at character boundary
-            i + 1; // Include at least one character.
+        if (std::ssize(visibleWidths) != std::ssize(line)) {
+            calculateBreakOpportunities();
+        }
 
-        auto reset_of_line = attributed_glyph_line(split_position, line.end());
-        line.erase(split_position, line.cend());
-        calculateLineMetrics();
-        return reset_of_line;
+        ttlet nr_glyphs = std::ssize(line);
+        ttlet minimum_nr_glyphs = line.back().isParagraphSeparator() ? 3 : 2;
+
+        ssize_t start = 0;
+        while (true) {
+            ttlet start_width = start == 0 ? 0.0f : advanceWidths[start - 1];
+            if (visibleWidths.back() - start_width <= maximum_width || nr_glyphs - start < minimum_nr_glyphs) {
+                break;
+            }
+
+            // The first visible glyph that ends beyond the maximum width.
+            ttlet end = std::distance(
+                visibleWidths.cbegin(),
+                std::upper_bound(visibleWidths.cbegin() + start, visibleWidths.cend(), start_width + maximum_width));
+            tt_axiom(end < nr_glyphs);
+
+            // The last word that fits on this piece of the line.
+            ttlet word_end_it = std::upper_bound(breakOpportunities.cbegin(), breakOpportunities.cend(), end);
+            ttlet word_end = word_end_it != breakOpportunities.cbegin() ? *(word_end_it - 1) : start;
+
+            start =
+                (word_end > start) ? word_end : // Wrap at word boundary
+                (end != start) ? end : // Wrap at character boundary
+                end + 1; // Include at least one character.
+            r.push_back(start);
+        }
+        return r;
     }
 
     [[nodiscard]] aarectangle boundingBox() const noexcept {
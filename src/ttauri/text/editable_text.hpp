@@ -7,15 +7,68 @@
 #include "attributed_grapheme.hpp"
 #include "shaped_text.hpp"
 #include "font.hpp"
+#include "../gap_buffer.hpp"
 #include <string>
 #include <vector>
+#include <deque>
+#include <algorithm>
+#include <iterator>
 
 namespace tt {
 
 class editable_text {
-    std::vector<attributed_grapheme> text;
+    /** A paragraph and its glyphs, before they are wrapped and positioned.
+     */
+    struct shaped_paragraph {
+        std::vector<attributed_grapheme> text;
+        attributed_glyph_line line;
+    };
+
+    /** A change to the text, as recorded in the undo journal.
+     * Only the graphemes that were replaced are stored, not the whole text.
+     */
+    struct text_edit {
+        /** The index in the text where the edit was made.
+         */
+        ssize_t index;
+
+        /** The graphemes that were removed by the edit.
+         */
+        std::vector<attributed_grapheme> removed;
+
+        /** The graphemes that were inserted by the edit.
+         */
+        std::vector<attributed_grapheme> inserted;
+
+        /** Typing of the next grapheme may be merged with this edit.
+         */
+        bool isTyping;
+    };
+
+    /** The maximum number of edits that can be undone.
+     */
+    static constexpr size_t maximumUndoDepth = 1000;
+
+    /** The text, without the trailing paragraph separator.
+     * The gap of the buffer follows the cursor, so that editing at the cursor
+     * does not need to move the text after it.
+     */
+    gap_buffer<attributed_grapheme> text;
     shaped_text _shapedText;
 
+    /** Edits that can be undone, the most recent edit is at the back.
+     */
+    std::deque<text_edit> undoJournal;
+
+    /** Edits that were undone and can be redone, the most recently undone edit is at the back.
+     */
+    std::deque<text_edit> redoJournal;
+
+    /** The paragraphs of the text when it was last shaped.
+     * Paragraphs that did not change since are not shaped again.
+     */
+    std::vector<shaped_paragraph> shapedParagraphs;
+
     /** The maximum width when wrapping text.
      * For single line text editing, we should never wrap.
      */
@@ -68,6 +121,8 @@ public:
         for (ttlet &g : gstr) {
             text.emplace_back(g, currentStyle);
         }
+        undoJournal.clear();
+        redoJournal.clear();
 
         selectionIndex = cursorIndex = 0;
         tt_axiom(selectionIndex >= 0);
@@ -79,20 +134,83 @@ public:
         return *this;
     }
 
+    [[nodiscard]] static bool isSameParagraph(
+        std::vector<attributed_grapheme> const &lhs,
+        std::vector<attributed_grapheme> const &rhs) noexcept
+    {
+        return std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend(), [](ttlet &a, ttlet &b) {
+            return a.grapheme == b.grapheme && a.style == b.style;
+        });
+    }
+
     /** Update the shaped text after changed to text.
      */
     void updateshaped_text() noexcept {
-        auto text_ = text;
+        // Split the text into paragraphs, each ending in a paragraph separator.
+        auto paragraphs = std::vector<std::vector<attributed_grapheme>>(1);
+        for (ttlet &c : text) {
+            paragraphs.back().push_back(c);
+            if (c.grapheme == grapheme::PS()) {
+                paragraphs.emplace_back();
+            }
+        }
 
         // Make sure there is an end-paragraph marker in the text.
         // This allows the shapedText to figure out the style of the text of an empty paragraph.
         if (std::ssize(text) == 0) {
-            text_.emplace_back(grapheme::PS(), currentStyle, 0);
+            paragraphs.back().emplace_back(grapheme::PS(), currentStyle, 0);
         } else {
-            text_.emplace_back(grapheme::PS(), text_.back().style, 0);
+            paragraphs.back().emplace_back(grapheme::PS(), text.back().style, 0);
         }
 
-        _shapedText = shaped_text(text_, width, alignment::top_left, false);
+        // An edit changes a range of paragraphs; the paragraphs before and after it are reused.
+        ttlet nr_paragraphs = std::ssize(paragraphs);
+        ttlet nr_old_paragraphs = std::ssize(shapedParagraphs);
+        ttlet nr_common = std::min(nr_paragraphs, nr_old_paragraphs);
+
+        ssize_t nr_prefix = 0;
+        while (nr_prefix != nr_common && isSameParagraph(paragraphs[nr_prefix], shapedParagraphs[nr_prefix].text)) {
+            ++nr_prefix;
+        }
+
+        ssize_t nr_suffix = 0;
+        while (nr_prefix + nr_suffix != nr_common &&
+               isSameParagraph(
+                   paragraphs[nr_paragraphs - nr_suffix - 1], shapedParagraphs[nr_old_paragraphs - nr_suffix - 1].text)) {
+            ++nr_suffix;
+        }
+
+        auto new_paragraphs = std::vector<shaped_paragraph>{};
+        new_paragraphs.reserve(paragraphs.size());
+        auto lines = std::vector<attributed_glyph_line>{};
+        lines.reserve(paragraphs.size());
+
+        ssize_t logicalIndex = 0;
+        for (ssize_t i = 0; i != nr_paragraphs; ++i) {
+            if (i < nr_prefix) {
+                new_paragraphs.push_back(std::move(shapedParagraphs[i]));
+
+            } else if (i >= nr_paragraphs - nr_suffix) {
+                auto &paragraph = new_paragraphs.emplace_back(std::move(shapedParagraphs[i - nr_paragraphs + nr_old_paragraphs]));
+
+                // The paragraph may have moved when the edited paragraphs changed length.
+                if (ttlet offset = logicalIndex - paragraph.line.line.front().logicalIndex; offset != 0) {
+                    for (auto &glyph : paragraph.line) {
+                        glyph.logicalIndex += offset;
+                    }
+                }
+
+            } else {
+                auto line = shaped_text::shape_paragraph(paragraphs[i], logicalIndex);
+                new_paragraphs.push_back({std::move(paragraphs[i]), std::move(line)});
+            }
+
+            lines.push_back(new_paragraphs.back().line);
+            logicalIndex += std::ssize(new_paragraphs.back().text);
+        }
+
+        shapedParagraphs = std::move(new_paragraphs);
+        _shapedText = shaped_text(std::move(lines), width, alignment::top_left, false);
     }
 
     [[nodiscard]] shaped_text shapedText() const noexcept {
@@ -115,6 +233,12 @@ public:
         for (auto &c: text) {
             c.style = style;
         }
+        for (auto &edit : undoJournal) {
+            setStyleOfEdit(edit, style);
+        }
+        for (auto &edit : redoJournal) {
+            setStyleOfEdit(edit, style);
+        }
         updateshaped_text();
     }
 
@@ -139,7 +263,7 @@ public:
         // Index should never be beyond text.cend();
         tt_axiom(index <= std::ssize(text));
 
-        return text.cbegin() + index;
+        return text.begin() + index;
     }
 
     decltype(auto) it(ssize_t index) const noexcept {
@@ -175,17 +299,86 @@ public:
         return r;
     }
 
+    /** Replace graphemes in the text.
+     * The replacement is recorded in the undo journal; consecutive typing is
+     * recorded as a single edit.
+     *
+     * @param first The index of the first grapheme to replace.
+     * @param last The index one beyond the last grapheme to replace.
+     * @param graphemes The graphemes to insert at first.
+     * @param isTyping True when a single grapheme was typed by the user.
+     */
+    void replaceText(ssize_t first, ssize_t last, std::vector<attributed_grapheme> graphemes, bool isTyping = false) noexcept
+    {
+        tt_axiom(first >= 0 && first <= last && last <= std::ssize(text));
+
+        auto removed = std::vector<attributed_grapheme>(text.begin() + first, text.begin() + last);
+        swapText(first, last - first, graphemes);
+
+        redoJournal.clear();
+        if (isTyping && removed.empty() && !undoJournal.empty() && undoJournal.back().isTyping &&
+            undoJournal.back().index + std::ssize(undoJournal.back().inserted) == first) {
+            auto &inserted = undoJournal.back().inserted;
+            inserted.insert(inserted.end(), graphemes.cbegin(), graphemes.cend());
+
+        } else {
+            undoJournal.push_back({first, std::move(removed), std::move(graphemes), isTyping});
+            if (undoJournal.size() > maximumUndoDepth) {
+                undoJournal.pop_front();
+            }
+        }
+    }
+
+    /** Undo the last edit in the undo journal.
+     * @return True when an edit was undone.
+     */
+    bool undo() noexcept {
+        if (undoJournal.empty()) {
+            return false;
+        }
+
+        auto edit = std::move(undoJournal.back());
+        undoJournal.pop_back();
+
+        swapText(edit.index, std::ssize(edit.inserted), edit.removed);
+        selectionIndex = cursorIndex = edit.index + std::ssize(edit.removed);
+
+        edit.isTyping = false;
+        redoJournal.push_back(std::move(edit));
+        updateshaped_text();
+        return true;
+    }
+
+    /** Redo the last edit that was undone.
+     * @return True when an edit was redone.
+     */
+    bool redo() noexcept {
+        if (redoJournal.empty()) {
+            return false;
+        }
+
+        auto edit = std::move(redoJournal.back());
+        redoJournal.pop_back();
+
+        swapText(edit.index, std::ssize(edit.removed), edit.inserted);
+        selectionIndex = cursorIndex = edit.index + std::ssize(edit.inserted);
+
+        undoJournal.push_back(std::move(edit));
+        updateshaped_text();
+        return true;
+    }
+
     /** Delete a selection.
      * This function should be called when a selection is active while new text
      * is being inserted.
      */
     void deleteSelection() noexcept {
         if (selectionIndex < cursorIndex) {
-            text.erase(cit(selectionIndex), cit(cursorIndex));
+            replaceText(selectionIndex, cursorIndex, {});
             cursorIndex = selectionIndex;
             updateshaped_text();
         } else if (selectionIndex > cursorIndex) {
-            text.erase(cit(cursorIndex), cit(selectionIndex));
+            replaceText(cursorIndex, selectionIndex, {});
             selectionIndex = cursorIndex;
             updateshaped_text();
         }
@@ -305,7 +498,7 @@ public:
             tt_axiom(cursorIndex >= 0);
             tt_axiom(cursorIndex <= std::ssize(text));
 
-            text.erase(cit(cursorIndex));
+            text.erase(it(cursorIndex));
             hasPartialgrapheme = false;
 
             updateshaped_text();
@@ -321,7 +514,7 @@ public:
         cancelPartialgrapheme();
         deleteSelection();
 
-        text.emplace(cit(cursorIndex), character, currentStyle);
+        text.emplace_before(text.begin() + cursorIndex, character, currentStyle);
         selectionIndex = ++cursorIndex;
         tt_axiom(selectionIndex >= 0);
         tt_axiom(selectionIndex <= std::ssize(text));
@@ -342,7 +535,7 @@ public:
         if (!insertMode) {
             handle_event(command::text_delete_char_next);
         }
-        text.emplace(cit(cursorIndex), character, currentStyle);
+        replaceText(cursorIndex, cursorIndex, {attributed_grapheme{character, currentStyle}}, true);
         selectionIndex = ++cursorIndex;
         tt_axiom(selectionIndex >= 0);
         tt_axiom(selectionIndex <= std::ssize(text));
@@ -364,8 +557,9 @@ public:
             str_attr.emplace_back(g, currentStyle);
         }
 
-        text.insert(cit(cursorIndex), str_attr.cbegin(), str_attr.cend());
-        selectionIndex = cursorIndex += std::ssize(str_attr);
+        ttlet nr_graphemes = std::ssize(str_attr);
+        replaceText(cursorIndex, cursorIndex, std::move(str_attr));
+        selectionIndex = cursorIndex += nr_graphemes;
         tt_axiom(selectionIndex >= 0);
         tt_axiom(selectionIndex <= std::ssize(text));
         tt_axiom(cursorIndex >= 0);
@@ -505,7 +699,7 @@ public:
 
             } else if (cursorIndex >= 1) {
                 selectionIndex = --cursorIndex;
-                text.erase(cit(cursorIndex));
+                replaceText(cursorIndex, cursorIndex + 1, {});
                 updateshaped_text();
             }
             break;
@@ -517,9 +711,21 @@ public:
 
             } else if (cursorIndex < (std::ssize(text) - 1)) {
                 // Don't delete the trailing paragraph separator.
-                text.erase(cit(cursorIndex));
+                replaceText(cursorIndex, cursorIndex + 1, {});
                 updateshaped_text();
             }
+            break;
+
+        case command::text_undo:
+            handled = true;
+            undo();
+            break;
+
+        case command::text_redo:
+            handled = true;
+            redo();
+            break;
+
         default:;
         }
 
@@ -529,6 +735,30 @@ public:
         tt_axiom(cursorIndex <= std::ssize(text));
         return handled;
     }
+
+private:
+    /** Replace graphemes in the text without recording it in the undo journal.
+     *
+     * @param index The index of the first grapheme to replace.
+     * @param size The number of graphemes to replace.
+     * @param graphemes The graphemes to insert at index.
+     */
+    void swapText(ssize_t index, ssize_t size, std::vector<attributed_grapheme> const &graphemes) noexcept
+    {
+        tt_axiom(index >= 0 && index + size <= std::ssize(text));
+
+        text.replace(text.begin() + index, text.begin() + index + size, graphemes);
+    }
+
+    static void setStyleOfEdit(text_edit &edit, text_style const &style) noexcept
+    {
+        for (auto &c : edit.removed) {
+            c.style = style;
+        }
+        for (auto &c : edit.inserted) {
+            c.style = style;
+        }
+    }
 };
 
 
@@ -4,26 +4,273 @@
 
 #include "font_book.hpp"
 #include "true_type_font.hpp"
+#include "../codec/BON8.hpp"
+#include "../file.hpp"
+#include "../file_view.hpp"
 #include "../trace.hpp"
+#include "../counters.hpp"
+#include "../thread.hpp"
+#include <filesystem>
+#include <thread>
+#include <atomic>
+#include <algorithm>
 
 namespace tt {
 
-font_book::font_book(std::vector<URL> const &font_directories)
+/** The version of the font index file.
+ * Increment when the layout of the index, or the parsing of the font description changes.
+ */
+constexpr int64_t font_index_version = 1;
+
+[[nodiscard]] static datum font_index_load(URL const &location) noexcept
+{
+    try {
+        ttlet view = file_view(location);
+        view.hint(file_view_hint::sequential);
+        auto ptr = view.bytes().data();
+        ttlet last = ptr + view.size();
+        auto index = decode_BON8(ptr, last);
+
+        if (not index.is_map() or not index.contains("version") or
+            static_cast<int64_t>(index["version"]) != font_index_version or not index.contains("fonts")) {
+            tt_log_info("Font index file has a different version, it will be replaced.");
+            return datum::map{};
+        }
+
+        auto fonts = index["fonts"];
+        if (not fonts.is_map()) {
+            tt_log_warning("Could not parse font index file, it will be replaced.");
+            return datum::map{};
+        }
+        return fonts;
+
+    } catch (io_error const &e) {
+        tt_log_info("Could not open font index file. \"{}\"", e.what());
+    } catch (std::exception const &e) {
+        tt_log_warning("Could not parse font index file, it will be replaced. \"{}\"", e.what());
+    }
+    return datum::map{};
+}
+
+static void font_index_save(URL const &location, datum const &fonts) noexcept
+{
+    auto index = datum::map{};
+    index["version"] = font_index_version;
+    index["fonts"] = fonts;
+
+    try {
+        ttlet bytes = encode_BON8(datum{std::move(index)});
+        auto file = tt::file(location, access_mode::truncate_or_create_for_write | access_mode::create_directories);
+        file.write(std::span<std::byte const>{bytes.data(), bytes.size()});
+        file.flush();
+
+    } catch (io_error const &e) {
+        tt_log_error("Could not save font index file. \"{}\"", e.what());
+    }
+}
+
+/** The size and modification time of a font file.
+ * Used to check if the entry in the font index still matches the font file.
+ */
+[[nodiscard]] static datum font_index_file_stamp(URL const &url) noexcept
+{
+    auto ec = std::error_code{};
+    ttlet path = std::filesystem::path{url.nativeWPath()};
+
+    ttlet size = std::filesystem::file_size(path, ec);
+    if (ec) {
+        return {};
+    }
+
+    ttlet time = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        return {};
+    }
+
+    auto r = datum::vector{};
+    r.emplace_back(static_cast<int64_t>(size));
+    r.emplace_back(static_cast<int64_t>(time.time_since_epoch().count()));
+    return datum{std::move(r)};
+}
+
+[[nodiscard]] static datum font_index_make_entry(datum const &stamp, font_description const &description) noexcept
+{
+    auto ranges = datum::vector{};
+    for (ttlet value : description.unicode_ranges.value) {
+        ranges.emplace_back(value);
+    }
+
+    auto r = datum::map{};
+    r["stamp"] = stamp;
+    r["family_name"] = description.family_name;
+    r["sub_family_name"] = description.sub_family_name;
+    r["monospace"] = description.monospace;
+    r["serif"] = description.serif;
+    r["italic"] = description.italic;
+    r["condensed"] = description.condensed;
+    r["weight"] = to_int(description.weight);
+    r["optical_size"] = description.optical_size;
+    r["unicode_ranges"] = std::move(ranges);
+    r["x_height"] = description.xHeight;
+    r["H_height"] = description.HHeight;
+    r["digit_width"] = description.DigitWidth;
+    return datum{std::move(r)};
+}
+
+/** Read the font description from an entry of the font index.
+ *
+ * @param entry The entry of the font index.
+ * @param stamp The current size and modification time of the font file.
+ * @return The font description, or empty when the entry does not match the font file.
+ */
+[[nodiscard]] static std::optional<font_description>
+font_index_parse_entry(datum const &entry, datum const &stamp) noexcept
+{
+    try {
+        if (not entry.is_map() or entry["stamp"] != stamp) {
+            return {};
+        }
+
+        ttlet ranges = static_cast<datum::vector>(entry["unicode_ranges"]);
+        if (ranges.size() != 4) {
+            return {};
+        }
+
+        auto r = font_description{};
+        r.family_name = static_cast<std::string>(entry["family_name"]);
+        r.sub_family_name = static_cast<std::string>(entry["sub_family_name"]);
+        r.monospace = static_cast<bool>(entry["monospace"]);
+        r.serif = static_cast<bool>(entry["serif"]);
+        r.italic = static_cast<bool>(entry["italic"]);
+        r.condensed = static_cast<bool>(entry["condensed"]);
+        r.weight = font_weight_from_int(static_cast<int>(entry["weight"]));
+        r.optical_size = static_cast<float>(entry["optical_size"]);
+        for (size_t i = 0; i != 4; ++i) {
+            r.unicode_ranges.value[i] = static_cast<uint32_t>(ranges[i]);
+        }
+        r.xHeight = static_cast<float>(entry["x_height"]);
+        r.HHeight = static_cast<float>(entry["H_height"]);
+        r.DigitWidth = static_cast<float>(entry["digit_width"]);
+        return r;
+
+    } catch (std::exception const &) {
+        return {};
+    }
+}
+
+/** A font file found while scanning the font directories.
+ */
+struct font_book_scanned_font {
+    URL url;
+
+    /** The key of the font in the font index.
+     */
+    std::string key;
+
+    /** The size and modification time of the font file, or undefined if it could not be determined.
+     */
+    datum stamp;
+
+    /** The description of the font, from the font index or from parsing the font file.
+     */
+    std::optional<font_description> description;
+
+    /** The error message when the font file could not be parsed.
+     */
+    std::string error;
+
+    bool from_index = false;
+};
+
+/** Parse the font files that where not found in the font index.
+ * The font files are independent from each other, so they are parsed on multiple threads.
+ */
+static void font_book_parse_fonts(std::vector<font_book_scanned_font> &fonts) noexcept
+{
+    auto next = std::atomic<size_t>{0};
+    auto parse_loop = [&fonts, &next] {
+        for (auto i = next.fetch_add(1, std::memory_order::relaxed); i < fonts.size();
+             i = next.fetch_add(1, std::memory_order::relaxed)) {
+            auto &font = fonts[i];
+            if (font.from_index) {
+                continue;
+            }
+
+            auto t = trace<"font_scan">{};
+            try {
+                font.description = true_type_font(font.url).description;
+            } catch (std::exception const &e) {
+                font.error = e.what();
+            }
+        }
+    };
+
+    ttlet nr_threads = std::clamp(std::thread::hardware_concurrency(), 1u, font_book::maximum_nr_scan_threads);
+
+    auto threads = std::vector<std::jthread>{};
+    for (unsigned int i = 1; i < nr_threads; ++i) {
+        threads.emplace_back([&parse_loop] {
+            set_thread_name("font_scan");
+            parse_loop();
+        });
+    }
+
+    // The current thread helps parsing, then waits for the other threads by destroying them.
+    parse_loop();
+}
+
+font_book::font_book(std::vector<URL> const &font_directories, URL const &index_location)
 {
     create_family_name_fallback_chain();
 
+    ttlet old_index = font_index_load(index_location);
+    auto new_index = datum::map{};
+    auto index_changed = false;
+
+    auto fonts = std::vector<font_book_scanned_font>{};
     for (ttlet &font_directory: font_directories) {
         ttlet font_directory_glob = font_directory / "**" / "*.ttf";
         for (ttlet &font_url: font_directory_glob.urlsByScanningWithGlobPattern()) {
-            auto t = trace<"font_scan">{};
+            auto &font = fonts.emplace_back();
+            font.url = font_url;
+            font.key = to_string(font_url);
+            font.stamp = font_index_file_stamp(font_url);
+
+            if (not font.stamp.is_undefined() and old_index.contains(font.key)) {
+                font.description = font_index_parse_entry(old_index[font.key], font.stamp);
+                font.from_index = static_cast<bool>(font.description);
+            }
+        }
+    }
 
-            try {
-                register_font(font_url, false);
+    font_book_parse_fonts(fonts);
 
-            } catch (std::exception const &e) {
-                tt_log_error("Failed parsing font at {}: \"{}\"", font_url, e.what());
-            }
+    // Register the fonts in the order they where found, so that the font_ids do not depend on the parsing threads.
+    for (auto &font : fonts) {
+        if (font.from_index) {
+            increment_counter<"font_index_hit">();
+            register_font(std::move(font.url), *font.description, false);
+            new_index[font.key] = old_index[font.key];
+            continue;
         }
+
+        increment_counter<"font_index_miss">();
+        index_changed = true;
+        if (not font.description) {
+            tt_log_error("Failed parsing font at {}: \"{}\"", font.url, font.error);
+            continue;
+        }
+
+        tt_log_info("Parsed font {}: {}", font.url, *font.description);
+        register_font(std::move(font.url), *font.description, false);
+        if (not font.stamp.is_undefined()) {
+            new_index[font.key] = font_index_make_entry(font.stamp, *font.description);
+        }
+    }
+
+    // Also rewrite the index when fonts were removed from the font directories.
+    if (index_changed or new_index.size() != old_index.size()) {
+        font_index_save(index_location, datum{std::move(new_index)});
     }
 
     post_process();
@@ -85,12 +332,15 @@ void font_book::create_family_name_fallback_chain() noexcept
 font_id font_book::register_font(URL url, bool post_process)
 {
     auto font = std::make_unique<true_type_font>(url);
-    auto &description = font->description;
+    tt_log_info("Parsed font {}: {}", url, font->description);
 
-    tt_log_info("Parsed font {}: {}", url, description);
+    return register_font(std::move(url), font->description, post_process);
+}
 
+font_id font_book::register_font(URL url, font_description const &description, bool post_process)
+{
     ttlet font_id = tt::font_id(std::ssize(font_entries));
-    font_entries.emplace_back(url, description);
+    font_entries.emplace_back(std::move(url), description);
 
     ttlet font_family_id = register_family(description.family_name);
     font_variants[font_family_id][description.font_variant()] = font_id;
@@ -278,17 +528,21 @@ void font_book::post_process() noexcept
     return glyph_ids;
 }
 
+void font_book::insert_glyph_cache(font_grapheme_id key, font_glyph_ids const &glyph_ids) const noexcept
+{
+    glyph_cache.insert(std::move(key), glyph_ids);
+}
+
 [[nodiscard]] font_glyph_ids font_book::find_glyph(font_id font_id, grapheme g) const noexcept
 {
-    auto i = glyph_cache.find({font_id, g});
-    if (i != glyph_cache.end()) {
-        return i->second;
+    if (auto cached = glyph_cache.get({font_id, g})) {
+        return std::move(*cached);
     }
 
     // First try the selected font.
     auto glyph_ids = find_glyph_actual(font_id, g);
     if (glyph_ids) {
-        glyph_cache[{font_id, g}] = glyph_ids;
+        insert_glyph_cache({font_id, g}, glyph_ids);
         return glyph_ids;
     }
 
@@ -298,7 +552,7 @@ void font_book::post_process() noexcept
         auto &fallback_description = font_entries[fallback_id].description;
         if (fallback_description.unicode_ranges >= g_range) {
             if ((glyph_ids = find_glyph_actual(fallback_id, g))) {
-                glyph_cache[{font_id, g}] = glyph_ids;
+                insert_glyph_cache({font_id, g}, glyph_ids);
                 return glyph_ids;
             }
         }
@@ -307,7 +561,7 @@ void font_book::post_process() noexcept
     // If all everything has failed, use the tofu block of the original font.
     glyph_ids += glyph_id{0};
     glyph_ids.set_font_id(font_id);
-    glyph_cache[{font_id, g}] = glyph_ids;
+    insert_glyph_cache({font_id, g}, glyph_ids);
     return glyph_ids;
 }
 
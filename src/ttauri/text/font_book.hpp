@@ -12,9 +12,11 @@
 #include "ttauri/text/font_grapheme_id.hpp"
 #include "ttauri/text/font_glyph_ids.hpp"
 #include "ttauri/URL.hpp"
+#include "ttauri/wfree_growable_unordered_map.hpp"
 #include "ttauri/alignment.hpp"
 #include <limits>
 #include <array>
+#include <atomic>
 #include <new>
 
 
@@ -30,7 +32,21 @@ class font_book {
 public:
     static inline std::unique_ptr<font_book> global;
 
-    font_book(std::vector<URL> const &font_directories);
+    /** The maximum number of threads parsing font files while scanning the font directories.
+     */
+    static constexpr unsigned int maximum_nr_scan_threads = 16;
+
+    /** Scan the font directories and register each font found.
+     *
+     * The descriptions of the fonts are stored in an index file, keyed by path, size and modification time.
+     * On the next startup a font that has not changed is registered from the index, without opening the font file;
+     * the font file is parsed when the font is first used. Fonts that are not in the index are parsed on multiple
+     * threads, then registered in the order they were found.
+     *
+     * @param font_directories The directories to scan for fonts.
+     * @param index_location The location of the font index file.
+     */
+    font_book(std::vector<URL> const &font_directories, URL const &index_location);
 
     /** Register a font.
      * Duplicate registrations will be ignored.
@@ -45,6 +61,15 @@ public:
      */
     font_id register_font(URL url, bool post_process=true);
 
+    /** Register a font with a description that was read earlier.
+     * The font file will not be opened until the font is used.
+     *
+     * @param url Location of font.
+     * @param description The description of the font.
+     * @param post_process Calculate font fallback
+     */
+    font_id register_font(URL url, font_description const &description, bool post_process=true);
+
     /** Post process font_book
      * Should be called after a set of register_font() calls
      * This calculates font fallbacks.
@@ -134,10 +159,16 @@ private:
      */
     mutable std::unordered_map<std::string, font_family_id> family_name_cache;
 
-    /**
+    /** The glyphs found for a grapheme in a font or in one of its fallback fonts.
+     * Graphemes that are not found in any font are cached as the tofu glyph.
+     * Lookups are wait-free, so that text can be shaped from any thread; the cache grows
+     * as more graphemes are shaped.
      * Must be cleared when a new font is registered.
      */
-    mutable std::unordered_map<font_grapheme_id, font_glyph_ids> glyph_cache;
+    mutable wfree_growable_unordered_map<font_grapheme_id, font_glyph_ids> glyph_cache;
+
+    void insert_glyph_cache(font_grapheme_id key, font_glyph_ids const &glyph_ids) const noexcept;
+
     void calculate_fallback_fonts(fontEntry &entry, std::function<bool(font_description const&,font_description const&)> predicate) noexcept;
 
     /** Find the glyph for this specific font.
@@ -11,24 +11,32 @@ namespace tt {
 grapheme::grapheme(std::u32string_view codePoints) noexcept :
     value(0)
 {
-    ttlet codePoints_ = unicode_NFC(codePoints);
+    // Most graphemes are already in NFC, in that case the code-points are encoded without a copy.
+    if (unicode_NFC_quick_check(codePoints)) {
+        set_code_points(codePoints);
+    } else {
+        set_code_points(unicode_NFC(codePoints));
+    }
+}
 
-    switch (codePoints_.size()) {
+void grapheme::set_code_points(std::u32string_view codePoints) noexcept
+{
+    switch (codePoints.size()) {
     case 3:
-        value |= (static_cast<uint64_t>(codePoints_[2] & 0x1f'ffff) << 43);
+        value |= (static_cast<uint64_t>(codePoints[2] & 0x1f'ffff) << 43);
         [[fallthrough]];
     case 2:
-        value |= (static_cast<uint64_t>(codePoints_[1] & 0x1f'ffff) << 22);
+        value |= (static_cast<uint64_t>(codePoints[1] & 0x1f'ffff) << 22);
         [[fallthrough]];
     case 1:
-        value |= (static_cast<uint64_t>(codePoints_[0] & 0x1f'ffff) << 1);
+        value |= (static_cast<uint64_t>(codePoints[0] & 0x1f'ffff) << 1);
         [[fallthrough]];
     case 0:
         value |= 1;
         break;
     default:
-        if (codePoints_.size() <= std::tuple_size_v<long_grapheme>) {
-            value = create_pointer(codePoints_.data(), codePoints_.size());
+        if (codePoints.size() <= std::tuple_size_v<long_grapheme>) {
+            value = create_pointer(codePoints.data(), codePoints.size());
         } else {
             value = (0x00'fffdULL << 1) | 1; // Replacement character.
         }
@@ -54,11 +62,13 @@ grapheme& grapheme::operator+=(char32_t codePoint) noexcept
         tmp[1] = (*this)[1];
         tmp[2] = (*this)[2];
         tmp[3] = codePoint;
-        value = create_pointer(tmp.data(), 3);
+        value = create_pointer(tmp.data(), 4);
+        } break;
+    default: {
+        ttlet old_size = size();
+        (*get_pointer())[old_size] = codePoint;
+        value = (static_cast<uint64_t>(old_size + 1) << 48) | (value & 0xffff'ffff'ffff);
         } break;
-    default:
-        auto tmp = *get_pointer();
-        tmp[size()] = codePoint;
     }
     return *this;
 }
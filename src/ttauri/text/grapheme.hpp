@@ -140,6 +140,19 @@ public:
         return r;
     }
 
+    /** A value that is equal for equal graphemes, for hashing strings of graphemes.
+     * This is the value itself for graphemes of up to three code-points, or the hash of the
+     * code-points of longer graphemes.
+     */
+    [[nodiscard]] uint64_t hash_key() const noexcept
+    {
+        if (has_pointer()) {
+            return hash_bytes(get_pointer()->data(), size() * sizeof(char32_t));
+        } else {
+            return value;
+        }
+    }
+
     [[nodiscard]] size_t size() const noexcept
     {
         if (has_pointer()) {
@@ -223,6 +236,10 @@ public:
     }
 
 private:
+    /** Encode code-points that are already in NFC.
+     */
+    void set_code_points(std::u32string_view codePoints) noexcept;
+
     [[nodiscard]] bool has_pointer() const noexcept
     {
         return (value & 1) == 0;
@@ -233,7 +250,7 @@ private:
         tt_assert(size <= std::tuple_size<long_grapheme>::value);
 
         auto ptr = new long_grapheme();
-        memcpy(ptr->data(), data, size);
+        memcpy(ptr->data(), data, size * sizeof(char32_t));
 
         auto iptr = reinterpret_cast<ptrdiff_t>(ptr);
         auto uptr = static_cast<uint64_t>(iptr << 16) >> 16;
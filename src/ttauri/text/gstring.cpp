@@ -7,29 +7,39 @@
 #include "unicode_normalization.hpp"
 #include "../strings.hpp"
 #include "../application.hpp"
+#include <array>
 
 namespace tt {
 
 [[nodiscard]] gstring to_gstring(std::u32string_view rhs) noexcept
 {
-    ttlet normalizedString = unicode_NFC(rhs, true, true, true);
+    // Most text is already normalized, in that case the text is not copied.
+    auto normalized = std::u32string{};
+    auto text = rhs;
+    if (not unicode_NFC_quick_check(rhs, true, true)) {
+        normalized = unicode_NFC(rhs, true, true, true);
+        text = normalized;
+    }
 
     auto r = tt::gstring{};
-    auto breakState = tt::grapheme_break_state{};
-    auto cluster = std::u32string{};
+    r.reserve(std::ssize(text));
 
-    for (ttlet codePoint : normalizedString) {
-        if (breaks_grapheme(codePoint, breakState)) {
-            if (cluster.size() > 0) {
-                r += tt::grapheme{cluster};
+    // The text is segmented in pieces, so that the offsets of the breaks fit in a buffer on the stack.
+    auto breakState = tt::grapheme_break_state{};
+    auto breaks = std::array<size_t, 256>{};
+    auto cluster_start = size_t{0};
+    for (auto piece_start = size_t{0}; piece_start < text.size(); piece_start += breaks.size()) {
+        ttlet nr_breaks = breaks_grapheme(text.substr(piece_start, breaks.size()), breaks, breakState);
+        for (size_t i = 0; i != nr_breaks; ++i) {
+            ttlet offset = piece_start + breaks[i];
+            if (offset != cluster_start) {
+                r += tt::grapheme{text.substr(cluster_start, offset - cluster_start)};
             }
-            cluster.clear();
+            cluster_start = offset;
         }
-
-        cluster += codePoint;
     }
-    if (std::ssize(cluster) != 0) {
-        r += tt::grapheme{cluster};
+    if (cluster_start != text.size()) {
+        r += tt::grapheme{text.substr(cluster_start)};
     }
     return r;
 }
@@ -6,52 +6,137 @@
 
 #include "grapheme.hpp"
 #include "../strings.hpp"
+#include "../hash.hpp"
 #include <vector>
+#include <array>
+#include <algorithm>
+#include <stdexcept>
 
 namespace tt {
 
+/** A string of graphemes.
+ *
+ * Short strings, such as the text of labels and menu items, are stored inside
+ * the gstring itself. The graphemes are moved to the heap when the string grows
+ * beyond the inline capacity.
+ */
 struct gstring {
-    std::vector<grapheme> graphemes;
-
-    using const_iterator = std::vector<grapheme>::const_iterator;
     using value_type = grapheme;
+    using iterator = grapheme *;
+    using const_iterator = grapheme const *;
+
+    /** The number of graphemes that are stored without allocating memory.
+     */
+    static constexpr ssize_t inline_capacity = 15;
+
+    gstring() noexcept = default;
+    gstring(gstring const &other) noexcept = default;
+    gstring(gstring &&other) noexcept = default;
+    gstring &operator=(gstring const &other) noexcept = default;
+    gstring &operator=(gstring &&other) noexcept = default;
+    ~gstring() = default;
+
+    [[nodiscard]] ssize_t size() const noexcept {
+        return _on_heap ? std::ssize(_heap) : _inline_size;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /** Reserve room for graphemes.
+     * The graphemes are moved to the heap when more room is needed than the inline capacity.
+     */
+    void reserve(ssize_t new_capacity) noexcept {
+        if (_on_heap) {
+            _heap.reserve(narrow_cast<size_t>(new_capacity));
+        } else if (new_capacity > inline_capacity) {
+            move_to_heap(new_capacity);
+        }
+    }
 
-    ssize_t size() const noexcept {
-        return std::ssize(graphemes);
+    grapheme const &operator[](ssize_t i) const noexcept {
+        tt_axiom(i >= 0 && i < size());
+        return begin()[i];
+    }
+
+    grapheme &operator[](ssize_t i) noexcept {
+        tt_axiom(i >= 0 && i < size());
+        return begin()[i];
     }
 
     grapheme const &at(ssize_t i) const {
-        return graphemes.at(i);
+        if (i < 0 || i >= size()) {
+            throw std::out_of_range("gstring::at");
+        }
+        return begin()[i];
     }
 
     grapheme &at(ssize_t i) {
-        return graphemes.at(i);
+        if (i < 0 || i >= size()) {
+            throw std::out_of_range("gstring::at");
+        }
+        return begin()[i];
     }
 
-    decltype(auto) begin() noexcept { return graphemes.begin(); }
-    decltype(auto) begin() const noexcept { return graphemes.begin(); }
-    decltype(auto) cbegin() const noexcept { return graphemes.cbegin(); }
-    decltype(auto) end() noexcept { return graphemes.end(); }
-    decltype(auto) end() const noexcept { return graphemes.end(); }
-    decltype(auto) cend() const noexcept { return graphemes.cend(); }
-
-    decltype(auto) front() noexcept { return graphemes.front(); }
-    decltype(auto) front() const noexcept { return graphemes.front(); }
-    decltype(auto) back() noexcept { return graphemes.back(); }
-    decltype(auto) back() const noexcept { return graphemes.back(); }
+    [[nodiscard]] iterator begin() noexcept { return _on_heap ? _heap.data() : _inline.data(); }
+    [[nodiscard]] const_iterator begin() const noexcept { return _on_heap ? _heap.data() : _inline.data(); }
+    [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+    [[nodiscard]] iterator end() noexcept { return begin() + size(); }
+    [[nodiscard]] const_iterator end() const noexcept { return begin() + size(); }
+    [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+
+    [[nodiscard]] grapheme &front() noexcept { tt_axiom(!empty()); return *begin(); }
+    [[nodiscard]] grapheme const &front() const noexcept { tt_axiom(!empty()); return *begin(); }
+    [[nodiscard]] grapheme &back() noexcept { tt_axiom(!empty()); return *(end() - 1); }
+    [[nodiscard]] grapheme const &back() const noexcept { tt_axiom(!empty()); return *(end() - 1); }
+
+    void push_back(grapheme g) noexcept {
+        if (_on_heap) {
+            _heap.push_back(std::move(g));
+        } else if (_inline_size < inline_capacity) {
+            _inline[_inline_size++] = std::move(g);
+        } else {
+            move_to_heap(inline_capacity * 2);
+            _heap.push_back(std::move(g));
+        }
+    }
 
     gstring &operator+=(gstring const &rhs) noexcept {
-        for (ttlet &rhs_grapheme: rhs.graphemes) {
-            graphemes.push_back(rhs_grapheme);
+        reserve(size() + rhs.size());
+        for (ttlet &rhs_grapheme: rhs) {
+            push_back(rhs_grapheme);
         }
         return *this;
     }
 
     gstring &operator+=(grapheme const &grapheme) noexcept {
-        graphemes.push_back(grapheme);
+        push_back(grapheme);
         return *this;
     }
 
+    [[nodiscard]] friend bool operator==(gstring const &lhs, gstring const &rhs) noexcept {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    /** Hash the graphemes.
+     * The hash keys of the graphemes are collected in blocks, which are hashed 16 bytes at a time.
+     */
+    [[nodiscard]] size_t hash() const noexcept {
+        auto keys = std::array<uint64_t, 16>{};
+
+        size_t r = 0;
+        auto it = begin();
+        while (it != end()) {
+            ttlet nr_keys = std::min(std::ssize(keys), end() - it);
+            for (ssize_t i = 0; i != nr_keys; ++i) {
+                keys[i] = (it++)->hash_key();
+            }
+            r = hash_bytes(keys.data(), narrow_cast<size_t>(nr_keys) * sizeof(uint64_t), r);
+        }
+        return r;
+    }
+
     [[nodiscard]] friend std::u32string to_u32string(gstring const &rhs) noexcept {
         std::u32string r;
         r.reserve(std::ssize(rhs));
@@ -69,6 +154,22 @@ struct gstring {
     friend std::ostream &operator<<(std::ostream &lhs, gstring const &rhs) {
         return lhs << to_string(rhs);
     }
+
+private:
+    std::array<grapheme, inline_capacity> _inline;
+    ssize_t _inline_size = 0;
+    std::vector<grapheme> _heap;
+    bool _on_heap = false;
+
+    void move_to_heap(ssize_t new_capacity) noexcept {
+        tt_axiom(!_on_heap);
+        _heap.reserve(narrow_cast<size_t>(new_capacity));
+        for (ssize_t i = 0; i != _inline_size; ++i) {
+            _heap.push_back(std::move(_inline[i]));
+        }
+        _inline_size = 0;
+        _on_heap = true;
+    }
 };
 
 [[nodiscard]] gstring to_gstring(std::u32string_view rhs) noexcept;
@@ -84,3 +185,15 @@ struct gstring {
 
 
 }
+
+namespace std {
+
+template<>
+struct hash<tt::gstring> {
+    [[nodiscard]] size_t operator()(tt::gstring const &rhs) const noexcept
+    {
+        return rhs.hash();
+    }
+};
+
+} // namespace std
@@ -0,0 +1,67 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/text/gstring.hpp"
+#include <gtest/gtest.h>
+#include <string>
+
+TEST(gstring, to_gstring)
+{
+    ttlet short_text = tt::to_gstring(std::u32string{U"Café"});
+    ASSERT_EQ(short_text.size(), 4);
+    ASSERT_TRUE(short_text[3] == tt::grapheme{U'\u00e9'});
+
+    // Longer than the inline capacity of a gstring.
+    ttlet long_text = tt::to_gstring(std::u32string{U"The quick brown fox jumps over the lazy dog."});
+    ASSERT_EQ(long_text.size(), 44);
+    ASSERT_TRUE(long_text.front() == tt::grapheme{U'T'});
+    ASSERT_TRUE(long_text.back() == tt::grapheme{U'.'});
+    ASSERT_TRUE(to_u32string(long_text) == U"The quick brown fox jumps over the lazy dog.");
+}
+
+TEST(gstring, copy_after_spill)
+{
+    auto text = tt::gstring{};
+    for (ttlet c : std::u32string{U"abcdefghijklmnopqrstuvwxyz"}) {
+        text += tt::grapheme{c};
+    }
+    ASSERT_EQ(text.size(), 26);
+
+    ttlet copy = text;
+    ASSERT_TRUE(copy == text);
+
+    auto moved = std::move(text);
+    ASSERT_TRUE(moved == copy);
+    ASSERT_TRUE(moved[25] == tt::grapheme{U'z'});
+}
+
+TEST(gstring, long_grapheme)
+{
+    // There are no precomposed characters for 'x' with these combining marks.
+    auto g = tt::grapheme{std::u32string_view{U"x\u0301\u0302\u0303"}};
+    ASSERT_EQ(g.size(), 4);
+    ASSERT_EQ(g[3], U'\u0303');
+
+    g += U'\u0304';
+    ASSERT_EQ(g.size(), 5);
+    ASSERT_EQ(g[4], U'\u0304');
+
+    ttlet copy = g;
+    ASSERT_TRUE(copy == g);
+}
+
+TEST(gstring, hash)
+{
+    ttlet text = tt::to_gstring(std::u32string{U"The quick brown fox jumps over the lazy dog."});
+    ttlet copy = text;
+    ASSERT_EQ(std::hash<tt::gstring>{}(text), std::hash<tt::gstring>{}(copy));
+    ASSERT_NE(std::hash<tt::gstring>{}(text), std::hash<tt::gstring>{}(tt::to_gstring(std::u32string{U"The quick brown fox"})));
+
+    // Equal long graphemes stored at different addresses have the same hash.
+    auto a = tt::gstring{};
+    auto b = tt::gstring{};
+    a += tt::grapheme{std::u32string_view{U"x\u0301\u0302\u0303"}};
+    b += tt::grapheme{std::u32string_view{U"x\u0301\u0302\u0303"}};
+    ASSERT_EQ(std::hash<tt::gstring>{}(a), std::hash<tt::gstring>{}(b));
+}
@@ -6,14 +6,33 @@
 #include "language.hpp"
 #include "translation.hpp"
 #include "po_parser.hpp"
+#include "translation_catalog.hpp"
 #include <fmt/format.h>
 
 namespace tt {
 
 language::language(language_tag tag) noexcept :
     tag(std::move(tag)), plurality_func()
+{
+}
+
+void language::load_translations_from_resources() noexcept
 {
     // XXX fmt::format is unable to find language_tag::operator<<
+    auto catalog_url = URL(fmt::format("resource:locale/{}.tcat", to_string(this->tag)));
+
+    try {
+        add_translation(translation_catalog(catalog_url.loadView()), *this);
+        tt_log_info("Loaded language {} catalog {}", to_string(this->tag), catalog_url);
+        return;
+
+    } catch (parse_error const &e) {
+        tt_log_warning("Could not parse language catalog {}: \"{}\"", catalog_url, e.what());
+
+    } catch (std::exception const &) {
+        // There is no compiled catalog for this language, fall back to the .po file.
+    }
+
     auto po_url = URL(fmt::format("resource:locale/{}.po", to_string(this->tag)));
 
     tt_log_info("Loading language {} catalog {}", to_string(this->tag), po_url);
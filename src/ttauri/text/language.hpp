@@ -8,6 +8,7 @@
 #include "../utils.hpp"
 #include "../logger.hpp"
 #include "language_tag.hpp"
+#include "translation_catalog.hpp"
 #include <string>
 #include <vector>
 #include <functional>
@@ -20,6 +21,10 @@ struct language {
     language_tag tag;
     std::function<int(int)> plurality_func;
 
+    /** The translations of this language, see `load_translations()`.
+     */
+    std::vector<translation_catalog> catalogs;
+
     language(language_tag tag) noexcept;
 
     language(language const &) = delete;
@@ -38,6 +43,17 @@ struct language {
         return std::clamp(narrow_cast<ssize_t>(r), ssize_t{0}, max - 1);
     }
 
+    /** Load the translations of this language from the resources.
+     * The translations are loaded on the first call, which is done by the first lookup of
+     * a translation in this language, so that only the languages that are used are loaded.
+     */
+    void load_translations() noexcept
+    {
+        std::call_once(_translations_loaded, [this] {
+            load_translations_from_resources();
+        });
+    }
+
     inline static std::unordered_map<language_tag,std::unique_ptr<language>> languages;
     inline static std::vector<language *> preferred_languages;
     inline static std::recursive_mutex static_mutex;
@@ -123,6 +139,11 @@ struct language {
      * Language tags are based on IETF BCP-47/RFC-5646
      */
     [[nodiscard]] static std::vector<language_tag> read_os_preferred_languages() noexcept;
+
+private:
+    std::once_flag _translations_loaded;
+
+    void load_translations_from_resources() noexcept;
 };
 
 }
\ No newline at end of file
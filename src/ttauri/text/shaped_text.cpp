@@ -6,9 +6,104 @@
 #include "unicode_description.hpp"
 #include "../small_map.hpp"
 #include "../application.hpp"
+#include "../hash.hpp"
+#include "../counters.hpp"
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 namespace tt {
 
+/** The arguments used to shape a string.
+ */
+struct shaped_text_cache_key {
+    gstring text;
+    text_style style;
+    float width;
+    tt::alignment alignment;
+    bool wrap;
+
+    [[nodiscard]] size_t hash() const noexcept
+    {
+        auto r = hash_mix(std::ssize(text), style.family_id, style.size, width, static_cast<int>(alignment), wrap);
+        for (ttlet &grapheme : text) {
+            r = hash_mix_two(r, grapheme.hash());
+        }
+        return r;
+    }
+
+    [[nodiscard]] friend bool operator==(shaped_text_cache_key const &lhs, shaped_text_cache_key const &rhs) noexcept
+    {
+        return lhs.width == rhs.width && lhs.alignment == rhs.alignment && lhs.wrap == rhs.wrap &&
+            lhs.style == rhs.style && lhs.text == rhs.text;
+    }
+};
+
+struct shaped_text_cache_key_hash {
+    [[nodiscard]] size_t operator()(shaped_text_cache_key const &rhs) const noexcept
+    {
+        return rhs.hash();
+    }
+};
+
+/** A process-wide cache of shaped strings.
+ *
+ * Widgets reshape their text each time their layout changes, often with the same text
+ * and width. The least recently used entry is removed when the cache is full.
+ */
+class shaped_text_cache {
+public:
+    static constexpr size_t maximum_nr_entries = 1024;
+
+    [[nodiscard]] std::shared_ptr<shaped_text const> find(shaped_text_cache_key const &key) noexcept
+    {
+        ttlet lock = std::scoped_lock(_mutex);
+
+        ttlet i = _entries.find(key);
+        if (i == _entries.end()) {
+            increment_counter<"shaped_text_cache_miss">();
+            return {};
+        }
+
+        // Move the entry to the front of the least-recently-used list.
+        _lru.splice(_lru.begin(), _lru, i->second);
+        increment_counter<"shaped_text_cache_hit">();
+        return i->second->second;
+    }
+
+    void insert(shaped_text_cache_key &&key, shaped_text const &value) noexcept
+    {
+        ttlet lock = std::scoped_lock(_mutex);
+
+        if (ttlet i = _entries.find(key); i != _entries.end()) {
+            i->second->second = std::make_shared<shaped_text const>(value);
+            return;
+        }
+
+        if (_entries.size() >= maximum_nr_entries) {
+            _entries.erase(_lru.back().first);
+            _lru.pop_back();
+        }
+
+        _lru.emplace_front(key, std::make_shared<shaped_text const>(value));
+        _entries.emplace(std::move(key), _lru.begin());
+    }
+
+private:
+    using lru_type = std::list<std::pair<shaped_text_cache_key, std::shared_ptr<shaped_text const>>>;
+
+    std::mutex _mutex;
+
+    /** The entries, the most recently used first.
+     */
+    lru_type _lru;
+
+    std::unordered_map<shaped_text_cache_key, lru_type::iterator, shaped_text_cache_key_hash> _entries;
+};
+
+static shaped_text_cache global_shaped_text_cache;
+
 [[nodiscard]] static std::vector<attributed_grapheme> makeattributed_graphemeVector(gstring const &text, text_style const &style) noexcept
 {
     std::vector<attributed_grapheme> r;
@@ -57,7 +152,7 @@ namespace tt {
     for (auto i = line_start; i != glyphs.end(); ++i) {
         if (i->general_category == unicode_general_category::Zp) {
             // The paragraph separator stays with the line.
-            lines.emplace_back(line_start, i + 1);
+            lines.emplace_back(line_start, i + 1).calculateBreakOpportunities();
             line_start = i + 1;
         }
     }
@@ -68,13 +163,26 @@ namespace tt {
 
 static void wrap_lines(std::vector<attributed_glyph_line> &lines, float width) noexcept
 {
-    for (auto i = lines.begin(); i != lines.end(); ++i) {
-        while (i->shouldWrap(width)) {
-            // Wrap will modify the current line to the maximum width and return
-            // the rest of that line, which we insert here after it.
-            i = lines.insert(i+1, i->wrap(width)); 
+    auto wrapped_lines = std::vector<attributed_glyph_line>{};
+    wrapped_lines.reserve(lines.size());
+
+    for (auto &line : lines) {
+        ttlet positions = line.wrapPositions(width);
+        if (positions.empty()) {
+            wrapped_lines.push_back(std::move(line));
+            continue;
+        }
+
+        auto first = line.begin();
+        for (ttlet position : positions) {
+            ttlet last = line.begin() + position;
+            wrapped_lines.emplace_back(first, last);
+            first = last;
         }
+        wrapped_lines.emplace_back(first, line.end());
     }
+
+    lines = std::move(wrapped_lines);
 }
 
 /** Calculate the size of the text.
@@ -229,6 +337,59 @@ struct shape_text_result {
     std::vector<attributed_glyph_line> lines;
 };
 
+/** Set the logical index and unicode properties of each grapheme.
+ *
+ * @param text The text to update.
+ * @param logicalIndex The logical index of the first grapheme.
+ */
+static void set_grapheme_attributes(std::vector<attributed_grapheme> &text, ssize_t logicalIndex) noexcept
+{
+    for (auto &c: text) {
+        ttlet &description = unicode_description_find(c.grapheme[0]);
+        c.logicalIndex = logicalIndex++;
+        c.bidi_class = description.bidi_class();
+        c.general_category = description.general_category();
+    }
+    tt_axiom(text.back().general_category == unicode_general_category::Zp);
+}
+
+/** Layout lines that were made from whole paragraphs.
+ *
+ * @param lines The unwrapped lines, one for each paragraph.
+ * @param alignment How the text should be horizontally-aligned inside the maximum_width.
+ * @param max_width Maximum width that the text should flow into.
+ * @return preferred size of the text, size of the resulting text, shaped text.
+ */
+[[nodiscard]] static shape_text_result layout_text(
+    std::vector<attributed_glyph_line> lines,
+    float width,
+    alignment alignment,
+    bool wrap) noexcept
+{
+    tt_axiom(std::ssize(lines) >= 1);
+
+    // Calculate actual size of the box, no smaller than the minimum_size.
+    ttlet preferred_extent = ceil(calculate_text_size(lines));
+
+    if (wrap) {
+        wrap_lines(lines, width);
+    }
+
+    // Morph attributed-glyphs using the font's morph algorithm.
+    //morph_glyphs(glyphs);
+
+    // Align the text within the actual box size.
+    position_glyphs(lines, alignment, width);
+
+    ttlet bounding_box = calculate_bounding_box(lines, width);
+
+    return {
+        preferred_extent,
+        bounding_box,
+        std::move(lines)
+    };
+}
+
 /** Shape the text.
 * The given text is in logical-order; the order in which humans write text.
 * The resulting glyphs are in left-to-right display order.
@@ -253,47 +414,46 @@ struct shape_text_result {
     alignment alignment,
     float wrap) noexcept
 {
-    std::vector<attributed_glyph> attributed_glyphs;
-
     // Put graphemes in left-to-right display order using the unicode_data::global's bidi_algorithm.
     //bidi_algorithm(text);
-    ssize_t logicalIndex = 0;
-    for (auto &c: text) {
-        ttlet &description = unicode_description_find(c.grapheme[0]);
-        c.logicalIndex = logicalIndex++;
-        c.bidi_class = description.bidi_class();
-        c.general_category = description.general_category();
-    }
-    tt_axiom(text.back().general_category == unicode_general_category::Zp);
+    set_grapheme_attributes(text, 0);
 
     // Convert attributed-graphemes into attributes-glyphs using font_book's find_glyph algorithm.
     auto glyphs = graphemes_to_glyphs(text);
 
     // Split the text up in lines, based on line-feeds and line-wrapping.
-    auto lines = make_lines(std::move(glyphs));
-
-    // Calculate actual size of the box, no smaller than the minimum_size.
-    ttlet preferred_extent = ceil(calculate_text_size(lines));
-
-    if (wrap) {
-        wrap_lines(lines, width);
-    }
-
-    // Morph attributed-glyphs using the font's morph algorithm.
-    //morph_glyphs(glyphs);
-
-    // Align the text within the actual box size.
-    position_glyphs(lines, alignment, width);
-
-    ttlet bounding_box = calculate_bounding_box(lines, width);
+    return layout_text(make_lines(std::move(glyphs)), width, alignment, wrap);
+}
 
-    return {
-        preferred_extent,
-        bounding_box,
-        lines
-    };
+[[nodiscard]] attributed_glyph_line shaped_text::shape_paragraph(
+    std::vector<attributed_grapheme> paragraph,
+    ssize_t logicalIndex) noexcept
+{
+    set_grapheme_attributes(paragraph, logicalIndex);
+    tt_axiom(std::none_of(paragraph.cbegin(), paragraph.cend() - 1, [](ttlet &c) {
+        return c.general_category == unicode_general_category::Zp;
+    }));
+
+    auto glyphs = graphemes_to_glyphs(paragraph);
+    auto r = attributed_glyph_line(glyphs.begin(), glyphs.end());
+    r.calculateBreakOpportunities();
+    return r;
 }
 
+shaped_text::shaped_text(
+    std::vector<attributed_glyph_line> paragraphs,
+    float width,
+    tt::alignment alignment,
+    bool wrap
+) noexcept :
+    alignment(alignment),
+    width(width)
+{
+    auto result = layout_text(std::move(paragraphs), width, alignment, wrap);
+    _preferred_extent = result.preferred_extent;
+    boundingBox = result.boundingBox;
+    lines = std::move(result.lines);
+}
 
 shaped_text::shaped_text(
     std::vector<attributed_grapheme> const &text,
@@ -316,8 +476,17 @@ shaped_text::shaped_text(
     float width,
     tt::alignment alignment,
     bool wrap)
-noexcept :
-    shaped_text(makeattributed_graphemeVector(text, style), width, alignment, wrap) {}
+noexcept
+{
+    auto key = shaped_text_cache_key{text, style, width, alignment, wrap};
+    if (ttlet cached = global_shaped_text_cache.find(key)) {
+        *this = *cached;
+        return;
+    }
+
+    *this = shaped_text(makeattributed_graphemeVector(text, style), width, alignment, wrap);
+    global_shaped_text_cache.insert(std::move(key), *this);
+}
 
 shaped_text::shaped_text(
     std::u8string_view text,
@@ -71,6 +71,22 @@ public:
         bool wrap=true
     ) noexcept;
 
+    /** Create shaped text from paragraphs that were shaped with `shape_paragraph()`.
+     * This function is used to reuse the glyphs of paragraphs that did not change
+     * while editing text.
+     *
+     * @param paragraphs The lines of glyphs, one for each paragraph, in logical order.
+     * @param width The width into which the text is horizontally aligned.
+     * @param alignment The alignment of the text within the extent.
+     * @param wrap True when text should be wrapped to fit inside the given width.
+     */
+    shaped_text(
+        std::vector<attributed_glyph_line> paragraphs,
+        float width,
+        tt::alignment const alignment=alignment::middle_center,
+        bool wrap=true
+    ) noexcept;
+
     /** Create shaped text from a string.
      * This function is mostly used for drawing label text.
      *
@@ -105,6 +121,18 @@ public:
         bool wrap=true
     ) noexcept;
 
+    /** Convert a single paragraph into a line of glyphs.
+     * The line is not wrapped or positioned, which is done when the paragraphs
+     * are passed to the shaped_text constructor.
+     *
+     * @param paragraph The text of the paragraph, ending in a paragraph separator.
+     * @param logicalIndex The logical index of the first grapheme of the paragraph.
+     * @return A line with the glyphs of the paragraph.
+     */
+    [[nodiscard]] static attributed_glyph_line shape_paragraph(
+        std::vector<attributed_grapheme> paragraph,
+        ssize_t logicalIndex) noexcept;
+
     [[nodiscard]] size_t size() const noexcept {
         ssize_t count = 0;
         for (ttlet &line: lines) {
@@ -0,0 +1,49 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/text/shaped_text.hpp"
+#include "ttauri/text/font_book.hpp"
+#include "ttauri/URL.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace std;
+using namespace tt;
+
+/** Load the system fonts once for all the shaped_text benchmarks.
+ * @return false if no fonts could be loaded.
+ */
+[[nodiscard]] static bool init_shaped_text_bench_fonts() noexcept
+{
+    static ttlet r = [] {
+        try {
+            font_book::global = std::make_unique<font_book>(
+                std::vector<URL>{URL::urlFromSystemfontDirectory()}, URL::urlFromApplicationDataDirectory() / "font_index.bon8");
+            return true;
+        } catch (...) {
+            return false;
+        }
+    }();
+    return r;
+}
+
+static void shaped_text_paragraph(benchmark::State &state)
+{
+    if (not init_shaped_text_bench_fonts()) {
+        state.SkipWithError("Could not load the system fonts.");
+        return;
+    }
+
+    auto text = std::u8string{};
+    while (text.size() < narrow_cast<size_t>(state.range(0))) {
+        text += u8"The quick brown fox jumps over the lazy dog. ";
+    }
+    ttlet style = text_style("Noto Sans", font_variant{}, 14.0f, color{1.0f, 1.0f, 1.0f}, text_decoration::None);
+
+    for (auto _ : state) {
+        ttlet shaped = shaped_text(text, style, 400.0f, alignment::top_left, true);
+        benchmark::DoNotOptimize(shaped.size());
+    }
+    state.SetItemsProcessed(state.iterations() * std::ssize(text));
+}
+BENCHMARK(shaped_text_paragraph)->Arg(64)->Arg(4096);
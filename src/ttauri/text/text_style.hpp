@@ -8,8 +8,11 @@
 #include "text_decoration.hpp"
 #include "font_family_id.hpp"
 #include "../color/color.hpp"
+#include "../hash.hpp"
 #include <fmt/format.h>
 #include <ostream>
+#include <array>
+#include <bit>
 
 namespace tt {
 
@@ -41,6 +44,27 @@ struct text_style {
     text_style &operator=(text_style const &) noexcept = default;
     text_style &operator=(text_style &&) noexcept = default;
 
+    [[nodiscard]] friend bool operator==(text_style const &lhs, text_style const &rhs) noexcept {
+        return lhs.family_id == rhs.family_id && lhs.variant.weight() == rhs.variant.weight() &&
+            lhs.variant.italic() == rhs.variant.italic() && lhs.size == rhs.size && lhs.color == rhs.color &&
+            lhs.decoration == rhs.decoration;
+    }
+
+    /** Hash the members that are compared by `operator==`.
+     */
+    [[nodiscard]] size_t hash() const noexcept {
+        // Adding zero turns -0.0 into 0.0, as they compare equal.
+        ttlet key = std::array<uint32_t, 7>{
+            static_cast<uint32_t>(std::hash<font_family_id>{}(family_id)),
+            static_cast<uint32_t>(variant.weight()) | (variant.italic() ? 0x100 : 0) | (static_cast<uint32_t>(decoration) << 16),
+            std::bit_cast<uint32_t>(size + 0.0f),
+            std::bit_cast<uint32_t>(color.r() + 0.0f),
+            std::bit_cast<uint32_t>(color.g() + 0.0f),
+            std::bit_cast<uint32_t>(color.b() + 0.0f),
+            std::bit_cast<uint32_t>(color.a() + 0.0f)};
+        return hash_bytes(key.data(), sizeof(key));
+    }
+
     float scaled_size() const noexcept {
         return size * dpi_scale;
     }
@@ -60,3 +84,15 @@ struct text_style {
 };
 
 }
+
+namespace std {
+
+template<>
+struct hash<tt::text_style> {
+    [[nodiscard]] size_t operator()(tt::text_style const &rhs) const noexcept
+    {
+        return rhs.hash();
+    }
+};
+
+} // namespace std
@@ -5,6 +5,7 @@
 
 #include "translation.hpp"
 #include "po_parser.hpp"
+#include "translation_catalog.hpp"
 
 namespace tt {
 
@@ -43,16 +44,29 @@ std::unordered_map<translation_key,std::vector<std::u8string>> translations;
 
 [[nodiscard]] std::u8string_view get_translation(
     std::u8string_view msgid,
+    uint32_t msgid_hash,
     long long n,
     std::vector<language*> const &languages
 ) noexcept {
+    for (auto *language : languages) {
+        language->load_translations();
+
+        for (ttlet &catalog : language->catalogs) {
+            if (ttlet plural_forms = catalog.find(msgid, msgid_hash); not plural_forms.empty()) {
+                ttlet plurality = language->plurality(n, plural_forms.size());
+                ttlet translation = plural_forms[plurality];
+                if (translation.size() != 0) {
+                    return translation;
+                }
+            }
+        }
 
-    auto key = translation_key{msgid};
-
-    for (ttlet *language : languages) {
-        key.language = language;
+        // Most applications only use catalogs, so the message-id is not copied into a key.
+        if (translations.empty()) {
+            continue;
+        }
 
-        ttlet i = translations.find(key);
+        ttlet i = translations.find(translation_key{msgid, language});
         if (i != translations.cend()) {
             ttlet plurality = language->plurality(n, std::ssize(i->second));
             ttlet &translation = i->second[plurality];
@@ -65,6 +79,14 @@ std::unordered_map<translation_key,std::vector<std::u8string>> translations;
     return msgid;
 }
 
+[[nodiscard]] std::u8string_view get_translation(
+    std::u8string_view msgid,
+    long long n,
+    std::vector<language*> const &languages
+) noexcept {
+    return get_translation(msgid, translation_catalog::hash(msgid), n, languages);
+}
+
 void add_translation(
     std::u8string_view msgid,
     language const &language,
@@ -83,16 +105,14 @@ void add_translation(
     add_translation(msgid, language, plural_forms);
 }
 
-void add_translation(po_translations const &po_translations, language const &language) noexcept
+void add_translation(po_translations const &po_translations, language &language) noexcept
 {
-    for (ttlet &translation : po_translations.translations) {
-        auto msgid = std::ssize(translation.msgctxt) == 0 ? translation.msgid : translation.msgctxt + u8'|' + translation.msgid;
-        add_translation(
-            msgid,
-            language,
-            translation.msgstr
-        );
-    }
+    add_translation(translation_catalog(make_translation_catalog(po_translations)), language);
+}
+
+void add_translation(translation_catalog catalog, language &language) noexcept
+{
+    language.catalogs.push_back(std::move(catalog));
 }
 
 }
@@ -11,9 +11,26 @@
 #include <string_view>
 #include <vector>
 #include <unordered_map>
+#include <cstdint>
 
 namespace tt {
 
+/** Get the translation of a message.
+ * The translations of each language are loaded on the first lookup in that language.
+ *
+ * @param msgid The message-id, prefixed with the message-context and a '|' when available.
+ * @param msgid_hash The hash of the message-id, see `translation_catalog::hash()`.
+ * @param n The number used to select the plural form.
+ * @param languages The languages to search, in order.
+ * @return The translation, or the message-id when no translation was found.
+ */
+[[nodiscard]] std::u8string_view get_translation(
+    std::u8string_view msgid,
+    uint32_t msgid_hash,
+    long long n,
+    std::vector<language*> const &languages
+) noexcept;
+
 [[nodiscard]] std::u8string_view get_translation(
     std::u8string_view msgid,
     long long n=0,
@@ -33,6 +50,17 @@ void add_translation(
 ) noexcept;
 
 struct po_translations;
-void add_translation(po_translations const &translations, language const &language) noexcept;
+
+/** Add the translations of a .po file for a language.
+ * The translations are compiled into a catalog, see `make_translation_catalog()`.
+ */
+void add_translation(po_translations const &translations, language &language) noexcept;
+
+class translation_catalog;
+
+/** Add a compiled catalog of translations for a language.
+ * Translations are looked up in the catalogs before the translations added for single message-ids.
+ */
+void add_translation(translation_catalog catalog, language &language) noexcept;
 
 }
@@ -0,0 +1,236 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "translation_catalog.hpp"
+#include "po_parser.hpp"
+#include "../endian.hpp"
+#include "../placement.hpp"
+#include "../strings.hpp"
+#include "../check.hpp"
+#include <unordered_map>
+#include <bit>
+#include <cstring>
+
+namespace tt {
+
+struct translation_catalog_header {
+    little_uint32_buf_t magic;
+    little_uint32_buf_t version;
+    little_uint32_buf_t nr_entries;
+    little_uint32_buf_t nr_buckets;
+    little_uint32_buf_t nr_forms;
+};
+
+struct translation_catalog_entry {
+    little_uint32_buf_t hash;
+    little_uint32_buf_t msgid_offset;
+    little_uint32_buf_t msgid_size;
+    little_uint32_buf_t forms_index;
+    little_uint32_buf_t nr_forms;
+};
+
+struct translation_catalog_form {
+    little_uint32_buf_t offset;
+    little_uint32_buf_t size;
+};
+
+constexpr uint32_t translation_catalog_magic = fourcc("tcat");
+
+[[nodiscard]] std::u8string_view translation_catalog::plural_forms::operator[](ssize_t index) const noexcept
+{
+    tt_axiom(index >= 0 && index < _size);
+
+    ttlet forms = unsafe_make_placement_array<translation_catalog_form>(
+        _catalog->_bytes, ssize_t{_catalog->_forms_offset}, _catalog->_nr_forms);
+    ttlet &form = forms[_first + index];
+    return _catalog->get_string(form.offset.value(), form.size.value());
+}
+
+translation_catalog::translation_catalog(std::unique_ptr<resource_view> view) : _view(std::move(view))
+{
+    _bytes = _view->bytes();
+    parse();
+}
+
+translation_catalog::translation_catalog(std::span<std::byte const> bytes) : _view(), _bytes(bytes)
+{
+    parse();
+}
+
+translation_catalog::translation_catalog(std::vector<std::byte> bytes) : _view(), _storage(std::move(bytes))
+{
+    _bytes = _storage;
+    parse();
+}
+
+void translation_catalog::parse()
+{
+    ssize_t offset = 0;
+
+    ttlet header = make_placement_ptr<translation_catalog_header>(_bytes, offset);
+    tt_parse_check(header->magic.value() == translation_catalog_magic, "Not a translation catalog");
+    tt_parse_check(header->version.value() == version, "Translation catalog has a different version");
+
+    _nr_entries = header->nr_entries.value();
+    _nr_buckets = header->nr_buckets.value();
+    _nr_forms = header->nr_forms.value();
+    tt_parse_check(std::has_single_bit(static_cast<uint32_t>(_nr_buckets)), "Number of buckets must be a power of two");
+    tt_parse_check(_nr_entries < _nr_buckets, "Translation catalog needs at least one empty bucket");
+
+    _buckets_offset = offset;
+    ttlet buckets = make_placement_array<little_uint32_buf_t>(_bytes, offset, _nr_buckets);
+    for (ttlet &bucket : buckets) {
+        tt_parse_check(bucket.value() <= _nr_entries, "Bucket refers to an entry beyond the end of the catalog");
+    }
+
+    _entries_offset = offset;
+    ttlet entries = make_placement_array<translation_catalog_entry>(_bytes, offset, _nr_entries);
+
+    _forms_offset = offset;
+    ttlet forms = make_placement_array<translation_catalog_form>(_bytes, offset, _nr_forms);
+
+    for (ttlet &entry : entries) {
+        tt_parse_check(
+            static_cast<ssize_t>(entry.msgid_offset.value()) + entry.msgid_size.value() <= std::ssize(_bytes),
+            "Message-id extends beyond end of catalog");
+        tt_parse_check(
+            static_cast<ssize_t>(entry.forms_index.value()) + entry.nr_forms.value() <= _nr_forms,
+            "Plural forms extend beyond end of catalog");
+    }
+
+    for (ttlet &form : forms) {
+        tt_parse_check(
+            static_cast<ssize_t>(form.offset.value()) + form.size.value() <= std::ssize(_bytes),
+            "Translation extends beyond end of catalog");
+    }
+}
+
+[[nodiscard]] std::u8string_view translation_catalog::get_string(ssize_t offset, ssize_t size) const noexcept
+{
+    return {reinterpret_cast<char8_t const *>(_bytes.data() + offset), narrow_cast<size_t>(size)};
+}
+
+[[nodiscard]] translation_catalog::plural_forms
+translation_catalog::find(std::u8string_view msgid, uint32_t msgid_hash) const noexcept
+{
+    tt_axiom(msgid_hash == hash(msgid));
+
+    ttlet buckets = unsafe_make_placement_array<little_uint32_buf_t>(_bytes, ssize_t{_buckets_offset}, _nr_buckets);
+    ttlet entries = unsafe_make_placement_array<translation_catalog_entry>(_bytes, ssize_t{_entries_offset}, _nr_entries);
+
+    ttlet h = msgid_hash;
+    ttlet mask = static_cast<uint32_t>(_nr_buckets - 1);
+
+    // There is always an empty bucket, which ends the linear probing.
+    for (auto i = h & mask; true; i = (i + 1) & mask) {
+        ttlet entry_nr = buckets[i].value();
+        if (entry_nr == 0) {
+            return {};
+        }
+
+        ttlet &entry = entries[entry_nr - 1];
+        if (entry.hash.value() == h && get_string(entry.msgid_offset.value(), entry.msgid_size.value()) == msgid) {
+            return {this, entry.forms_index.value(), entry.nr_forms.value()};
+        }
+    }
+}
+
+[[nodiscard]] std::vector<std::byte> make_translation_catalog(po_translations const &translations) noexcept
+{
+    // Later translations of the same message-id replace earlier ones, like add_translation().
+    auto msgids = std::vector<std::u8string>{};
+    auto msgstrs = std::vector<std::vector<std::u8string> const *>{};
+    auto indices = std::unordered_map<std::u8string, size_t>{};
+    for (ttlet &translation : translations.translations) {
+        if (translation.msgid.empty()) {
+            continue;
+        }
+
+        auto msgid = translation.msgctxt.empty() ? translation.msgid : translation.msgctxt + u8'|' + translation.msgid;
+        if (ttlet i = indices.find(msgid); i != indices.end()) {
+            msgstrs[i->second] = &translation.msgstr;
+        } else {
+            indices.emplace(msgid, msgids.size());
+            msgids.push_back(std::move(msgid));
+            msgstrs.push_back(&translation.msgstr);
+        }
+    }
+
+    ttlet nr_entries = msgids.size();
+    // Keep the load factor at or below 50%, which also guarantees an empty bucket.
+    ttlet nr_buckets = std::bit_ceil(nr_entries * 2 + 1);
+    auto nr_forms = size_t{0};
+    for (ttlet *msgstr : msgstrs) {
+        nr_forms += msgstr->size();
+    }
+
+    ttlet buckets_offset = sizeof(translation_catalog_header);
+    ttlet entries_offset = buckets_offset + nr_buckets * sizeof(little_uint32_buf_t);
+    ttlet forms_offset = entries_offset + nr_entries * sizeof(translation_catalog_entry);
+    ttlet strings_offset = forms_offset + nr_forms * sizeof(translation_catalog_form);
+
+    auto strings_size = size_t{0};
+    for (size_t i = 0; i != nr_entries; ++i) {
+        strings_size += msgids[i].size();
+        for (ttlet &form : *msgstrs[i]) {
+            strings_size += form.size();
+        }
+    }
+
+    auto r = std::vector<std::byte>(strings_offset + strings_size);
+    auto bytes = std::span{r};
+
+    ttlet header = unsafe_make_placement_ptr<translation_catalog_header>(bytes);
+    header->magic = translation_catalog_magic;
+    header->version = translation_catalog::version;
+    header->nr_entries = narrow_cast<uint32_t>(nr_entries);
+    header->nr_buckets = narrow_cast<uint32_t>(nr_buckets);
+    header->nr_forms = narrow_cast<uint32_t>(nr_forms);
+
+    ttlet buckets = unsafe_make_placement_array<little_uint32_buf_t>(bytes, narrow_cast<ssize_t>(buckets_offset), nr_buckets);
+    ttlet entries =
+        unsafe_make_placement_array<translation_catalog_entry>(bytes, narrow_cast<ssize_t>(entries_offset), nr_entries);
+    ttlet forms = unsafe_make_placement_array<translation_catalog_form>(bytes, narrow_cast<ssize_t>(forms_offset), nr_forms);
+
+    for (auto &bucket : buckets) {
+        bucket = 0;
+    }
+
+    auto string_offset = strings_offset;
+    auto add_string = [&](std::u8string const &str) {
+        ttlet offset = string_offset;
+        std::memcpy(r.data() + offset, str.data(), str.size());
+        string_offset += str.size();
+        return narrow_cast<uint32_t>(offset);
+    };
+
+    auto form_index = size_t{0};
+    for (size_t i = 0; i != nr_entries; ++i) {
+        ttlet h = translation_catalog::hash(msgids[i]);
+
+        auto &entry = entries[i];
+        entry.hash = h;
+        entry.msgid_offset = add_string(msgids[i]);
+        entry.msgid_size = narrow_cast<uint32_t>(msgids[i].size());
+        entry.forms_index = narrow_cast<uint32_t>(form_index);
+        entry.nr_forms = narrow_cast<uint32_t>(msgstrs[i]->size());
+
+        for (ttlet &msgstr : *msgstrs[i]) {
+            auto &form = forms[form_index++];
+            form.offset = add_string(msgstr);
+            form.size = narrow_cast<uint32_t>(msgstr.size());
+        }
+
+        ttlet mask = nr_buckets - 1;
+        auto j = h & mask;
+        while (buckets[j].value() != 0) {
+            j = (j + 1) & mask;
+        }
+        buckets[j] = narrow_cast<uint32_t>(i + 1);
+    }
+
+    return r;
+}
+
+} // namespace tt
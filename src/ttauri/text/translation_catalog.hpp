@@ -0,0 +1,162 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../resource_view.hpp"
+#include "../required.hpp"
+#include <span>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+namespace tt {
+
+struct po_translations;
+
+/** A compiled catalog of translations for a single language.
+ *
+ * The catalog is compiled from a gettext .po file at build time by the `compile_translation_catalog`
+ * tool. Translations are looked up through a hash table stored in the catalog itself, directly
+ * from the memory mapping of the file or static resource; nothing is copied when the catalog is loaded.
+ *
+ * The format of the catalog, with all integers as little-endian 32 bit values:
+ *  - header: magic "tcat", version, number of entries, number of buckets, number of plural forms.
+ *  - buckets: for each bucket the index of the entry plus one, or zero when the bucket is empty.
+ *  - entries: hash of the message-id, offset and size of the message-id, index of the first
+ *    plural form and the number of plural forms.
+ *  - plural forms: offset and size of each translated string.
+ *  - strings: UTF-8 strings, not nul-terminated.
+ */
+class translation_catalog {
+public:
+    static constexpr uint32_t version = 1;
+
+    /** The plural forms of a translation.
+     */
+    class plural_forms {
+    public:
+        plural_forms() noexcept : _catalog(nullptr), _first(0), _size(0) {}
+
+        [[nodiscard]] ssize_t size() const noexcept
+        {
+            return _size;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return _size == 0;
+        }
+
+        [[nodiscard]] std::u8string_view operator[](ssize_t index) const noexcept;
+
+    private:
+        translation_catalog const *_catalog;
+        ssize_t _first;
+        ssize_t _size;
+
+        plural_forms(translation_catalog const *catalog, ssize_t first, ssize_t size) noexcept :
+            _catalog(catalog), _first(first), _size(size)
+        {
+        }
+
+        friend translation_catalog;
+    };
+
+    translation_catalog(translation_catalog const &) = delete;
+    translation_catalog(translation_catalog &&) noexcept = default;
+    translation_catalog &operator=(translation_catalog const &) = delete;
+    translation_catalog &operator=(translation_catalog &&) noexcept = default;
+    ~translation_catalog() = default;
+
+    /** Open a catalog from a file or static resource.
+     *
+     * @param view The memory mapping of the catalog.
+     * @throw parse_error When the catalog is invalid.
+     */
+    translation_catalog(std::unique_ptr<resource_view> view);
+
+    /** Open a catalog from bytes in memory.
+     *
+     * @param bytes The catalog, which must outlive this object.
+     * @throw parse_error When the catalog is invalid.
+     */
+    translation_catalog(std::span<std::byte const> bytes);
+
+    /** Open a catalog from bytes in memory, owned by the catalog.
+     * Used for catalogs compiled at run time with `make_translation_catalog()`.
+     *
+     * @param bytes The catalog.
+     * @throw parse_error When the catalog is invalid.
+     */
+    translation_catalog(std::vector<std::byte> bytes);
+
+    /** The number of translations in the catalog.
+     */
+    [[nodiscard]] ssize_t size() const noexcept
+    {
+        return _nr_entries;
+    }
+
+    /** Find a translation.
+     *
+     * @param msgid The message-id, prefixed with the message-context and a '|' when available.
+     * @return The plural forms of the translation, or empty when the message-id was not found.
+     */
+    [[nodiscard]] plural_forms find(std::u8string_view msgid) const noexcept
+    {
+        return find(msgid, hash(msgid));
+    }
+
+    /** Find a translation.
+     *
+     * @param msgid The message-id, prefixed with the message-context and a '|' when available.
+     * @param msgid_hash The hash of the message-id, as returned by `hash()`.
+     * @return The plural forms of the translation, or empty when the message-id was not found.
+     */
+    [[nodiscard]] plural_forms find(std::u8string_view msgid, uint32_t msgid_hash) const noexcept;
+
+    /** The hash used for the index of a catalog.
+     * The hash is constexpr, so that the hash of a message-id in the source code can be calculated
+     * by the compiler.
+     */
+    [[nodiscard]] static constexpr uint32_t hash(std::u8string_view str) noexcept
+    {
+        // FNV-1a, which gives the same hash when compiling the catalog and when loading it.
+        auto r = uint32_t{0x811c'9dc5};
+        for (ttlet c : str) {
+            r ^= static_cast<uint8_t>(c);
+            r *= uint32_t{0x0100'0193};
+        }
+        return r;
+    }
+
+private:
+    std::unique_ptr<resource_view> _view;
+    std::vector<std::byte> _storage;
+    std::span<std::byte const> _bytes;
+
+    ssize_t _nr_entries;
+    ssize_t _nr_buckets;
+    ssize_t _nr_forms;
+
+    ssize_t _buckets_offset;
+    ssize_t _entries_offset;
+    ssize_t _forms_offset;
+
+    void parse();
+
+    [[nodiscard]] std::u8string_view get_string(ssize_t offset, ssize_t size) const noexcept;
+};
+
+/** Compile translations into a catalog.
+ *
+ * @param translations The translations parsed from a .po file.
+ * @return The bytes of the catalog.
+ */
+[[nodiscard]] std::vector<std::byte> make_translation_catalog(po_translations const &translations) noexcept;
+
+} // namespace tt
@@ -0,0 +1,82 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/text/translation_catalog.hpp"
+#include "ttauri/text/po_parser.hpp"
+#include "ttauri/exception.hpp"
+#include <gtest/gtest.h>
+#include <string>
+
+[[nodiscard]] static tt::po_translations make_test_translations()
+{
+    auto r = tt::po_translations{};
+    r.translations.push_back({u8"", u8"Hello", u8"", {u8"Hallo"}});
+    r.translations.push_back({u8"", u8"{} file", u8"{} files", {u8"{} bestand", u8"{} bestanden"}});
+    r.translations.push_back({u8"menu", u8"Open", u8"", {u8"Openen"}});
+    r.translations.push_back({u8"", u8"Open", u8"", {u8"Open"}});
+    r.translations.push_back({u8"", u8"Hello", u8"", {u8"Hoi"}});
+    return r;
+}
+
+TEST(translation_catalog, find)
+{
+    ttlet bytes = tt::make_translation_catalog(make_test_translations());
+    ttlet catalog = tt::translation_catalog(std::span{bytes});
+
+    ASSERT_EQ(catalog.size(), 4);
+
+    // The last translation of the same message-id is used.
+    ttlet hello = catalog.find(u8"Hello");
+    ASSERT_EQ(hello.size(), 1);
+    ASSERT_TRUE(hello[0] == u8"Hoi");
+
+    ttlet files = catalog.find(u8"{} file");
+    ASSERT_EQ(files.size(), 2);
+    ASSERT_TRUE(files[0] == u8"{} bestand");
+    ASSERT_TRUE(files[1] == u8"{} bestanden");
+
+    ttlet menu_open = catalog.find(u8"menu|Open");
+    ASSERT_EQ(menu_open.size(), 1);
+    ASSERT_TRUE(menu_open[0] == u8"Openen");
+
+    ASSERT_TRUE(catalog.find(u8"Goodbye").empty());
+    ASSERT_TRUE(catalog.find(u8"").empty());
+}
+
+TEST(translation_catalog, empty)
+{
+    ttlet bytes = tt::make_translation_catalog(tt::po_translations{});
+    ttlet catalog = tt::translation_catalog(std::span{bytes});
+
+    ASSERT_EQ(catalog.size(), 0);
+    ASSERT_TRUE(catalog.find(u8"Hello").empty());
+}
+
+TEST(translation_catalog, corrupt)
+{
+    auto bytes = tt::make_translation_catalog(make_test_translations());
+
+    auto truncated = std::vector<std::byte>(bytes.begin(), bytes.begin() + bytes.size() / 2);
+    ASSERT_THROW(tt::translation_catalog(std::span<std::byte const>{truncated}), tt::parse_error);
+
+    bytes[0] = std::byte{'x'};
+    ASSERT_THROW(tt::translation_catalog(std::span<std::byte const>{bytes}), tt::parse_error);
+}
+
+TEST(translation_catalog, owned_bytes)
+{
+    // The hash of a message-id can be calculated by the compiler.
+    constexpr auto hello_hash = tt::translation_catalog::hash(u8"Hello");
+    static_assert(hello_hash == tt::translation_catalog::hash(u8"Hello"));
+
+    auto catalog = tt::translation_catalog(tt::make_translation_catalog(make_test_translations()));
+
+    // The bytes are owned by the catalog, which may be moved.
+    ttlet moved = std::move(catalog);
+    ASSERT_EQ(moved.size(), 4);
+
+    ttlet hello = moved.find(u8"Hello", hello_hash);
+    ASSERT_EQ(hello.size(), 1);
+    ASSERT_TRUE(hello[0] == u8"Hoi");
+}
@@ -10,6 +10,7 @@
 #include "../logger.hpp"
 #include "../geometry/vector.hpp"
 #include "../geometry/point.hpp"
+#include <algorithm>
 #include <cstddef>
 
 
@@ -251,6 +252,150 @@ static glyph_id searchCharacterMapFormat12(std::span<std::byte const> bytes, cha
     return r;
 }
 
+void true_type_font::decoded_character_map::add(char32_t c, uint16_t glyph_index) noexcept
+{
+    if (not range_ends.empty() and range_ends.back() + 1 == c and
+        range_glyph_ids.back() + (range_ends.back() - range_starts.back()) + 1 == glyph_index) {
+        // Extend the last range.
+        range_ends.back() = c;
+    } else {
+        add(c, c, glyph_index);
+    }
+}
+
+void true_type_font::decoded_character_map::add(char32_t first, char32_t last, uint16_t first_glyph_index) noexcept
+{
+    if (not range_ends.empty() and first <= range_ends.back()) {
+        // Ranges must be sorted and not overlap, ignore a malformed range.
+        return;
+    }
+    range_ends.push_back(last);
+    range_starts.push_back(first);
+    range_glyph_ids.push_back(first_glyph_index);
+}
+
+[[nodiscard]] glyph_id true_type_font::decoded_character_map::find(char32_t c) const noexcept
+{
+    ttlet i = std::lower_bound(range_ends.cbegin(), range_ends.cend(), c);
+    if (i == range_ends.cend()) {
+        return {};
+    }
+
+    ttlet index = std::distance(range_ends.cbegin(), i);
+    ttlet first = range_starts[index];
+    if (c < first) {
+        return {};
+    }
+    return glyph_id{narrow_cast<uint16_t>(range_glyph_ids[index] + (c - first))};
+}
+
+static void decodeCharacterMapFormat4(std::span<std::byte const> bytes, auto &r) noexcept
+{
+    ssize_t offset = 0;
+
+    assert_or_return(check_placement_ptr<CMAPFormat4>(bytes, offset), );
+    ttlet header = unsafe_make_placement_ptr<CMAPFormat4>(bytes, offset);
+
+    ttlet length = header->length.value();
+    assert_or_return(length <= bytes.size(), );
+
+    ttlet segCount = header->segCountX2.value() / 2;
+
+    assert_or_return(check_placement_array<big_uint16_buf_t>(bytes, offset, segCount), );
+    ttlet endCode = unsafe_make_placement_array<big_uint16_buf_t>(bytes, offset, segCount);
+
+    offset += ssizeof(uint16_t); // reservedPad
+
+    assert_or_return(check_placement_array<big_uint16_buf_t>(bytes, offset, segCount), );
+    ttlet startCode = unsafe_make_placement_array<big_uint16_buf_t>(bytes, offset, segCount);
+
+    assert_or_return(check_placement_array<big_uint16_buf_t>(bytes, offset, segCount), );
+    ttlet idDelta = unsafe_make_placement_array<big_uint16_buf_t>(bytes, offset, segCount);
+
+    ttlet idRangeOffset_count = (length - offset) / ssizeof(uint16_t);
+    assert_or_return(check_placement_array<big_uint16_buf_t>(bytes, offset, idRangeOffset_count), );
+    ttlet idRangeOffset = unsafe_make_placement_array<big_uint16_buf_t>(bytes, offset, idRangeOffset_count);
+
+    for (uint16_t i = 0; i < segCount; i++) {
+        ttlet startCode_ = char32_t{startCode[i].value()};
+        ttlet endCode_ = char32_t{endCode[i].value()};
+        ttlet idRangeOffset_ = idRangeOffset[i].value();
+
+        for (auto c = startCode_; c <= endCode_; ++c) {
+            // Use modulo 65536 arithmetic.
+            uint16_t glyphIndex = idDelta[i].value();
+            if (idRangeOffset_ == 0) {
+                glyphIndex += static_cast<uint16_t>(c);
+
+            } else {
+                ttlet glyphOffset = (idRangeOffset_ / 2) + (c - startCode_) + i;
+                if (glyphOffset >= idRangeOffset.size() or idRangeOffset[glyphOffset].value() == 0) {
+                    continue;
+                }
+                glyphIndex += idRangeOffset[glyphOffset].value();
+            }
+
+            r.add(c, glyphIndex);
+        }
+    }
+}
+
+static void decodeCharacterMapFormat6(std::span<std::byte const> bytes, auto &r) noexcept
+{
+    ssize_t offset = 0;
+
+    assert_or_return(check_placement_ptr<CMAPFormat6>(bytes, offset), );
+    ttlet header = unsafe_make_placement_ptr<CMAPFormat6>(bytes, offset);
+
+    ttlet firstCode = static_cast<char32_t>(header->firstCode.value());
+    ttlet entryCount = header->entryCount.value();
+
+    assert_or_return(check_placement_array<big_uint16_buf_t>(bytes, offset, entryCount), );
+    ttlet glyphIndexArray = unsafe_make_placement_array<big_uint16_buf_t>(bytes, offset, entryCount);
+
+    for (uint16_t i = 0; i != entryCount; ++i) {
+        r.add(firstCode + i, glyphIndexArray[i].value());
+    }
+}
+
+static void decodeCharacterMapFormat12(std::span<std::byte const> bytes, auto &r) noexcept
+{
+    ssize_t offset = 0;
+
+    assert_or_return(check_placement_ptr<CMAPFormat12>(bytes, offset), );
+    ttlet header = unsafe_make_placement_ptr<CMAPFormat12>(bytes, offset);
+
+    ttlet numGroups = header->numGroups.value();
+
+    assert_or_return(check_placement_array<CMAPFormat12Group>(bytes, offset, numGroups), );
+    ttlet entries = unsafe_make_placement_array<CMAPFormat12Group>(bytes, offset, numGroups);
+
+    for (ttlet &entry : entries) {
+        ttlet startCharCode = static_cast<char32_t>(entry.startCharCode.value());
+        ttlet endCharCode = static_cast<char32_t>(entry.endCharCode.value());
+        ttlet startGlyphIndex = entry.startglyph_id.value();
+        if (endCharCode < startCharCode or startGlyphIndex + (endCharCode - startCharCode) > 0xffff) {
+            continue;
+        }
+        r.add(startCharCode, endCharCode, static_cast<uint16_t>(startGlyphIndex));
+    }
+}
+
+void true_type_font::decodeCharacterMap() const noexcept
+{
+    assert_or_return(check_placement_ptr<big_uint16_buf_t>(cmapBytes), );
+    ttlet format = unsafe_make_placement_ptr<big_uint16_buf_t>(cmapBytes);
+
+    switch (format->value()) {
+    case 4: decodeCharacterMapFormat4(cmapBytes, cmap_decoded); break;
+    case 6: decodeCharacterMapFormat6(cmapBytes, cmap_decoded); break;
+    case 12: decodeCharacterMapFormat12(cmapBytes, cmap_decoded); break;
+    default: return;
+    }
+
+    cmap_is_decoded.store(true, std::memory_order::release);
+}
+
 [[nodiscard]] unicode_ranges true_type_font::parseCharacterMap()
 {
     ttlet format = make_placement_ptr<big_uint16_buf_t>(cmapBytes);
@@ -266,6 +411,19 @@ static glyph_id searchCharacterMapFormat12(std::span<std::byte const> bytes, cha
 
 [[nodiscard]] glyph_id true_type_font::find_glyph(char32_t c) const noexcept
 {
+    if (cmap_is_decoded.load(std::memory_order::acquire)) {
+        return cmap_decoded.find(c);
+    }
+
+    if (cmap_nr_lookups.fetch_add(1, std::memory_order::relaxed) >= cmap_decode_threshold) {
+        std::call_once(cmap_decode_flag, [this] {
+            decodeCharacterMap();
+        });
+        if (cmap_is_decoded.load(std::memory_order::acquire)) {
+            return cmap_decoded.find(c);
+        }
+    }
+
     assert_or_return(check_placement_ptr<big_uint16_buf_t>(cmapBytes), {});
     ttlet format = unsafe_make_placement_ptr<big_uint16_buf_t>(cmapBytes);
 
@@ -875,12 +1033,18 @@ static void getKerningFormat3(
     tt_not_implemented();
 }
 
-[[nodiscard]] static vector2 getKerning(std::span<std::byte const> const &bytes, float unitsPerEm, glyph_id glyph1_id, glyph_id glyph2_id) noexcept
+/** Call a function for each subtable of the kern table.
+ *
+ * @param bytes The bytes of the kern table.
+ * @param function A function `void(std::span<std::byte const> subtable_bytes, uint16_t coverage)`,
+ *                 the subtable bytes start after the subtable header.
+ */
+template<typename Function>
+static void forEachKerningSubtable(std::span<std::byte const> const &bytes, Function const &function) noexcept
 {
-    auto r = vector2{0.0f, 0.0f};
     ssize_t offset = 0;
 
-    assert_or_return(check_placement_ptr<KERNTable_ver0>(bytes, offset), r);
+    assert_or_return(check_placement_ptr<KERNTable_ver0>(bytes, offset), );
     ttlet header_ver0 = unsafe_make_placement_ptr<KERNTable_ver0>(bytes, offset);
     uint32_t version = header_ver0->version.value();
 
@@ -891,9 +1055,9 @@ static void getKerningFormat3(
     } else {
         // Restart with version 1 table.
         offset = 0;
-        assert_or_return(check_placement_ptr<KERNTable_ver1>(bytes, offset), r);
+        assert_or_return(check_placement_ptr<KERNTable_ver1>(bytes, offset), );
         ttlet header_ver1 = unsafe_make_placement_ptr<KERNTable_ver1>(bytes, offset);
-        assert_or_return(header_ver1->version.value() == 0x00010000, r);
+        assert_or_return(header_ver1->version.value() == 0x00010000, );
         nTables = header_ver1->nTables.value();
     }
 
@@ -903,31 +1067,89 @@ static void getKerningFormat3(
         uint16_t coverage = 0;
         uint32_t length = 0;
         if (version == 0x0000) {
-            assert_or_return(check_placement_ptr<KERNSubtable_ver0>(bytes, offset), r);
+            assert_or_return(check_placement_ptr<KERNSubtable_ver0>(bytes, offset), );
             ttlet subheader = unsafe_make_placement_ptr<KERNSubtable_ver0>(bytes, offset);
             coverage = subheader->coverage.value();
             length = subheader->length.value();
 
         } else {
-            assert_or_return(check_placement_ptr<KERNSubtable_ver1>(bytes, offset), r);
+            assert_or_return(check_placement_ptr<KERNSubtable_ver1>(bytes, offset), );
             ttlet subheader = unsafe_make_placement_ptr<KERNSubtable_ver1>(bytes, offset);
             coverage = subheader->coverage.value();
             length = subheader->length.value();
         }
 
+        function(bytes.subspan(offset), coverage);
+
+        offset = subtable_offset + length;
+    }
+}
+
+[[nodiscard]] static vector2 getKerning(std::span<std::byte const> const &bytes, float unitsPerEm, glyph_id glyph1_id, glyph_id glyph2_id) noexcept
+{
+    auto r = vector2{0.0f, 0.0f};
+
+    forEachKerningSubtable(bytes, [&](std::span<std::byte const> subtable_bytes, uint16_t coverage) {
         switch (coverage >> 8) {
         case 0: // Pairs
-            getKerningFormat0(bytes.subspan(offset), coverage, unitsPerEm, glyph1_id, glyph2_id, r);
+            getKerningFormat0(subtable_bytes, coverage, unitsPerEm, glyph1_id, glyph2_id, r);
             break;
         case 3: // Compact 2D kerning values.
-            getKerningFormat3(bytes.subspan(offset), coverage, unitsPerEm, glyph1_id, glyph2_id, r);
+            getKerningFormat3(subtable_bytes, coverage, unitsPerEm, glyph1_id, glyph2_id, r);
             break;
         }
+    });
 
-        offset = subtable_offset + length;
+    return r;
+}
+
+void true_type_font::decodeKerning() const noexcept
+{
+    // Collect the pairs of all the subtables; the kerning of a pair may combine the values of several subtables.
+    auto pairs = std::vector<uint32_t>{};
+    forEachKerningSubtable(kernTableBytes, [&](std::span<std::byte const> subtable_bytes, uint16_t coverage) {
+        if ((coverage >> 8) != 0) {
+            return;
+        }
+
+        ssize_t offset = 0;
+        assert_or_return(check_placement_ptr<KERNFormat0>(subtable_bytes, offset), );
+        ttlet formatheader = unsafe_make_placement_ptr<KERNFormat0>(subtable_bytes, offset);
+        ttlet nPairs = formatheader->nPairs.value();
+
+        assert_or_return(check_placement_array<KERNFormat0_entry>(subtable_bytes, offset, nPairs), );
+        ttlet entries = unsafe_make_placement_array<KERNFormat0_entry>(subtable_bytes, offset, nPairs);
+        for (ttlet &entry : entries) {
+            pairs.push_back(kerning_key(glyph_id{entry.left.value()}, glyph_id{entry.right.value()}));
+        }
+    });
+
+    std::sort(pairs.begin(), pairs.end());
+    pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+    kern_decoded.reserve(pairs.size());
+    for (ttlet key : pairs) {
+        ttlet glyph1_id = glyph_id{narrow_cast<uint16_t>(key >> 16)};
+        ttlet glyph2_id = glyph_id{narrow_cast<uint16_t>(key & 0xffff)};
+        ttlet kerning = getKerning(kernTableBytes, unitsPerEm, glyph1_id, glyph2_id);
+        if (kerning != vector2{}) {
+            kern_decoded.emplace(key, kerning);
+        }
+    }
+}
+
+[[nodiscard]] vector2 true_type_font::findKerning(tt::glyph_id glyph1_id, tt::glyph_id glyph2_id) const noexcept
+{
+    if (kernTableBytes.empty()) {
+        return {};
     }
 
-    return r;
+    std::call_once(kern_decode_flag, [this] {
+        decodeKerning();
+    });
+
+    ttlet i = kern_decoded.find(kerning_key(glyph1_id, glyph2_id));
+    return i != kern_decoded.cend() ? i->second : vector2{};
 }
 
 struct HMTXEntry {
@@ -972,7 +1194,7 @@ bool true_type_font::updateglyph_metrics(
     metrics.capHeight = description.HHeight;
 
     if (kern_glyph1_id && kern_glyph2_id) {
-        metrics.advance += getKerning(kernTableBytes, unitsPerEm, kern_glyph1_id, kern_glyph2_id);
+        metrics.advance += findKerning(kern_glyph1_id, kern_glyph2_id);
     }
 
     return true;
@@ -1210,7 +1432,47 @@ bool true_type_font::loadCompoundGlyph(std::span<std::byte const> glyph_bytes, g
     return true;
 }
 
+bool true_type_font::reserveGlyphCache(size_t size) const noexcept
+{
+    if (glyph_cache_size + size > glyph_cache_maximum_size) {
+        return false;
+    }
+    glyph_cache_size += size;
+    return true;
+}
+
 std::optional<glyph_id> true_type_font::loadGlyph(glyph_id glyph_id, graphic_path &glyph) const noexcept
+{
+    {
+        ttlet lock = std::scoped_lock(glyph_cache_mutex);
+        ttlet i = glyph_outline_cache.find(glyph_id);
+        if (i != glyph_outline_cache.cend()) {
+            glyph += i->second.path;
+            return i->second.metrics_glyph_id;
+        }
+    }
+
+    // Compound glyphs call loadGlyph() recursively, so the cache is not locked while loading.
+    auto outline = glyph_outline{};
+    ttlet metrics_glyph_id = loadGlyphUncached(glyph_id, outline.path);
+    if (not metrics_glyph_id) {
+        return {};
+    }
+    outline.metrics_glyph_id = *metrics_glyph_id;
+    glyph += outline.path;
+
+    ttlet size = sizeof(glyph_outline) + outline.path.points.size() * sizeof(bezier_point) +
+        outline.path.contourEndPoints.size() * sizeof(ssize_t) +
+        outline.path.layerEndContours.size() * sizeof(std::pair<ssize_t, color>);
+
+    ttlet lock = std::scoped_lock(glyph_cache_mutex);
+    if (not glyph_outline_cache.contains(glyph_id) and reserveGlyphCache(size)) {
+        glyph_outline_cache.emplace(glyph_id, std::move(outline));
+    }
+    return metrics_glyph_id;
+}
+
+std::optional<glyph_id> true_type_font::loadGlyphUncached(glyph_id glyph_id, graphic_path &glyph) const noexcept
 {
     assert_or_return(glyph_id >= 0 && glyph_id < numGlyphs, {});
 
@@ -1285,6 +1547,36 @@ bool true_type_font::loadCompoundglyph_metrics(std::span<std::byte const> bytes,
 
 bool true_type_font::loadglyph_metrics(tt::glyph_id glyph_id, glyph_metrics &metrics, tt::glyph_id lookahead_glyph_id)
     const noexcept
+{
+    auto found = false;
+    {
+        ttlet lock = std::scoped_lock(glyph_cache_mutex);
+        ttlet i = glyph_metrics_cache.find(glyph_id);
+        if (i != glyph_metrics_cache.cend()) {
+            metrics = i->second;
+            found = true;
+        }
+    }
+
+    if (not found) {
+        metrics = {};
+        if (not loadglyph_metricsUncached(glyph_id, metrics)) {
+            return false;
+        }
+
+        ttlet lock = std::scoped_lock(glyph_cache_mutex);
+        if (not glyph_metrics_cache.contains(glyph_id) and reserveGlyphCache(sizeof(glyph_id) + sizeof(glyph_metrics))) {
+            glyph_metrics_cache.emplace(glyph_id, metrics);
+        }
+    }
+
+    if (glyph_id && lookahead_glyph_id) {
+        metrics.advance += findKerning(glyph_id, lookahead_glyph_id);
+    }
+    return true;
+}
+
+bool true_type_font::loadglyph_metricsUncached(tt::glyph_id glyph_id, glyph_metrics &metrics) const noexcept
 {
     assert_or_return(glyph_id >= 0 && glyph_id < numGlyphs, false);
 
@@ -1314,7 +1606,7 @@ bool true_type_font::loadglyph_metrics(tt::glyph_id glyph_id, glyph_metrics &met
         // Empty glyph, such as white-space ' '.
     }
 
-    return updateglyph_metrics(metricsGlyphIndex, metrics, glyph_id, lookahead_glyph_id);
+    return updateglyph_metrics(metricsGlyphIndex, metrics);
 }
 
 struct SFNTHeader {
@@ -8,7 +8,12 @@
 #include "../graphic_path.hpp"
 #include "../resource_view.hpp"
 #include "../URL.hpp"
+#include "../geometry/vector.hpp"
 #include <memory>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <unordered_map>
 
 namespace tt {
 
@@ -27,6 +32,38 @@ private:
     /// The bytes of a Unicode character map.
     std::span<std::byte const> cmapBytes;
 
+    /** The character map decoded into sorted ranges of consecutive glyphs.
+     * The arrays are stored separately so that the binary search only touches the end code points.
+     */
+    struct decoded_character_map {
+        /** The last code point of each range, sorted.
+         */
+        std::vector<char32_t> range_ends;
+
+        /** The first code point of each range.
+         */
+        std::vector<char32_t> range_starts;
+
+        /** The glyph of the first code point of each range.
+         * Each next code point in a range maps to the next glyph.
+         */
+        std::vector<uint16_t> range_glyph_ids;
+
+        void add(char32_t c, uint16_t glyph_index) noexcept;
+        void add(char32_t first, char32_t last, uint16_t first_glyph_index) noexcept;
+        [[nodiscard]] tt::glyph_id find(char32_t c) const noexcept;
+    };
+
+    /** The number of lookups in the character map before it is decoded.
+     * A font that is only used for a few characters, such as a fallback font, is searched in place.
+     */
+    static constexpr size_t cmap_decode_threshold = 64;
+
+    mutable std::atomic<size_t> cmap_nr_lookups = 0;
+    mutable std::atomic<bool> cmap_is_decoded = false;
+    mutable std::once_flag cmap_decode_flag;
+    mutable decoded_character_map cmap_decoded;
+
     /// 'glyf' glyph data
     std::span<std::byte const> glyfTableBytes;
 
@@ -65,7 +102,47 @@ private:
     /// 'kern' Kerning tables (optional)
     std::span<std::byte const> kernTableBytes;
 
+    /** The kerning of each pair of glyphs in the 'kern' table, with the values of all subtables combined.
+     * The key is the left glyph in the high 16 bits and the right glyph in the low 16 bits;
+     * pairs without kerning are not included.
+     */
+    mutable std::unordered_map<uint32_t, vector2> kern_decoded;
+    mutable std::once_flag kern_decode_flag;
+
+    /** A glyph outline decoded from the 'glyf' table.
+     */
+    struct glyph_outline {
+        graphic_path path;
+        tt::glyph_id metrics_glyph_id;
+    };
+
+    /** Protects the glyph caches, glyphs may be loaded from multiple threads.
+     */
+    mutable std::mutex glyph_cache_mutex;
+
+    /** Decoded metrics of glyphs, without kerning.
+     */
+    mutable std::unordered_map<tt::glyph_id, glyph_metrics> glyph_metrics_cache;
+
+    /** Decoded outlines of glyphs, including the outlines of compound glyphs.
+     */
+    mutable std::unordered_map<tt::glyph_id, glyph_outline> glyph_outline_cache;
+
+    /** The estimated number of bytes used by the glyph caches.
+     */
+    mutable size_t glyph_cache_size = 0;
+
 public:
+    /** The default maximum number of bytes used by the glyph caches of a single font.
+     */
+    static constexpr size_t default_glyph_cache_maximum_size = 1024 * 1024;
+
+    /** The maximum number of bytes used to cache decoded glyph metrics and outlines.
+     * When the caches are full, glyphs are decoded from the font file on each call.
+     * A value of zero disables the caches.
+     */
+    size_t glyph_cache_maximum_size = default_glyph_cache_maximum_size;
+
     /** Load a true type font.
      * The methods in this class will parse the true-type font at run time.
      * This also means that the bytes passed into this constructor will need to
@@ -109,7 +186,7 @@ public:
     [[nodiscard]] tt::glyph_id find_glyph(char32_t c) const noexcept override;
 
     /** Load a glyph into a path.
-     * The glyph is directly loaded from the font file.
+     * The glyph is loaded from the font file, or from the glyph outline cache.
      *
      * @param glyph_id the index of a glyph inside the font.
      * @param path The path constructed by the loader.
@@ -118,7 +195,9 @@ public:
     std::optional<tt::glyph_id> loadGlyph(tt::glyph_id glyph_id, graphic_path &path) const noexcept override;
 
     /** Load a glyphMetrics into a path.
-    * The glyph is directly loaded from the font file.
+    * The glyph is loaded from the font file, or from the glyph metrics cache.
+    * The kerning against the lookahead glyph is added from the kerning pairs, which are
+    * decoded from the 'kern' table the first time kerning is needed.
     *
     * @param glyph_id the index of a glyph inside the font.
     * @param metrics The metrics constructed by the loader.
@@ -129,6 +208,33 @@ public:
         const noexcept override;
 
 private:
+    /** Load a glyph into a path directly from the font file.
+     */
+    std::optional<tt::glyph_id> loadGlyphUncached(tt::glyph_id glyph_id, graphic_path &path) const noexcept;
+
+    /** Load the metrics of a glyph without kerning directly from the font file.
+     */
+    bool loadglyph_metricsUncached(tt::glyph_id glyph_id, glyph_metrics &metrics) const noexcept;
+
+    [[nodiscard]] static constexpr uint32_t kerning_key(tt::glyph_id glyph1_id, tt::glyph_id glyph2_id) noexcept
+    {
+        return (uint32_t{static_cast<uint16_t>(glyph1_id)} << 16) | uint32_t{static_cast<uint16_t>(glyph2_id)};
+    }
+
+    /** Decode the kerning pairs of the 'kern' table into kern_decoded.
+     */
+    void decodeKerning() const noexcept;
+
+    /** Get the kerning between two glyphs.
+     * @return The adjustment of the advance of the first glyph.
+     */
+    [[nodiscard]] vector2 findKerning(tt::glyph_id glyph1_id, tt::glyph_id glyph2_id) const noexcept;
+
+    /** Add to the size of the glyph caches.
+     * @return true if the item fits within glyph_cache_maximum_size and may be inserted.
+     */
+    bool reserveGlyphCache(size_t size) const noexcept;
+
     /** Parses the directory table of the font file.
      * This function is called by the constructor to set up references
      * inside the file for each table.
@@ -150,6 +256,10 @@ private:
      */
     [[nodiscard]] unicode_ranges parseCharacterMap();
 
+    /** Decode the character map into cmap_decoded.
+     */
+    void decodeCharacterMap() const noexcept;
+
 
     /** Parses the maxp table of the font file.
     * This function is called by parsefontDirectory().
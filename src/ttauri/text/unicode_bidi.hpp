@@ -7,6 +7,8 @@
 
 #include "unicode_bidi_class.hpp"
 #include "unicode_description.hpp"
+#include "../algorithm.hpp"
+#include <algorithm>
 
 namespace tt {
 namespace detail {
@@ -136,6 +138,16 @@ It unicode_bidi(
     SetCodePoint set_code_point,
     detail::unicode_bidi_test_parameters test_parameters = {})
 {
+    // Most text is left-to-right only, which the algorithm would return in the original order.
+    if (test_parameters.force_paragraph_direction != unicode_bidi_class::R) {
+        ttlet LTR_only = std::all_of(first, last, [&get_code_point](auto const &item) {
+            return is_LTR_only(unicode_description_find(get_code_point(item)).bidi_class());
+        });
+        if (LTR_only) {
+            return last;
+        }
+    }
+
     auto proxy = detail::unicode_bidi_char_info_vector{};
     proxy.reserve(std::distance(first, last));
 
@@ -0,0 +1,47 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/text/unicode_bidi.hpp"
+#include <benchmark/benchmark.h>
+#include <string>
+
+using namespace std;
+using namespace tt;
+
+[[nodiscard]] static std::u32string make_bidi_bench_text(bool mixed) noexcept
+{
+    // Latin text, optionally mixed with Hebrew words and digits.
+    ttlet sentence = mixed ? std::u32string{U"The word שלום means peace, 123 עולם. "} :
+                             std::u32string{U"The quick brown fox jumps over the lazy dog. "};
+
+    auto r = std::u32string{};
+    while (r.size() < 1024) {
+        r += sentence;
+    }
+    return r;
+}
+
+static void unicode_bidi_text(benchmark::State &state)
+{
+    ttlet original = make_bidi_bench_text(static_cast<bool>(state.range(0)));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto text = original;
+        state.ResumeTiming();
+
+        auto last = unicode_bidi(
+            std::begin(text),
+            std::end(text),
+            [](ttlet &c) {
+                return c;
+            },
+            [](auto &c, ttlet &code_point) {
+                c = code_point;
+            });
+        benchmark::DoNotOptimize(last);
+    }
+    state.SetItemsProcessed(state.iterations() * std::ssize(original));
+}
+BENCHMARK(unicode_bidi_text)->Arg(0)->Arg(1);
@@ -54,6 +54,17 @@ enum class unicode_bidi_class : uint8_t {
     return is_isolate_starter(rhs) || rhs == PDI;
 }
 
+/** Check if a character keeps the text left-to-right.
+ * When all characters in a paragraph are left-to-right only, the bidi-algorithm resolves all characters
+ * to embedding level 0 and never reorders, mirrors or removes them.
+ */
+[[nodiscard]] constexpr bool is_LTR_only(unicode_bidi_class const &rhs) noexcept
+{
+    using enum unicode_bidi_class;
+    return rhs == L || rhs == EN || rhs == ES || rhs == ET || rhs == CS || rhs == NSM || rhs == B || rhs == S ||
+        rhs == WS || rhs == ON;
+}
+
 [[nodiscard]] constexpr bool is_NI(unicode_bidi_class const &rhs) noexcept
 {
     using enum unicode_bidi_class;
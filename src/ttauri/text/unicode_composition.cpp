@@ -9,14 +9,19 @@ namespace tt {
 
 [[nodiscard]] char32_t unicode_composition_find(char32_t first, char32_t second) noexcept
 {
-    auto first_it = std::begin(detail::unicode_db_composition_table);
-    auto last_it = std::end(detail::unicode_db_composition_table);
+    constexpr auto size = std::size(detail::unicode_db_composition_table);
+    static_assert(std::size(detail::unicode_db_composition_salts) == size);
+    static_assert(std::size(detail::unicode_db_composition_indices) == size);
 
-    auto it = unicode_composition_find(first_it, last_it, first, second);
-    if (it == last_it) {
-        return U'\uffff';
+    ttlet key = unicode_composition{first, second}.key();
+    ttlet salt = detail::unicode_db_composition_salts[unicode_composition_hash(key, 0, size)];
+    ttlet index = detail::unicode_db_composition_indices[unicode_composition_hash(key, salt, size)];
+
+    ttlet &composition = detail::unicode_db_composition_table[index];
+    if (composition.key() == key) {
+        return composition.composed();
     } else {
-        return it->composed();
+        return U'\uffff';
     }
 }
 
@@ -5,6 +5,9 @@
 #pragma once
 
 #include "../assert.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
 
 namespace tt {
 
@@ -33,6 +36,13 @@ public:
         return static_cast<char32_t>(value & 0x1f'ffff);
     }
 
+    /** The first and second code-point packed into a 42 bit integer, used to find a composition.
+     */
+    [[nodiscard]] constexpr uint64_t key() const noexcept
+    {
+        return static_cast<uint64_t>(value >> 21);
+    }
+
     [[nodiscard]] constexpr friend bool operator<(unicode_composition const &lhs, unicode_composition const &rhs) noexcept
     {
         return lhs.value < rhs.value;
@@ -48,6 +58,21 @@ private:
     int64_t value;
 };
 
+/** The hash of the composition table.
+ * Must be the same as `composition_hash()` in tools/unicode_data_generator.py.
+ *
+ * @param key The key of a composition.
+ * @param salt The salt for the bucket of the key, or zero to find the bucket.
+ * @param size The size of the composition table.
+ * @return An index into the table, below size.
+ */
+[[nodiscard]] constexpr size_t unicode_composition_hash(uint64_t key, uint64_t salt, size_t size) noexcept
+{
+    auto y = (key + salt) * 0x9e37'79b9'7f4a'7c15;
+    y ^= key * 0x3141'5926'5358'9793;
+    return static_cast<size_t>(((y >> 32) * size) >> 32);
+}
+
 template<typename It>
 [[nodiscard]] constexpr It unicode_composition_find(It first, It last, unicode_composition value) noexcept
 {
@@ -66,6 +91,9 @@ template<typename It>
 }
 
 /** Find a composition of two code-points.
+ * The composition table is indexed through a minimal perfect hash made by the generator of the
+ * Unicode database, so that a pair is found with a single probe.
+ *
  * @return The combined character or 0xffff.
  */
 [[nodiscard]] char32_t unicode_composition_find(char32_t first, char32_t second) noexcept;
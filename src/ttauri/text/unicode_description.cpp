@@ -7,13 +7,23 @@
 
 namespace tt {
 
+/** Find a code-point in the global unicode_description table.
+ * This uses the two-stage index, which replaces the binary-search with two loads.
+ */
 constexpr auto _unicode_description_find(char32_t code_point) noexcept
 {
     tt_axiom(code_point <= 0x10'ffff);
 
-    auto first = std::begin(detail::unicode_db_description_table);
-    auto last = std::end(detail::unicode_db_description_table);
-    return unicode_description_find(first, last, code_point);
+    constexpr auto block_size = detail::unicode_db_description_index_block_size;
+
+    ttlet block_nr = detail::unicode_db_description_index_stage1[code_point / block_size];
+    ttlet index = detail::unicode_db_description_index_stage2[block_nr * block_size + code_point % block_size];
+
+    if (index == detail::unicode_db_description_index_not_found) {
+        return std::end(detail::unicode_db_description_table);
+    } else {
+        return std::begin(detail::unicode_db_description_table) + index;
+    }
 }
 
 constexpr unicode_description const &Replacement_Character_unicode_description = *_unicode_description_find(U'\ufffd');
@@ -202,8 +202,36 @@ static void unicode_clean(std::u32string &text) noexcept
     }
 }
 
+/** Check if text only contains code points before the limit.
+ * Code points before the limit must not decompose, combine or reorder in the requested normal form.
+ */
+[[nodiscard]] static bool
+unicode_quick_check(std::u32string_view text, char32_t limit, bool paragraph, bool composeCRLF) noexcept
+{
+    for (ttlet c : text) {
+        if (c >= limit or (paragraph and c == U'\n') or (composeCRLF and c == U'\r')) {
+            return false;
+        }
+    }
+    return true;
+}
+
+[[nodiscard]] bool unicode_NFC_quick_check(std::u32string_view text, bool paragraph, bool composeCRLF) noexcept
+{
+    return unicode_quick_check(text, U'\u0300', paragraph, composeCRLF);
+}
+
+[[nodiscard]] bool unicode_NFD_quick_check(std::u32string_view text, bool paragraph) noexcept
+{
+    return unicode_quick_check(text, U'\u00c0', paragraph, false);
+}
+
 std::u32string unicode_NFD(std::u32string_view text, bool ligatures, bool paragraph) noexcept
 {
+    if (unicode_NFD_quick_check(text, paragraph)) {
+        return std::u32string{text};
+    }
+
     auto r = std::u32string{};
     unicode_decompose(text, false, ligatures, paragraph, r);
     unicode_reorder(r);
@@ -214,6 +242,10 @@ std::u32string unicode_NFD(std::u32string_view text, bool ligatures, bool paragr
 [[nodiscard]] std::u32string
 unicode_NFC(std::u32string_view text, bool ligatures, bool paragraph, bool composeCRLF) noexcept
 {
+    if (unicode_NFC_quick_check(text, paragraph, composeCRLF)) {
+        return std::u32string{text};
+    }
+
     auto r = std::u32string{};
     unicode_decompose(text, false, ligatures, paragraph, r);
     unicode_reorder(r);
@@ -224,6 +256,11 @@ unicode_NFC(std::u32string_view text, bool ligatures, bool paragraph, bool compo
 
 std::u32string unicode_NFKD(std::u32string_view text, bool paragraph) noexcept
 {
+    // Compatibility decompositions start at U+00A0 NO-BREAK SPACE.
+    if (unicode_quick_check(text, U'\u00a0', paragraph, false)) {
+        return std::u32string{text};
+    }
+
     auto r = std::u32string{};
     unicode_decompose(text, true, false, paragraph, r);
     unicode_reorder(r);
@@ -233,6 +270,10 @@ std::u32string unicode_NFKD(std::u32string_view text, bool paragraph) noexcept
 
 std::u32string unicode_NFKC(std::u32string_view text, bool paragraph, bool composeCRLF) noexcept
 {
+    if (unicode_quick_check(text, U'\u00a0', paragraph, composeCRLF)) {
+        return std::u32string{text};
+    }
+
     auto r = std::u32string{};
     unicode_decompose(text, true, false, paragraph, r);
     unicode_reorder(r);
@@ -241,4 +282,51 @@ std::u32string unicode_NFKC(std::u32string_view text, bool paragraph, bool compo
     return r;
 }
 
+unicode_normalizer::unicode_normalizer(
+    bool compose,
+    bool compatible,
+    bool ligatures,
+    bool paragraph,
+    bool composeCRLF) noexcept :
+    _compose(compose), _compatible(compatible), _ligatures(ligatures), _paragraph(paragraph), _composeCRLF(composeCRLF)
+{
+}
+
+void unicode_normalizer::normalize_segment(size_t size, std::u32string &r) noexcept
+{
+    _segment.assign(_buffer, 0, size);
+    _buffer.erase(0, size);
+
+    unicode_reorder(_segment);
+    if (_compose) {
+        unicode_compose(_paragraph, _composeCRLF, _segment);
+    }
+    unicode_clean(_segment);
+    r += _segment;
+}
+
+void unicode_normalizer::add(std::u32string_view chunk, std::u32string &r) noexcept
+{
+    unicode_decompose(chunk, _compatible, _ligatures, _paragraph, _buffer);
+
+    // Find the last code-unit before which the segment can be cut. A starter before U+0300 is never
+    // the second character of a composition, and blocks the characters after it from combining with
+    // or reordering before the characters in front of it.
+    for (auto i = _buffer.size(); i > 1; --i) {
+        ttlet code_unit = _buffer[i - 1];
+        ttlet code_point = code_unit & 0x1f'ffff;
+        ttlet combining_class = code_unit >> 24;
+
+        if (combining_class == 0 and code_point < U'\u0300' and not(_composeCRLF and code_point == U'\r')) {
+            normalize_segment(i - 1, r);
+            return;
+        }
+    }
+}
+
+void unicode_normalizer::finish(std::u32string &r) noexcept
+{
+    normalize_segment(_buffer.size(), r);
+}
+
 }
@@ -51,4 +51,82 @@ std::u32string unicode_NFKD(std::u32string_view text, bool paragraph = false) no
  */
 std::u32string unicode_NFKC(std::u32string_view text, bool paragraph = false, bool composeCRLF = false) noexcept;
 
+/** Quickly check if text is already in Unicode-NFC normal form.
+ *
+ * This is a conservative check which only accepts text made of code points before U+0300, which covers
+ * ASCII and most Latin text. When this function returns true unicode_NFC() would return the text unchanged,
+ * and the caller may keep using the text or a view to it.
+ *
+ * @param text to check.
+ * @param paragraph line-feed characters are converted to paragraph separators.
+ * @param composeCRLF Compose CR-LF combinations to LF.
+ * @return true if the text is in NFC form; false if the text may need to be normalized.
+ */
+[[nodiscard]] bool unicode_NFC_quick_check(std::u32string_view text, bool paragraph = false, bool composeCRLF = false) noexcept;
+
+/** Quickly check if text is already in Unicode-NFD normal form.
+ *
+ * This is a conservative check which only accepts text made of code points before U+00C0.
+ *
+ * @param text to check.
+ * @param paragraph line-feed characters are converted to paragraph separators.
+ * @return true if the text is in NFD form; false if the text may need to be normalized.
+ */
+[[nodiscard]] bool unicode_NFD_quick_check(std::u32string_view text, bool paragraph = false) noexcept;
+
+/** Normalize text that is received in chunks.
+ *
+ * The text is normalized per segment, a segment ends before a starter that can not combine
+ * with the characters before it. The normalized text is appended to the output as soon as it
+ * can no longer change, so that only the last segment is buffered.
+ */
+class unicode_normalizer {
+public:
+    /**
+     * @param compose Compose the text into NFC or NFKC form, otherwise NFD or NFKD form.
+     * @param compatible Use compatible decomposition for NFKC or NFKD form.
+     * @param ligatures typographical-ligatures such as "fi" are decomposed.
+     * @param paragraph line-feed characters are converted to paragraph separators.
+     * @param composeCRLF Compose CR-LF combinations to LF.
+     */
+    unicode_normalizer(
+        bool compose,
+        bool compatible,
+        bool ligatures = false,
+        bool paragraph = false,
+        bool composeCRLF = false) noexcept;
+
+    /** Add a chunk of text.
+     *
+     * @param chunk The next part of the text.
+     * @param r The normalized text that can no longer change is appended to this string.
+     */
+    void add(std::u32string_view chunk, std::u32string &r) noexcept;
+
+    /** Finish the text.
+     *
+     * After this call the normalizer may be used for a new text.
+     *
+     * @param r The rest of the normalized text is appended to this string.
+     */
+    void finish(std::u32string &r) noexcept;
+
+private:
+    bool _compose;
+    bool _compatible;
+    bool _ligatures;
+    bool _paragraph;
+    bool _composeCRLF;
+
+    /** Decomposed code-units of the segment that may still change.
+     */
+    std::u32string _buffer;
+
+    /** The segment being normalized, reused between calls to reduce allocations.
+     */
+    std::u32string _segment;
+
+    void normalize_segment(size_t size, std::u32string &r) noexcept;
+};
+
 }
@@ -0,0 +1,61 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/text/unicode_normalization.hpp"
+#include <benchmark/benchmark.h>
+#include <string>
+
+using namespace std;
+using namespace tt;
+
+[[nodiscard]] static std::u32string make_normalization_bench_text(bool decomposed) noexcept
+{
+    // "é" and "ö" either precomposed or as a base letter with a combining mark.
+    ttlet sentence = decomposed ? std::u32string{U"Cafe\u0301 au lait, o\u0308l und Ka\u0308se. "} :
+                                  std::u32string{U"Caf\u00e9 au lait, \u00f6l und K\u00e4se. "};
+
+    auto r = std::u32string{};
+    while (r.size() < 4096) {
+        r += sentence;
+    }
+    return r;
+}
+
+static void unicode_NFC_precomposed(benchmark::State &state)
+{
+    ttlet text = make_normalization_bench_text(false);
+
+    for (auto _ : state) {
+        ttlet result = unicode_NFC(text);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * std::ssize(text));
+}
+BENCHMARK(unicode_NFC_precomposed);
+
+static void unicode_NFC_decomposed(benchmark::State &state)
+{
+    ttlet text = make_normalization_bench_text(true);
+
+    for (auto _ : state) {
+        ttlet result = unicode_NFC(text);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * std::ssize(text));
+}
+BENCHMARK(unicode_NFC_decomposed);
+
+static void unicode_NFC_quick_check_ASCII(benchmark::State &state)
+{
+    auto text = std::u32string{};
+    while (text.size() < 4096) {
+        text += U"The quick brown fox jumps over the lazy dog. ";
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(unicode_NFC_quick_check(text));
+    }
+    state.SetItemsProcessed(state.iterations() * std::ssize(text));
+}
+BENCHMARK(unicode_NFC_quick_check_ASCII);
@@ -3,6 +3,8 @@
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #include "ttauri/text/unicode_normalization.hpp"
+#include "ttauri/text/unicode_composition.hpp"
+#include "ttauri/text/unicode_db.hpp"
 #include "ttauri/file_view.hpp"
 #include "ttauri/strings.hpp"
 #include <gtest/gtest.h>
@@ -135,6 +137,29 @@ TEST_F(unicode_normalization, unicode_NFC_colon)
     ASSERT_TRUE(unicode_NFD(tt::to_u32string("Audio device:")) == tt::to_u32string("Audio device:"));
 }
 
+TEST_F(unicode_normalization, quick_check)
+{
+    ASSERT_TRUE(unicode_NFC_quick_check(tt::to_u32string("Audio device:")));
+    ASSERT_TRUE(unicode_NFC_quick_check(U"Caf\u00e9"));
+    ASSERT_FALSE(unicode_NFC_quick_check(U"Cafe\u0301"));
+    ASSERT_FALSE(unicode_NFC_quick_check(U"a\nb", true));
+    ASSERT_FALSE(unicode_NFD_quick_check(U"Caf\u00e9"));
+}
+
+TEST_F(unicode_normalization, normalizer)
+{
+    for (ttlet &test : normalizationTests) {
+        // Feed the text one code-point at a time, which cuts the text at every possible position.
+        auto normalizer = unicode_normalizer(true, false);
+        auto r = std::u32string{};
+        for (ttlet c : test.c1) {
+            normalizer.add(std::u32string_view{&c, 1}, r);
+        }
+        normalizer.finish(r);
+        ASSERT_TRUE(r == test.c2) << test.comment;
+    }
+}
+
 TEST_F(unicode_normalization, toNFC_c1)
 {
     for (ttlet &test : normalizationTests) {
@@ -317,3 +342,14 @@ TEST_F(unicode_normalization, Invariant)
     }
 }
 #endif
+
+TEST(unicode_composition, find)
+{
+    for (ttlet &composition : detail::unicode_db_composition_table) {
+        ASSERT_EQ(unicode_composition_find(composition.first(), composition.second()), composition.composed());
+    }
+
+    ASSERT_EQ(unicode_composition_find(U'A', U'B'), U'\uffff');
+    ASSERT_EQ(unicode_composition_find(U'\u0301', U'A'), U'\uffff');
+    ASSERT_EQ(unicode_composition_find(U'\U0010ffff', U'\U0010ffff'), U'\uffff');
+}
@@ -3,6 +3,7 @@
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #include "unicode_ranges.hpp"
+#include "../range_map.hpp"
 
 namespace tt {
 
@@ -180,6 +181,15 @@ constexpr std::array unicodeRangeToBitPosition = {
     std::pair<char32_t,int>{0x100000, 90}, //  Private Use (plane 16)	-10FFFD	Added in OpenType 1.4 for OS/2 version 3.
 };
 
+/** The bit position of the unicode range of each code point.
+ * Used for the lookups of single code points, which are done for each character of a text.
+ */
+[[nodiscard]] static frozen_range_map<char32_t, int> const &unicode_range_bit_positions() noexcept
+{
+    static ttlet r = frozen_range_map<char32_t, int>{unicodeRangeToBitPosition};
+    return r;
+}
+
 void unicode_ranges::add(char32_t first, char32_t last) noexcept
 {
     tt_assert(first < last);
@@ -192,14 +202,12 @@ void unicode_ranges::add(char32_t first, char32_t last) noexcept
 
 void unicode_ranges::add(char32_t c) noexcept
 {
-    auto i = std::upper_bound(unicodeRangeToBitPosition.cbegin(), unicodeRangeToBitPosition.cend(), c, [](ttlet &value, ttlet &element) { return value < element.first; });
-    return set_bit((i - 1)->second);
+    return set_bit(unicode_range_bit_positions()[c]);
 }
 
 [[nodiscard]] bool unicode_ranges::contains(char32_t c) const noexcept
 {
-    auto i = std::upper_bound(unicodeRangeToBitPosition.cbegin(), unicodeRangeToBitPosition.cend(), c, [](ttlet &value, ttlet &element) { return value < element.first; });
-    return get_bit((i - 1)->second);
+    return get_bit(unicode_range_bit_positions()[c]);
 }
 
 }
\ No newline at end of file
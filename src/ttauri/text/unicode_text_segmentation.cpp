@@ -5,6 +5,8 @@
 #include "unicode_text_segmentation.hpp"
 #include "unicode_description.hpp"
 #include "../required.hpp"
+#include "../assert.hpp"
+#include <array>
 
 namespace tt {
 
@@ -98,4 +100,58 @@ breaks_grapheme(unicode_grapheme_cluster_break cluster_break, grapheme_break_sta
     return breaks_grapheme(unicode_description_find(code_point).grapheme_cluster_break(), state);
 }
 
+/** The grapheme cluster break property of the Latin-1 code points.
+ */
+[[nodiscard]] static auto const &latin1_grapheme_cluster_breaks() noexcept
+{
+    static ttlet table = [] {
+        auto r = std::array<unicode_grapheme_cluster_break, 256>{};
+        for (char32_t c = 0; c != r.size(); ++c) {
+            r[c] = unicode_description_find(c).grapheme_cluster_break();
+        }
+        return r;
+    }();
+    return table;
+}
+
+[[nodiscard]] size_t breaks_grapheme(std::u32string_view text, std::span<size_t> breaks, grapheme_break_state &state) noexcept
+{
+    using enum unicode_grapheme_cluster_break;
+
+    tt_axiom(breaks.size() >= text.size());
+
+    ttlet is_trivial = [](unicode_grapheme_cluster_break cluster_break) {
+        return cluster_break == Other or cluster_break == Control or cluster_break == CR or cluster_break == LF;
+    };
+
+    ttlet &latin1_cluster_breaks = latin1_grapheme_cluster_breaks();
+
+    auto nr_breaks = 0_uz;
+    for (auto i = 0_uz; i != text.size(); ++i) {
+        ttlet code_point = text[i];
+
+        auto is_break = false;
+        if (code_point >= latin1_cluster_breaks.size()) {
+            is_break = breaks_grapheme(unicode_description_find(code_point).grapheme_cluster_break(), state);
+
+        } else if (ttlet cluster_break = latin1_cluster_breaks[code_point];
+                   is_trivial(state.previous) and is_trivial(cluster_break)) {
+            // Between these only GB3 does not break, all that remains of the state is the previous property.
+            is_break = state.first_character or not(state.previous == CR and cluster_break == LF);
+            state.previous = cluster_break;
+            state.RI_count = 0;
+            state.first_character = false;
+            state.in_extended_pictograph = false;
+
+        } else {
+            is_break = breaks_grapheme(cluster_break, state);
+        }
+
+        if (is_break) {
+            breaks[nr_breaks++] = i;
+        }
+    }
+    return nr_breaks;
+}
+
 }
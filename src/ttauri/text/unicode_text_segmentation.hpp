@@ -6,6 +6,9 @@
 
 #include "unicode_grapheme_cluster_break.hpp"
 #include "unicode_description.hpp"
+#include <string_view>
+#include <span>
+#include <cstddef>
 
 namespace tt {
 
@@ -33,6 +36,20 @@ struct grapheme_break_state {
  */
 [[nodiscard]] bool breaks_grapheme(char32_t code_point, grapheme_break_state &state) noexcept;
 
+/** Find the grapheme breaks in a text.
+ * Long text may be segmented in consecutive pieces, by passing the same state to each call.
+ *
+ * Latin-1 code points following a code point without special grapheme-break rules always
+ * break, except for a LF following a CR; the properties of other code points are looked up.
+ *
+ * @param text The text to segment.
+ * @param[out] breaks The offsets in `text` of the code points with a grapheme break before them.
+ *                    The buffer must be at least as large as `text`.
+ * @param state Current state of the grapheme-break algorithm.
+ * @return The number of offsets written to `breaks`.
+ */
+[[nodiscard]] size_t breaks_grapheme(std::u32string_view text, std::span<size_t> breaks, grapheme_break_state &state) noexcept;
+
 
 /** Wrap lines in text that are too wide.
  * This algorithm may modify white-space in text and change them into line seperators.
@@ -59,8 +76,8 @@ void wrap_lines(auto first, auto last, float max_width, auto get_width, auto get
 
     for (auto it = first; it != last; ++it) {
         ttlet code_point = get_code_point(*it);
-        ttlet description = unicode_description_find(code_point);
-        ttlet general_category = description->general_category();
+        ttlet &description = unicode_description_find(code_point);
+        ttlet general_category = description.general_category();
 
         if (general_category == Zp || general_category == Zl) {
             // Reset the line on existing line and paragraph separator.
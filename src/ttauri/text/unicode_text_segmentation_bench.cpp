@@ -0,0 +1,59 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/text/unicode_text_segmentation.hpp"
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace tt;
+
+static void wrap_lines_text(benchmark::State &state)
+{
+    auto original = std::u32string{};
+    while (original.size() < 4096) {
+        original += U"The quick brown fox jumps over the lazy dog. ";
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto text = original;
+        state.ResumeTiming();
+
+        wrap_lines(
+            std::begin(text),
+            std::end(text),
+            static_cast<float>(state.range(0)),
+            [](ttlet &) {
+                return 1.0f;
+            },
+            [](ttlet &c) {
+                return c;
+            },
+            [](auto &c, ttlet &code_point) {
+                c = code_point;
+            });
+        benchmark::DoNotOptimize(text.data());
+    }
+    state.SetItemsProcessed(state.iterations() * std::ssize(original));
+}
+BENCHMARK(wrap_lines_text)->Arg(40)->Arg(80);
+
+static void breaks_grapheme_text(benchmark::State &state)
+{
+    auto text = std::u32string{};
+    while (text.size() < 4096) {
+        text += U"The quick brown fox jumps over the lazy dog. ";
+    }
+
+    auto breaks = std::vector<size_t>(text.size());
+    for (auto _ : state) {
+        auto break_state = grapheme_break_state{};
+        benchmark::DoNotOptimize(breaks_grapheme(text, breaks, break_state));
+        benchmark::DoNotOptimize(breaks.data());
+    }
+    state.SetItemsProcessed(state.iterations() * std::ssize(text));
+}
+BENCHMARK(breaks_grapheme_text);
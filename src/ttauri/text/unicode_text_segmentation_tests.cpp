@@ -89,3 +89,53 @@ TEST(unicode_text_segmentation, breaks_grapheme)
         }
     }
 }
+
+TEST(unicode_text_segmentation, breaks_grapheme_text)
+{
+    auto tests = parsegraphemeBreakTests();
+
+    for (ttlet &test : tests) {
+        auto state = grapheme_break_state{};
+        auto breaks = std::vector<size_t>(test.code_points.size());
+        ttlet nr_breaks = breaks_grapheme(test.code_points, breaks, state);
+
+        auto expected = std::vector<size_t>{};
+        for (size_t i = 0; i < test.code_points.size(); i++) {
+            if (test.break_opportunities[i]) {
+                expected.push_back(i);
+            }
+        }
+
+        breaks.resize(nr_breaks);
+        ASSERT_EQ(breaks, expected) << test.comment;
+    }
+}
+
+TEST(unicode_text_segmentation, breaks_grapheme_text_pieces)
+{
+    // Latin-1 text, with CR LF and combining marks which are not in the fast path.
+    ttlet text = std::u32string{U"ab\r\ncd\r\r\u00e9e\u0301\u00a9\u200d\u00a9\n\u00ad\u0301x"};
+
+    auto expected_state = grapheme_break_state{};
+    auto expected = std::vector<size_t>{};
+    for (size_t i = 0; i != text.size(); ++i) {
+        if (breaks_grapheme(text[i], expected_state)) {
+            expected.push_back(i);
+        }
+    }
+
+    // Segmenting in pieces of each size gives the same breaks as per code point.
+    for (size_t piece_size = 1; piece_size <= text.size(); ++piece_size) {
+        auto state = grapheme_break_state{};
+        auto breaks = std::vector<size_t>{};
+        auto buffer = std::vector<size_t>(piece_size);
+        for (size_t piece_start = 0; piece_start < text.size(); piece_start += piece_size) {
+            ttlet piece = std::u32string_view{text}.substr(piece_start, piece_size);
+            ttlet nr_breaks = breaks_grapheme(piece, buffer, state);
+            for (size_t i = 0; i != nr_breaks; ++i) {
+                breaks.push_back(piece_start + buffer[i]);
+            }
+        }
+        ASSERT_EQ(breaks, expected) << piece_size;
+    }
+}
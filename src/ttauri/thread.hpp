@@ -9,7 +9,13 @@
 #if TT_OPERATING_SYSTEM == TT_OS_WINDOWS
 #include <intrin.h>
 #endif
+#if TT_PROCESSOR == TT_CPU_X64
+#include <immintrin.h>
+#endif
 #include <thread>
+#include <stop_token>
+#include <mutex>
+#include <condition_variable>
 #include <string_view>
 #include <functional>
 #include <atomic>
@@ -60,6 +66,41 @@ inline thread_local thread_id current_thread_id_dummy = 0;
 #endif
 }
 
+/** Tell the CPU that the current thread is spinning.
+ * This reduces the power used while spinning and gives the execution resources
+ * to the other hyper-thread on the same core.
+ */
+inline void cpu_pause() noexcept
+{
+#if TT_PROCESSOR == TT_CPU_X64
+    _mm_pause();
+#elif TT_COMPILER == TT_CC_MSVC
+    __yield();
+#else
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/** Sleep for a duration, or until a stop is requested.
+ * Background threads that sleep between their work use this, so that they can
+ * be joined without waiting for the rest of the sleep.
+ *
+ * @param stop_token The stop token of the current thread.
+ * @param duration The maximum time to sleep.
+ * @return false when a stop was requested.
+ */
+template<typename Rep, typename Period>
+bool sleep_for(std::stop_token const &stop_token, std::chrono::duration<Rep, Period> duration) noexcept
+{
+    auto mutex = std::mutex{};
+    auto condition = std::condition_variable_any{};
+    auto lock = std::unique_lock(mutex);
+    condition.wait_for(lock, stop_token, duration, [] {
+        return false;
+    });
+    return not stop_token.stop_requested();
+}
+
 /** Get the current process CPU affinity mask.
  *
  * @return A bit mask on which CPUs the process is allowed to run on.
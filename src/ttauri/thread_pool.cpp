@@ -0,0 +1,253 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "thread_pool.hpp"
+#include "work_stealing_deque.hpp"
+#include "thread.hpp"
+#include "cpu_topology.hpp"
+#include "trace.hpp"
+#include "counters.hpp"
+#include "unfair_mutex.hpp"
+#include <fmt/format.h>
+#include <array>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tt {
+namespace detail {
+
+using thread_pool_task = std::function<void()>;
+
+constexpr size_t thread_pool_nr_lanes = 2;
+
+/** The maximum number of tasks in a lane of a worker.
+ * When full, tasks are posted on the shared queue instead.
+ */
+constexpr size_t thread_pool_deque_capacity = 1024;
+
+struct thread_pool_worker {
+    size_t index;
+
+    /** The index of the cpu to pin the worker to.
+     */
+    size_t cpu;
+
+    std::array<work_stealing_deque<thread_pool_task, thread_pool_deque_capacity>, thread_pool_nr_lanes> deques;
+    std::jthread thread;
+};
+
+/** The workers, only modified by init and deinit while no worker is running.
+ */
+static std::vector<std::unique_ptr<thread_pool_worker>> thread_pool_workers;
+static std::atomic<size_t> thread_pool_nr_workers_ = 0;
+
+static thread_local thread_pool_worker *thread_pool_current_worker = nullptr;
+
+/** The queues for tasks posted from threads outside of the pool.
+ */
+static unfair_mutex thread_pool_mutex;
+static std::array<std::deque<thread_pool_task *>, thread_pool_nr_lanes> thread_pool_queues;
+static std::array<std::atomic<size_t>, thread_pool_nr_lanes> thread_pool_queue_sizes = {};
+
+/** Incremented on each post, the sleeping workers wait for it to change.
+ */
+static std::atomic<uint32_t> thread_pool_epoch = 0;
+static std::atomic<size_t> thread_pool_nr_sleeping = 0;
+
+static void thread_pool_wake() noexcept
+{
+    thread_pool_epoch.fetch_add(1, std::memory_order::seq_cst);
+    if (thread_pool_nr_sleeping.load(std::memory_order::seq_cst) != 0) {
+        thread_pool_epoch.notify_one();
+    }
+}
+
+[[nodiscard]] static thread_pool_task *thread_pool_pop_queue(size_t lane) noexcept
+{
+    if (thread_pool_queue_sizes[lane].load(std::memory_order::seq_cst) == 0) {
+        return nullptr;
+    }
+
+    ttlet lock = std::scoped_lock(thread_pool_mutex);
+    auto &queue = thread_pool_queues[lane];
+    if (queue.empty()) {
+        return nullptr;
+    }
+
+    auto *task = queue.front();
+    queue.pop_front();
+    thread_pool_queue_sizes[lane].fetch_sub(1, std::memory_order::relaxed);
+    return task;
+}
+
+[[nodiscard]] static thread_pool_task *thread_pool_steal(thread_pool_worker const &thief, size_t lane) noexcept
+{
+    ttlet nr_workers = thread_pool_workers.size();
+    for (size_t i = 1; i < nr_workers; ++i) {
+        auto &victim = *thread_pool_workers[(thief.index + i) % nr_workers];
+        if (auto *task = victim.deques[lane].steal()) {
+            increment_counter<"thread_pool:steal">();
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+/** Find a task, interactive tasks first.
+ * For each lane the worker's own deque goes first, then the shared queue, then the deques of the other workers.
+ */
+[[nodiscard]] static thread_pool_task *thread_pool_find_task(thread_pool_worker &worker) noexcept
+{
+    for (size_t lane = 0; lane != thread_pool_nr_lanes; ++lane) {
+        if (auto *task = worker.deques[lane].pop()) {
+            return task;
+        }
+        if (auto *task = thread_pool_pop_queue(lane)) {
+            return task;
+        }
+        if (auto *task = thread_pool_steal(worker, lane)) {
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+static void thread_pool_run(thread_pool_task *task) noexcept
+{
+    add_to_counter<"thread_pool:queue_depth">(-1);
+    increment_counter<"thread_pool:task">();
+    {
+        auto t = trace<"thread_pool_task">{};
+        (*task)();
+    }
+    delete task;
+}
+
+static void thread_pool_worker_loop(std::stop_token stop_token, thread_pool_worker *worker) noexcept
+{
+    set_thread_name(fmt::format("pool {}", worker->index));
+    thread_pool_current_worker = worker;
+
+    auto cpu = worker->cpu;
+    advance_thread_affinity(cpu);
+
+    while (true) {
+        if (auto *task = thread_pool_find_task(*worker)) {
+            [[likely]] thread_pool_run(task);
+            continue;
+        }
+
+        // Look once more after announcing the sleep, so that a post between
+        // the search and the wait is not missed.
+        ttlet epoch = thread_pool_epoch.load(std::memory_order::seq_cst);
+        thread_pool_nr_sleeping.fetch_add(1, std::memory_order::seq_cst);
+        auto *task = thread_pool_find_task(*worker);
+        ttlet stop_requested = stop_token.stop_requested();
+        if (task == nullptr && !stop_requested) {
+            thread_pool_epoch.wait(epoch, std::memory_order::seq_cst);
+        }
+        thread_pool_nr_sleeping.fetch_sub(1, std::memory_order::relaxed);
+
+        if (task != nullptr) {
+            thread_pool_run(task);
+        } else if (stop_requested) {
+            // All queues are empty, other workers finish what they have left themselves.
+            break;
+        }
+    }
+
+    thread_pool_current_worker = nullptr;
+}
+
+bool thread_pool_init() noexcept
+{
+    // Workers are spread over the physical performance cores first; the hyper-thread
+    // siblings and the efficiency cores are used last.
+    auto cpus = cpu_placement_order(cpu_core_type::performance);
+    if (cpus.empty()) {
+        return false;
+    }
+
+    // Leave the first cpu for the main thread.
+    if (cpus.size() > 1) {
+        cpus.erase(cpus.begin());
+    }
+
+    // All the workers must exist before a worker tries to steal.
+    tt_axiom(thread_pool_workers.empty());
+    for (size_t i = 0; i != cpus.size(); ++i) {
+        auto worker = std::make_unique<thread_pool_worker>();
+        worker->index = i;
+        worker->cpu = cpus[i];
+        thread_pool_workers.push_back(std::move(worker));
+    }
+
+    for (auto &worker : thread_pool_workers) {
+        worker->thread = std::jthread(thread_pool_worker_loop, worker.get());
+    }
+    thread_pool_nr_workers_.store(thread_pool_workers.size(), std::memory_order::relaxed);
+    return true;
+}
+
+void thread_pool_deinit() noexcept
+{
+    for (auto &worker : thread_pool_workers) {
+        worker->thread.request_stop();
+    }
+    thread_pool_epoch.fetch_add(1, std::memory_order::seq_cst);
+    thread_pool_epoch.notify_all();
+
+    for (auto &worker : thread_pool_workers) {
+        worker->thread.join();
+    }
+    thread_pool_nr_workers_.store(0, std::memory_order::relaxed);
+    thread_pool_workers.clear();
+
+    // Run the tasks that were posted from outside the pool while the workers were stopping.
+    for (size_t lane = 0; lane != thread_pool_nr_lanes; ++lane) {
+        while (auto *task = thread_pool_pop_queue(lane)) {
+            thread_pool_run(task);
+        }
+    }
+}
+
+} // namespace detail
+
+size_t thread_pool_nr_workers() noexcept
+{
+    return detail::thread_pool_nr_workers_.load(std::memory_order::relaxed);
+}
+
+bool thread_pool_is_worker() noexcept
+{
+    return detail::thread_pool_current_worker != nullptr;
+}
+
+void thread_pool_post(std::function<void()> task, thread_pool_priority priority) noexcept
+{
+    if (!detail::thread_pool_is_running.load(std::memory_order::acquire)) {
+        if (!thread_pool_start()) {
+            // Degraded mode, when the system is not running.
+            [[unlikely]] return task();
+        }
+    }
+
+    auto *ptr = new detail::thread_pool_task(std::move(task));
+    add_to_counter<"thread_pool:queue_depth">(1);
+
+    ttlet lane = static_cast<size_t>(priority);
+    auto *worker = detail::thread_pool_current_worker;
+    if (worker == nullptr || !worker->deques[lane].push(ptr)) {
+        ttlet lock = std::scoped_lock(detail::thread_pool_mutex);
+        detail::thread_pool_queues[lane].push_back(ptr);
+        detail::thread_pool_queue_sizes[lane].fetch_add(1, std::memory_order::seq_cst);
+    }
+
+    detail::thread_pool_wake();
+}
+
+} // namespace tt
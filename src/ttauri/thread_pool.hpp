@@ -0,0 +1,103 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "subsystem.hpp"
+#include "required.hpp"
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+
+namespace tt {
+
+/** The lane in which a task is queued on the thread pool.
+ * Workers run all queued interactive tasks before any background task.
+ */
+enum class thread_pool_priority : uint8_t {
+    /** Work that a user is waiting on, such as work needed for the next frame.
+     */
+    interactive = 0,
+
+    /** Work that may be delayed, such as pre-loading and cache building.
+     */
+    background = 1
+};
+
+namespace detail {
+
+/** Initialize the thread pool.
+ * This will start a worker thread for each available cpu, except one.
+ */
+tt_no_inline bool thread_pool_init() noexcept;
+
+/** Deinitialize the thread pool.
+ * The queued tasks are finished before the worker threads are stopped.
+ */
+tt_no_inline void thread_pool_deinit() noexcept;
+
+inline std::atomic<bool> thread_pool_is_running = false;
+
+} // namespace detail
+
+/** Start the thread pool.
+ * Initialize the thread pool if it is not already initialized and while the system is not in shutdown-mode.
+ * @return true if the thread pool is initialized, false when the system is being shutdown.
+ */
+inline bool thread_pool_start()
+{
+    return start_subsystem(detail::thread_pool_is_running, false, detail::thread_pool_init, detail::thread_pool_deinit);
+}
+
+/** Stop the thread pool.
+ * De-initialize the thread pool if it is initialized.
+ */
+inline void thread_pool_stop()
+{
+    return stop_subsystem(detail::thread_pool_is_running, false, detail::thread_pool_deinit);
+}
+
+/** The number of worker threads of the thread pool.
+ * @return The number of workers, or zero when the thread pool is not running.
+ */
+[[nodiscard]] size_t thread_pool_nr_workers() noexcept;
+
+/** Check if the current thread is a worker of the thread pool.
+ */
+[[nodiscard]] bool thread_pool_is_worker() noexcept;
+
+/** Post a task on the thread pool.
+ *
+ * A task posted from a worker is put on the worker's own deque, where other workers may steal it.
+ * A task posted from any other thread is put on a shared queue.
+ *
+ * When the thread pool can not be started, because the system is not running, the task
+ * is run directly on the current thread.
+ *
+ * @param task The task to run, it must not throw.
+ * @param priority The lane to queue the task in.
+ */
+void thread_pool_post(std::function<void()> task, thread_pool_priority priority = thread_pool_priority::background) noexcept;
+
+/** Run a function on the thread pool.
+ *
+ * @param func The function to run, exceptions thrown by the function are passed to the future.
+ * @param priority The lane to queue the function in.
+ * @return A future for the return value of the function.
+ */
+template<typename Func>
+[[nodiscard]] auto thread_pool_async(Func &&func, thread_pool_priority priority = thread_pool_priority::background)
+{
+    using result_type = std::invoke_result_t<std::decay_t<Func>>;
+
+    // std::function must be copyable, the packaged_task is not.
+    auto task = std::make_shared<std::packaged_task<result_type()>>(std::forward<Func>(func));
+    auto future = task->get_future();
+    thread_pool_post([task] { (*task)(); }, priority);
+    return future;
+}
+
+} // namespace tt
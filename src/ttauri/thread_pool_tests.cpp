@@ -0,0 +1,84 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/thread_pool.hpp"
+#include "ttauri/subsystem.hpp"
+#include "ttauri/awaitable.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <future>
+#include <vector>
+
+using namespace std;
+using namespace tt;
+
+TEST(ThreadPool, Async)
+{
+    start_system();
+
+    auto futures = std::vector<std::future<int>>{};
+    for (int i = 0; i != 1000; ++i) {
+        ttlet priority = i % 2 == 0 ? thread_pool_priority::interactive : thread_pool_priority::background;
+        futures.push_back(thread_pool_async([i] { return i * 2; }, priority));
+    }
+    ASSERT_GE(thread_pool_nr_workers(), 1);
+    ASSERT_FALSE(thread_pool_is_worker());
+
+    for (int i = 0; i != 1000; ++i) {
+        ASSERT_EQ(futures[i].get(), i * 2);
+    }
+
+    thread_pool_stop();
+}
+
+TEST(ThreadPool, Exception)
+{
+    start_system();
+
+    auto future = thread_pool_async([]() -> int {
+        throw std::runtime_error("task failed");
+    });
+    ASSERT_THROW(future.get(), std::runtime_error);
+
+    thread_pool_stop();
+}
+
+TEST(ThreadPool, PostFromWorker)
+{
+    start_system();
+
+    // Tasks posted from a worker go on its own deque, where the other workers steal them.
+    auto count = std::atomic<int>{0};
+    auto futures = std::vector<std::future<void>>{};
+    for (int i = 0; i != 10; ++i) {
+        futures.push_back(thread_pool_async([&count] {
+            ASSERT_TRUE(thread_pool_is_worker());
+            for (int j = 0; j != 2000; ++j) {
+                thread_pool_post([&count] {
+                    count.fetch_add(1, std::memory_order::relaxed);
+                });
+            }
+        }));
+    }
+    for (auto &future : futures) {
+        future.get();
+    }
+
+    // Stopping the pool finishes all queued tasks.
+    thread_pool_stop();
+    ASSERT_EQ(count.load(), 20000);
+}
+
+TEST(ThreadPool, Coroutine)
+{
+    start_system();
+
+    auto worker_task = []() -> task<bool> {
+        co_await resume_on_thread_pool{thread_pool_priority::interactive};
+        co_return thread_pool_is_worker();
+    };
+    ASSERT_TRUE(sync_wait(worker_task()));
+
+    thread_pool_stop();
+}
@@ -2,7 +2,6 @@
 #include "time_stamp_count.hpp"
 #include "hires_utc_clock.hpp"
 #include "logger.hpp"
-#include <emmintrin.h>
 #include <array>
 #include <cstdint>
 
@@ -10,28 +9,14 @@ namespace tt {
 
 [[nodiscard]] ssize_t time_stamp_count::cpu_id_fallback() const noexcept
 {
-    auto aux_value_ = _mm_set1_epi32(_aux);
-
-    ttlet num_aux_values = _num_aux_values.load(std::memory_order_acquire);
-    tt_axiom(_aux_values.size() == _cpu_ids.size());
-    tt_axiom(num_aux_values < _aux_values.size());
-
-    for (size_t i = 0; i < num_aux_values; i += 4) {
-        ttlet row = _mm_loadu_si128(reinterpret_cast<__m128i const *>(_aux_values.data() + i));
-        ttlet row_result = _mm_cmpeq_epi32(row, aux_value_);
-        ttlet row_result_ = _mm_castsi128_ps(row_result);
-        ttlet row_result_mask = _mm_movemask_ps(row_result_);
-        if (static_cast<bool>(row_result_mask)) {
-            ttlet j = i + std::countr_zero(static_cast<unsigned int>(row_result_mask));
-            if (j < num_aux_values) {
-                return _cpu_ids[j];
-            }
-
+    for (auto i = aux_table_index(_aux);; i = (i + 1) % aux_table_size) {
+        ttlet slot = _aux_table[i].load(std::memory_order::acquire);
+        if (slot == 0) {
             return -1;
+        } else if (static_cast<uint32_t>(slot) == _aux) {
+            return narrow_cast<ssize_t>(slot >> 32) - 1;
         }
     }
-
-    return -1;
 }
 
 [[nodiscard]] uint64_t time_stamp_count::measure_frequency(std::chrono::milliseconds sample_duration) noexcept
@@ -89,11 +74,12 @@ void time_stamp_count::populate_aux_values() noexcept
     do {
         current_cpu = advance_thread_affinity(next_cpu);
 
-        auto i = _num_aux_values.load(std::memory_order::acquire);
         auto tsc = time_stamp_count::now();
-        _aux_values[i] = tsc._aux;
-        _cpu_ids[i] = current_cpu;
-        _num_aux_values.store(i + 1, std::memory_order::release);
+        auto i = aux_table_index(tsc._aux);
+        while (_aux_table[i].load(std::memory_order::relaxed) != 0) {
+            i = (i + 1) % aux_table_size;
+        }
+        _aux_table[i].store((static_cast<uint64_t>(current_cpu + 1) << 32) | tsc._aux, std::memory_order::release);
         tt_log_info("Found CPU {} with TSC:AUX {}.", current_cpu, tsc._aux);
 
         if ((tsc._aux & 0xfff) != current_cpu) {
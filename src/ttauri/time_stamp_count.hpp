@@ -11,6 +11,7 @@
 #include <atomic>
 #include <array>
 #include <cstdint>
+#include <bit>
 
 #if TT_OPERATING_SYSTEM == TT_OS_WINDOWS
 #include <intrin.h>
@@ -113,6 +114,13 @@ public:
      */
     [[nodiscard]] static uint64_t measure_frequency(std::chrono::milliseconds duration) noexcept;
 
+    /** The period in nanoseconds/cycle as Q32.32.
+     */
+    [[nodiscard]] static uint64_t period() noexcept
+    {
+        return _period.load(std::memory_order::relaxed);
+    }
+
     static void set_frequency(uint64_t frequency) noexcept
     {
         auto period = (uint64_t{1'000'000'000} << 32) / frequency;
@@ -140,22 +148,25 @@ private:
 
     inline static std::atomic<bool> _aux_is_cpu_id = false;
 
-    /** The number of CPU ids we know of.
-     */
-    inline static std::atomic<size_t> _num_aux_values = 0;
+    static constexpr size_t aux_table_size = std::bit_ceil(maximum_num_cpus * 2);
 
-    /** A list of known CPU ids.
+    /** A hash table from an aux value to its CPU id.
+     * Each slot holds the aux value in the low 32 bits and the CPU id + 1 in the high
+     * 32 bits, or zero when the slot is empty. Slots are found by linear probing; the
+     * table is at most half full, so a lookup inspects only a few slots.
      */
-    inline static std::array<uint32_t, maximum_num_cpus> _aux_values;
+    inline static std::array<std::atomic<uint64_t>, aux_table_size> _aux_table = {};
 
-    /** A list of CPU ids that match the _aux_values list.
-     */
-    inline static std::array<size_t, maximum_num_cpus> _cpu_ids;
+    [[nodiscard]] static size_t aux_table_index(uint32_t aux) noexcept
+    {
+        constexpr auto shift = 64 - std::countr_zero(aux_table_size);
+        return static_cast<size_t>((static_cast<uint64_t>(aux) * 0x9e37'79b9'7f4a'7c15) >> shift);
+    }
 
     /** Get the CPU id.
      * This is logical CPU id that the operating system uses.
-     * This is the fallback function that will search through the
-     * table of _aux_values.
+     * This is the fallback function that will look up the
+     * aux value in the _aux_table.
      * 
      * @return the CPU id, or -1 if the CPU id is unknown.
      */
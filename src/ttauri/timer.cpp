@@ -31,11 +31,34 @@ timer::timer(std::string name) noexcept :
 timer::~timer()
 {
     stop();
-    tt_assert(std::ssize(callback_list) == 0);
+    tt_assert(handles.empty());
+}
+
+[[nodiscard]] uint64_t timer::to_tick_ceil(timer::time_point time) noexcept
+{
+    ttlet ns = narrow_cast<uint64_t>(time.time_since_epoch().count());
+    ttlet tick_ns = narrow_cast<uint64_t>(tick_duration.count());
+    return (ns + tick_ns - 1) / tick_ns;
+}
+
+[[nodiscard]] uint64_t timer::to_tick_floor(timer::time_point time) noexcept
+{
+    ttlet ns = narrow_cast<uint64_t>(time.time_since_epoch().count());
+    ttlet tick_ns = narrow_cast<uint64_t>(tick_duration.count());
+    return ns / tick_ns;
+}
+
+[[nodiscard]] timer::time_point timer::from_tick(uint64_t tick) noexcept
+{
+    return timer::time_point{tick_duration * narrow_cast<int64_t>(tick)};
 }
 
 void timer::start_with_lock_held() noexcept
 {
+    if (thread.joinable()) {
+        return;
+    }
+
     stop_thread = false;
     thread = std::thread([this]() {
         set_thread_name(name);
@@ -46,6 +69,7 @@ void timer::start_with_lock_held() noexcept
 void timer::stop_with_lock_held() noexcept
 {
     stop_thread = true;
+    condition.notify_all();
     if (thread.joinable()) {
         auto tmp = std::thread{};
         std::swap(tmp, thread);
@@ -70,78 +94,102 @@ void timer::stop() noexcept
     mutex.unlock();
 }
 
-[[nodiscard]] std::pair<std::vector<timer::callback_ptr_type>,timer::time_point> timer::find_triggered_callbacks(
-    timer::time_point current_time
-) noexcept {
+void timer::add_callback_ptr(timer::duration interval, timer::callback_ptr_type const &callback_ptr) noexcept
+{
     ttlet lock = std::scoped_lock(mutex);
+    ttlet current_time = hires_utc_clock::now();
 
-    auto triggered_callbacks = std::vector<callback_ptr_type>{};
-    auto next_wakeup = timer::time_point::max();
+    if (wheel.empty()) {
+        // Start the wheel at the current time, the wheel is empty so this is cheap.
+        wheel.rebase(to_tick_floor(current_time));
+    }
 
-    auto i = callback_list.begin();
-    while (i != callback_list.end()) {
-        auto callback_ptr = i->callback_ptr.lock();
+    // The callback of an expired entry may have been allocated at the same address.
+    remove_callback_with_lock_held(callback_ptr.get());
 
-        if (callback_ptr) {
-            if (i->next_wakeup <= current_time) {
-                triggered_callbacks.push_back(callback_ptr);
-                i->next_wakeup = calculate_next_wakeup(current_time, i->interval);
-            }
+    ttlet next_wakeup = calculate_next_wakeup(current_time, interval);
+    handles[callback_ptr.get()] =
+        wheel.insert(to_tick_ceil(next_wakeup), callback_entry{interval, callback_ptr, callback_ptr.get()});
 
-            // Protection against clock_settime().
-            if (i->next_wakeup > current_time + i->interval) {
-                i->next_wakeup = calculate_next_wakeup(current_time, i->interval);
-            }
+    start_with_lock_held();
+    condition.notify_one();
+}
 
-            if (i->next_wakeup < next_wakeup) {
-                next_wakeup = i->next_wakeup;
-            }
+void timer::remove_callback_with_lock_held(timer::callback_type const *key) noexcept
+{
+    if (auto i = handles.find(key); i != handles.end()) {
+        wheel.erase(i->second);
+        handles.erase(i);
+    }
+}
 
-            ++i;
-        } else {
-            i = callback_list.erase(i);
+void timer::find_triggered_callbacks(
+    timer::time_point current_time,
+    std::vector<timer::callback_ptr_type> &triggered_callbacks) noexcept
+{
+    ttlet current_tick = to_tick_floor(current_time);
+
+    // Protection against clock_settime().
+    if (current_tick < wheel.tick()) {
+        wheel.rebase(current_tick);
+        for (ttlet &[key, handle] : handles) {
+            wheel.reschedule(handle, to_tick_ceil(calculate_next_wakeup(current_time, handle->value.interval)));
         }
+    }
 
-        
+    auto expired = std::vector<wheel_type::handle_type>{};
+    wheel.advance(current_tick, expired);
+
+    for (auto *handle : expired) {
+        if (auto callback_ptr = handle->value.callback_ptr.lock()) {
+            triggered_callbacks.push_back(std::move(callback_ptr));
+            wheel.reschedule(handle, to_tick_ceil(calculate_next_wakeup(current_time, handle->value.interval)));
+        } else {
+            handles.erase(handle->value.key);
+            wheel.erase(handle);
+        }
     }
-    return {triggered_callbacks, next_wakeup};
 }
 
 void timer::loop() noexcept
 {
     tt_log_info("Timer {}: started", name);
-    while (true) {
-        ttlet current_time = hires_utc_clock::now();
 
-        ttlet &[triggered_callbacks, next_wakeup] = find_triggered_callbacks(current_time);
+    auto triggered_callbacks = std::vector<callback_ptr_type>{};
 
-        // Execute all the triggered callbacks.
-        for (ttlet &callback_ptr: triggered_callbacks) {
-            (*callback_ptr)(current_time, false);
-        }
+    auto lock = std::unique_lock(mutex);
+    while (!stop_thread) {
+        ttlet current_time = hires_utc_clock::now();
+        find_triggered_callbacks(current_time, triggered_callbacks);
 
-        // Sleep, but not for more than 100ms.
-        ttlet sleep_duration = std::min(next_wakeup - current_time, timer::duration{100ms});
-        if (sleep_duration > 0ms) {
-            std::this_thread::sleep_for(sleep_duration);
+        if (!triggered_callbacks.empty()) {
+            // Callbacks may add and remove callbacks, so execute them without holding the lock.
+            lock.unlock();
+            for (ttlet &callback_ptr : triggered_callbacks) {
+                (*callback_ptr)(current_time, false);
+            }
+            triggered_callbacks.clear();
+            lock.lock();
+            continue;
         }
 
-        ttlet lock = std::scoped_lock(mutex);
-        if (stop_thread || std::ssize(callback_list) == 0) {
-            break;
+        // Wait until the next slot of the wheel is due, or until a callback is added.
+        auto timeout = maximum_wait;
+        if (ttlet next_tick = wheel.next_tick(); next_tick != wheel_type::no_tick) {
+            timeout = std::min(from_tick(next_tick) - current_time, maximum_wait);
         }
+        condition.wait_for(lock, timeout);
     }
     tt_log_info("Timer {}: finishing up", name);
 
-    ttlet lock = std::scoped_lock(mutex);
-    
     ttlet current_time = hires_utc_clock::now();
-    for (ttlet &item: callback_list) {
-        if (auto callback_ptr_ = item.callback_ptr.lock()) {
-            (*callback_ptr_)(current_time, true);
+    for (ttlet &[key, handle] : handles) {
+        if (auto callback_ptr = handle->value.callback_ptr.lock()) {
+            (*callback_ptr)(current_time, true);
         }
     }
-    callback_list.clear();
+    handles.clear();
+    wheel.clear();
 
     tt_log_info("Timer {}: finished", name);
 }
@@ -149,12 +197,7 @@ void timer::loop() noexcept
 void timer::remove_callback(callback_ptr_type const &callback_ptr) noexcept
 {
     ttlet lock = std::scoped_lock(mutex);
-
-    ttlet i = std::remove_if(callback_list.begin(), callback_list.end(), [&callback_ptr](ttlet &item) {
-        auto callback_ptr_ = item.callback_ptr.lock();
-        return !callback_ptr_ || callback_ptr_ == callback_ptr;
-    });
-    callback_list.erase(i, callback_list.end());
+    remove_callback_with_lock_held(callback_ptr.get());
 }
 
 }
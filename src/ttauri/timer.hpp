@@ -7,15 +7,23 @@
 
 #include "hires_utc_clock.hpp"
 #include "unfair_mutex.hpp"
+#include "timer_wheel.hpp"
 #include <mutex>
+#include <condition_variable>
 #include <vector>
 #include <functional>
+#include <memory>
 #include <tuple>
 #include <thread>
+#include <unordered_map>
 
 namespace tt {
 
 /** A timer which will execute callbacks at given intervals.
+ *
+ * The callbacks are kept in a hierarchical timing wheel with a resolution of `tick_duration`,
+ * so that adding and removing callbacks is O(1), and callbacks that are due at the same
+ * time are executed together. Between the due times the timer thread waits on a condition variable.
  */
 class timer {
 public:
@@ -38,8 +46,8 @@ public:
     ~timer();
 
     /** Start the timer thread.
-     * Normally it is not needed to call this yourself. If there
-     * are no callbacks registered the thread will exit itself.
+     * Normally it is not needed to call this yourself, the thread is
+     * started when the first callback is added.
      */
     void start() noexcept;
 
@@ -64,21 +72,8 @@ public:
     template<typename Callback>
     [[nodiscard]] std::shared_ptr<callback_type> add_callback(duration interval, Callback callback) noexcept
     {
-        ttlet lock = std::scoped_lock(mutex);
-        ttlet current_time = hires_utc_clock::now();
-
         auto callback_ptr = std::make_shared<callback_type>(std::forward<Callback>(callback));
-
-        callback_list.emplace_back(
-            interval,
-            calculate_next_wakeup(current_time, interval),
-            callback_ptr
-        );
-
-        if (std::ssize(callback_list) == 1) {
-            start_with_lock_held();
-        }
-
+        add_callback_ptr(interval, callback_ptr);
         return callback_ptr;
     }
 
@@ -89,43 +84,61 @@ public:
 private:
     struct callback_entry {
         duration interval;
-        time_point next_wakeup;
         std::weak_ptr<callback_type> callback_ptr;
 
-        callback_entry(duration interval, time_point next_wakeup, std::shared_ptr<callback_type> const &callback_ptr) noexcept :
-            interval(interval), next_wakeup(next_wakeup), callback_ptr(callback_ptr)
-        {
-        }
+        /** The key in the handles map, the callback_ptr may have expired.
+         */
+        callback_type const *key;
     };
 
+    using wheel_type = timer_wheel<callback_entry>;
+
+    /** The resolution of the timer.
+     */
+    static constexpr duration tick_duration = std::chrono::milliseconds{1};
+
+    /** The maximum time to wait, to notice changes of the clock.
+     */
+    static constexpr duration maximum_wait = std::chrono::seconds{1};
+
     /** Name of the timer.
      */
     std::string name;
 
     mutable unfair_mutex mutex;
+
+    /** Notified when a callback is added or when the thread should stop.
+     */
+    std::condition_variable_any condition;
+
     std::thread thread;
-    std::vector<callback_entry> callback_list;
-    size_t callback_count = 0;
+    wheel_type wheel;
+
+    /** The callbacks in the wheel, for removing a callback in O(1).
+     */
+    std::unordered_map<callback_type const *, wheel_type::handle_type> handles;
 
     /** Set to true to ask the thread to exit.
      */
     bool stop_thread;
 
+    void add_callback_ptr(duration interval, callback_ptr_type const &callback_ptr) noexcept;
+
+    void remove_callback_with_lock_held(callback_type const *key) noexcept;
+
     /** Find the callbacks that have triggered.
-     * This function will also update the wakup times of triggered callbacks.
+     * This function will also reschedule the triggered callbacks, and remove expired callbacks.
      *
-     * @return List of triggered callbacks, Time to wakeup to trigger on the next callback.
+     * @param current_time The current time.
+     * @param[out] triggered_callbacks The callbacks to execute.
      */
-    [[nodiscard]] std::pair<std::vector<callback_ptr_type>, timer::time_point>
-    find_triggered_callbacks(timer::time_point current_time) noexcept;
+    void find_triggered_callbacks(time_point current_time, std::vector<callback_ptr_type> &triggered_callbacks) noexcept;
 
     /** The thread procedure.
      */
     void loop() noexcept;
 
-    /** Start the timer thread.
-     * Normally it is not needed to call this yourself. If there
-     * are no callbacks registered the thread will exit itself.
+    /** Start the timer thread, if it is not running.
      */
     void start_with_lock_held() noexcept;
 
@@ -135,6 +148,16 @@ private:
      */
     void stop_with_lock_held() noexcept;
 
+    /** The first tick at or after a time point.
+     */
+    [[nodiscard]] static uint64_t to_tick_ceil(time_point time) noexcept;
+
+    /** The last tick at or before a time point.
+     */
+    [[nodiscard]] static uint64_t to_tick_floor(time_point time) noexcept;
+
+    [[nodiscard]] static time_point from_tick(uint64_t tick) noexcept;
+
     [[nodiscard]] static time_point calculate_next_wakeup(time_point current_time, duration interval) noexcept;
 };
 
@@ -0,0 +1,357 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "required.hpp"
+#include "assert.hpp"
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace tt {
+
+/** A hierarchical timing wheel.
+ *
+ * Items are scheduled at a tick, an abstract unit of time. Each level of the wheel has 64 slots,
+ * a slot on level 0 holds the items of a single tick and a slot on each next level spans the
+ * 64 slots of the level below. When the current tick enters the span of a slot on a higher level,
+ * the items of that slot are cascaded to the lower levels. Items that are further away than
+ * the top level can hold are kept on an overflow list, which is cascaded at the end of the top level.
+ *
+ * Insert and erase are O(1). Each level keeps a bit mask of its occupied slots, so that the
+ * next tick at which anything happens is found in O(1), without stepping through the empty ticks.
+ *
+ * Items in the same slot of level 0 have the same tick, and expire together.
+ *
+ * @tparam T The type of the value of an item.
+ */
+template<typename T>
+class timer_wheel {
+public:
+    using value_type = T;
+
+    static constexpr int slot_bits = 6;
+    static constexpr size_t nr_slots = size_t{1} << slot_bits;
+    static constexpr int nr_levels = 4;
+
+    static constexpr uint64_t no_tick = std::numeric_limits<uint64_t>::max();
+
+    class node {
+    public:
+        value_type value;
+
+        /** The tick at which the item expires.
+         */
+        [[nodiscard]] uint64_t tick() const noexcept
+        {
+            return _tick;
+        }
+
+    private:
+        uint64_t _tick;
+        node *_prev = nullptr;
+        node *_next = nullptr;
+
+        /** The level the item is on, `overflow_level` or `detached_level`.
+         */
+        int _level = detached_level;
+        size_t _slot = 0;
+
+        node(uint64_t tick, value_type value) noexcept : value(std::move(value)), _tick(tick) {}
+
+        friend class timer_wheel;
+    };
+
+    using handle_type = node *;
+
+    /**
+     * @param tick The current tick; items at or before this tick have expired.
+     */
+    explicit timer_wheel(uint64_t tick = 0) noexcept : _tick(tick) {}
+
+    timer_wheel(timer_wheel const &) = delete;
+    timer_wheel(timer_wheel &&) = delete;
+    timer_wheel &operator=(timer_wheel const &) = delete;
+    timer_wheel &operator=(timer_wheel &&) = delete;
+
+    ~timer_wheel()
+    {
+        clear();
+    }
+
+    /** The current tick.
+     */
+    [[nodiscard]] uint64_t tick() const noexcept
+    {
+        return _tick;
+    }
+
+    /** The number of items, including the expired items that were not yet erased or rescheduled.
+     */
+    [[nodiscard]] size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    /** Add an item.
+     *
+     * @param tick The tick to expire at, an item in the past expires at the next tick.
+     * @param value The value of the item.
+     * @return A handle to erase or reschedule the item.
+     */
+    handle_type insert(uint64_t tick, value_type value) noexcept
+    {
+        auto *n = new node(tick, std::move(value));
+        ++_size;
+        link(n, std::max(tick, _tick + 1));
+        return n;
+    }
+
+    /** Remove an item.
+     * This may also be called on an expired item.
+     */
+    void erase(handle_type n) noexcept
+    {
+        tt_axiom(n != nullptr);
+        unlink(n);
+        --_size;
+        delete n;
+    }
+
+    /** Schedule an item at an other tick.
+     * This may also be called on an expired item.
+     */
+    void reschedule(handle_type n, uint64_t tick) noexcept
+    {
+        tt_axiom(n != nullptr);
+        unlink(n);
+        link(n, std::max(tick, _tick + 1));
+    }
+
+    /** Remove all items.
+     */
+    void clear() noexcept
+    {
+        for (auto &level : _levels) {
+            for (auto &head : level.slots) {
+                delete_list(head);
+            }
+            level.occupied = 0;
+        }
+        delete_list(_overflow);
+        _size = 0;
+    }
+
+    /** The next tick at which an item expires or at which items are cascaded.
+     *
+     * @return The tick, or `no_tick` when the wheel is empty.
+     */
+    [[nodiscard]] uint64_t next_tick() const noexcept
+    {
+        for (int level = 0; level != nr_levels; ++level) {
+            ttlet shift = level * slot_bits;
+            ttlet index = (_tick >> shift) & (nr_slots - 1);
+
+            // Only slots after the current slot are occupied, the current slot on
+            // the higher levels has already been cascaded.
+            ttlet later = index == nr_slots - 1 ? uint64_t{0} : _levels[level].occupied & (~uint64_t{0} << (index + 1));
+            if (later != 0) {
+                ttlet span_shift = shift + slot_bits;
+                return ((_tick >> span_shift) << span_shift) | (uint64_t{static_cast<unsigned>(std::countr_zero(later))} << shift);
+            }
+        }
+
+        if (_overflow != nullptr) {
+            return ((_tick >> top_shift) + 1) << top_shift;
+        } else {
+            return no_tick;
+        }
+    }
+
+    /** Advance the current tick.
+     *
+     * The expired items are detached from the wheel and appended to `expired`; they
+     * should be erased or rescheduled.
+     *
+     * @param tick The new current tick.
+     * @param expired The list to append the expired items to.
+     */
+    void advance(uint64_t tick, std::vector<handle_type> &expired) noexcept
+    {
+        while (_tick < tick) {
+            ttlet next = next_tick();
+            if (next > tick) {
+                // Nothing happens until after tick; the bit masks are still valid, since
+                // the first occupied slot of each level comes after the new current tick.
+                _tick = tick;
+                return;
+            }
+
+            _tick = next;
+            cascade();
+
+            auto &level = _levels[0];
+            ttlet index = _tick & (nr_slots - 1);
+            for (auto *n = level.slots[index]; n != nullptr; n = level.slots[index]) {
+                unlink(n);
+                expired.push_back(n);
+            }
+        }
+    }
+
+    /** Set the current tick, when time went backwards.
+     * All items are inserted again relative to the new current tick.
+     */
+    void rebase(uint64_t tick) noexcept
+    {
+        auto nodes = std::vector<handle_type>{};
+        nodes.reserve(_size);
+        for (auto &level : _levels) {
+            for (auto &head : level.slots) {
+                while (head != nullptr) {
+                    nodes.push_back(head);
+                    unlink(head);
+                }
+            }
+        }
+        while (_overflow != nullptr) {
+            nodes.push_back(_overflow);
+            unlink(_overflow);
+        }
+
+        _tick = tick;
+        for (auto *n : nodes) {
+            link(n, std::max(n->_tick, _tick + 1));
+        }
+    }
+
+private:
+    static constexpr int overflow_level = nr_levels;
+    static constexpr int detached_level = nr_levels + 1;
+    static constexpr int top_shift = nr_levels * slot_bits;
+
+    struct level_type {
+        /** A bit for each slot that has items.
+         */
+        uint64_t occupied = 0;
+        std::array<node *, nr_slots> slots = {};
+    };
+
+    std::array<level_type, nr_levels> _levels;
+    node *_overflow = nullptr;
+    uint64_t _tick;
+    size_t _size = 0;
+
+    static void push_front(node *&head, node *n) noexcept
+    {
+        n->_prev = nullptr;
+        n->_next = head;
+        if (head != nullptr) {
+            head->_prev = n;
+        }
+        head = n;
+    }
+
+    static void delete_list(node *&head) noexcept
+    {
+        while (head != nullptr) {
+            delete std::exchange(head, head->_next);
+        }
+    }
+
+    /** Link a node into the level and slot that holds its tick.
+     * The level is the highest group of 6 bits in which the tick differs from the current tick.
+     */
+    void link(node *n, uint64_t tick) noexcept
+    {
+        tt_axiom(n->_level == detached_level);
+        tt_axiom(tick >= _tick);
+        n->_tick = tick;
+
+        ttlet difference = tick ^ _tick;
+        ttlet level = difference == 0 ? 0 : (std::bit_width(difference) - 1) / slot_bits;
+        if (level >= nr_levels) {
+            n->_level = overflow_level;
+            push_front(_overflow, n);
+            return;
+        }
+
+        ttlet slot = static_cast<size_t>((tick >> (level * slot_bits)) & (nr_slots - 1));
+        n->_level = level;
+        n->_slot = slot;
+        push_front(_levels[level].slots[slot], n);
+        _levels[level].occupied |= uint64_t{1} << slot;
+    }
+
+    void unlink(node *n) noexcept
+    {
+        if (n->_level == detached_level) {
+            return;
+        }
+
+        auto &head = n->_level == overflow_level ? _overflow : _levels[n->_level].slots[n->_slot];
+        if (n->_prev != nullptr) {
+            n->_prev->_next = n->_next;
+        } else {
+            tt_axiom(head == n);
+            head = n->_next;
+        }
+        if (n->_next != nullptr) {
+            n->_next->_prev = n->_prev;
+        }
+
+        if (head == nullptr && n->_level != overflow_level) {
+            _levels[n->_level].occupied &= ~(uint64_t{1} << n->_slot);
+        }
+
+        n->_prev = nullptr;
+        n->_next = nullptr;
+        n->_level = detached_level;
+    }
+
+    /** Move the items of a slot on to the lower levels.
+     */
+    void cascade_list(node *&head) noexcept
+    {
+        // Items of the overflow list may be linked into the overflow list again.
+        auto *n = std::exchange(head, nullptr);
+        while (n != nullptr) {
+            auto *next = n->_next;
+            n->_prev = nullptr;
+            n->_next = nullptr;
+            n->_level = detached_level;
+            link(n, n->_tick);
+            n = next;
+        }
+    }
+
+    /** Cascade the slots that the current tick just entered, from the top level down.
+     */
+    void cascade() noexcept
+    {
+        if ((_tick & ((uint64_t{1} << top_shift) - 1)) == 0) {
+            cascade_list(_overflow);
+        }
+
+        for (int level = nr_levels - 1; level != 0; --level) {
+            ttlet shift = level * slot_bits;
+            if ((_tick & ((uint64_t{1} << shift) - 1)) == 0) {
+                ttlet slot = (_tick >> shift) & (nr_slots - 1);
+                _levels[level].occupied &= ~(uint64_t{1} << slot);
+                cascade_list(_levels[level].slots[slot]);
+            }
+        }
+    }
+};
+
+} // namespace tt
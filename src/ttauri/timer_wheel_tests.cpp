@@ -0,0 +1,144 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/timer_wheel.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace tt;
+
+TEST(TimerWheel, Expire)
+{
+    auto wheel = timer_wheel<int>{};
+    auto expired = std::vector<timer_wheel<int>::handle_type>{};
+
+    wheel.insert(10, 10);
+    wheel.insert(10, 11);
+    wheel.insert(100, 100);
+    ASSERT_EQ(wheel.next_tick(), 10);
+
+    wheel.advance(9, expired);
+    ASSERT_TRUE(expired.empty());
+
+    // Items with the same tick expire together.
+    wheel.advance(10, expired);
+    ASSERT_EQ(expired.size(), 2);
+    for (auto *item : expired) {
+        ASSERT_EQ(item->tick(), 10);
+        wheel.erase(item);
+    }
+    expired.clear();
+
+    // The item on level 1 is cascaded at the start of its span.
+    ASSERT_EQ(wheel.next_tick(), 64);
+    wheel.advance(1000, expired);
+    ASSERT_EQ(expired.size(), 1);
+    ASSERT_EQ(expired[0]->value, 100);
+    wheel.erase(expired[0]);
+    ASSERT_TRUE(wheel.empty());
+    ASSERT_EQ(wheel.next_tick(), wheel.no_tick);
+}
+
+TEST(TimerWheel, Erase)
+{
+    auto wheel = timer_wheel<int>{};
+    auto expired = std::vector<timer_wheel<int>::handle_type>{};
+
+    auto *a = wheel.insert(5, 1);
+    auto *b = wheel.insert(5000, 2);
+    wheel.erase(a);
+    wheel.erase(b);
+    ASSERT_TRUE(wheel.empty());
+
+    wheel.advance(10000, expired);
+    ASSERT_TRUE(expired.empty());
+}
+
+TEST(TimerWheel, Reschedule)
+{
+    auto wheel = timer_wheel<int>{};
+    auto expired = std::vector<timer_wheel<int>::handle_type>{};
+
+    auto *a = wheel.insert(5, 1);
+    for (uint64_t tick = 5; tick < 100'000; tick += 5) {
+        wheel.advance(tick, expired);
+        ASSERT_EQ(expired.size(), 1);
+        ASSERT_EQ(expired[0], a);
+        wheel.reschedule(a, tick + 5);
+        expired.clear();
+    }
+    ASSERT_EQ(wheel.size(), 1);
+}
+
+TEST(TimerWheel, Overflow)
+{
+    auto wheel = timer_wheel<int>{};
+    auto expired = std::vector<timer_wheel<int>::handle_type>{};
+
+    constexpr auto far = uint64_t{1} << 30;
+    wheel.insert(far, 1);
+    wheel.advance(far - 1, expired);
+    ASSERT_TRUE(expired.empty());
+    wheel.advance(far, expired);
+    ASSERT_EQ(expired.size(), 1);
+    wheel.erase(expired[0]);
+}
+
+TEST(TimerWheel, Rebase)
+{
+    auto wheel = timer_wheel<int>{1000};
+    auto expired = std::vector<timer_wheel<int>::handle_type>{};
+
+    wheel.insert(1010, 1);
+    wheel.rebase(500);
+    wheel.advance(1009, expired);
+    ASSERT_TRUE(expired.empty());
+    wheel.advance(1010, expired);
+    ASSERT_EQ(expired.size(), 1);
+    wheel.erase(expired[0]);
+}
+
+TEST(TimerWheel, Random)
+{
+    auto engine = std::mt19937_64{42};
+    auto wheel = timer_wheel<uint64_t>{};
+    auto expired = std::vector<timer_wheel<uint64_t>::handle_type>{};
+    auto nr_items = 0;
+
+    for (int step = 0; step != 10000; ++step) {
+        // Delays spread over all the levels of the wheel and the overflow list.
+        ttlet distance_bits = std::uniform_int_distribution<int>{0, 27}(engine);
+        ttlet delay = std::uniform_int_distribution<uint64_t>{1, uint64_t{1} << distance_bits}(engine);
+        wheel.insert(wheel.tick() + delay, wheel.tick() + delay);
+        ++nr_items;
+
+        ttlet advance = std::uniform_int_distribution<uint64_t>{0, uint64_t{1} << 10}(engine);
+        ttlet previous_tick = wheel.tick();
+        wheel.advance(previous_tick + advance, expired);
+        for (auto *item : expired) {
+            ASSERT_GT(item->value, previous_tick);
+            ASSERT_LE(item->value, wheel.tick());
+            wheel.erase(item);
+            --nr_items;
+        }
+        expired.clear();
+    }
+
+    // Everything expires exactly at its own tick.
+    while (!wheel.empty()) {
+        ttlet next = wheel.next_tick();
+        ASSERT_NE(next, wheel.no_tick);
+        wheel.advance(next, expired);
+        for (auto *item : expired) {
+            ASSERT_EQ(item->value, next);
+            wheel.erase(item);
+            --nr_items;
+        }
+        expired.clear();
+    }
+    ASSERT_EQ(nr_items, 0);
+}
@@ -3,6 +3,11 @@
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #include "tokenizer.hpp"
+#include "os_detect.hpp"
+#if TT_PROCESSOR == TT_CPU_X64
+#include <emmintrin.h>
+#endif
+#include <bit>
 
 namespace tt {
 
@@ -954,89 +959,198 @@ constexpr transitionTable_t buildTransitionTable()
 
 constexpr transitionTable_t transitionTable = buildTransitionTable();
 
+/** Check if a character continues a run in a state.
+ * A run is a sequence of characters which each keep the tokenizer in the same state, are read,
+ * advance the location by a single column and are either all captured unchanged or all skipped.
+ * Only the states in which long runs are common have runs.
+ */
+[[nodiscard]] constexpr bool is_run_char(tokenizer_state_t state, char c) noexcept
+{
+    ttlet u = static_cast<uint8_t>(c);
+
+    switch (state) {
+    case tokenizer_state_t::Initial: return c == ' ';
+    case tokenizer_state_t::Name: return is_name_next(c) || c == '-';
+    case tokenizer_state_t::String: return u >= 0x20 && c != '"' && c != '\\';
+    case tokenizer_state_t::LineComment: return u >= 0x20;
+    case tokenizer_state_t::BlockComment: return u >= 0x20 && c != '*';
+    default: return false;
+    }
+}
 
-struct tokenizer {
-    using iterator = typename std::string_view::const_iterator;
+constexpr bool checkRunChars(transitionTable_t const &r)
+{
+    for (uint8_t s = 0; s != NR_TOKENIZER_STATES; ++s) {
+        ttlet state = static_cast<tokenizer_state_t>(s);
+        auto run_action = tokenizer_action_t::Idle;
+        for (uint16_t i = 0; i != 256; ++i) {
+            ttlet c = static_cast<char>(i);
+            if (!is_run_char(state, c)) {
+                continue;
+            }
 
-    tokenizer_state_t state;
-    iterator index;
-    iterator end;
-    parse_location location;
-    parse_location captureLocation;
+            // All characters of a run must be either captured or not.
+            ttlet &transition = r[get_offset(state, c)];
+            if (run_action == tokenizer_action_t::Idle) {
+                run_action = transition.action;
+            }
+            if (transition.next != state || transition.c != c || transition.action != run_action ||
+                (run_action != tokenizer_action_t::Read && run_action != (tokenizer_action_t::Read | tokenizer_action_t::Capture))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
 
-    tokenizer(iterator begin, iterator end) :
-        state(tokenizer_state_t::Initial), index(begin), end(end) {}
+static_assert(checkRunChars(transitionTable), "A run character does not behave as a single read in the transition table.");
+
+/** Find the end of a run of characters.
+ *
+ * On x64 the characters are classified 16 at a time with SSE2 compares; the characters
+ * which remain, fewer than 16, are classified one at a time.
+ *
+ * @param state The current state of the tokenizer.
+ * @param first The first character to check.
+ * @param last One beyond the last character to check.
+ * @return A pointer to the first character which does not continue the run.
+ */
+[[nodiscard]] static char const *find_run_end(tokenizer_state_t state, char const *first, char const *last) noexcept
+{
+#if TT_PROCESSOR == TT_CPU_X64
+    ttlet splat = [](char c) {
+        return _mm_set1_epi8(c);
+    };
+
+    // Characters which are not part of the run set the corresponding bit in the mask.
+    ttlet stop_mask = [&](__m128i chunk) -> int {
+        // Signed compare, with the bias the unsigned characters below 0x20 are below -0x60.
+        ttlet is_control = _mm_cmplt_epi8(_mm_xor_si128(chunk, splat('\x80')), splat('\xa0'));
+
+        switch (state) {
+        case tokenizer_state_t::Initial:
+            return ~_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, splat(' '))) & 0xffff;
+
+        case tokenizer_state_t::Name: {
+            // Fold lower case onto upper case, letters then are a single range.
+            ttlet upper = _mm_andnot_si128(splat(0x20), chunk);
+            ttlet is_alpha = _mm_and_si128(_mm_cmpgt_epi8(upper, splat('A' - 1)), _mm_cmplt_epi8(upper, splat('Z' + 1)));
+            ttlet is_digit = _mm_and_si128(_mm_cmpgt_epi8(chunk, splat('0' - 1)), _mm_cmplt_epi8(chunk, splat('9' + 1)));
+            ttlet is_other = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(chunk, splat('_')), _mm_cmpeq_epi8(chunk, splat('$'))),
+                _mm_cmpeq_epi8(chunk, splat('-')));
+            return ~_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(is_alpha, is_digit), is_other)) & 0xffff;
+        }
 
-    /*! Parse a token.
-    */
-    [[nodiscard]] token_t getNextToken() {
-        auto token = token_t{};
+        case tokenizer_state_t::String:
+            return _mm_movemask_epi8(_mm_or_si128(
+                _mm_or_si128(is_control, _mm_cmpeq_epi8(chunk, splat('"'))), _mm_cmpeq_epi8(chunk, splat('\\'))));
 
-        auto transition = tokenizer_transition_t{};
-        while (index != end) {
-            transition = transitionTable[get_offset(state, *index)];
-            state = transition.next;
+        case tokenizer_state_t::LineComment:
+            return _mm_movemask_epi8(is_control);
 
-            auto action = transition.action;
-            if (action >= tokenizer_action_t::Start) {
-                token.location = location;
-                token.value.clear();
-            }
+        case tokenizer_state_t::BlockComment:
+            return _mm_movemask_epi8(_mm_or_si128(is_control, _mm_cmpeq_epi8(chunk, splat('*'))));
 
-            if (action >= tokenizer_action_t::Capture) {
-                token.value += transition.c;
-            }
+        default:
+            return 1;
+        }
+    };
 
-            if (action >= tokenizer_action_t::Read) {
-                if (action >= tokenizer_action_t::LineFeed) {
-                    location.increment_line();
-                } else if (action >= tokenizer_action_t::Tab) {
-                    location.tab_column();
-                } else {
-                    location.increment_column();
-                }
-                ++index;
-            }
+    while (last - first >= 16) {
+        ttlet chunk = _mm_loadu_si128(reinterpret_cast<__m128i const *>(first));
+        if (ttlet mask = stop_mask(chunk)) {
+            return first + std::countr_zero(static_cast<unsigned int>(mask));
+        }
+        first += 16;
+    }
+#endif
 
-            if (action >= tokenizer_action_t::Found) {
-                token.name = transition.name;
-                return token;
+    while (first != last && is_run_char(state, *first)) {
+        ++first;
+    }
+    return first;
+}
+
+
+tokenizer::tokenizer(iterator first, iterator last) noexcept : _state(tokenizer_state_t::Initial), _index(first), _last(last) {}
+
+void tokenizer::next(token_t &token) noexcept
+{
+    token.name = tokenizer_name_t::NotAssigned;
+    token.value.clear();
+    token.location = _location;
+    token.is_binary = false;
+    token.precedence = 0;
+
+    auto transition = tokenizer_transition_t{};
+    while (_index != _last) {
+        if (is_run_char(_state, *_index)) {
+            // Handle a run of characters at once, instead of one transition at a time.
+            ttlet first = &*_index;
+            ttlet run_size = find_run_end(_state, first, first + (_last - _index)) - first;
+
+            if (transitionTable[get_offset(_state, *_index)].action >= tokenizer_action_t::Capture) {
+                token.value.append(first, run_size);
             }
+            _location.increment_column(narrow_cast<int>(run_size));
+            _index += run_size;
+            continue;
         }
 
-        // Complete the token at the current state. Or an end-token at the initial state.
-        if (state == tokenizer_state_t::Initial) {
-            // Mark the current offset as the position of the end-token.
-            token.location = location;
+        transition = transitionTable[get_offset(_state, *_index)];
+        _state = transition.next;
+
+        auto action = transition.action;
+        if (action >= tokenizer_action_t::Start) {
+            token.location = _location;
             token.value.clear();
         }
 
-        transition = transitionTable[get_offset(state)];
-        state = transition.next;
+        if (action >= tokenizer_action_t::Capture) {
+            token.value += transition.c;
+        }
+
+        if (action >= tokenizer_action_t::Read) {
+            if (action >= tokenizer_action_t::LineFeed) {
+                _location.increment_line();
+            } else if (action >= tokenizer_action_t::Tab) {
+                _location.tab_column();
+            } else {
+                _location.increment_column();
+            }
+            ++_index;
+        }
 
-        token.name = transition.name;
-        return token;
+        if (action >= tokenizer_action_t::Found) {
+            token.name = transition.name;
+            return;
+        }
     }
 
-    /*! Parse all tokens.
-    */
-    [[nodiscard]] std::vector<token_t> getTokens() noexcept {
-        std::vector<token_t> r;
+    // Complete the token at the current state. Or an end-token at the initial state.
+    if (_state == tokenizer_state_t::Initial) {
+        // Mark the current offset as the position of the end-token.
+        token.location = _location;
+        token.value.clear();
+    }
 
-        tokenizer_name_t token_name;
-        do {
-            ttlet token = getNextToken();
-            token_name = token.name;
-            r.push_back(std::move(token));
-        } while (token_name != tokenizer_name_t::End);
+    transition = transitionTable[get_offset(_state)];
+    _state = transition.next;
 
-        return r;
-    }
-};
+    token.name = transition.name;
+}
 
 [[nodiscard]] std::vector<token_t> parseTokens(std::string_view::const_iterator first, std::string_view::const_iterator last) noexcept
 {
-    return tokenizer(first, last).getTokens();
+    std::vector<token_t> r;
+    auto t = tokenizer(first, last);
+
+    do {
+        r.push_back(t.next());
+    } while (r.back() != tokenizer_name_t::End);
+
+    return r;
 }
 
 [[nodiscard]] std::vector<token_t> parseTokens(std::string_view text) noexcept
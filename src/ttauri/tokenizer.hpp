@@ -256,6 +256,53 @@ struct parse_result {
     }
 };
 
+enum class tokenizer_state_t : uint8_t;
+
+/** A tokenizer which produces tokens one at a time.
+ *
+ * The tokenizer is a table driven state machine which does not look ahead, so a
+ * parser can pull tokens as it needs them, instead of tokenizing the whole text first.
+ * The tokenizer is small and cheap to copy; the text must outlive the tokenizer.
+ *
+ * See `parseTokens()` for the tokens that are recognized.
+ */
+class tokenizer {
+public:
+    using iterator = typename std::string_view::const_iterator;
+
+    tokenizer(iterator first, iterator last) noexcept;
+
+    explicit tokenizer(std::string_view text) noexcept : tokenizer(text.cbegin(), text.cend()) {}
+
+    tokenizer(tokenizer const &) = default;
+    tokenizer(tokenizer &&) noexcept = default;
+    tokenizer &operator=(tokenizer const &) = default;
+    tokenizer &operator=(tokenizer &&) noexcept = default;
+
+    /** Parse the next token.
+     * After the text is exhausted an End-token is returned for every call.
+     *
+     * @param [out] token The token to overwrite; the storage of its value is reused.
+     */
+    void next(token_t &token) noexcept;
+
+    /** Parse the next token.
+     * After the text is exhausted an End-token is returned for every call.
+     */
+    [[nodiscard]] token_t next() noexcept
+    {
+        auto r = token_t{};
+        next(r);
+        return r;
+    }
+
+private:
+    tokenizer_state_t _state;
+    iterator _index;
+    iterator _last;
+    parse_location _location;
+};
+
 /*! parse tokens from a text.
  * This parsing tokens from most programming languages.
  * It will recognize:
@@ -382,3 +382,58 @@ TEST(Tokenizer, ParseFQName) {
     ASSERT_TOKEN_EQ(tokens[3], End, "");
 }
 
+
+TEST(Tokenizer, Pull) {
+    auto str = "foo = \"a long string literal, longer than a small string\"\nbar";
+    auto v = std::string_view(str);
+    auto t = tokenizer(v);
+
+    auto token = token_t{};
+    t.next(token);
+    ASSERT_TOKEN_EQ(token, Name, "foo");
+    ASSERT_EQ(token.location.line(), 1);
+    ASSERT_EQ(token.location.column(), 1);
+
+    t.next(token);
+    ASSERT_TOKEN_EQ(token, Operator, "=");
+
+    t.next(token);
+    ASSERT_TOKEN_EQ(token, StringLiteral, "a long string literal, longer than a small string");
+    ttlet *const buffer = token.value.data();
+
+    t.next(token);
+    ASSERT_TOKEN_EQ(token, Name, "bar");
+    ASSERT_EQ(token.location.line(), 2);
+    ASSERT_EQ(token.location.column(), 1);
+    // The storage of the token's value is reused.
+    ASSERT_EQ(token.value.data(), buffer);
+
+    ASSERT_TOKEN_EQ(t.next(), End, "");
+    ASSERT_TOKEN_EQ(t.next(), End, "");
+
+    // The pull tokenizer produces the same tokens as parseTokens().
+    auto u = tokenizer(v);
+    for (ttlet &expected : parseTokens(v)) {
+        ttlet token = u.next();
+        ASSERT_EQ(token, expected);
+        ASSERT_EQ(token.location.line(), expected.location.line());
+        ASSERT_EQ(token.location.column(), expected.location.column());
+    }
+}
+
+TEST(Tokenizer, LongRuns) {
+    auto str =
+        "a_very_long_name_with-dashes-and-digits-0123456789 \"a string with \\\"escapes\\\" in a long run of text\""
+        "                                    # a line comment which is longer than sixteen characters\n"
+        "/* a block comment * with a star, longer than sixteen characters */ end";
+    auto v = std::string_view(str);
+    auto tokens = parseTokens(v);
+    ASSERT_TOKEN_EQ(tokens[0], Name, "a_very_long_name_with-dashes-and-digits-0123456789");
+    ASSERT_EQ(tokens[0].location.column(), 1);
+    ASSERT_TOKEN_EQ(tokens[1], StringLiteral, "a string with \"escapes\" in a long run of text");
+    ASSERT_EQ(tokens[1].location.column(), 52);
+    ASSERT_TOKEN_EQ(tokens[2], Name, "end");
+    ASSERT_EQ(tokens[2].location.line(), 2);
+    ASSERT_EQ(tokens[2].location.column(), 69);
+    ASSERT_TOKEN_EQ(tokens[3], End, "");
+}
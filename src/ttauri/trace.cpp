@@ -3,6 +3,14 @@
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #include "trace.hpp"
+#include "thread.hpp"
+#include "file.hpp"
+#include "unfair_mutex.hpp"
+#include <mutex>
+#include <vector>
+#include <memory>
+#include <map>
+#include <string>
 
 namespace tt {
 
@@ -14,4 +22,225 @@ void trace_record() noexcept
     }
 }
 
+/** The sample interval and registered tags.
+ */
+struct trace_tag_settings_type {
+    uint32_t interval = TRACE_DEFAULT_SAMPLE_INTERVAL;
+    std::atomic<uint32_t> *sample_interval = nullptr;
+};
+
+static std::mutex trace_tag_mutex;
+static std::map<std::string, trace_tag_settings_type, std::less<>> trace_tag_settings;
+
+static trace_tag_settings_type &trace_tag_settings_get(std::string_view tag) noexcept
+{
+    auto it = trace_tag_settings.find(tag);
+    if (it == trace_tag_settings.end()) {
+        it = trace_tag_settings.emplace(std::string{tag}, trace_tag_settings_type{}).first;
+    }
+    return it->second;
+}
+
+uint32_t trace_tag_register(std::string_view tag, std::atomic<uint32_t> &sample_interval) noexcept
+{
+    ttlet lock = std::scoped_lock(trace_tag_mutex);
+
+    auto &settings = trace_tag_settings_get(tag);
+    settings.sample_interval = &sample_interval;
+    sample_interval.store(settings.interval, std::memory_order::relaxed);
+    return settings.interval;
+}
+
+void trace_set_sample_interval(std::string_view tag, uint32_t interval) noexcept
+{
+    tt_axiom(interval != TRACE_SAMPLE_INTERVAL_UNREGISTERED);
+    ttlet lock = std::scoped_lock(trace_tag_mutex);
+
+    auto &settings = trace_tag_settings_get(tag);
+    settings.interval = interval;
+    if (settings.sample_interval) {
+        settings.sample_interval->store(interval, std::memory_order::relaxed);
+    }
+}
+
+/** The flight-recorder of a thread.
+ */
+struct trace_ring_type {
+    /** Locked by the thread when writing an event, and while the ring is read.
+     * This lock is only contended while the flight-recorder is dumped.
+     */
+    unfair_mutex_impl<false> mutex;
+
+    thread_id thread = 0;
+
+    /** The total number of events written, the oldest events are overwritten.
+     */
+    size_t head = 0;
+
+    /** Set when the thread has exited; the ring is reused by the next thread.
+     * The events of the exited thread are kept until then.
+     */
+    bool abandoned = false;
+
+    std::array<trace_event, MAX_NR_TRACE_EVENTS> events;
+};
+
+/** Protects trace_rings and trace_recorder_fatal_location.
+ */
+static std::mutex trace_rings_mutex;
+static std::vector<std::unique_ptr<trace_ring_type>> trace_rings;
+static std::optional<URL> trace_recorder_fatal_location;
+
+static thread_local trace_ring_type *trace_ring = nullptr;
+
+/** Set when the current thread's ring was released on thread exit.
+ */
+static thread_local bool trace_ring_released = false;
+
+/** Releases the ring of the thread on thread exit.
+ */
+struct trace_ring_owner {
+    trace_ring_type *ring;
+
+    ~trace_ring_owner()
+    {
+        trace_ring = nullptr;
+        trace_ring_released = true;
+
+        ttlet lock = std::scoped_lock(trace_rings_mutex);
+        ring->abandoned = true;
+    }
+};
+
+[[nodiscard]] static trace_ring_type *trace_ring_register() noexcept
+{
+    if (trace_ring_released) {
+        return nullptr;
+    }
+
+    trace_ring_type *ring = nullptr;
+    {
+        ttlet lock = std::scoped_lock(trace_rings_mutex);
+        for (ttlet &abandoned_ring : trace_rings) {
+            if (abandoned_ring->abandoned) {
+                ring = abandoned_ring.get();
+                break;
+            }
+        }
+
+        if (ring == nullptr) {
+            ring = trace_rings.emplace_back(std::make_unique<trace_ring_type>()).get();
+        }
+
+        ttlet ring_lock = std::scoped_lock(ring->mutex);
+        ring->thread = current_thread_id();
+        ring->head = 0;
+        ring->abandoned = false;
+    }
+
+    thread_local trace_ring_owner owner{ring};
+    return trace_ring = ring;
+}
+
+void trace_recorder_write(trace_event const &event) noexcept
+{
+    auto ring = trace_ring;
+    if (ring == nullptr) {
+        if ((ring = trace_ring_register()) == nullptr) {
+            return;
+        }
+    }
+
+    ttlet lock = std::scoped_lock(ring->mutex);
+    ring->events[ring->head++ % MAX_NR_TRACE_EVENTS] = event;
+}
+
+void trace_recorder_start() noexcept
+{
+    trace_recorder_is_running.store(true, std::memory_order::relaxed);
+}
+
+void trace_recorder_stop() noexcept
+{
+    trace_recorder_is_running.store(false, std::memory_order::relaxed);
+}
+
+[[nodiscard]] std::string trace_recorder_to_json() noexcept
+{
+    auto r = std::string{"{\"displayTimeUnit\":\"ns\",\"traceEvents\":["};
+
+    auto events = std::vector<trace_event>{};
+    auto first_event = true;
+
+    ttlet lock = std::scoped_lock(trace_rings_mutex);
+    for (ttlet &ring : trace_rings) {
+        // Copy the events while holding the lock for as short as possible, the thread is blocked meanwhile.
+        events.clear();
+        thread_id thread;
+        {
+            ttlet ring_lock = std::scoped_lock(ring->mutex);
+            thread = ring->thread;
+
+            ttlet first = ring->head > MAX_NR_TRACE_EVENTS ? ring->head - MAX_NR_TRACE_EVENTS : size_t{0};
+            for (auto i = first; i != ring->head; ++i) {
+                events.push_back(ring->events[i % MAX_NR_TRACE_EVENTS]);
+            }
+        }
+
+        // Complete-events ("X") on the same thread are nested by the viewer based on their time span.
+        for (ttlet &event : events) {
+            ttlet begin = hires_utc_clock::make(event.begin).time_since_epoch();
+            ttlet duration = event.end.time_since_epoch() - event.begin.time_since_epoch();
+
+            if (!std::exchange(first_event, false)) {
+                r += ',';
+            }
+            r += fmt::format(
+                "\n{{\"name\":\"{}\",\"cat\":\"trace\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f},"
+                "\"args\":{{\"id\":{},\"parent_id\":{}}}}}",
+                event.tag,
+                thread,
+                static_cast<double>(begin.count()) / 1000.0,
+                static_cast<double>(duration.count()) / 1000.0,
+                event.id,
+                event.parent_id);
+        }
+    }
+
+    r += "\n]}\n";
+    return r;
+}
+
+void trace_recorder_dump(URL const &location)
+{
+    ttlet json = trace_recorder_to_json();
+
+    auto file = tt::file(location, access_mode::truncate_or_create_for_write);
+    file.write(std::string_view{json});
+    file.close();
+}
+
+void trace_recorder_set_fatal_dump_location(std::optional<URL> location) noexcept
+{
+    ttlet lock = std::scoped_lock(trace_rings_mutex);
+    trace_recorder_fatal_location = std::move(location);
+}
+
+void trace_recorder_fatal_dump() noexcept
+{
+    auto location = std::optional<URL>{};
+    {
+        ttlet lock = std::scoped_lock(trace_rings_mutex);
+        location = trace_recorder_fatal_location;
+    }
+
+    if (location) {
+        try {
+            trace_recorder_dump(*location);
+        } catch (...) {
+            // We are already terminating on a fatal error.
+        }
+    }
+}
+
 }
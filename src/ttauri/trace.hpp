@@ -4,6 +4,7 @@
 
 #include "counters.hpp"
 #include "datum.hpp"
+#include "URL.hpp"
 #include "logger.hpp"
 #include "time_stamp_count.hpp"
 #include "hires_utc_clock.hpp"
@@ -12,6 +13,8 @@
 #include "wfree_message_queue.hpp"
 #include "fixed_string.hpp"
 #include "statistics.hpp"
+#include "latency_histogram.hpp"
+#include "allocation_tracker.hpp"
 #include <fmt/ostream.h>
 #include <fmt/format.h>
 #include <atomic>
@@ -20,6 +23,10 @@
 #include <ostream>
 #include <typeinfo>
 #include <typeindex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <limits>
 
 #pragma once
 
@@ -30,6 +37,10 @@ constexpr int MAX_NR_TRACES = 1024;
 
 inline std::atomic<int64_t> trace_id = 0;
 
+/** The number of trace ids a thread takes from `trace_id` at once.
+ */
+constexpr int64_t TRACE_ID_BLOCK_SIZE = 1024;
+
 struct trace_stack_type {
     /*! The trace id of the trace at the top of the thread's stack.
     */
@@ -43,18 +54,34 @@ struct trace_stack_type {
     */
     int8_t record_depth = 0;
 
+    /*! The next trace id to use, and the end of the block of ids reserved by this thread.
+    * Reserving ids in blocks avoids an atomic operation on a shared cache line for each trace.
+    */
+    int64_t next_trace_id = 0;
+    int64_t last_trace_id = 0;
+
     /*! Push a trace on the trace stack.
     * Traces are in reality already on the thread's actual stack.
     * This function will update a virtual stack of traces.
     * \return parent_id
     */
     inline int64_t push() noexcept {
+        if (next_trace_id == last_trace_id) {
+            [[unlikely]] reserve_trace_ids();
+        }
+
         ttlet parent_id = top_trace_id;
-        top_trace_id = trace_id.fetch_add(1, std::memory_order::relaxed) + 1;
+        top_trace_id = next_trace_id++;
         depth++;
         return parent_id;
     }
 
+    tt_no_inline void reserve_trace_ids() noexcept {
+        // Trace ids start at 1, zero means no parent.
+        next_trace_id = trace_id.fetch_add(TRACE_ID_BLOCK_SIZE, std::memory_order::relaxed) + 1;
+        last_trace_id = next_trace_id + TRACE_ID_BLOCK_SIZE;
+    }
+
     /*! pop a trace from the trace stack.
     * Traces are in reality already on the thread's actual stack.
     * This function will update a virtual stack of traces.
@@ -79,6 +106,58 @@ inline thread_local trace_stack_type trace_stack;
 */
 void trace_record() noexcept;
 
+/** A completed trace, as stored by the trace recorder.
+ */
+struct trace_event {
+    /** The tag of the trace, a string literal.
+     */
+    char const *tag;
+    int64_t id;
+    int64_t parent_id;
+    time_stamp_count begin;
+    time_stamp_count end;
+};
+
+/** Maximum number of events in the flight-recorder of each thread.
+ * When full the oldest events are overwritten.
+ */
+constexpr size_t MAX_NR_TRACE_EVENTS = 4096;
+
+inline std::atomic<bool> trace_recorder_is_running = false;
+
+/** Record a completed trace in the flight-recorder of the current thread.
+ */
+void trace_recorder_write(trace_event const &event) noexcept;
+
+/** Start recording every completed trace into the per-thread flight-recorders.
+ */
+void trace_recorder_start() noexcept;
+
+/** Stop recording traces.
+ * The recorded traces are kept so that they can still be dumped.
+ */
+void trace_recorder_stop() noexcept;
+
+/** Get the recorded traces in the Chrome Trace Event JSON format.
+ * The result can be opened in chrome://tracing or https://ui.perfetto.dev.
+ */
+[[nodiscard]] std::string trace_recorder_to_json() noexcept;
+
+/** Write the recorded traces to a file in the Chrome Trace Event JSON format.
+ * @throws io_error When the file could not be written.
+ */
+void trace_recorder_dump(URL const &location);
+
+/** Set the file to dump the flight-recorder to on a fatal error.
+ * @param location The file to write, or nullopt to not dump on a fatal error.
+ */
+void trace_recorder_set_fatal_dump_location(std::optional<URL> location) noexcept;
+
+/** Dump the flight-recorder to the location set with `trace_recorder_set_fatal_dump_location()`.
+ * Called by the logger on a fatal error.
+ */
+void trace_recorder_fatal_dump() noexcept;
+
 template<basic_fixed_string Tag, basic_fixed_string... InfoTags>
 struct trace_data {
     /*! id of the parent trace.
@@ -152,6 +231,10 @@ private:
     std::atomic<long long> peak_duration = {};
     std::atomic<long long> version = 0;
 
+    /*! Durations since the previous read, for the percentiles.
+     */
+    latency_histogram histogram;
+
     // Variables used by logger.
     long long prev_count = 0;
     std::chrono::nanoseconds prev_duration = {};
@@ -168,14 +251,14 @@ public:
 
         duration.fetch_add(d.count(), std::memory_order::relaxed);
 
+        // Only when the peak changes the compare-exchange is needed.
         auto prev_peak = peak_duration.load(std::memory_order::relaxed);
-        decltype(prev_peak) new_peak;
-        do {
-            new_peak = d.count() > prev_peak ? d.count() : prev_peak;
-        } while (!peak_duration.compare_exchange_weak(prev_peak, new_peak, std::memory_order::relaxed));
+        while (d.count() > prev_peak && !peak_duration.compare_exchange_weak(prev_peak, d.count(), std::memory_order::relaxed)) {}
 
         version.store(current_count + 1, std::memory_order::release);
-        
+
+        histogram.write(d);
+
         return current_count == 0;
     }
 
@@ -186,6 +269,13 @@ public:
         std::chrono::nanoseconds duration;
         std::chrono::nanoseconds last_duration;
         std::chrono::nanoseconds peak_duration;
+
+        /*! Percentiles of the durations since the previous read.
+         */
+        std::chrono::nanoseconds p50;
+        std::chrono::nanoseconds p90;
+        std::chrono::nanoseconds p99;
+        std::chrono::nanoseconds p999;
     };
 
     read_result read() {
@@ -210,6 +300,12 @@ public:
 
         prev_count = r.count;
         prev_duration = r.duration;
+
+        ttlet histogram_result = histogram.read();
+        r.p50 = histogram_result.percentile(0.5);
+        r.p90 = histogram_result.percentile(0.9);
+        r.p99 = histogram_result.percentile(0.99);
+        r.p999 = histogram_result.percentile(0.999);
         return r;
     }
 };
@@ -219,20 +315,110 @@ inline trace_statistics_type trace_statistics;
 
 inline wfree_unordered_map<std::string,trace_statistics_type *,MAX_NR_TRACES> trace_statistics_map;
 
+template<basic_fixed_string Tag>
+tt_no_inline void trace_statistics_add_to_map() noexcept
+{
+    trace_statistics_map.insert(Tag, &trace_statistics<Tag>);
+    statistics_start();
+}
+
+/*! Add a duration to the statistics of a trace.
+ * This is used for durations that are not measured on the CPU by a trace, such as GPU timestamps.
+ */
+template<basic_fixed_string Tag>
+void trace_statistics_write(std::chrono::nanoseconds duration) noexcept
+{
+    if (trace_statistics<Tag>.write(duration)) {
+        [[unlikely]] trace_statistics_add_to_map<Tag>();
+    }
+}
+
+
+/** Compile-time enablement of a trace tag.
+ * Specialize to false to remove all traces with this tag from the binary:
+ *
+ * ```
+ * template<> constexpr bool trace_tag_is_compiled<"window_render"> = false;
+ * ```
+ *
+ * When `TT_DISABLE_TRACES` is defined all traces are removed.
+ */
+template<basic_fixed_string Tag>
+#if defined(TT_DISABLE_TRACES)
+constexpr bool trace_tag_is_compiled = false;
+#else
+constexpr bool trace_tag_is_compiled = true;
+#endif
+
+/** The sample interval used for tags that were not configured with `trace_set_sample_interval()`.
+ */
+constexpr uint32_t TRACE_DEFAULT_SAMPLE_INTERVAL = 1;
+
+/** The sample interval of a tag before it is used for the first time.
+ */
+constexpr uint32_t TRACE_SAMPLE_INTERVAL_UNREGISTERED = std::numeric_limits<uint32_t>::max();
+
+/** The sample interval of a trace tag.
+ * - 0: the tag is disabled.
+ * - 1: every trace is recorded.
+ * - N: one in N traces is recorded, counted per thread.
+ */
+template<basic_fixed_string Tag>
+inline std::atomic<uint32_t> trace_sample_interval = TRACE_SAMPLE_INTERVAL_UNREGISTERED;
+
+template<basic_fixed_string Tag>
+inline thread_local uint32_t trace_sample_counter = 0;
+
+/** Register a tag, so that its sample interval can be changed by name.
+ * @return The configured sample interval for the tag.
+ */
+uint32_t trace_tag_register(std::string_view tag, std::atomic<uint32_t> &sample_interval) noexcept;
+
+/** Set the sample interval of a trace tag.
+ * This may be called before the tag is used for the first time.
+ *
+ * Sampled traces only update the statistics and the recorder for the traces that are sampled.
+ *
+ * @param tag The tag of the trace.
+ * @param interval 0 to disable the tag, N to record one in N traces.
+ */
+void trace_set_sample_interval(std::string_view tag, uint32_t interval) noexcept;
+
+/** Check if the next trace with this tag should be recorded.
+ */
+template<basic_fixed_string Tag>
+[[nodiscard]] bool trace_is_sampled() noexcept
+{
+    auto interval = trace_sample_interval<Tag>.load(std::memory_order::relaxed);
+    if (interval == 1) {
+        [[likely]] return true;
+
+    } else if (interval == TRACE_SAMPLE_INTERVAL_UNREGISTERED) {
+        interval = trace_tag_register(static_cast<char const *>(Tag), trace_sample_interval<Tag>);
+    }
+
+    if (interval == 0) {
+        return false;
+    } else if (++trace_sample_counter<Tag> >= interval) {
+        trace_sample_counter<Tag> = 0;
+        return true;
+    } else {
+        return false;
+    }
+}
 
 template<basic_fixed_string Tag, basic_fixed_string... InfoTags>
 class trace final {
     // If this pointer is not an volatile, clang will optimize it away and replacing it
     // with direct access to the trace_stack variable. This trace_stack variable is in local storage,
     // so a lot of instructions and memory accesses are emitted by the compiler multiple times.
+    // nullptr when this trace is not sampled.
     trace_stack_type * volatile stack;
 
     trace_data<Tag, InfoTags...> data;
 
-    tt_no_inline static void add_to_map() {
-        trace_statistics_map.insert(Tag, &trace_statistics<Tag>);
-        statistics_start();
-    }
+    // The allocation counters of the enclosing trace, restored by the destructor.
+    detail::allocation_tag_counters *allocation_parent = nullptr;
 
 public:
     /*! The constructor will make the start of a trace.
@@ -240,23 +426,48 @@ public:
      * start_trace() should be the only function that will cause this constructor to
      * be executed. start_trace will place this onto current_trace and set this' parent.
      */
-    trace() :
-        stack(&trace_stack), data(time_stamp_count::now())
+    trace() : stack(nullptr)
     {
-        // We don't need to know our own id, until the destructor is called.
-        // Our id will be at the top of the stack.
-        data.parent_id = stack->push();
+        if constexpr (trace_tag_is_compiled<Tag>) {
+            if (trace_is_sampled<Tag>()) {
+                [[likely]] stack = &trace_stack;
+                data.time_stamp = time_stamp_count::now();
+
+                // We don't need to know our own id, until the destructor is called.
+                // Our id will be at the top of the stack.
+                data.parent_id = stack->push();
+            }
+
+            if constexpr (allocation_tracking_is_enabled) {
+                // Allocations are attributed to the innermost trace, also when it is not sampled.
+                allocation_parent = std::exchange(detail::allocation_thread.tag, detail::allocation_tag_counters_get<Tag>());
+            }
+        }
     }
 
     ~trace() {
-        ttlet end_time_stamp = time_stamp_count::now();
+        if constexpr (!trace_tag_is_compiled<Tag>) {
+            return;
+        }
+
+        if constexpr (allocation_tracking_is_enabled) {
+            detail::allocation_thread.tag = allocation_parent;
+        }
 
-        if (trace_statistics<Tag>.write(end_time_stamp.time_since_epoch() - data.time_stamp.time_since_epoch())) {
-            [[unlikely]] add_to_map();
+        if (stack == nullptr) {
+            return;
         }
 
+        ttlet end_time_stamp = time_stamp_count::now();
+
+        trace_statistics_write<Tag>(end_time_stamp.time_since_epoch() - data.time_stamp.time_since_epoch());
+
         ttlet [id, is_recording] = stack->pop(data.parent_id);
 
+        if (trace_recorder_is_running.load(std::memory_order::relaxed)) {
+            [[unlikely]] trace_recorder_write({static_cast<char const *>(Tag), id, data.parent_id, data.time_stamp, end_time_stamp});
+        }
+
         // Send the log to the log thread.
         if (is_recording) {
             [[unlikely]] tt_log_trace("id={} {}", id, std::move(data));
@@ -270,7 +481,11 @@ public:
 
     template<basic_fixed_string InfoTag, typename T>
     trace &set(T &&value) {
-        data.template get<InfoTag>() = std::forward<T>(value);
+        if constexpr (trace_tag_is_compiled<Tag>) {
+            if (stack != nullptr) {
+                data.template get<InfoTag>() = std::forward<T>(value);
+            }
+        }
         return *this;
     }
 };
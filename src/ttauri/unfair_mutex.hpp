@@ -8,6 +8,9 @@
 #include "thread.hpp"
 #include "assert.hpp"
 #include "dead_lock_detector.hpp"
+#include "counters.hpp"
+#include "fixed_string.hpp"
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <thread>
@@ -28,8 +31,18 @@ namespace tt {
  *     - lock(): MOV r,1; XOR r,r; LOCK CMPXCHG; JNE (skip)
  *     - unlock(): LOCK XADD [],-1; CMP; JE
  * 
+ * When contended, lock() first spins for a short while before waiting on the
+ * operating system. The number of spins adapts to how long it took to acquire
+ * this mutex recently, so that a mutex with short critical sections rarely causes
+ * a context switch, while a mutex with long critical sections quickly stops spinning.
+ *
+ * @tparam UseDeadLockDetector Check the order of locks.
+ * @tparam CounterTag When not empty, the counters "<CounterTag>:contended" and
+ *         "<CounterTag>:wait" count the contended locks and the waits on the operating system.
+ *         Without the dead-lock detector, a mutex with a tag also takes part in
+ *         the `lock_order_detector`, which is cheap enough for release builds.
  */
-template<bool UseDeadLockDetector>
+template<bool UseDeadLockDetector, basic_fixed_string CounterTag = "">
 class unfair_mutex_impl {
 public:
     unfair_mutex_impl() noexcept {}
@@ -56,10 +69,14 @@ public:
         // Switch to 1 means there are no waiters.
         uint32_t expected = 0;
         if (!semaphore.compare_exchange_strong(expected, 1, std::memory_order::acquire)) {
-            [[unlikely]] lock_contented(expected);
+            [[unlikely]] lock_contended(expected);
         }
 
         tt_axiom(semaphore.load() <= 2);
+
+        if constexpr (use_lock_order_detector) {
+            lock_order_detector::lock(lock_order_id, CounterTag.data());
+        }
     }
 
     /**
@@ -89,6 +106,10 @@ public:
         }
 
         tt_axiom(semaphore.load() <= 2);
+
+        if constexpr (use_lock_order_detector) {
+            lock_order_detector::lock(lock_order_id, CounterTag.data());
+        }
         return true;
     }
 
@@ -97,20 +118,34 @@ public:
             dead_lock_detector::unlock(this);
         }
 
+        if constexpr (use_lock_order_detector) {
+            lock_order_detector::unlock(lock_order_id);
+        }
+
         tt_axiom(semaphore.load() <= 2);
 
-        if (semaphore.fetch_sub(1, std::memory_order::relaxed) != 1) {
+        // The release must be on the fetch_sub itself; a fence after it does not order the
+        // writes of the critical section before the unlock. On x86 this is the same LOCK XADD.
+        if (semaphore.fetch_sub(1, std::memory_order::release) != 1) {
             [[unlikely]] semaphore.store(0, std::memory_order::release);
 
             semaphore.notify_one();
-        } else {
-            atomic_thread_fence(std::memory_order::release);
         }
 
         tt_axiom(semaphore.load() <= 2);
     }
 
 private:
+    /** The maximum number of spins before waiting on the operating system.
+     * Each spin lasts between 10 and 140 cycles depending on the CPU.
+     */
+    static constexpr int maximum_nr_spins = 100;
+
+    static constexpr auto contended_counter_tag = CounterTag + basic_fixed_string(":contended");
+    static constexpr auto wait_counter_tag = CounterTag + basic_fixed_string(":wait");
+
+    static constexpr bool use_lock_order_detector = !UseDeadLockDetector && CounterTag.size() != 0;
+
     /*
      * semaphore value:
      *  0 - Unlocked, no other thread is waiting.
@@ -119,10 +154,58 @@ private:
      */
     std::atomic<uint32_t> semaphore = 0;
 
-    tt_no_inline void lock_contented(uint32_t expected) noexcept
+    /** A moving average of the number of spins needed to acquire a contended lock.
+     */
+    std::atomic<uint32_t> spin_budget = 0;
+
+    /** The id in the lock_order_detector, only accessed while holding the lock.
+     */
+    uint8_t lock_order_id = lock_order_detector::unassigned_id;
+
+    /** Spin for a while, in the hope that the lock is released soon.
+     *
+     * @return True when the lock was acquired.
+     */
+    [[nodiscard]] bool spin_lock() noexcept
+    {
+        ttlet budget = static_cast<int>(spin_budget.load(std::memory_order::relaxed));
+        ttlet max_nr_spins = std::min(maximum_nr_spins, budget * 2 + 10);
+
+        auto nr_spins = 0;
+        auto acquired = false;
+        while (nr_spins < max_nr_spins) {
+            ++nr_spins;
+            cpu_pause();
+
+            // Only try to acquire the lock when it looks free, so that the cache line is not
+            // taken away from the thread holding the lock.
+            if (semaphore.load(std::memory_order::relaxed) == 0) {
+                uint32_t expected = 0;
+                if (semaphore.compare_exchange_weak(expected, 1, std::memory_order::acquire)) {
+                    acquired = true;
+                    break;
+                }
+            }
+        }
+
+        // Move the budget an eighth of the way towards the number of spins that were needed.
+        spin_budget.store(static_cast<uint32_t>(budget + (nr_spins - budget) / 8), std::memory_order::relaxed);
+        return acquired;
+    }
+
+    tt_no_inline void lock_contended(uint32_t expected) noexcept
     {
         tt_axiom(semaphore.load() <= 2);
 
+        if constexpr (CounterTag.size() != 0) {
+            increment_counter<contended_counter_tag>();
+        }
+
+        if (spin_lock()) {
+            return;
+        }
+        expected = semaphore.load(std::memory_order::relaxed);
+
         do {
             ttlet should_wait = expected == 2;
 
@@ -130,6 +213,9 @@ private:
             expected = 1;
             if (should_wait || semaphore.compare_exchange_strong(expected, 2)) {
                 tt_axiom(semaphore.load() <= 2);
+                if constexpr (CounterTag.size() != 0) {
+                    increment_counter<wait_counter_tag>();
+                }
                 semaphore.wait(2);
             }
 
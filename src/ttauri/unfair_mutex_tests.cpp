@@ -0,0 +1,68 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/unfair_mutex.hpp"
+#include "ttauri/unfair_recursive_mutex.hpp"
+#include "ttauri/counters.hpp"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace tt;
+
+TEST(UnfairMutex, Contended)
+{
+    auto mutex = unfair_mutex_impl<false, "test_mutex">{};
+    auto count = 0;
+
+    auto threads = std::vector<std::thread>{};
+    for (int i = 0; i != 4; ++i) {
+        threads.emplace_back([&mutex, &count] {
+            for (int j = 0; j != 100'000; ++j) {
+                ttlet lock = std::scoped_lock(mutex);
+                ++count;
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(count, 400'000);
+}
+
+TEST(UnfairMutex, Counters)
+{
+    using namespace std::literals::chrono_literals;
+
+    auto mutex = unfair_mutex_impl<false, "test_counted_mutex">{};
+
+    mutex.lock();
+    auto thread = std::thread([&mutex] {
+        ttlet lock = std::scoped_lock(mutex);
+    });
+
+    // Hold the lock longer than the other thread spins, so that it has to wait.
+    std::this_thread::sleep_for(100ms);
+    mutex.unlock();
+    thread.join();
+
+    ASSERT_EQ(read_counter<"test_counted_mutex:contended">(), 1);
+    ASSERT_GE(read_counter<"test_counted_mutex:wait">(), 1);
+}
+
+TEST(UnfairMutex, Recursive)
+{
+    auto mutex = unfair_recursive_mutex_impl<"test_recursive_mutex">{};
+
+    mutex.lock();
+    mutex.lock();
+    ASSERT_EQ(mutex.recurse_lock_count(), 2);
+    mutex.unlock();
+    mutex.unlock();
+    ASSERT_EQ(mutex.recurse_lock_count(), 0);
+}
@@ -28,8 +28,10 @@ namespace tt {
  *     - lock(): LEA, 2*MOV r,[]; CMP; JNE (skip); LEA, INC [], JMP
  *     - unlock(): ADD [],-1; JNE
  *
+ * @tparam CounterTag The counter tag of the underlying `unfair_mutex_impl`.
  */
-class unfair_recursive_mutex {
+template<basic_fixed_string CounterTag = "">
+class unfair_recursive_mutex_impl {
     /* Thread annotation syntax.
      * 
      * FIRST - The thread that acquires/acquired the mutex
@@ -37,7 +39,7 @@ class unfair_recursive_mutex {
      * OTHER - Another thread while the mutex is held.
      */
 
-    unfair_mutex_impl<false> mutex;
+    unfair_mutex_impl<false, CounterTag> mutex;
 
     // FIRST=write, OWNER|OTHER=read
     std::atomic<thread_id> owner = 0;
@@ -46,11 +48,11 @@ class unfair_recursive_mutex {
     uint32_t count = 0;
 
 public:
-    unfair_recursive_mutex(unfair_recursive_mutex const &) = delete;
-    unfair_recursive_mutex &operator=(unfair_recursive_mutex const &) = delete;
+    unfair_recursive_mutex_impl(unfair_recursive_mutex_impl const &) = delete;
+    unfair_recursive_mutex_impl &operator=(unfair_recursive_mutex_impl const &) = delete;
 
-    unfair_recursive_mutex() = default;
-    ~unfair_recursive_mutex() = default;
+    unfair_recursive_mutex_impl() = default;
+    ~unfair_recursive_mutex_impl() = default;
 
     /** This function should be used in tt_axiom() to check if the lock is held by current thread.
      *
@@ -182,6 +184,6 @@ public:
 
 };
 
-
+using unfair_recursive_mutex = unfair_recursive_mutex_impl<>;
 
 }
@@ -0,0 +1,347 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "required.hpp"
+#include "thread.hpp"
+#include "assert.hpp"
+#include "dead_lock_detector.hpp"
+#include "counters.hpp"
+#include "fixed_string.hpp"
+#include <atomic>
+#include <thread>
+
+namespace tt {
+
+/** An unfair recursive shared/exclusive mutex.
+ *
+ * The exclusive lock is recursive, like `unfair_recursive_mutex`. A thread that holds
+ * the exclusive lock may also take shared locks, which then count as recursive exclusive locks.
+ *
+ * Shared locks are taken whenever the mutex is not locked exclusively, even when another
+ * thread is waiting for the exclusive lock. This makes it possible to recursively take
+ * shared locks without tracking the readers, at the cost of possibly starving a writer when
+ * there is a continuous stream of readers.
+ *
+ * A thread that holds a shared lock must not take the exclusive lock; this would dead-lock.
+ *
+ * @tparam CounterTag When not empty, the counters "<CounterTag>:contended" and
+ *         "<CounterTag>:wait" count the contended locks and the waits on the operating system.
+ *         A mutex with a tag also takes part in the `lock_order_detector`.
+ */
+template<basic_fixed_string CounterTag = "">
+class unfair_recursive_shared_mutex_impl {
+public:
+    unfair_recursive_shared_mutex_impl() noexcept
+    {
+        if constexpr (use_lock_order_detector) {
+            // Shared locks are taken by multiple threads at once, so the id is assigned up front.
+            lock_order_id = lock_order_detector::assign_id(CounterTag.data());
+        }
+    }
+
+    unfair_recursive_shared_mutex_impl(unfair_recursive_shared_mutex_impl const &) = delete;
+    unfair_recursive_shared_mutex_impl(unfair_recursive_shared_mutex_impl &&) = delete;
+    unfair_recursive_shared_mutex_impl &operator=(unfair_recursive_shared_mutex_impl const &) = delete;
+    unfair_recursive_shared_mutex_impl &operator=(unfair_recursive_shared_mutex_impl &&) = delete;
+    ~unfair_recursive_shared_mutex_impl() = default;
+
+    /** This function should be used in tt_axiom() to check if the exclusive lock is held by current thread.
+     *
+     * @return The number of recursive exclusive locks the current thread has taken.
+     * @retval 0 The current thread does not have an exclusive lock.
+     */
+    [[nodiscard]] int recurse_lock_count() const noexcept
+    {
+        if (owner.load(std::memory_order::acquire) == current_thread_id()) {
+            return count;
+        } else {
+            return 0;
+        }
+    }
+
+    /** This function should be used in tt_axiom() to check if a shared or exclusive lock is held
+     * by current thread.
+     *
+     * The shared locks are counted per thread for each instantiation of this template, not for
+     * each mutex; give each mutex its own `CounterTag` when this matters.
+     *
+     * @return The number of recursive shared and exclusive locks the current thread has taken.
+     */
+    [[nodiscard]] int recurse_shared_lock_count() const noexcept
+    {
+        return recurse_lock_count() + shared_count;
+    }
+
+    /**
+     * When `try_lock()` is called on a thread that already holds the lock true is returned.
+     */
+    [[nodiscard]] bool try_lock() noexcept
+    {
+#if TT_BUILD_TYPE == TT_BT_DEBUG
+        dead_lock_detector::lock(this, true);
+#endif
+
+        ttlet thread_id = current_thread_id();
+        if (owner.load(std::memory_order::acquire) == thread_id) {
+            tt_axiom(count != 0);
+            ++count;
+            return true;
+        }
+
+        tt_axiom(shared_count == 0, "Upgrading a shared lock to an exclusive lock dead-locks");
+        uint32_t expected = 0;
+        if (state.compare_exchange_strong(expected, exclusive_bit, std::memory_order::acquire)) {
+            tt_axiom(count == 0);
+            count = 1;
+            owner.store(thread_id, std::memory_order::release);
+            if constexpr (use_lock_order_detector) {
+                lock_order_detector::lock(lock_order_id, CounterTag.data());
+            }
+            return true;
+        }
+
+#if TT_BUILD_TYPE == TT_BT_DEBUG
+        dead_lock_detector::unlock(this);
+#endif
+        return false;
+    }
+
+    void lock() noexcept
+    {
+#if TT_BUILD_TYPE == TT_BT_DEBUG
+        dead_lock_detector::lock(this, true);
+#endif
+
+        ttlet thread_id = current_thread_id();
+        if (owner.load(std::memory_order::acquire) == thread_id) {
+            tt_axiom(count != 0);
+            ++count;
+            return;
+        }
+
+        tt_axiom(shared_count == 0, "Upgrading a shared lock to an exclusive lock dead-locks");
+        uint32_t expected = 0;
+        if (!state.compare_exchange_strong(expected, exclusive_bit, std::memory_order::acquire)) {
+            [[unlikely]] lock_contended();
+        }
+
+        tt_axiom(count == 0);
+        count = 1;
+        owner.store(thread_id, std::memory_order::release);
+        if constexpr (use_lock_order_detector) {
+            lock_order_detector::lock(lock_order_id, CounterTag.data());
+        }
+    }
+
+    void unlock() noexcept
+    {
+#if TT_BUILD_TYPE == TT_BT_DEBUG
+        dead_lock_detector::unlock(this);
+#endif
+
+        tt_axiom(recurse_lock_count(), "Unlock must be called on the thread that locked the mutex");
+        if (--count == 0) {
+            if constexpr (use_lock_order_detector) {
+                lock_order_detector::unlock(lock_order_id);
+            }
+            owner.store(0, std::memory_order::release);
+
+            if (state.exchange(0, std::memory_order::release) & waiting_bit) {
+                [[unlikely]] state.notify_all();
+            }
+        }
+    }
+
+    /**
+     * When `try_lock_shared()` is called on a thread that already holds the exclusive lock true is returned.
+     */
+    [[nodiscard]] bool try_lock_shared() noexcept
+    {
+#if TT_BUILD_TYPE == TT_BT_DEBUG
+        dead_lock_detector::lock(this, true);
+#endif
+
+        if (owner.load(std::memory_order::acquire) == current_thread_id()) {
+            ++count;
+            return true;
+        }
+
+        auto expected = state.load(std::memory_order::relaxed);
+        while ((expected & exclusive_bit) == 0) {
+            if (state.compare_exchange_weak(expected, expected + 1, std::memory_order::acquire)) {
+                lock_shared_finish();
+                return true;
+            }
+        }
+
+#if TT_BUILD_TYPE == TT_BT_DEBUG
+        dead_lock_detector::unlock(this);
+#endif
+        return false;
+    }
+
+    void lock_shared() noexcept
+    {
+#if TT_BUILD_TYPE == TT_BT_DEBUG
+        dead_lock_detector::lock(this, true);
+#endif
+
+        if (owner.load(std::memory_order::acquire) == current_thread_id()) {
+            // The exclusive lock is already held by this thread.
+            ++count;
+            return;
+        }
+
+        auto expected = state.load(std::memory_order::relaxed);
+        if ((expected & exclusive_bit) != 0 ||
+            !state.compare_exchange_strong(expected, expected + 1, std::memory_order::acquire)) {
+            [[unlikely]] lock_shared_contended();
+        }
+        lock_shared_finish();
+    }
+
+    void unlock_shared() noexcept
+    {
+        if (owner.load(std::memory_order::acquire) == current_thread_id()) {
+            // The shared lock was taken while holding the exclusive lock.
+            unlock();
+            return;
+        }
+
+#if TT_BUILD_TYPE == TT_BT_DEBUG
+        dead_lock_detector::unlock(this);
+#endif
+
+        tt_axiom(shared_count > 0, "Unlock must be called on the thread that locked the mutex");
+        if (--shared_count == 0) {
+            if constexpr (use_lock_order_detector) {
+                lock_order_detector::unlock(lock_order_id);
+            }
+        }
+
+        if (state.fetch_sub(1, std::memory_order::release) == (waiting_bit | 1)) {
+            // The last reader wakes up the threads waiting for the exclusive lock.
+            [[unlikely]] wake_waiters();
+        }
+    }
+
+private:
+    /** The maximum number of spins before waiting on the operating system.
+     */
+    static constexpr int maximum_nr_spins = 100;
+
+    static constexpr auto contended_counter_tag = CounterTag + basic_fixed_string(":contended");
+    static constexpr auto wait_counter_tag = CounterTag + basic_fixed_string(":wait");
+
+    static constexpr bool use_lock_order_detector = CounterTag.size() != 0;
+
+    /** The exclusive lock is held.
+     */
+    static constexpr uint32_t exclusive_bit = 0x8000'0000;
+
+    /** At least one thread is waiting on the operating system.
+     */
+    static constexpr uint32_t waiting_bit = 0x4000'0000;
+
+    /** The lower bits are the number of shared locks.
+     */
+    static constexpr uint32_t shared_mask = 0x3fff'ffff;
+
+    std::atomic<uint32_t> state = 0;
+
+    // The thread that holds the exclusive lock.
+    std::atomic<thread_id> owner = 0;
+
+    // The number of recursive exclusive locks, only accessed by the owner.
+    uint32_t count = 0;
+
+    // The number of shared locks held by the current thread.
+    inline static thread_local int shared_count = 0;
+
+    // The id in the lock_order_detector, assigned on construction.
+    uint8_t lock_order_id = lock_order_detector::unassigned_id;
+
+    void lock_shared_finish() noexcept
+    {
+        if (shared_count++ == 0) {
+            if constexpr (use_lock_order_detector) {
+                lock_order_detector::lock(lock_order_id, CounterTag.data());
+            }
+        }
+    }
+
+    tt_no_inline void wake_waiters() noexcept
+    {
+        // Clear the waiting bit; the woken threads set it again when they have to wait again.
+        auto expected = waiting_bit;
+        state.compare_exchange_strong(expected, 0, std::memory_order::relaxed);
+        state.notify_all();
+    }
+
+    /** Wait until the state changes, marking that a thread is waiting.
+     */
+    void wait(uint32_t expected) noexcept
+    {
+        if ((expected & waiting_bit) == 0) {
+            if (!state.compare_exchange_strong(expected, expected | waiting_bit, std::memory_order::relaxed)) {
+                // The state changed, so try to acquire the lock again.
+                return;
+            }
+            expected |= waiting_bit;
+        }
+
+        if constexpr (CounterTag.size() != 0) {
+            increment_counter<wait_counter_tag>();
+        }
+        state.wait(expected, std::memory_order::relaxed);
+    }
+
+    tt_no_inline void lock_contended() noexcept
+    {
+        if constexpr (CounterTag.size() != 0) {
+            increment_counter<contended_counter_tag>();
+        }
+
+        for (auto nr_spins = 0;; ++nr_spins) {
+            // Keep the waiting bit, as other threads may still be waiting.
+            auto expected = state.load(std::memory_order::relaxed);
+            if ((expected & ~waiting_bit) == 0) {
+                if (state.compare_exchange_weak(expected, expected | exclusive_bit, std::memory_order::acquire)) {
+                    return;
+                }
+            } else if (nr_spins < maximum_nr_spins) {
+                cpu_pause();
+            } else {
+                wait(expected);
+            }
+        }
+    }
+
+    tt_no_inline void lock_shared_contended() noexcept
+    {
+        if constexpr (CounterTag.size() != 0) {
+            increment_counter<contended_counter_tag>();
+        }
+
+        for (auto nr_spins = 0;; ++nr_spins) {
+            auto expected = state.load(std::memory_order::relaxed);
+            if ((expected & exclusive_bit) == 0) {
+                tt_axiom((expected & shared_mask) != shared_mask);
+                if (state.compare_exchange_weak(expected, expected + 1, std::memory_order::acquire)) {
+                    return;
+                }
+            } else if (nr_spins < maximum_nr_spins) {
+                cpu_pause();
+            } else {
+                wait(expected);
+            }
+        }
+    }
+};
+
+using unfair_recursive_shared_mutex = unfair_recursive_shared_mutex_impl<>;
+
+} // namespace tt
@@ -0,0 +1,96 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/unfair_recursive_shared_mutex.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace tt;
+
+TEST(UnfairRecursiveSharedMutex, Recursive)
+{
+    auto mutex = unfair_recursive_shared_mutex_impl<"test_rs_recursive">{};
+
+    mutex.lock();
+    mutex.lock_shared();
+    mutex.lock();
+    ASSERT_EQ(mutex.recurse_lock_count(), 3);
+    mutex.unlock();
+    mutex.unlock_shared();
+    mutex.unlock();
+    ASSERT_EQ(mutex.recurse_lock_count(), 0);
+
+    mutex.lock_shared();
+    mutex.lock_shared();
+    ASSERT_EQ(mutex.recurse_lock_count(), 0);
+    ASSERT_EQ(mutex.recurse_shared_lock_count(), 2);
+    mutex.unlock_shared();
+    mutex.unlock_shared();
+    ASSERT_EQ(mutex.recurse_shared_lock_count(), 0);
+}
+
+TEST(UnfairRecursiveSharedMutex, SharedWithOtherThreads)
+{
+    using namespace std::literals::chrono_literals;
+
+    auto mutex = unfair_recursive_shared_mutex_impl<"test_rs_shared">{};
+
+    mutex.lock_shared();
+    auto thread = std::thread([&mutex] {
+        // Other readers are not blocked by a reader.
+        ASSERT_TRUE(mutex.try_lock_shared());
+        mutex.unlock_shared();
+
+        // A writer is blocked by a reader.
+        ASSERT_FALSE(mutex.try_lock());
+    });
+    thread.join();
+
+    auto writer_has_lock = std::atomic<bool>{false};
+    auto writer = std::thread([&mutex, &writer_has_lock] {
+        ttlet lock = std::scoped_lock(mutex);
+        writer_has_lock = true;
+    });
+
+    std::this_thread::sleep_for(50ms);
+    ASSERT_FALSE(writer_has_lock.load());
+    mutex.unlock_shared();
+    writer.join();
+    ASSERT_TRUE(writer_has_lock.load());
+}
+
+TEST(UnfairRecursiveSharedMutex, Contended)
+{
+    auto mutex = unfair_recursive_shared_mutex_impl<"test_rs_contended">{};
+    auto value = 0;
+    auto shadow = 0;
+
+    auto threads = std::vector<std::thread>{};
+    for (int i = 0; i != 2; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j != 50'000; ++j) {
+                ttlet lock = std::scoped_lock(mutex);
+                ++value;
+                ++shadow;
+            }
+        });
+        threads.emplace_back([&] {
+            for (int j = 0; j != 50'000; ++j) {
+                ttlet lock = std::shared_lock(mutex);
+                ASSERT_EQ(value, shadow);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(value, 100'000);
+}
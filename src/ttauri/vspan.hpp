@@ -69,6 +69,11 @@ public:
     [[nodiscard]] friend difference_type operator-(vspan_iterator const &lhs, vspan_iterator const &rhs) noexcept { return lhs.ptr - rhs.ptr; }
 };
 
+/** A vector-like container on top of a fixed size buffer, such as a mapped vertex buffer.
+ *
+ * Elements that are added when the buffer is full are dropped, the number of dropped elements
+ * is available from `nr_dropped()` so that the owner of the buffer can grow it.
+ */
 template<typename T>
 class vspan {
 public:
@@ -80,19 +85,20 @@ private:
     value_type *_begin;
     value_type *_end;
     value_type *_max;
+    size_t _nr_dropped;
 
 public:
     vspan() noexcept :
-        _begin(nullptr), _end(nullptr), _max(nullptr) {}
+        _begin(nullptr), _end(nullptr), _max(nullptr), _nr_dropped(0) {}
 
     vspan(value_type *buffer, ssize_t nr_elements) noexcept :
-        _begin(buffer), _end(buffer), _max(buffer + nr_elements)
+        _begin(buffer), _end(buffer), _max(buffer + nr_elements), _nr_dropped(0)
     {
         tt_axiom(nr_elements >= 0);
     }
 
     vspan(std::span<value_type> span) noexcept :
-        _begin(span.data()), _end(span.data()), _max(span.data() + span.size()) {}
+        _begin(span.data()), _end(span.data()), _max(span.data() + span.size()), _nr_dropped(0) {}
 
     vspan(vspan const &other) = default;
     vspan(vspan &&other) = default;
@@ -109,6 +115,11 @@ public:
     [[nodiscard]] const_iterator cend() const noexcept { return _end; }
 
     [[nodiscard]] size_t size() const noexcept { return std::distance(_begin, _end); }
+    [[nodiscard]] size_t capacity() const noexcept { return std::distance(_begin, _max); }
+
+    /** The number of elements that were not added since the last clear(), because the vspan was full.
+     */
+    [[nodiscard]] size_t nr_dropped() const noexcept { return _nr_dropped; }
 
     [[nodiscard]] value_type &operator[](size_t i) noexcept { tt_axiom(i < size()); return *std::launder(_begin + i); }
     [[nodiscard]] value_type const &operator[](size_t i) const noexcept { tt_axiom(i < size()); return *std::launder(_begin + i); }
@@ -123,18 +134,25 @@ public:
             std::destroy_at(std::launder(i));
         }
         _end = _begin;
+        _nr_dropped = 0;
         return *this;
     }
 
     void push_back(value_type const &rhs) noexcept {
-        tt_axiom(_end != _max);
+        if (_end == _max) [[unlikely]] {
+            ++_nr_dropped;
+            return;
+        }
         // Since we throw away the pointer, we have to std::launder all access to this object.
         [[maybe_unused]] value_type *ptr = new (_end) value_type(rhs);
         ++_end;
     }
 
     void push_back(value_type &&rhs) noexcept {
-        tt_axiom(_end != _max);
+        if (_end == _max) [[unlikely]] {
+            ++_nr_dropped;
+            return;
+        }
         // Since we throw away the pointer, we have to std::launder all access to this object.
         [[maybe_unused]] value_type *ptr = new (_end) value_type(std::move(rhs));
         ++_end;
@@ -142,7 +160,10 @@ public:
 
     template<typename... Args>
     void emplace_back(Args &&... args) noexcept {
-        tt_axiom(_end != _max);
+        if (_end == _max) [[unlikely]] {
+            ++_nr_dropped;
+            return;
+        }
         // Since we throw away the pointer, we have to std::launder all access to this object.
         [[maybe_unused]] value_type *ptr = new (_end) value_type(std::forward<Args>(args)...);
         ++_end;
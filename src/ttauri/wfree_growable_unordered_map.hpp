@@ -0,0 +1,266 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "wfree_unordered_map.hpp"
+#include "unfair_mutex.hpp"
+#include "required.hpp"
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace tt {
+
+/*! Unordered map with wait-free get that grows when it fills up.
+ *
+ * Unlike `wfree_unordered_map` the number of items is not limited. Inserts and erases
+ * are serialized with a mutex; they are expected to be rare compared to lookups, as in a cache.
+ *
+ * When the table becomes half full, including the tombstones left by erase(), the live
+ * items are copied into a new table, which is twice as large when needed. The new table
+ * is published atomically; the old table is never modified again and is kept alive until
+ * the map is destroyed, so that a concurrent get() can finish its lookup in it. Since the
+ * tables grow geometrically, the retired tables use at most as much memory as the current table.
+ */
+template<typename K, typename V>
+class wfree_growable_unordered_map {
+public:
+    using key_type = K;
+    using mapped_type = V;
+
+    /*! The number of slots of a new table.
+     */
+    static constexpr size_t minimum_capacity = 64;
+
+    wfree_growable_unordered_map() noexcept : _owner(std::make_unique<table_type>(minimum_capacity, nullptr))
+    {
+        _table.store(_owner.get(), std::memory_order::release);
+    }
+
+    wfree_growable_unordered_map(wfree_growable_unordered_map const &) = delete;
+    wfree_growable_unordered_map(wfree_growable_unordered_map &&) = delete;
+    wfree_growable_unordered_map &operator=(wfree_growable_unordered_map const &) = delete;
+    wfree_growable_unordered_map &operator=(wfree_growable_unordered_map &&) = delete;
+    ~wfree_growable_unordered_map() = default;
+
+    /*! The number of items in the map.
+     */
+    [[nodiscard]] size_t size() const noexcept
+    {
+        ttlet lock = std::scoped_lock(_mutex);
+        return _nr_items;
+    }
+
+    /*! The number of slots in the current table.
+     */
+    [[nodiscard]] size_t capacity() const noexcept
+    {
+        return _table.load(std::memory_order::acquire)->capacity;
+    }
+
+    void insert(K key, V value) noexcept
+    {
+        ttlet hash = wfree_unordered_map<K, V, 1>::make_hash(key);
+        ttlet lock = std::scoped_lock(_mutex);
+
+        if ((_nr_items + _nr_tombstones + 1) * 2 > _table.load(std::memory_order::relaxed)->capacity) {
+            rebuild();
+        }
+
+        auto &table = *_table.load(std::memory_order::relaxed);
+        for (auto index = table.start_index(hash);; index = table.next_index(index)) {
+            auto &item = table.items[index];
+            ttlet item_hash = item.hash.load(std::memory_order::relaxed);
+
+            if (item_hash == 0) {
+                item.key = std::move(key);
+                item.value = std::move(value);
+                item.hash.store(hash, std::memory_order::release);
+                ++_nr_items;
+                return;
+
+            } else if (item_hash == hash && key == item.key) {
+                // Key was already in map, replace the value.
+                item.value = std::move(value);
+                return;
+            }
+        }
+    }
+
+    [[nodiscard]] std::optional<V> get(K const &key) const noexcept
+    {
+        ttlet hash = wfree_unordered_map<K, V, 1>::make_hash(key);
+
+        // The table is at most half full, so the probe always ends on an empty item.
+        ttlet &table = *_table.load(std::memory_order::acquire);
+        for (auto index = table.start_index(hash);; index = table.next_index(index)) {
+            ttlet &item = table.items[index];
+            ttlet item_hash = item.hash.load(std::memory_order::acquire);
+
+            if (item_hash == hash && key == item.key) {
+                return {item.value};
+
+            } else if (item_hash == 0) {
+                return {};
+            }
+        }
+    }
+
+    [[nodiscard]] V get(K const &key, V const &default_value) const noexcept
+    {
+        if (auto optional_value = get(key)) {
+            return std::move(*optional_value);
+        } else {
+            return default_value;
+        }
+    }
+
+    std::optional<V> erase(K const &key) noexcept
+    {
+        ttlet hash = wfree_unordered_map<K, V, 1>::make_hash(key);
+        ttlet lock = std::scoped_lock(_mutex);
+
+        auto &table = *_table.load(std::memory_order::relaxed);
+        for (auto index = table.start_index(hash);; index = table.next_index(index)) {
+            auto &item = table.items[index];
+            ttlet item_hash = item.hash.load(std::memory_order::relaxed);
+
+            if (item_hash == hash && key == item.key) {
+                // Set tombstone. The key and value are left alone, since a concurrent get()
+                // may still be comparing the key. The tombstone is removed by the next rebuild.
+                item.hash.store(2, std::memory_order::release);
+                --_nr_items;
+                ++_nr_tombstones;
+                return {item.value};
+
+            } else if (item_hash == 0) {
+                return {};
+            }
+        }
+    }
+
+    /*! Remove all items.
+     * Unlike `wfree_unordered_map::clear()` this may be called concurrently with get().
+     */
+    void clear() noexcept
+    {
+        ttlet lock = std::scoped_lock(_mutex);
+        publish(std::make_unique<table_type>(minimum_capacity, nullptr));
+        _nr_items = 0;
+        _nr_tombstones = 0;
+    }
+
+    [[nodiscard]] std::vector<K> keys() const noexcept
+    {
+        auto r = std::vector<K>{};
+
+        ttlet &table = *_table.load(std::memory_order::acquire);
+        for (size_t i = 0; i != table.capacity; ++i) {
+            ttlet &item = table.items[i];
+            if (item.hash.load(std::memory_order::acquire) >= 3) {
+                r.push_back(item.key);
+            }
+        }
+        return r;
+    }
+
+private:
+    struct table_type {
+        size_t capacity;
+        int shift;
+        std::unique_ptr<wfree_unordered_map_item<K, V>[]> items;
+
+        /*! The retired table, kept alive for concurrent readers.
+         */
+        std::unique_ptr<table_type> previous;
+
+        table_type(size_t capacity, std::unique_ptr<table_type> previous) noexcept :
+            capacity(capacity),
+            shift(64 - std::bit_width(capacity - 1)),
+            items(std::make_unique<wfree_unordered_map_item<K, V>[]>(capacity)),
+            previous(std::move(previous))
+        {
+            tt_axiom(std::has_single_bit(capacity));
+        }
+
+        ~table_type()
+        {
+            // Unwind the chain of retired tables iteratively.
+            while (previous) {
+                previous = std::move(previous->previous);
+            }
+        }
+
+        /*! The first index to probe.
+         * The hash is mixed, since std::hash of integers is often the identity function.
+         */
+        [[nodiscard]] size_t start_index(size_t hash) const noexcept
+        {
+            return static_cast<size_t>((static_cast<uint64_t>(hash) * 0x9e37'79b9'7f4a'7c15ULL) >> shift);
+        }
+
+        [[nodiscard]] size_t next_index(size_t index) const noexcept
+        {
+            return (index + 1) & (capacity - 1);
+        }
+    };
+
+    std::atomic<table_type *> _table;
+
+    /*! The newest table, which owns the chain of retired tables.
+     */
+    std::unique_ptr<table_type> _owner;
+
+    mutable unfair_mutex _mutex;
+    size_t _nr_items = 0;
+    size_t _nr_tombstones = 0;
+
+    void publish(std::unique_ptr<table_type> new_table) noexcept
+    {
+        new_table->previous = std::move(_owner);
+        _owner = std::move(new_table);
+        _table.store(_owner.get(), std::memory_order::release);
+    }
+
+    /*! Copy the live items into a new table, dropping the tombstones.
+     * The new table is at most a quarter full after the rebuild.
+     */
+    void rebuild() noexcept
+    {
+        ttlet &old_table = *_owner;
+
+        auto new_capacity = minimum_capacity;
+        while (new_capacity < (_nr_items + 1) * 4) {
+            new_capacity *= 2;
+        }
+
+        auto new_table = std::make_unique<table_type>(new_capacity, nullptr);
+        for (size_t i = 0; i != old_table.capacity; ++i) {
+            ttlet &old_item = old_table.items[i];
+            ttlet hash = old_item.hash.load(std::memory_order::relaxed);
+            if (hash < 3) {
+                continue;
+            }
+
+            auto index = new_table->start_index(hash);
+            while (new_table->items[index].hash.load(std::memory_order::relaxed) != 0) {
+                index = new_table->next_index(index);
+            }
+
+            auto &new_item = new_table->items[index];
+            new_item.key = old_item.key;
+            new_item.value = old_item.value;
+            new_item.hash.store(hash, std::memory_order::relaxed);
+        }
+
+        _nr_tombstones = 0;
+        publish(std::move(new_table));
+    }
+};
+
+} // namespace tt
@@ -0,0 +1,100 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/wfree_growable_unordered_map.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace tt;
+
+TEST(WFreeGrowableUnorderedMap, Grow)
+{
+    auto map = wfree_growable_unordered_map<int, int>{};
+
+    for (int i = 0; i != 1000; ++i) {
+        map.insert(i, i * 2);
+    }
+    ASSERT_EQ(map.size(), 1000);
+    ASSERT_GE(map.capacity(), 2000);
+
+    for (int i = 0; i != 1000; ++i) {
+        ASSERT_EQ(map.get(i, -1), i * 2);
+    }
+    ASSERT_FALSE(map.get(1000));
+    ASSERT_EQ(map.keys().size(), 1000);
+}
+
+TEST(WFreeGrowableUnorderedMap, Replace)
+{
+    auto map = wfree_growable_unordered_map<int, int>{};
+
+    map.insert(1, 1);
+    map.insert(1, 2);
+    ASSERT_EQ(map.size(), 1);
+    ASSERT_EQ(map.get(1, -1), 2);
+}
+
+TEST(WFreeGrowableUnorderedMap, EraseReclaimsTombstones)
+{
+    auto map = wfree_growable_unordered_map<int, int>{};
+
+    // A cache with a small working set that keeps replacing its items
+    // must not grow because of the tombstones.
+    for (int i = 0; i != 10000; ++i) {
+        map.insert(i, i);
+        if (i >= 8) {
+            ASSERT_EQ(map.erase(i - 8), i - 8);
+        }
+    }
+    ASSERT_EQ(map.size(), 8);
+    ASSERT_EQ(map.capacity(), map.minimum_capacity);
+    ASSERT_FALSE(map.get(0));
+    ASSERT_FALSE(map.erase(0));
+    ASSERT_EQ(map.get(9999, -1), 9999);
+}
+
+TEST(WFreeGrowableUnorderedMap, Clear)
+{
+    auto map = wfree_growable_unordered_map<int, int>{};
+
+    for (int i = 0; i != 100; ++i) {
+        map.insert(i, i);
+    }
+    map.clear();
+    ASSERT_EQ(map.size(), 0);
+    ASSERT_FALSE(map.get(1));
+}
+
+TEST(WFreeGrowableUnorderedMap, ConcurrentGet)
+{
+    auto map = wfree_growable_unordered_map<int, int>{};
+    auto done = std::atomic<bool>{false};
+
+    auto readers = std::vector<std::thread>{};
+    for (int i = 0; i != 4; ++i) {
+        readers.emplace_back([&map, &done] {
+            while (!done.load(std::memory_order::relaxed)) {
+                for (int key = 0; key != 100; ++key) {
+                    ttlet value = map.get(key, key);
+                    ASSERT_EQ(value, key);
+                }
+            }
+        });
+    }
+
+    // Inserted values are equal to their key, so every reader either finds the value
+    // or falls back to the default value.
+    for (int i = 0; i != 10000; ++i) {
+        map.insert(i, i);
+    }
+    done = true;
+
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    ASSERT_EQ(map.size(), 10000);
+}
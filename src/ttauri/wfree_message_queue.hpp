@@ -71,12 +71,50 @@ public:
     }
 };
 
+/** A write operation on a contiguous range of messages.
+ * The messages are published when the operation is destroyed.
+ */
+template<typename T, size_t Capacity>
+class wfree_message_queue_bulk_write_operation {
+    wfree_message_queue<T,Capacity> *parent;
+    size_t first;
+    size_t count;
+
+public:
+    wfree_message_queue_bulk_write_operation(wfree_message_queue<T,Capacity> *parent, size_t first, size_t count) noexcept :
+        parent(parent), first(first), count(count) {}
+
+    wfree_message_queue_bulk_write_operation(wfree_message_queue_bulk_write_operation const &other) = delete;
+    wfree_message_queue_bulk_write_operation(wfree_message_queue_bulk_write_operation &&other) = delete;
+    wfree_message_queue_bulk_write_operation &operator=(wfree_message_queue_bulk_write_operation const &other) = delete;
+    wfree_message_queue_bulk_write_operation &operator=(wfree_message_queue_bulk_write_operation &&other) = delete;
+
+    ~wfree_message_queue_bulk_write_operation()
+    {
+        for (size_t i = 0; i != count; ++i) {
+            parent->write_finish(first + i);
+        }
+    }
+
+    [[nodiscard]] size_t size() const noexcept
+    {
+        return count;
+    }
+
+    T &operator[](size_t i) noexcept
+    {
+        tt_axiom(i < count);
+        return (*parent)[first + i];
+    }
+};
+
 template<typename T, size_t Capacity>
 class wfree_message_queue {
     using index_type = size_t;
     using value_type = T;
     using scoped_write_operation = wfree_message_queue_operation<T,Capacity,true>;
     using scoped_read_operation = wfree_message_queue_operation<T,Capacity,false>;
+    using scoped_bulk_write_operation = wfree_message_queue_bulk_write_operation<T,Capacity>;
 
     struct message_type {
         // The in_use atomic is first, to improve cache-line and prefetch.
@@ -131,6 +169,23 @@ public:
         return {this, write_start<BlockCounterTag>()};
     }
 
+    /*! Write a contiguous range of messages into the queue.
+    * The slots are claimed with a single atomic operation, and are published
+    * together when the returned operation is destroyed.
+    *
+    * \param n The number of messages, less than the capacity minus the slack of the queue.
+    * \return A scoped write operation which can be indexed to access the message values.
+    */
+    template<basic_fixed_string BlockCounterTag = "">
+    scoped_bulk_write_operation write_n(index_type n) noexcept {
+        tt_axiom(n < capacity - slack);
+        ttlet first = head.fetch_add(n, std::memory_order::acquire);
+        for (index_type i = 0; i != n; ++i) {
+            wait_for_transition<BlockCounterTag>(messages[(first + i) % capacity].in_use, false, std::memory_order::acquire);
+        }
+        return {this, first, n};
+    }
+
     /*! Read a message from the queue.
     * This function will block until the message being read is completed by the writing thread.
     *
@@ -140,6 +195,39 @@ public:
         return {this, read_start()};
     }
 
+    /*! Read all messages that are ready.
+    * The consecutive messages that are completely written are claimed with a single
+    * atomic operation and passed to the function in order. This function does not block
+    * on messages that are still being written.
+    *
+    * \param f A function called as `f(value_type &)` for each message.
+    * \return The number of messages read.
+    */
+    template<typename F>
+    index_type read_all(F &&f) noexcept {
+        auto first = tail.load(std::memory_order::relaxed);
+        index_type n;
+        do {
+            ttlet last = head.load(std::memory_order::relaxed);
+
+            n = 0;
+            while (first + n < last && messages[(first + n) % capacity].in_use.load(std::memory_order::acquire)) {
+                ++n;
+            }
+
+            if (n == 0) {
+                return 0;
+            }
+            // On failure another reader has claimed messages, first is updated to the current tail.
+        } while (!tail.compare_exchange_weak(first, first + n, std::memory_order::acquire, std::memory_order::relaxed));
+
+        for (index_type i = 0; i != n; ++i) {
+            f(messages[(first + i) % capacity].value);
+            read_finish(first + i);
+        }
+        return n;
+    }
+
     value_type const &operator[](index_type index) const noexcept {
         return messages[index % capacity].value;
     }
@@ -0,0 +1,62 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/wfree_message_queue.hpp"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <thread>
+#include <atomic>
+
+using namespace std;
+using namespace tt;
+
+using wfree_message_queue_bench_type = wfree_message_queue<uint64_t, 1024>;
+
+static void wfree_message_queue_write_read(benchmark::State &state)
+{
+    auto queue = std::make_unique<wfree_message_queue_bench_type>();
+
+    uint64_t value = 0;
+    for (auto _ : state) {
+        *queue->write() = value++;
+        benchmark::DoNotOptimize(*queue->read());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(wfree_message_queue_write_read);
+
+/** Throughput of producers on the benchmark threads with a single consumer on a separate thread.
+ */
+static void wfree_message_queue_throughput(benchmark::State &state)
+{
+    static std::unique_ptr<wfree_message_queue_bench_type> queue;
+    static std::jthread consumer;
+    static std::atomic<uint64_t> sum;
+
+    if (state.thread_index == 0) {
+        queue = std::make_unique<wfree_message_queue_bench_type>();
+        sum = 0;
+        consumer = std::jthread([](std::stop_token stop_token) {
+            while (not stop_token.stop_requested() or not queue->empty()) {
+                if (queue->read_all([](ttlet &value) {
+                        sum.fetch_add(value, std::memory_order::relaxed);
+                    }) == 0) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto _ : state) {
+        *queue->write() = 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index == 0) {
+        consumer.request_stop();
+        consumer.join();
+        queue = {};
+    }
+}
+BENCHMARK(wfree_message_queue_throughput)->Threads(1)->Threads(2)->Threads(4)->UseRealTime();
@@ -0,0 +1,78 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/wfree_message_queue.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace tt;
+
+TEST(WFreeMessageQueue, WriteRead)
+{
+    auto queue = std::make_unique<wfree_message_queue<int, 64>>();
+
+    *queue->write() = 1;
+    *queue->write() = 2;
+    ASSERT_EQ(queue->size(), 2);
+    ASSERT_EQ(*queue->read(), 1);
+    ASSERT_EQ(*queue->read(), 2);
+    ASSERT_TRUE(queue->empty());
+}
+
+TEST(WFreeMessageQueue, Bulk)
+{
+    auto queue = std::make_unique<wfree_message_queue<int, 64>>();
+
+    {
+        auto operation = queue->write_n(3);
+        ASSERT_EQ(operation.size(), 3);
+        for (auto i = 0; i != 3; ++i) {
+            operation[i] = i + 10;
+        }
+
+        // The messages are not published until the operation is destroyed.
+        ASSERT_EQ(queue->read_all([](int &) {}), 0);
+    }
+
+    *queue->write() = 13;
+
+    auto values = std::vector<int>{};
+    ASSERT_EQ(queue->read_all([&values](int &value) { values.push_back(value); }), 4);
+    ASSERT_EQ(values, (std::vector<int>{10, 11, 12, 13}));
+    ASSERT_TRUE(queue->empty());
+    ASSERT_EQ(queue->read_all([](int &) {}), 0);
+}
+
+TEST(WFreeMessageQueue, BulkThreads)
+{
+    auto queue = std::make_unique<wfree_message_queue<int, 1024>>();
+    constexpr int nr_threads = 4;
+    constexpr int nr_messages = 10000;
+
+    auto threads = std::vector<std::thread>{};
+    for (auto t = 0; t != nr_threads; ++t) {
+        threads.emplace_back([&queue] {
+            for (auto i = 0; i != nr_messages; i += 4) {
+                auto operation = queue->write_n(4);
+                for (auto j = 0; j != 4; ++j) {
+                    operation[j] = 1;
+                }
+            }
+        });
+    }
+
+    auto total = 0;
+    while (total != nr_threads * nr_messages) {
+        queue->read_all([&total](int &value) {
+            total += value;
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(total, nr_threads * nr_messages);
+}
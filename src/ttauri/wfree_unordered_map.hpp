@@ -108,6 +108,19 @@ public:
         }
     }
 
+    /*! Remove all items.
+     * This function is not wait-free and must not be called concurrently with other functions.
+     */
+    void clear() noexcept {
+        for (auto &item: items) {
+            if (item.hash.load(std::memory_order::relaxed) != 0) {
+                item.key = {};
+                item.value = {};
+                item.hash.store(0, std::memory_order::relaxed);
+            }
+        }
+    }
+
     std::vector<K> keys() const noexcept {
         std::vector<K> r;
         // XXX - with counting items, we could reserve capacity.
@@ -18,7 +18,11 @@ public:
     using super = widget;
     using value_type = T;
 
-    value_type const true_value;
+    /** The value that the button represents.
+     * A button that is reused for another item, such as a row of a virtual column,
+     * may assign a new value; after which the button must be redrawn.
+     */
+    value_type true_value;
     observable<value_type> value;
 
     using notifier_type = notifier<void()>;
@@ -46,7 +50,7 @@ public:
 
     [[nodiscard]] bool accepts_keyboard_focus(keyboard_focus_group group) const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return is_normal(group) && *enabled;
     }
 
@@ -90,7 +94,7 @@ public:
 
     [[nodiscard]] hit_box hitbox_test(point2 position) const noexcept final
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
 
         if (_visible_rectangle.contains(position)) {
             return hit_box{weak_from_this(), _draw_layer, *enabled ? hit_box::Type::Button : hit_box::Type::Default};
@@ -5,6 +5,9 @@
 #pragma once
 
 #include "widget.hpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
 namespace tt {
 
@@ -30,7 +33,9 @@ public:
     void clear() noexcept
     {
         _children.clear();
-        _request_reconstrain = true;
+        window.invalidate_widget_tree();
+        invalidate_hitbox_index();
+        request_reconstrain();
     }
 
     /** Add a widget directly to this widget.
@@ -42,7 +47,9 @@ public:
 
         tt_axiom(&widget->parent() == this);
         _children.push_back(widget);
-        _request_reconstrain = true;
+        window.invalidate_widget_tree();
+        invalidate_hitbox_index();
+        request_reconstrain();
         window.requestLayout = true;
         return widget;
     }
@@ -96,6 +103,11 @@ public:
     {
         tt_axiom(gui_system_mutex.recurse_lock_count());
 
+        if (not std::exchange(_request_reconstrain_subtree, false) and not need_reconstrain) {
+            // Neither this widget nor any of its children requested to be reconstrained.
+            return false;
+        }
+
         auto has_constrainted = super::update_constraints(display_time_point, need_reconstrain);
 
         for (auto &&child : _children) {
@@ -118,6 +130,11 @@ public:
             child->update_layout(display_time_point, need_layout);
         }
 
+        // The children have been laid out, so that the index is ready for the hit tests of the next frame.
+        if (not _hitbox_index_valid) {
+            build_hitbox_index();
+        }
+
         super::update_layout(display_time_point, need_layout);
     }
 
@@ -131,7 +148,7 @@ public:
 
             auto child_context =
                 context.make_child_context(child->parent_to_local(), child->local_to_window(), child->clipping_rectangle());
-            child->draw(child_context, display_time_point);
+            child->draw_retained(child_context, display_time_point);
         }
 
         super::draw(std::move(context), display_time_point);
@@ -153,13 +170,47 @@ public:
 
     [[nodiscard]] hit_box hitbox_test(point2 position) const noexcept override
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
 
         auto r = hit_box{};
+        if (_hitbox_index_valid and not _hitbox_grid.empty()) {
+            if (not _hitbox_rectangle.contains(position)) {
+                return r;
+            }
+
+            for (ttlet i : _hitbox_grid[hitbox_cell(position)]) {
+                ttlet &child = _children[i];
+                increment_counter<"widget_hitbox_test">();
+                r = std::max(r, child->hitbox_test(point2{child->parent_to_local() * position}));
+            }
+
+        } else {
+            for (ttlet &child : _children) {
+                tt_axiom(child);
+                tt_axiom(&child->parent() == this);
+                increment_counter<"widget_hitbox_test">();
+                r = std::max(r, child->hitbox_test(point2{child->parent_to_local() * position}));
+            }
+        }
+        return r;
+    }
+
+    [[nodiscard]] std::span<std::shared_ptr<widget> const> children() const noexcept override
+    {
+        return _children;
+    }
+
+    [[nodiscard]] aarectangle hitbox_rectangle() const noexcept override
+    {
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
+
+        if (_hitbox_index_valid) {
+            return _hitbox_rectangle;
+        }
+
+        auto r = _clipping_rectangle;
         for (ttlet &child : _children) {
-            tt_axiom(child);
-            tt_axiom(&child->parent() == this);
-            r = std::max(r, child->hitbox_test(point2{child->parent_to_local() * position}));
+            r = r | aarectangle{child->local_to_parent() * child->hitbox_rectangle()};
         }
         return r;
     }
@@ -189,7 +240,7 @@ public:
         keyboard_focus_group group,
         keyboard_focus_direction direction) const noexcept
     {
-        ttlet lock = std::scoped_lock(gui_system_mutex);
+        ttlet lock = std::shared_lock(gui_system_mutex);
 
         auto found = false;
 
@@ -240,6 +291,89 @@ public:
 
 protected:
     std::vector<std::shared_ptr<widget>> _children;
+
+    void invalidate_hitbox_index() noexcept override
+    {
+        _hitbox_index_valid = false;
+        super::invalidate_hitbox_index();
+    }
+
+private:
+    /** Containers with fewer children are hit tested by testing each child.
+     */
+    static constexpr size_t hitbox_grid_minimum_nr_children = 8;
+
+    /** The rectangle containing the hitbox rectangles of this widget and all of its children.
+     */
+    aarectangle _hitbox_rectangle;
+
+    /** A uniform grid over the `_hitbox_rectangle`.
+     * Each cell lists the indices of the children whose hitbox rectangle overlaps the cell,
+     * in the order of `_children`. Empty when the container has only a few children.
+     */
+    std::vector<std::vector<size_t>> _hitbox_grid;
+    size_t _hitbox_grid_width = 0;
+    size_t _hitbox_grid_height = 0;
+
+    bool _hitbox_index_valid = false;
+
+    [[nodiscard]] size_t hitbox_cell(float x, float y) const noexcept
+    {
+        ttlet cell_x = (x - _hitbox_rectangle.left()) / _hitbox_rectangle.width() * narrow_cast<float>(_hitbox_grid_width);
+        ttlet cell_y = (y - _hitbox_rectangle.bottom()) / _hitbox_rectangle.height() * narrow_cast<float>(_hitbox_grid_height);
+        ttlet cell_x_ = std::clamp(narrow_cast<ssize_t>(cell_x), ssize_t{0}, narrow_cast<ssize_t>(_hitbox_grid_width) - 1);
+        ttlet cell_y_ = std::clamp(narrow_cast<ssize_t>(cell_y), ssize_t{0}, narrow_cast<ssize_t>(_hitbox_grid_height) - 1);
+        return narrow_cast<size_t>(cell_y_) * _hitbox_grid_width + narrow_cast<size_t>(cell_x_);
+    }
+
+    [[nodiscard]] size_t hitbox_cell(point2 position) const noexcept
+    {
+        return hitbox_cell(position.x(), position.y());
+    }
+
+    /** Build the hit-test index from the hitbox rectangles of the children.
+     */
+    void build_hitbox_index() noexcept
+    {
+        tt_axiom(gui_system_mutex.recurse_lock_count());
+
+        auto child_rectangles = std::vector<aarectangle>{};
+        child_rectangles.reserve(_children.size());
+
+        _hitbox_rectangle = _clipping_rectangle;
+        for (ttlet &child : _children) {
+            child_rectangles.push_back(aarectangle{child->local_to_parent() * child->hitbox_rectangle()});
+            _hitbox_rectangle = _hitbox_rectangle | child_rectangles.back();
+        }
+
+        _hitbox_grid.clear();
+        if (_children.size() >= hitbox_grid_minimum_nr_children && _hitbox_rectangle.width() > 0.0f &&
+            _hitbox_rectangle.height() > 0.0f) {
+            // About one child per cell, when the children are spread evenly.
+            ttlet aspect_ratio = _hitbox_rectangle.width() / _hitbox_rectangle.height();
+            ttlet nr_cells = narrow_cast<float>(_children.size());
+            _hitbox_grid_width = std::clamp(narrow_cast<size_t>(std::sqrt(nr_cells * aspect_ratio)), 1_uz, _children.size());
+            _hitbox_grid_height = std::clamp(_children.size() / _hitbox_grid_width, 1_uz, _children.size());
+            _hitbox_grid.resize(_hitbox_grid_width * _hitbox_grid_height);
+
+            for (auto i = 0_uz; i != _children.size(); ++i) {
+                ttlet &rectangle = child_rectangles[i];
+                if (not rectangle) {
+                    continue;
+                }
+
+                ttlet first_cell = hitbox_cell(rectangle.left(), rectangle.bottom());
+                ttlet last_cell = hitbox_cell(rectangle.right(), rectangle.top());
+                for (auto y = first_cell / _hitbox_grid_width; y <= last_cell / _hitbox_grid_width; ++y) {
+                    for (auto x = first_cell % _hitbox_grid_width; x <= last_cell % _hitbox_grid_width; ++x) {
+                        _hitbox_grid[y * _hitbox_grid_width + x].push_back(i);
+                    }
+                }
+            }
+        }
+
+        _hitbox_index_valid = true;
+    }
 };
 
 } // namespace tt
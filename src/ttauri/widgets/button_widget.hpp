@@ -36,7 +36,7 @@ public:
     void init() noexcept override
     {
         _label_callback = label.subscribe([this](auto...) {
-            this->_request_reconstrain = true;
+            this->request_reconstrain();
         });
 
         _callback = this->subscribe([this](auto...) {
@@ -87,9 +87,12 @@ public:
         if (overlaps(context, this->_clipping_rectangle)) {
             // Move the border of the button in the middle of a pixel.
             context.draw_box_with_border_inside(
-                this->rectangle(), this->background_color(), this->focus_color(), corner_shapes{theme::global->roundingRadius});
+                this->rectangle(),
+                this->style().background_color,
+                this->style().focus_color,
+                corner_shapes{theme::global->roundingRadius});
 
-            _label_stencil->draw(context, this->label_color(), translate_z(0.1f));
+            _label_stencil->draw(context, this->style().label_color, translate_z(0.1f));
         }
 
         super::draw(std::move(context), display_time_point);
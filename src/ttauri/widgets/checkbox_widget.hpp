@@ -51,13 +51,13 @@ public:
     void init() noexcept override
     {
         _true_label_callback = true_label.subscribe([this](auto...) {
-            this->_request_reconstrain = true;
+            this->request_reconstrain();
         });
         _false_label_callback = false_label.subscribe([this](auto...) {
-            this->_request_reconstrain = true;
+            this->request_reconstrain();
         });
         _other_label_callback = other_label.subscribe([this](auto...) {
-            this->_request_reconstrain = true;
+            this->request_reconstrain();
         });
     }
 
@@ -175,7 +175,7 @@ private:
     {
         tt_axiom(gui_system_mutex.recurse_lock_count());
 
-        context.draw_box_with_border_inside(_checkbox_rectangle, this->background_color(), this->focus_color());
+        context.draw_box_with_border_inside(_checkbox_rectangle, this->style().background_color, this->style().focus_color);
     }
 
     void draw_check_mark(draw_context context) noexcept
@@ -184,11 +184,11 @@ private:
 
         // Checkmark or tristate.
         if (this->value == this->true_value) {
-            context.draw_glyph(_check_glyph, translate_z(0.1f) * _check_glyph_rectangle, this->accent_color());
+            context.draw_glyph(_check_glyph, translate_z(0.1f) * _check_glyph_rectangle, this->style().accent_color);
         } else if (this->value == this->false_value) {
             ;
         } else {
-            context.draw_glyph(_minus_glyph, translate_z(0.1f) * _minus_glyph_rectangle, this->accent_color());
+            context.draw_glyph(_minus_glyph, translate_z(0.1f) * _minus_glyph_rectangle, this->style().accent_color);
         }
     }
 
@@ -200,7 +200,7 @@ private:
             this->value == this->false_value               ? _false_label_stencil :
                                                              _other_label_stencil;
 
-        labelCell->draw(context, this->label_color());
+        labelCell->draw(context, this->style().label_color);
     }
 };
 
@@ -0,0 +1,88 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "flat_widget_tree.hpp"
+#include "widget.hpp"
+#include <ranges>
+
+namespace tt {
+
+void flat_widget_tree::rebuild(widget &root) noexcept
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    _widgets.clear();
+    _parents.clear();
+    _subtree_ends.clear();
+
+    struct stack_item {
+        widget *ptr;
+        size_t parent;
+    };
+
+    auto stack = std::vector<stack_item>{{&root, no_index}};
+    while (not stack.empty()) {
+        ttlet item = stack.back();
+        stack.pop_back();
+
+        if (item.ptr == nullptr) {
+            // The end marker of a sub-tree.
+            _subtree_ends[item.parent] = _widgets.size();
+            continue;
+        }
+
+        ttlet index = _widgets.size();
+        item.ptr->_flat_index = index;
+        _widgets.push_back(item.ptr);
+        _parents.push_back(item.parent);
+        _subtree_ends.push_back(index + 1);
+
+        // Push the children in reverse, so that they are visited in order after the end marker.
+        stack.push_back({nullptr, index});
+        for (ttlet &child : std::views::reverse(item.ptr->children())) {
+            tt_axiom(child);
+            stack.push_back({child.get(), index});
+        }
+    }
+
+    _clipping_rectangles.resize(_widgets.size());
+    _hitbox_rectangles.resize(_widgets.size());
+    _is_culled.assign(_widgets.size(), false);
+    _valid = true;
+}
+
+void flat_widget_tree::update() noexcept
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+    tt_axiom(_valid);
+
+    for (size_t i = 0; i != _widgets.size(); ++i) {
+        ttlet &w = *_widgets[i];
+        ttlet local_to_window = w.local_to_window();
+        _clipping_rectangles[i] = aarectangle{local_to_window * w.clipping_rectangle()};
+        _hitbox_rectangles[i] = aarectangle{local_to_window * w.hitbox_rectangle()};
+    }
+}
+
+void flat_widget_tree::cull(dirty_rectangles const &redraw_rectangles) noexcept
+{
+    tt_axiom(_valid);
+
+    size_t i = 0;
+    while (i != _widgets.size()) {
+        if (overlaps(redraw_rectangles, _hitbox_rectangles[i])) {
+            _is_culled[i] = not overlaps(redraw_rectangles, _clipping_rectangles[i]);
+            ++i;
+
+        } else {
+            // Neither the widget nor any of its descendants overlap with the redraw rectangles.
+            ttlet end = _subtree_ends[i];
+            for (; i != end; ++i) {
+                _is_culled[i] = true;
+            }
+        }
+    }
+}
+
+} // namespace tt
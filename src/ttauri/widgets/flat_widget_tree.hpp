@@ -0,0 +1,123 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../GUI/dirty_rectangles.hpp"
+#include "../geometry/axis_aligned_rectangle.hpp"
+#include "../required.hpp"
+#include <vector>
+#include <cstddef>
+#include <limits>
+
+namespace tt {
+
+class widget;
+
+/** A flattened copy of the widget tree of a window.
+ *
+ * The widgets are stored in depth-first order as a structure of arrays, so that passes over
+ * all the widgets of a window are linear scans over contiguous memory, instead of following
+ * the `std::shared_ptr` of each child through the heap.
+ *
+ * The tree is rebuilt after the structure of the widget tree changes, and the rectangles are
+ * updated after the layout changes.
+ */
+class flat_widget_tree {
+public:
+    static constexpr size_t no_index = std::numeric_limits<size_t>::max();
+
+    /** Check if the tree matches the structure of the widget tree.
+     */
+    [[nodiscard]] bool valid() const noexcept
+    {
+        return _valid;
+    }
+
+    /** Mark the tree to be rebuilt, after a widget was added or removed.
+     */
+    void invalidate() noexcept
+    {
+        _valid = false;
+    }
+
+    /** The number of widgets in the tree.
+     */
+    [[nodiscard]] size_t size() const noexcept
+    {
+        return _widgets.size();
+    }
+
+    /** Rebuild the tree from the widgets.
+     * This also assigns each widget its index in the tree.
+     *
+     * @param root The top most widget of the window.
+     */
+    void rebuild(widget &root) noexcept;
+
+    /** Update the rectangles of the widgets after the layout has changed.
+     */
+    void update() noexcept;
+
+    /** Determine which widgets overlap with the rectangles that are being redrawn.
+     * The descendants of a widget whose hitbox rectangle is outside the redraw rectangles are skipped.
+     *
+     * @param redraw_rectangles The parts of the window which are redrawn.
+     */
+    void cull(dirty_rectangles const &redraw_rectangles) noexcept;
+
+    /** Check if the widget at index was culled by the last call to `cull()`.
+     *
+     * @param index The index of a widget, or `no_index` for a widget that is not yet part of the tree.
+     * @return True if the widget does not overlap the redraw rectangles.
+     */
+    [[nodiscard]] bool is_culled(size_t index) const noexcept
+    {
+        return _valid and index < _is_culled.size() and _is_culled[index];
+    }
+
+    /** Get the index of the parent of a widget.
+     * @return The index of the parent, or `no_index` for the root.
+     */
+    [[nodiscard]] size_t parent(size_t index) const noexcept
+    {
+        tt_axiom(index < size());
+        return _parents[index];
+    }
+
+    /** Get the index one beyond the last descendant of a widget.
+     * The descendants of a widget at index are located at `[index + 1, subtree_end(index))`.
+     */
+    [[nodiscard]] size_t subtree_end(size_t index) const noexcept
+    {
+        tt_axiom(index < size());
+        return _subtree_ends[index];
+    }
+
+private:
+    bool _valid = false;
+
+    std::vector<widget *> _widgets;
+
+    /** The index of the parent of each widget.
+     */
+    std::vector<size_t> _parents;
+
+    /** The index one beyond the last descendant of each widget.
+     */
+    std::vector<size_t> _subtree_ends;
+
+    /** The clipping rectangle of each widget, in window coordinates.
+     */
+    std::vector<aarectangle> _clipping_rectangles;
+
+    /** The hitbox rectangle of each widget, in window coordinates.
+     * The hitbox rectangle of a container includes the rectangles of all its descendants.
+     */
+    std::vector<aarectangle> _hitbox_rectangles;
+
+    std::vector<bool> _is_culled;
+};
+
+} // namespace tt
@@ -8,64 +8,92 @@
 
 namespace tt {
 
-[[nodiscard]] std::pair<size_t, size_t> grid_layout_widget::calculate_grid_size(std::vector<cell> const &cells) noexcept
+void grid_layout_widget::update_flow_layout(
+    flow_layout &layout,
+    std::vector<std::vector<size_t>> const &index,
+    std::vector<bool> &is_dirty,
+    bool is_row) const noexcept
 {
-    size_t nr_columns = 0;
-    size_t nr_rows = 0;
+    tt_axiom(index.size() == is_dirty.size());
 
-    for (auto &&cell : cells) {
-        nr_rows = std::max(nr_rows, cell.row_nr + 1);
-        nr_columns = std::max(nr_columns, cell.column_nr + 1);
+    layout.reserve(std::ssize(index));
+
+    for (size_t i = 0; i != is_dirty.size(); ++i) {
+        if (is_dirty[i]) {
+            layout.clear(i);
+        }
     }
 
-    return {nr_columns, nr_rows};
+    // The margins of a dirty item are shared with its neighbours, so the neighbours are updated as well.
+    for (size_t i = 0; i != index.size(); ++i) {
+        ttlet needs_update = is_dirty[i] or (i > 0 and is_dirty[i - 1]) or (i + 1 < is_dirty.size() and is_dirty[i + 1]);
+        if (not needs_update) {
+            continue;
+        }
+
+        for (ttlet cell_nr : index[i]) {
+            ttlet &cell = _cells[cell_nr];
+            if (is_row) {
+                layout.update(
+                    i, cell.minimum_size.height(), cell.preferred_size.height(), cell.maximum_size.height(), cell.margin);
+            } else {
+                layout.update(
+                    i, cell.minimum_size.width(), cell.preferred_size.width(), cell.maximum_size.width(), cell.margin);
+            }
+        }
+    }
+
+    std::fill(is_dirty.begin(), is_dirty.end(), false);
 }
 
-[[nodiscard]] std::tuple<extent2, extent2, extent2>
-grid_layout_widget::calculate_size(std::vector<cell> const &cells, flow_layout &rows, flow_layout &columns) noexcept
+[[nodiscard]] std::tuple<extent2, extent2, extent2> grid_layout_widget::calculate_size() noexcept
 {
     tt_axiom(gui_system_mutex.recurse_lock_count());
 
-    rows.clear();
-    columns.clear();
-
-    ttlet[nr_columns, nr_rows] = calculate_grid_size(cells);
-    rows.reserve(nr_rows);
-    columns.reserve(nr_columns);
-
-    ttlet max_row_nr = nr_rows - 1;
-    for (auto &&cell : cells) {
-        rows.update(
-            cell.row_nr,
-            cell.widget->minimum_size().height(),
-            cell.widget->preferred_size().height(),
-            cell.widget->maximum_size().height(),
-            cell.widget->margin());
-
-        columns.update(
-            cell.column_nr,
-            cell.widget->minimum_size().width(),
-            cell.widget->preferred_size().width(),
-            cell.widget->maximum_size().width(),
-            cell.widget->margin());
+    for (auto &&cell : _cells) {
+        if (cell.update_constraints()) {
+            _row_is_dirty[cell.row_nr] = true;
+            _column_is_dirty[cell.column_nr] = true;
+        }
     }
 
+    update_flow_layout(_rows, _row_cells, _row_is_dirty, true);
+    update_flow_layout(_columns, _column_cells, _column_is_dirty, false);
+
     return {
-        extent2{columns.minimum_size(), rows.minimum_size()},
-        extent2{columns.preferred_size(), rows.preferred_size()},
-        extent2{columns.maximum_size(), rows.maximum_size()}};
+        extent2{_columns.minimum_size(), _rows.minimum_size()},
+        extent2{_columns.preferred_size(), _rows.preferred_size()},
+        extent2{_columns.maximum_size(), _rows.maximum_size()}};
 }
 
 bool grid_layout_widget::address_in_use(size_t column_nr, size_t row_nr) const noexcept
 {
-    for (ttlet &cell : _cells) {
-        if (cell.column_nr == column_nr && cell.row_nr == row_nr) {
+    if (row_nr >= _row_cells.size()) {
+        return false;
+    }
+
+    for (ttlet cell_nr : _row_cells[row_nr]) {
+        if (_cells[cell_nr].column_nr == column_nr) {
             return true;
         }
     }
     return false;
 }
 
+void grid_layout_widget::clear() noexcept
+{
+    ttlet lock = std::scoped_lock(gui_system_mutex);
+
+    _cells.clear();
+    _row_cells.clear();
+    _column_cells.clear();
+    _row_is_dirty.clear();
+    _column_is_dirty.clear();
+    _rows.clear();
+    _columns.clear();
+    super::clear();
+}
+
 std::shared_ptr<widget> grid_layout_widget::add_widget(size_t column_nr, size_t row_nr, std::shared_ptr<widget> widget) noexcept
 {
     ttlet lock = std::scoped_lock(gui_system_mutex);
@@ -73,6 +101,20 @@ std::shared_ptr<widget> grid_layout_widget::add_widget(size_t column_nr, size_t
 
     tt_assert(!address_in_use(column_nr, row_nr), "cell ({},{}) of grid_widget is already in use", column_nr, row_nr);
 
+    if (row_nr >= _row_cells.size()) {
+        _row_cells.resize(row_nr + 1);
+        _row_is_dirty.resize(row_nr + 1, true);
+    }
+    if (column_nr >= _column_cells.size()) {
+        _column_cells.resize(column_nr + 1);
+        _column_is_dirty.resize(column_nr + 1, true);
+    }
+
+    _row_cells[row_nr].push_back(_cells.size());
+    _column_cells[column_nr].push_back(_cells.size());
+    _row_is_dirty[row_nr] = true;
+    _column_is_dirty[column_nr] = true;
+
     _cells.emplace_back(column_nr, row_nr, tmp);
     return tmp;
 }
@@ -82,7 +124,7 @@ bool grid_layout_widget::update_constraints(hires_utc_clock::time_point display_
     tt_axiom(gui_system_mutex.recurse_lock_count());
 
     if (super::update_constraints(display_time_point, need_reconstrain)) {
-        std::tie(_minimum_size, _preferred_size, _maximum_size) = calculate_size(_cells, _rows, _columns);
+        std::tie(_minimum_size, _preferred_size, _maximum_size) = calculate_size();
         tt_axiom(_minimum_size <= _preferred_size && _preferred_size <= _maximum_size);
         return true;
     } else {
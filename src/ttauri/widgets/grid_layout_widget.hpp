@@ -39,6 +39,10 @@ public:
         }
     }
 
+    /** Remove and deallocate all child widgets.
+     */
+    void clear() noexcept;
+
     [[nodiscard]] bool
     update_constraints(hires_utc_clock::time_point display_time_point, bool need_reconstrain) noexcept override;
     [[nodiscard]] void update_layout(hires_utc_clock::time_point display_time_point, bool need_layout) noexcept override;
@@ -76,11 +80,33 @@ private:
         size_t row_nr;
         std::shared_ptr<tt::widget> widget;
 
+        /** The constraints of the widget when the row and column were last calculated.
+         */
+        extent2 minimum_size;
+        extent2 preferred_size;
+        extent2 maximum_size;
+        float margin = 0.0f;
+
         cell(size_t column_nr, size_t row_nr, std::shared_ptr<tt::widget> widget) noexcept :
             column_nr(column_nr), row_nr(row_nr), widget(std::move(widget))
         {
         }
 
+        /** Copy the constraints of the widget.
+         * @return True if the constraints of the widget have changed.
+         */
+        [[nodiscard]] bool update_constraints() noexcept
+        {
+            ttlet has_changed = minimum_size != widget->minimum_size() or preferred_size != widget->preferred_size() or
+                maximum_size != widget->maximum_size() or margin != widget->margin();
+
+            minimum_size = widget->minimum_size();
+            preferred_size = widget->preferred_size();
+            maximum_size = widget->maximum_size();
+            margin = widget->margin();
+            return has_changed;
+        }
+
         [[nodiscard]] aarectangle rectangle(flow_layout const &columns, flow_layout const &rows, float container_height) const noexcept
         {
             ttlet[x, width] = columns.get_offset_and_size(column_nr);
@@ -92,14 +118,35 @@ private:
 
     std::vector<cell> _cells;
 
+    /** The indices into `_cells` of the cells in each row and in each column.
+     */
+    std::vector<std::vector<size_t>> _row_cells;
+    std::vector<std::vector<size_t>> _column_cells;
+
+    /** The rows and columns which need to be recalculated in `_rows` and `_columns`.
+     */
+    std::vector<bool> _row_is_dirty;
+    std::vector<bool> _column_is_dirty;
+
     std::weak_ptr<grid_layout_delegate> _delegate;
 
     flow_layout _rows;
     flow_layout _columns;
 
-    [[nodiscard]] static std::pair<size_t, size_t> calculate_grid_size(std::vector<cell> const &cells) noexcept;
-    [[nodiscard]] static std::tuple<extent2, extent2, extent2>
-    calculate_size(std::vector<cell> const &cells, flow_layout &rows, flow_layout &columns) noexcept;
+    /** Recalculate the dirty items of a flow layout from the cells in those rows or columns.
+     *
+     * @param layout The row or column layout to update.
+     * @param index The indices into `_cells` of the cells in each row or column.
+     * @param is_dirty The rows or columns to recalculate, reset to false on return.
+     * @param is_row True when updating the rows, which use the height of the cells.
+     */
+    void update_flow_layout(
+        flow_layout &layout,
+        std::vector<std::vector<size_t>> const &index,
+        std::vector<bool> &is_dirty,
+        bool is_row) const noexcept;
+
+    [[nodiscard]] std::tuple<extent2, extent2, extent2> calculate_size() noexcept;
     [[nodiscard]] bool address_in_use(size_t column_nr, size_t row_nr) const noexcept;
 };
 
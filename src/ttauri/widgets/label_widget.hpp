@@ -47,7 +47,7 @@ public:
 
     void init() noexcept override {
         _label_callback = label.subscribe([this](auto...) {
-            _request_reconstrain = true;
+            request_reconstrain();
         });
     }
 
@@ -82,7 +82,7 @@ public:
         tt_axiom(gui_system_mutex.recurse_lock_count());
 
         if (overlaps(context, _clipping_rectangle)) {
-            _label_cell->draw(context, this->label_color());
+            _label_cell->draw(context, this->style().label_color);
         }
 
         super::draw(std::move(context), display_time_point);
@@ -67,7 +67,7 @@ public:
     {
         super::init();
         _label_callback = this->label.subscribe([this](auto...) {
-            this->_request_reconstrain = true;
+            this->request_reconstrain();
         });
     }
 
@@ -77,7 +77,7 @@ public:
     {
         tt_axiom(gui_system_mutex.recurse_lock_count());
         this->_show_check_mark = flag;
-        this->_request_reconstrain = true;
+        this->request_reconstrain();
     }
 
     /** Whether the label aligns to an optional check-mark.
@@ -91,7 +91,7 @@ public:
      */
     [[nodiscard]] bool show_check_mark() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return _show_check_mark;
     }
 
@@ -101,7 +101,7 @@ public:
     {
         tt_axiom(gui_system_mutex.recurse_lock_count());
         this->_show_icon = flag;
-        this->_request_reconstrain = true;
+        this->request_reconstrain();
     }
 
     /** Whether the text in the label will align to an optional icon in the label.
@@ -118,7 +118,7 @@ public:
      */
     [[nodiscard]] bool show_icon() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return _show_icon;
     }
 
@@ -128,7 +128,7 @@ public:
     {
         tt_axiom(gui_system_mutex.recurse_lock_count());
         this->_show_short_cut = flag;
-        this->_request_reconstrain = true;
+        this->request_reconstrain();
     }
 
     /** Whether the menu item should make space for an optional short-cut.
@@ -144,13 +144,28 @@ public:
      */
     [[nodiscard]] bool show_short_cut() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return _show_short_cut;
     }
 
+    /** The size that a menu item adds around its label.
+     * This allows the size of a menu to be calculated from the labels, without making the menu items.
+     */
+    [[nodiscard]] static extent2 label_padding(bool show_check_mark, bool show_short_cut) noexcept
+    {
+        auto width = theme::global->margin * 2.0f;
+        if (show_check_mark) {
+            width += theme::global->small_icon_size + theme::global->margin;
+        }
+        if (show_short_cut) {
+            width += theme::global->margin + theme::global->small_icon_size * 3.0f;
+        }
+        return extent2{width, theme::global->margin * 2.0f};
+    }
+
     [[nodiscard]] bool accepts_keyboard_focus(keyboard_focus_group group) const noexcept override
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         if (_parent_is_toolbar) {
             return is_toolbar(group) && *this->enabled;
         } else {
@@ -221,15 +236,7 @@ public:
 
             _check_mark_stencil = stencil::make_unique(alignment::middle_center, elusive_icon::Ok);
 
-            auto width = theme::global->margin * 2.0f;
-            if (_show_check_mark) {
-                width += theme::global->small_icon_size + theme::global->margin;
-            }
-            if (_show_short_cut) {
-                width += theme::global->margin + theme::global->small_icon_size * 3.0f;
-            }
-
-            ttlet extra_size = extent2{width, theme::global->margin * 2.0f};
+            ttlet extra_size = label_padding(_show_check_mark, _show_short_cut);
 
             this->_minimum_size = _label_stencil->minimum_size() + extra_size;
             this->_preferred_size = _label_stencil->preferred_size() + extra_size;
@@ -313,18 +320,18 @@ private:
     void draw_background(draw_context context) noexcept
     {
         tt_axiom(gui_system_mutex.recurse_lock_count());
-        context.draw_box_with_border_inside(this->rectangle(), this->background_color(), this->focus_color());
+        context.draw_box_with_border_inside(this->rectangle(), this->style().background_color, this->style().focus_color);
     }
 
     void draw_label(draw_context context) noexcept
     {
-        _label_stencil->draw(context, this->label_color(), translate_z(0.1f));
+        _label_stencil->draw(context, this->style().label_color, translate_z(0.1f));
     }
 
     void draw_check_mark(draw_context context) noexcept
     {
         if (this->value == this->true_value) {
-            _check_mark_stencil->draw(context, this->accent_color(), translate_z(0.1f));
+            _check_mark_stencil->draw(context, this->style().accent_color, translate_z(0.1f));
         }
     }
 };
@@ -35,10 +35,15 @@ public:
         auto has_updated_contraints = super::update_constraints(display_time_point, need_reconstrain);
 
         if (has_updated_contraints) {
-            tt_axiom(_content);
-            _minimum_size = _content->minimum_size();
-            _preferred_size = _content->preferred_size();
-            _maximum_size = _content->maximum_size();
+            if (_content) {
+                _minimum_size = _content->minimum_size();
+                _preferred_size = _content->preferred_size();
+                _maximum_size = _content->maximum_size();
+            } else {
+                _minimum_size = {};
+                _preferred_size = {};
+                _maximum_size = {};
+            }
             tt_axiom(_minimum_size <= _preferred_size && _preferred_size <= _maximum_size);
         }
 
@@ -50,8 +55,7 @@ public:
         tt_axiom(gui_system_mutex.recurse_lock_count());
 
         need_layout |= std::exchange(_request_relayout, false);
-        if (need_layout) {
-            tt_axiom(_content);
+        if (need_layout && _content) {
             _content->set_layout_parameters_from_parent(rectangle(), rectangle(), 1.0f);
         }
 
@@ -75,7 +79,7 @@ public:
      */
     [[nodiscard]] aarectangle make_overlay_rectangle_from_parent(aarectangle requested_rectangle) const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
 
         if (auto parent = _parent.lock()) {
             ttlet requested_window_rectangle = aarectangle{parent->local_to_window() * requested_rectangle};
@@ -98,6 +102,24 @@ public:
         return widget;
     }
 
+    /** Remove and deallocate the content.
+     * An overlay that is only shown on request, such as a menu, may be emptied while it is closed;
+     * after which a new content can be made with `make_widget()`.
+     */
+    void clear() noexcept
+    {
+        ttlet lock = std::scoped_lock(gui_system_mutex);
+
+        _content = {};
+        super::clear();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
+        return not _content;
+    }
+
     [[nodiscard]] color background_color() const noexcept override
     {
         return theme::global->fillColor(_semantic_layer + 1);
@@ -119,7 +141,7 @@ private:
 
     void draw_background(draw_context context) noexcept
     {
-        context.draw_box_with_border_outside(rectangle(), background_color(), foreground_color());
+        context.draw_box_with_border_outside(rectangle(), style().background_color, style().foreground_color);
     }
 };
 
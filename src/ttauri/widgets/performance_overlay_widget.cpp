@@ -0,0 +1,166 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "performance_overlay_widget.hpp"
+#include "../GUI/frame_statistics.hpp"
+#include "../codec/UTF.hpp"
+#include "../allocation_tracker.hpp"
+#include <fmt/format.h>
+#include <algorithm>
+
+namespace tt {
+
+performance_overlay_widget::performance_overlay_widget(gui_window &window, std::shared_ptr<abstract_container_widget> parent) noexcept
+    :
+    super(window, parent)
+{
+    if (parent) {
+        // The overlay is drawn above any other widget, including overlays such as menus.
+        ttlet lock = std::scoped_lock(gui_system_mutex);
+        _draw_layer = parent->draw_layer() + 30.0f;
+    }
+    _margin = 0.0f;
+}
+
+[[nodiscard]] bool
+performance_overlay_widget::update_constraints(hires_utc_clock::time_point display_time_point, bool need_reconstrain) noexcept
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    if (super::update_constraints(display_time_point, need_reconstrain)) {
+        // The overlay is placed by the window_widget and does not affect the size of the window.
+        _minimum_size = _preferred_size = _maximum_size = {};
+        return true;
+    } else {
+        return false;
+    }
+}
+
+void performance_overlay_widget::toggle() noexcept
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    _visible = not _visible;
+    request_redraw();
+}
+
+void performance_overlay_widget::shape_lines() noexcept
+{
+    ttlet &history = window.frame_history;
+
+    auto cpu_duration = hires_utc_clock::duration{};
+    auto gpu_duration = hires_utc_clock::duration{};
+    int64_t nr_constrained = 0;
+    int64_t nr_laid_out = 0;
+    int64_t nr_drawn = 0;
+    int64_t nr_hitbox_tested = 0;
+    int64_t nr_allocations = 0;
+    for (size_t i = 0; i != history.size(); ++i) {
+        ttlet &frame = history[i];
+        cpu_duration += frame.cpu_duration;
+        gpu_duration += frame.gpu_duration;
+        nr_constrained += frame.nr_constrained;
+        nr_laid_out += frame.nr_laid_out;
+        nr_drawn += frame.nr_drawn;
+        nr_hitbox_tested += frame.nr_hitbox_tested;
+        nr_allocations += frame.nr_allocations;
+    }
+
+    ttlet nr_frames = static_cast<int64_t>(std::max(history.size(), 1_uz));
+    ttlet last_frame = history.empty() ? frame_statistics{} : history.back();
+
+    ttlet texts = std::array{
+        fmt::format(
+            "frame: cpu {} gpu {}",
+            format_engineering(cpu_duration / nr_frames),
+            format_engineering(gpu_duration / nr_frames)),
+        fmt::format(
+            "widgets: {} constrained, {} laid out, {} drawn, {} hit tested",
+            nr_constrained / nr_frames,
+            nr_laid_out / nr_frames,
+            nr_drawn / nr_frames,
+            nr_hitbox_tested / nr_frames),
+        fmt::format(
+            "atlas: SDF {:.0f}%, image {}/{} pages",
+            last_frame.sdf_atlas_occupancy * 100.0f,
+            last_frame.nr_image_atlas_pages,
+            last_frame.image_atlas_capacity),
+        allocation_tracking_is_enabled ? fmt::format("allocations: {} per frame", nr_allocations / nr_frames) :
+                                         std::string{"allocations: not tracked"}};
+    static_assert(std::tuple_size_v<decltype(texts)> == nr_lines);
+
+    ttlet text_width = rectangle().width() - theme::global->margin * 2.0f;
+    for (size_t i = 0; i != nr_lines; ++i) {
+        _lines[i] = shaped_text(to_u8string(texts[i]), theme::global->smallLabelStyle, text_width, alignment::middle_left, false);
+    }
+}
+
+void performance_overlay_widget::draw_graph(draw_context const &context, aarectangle graph_rectangle) noexcept
+{
+    using namespace std::chrono_literals;
+
+    ttlet &history = window.frame_history;
+
+    // The graph shows at least two frames at 60 fps, so that the reference line stays in place
+    // until a frame takes longer than that.
+    ttlet reference_duration = std::chrono::duration_cast<hires_utc_clock::duration>(16'667us);
+    auto maximum_duration = reference_duration * 2;
+    for (size_t i = 0; i != history.size(); ++i) {
+        maximum_duration = std::max(maximum_duration, history[i].cpu_duration + history[i].gpu_duration);
+    }
+
+    ttlet to_height = [&](hires_utc_clock::duration duration) {
+        return graph_rectangle.height() * static_cast<float>(duration.count()) / static_cast<float>(maximum_duration.count());
+    };
+
+    // The newest frame is on the right.
+    ttlet bar_width = graph_rectangle.width() / static_cast<float>(frame_statistics_history::capacity);
+    ttlet first_x = graph_rectangle.right() - bar_width * static_cast<float>(history.size());
+    for (size_t i = 0; i != history.size(); ++i) {
+        ttlet &frame = history[i];
+        ttlet x = first_x + bar_width * static_cast<float>(i);
+        ttlet cpu_height = to_height(frame.cpu_duration);
+        ttlet gpu_height = to_height(frame.gpu_duration);
+
+        ttlet cpu_rectangle = aarectangle{x, graph_rectangle.bottom(), bar_width, cpu_height};
+        ttlet gpu_rectangle = aarectangle{x, graph_rectangle.bottom() + cpu_height, bar_width, gpu_height};
+        context.draw_filled_quad(translate3{0.0f, 0.0f, 0.1f} * cpu_rectangle, theme::global->blue);
+        context.draw_filled_quad(translate3{0.0f, 0.0f, 0.1f} * gpu_rectangle, theme::global->orange);
+    }
+
+    ttlet reference_rectangle =
+        aarectangle{graph_rectangle.left(), graph_rectangle.bottom() + to_height(reference_duration), graph_rectangle.width(), 1.0f};
+    context.draw_filled_quad(translate3{0.0f, 0.0f, 0.2f} * reference_rectangle, theme::global->red);
+}
+
+void performance_overlay_widget::draw(draw_context context, hires_utc_clock::time_point display_time_point) noexcept
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    if (_visible and overlaps(context, _clipping_rectangle)) {
+        shape_lines();
+
+        context.draw_box_with_border_outside(rectangle(), style().background_color, style().foreground_color);
+
+        ttlet inner_rectangle = shrink(rectangle(), theme::global->margin);
+        ttlet graph_rectangle = aarectangle{
+            inner_rectangle.left(), inner_rectangle.top() - graph_height, inner_rectangle.width(), graph_height};
+        draw_graph(context, graph_rectangle);
+
+        auto y = graph_rectangle.bottom() - line_height * 0.5f;
+        for (auto &line : _lines) {
+            context.draw_text(
+                line, style().label_color, line.translate_base_line(point2{inner_rectangle.left(), y}) * translate_z(0.2f));
+            y -= line_height;
+        }
+
+        // Refresh the statistics a few times per second, without forcing frames to be rendered continuously.
+        ttlet refresh_time_point = display_time_point + refresh_interval;
+        window.request_animation(weak_from_this(), refresh_time_point, refresh_time_point);
+    }
+
+    super::draw(std::move(context), display_time_point);
+}
+
+} // namespace tt
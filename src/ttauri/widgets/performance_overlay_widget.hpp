@@ -0,0 +1,72 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "widget.hpp"
+#include "../text/shaped_text.hpp"
+#include <array>
+#include <chrono>
+#include <memory>
+
+namespace tt {
+
+/** An overlay showing the statistics of the last frames rendered by the window.
+ *
+ * The overlay shows a graph of the CPU and GPU time of each frame, and the average over
+ * these frames of the number of widgets constrained, laid out and drawn, the occupancy of
+ * the atlases and the number of allocations. The statistics are taken from `gui_window::frame_history`.
+ *
+ * The overlay is hidden by default and is toggled with the `gui_toggle_performance_overlay` command.
+ * While visible it is redrawn a few times per second; it does not cause frames to be rendered
+ * continuously, so that it does not change the statistics it shows.
+ */
+class performance_overlay_widget final : public widget {
+public:
+    using super = widget;
+
+    performance_overlay_widget(gui_window &window, std::shared_ptr<abstract_container_widget> parent) noexcept;
+    ~performance_overlay_widget() {}
+
+    [[nodiscard]] bool
+    update_constraints(hires_utc_clock::time_point display_time_point, bool need_reconstrain) noexcept override;
+    void draw(draw_context context, hires_utc_clock::time_point display_time_point) noexcept override;
+
+    /** The overlay does not handle the mouse, so that the widgets below it remain usable.
+     */
+    [[nodiscard]] hit_box hitbox_test(point2 position) const noexcept override
+    {
+        return {};
+    }
+
+    [[nodiscard]] bool visible() const noexcept
+    {
+        return _visible;
+    }
+
+    /** Show or hide the overlay.
+     */
+    void toggle() noexcept;
+
+    /** The size of the overlay.
+     */
+    static constexpr extent2 size = {320.0f, 180.0f};
+
+private:
+    static constexpr float graph_height = 80.0f;
+    static constexpr float line_height = 18.0f;
+    static constexpr size_t nr_lines = 4;
+    static constexpr std::chrono::milliseconds refresh_interval = std::chrono::milliseconds(250);
+
+    bool _visible = false;
+
+    /** The text lines, shaped when the overlay is refreshed.
+     */
+    std::array<shaped_text, nr_lines> _lines;
+
+    void shape_lines() noexcept;
+    void draw_graph(draw_context const &context, aarectangle graph_rectangle) noexcept;
+};
+
+} // namespace tt
@@ -56,7 +56,7 @@ public:
     void init() noexcept override
     {
         label_callback = label.subscribe([this](auto...) {
-            this->_request_reconstrain = true;
+            this->request_reconstrain();
         });
     }
 
@@ -130,7 +130,10 @@ private:
         tt_axiom(gui_system_mutex.recurse_lock_count());
 
         context.draw_box_with_border_inside(
-            _outline_rectangle, this->background_color(), this->focus_color(), corner_shapes{_outline_rectangle.height() * 0.5f});
+            _outline_rectangle,
+            this->style().background_color,
+            this->style().focus_color,
+            corner_shapes{_outline_rectangle.height() * 0.5f});
     }
 
     void draw_pip(draw_context context) noexcept
@@ -140,14 +143,14 @@ private:
         // draw pip
         if (this->value == this->true_value) {
             context.draw_box(
-                _pip_rectangle, this->accent_color(), corner_shapes{_pip_rectangle.height() * 0.5f});
+                _pip_rectangle, this->style().accent_color, corner_shapes{_pip_rectangle.height() * 0.5f});
         }
     }
 
     void draw_label(draw_context context) noexcept
     {
         tt_axiom(gui_system_mutex.recurse_lock_count());
-        _label_stencil->draw(context, this->label_color());
+        _label_stencil->draw(context, this->style().label_color);
     }
 };
 
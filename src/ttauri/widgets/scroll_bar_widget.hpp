@@ -102,7 +102,7 @@ public:
 
     hit_box hitbox_test(point2 position) const noexcept override
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
 
         if (visible() && _visible_rectangle.contains(position) && slider_rectangle.contains(position)) {
             return hit_box{weak_from_this(), _draw_layer};
@@ -151,7 +151,7 @@ public:
      */
     [[nodiscard]] bool visible() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return hidden_content() >= 1.0f;
     }
 
@@ -184,13 +184,13 @@ private:
 
     [[nodiscard]] float rail_length() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return is_vertical ? rectangle().height() : rectangle().width();
     }
 
     [[nodiscard]] float slider_length() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
 
         ttlet content_aperture_ratio = *aperture / *content;
         return std::max(rail_length() * content_aperture_ratio, theme::global->smallSize * 2.0f);
@@ -200,7 +200,7 @@ private:
      */
     [[nodiscard]] float slider_travel_range() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return rail_length() - slider_length();
     }
 
@@ -208,7 +208,7 @@ private:
      */
     [[nodiscard]] float hidden_content() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return *content - *aperture;
     }
 
@@ -218,7 +218,7 @@ private:
      */
     [[nodiscard]] float hidden_content_vs_travel_ratio() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
 
         ttlet _slider_travel_range = slider_travel_range();
         return _slider_travel_range != 0.0f ? hidden_content() / _slider_travel_range : 0.0f;
@@ -230,7 +230,7 @@ private:
      */
     [[nodiscard]] float travel_vs_hidden_content_ratio() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
 
         ttlet _hidden_content = hidden_content();
         return _hidden_content != 0.0f ? slider_travel_range() / _hidden_content : 0.0f;
@@ -242,7 +242,7 @@ private:
 
         ttlet corner_shapes =
             is_vertical ? tt::corner_shapes{rectangle().width() * 0.5f} : tt::corner_shapes{rectangle().height() * 0.5f};
-        context.draw_box(rectangle(), background_color(), corner_shapes);
+        context.draw_box(rectangle(), style().background_color, corner_shapes);
     }
 
     void draw_slider(draw_context context) noexcept
@@ -252,7 +252,7 @@ private:
         ttlet corner_shapes = is_vertical ? tt::corner_shapes{slider_rectangle.width() * 0.5f} :
                                             tt::corner_shapes{slider_rectangle.height() * 0.5f};
 
-        context.draw_box(translate_z(0.1f) * slider_rectangle, foreground_color(), corner_shapes);
+        context.draw_box(translate_z(0.1f) * slider_rectangle, style().foreground_color, corner_shapes);
     }
 };
 
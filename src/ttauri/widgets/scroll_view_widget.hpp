@@ -178,7 +178,7 @@ public:
 
     [[nodiscard]] hit_box hitbox_test(point2 position) const noexcept override
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         tt_axiom(_content);
 
         auto r = super::hitbox_test(position);
@@ -211,7 +211,7 @@ public:
             handled = true;
             _scroll_offset_x += event.wheelDelta.x();
             _scroll_offset_y += event.wheelDelta.y();
-            _request_relayout = true;
+            request_relayout();
             return true;
         }
         return handled;
@@ -7,7 +7,8 @@
 #include "abstract_container_widget.hpp"
 #include "overlay_view_widget.hpp"
 #include "scroll_view_widget.hpp"
-#include "row_column_layout_widget.hpp"
+#include "virtual_column_widget.hpp"
+#include "virtual_column_delegate.hpp"
 #include "menu_item_widget.hpp"
 #include "../stencils/label_stencil.hpp"
 #include "../GUI/draw_context.hpp"
@@ -17,6 +18,7 @@
 #include <memory>
 #include <string>
 #include <array>
+#include <algorithm>
 #include <optional>
 #include <future>
 
@@ -55,21 +57,21 @@ public:
 
     void init() noexcept override
     {
+        // The menu items are only made while the menu is open, see `start_selecting()`.
         _overlay_widget = super::make_widget<overlay_view_widget>();
-        _scroll_widget = _overlay_widget->make_widget<vertical_scroll_view_widget<>>();
-        _column_widget = _scroll_widget->make_widget<column_layout_widget>();
+        _menu_delegate = std::make_shared<menu_delegate>(*this);
 
         repopulate_options();
 
         _value_callback = this->value.subscribe([this](auto...) {
-            _request_reconstrain = true;
+            request_reconstrain();
         });
         _option_list_callback = this->option_list.subscribe([this](auto...) {
             repopulate_options();
-            _request_reconstrain = true;
+            request_reconstrain();
         });
         _unknown_label_callback = this->unknown_label.subscribe([this](auto...) {
-            _request_reconstrain = true;
+            request_reconstrain();
         });
     }
 
@@ -77,6 +79,12 @@ public:
     {
         tt_axiom(gui_system_mutex.recurse_lock_count());
 
+        if (not _selecting && not _overlay_widget->empty()) {
+            // The menu was closed, possibly by one of its own menu items; it is freed here
+            // since none of the menu items are handling an event while constraining.
+            free_menu();
+        }
+
         auto updated = super::update_constraints(display_time_point, need_reconstrain);
 
         if (updated) {
@@ -91,7 +99,7 @@ public:
                 _text_stencil_color = theme::global->labelStyle.color;
             }
 
-            // Calculate the size of the widget based on the largest height of a label and the width of the overlay.
+            // Calculate the size of the widget based on the largest height of a label and the width of the menu.
             ttlet unknown_label_stencil =
                 stencil::make_unique(alignment::middle_left, *unknown_label, theme::global->placeholderLabelStyle);
 
@@ -99,14 +107,13 @@ public:
             ttlet extra_height = theme::global->margin * 2.0f;
 
             _minimum_size = {
-                std::max(_overlay_widget->preferred_size().width(), unknown_label_stencil->minimum_size().width()) + extra_width,
+                std::max(_max_option_width, unknown_label_stencil->minimum_size().width()) + extra_width,
                 std::max(_max_option_label_height, unknown_label_stencil->minimum_size().height()) + extra_height};
             _preferred_size = {
-                std::max(_overlay_widget->preferred_size().width(), unknown_label_stencil->preferred_size().width()) +
-                    extra_width,
+                std::max(_max_option_width, unknown_label_stencil->preferred_size().width()) + extra_width,
                 std::max(_max_option_label_height, unknown_label_stencil->preferred_size().height()) + extra_height};
             _maximum_size = {
-                std::max(_overlay_widget->preferred_size().width(), unknown_label_stencil->maximum_size().width()) + extra_width,
+                std::max(_max_option_width, unknown_label_stencil->maximum_size().width()) + extra_width,
                 std::max(_max_option_label_height, unknown_label_stencil->maximum_size().height()) + extra_height};
 
             tt_axiom(_minimum_size <= _preferred_size && _preferred_size <= _maximum_size);
@@ -163,6 +170,10 @@ public:
             _text_stencil->set_layout_parameters(_option_rectangle, base_line());
         }
         super::update_layout(display_time_point, need_layout);
+
+        if (_need_menu_focus) {
+            update_menu_focus();
+        }
     }
 
     void draw(draw_context context, hires_utc_clock::time_point display_time_point) noexcept override
@@ -206,7 +217,7 @@ public:
     bool handle_event(command command) noexcept override
     {
         ttlet lock = std::scoped_lock(gui_system_mutex);
-        _request_relayout = true;
+        request_relayout();
 
         if (*enabled) {
             switch (command) {
@@ -235,7 +246,7 @@ public:
 
     [[nodiscard]] hit_box hitbox_test(point2 position) const noexcept override
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
 
         auto r = hit_box{};
 
@@ -252,7 +263,7 @@ public:
 
     [[nodiscard]] bool accepts_keyboard_focus(keyboard_focus_group group) const noexcept override
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return is_normal(group) && *enabled;
     }
 
@@ -272,6 +283,44 @@ public:
     }
 
 private:
+    /** The delegate of the virtual column of the menu.
+     * The rows of the menu are the options, only the visible options have a menu item.
+     */
+    class menu_delegate final : public virtual_column_delegate {
+    public:
+        menu_delegate(selection_widget &selection) noexcept : _selection(selection) {}
+
+        [[nodiscard]] size_t size(virtual_column_widget const &self) const noexcept override
+        {
+            return _selection._options.size();
+        }
+
+        [[nodiscard]] std::shared_ptr<widget> make_row(virtual_column_widget &self) noexcept override
+        {
+            auto menu_item = self.make_row_widget<menu_item_widget<value_type>>(value_type{}, _selection.value);
+            menu_item->set_show_check_mark(true);
+            menu_item->set_show_icon(_selection._show_icon);
+
+            _selection._menu_item_callbacks.push_back(menu_item->subscribe([this, menu_item_ = menu_item.get()] {
+                _selection.value = menu_item_->true_value;
+                _selection.stop_selecting();
+            }));
+            return menu_item;
+        }
+
+        void bind_row(virtual_column_widget &self, widget &row_widget, size_t row_nr) noexcept override
+        {
+            auto &menu_item = static_cast<menu_item_widget<value_type> &>(row_widget);
+            ttlet &[tag, text] = _selection._options[row_nr];
+            menu_item.true_value = tag;
+            menu_item.label = text;
+            menu_item.request_redraw();
+        }
+
+    private:
+        selection_widget &_selection;
+    };
+
     typename decltype(unknown_label)::callback_ptr_type _unknown_label_callback;
     typename decltype(value)::callback_ptr_type _value_callback;
     typename decltype(option_list)::callback_ptr_type _option_list_callback;
@@ -281,6 +330,18 @@ private:
 
     float _max_option_label_height;
 
+    /** A copy of the option list, so that the menu can bind each row without copying the whole list.
+     */
+    option_list_type _options;
+
+    /** The preferred width of the widest menu item.
+     */
+    float _max_option_width;
+
+    /** If any of the options has an icon, all the menu items show an icon.
+     */
+    bool _show_icon = false;
+
     aarectangle _option_rectangle;
     aarectangle _left_box_rectangle;
 
@@ -290,15 +351,19 @@ private:
     bool _selecting = false;
     std::shared_ptr<overlay_view_widget> _overlay_widget;
     std::shared_ptr<vertical_scroll_view_widget<>> _scroll_widget;
-    std::shared_ptr<column_layout_widget> _column_widget;
-
-    std::vector<std::shared_ptr<menu_item_widget<value_type>>> _menu_item_widgets;
+    std::shared_ptr<virtual_column_widget> _column_widget;
+    std::shared_ptr<menu_delegate> _menu_delegate;
     std::vector<typename menu_item_widget<value_type>::callback_ptr_type> _menu_item_callbacks;
 
+    /** The keyboard focus is moved to the menu item of the selected option, once it is instantiated.
+     */
+    bool _need_menu_focus = false;
+    bool _menu_did_scroll = false;
+
     [[nodiscard]] ssize_t get_value_as_index() const noexcept
     {
         ssize_t index = 0;
-        for (ttlet & [ tag, unknown_label_text ] : *option_list) {
+        for (ttlet & [ tag, unknown_label_text ] : _options) {
             if (value == tag) {
                 return index;
             }
@@ -308,37 +373,18 @@ private:
         return -1;
     }
 
-    [[nodiscard]] std::shared_ptr<menu_item_widget<value_type>> get_first_menu_item() const noexcept
-    {
-        if (std::ssize(_menu_item_widgets) != 0) {
-            return _menu_item_widgets.front();
-        } else {
-            return {};
-        }
-    }
-
-    [[nodiscard]] std::shared_ptr<menu_item_widget<value_type>> get_selected_menu_item() const noexcept
-    {
-        ttlet i = get_value_as_index();
-        if (i >= 0 && i < std::ssize(_menu_item_widgets)) {
-            return _menu_item_widgets[i];
-        } else {
-            return {};
-        }
-    }
-
     void start_selecting() noexcept
     {
         tt_axiom(gui_system_mutex.recurse_lock_count());
 
-        _selecting = true;
-        if (auto selected_menu_item = get_selected_menu_item()) {
-            this->window.update_keyboard_target(selected_menu_item, keyboard_focus_group::menu);
-
-        } else if (auto first_menu_item = get_first_menu_item()) {
-            this->window.update_keyboard_target(first_menu_item, keyboard_focus_group::menu);
+        if (_overlay_widget->empty()) {
+            _scroll_widget = _overlay_widget->make_widget<vertical_scroll_view_widget<>>();
+            _column_widget = _scroll_widget->make_widget<virtual_column_widget>(_menu_delegate);
         }
 
+        _selecting = true;
+        _need_menu_focus = true;
+        _menu_did_scroll = false;
         request_redraw();
     }
 
@@ -347,44 +393,91 @@ private:
         tt_axiom(gui_system_mutex.recurse_lock_count());
 
         _selecting = false;
+        _need_menu_focus = false;
+        invalidate_style();
+        request_reconstrain();
         request_redraw();
     }
 
-    /** Populate the scroll view with menu items corresponding to the options.
+    /** Deallocate the menu items of a closed menu.
      */
-    void repopulate_options() noexcept
+    void free_menu() noexcept
     {
-        ttlet lock = std::scoped_lock(gui_system_mutex);
-        auto option_list_ = *option_list;
+        tt_axiom(gui_system_mutex.recurse_lock_count());
 
-        // If any of the options has a an icon, all of the options should show the icon.
-        auto show_icon = false;
-        for (ttlet & [ tag, label ] : option_list_) {
-            show_icon |= label.has_icon();
+        _column_widget = {};
+        _scroll_widget = {};
+        _overlay_widget->clear();
+        _menu_item_callbacks.clear();
+    }
+
+    /** Give the keyboard focus to the menu item of the selected option, or else the first menu item.
+     * The menu items are instantiated during layout, so this may take a couple of frames
+     * when the menu has to scroll to the selected option first.
+     */
+    void update_menu_focus() noexcept
+    {
+        tt_axiom(gui_system_mutex.recurse_lock_count());
+
+        if (not _column_widget) {
+            _need_menu_focus = false;
+            return;
         }
 
-        _column_widget->clear();
-        _menu_item_widgets.clear();
-        _menu_item_callbacks.clear();
-        for (ttlet & [ tag, text ] : option_list_) {
-            auto menu_item = _column_widget->make_widget<menu_item_widget<value_type>>(tag, this->value);
-            menu_item->set_show_check_mark(true);
-            menu_item->set_show_icon(show_icon);
-            menu_item->label = text;
+        ttlet rows = _column_widget->children();
+        if (rows.empty()) {
+            // The menu has not been laid out yet.
+            return;
+        }
 
-            _menu_item_callbacks.push_back(menu_item->subscribe([this, tag] {
-                this->value = tag;
-                this->_selecting = false;
-            }));
+        ttlet index = get_value_as_index();
+        ttlet first_row = _column_widget->first_row();
+        if (index >= 0 && narrow_cast<size_t>(index) >= first_row && narrow_cast<size_t>(index) < first_row + rows.size()) {
+            this->window.update_keyboard_target(rows[narrow_cast<size_t>(index) - first_row], keyboard_focus_group::menu);
+            _need_menu_focus = false;
+
+        } else if (index >= 0 && not std::exchange(_menu_did_scroll, true)) {
+            _column_widget->scroll_to_show_row(narrow_cast<size_t>(index));
 
-            _menu_item_widgets.push_back(std::move(menu_item));
+        } else {
+            this->window.update_keyboard_target(rows.front(), keyboard_focus_group::menu);
+            _need_menu_focus = false;
         }
+    }
+
+    /** Update the size of the menu from the options, and reload an open menu.
+     */
+    void repopulate_options() noexcept
+    {
+        ttlet lock = std::scoped_lock(gui_system_mutex);
+        _options = *option_list;
+
+        // If any of the options has a an icon, all of the options should show the icon.
+        ttlet show_icon = std::ranges::any_of(_options, [](ttlet &option) {
+            return option.second.has_icon();
+        });
+
+        if (std::exchange(_show_icon, show_icon) != show_icon) {
+            // The menu items are made with the show_icon flag, make them again.
+            free_menu();
+            if (_selecting) {
+                start_selecting();
+            }
+        } else if (_column_widget) {
+            _column_widget->reload();
+        }
+
+        ttlet padding = menu_item_widget<value_type>::label_padding(true, false);
 
         _max_option_label_height = 0.0f;
-        for (ttlet & [ tag, text ] : *option_list) {
-            _max_option_label_height = std::max(
-                _max_option_label_height,
-                stencil::make_unique(alignment::middle_left, text, theme::global->labelStyle)->preferred_size().height());
+        _max_option_width = 0.0f;
+        for (ttlet & [ tag, text ] : _options) {
+            auto option_label_stencil = stencil::make_unique(alignment::middle_left, text, theme::global->labelStyle);
+            option_label_stencil->set_show_icon(_show_icon);
+
+            ttlet preferred_size = option_label_stencil->preferred_size();
+            _max_option_label_height = std::max(_max_option_label_height, preferred_size.height());
+            _max_option_width = std::max(_max_option_width, preferred_size.width() + padding.width());
         }
     }
 
@@ -393,7 +486,7 @@ private:
         tt_axiom(gui_system_mutex.recurse_lock_count());
 
         context.draw_box_with_border_inside(
-            rectangle(), background_color(), focus_color(), corner_shapes{theme::global->roundingRadius});
+            rectangle(), style().background_color, style().focus_color, corner_shapes{theme::global->roundingRadius});
     }
 
     void draw_left_box(draw_context context) noexcept
@@ -401,20 +494,20 @@ private:
         tt_axiom(gui_system_mutex.recurse_lock_count());
 
         ttlet corner_shapes = tt::corner_shapes{theme::global->roundingRadius, 0.0f, theme::global->roundingRadius, 0.0f};
-        context.draw_box(translate_z(0.1f) * _left_box_rectangle, focus_color(), corner_shapes);
+        context.draw_box(translate_z(0.1f) * _left_box_rectangle, style().focus_color, corner_shapes);
     }
 
     void draw_chevrons(draw_context context) noexcept
     {
         tt_axiom(gui_system_mutex.recurse_lock_count());
 
-        context.draw_glyph(_chevrons_glyph, translate_z(0.2f) * _chevrons_rectangle, label_color());
+        context.draw_glyph(_chevrons_glyph, translate_z(0.2f) * _chevrons_rectangle, style().label_color);
     }
 
     void draw_value(draw_context context) noexcept
     {
         tt_axiom(gui_system_mutex.recurse_lock_count());
-        _text_stencil->draw(context, label_color(), translate_z(0.1f));
+        _text_stencil->draw(context, style().label_color, translate_z(0.1f));
     }
 };
 
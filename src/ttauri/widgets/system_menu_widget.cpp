@@ -74,7 +74,7 @@ void system_menu_widget::draw(draw_context context, hires_utc_clock::time_point
 
 hit_box system_menu_widget::hitbox_test(point2 position) const noexcept
 {
-    tt_axiom(gui_system_mutex.recurse_lock_count());
+    tt_axiom(gui_system_mutex.recurse_shared_lock_count());
 
     if (_visible_rectangle.contains(position)) {
         // Only the top-left square should return ApplicationIcon, leave
@@ -30,7 +30,7 @@ public:
         _margin = 0.0f;
 
         _value_callback = value.subscribe([this](auto...) {
-            this->_request_reconstrain = true;
+            this->request_reconstrain();
         });
 
         // Compare and assign would trigger the signaling NaN that widget sets.
@@ -91,8 +91,9 @@ public:
 
     [[nodiscard]] hit_box hitbox_test(point2 position) const noexcept override
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         ttlet &child = selected_child();
+        increment_counter<"widget_hitbox_test">();
         return child.hitbox_test(point2{child.parent_to_local() * position});
     }
 
@@ -101,7 +102,7 @@ public:
         keyboard_focus_group group,
         keyboard_focus_direction direction) const noexcept
     {
-        ttlet lock = std::scoped_lock(gui_system_mutex);
+        ttlet lock = std::shared_lock(gui_system_mutex);
         return selected_child().find_next_widget(current_widget, group, direction);
     }
 
@@ -122,7 +123,7 @@ private:
 
     [[nodiscard]] auto find_child(value_type index) const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         tt_axiom(std::size(_children_keys) == std::size(_children));
 
         ttlet child_key_it = std::find(_children_keys.cbegin(), _children_keys.cend(), index);
@@ -150,7 +151,7 @@ private:
 
     [[nodiscard]] auto find_selected_child() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return find_child(*value);
     }
 
@@ -162,7 +163,7 @@ private:
 
     [[nodiscard]] widget const &selected_child() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         tt_axiom(std::ssize(_children) != 0);
 
         auto i = find_selected_child();
@@ -191,7 +192,7 @@ private:
         tt_axiom(gui_system_mutex.recurse_lock_count());
         auto child_context =
             context.make_child_context(child.parent_to_local(), child.local_to_window(), child.clipping_rectangle());
-        child.draw(child_context, displayTimePoint);
+        child.draw_retained(child_context, displayTimePoint);
     }
 };
 
@@ -73,7 +73,7 @@ public:
     {
         _value_callback = this->value.subscribe([this](auto...) {
             ttlet lock = std::scoped_lock(gui_system_mutex);
-            _request_relayout = true;
+            request_relayout();
         });
     }
 
@@ -137,10 +137,6 @@ public:
     {
         tt_axiom(gui_system_mutex.recurse_lock_count());
 
-        if (_focus && display_time_point >= _next_redraw_time_point) {
-            request_redraw();
-        }
-
         need_layout |= std::exchange(_request_relayout, false);
         if (need_layout) {
             _text_field_rectangle = aarectangle{extent2{_text_width + theme::global->margin * 2.0f, _size.height()}};
@@ -176,6 +172,9 @@ public:
 
             // Record the last time the text is modified, so that the caret remains lit.
             _last_update_time_point = display_time_point;
+
+            // The focus color depends on the error from the string conversion.
+            invalidate_style();
         }
 
         super::update_layout(display_time_point, need_layout);
@@ -185,7 +184,11 @@ public:
     {
         tt_axiom(gui_system_mutex.recurse_lock_count());
 
-        _next_redraw_time_point = display_time_point + _blink_interval;
+        if (_focus) {
+            // Wake up to blink the caret.
+            ttlet blink_time_point = display_time_point + _blink_interval;
+            window.request_animation(weak_from_this(), blink_time_point, blink_time_point);
+        }
 
         if (overlaps(context, this->_clipping_rectangle)) {
             scroll_text();
@@ -208,7 +211,7 @@ public:
     bool handle_event(command command) noexcept override
     {
         ttlet lock = std::scoped_lock(gui_system_mutex);
-        _request_relayout = true;
+        request_relayout();
 
         if (*enabled) {
             switch (command) {
@@ -347,13 +350,13 @@ public:
             }
         }
 
-        _request_relayout = true;
+        request_relayout();
         return handled;
     }
 
     hit_box hitbox_test(point2 position) const noexcept override
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
 
         if (_visible_rectangle.contains(position)) {
             return hit_box{weak_from_this(), _draw_layer, *enabled ? hit_box::Type::TextEdit : hit_box::Type::Default};
@@ -364,7 +367,7 @@ public:
 
     [[nodiscard]] bool accepts_keyboard_focus(keyboard_focus_group group) const noexcept override
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return is_normal(group) && *enabled;
     }
 
@@ -417,7 +420,6 @@ private:
     translate2 _text_inv_translate;
 
     static constexpr hires_utc_clock::duration _blink_interval = 500ms;
-    hires_utc_clock::time_point _next_redraw_time_point;
     hires_utc_clock::time_point _last_update_time_point;
 
     void revert(bool force) noexcept
@@ -495,10 +497,10 @@ private:
     void draw_background_box(draw_context context) const noexcept
     {
         ttlet corner_shapes = tt::corner_shapes{0.0f, 0.0f, theme::global->roundingRadius, theme::global->roundingRadius};
-        context.draw_box(_text_field_rectangle, background_color(), corner_shapes);
+        context.draw_box(_text_field_rectangle, style().background_color, corner_shapes);
 
         ttlet line_rectangle = aarectangle{get<0>(_text_field_rectangle), extent2{_text_field_rectangle.width(), 1.0f}};
-        context.draw_filled_quad(translate3{0.0f, 0.0f, 0.1f} * line_rectangle, focus_color());
+        context.draw_filled_quad(translate3{0.0f, 0.0f, 0.1f} * line_rectangle, style().focus_color);
     }
 
     void draw_selection_rectangles(draw_context context) const noexcept
@@ -533,7 +535,7 @@ private:
 
     void draw_text(draw_context context) const noexcept
     {
-        context.draw_text(_shaped_text, label_color(), _text_translate * translate_z(0.2f));
+        context.draw_text(_shaped_text, style().label_color, _text_translate * translate_z(0.2f));
     }
 };
 
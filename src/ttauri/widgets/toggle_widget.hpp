@@ -32,10 +32,10 @@ public:
         super(window, parent, std::forward<Value>(value))
     {
         _on_label_callback = this->on_label.subscribe([this](auto...) {
-            _request_reconstrain = true;
+            request_reconstrain();
         });
         _off_label_callback = this->off_label.subscribe([this](auto...) {
-            _request_reconstrain = true;
+            request_reconstrain();
         });
     }
 
@@ -105,7 +105,7 @@ public:
 
         if (overlaps(context, _clipping_rectangle)) {
             draw_rail(context);
-            draw_slider(context);
+            draw_slider(context, display_time_point);
             draw_label(context);
         }
 
@@ -134,24 +134,26 @@ private:
         tt_axiom(gui_system_mutex.recurse_lock_count());
 
         draw_context.draw_box_with_border_inside(
-            _rail_rectangle, background_color(), focus_color(), corner_shapes{_rail_rectangle.height() * 0.5f});
+            _rail_rectangle, style().background_color, style().focus_color, corner_shapes{_rail_rectangle.height() * 0.5f});
     }
 
-    void draw_slider(draw_context draw_context) noexcept
+    void draw_slider(draw_context draw_context, hires_utc_clock::time_point display_time_point) noexcept
     {
         tt_axiom(gui_system_mutex.recurse_lock_count());
 
         // Prepare animation values.
         ttlet animationProgress = value.animation_progress(_animation_duration);
         if (animationProgress < 1.0f) {
-            request_redraw();
+            ttlet time_left =
+                std::chrono::duration_cast<hires_utc_clock::duration>((1.0f - animationProgress) * _animation_duration);
+            window.request_animation(weak_from_this(), display_time_point, display_time_point + time_left);
         }
 
         ttlet animatedValue = to_float(value, _animation_duration);
         ttlet positionedSliderRectangle = translate3{_slider_move_range * animatedValue, 0.0f, 0.1f} * _slider_rectangle;
 
         draw_context.draw_box(
-            positionedSliderRectangle, accent_color(), corner_shapes{positionedSliderRectangle.height() * 0.5f});
+            positionedSliderRectangle, style().accent_color, corner_shapes{positionedSliderRectangle.height() * 0.5f});
     }
 
     void draw_label(draw_context draw_context) noexcept
@@ -159,7 +161,7 @@ private:
         tt_axiom(gui_system_mutex.recurse_lock_count());
 
         ttlet &label_stencil = *value ? _on_label_stencil : _off_label_stencil;
-        label_stencil->draw(draw_context, label_color());
+        label_stencil->draw(draw_context, style().label_color);
     }
 };
 
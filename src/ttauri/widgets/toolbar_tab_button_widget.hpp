@@ -46,13 +46,13 @@ public:
     void init() noexcept override
     {
         _label_callback = label.subscribe([this](auto...) {
-            this->_request_reconstrain = true;
+            this->request_reconstrain();
         });
     }
 
     [[nodiscard]] bool accepts_keyboard_focus(keyboard_focus_group group) const noexcept override
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return is_toolbar(group) && *this->enabled;
     }
 
@@ -158,7 +158,7 @@ private:
             if (overlaps(context, line_rectangle)) {
                 // Draw the line above every other direct child of the toolbar, and between
                 // the selected-tab (0.6) and unselected-tabs (0.8).
-                context.draw_filled_quad(translate_z(0.7f) * line_rectangle, this->focus_color());
+                context.draw_filled_quad(translate_z(0.7f) * line_rectangle, this->style().focus_color);
             }
         }
     }
@@ -182,14 +182,14 @@ private:
         context.draw_box_with_border_inside(
             button_z * _button_rectangle,
             button_color,
-            (this->_focus && this->window.active) ? this->focus_color() : button_color,
+            (this->_focus && this->window.active) ? this->style().focus_color : button_color,
             corner_shapes);
     }
 
     void draw_label(draw_context context) noexcept
     {
         tt_axiom(gui_system_mutex.recurse_lock_count());
-        _label_stencil->draw(context, this->label_color(), translate_z(0.9f));
+        _label_stencil->draw(context, this->style().label_color, translate_z(0.9f));
     }
 };
 
@@ -115,7 +115,7 @@ public:
 
     hit_box hitbox_test(point2 position) const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
 
         auto r = hit_box{};
 
@@ -124,6 +124,7 @@ public:
         }
 
         for (ttlet &child : _children) {
+            increment_counter<"widget_hitbox_test">();
             r = std::max(r, child->hitbox_test(point2{child->parent_to_local() * position}));
         }
         return r;
@@ -0,0 +1,46 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../required.hpp"
+#include <memory>
+
+namespace tt {
+class widget;
+class virtual_column_widget;
+
+/** The delegate of a virtual_column_widget.
+ * The delegate supplies the rows of the column; row widgets are only made for the rows
+ * that are visible, and are reused for other rows when they scroll out of view.
+ */
+class virtual_column_delegate {
+public:
+    virtual ~virtual_column_delegate() = default;
+
+    virtual void init(virtual_column_widget &self) noexcept {}
+    virtual void deinit(virtual_column_widget &self) noexcept {}
+
+    /** The number of rows in the column.
+     */
+    [[nodiscard]] virtual size_t size(virtual_column_widget const &self) const noexcept = 0;
+
+    /** Make a new row widget.
+     * This is only called when there is no row widget available for reuse.
+     *
+     * @param self The column widget, use `self.make_row_widget<T>()` to make the widget.
+     */
+    [[nodiscard]] virtual std::shared_ptr<widget> make_row(virtual_column_widget &self) noexcept = 0;
+
+    /** Show the data of a row in a row widget.
+     * The row widget may have shown the data of another row before.
+     *
+     * @param self The column widget.
+     * @param row_widget A widget made by `make_row()`.
+     * @param row_nr The index of the row to show.
+     */
+    virtual void bind_row(virtual_column_widget &self, widget &row_widget, size_t row_nr) noexcept = 0;
+};
+
+} // namespace tt
@@ -0,0 +1,281 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "abstract_container_widget.hpp"
+#include "virtual_column_delegate.hpp"
+#include <memory>
+#include <vector>
+#include <cmath>
+
+namespace tt {
+
+/** A column of rows, of which only the visible rows are instantiated.
+ *
+ * This widget is meant to be the content of a scroll_view_widget showing a large number of rows,
+ * such as a log viewer. Only the rows that intersect the clipping rectangle, plus `overscan` rows on
+ * each side, have a widget. Row widgets that scroll out of view are kept for reuse, the delegate
+ * then binds them to the data of another row.
+ *
+ * All rows have the same height, the largest preferred height of the row widgets made so far.
+ * The height of the column is estimated from this height and the number of rows, so that the
+ * scroll bars work without instantiating every row.
+ */
+class virtual_column_widget final : public abstract_container_widget {
+public:
+    using super = abstract_container_widget;
+
+    /** The number of rows outside the visible area that are instantiated on each side.
+     * So that small scroll steps do not need to bind rows.
+     */
+    static constexpr size_t overscan = 4;
+
+    virtual_column_widget(
+        gui_window &window,
+        std::shared_ptr<abstract_container_widget> parent,
+        std::weak_ptr<virtual_column_delegate> delegate) noexcept :
+        super(window, parent), _delegate(delegate)
+    {
+    }
+
+    ~virtual_column_widget()
+    {
+        if (auto delegate_ = _delegate.lock()) {
+            delegate_->deinit(*this);
+        }
+    }
+
+    void init() noexcept override
+    {
+        if (auto delegate_ = _delegate.lock()) {
+            delegate_->init(*this);
+        }
+    }
+
+    /** Make a row widget for the delegate.
+     * The widget is not added as a child, the column adds it when the row becomes visible.
+     */
+    template<typename T, typename... Args>
+    std::shared_ptr<T> make_row_widget(Args &&...args)
+    {
+        auto tmp = std::make_shared<T>(window, shared_from_this(), std::forward<Args>(args)...);
+        tmp->init();
+        return tmp;
+    }
+
+    /** The data or the number of rows have changed.
+     * All the visible rows will be bound again, and the number of rows is retrieved from the delegate.
+     * The delegate must call this function after a change, the column does not poll the delegate.
+     */
+    void reload() noexcept
+    {
+        ttlet lock = std::scoped_lock(gui_system_mutex);
+        _need_rebind = true;
+        request_reconstrain();
+    }
+
+    /** The index of the first instantiated row.
+     */
+    [[nodiscard]] size_t first_row() const noexcept
+    {
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
+        return _first_row;
+    }
+
+    /** The number of instantiated rows.
+     */
+    [[nodiscard]] size_t nr_instantiated_rows() const noexcept
+    {
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
+        return _children.size();
+    }
+
+    /** Scroll the column so that a row becomes visible.
+     * The widget of the row is instantiated during the next layout.
+     */
+    void scroll_to_show_row(size_t row_nr) noexcept
+    {
+        tt_axiom(gui_system_mutex.recurse_lock_count());
+
+        ttlet row_top = rectangle().top() - _row_height * narrow_cast<float>(row_nr);
+        scroll_to_show(aarectangle{rectangle().left(), row_top - _row_height, rectangle().width(), _row_height});
+    }
+
+    [[nodiscard]] bool update_constraints(hires_utc_clock::time_point display_time_point, bool need_reconstrain) noexcept override
+    {
+        tt_axiom(gui_system_mutex.recurse_lock_count());
+
+        auto delegate_ = _delegate.lock();
+        ttlet nr_rows = delegate_ ? delegate_->size(*this) : 0_uz;
+        if (std::exchange(_need_rebind, false) || nr_rows != _nr_rows) {
+            _nr_rows = nr_rows;
+            // Bind the already visible rows again, limited to the new number of rows.
+            update_rows(display_time_point, _first_row, _first_row + _children.size(), true);
+            need_reconstrain = true;
+        }
+
+        if (_children.empty() && _nr_rows != 0) {
+            // A row widget is needed to estimate the size of the column.
+            update_rows(display_time_point, 0, 1, false);
+        }
+
+        if (super::update_constraints(display_time_point, need_reconstrain)) {
+            auto minimum_width = 0.0f;
+            auto preferred_width = 0.0f;
+            auto maximum_width = 0.0f;
+            for (ttlet &child : _children) {
+                update_constraints_for_child(*child, minimum_width, preferred_width, maximum_width);
+            }
+
+            ttlet height = _row_height * narrow_cast<float>(_nr_rows);
+            _minimum_size = {minimum_width, height};
+            _preferred_size = {preferred_width, height};
+            _maximum_size = {maximum_width, height};
+            tt_axiom(_minimum_size <= _preferred_size && _preferred_size <= _maximum_size);
+            return true;
+        } else {
+            return false;
+        }
+    }
+
+    [[nodiscard]] void update_layout(hires_utc_clock::time_point display_time_point, bool need_layout) noexcept override
+    {
+        tt_axiom(gui_system_mutex.recurse_lock_count());
+
+        need_layout |= std::exchange(_request_relayout, false);
+        if (need_layout) {
+            // Rows are counted from the top, the visible part of the column is the clipping rectangle.
+            ttlet top = rectangle().top();
+            ttlet row_height = std::max(_row_height, 1.0f);
+            ttlet nr_rows = narrow_cast<float>(_nr_rows);
+            ttlet first = std::clamp(std::floor((top - clipping_rectangle().top()) / row_height), 0.0f, nr_rows);
+            ttlet last = std::clamp(std::ceil((top - clipping_rectangle().bottom()) / row_height), 0.0f, nr_rows);
+
+            ttlet first_row = narrow_cast<size_t>(first) - std::min(narrow_cast<size_t>(first), overscan);
+            ttlet last_row = std::min(narrow_cast<size_t>(last) + overscan, _nr_rows);
+            update_rows(display_time_point, first_row, std::max(first_row, last_row), false);
+
+            auto row_nr = _first_row;
+            for (ttlet &child : _children) {
+                update_layout_for_child(*child, row_nr++);
+            }
+        }
+
+        super::update_layout(display_time_point, need_layout);
+    }
+
+private:
+    std::weak_ptr<virtual_column_delegate> _delegate;
+
+    /** The number of rows, as retrieved from the delegate during constraining.
+     */
+    size_t _nr_rows = 0;
+
+    /** The row index of `_children.front()`.
+     * The children are the widgets of the consecutive rows starting at this index.
+     */
+    size_t _first_row = 0;
+
+    /** The height of each row, including the margins.
+     * This is the largest preferred height of any of the row widgets.
+     */
+    float _row_height = 0.0f;
+
+    /** Row widgets that are not visible and can be bound to another row.
+     */
+    std::vector<std::shared_ptr<widget>> _recycled_rows;
+
+    bool _need_rebind = false;
+
+    /** Make the children the widgets of the rows from first to last.
+     *
+     * @param first The index of the first row to instantiate.
+     * @param last One beyond the index of the last row to instantiate.
+     * @param rebind Bind the rows that were already instantiated again.
+     */
+    void update_rows(hires_utc_clock::time_point display_time_point, size_t first, size_t last, bool rebind) noexcept
+    {
+        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(first <= last);
+
+        last = std::min(last, _nr_rows);
+        first = std::min(first, last);
+
+        auto rows = std::vector<std::shared_ptr<widget>>{};
+        rows.reserve(last - first);
+        for (auto row_nr = first; row_nr != last; ++row_nr) {
+            if (not rebind && row_nr >= _first_row && row_nr < _first_row + _children.size()) {
+                rows.push_back(std::move(_children[row_nr - _first_row]));
+            } else {
+                rows.emplace_back();
+            }
+        }
+
+        for (auto &child : _children) {
+            if (child) {
+                _recycled_rows.push_back(std::move(child));
+            }
+        }
+
+        auto delegate_ = _delegate.lock();
+        for (auto i = 0_uz; i != rows.size(); ++i) {
+            auto &row = rows[i];
+            if (row) {
+                continue;
+            }
+
+            tt_axiom(delegate_);
+            if (_recycled_rows.empty()) {
+                row = delegate_->make_row(*this);
+                tt_axiom(row && &row->parent() == this);
+            } else {
+                row = std::move(_recycled_rows.back());
+                _recycled_rows.pop_back();
+            }
+
+            delegate_->bind_row(*this, *row, first + i);
+            (void)row->update_constraints(display_time_point, true);
+
+            ttlet row_height = row->preferred_size().height() + row->margin() * 2.0f;
+            if (row_height > _row_height) {
+                _row_height = row_height;
+                request_reconstrain();
+            }
+        }
+
+        _children = std::move(rows);
+        _first_row = first;
+        window.invalidate_widget_tree();
+        invalidate_hitbox_index();
+    }
+
+    void update_constraints_for_child(
+        widget const &child,
+        float &minimum_width,
+        float &preferred_width,
+        float &maximum_width) noexcept
+    {
+        tt_axiom(gui_system_mutex.recurse_lock_count());
+
+        minimum_width = std::max(minimum_width, child.minimum_size().width() + child.margin() * 2.0f);
+        preferred_width = std::max(preferred_width, child.preferred_size().width() + child.margin() * 2.0f);
+        maximum_width = std::max(maximum_width, child.maximum_size().width() + child.margin() * 2.0f);
+        _row_height = std::max(_row_height, child.preferred_size().height() + child.margin() * 2.0f);
+    }
+
+    void update_layout_for_child(widget &child, size_t row_nr) const noexcept
+    {
+        tt_axiom(gui_system_mutex.recurse_lock_count());
+
+        ttlet row_top = rectangle().top() - _row_height * narrow_cast<float>(row_nr);
+        ttlet child_height = std::max(_row_height - child.margin() * 2.0f, child.minimum_size().height());
+        ttlet child_width = std::max(rectangle().width() - child.margin() * 2.0f, child.minimum_size().width());
+
+        child.set_layout_parameters_from_parent(
+            aarectangle{rectangle().left() + child.margin(), row_top - child.margin() - child_height, child_width, child_height});
+    }
+};
+
+} // namespace tt
@@ -5,6 +5,7 @@
 #include "widget.hpp"
 #include "abstract_container_widget.hpp"
 #include "../GUI/utils.hpp"
+#include "../counters.hpp"
 #include <ranges>
 
 namespace tt {
@@ -33,7 +34,7 @@ widget::~widget() {}
 
 gui_device *widget::device() const noexcept
 {
-    tt_axiom(gui_system_mutex.recurse_lock_count());
+    tt_axiom(gui_system_mutex.recurse_shared_lock_count());
 
     auto device = window.device();
     tt_assert(device);
@@ -44,16 +45,34 @@ bool widget::update_constraints(hires_utc_clock::time_point display_time_point,
 {
     tt_axiom(gui_system_mutex.recurse_lock_count());
 
+    increment_counter<"widget_constrain">();
+
     need_reconstrain |= std::exchange(_request_reconstrain, false);
     return need_reconstrain;
 }
 
+void widget::request_reconstrain() noexcept
+{
+    _request_reconstrain = true;
+    _request_reconstrain_subtree = true;
+
+    // When a parent is already marked, then so are its parents.
+    for (auto parent = _parent.lock(); parent; parent = parent->_parent.lock()) {
+        if (std::exchange(parent->_request_reconstrain_subtree, true)) {
+            break;
+        }
+    }
+
+    window.request_frame();
+}
+
 void widget::update_layout(hires_utc_clock::time_point display_time_point, bool need_layout) noexcept
 {
     tt_axiom(gui_system_mutex.recurse_lock_count());
 
     need_layout |= std::exchange(_request_relayout, false);
     if (need_layout) {
+        increment_counter<"widget_layout">();
         request_redraw();
     }
 }
@@ -121,6 +140,26 @@ void widget::update_layout(hires_utc_clock::time_point display_time_point, bool
     }
 }
 
+[[nodiscard]] widget::style_type const &widget::style() const noexcept
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    ttlet state = static_cast<uint8_t>((*enabled ? 1 : 0) | (_hover ? 2 : 0) | (_focus ? 4 : 0) | (window.active ? 8 : 0));
+    if (not _style_is_valid or _style_theme != theme::global or _style_state != state) {
+        increment_counter<"widget_style">();
+
+        _style.background_color = background_color();
+        _style.foreground_color = foreground_color();
+        _style.focus_color = focus_color();
+        _style.accent_color = accent_color();
+        _style.label_color = label_color();
+        _style_theme = theme::global;
+        _style_state = state;
+        _style_is_valid = true;
+    }
+    return _style;
+}
+
 bool widget::handle_event(command command) noexcept
 {
     tt_axiom(gui_system_mutex.recurse_lock_count());
@@ -186,7 +225,7 @@ std::shared_ptr<widget> widget::find_next_widget(
     keyboard_focus_group group,
     keyboard_focus_direction direction) const noexcept
 {
-    ttlet lock = std::scoped_lock(gui_system_mutex);
+    ttlet lock = std::shared_lock(gui_system_mutex);
 
     auto this_ = shared_from_this();
     if (current_keyboard_widget == this_) {
@@ -207,7 +246,7 @@ std::shared_ptr<widget> widget::find_next_widget(
  */
 [[nodiscard]] std::shared_ptr<abstract_container_widget const> widget::shared_parent() const noexcept
 {
-    tt_axiom(gui_system_mutex.recurse_lock_count());
+    tt_axiom(gui_system_mutex.recurse_shared_lock_count());
     return _parent.lock();
 }
 
@@ -221,7 +260,7 @@ std::shared_ptr<widget> widget::find_next_widget(
 
 [[nodiscard]] abstract_container_widget const &widget::parent() const noexcept
 {
-    tt_axiom(gui_system_mutex.recurse_lock_count());
+    tt_axiom(gui_system_mutex.recurse_shared_lock_count());
     if (ttlet parent_ = shared_parent()) {
         return *parent_;
     } else {
@@ -241,16 +280,35 @@ std::shared_ptr<widget> widget::find_next_widget(
 
 [[nodiscard]] bool widget::is_first(keyboard_focus_group group) const noexcept
 {
-    tt_axiom(gui_system_mutex.recurse_lock_count());
+    tt_axiom(gui_system_mutex.recurse_shared_lock_count());
     return parent().find_first_widget(group).get() == this;
 }
 
 [[nodiscard]] bool widget::is_last(keyboard_focus_group group) const noexcept
 {
-    tt_axiom(gui_system_mutex.recurse_lock_count());
+    tt_axiom(gui_system_mutex.recurse_shared_lock_count());
     return parent().find_last_widget(group).get() == this;
 }
 
+void widget::invalidate_draw_cache() const noexcept
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    _draw_cache.valid = false;
+    if (auto parent = _parent.lock()) {
+        parent->invalidate_draw_cache();
+    }
+}
+
+void widget::invalidate_hitbox_index() noexcept
+{
+    tt_axiom(gui_system_mutex.recurse_lock_count());
+
+    if (auto parent = _parent.lock()) {
+        parent->invalidate_hitbox_index();
+    }
+}
+
 void widget::scroll_to_show(tt::rectangle rectangle) noexcept
 {
     tt_axiom(gui_system_mutex.recurse_lock_count());
@@ -265,7 +323,7 @@ void widget::scroll_to_show(tt::rectangle rectangle) noexcept
  */
 [[nodiscard]] std::vector<std::shared_ptr<widget>> widget::parent_chain(std::shared_ptr<tt::widget> const &child_widget) noexcept
 {
-    ttlet lock = std::scoped_lock(gui_system_mutex);
+    ttlet lock = std::shared_lock(gui_system_mutex);
 
     std::vector<std::shared_ptr<widget>> chain;
 
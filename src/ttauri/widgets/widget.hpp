@@ -13,6 +13,7 @@
 #include "../GUI/draw_context.hpp"
 #include "../GUI/keyboard_focus_direction.hpp"
 #include "../GUI/keyboard_focus_group.hpp"
+#include "flat_widget_tree.hpp"
 #include "../text/shaped_text.hpp"
 #include "../alignment.hpp"
 #include "../graphic_path.hpp"
@@ -25,12 +26,14 @@
 #include "../hires_utc_clock.hpp"
 #include "../observable.hpp"
 #include "../command.hpp"
+#include "../counters.hpp"
 #include "../unfair_recursive_mutex.hpp"
 #include "../flow_layout.hpp"
 #include "../ranged_numeric.hpp"
 #include <limits>
 #include <memory>
 #include <vector>
+#include <span>
 #include <mutex>
 #include <typeinfo>
 
@@ -126,7 +129,7 @@ public:
      */
     [[nodiscard]] float margin() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return _margin;
     }
 
@@ -147,7 +150,7 @@ public:
      */
     [[nodiscard]] float draw_layer() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return _draw_layer;
     }
 
@@ -163,7 +166,7 @@ public:
      */
     [[nodiscard]] int logical_layer() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return _logical_layer;
     }
 
@@ -187,7 +190,7 @@ public:
      */
     [[nodiscard]] int semantic_layer() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return _semantic_layer;
     }
 
@@ -198,7 +201,7 @@ public:
      */
     [[nodiscard]] extent2 minimum_size() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return _minimum_size;
     }
 
@@ -212,7 +215,7 @@ public:
      */
     [[nodiscard]] extent2 preferred_size() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return _preferred_size;
     }
 
@@ -224,7 +227,7 @@ public:
      */
     [[nodiscard]] extent2 maximum_size() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return _maximum_size;
     }
 
@@ -256,6 +259,7 @@ public:
         _size = size;
         _clipping_rectangle = clipping_rectangle;
         _visible_rectangle = intersect(aarectangle{size}, clipping_rectangle);
+        invalidate_hitbox_index();
     }
 
     void
@@ -287,43 +291,43 @@ public:
 
     [[nodiscard]] matrix3 parent_to_local() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return _parent_to_local;
     }
 
     [[nodiscard]] matrix3 local_to_parent() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return _local_to_parent;
     }
 
     [[nodiscard]] matrix3 window_to_local() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return _window_to_local;
     }
 
     [[nodiscard]] matrix3 local_to_window() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return _local_to_window;
     }
 
     [[nodiscard]] extent2 size() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return _size;
     }
 
     [[nodiscard]] float width() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return _size.width();
     }
 
     [[nodiscard]] float height() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return _size.height();
     }
 
@@ -333,7 +337,7 @@ public:
      */
     [[nodiscard]] aarectangle rectangle() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return aarectangle{_size};
     }
 
@@ -347,7 +351,7 @@ public:
 
     [[nodiscard]] aarectangle clipping_rectangle() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return _clipping_rectangle;
     }
 
@@ -362,7 +366,7 @@ public:
      */
     [[nodiscard]] virtual hit_box hitbox_test(point2 position) const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
 
         if (_visible_rectangle.contains(position)) {
             return hit_box{weak_from_this(), _draw_layer};
@@ -371,13 +375,31 @@ public:
         }
     }
 
+    /** The rectangle that contains every position for which `hitbox_test()` may return a hit.
+     * Containers use it to index their children for hit testing.
+     *
+     * @return The rectangle in local coordinates.
+     */
+    [[nodiscard]] virtual aarectangle hitbox_rectangle() const noexcept
+    {
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
+        return _clipping_rectangle;
+    }
+
+    /** The child widgets of this widget, in the order they are drawn.
+     */
+    [[nodiscard]] virtual std::span<std::shared_ptr<widget> const> children() const noexcept
+    {
+        return {};
+    }
+
     /** Check if the widget will accept keyboard focus.
      *
      * @pre `mutex` must be locked by current thread.
      */
     [[nodiscard]] virtual bool accepts_keyboard_focus(keyboard_focus_group group) const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         return false;
     }
 
@@ -436,6 +458,26 @@ public:
 
     virtual [[nodiscard]] color label_color() const noexcept;
 
+    /** The colors of a widget in its current state.
+     */
+    struct style_type {
+        color background_color;
+        color foreground_color;
+        color focus_color;
+        color accent_color;
+        color label_color;
+    };
+
+    /** Get the colors of the widget.
+     *
+     * The colors are calculated with the virtual `*_color()` functions and cached until the theme,
+     * the window's activation or the enabled, hover or focus state of the widget changes,
+     * or until the widget requests a redraw.
+     *
+     * @pre `mutex` must be locked by current thread.
+     */
+    [[nodiscard]] style_type const &style() const noexcept;
+
     /** Draw the widget.
      * This function is called by the window (optionally) on every frame.
      * It should recursively call this function on every visible child.
@@ -456,11 +498,50 @@ public:
         tt_axiom(gui_system_mutex.recurse_lock_count());
     }
 
+    /** Draw the widget, or copy the vertices it placed during the previous frame.
+     * In retained mode the vertices of this widget and its children are recorded,
+     * they are reused until the widget or one of its children requests a redraw.
+     *
+     * @pre `mutex` must be locked by current thread.
+     * @param context The context to where the widget will draw.
+     * @param display_time_point The time point when the widget will be shown on the screen.
+     */
+    void draw_retained(draw_context const &context, hires_utc_clock::time_point display_time_point) noexcept
+    {
+        tt_axiom(gui_system_mutex.recurse_lock_count());
+
+        if (window.widget_tree().is_culled(_flat_index)) {
+            context.skip_retained();
+            return;
+        }
+
+        context.draw_retained(_draw_cache, [this, display_time_point](draw_context const &recording_context) {
+            increment_counter<"widget_draw">();
+            draw(recording_context, display_time_point);
+        });
+    }
+
     virtual void request_redraw() const noexcept
     {
+        invalidate_style();
+        invalidate_draw_cache();
         window.request_redraw(aarectangle{_local_to_window * _clipping_rectangle});
     }
 
+    /** Request the constraints of this widget to be recalculated on the next frame.
+     * The parents are marked as well, so that `update_constraints()` only needs to
+     * visit the branches of the widget tree that lead to this widget.
+     */
+    void request_reconstrain() noexcept;
+
+    /** Request the layout of this widget to be recalculated on the next frame.
+     */
+    void request_relayout() noexcept
+    {
+        _request_relayout = true;
+        window.request_frame();
+    }
+
     /** Handle command.
      * If a widget does not fully handle a command it should pass the
      * command to the super class' `handle_event()`.
@@ -615,6 +696,11 @@ protected:
      */
     bool _request_reconstrain = true;
 
+    /** Set when this widget, or one of its children, has requested to recalculate its constraints.
+     * Containers that are not set skip their children during `updateConstraints()`.
+     */
+    bool _request_reconstrain_subtree = true;
+
     /** When set to true the widget will recalculate the layout on the next call to `updateLayout()`
      */
     bool _request_relayout = true;
@@ -651,8 +737,44 @@ protected:
      */
     int _logical_layer;
 
+    /** Invalidate the retained vertices of this widget and its parents.
+     * The vertices of a widget include the vertices of its children, therefor
+     * the parents need to redraw as well.
+     */
+    void invalidate_draw_cache() const noexcept;
+
+    /** Recalculate the colors returned by `style()` on its next call.
+     * This must be called when a state, on which the `*_color()` functions depend, changes
+     * without a call to `request_redraw()`.
+     */
+    void invalidate_style() const noexcept
+    {
+        _style_is_valid = false;
+    }
+
+    /** Invalidate the hit-test index of this widget and its parents.
+     * This is called when the layout of the widget changes, since the hitbox
+     * rectangles of the parents include the hitbox rectangles of their children.
+     */
+    virtual void invalidate_hitbox_index() noexcept;
+
 private:
+    /** The vertices placed during the previous frame, used in retained mode.
+     */
+    mutable draw_cache _draw_cache;
+
+    mutable style_type _style;
+    mutable theme const *_style_theme = nullptr;
+    mutable uint8_t _style_state = 0;
+    mutable bool _style_is_valid = false;
+
+    /** The index of this widget in the flattened widget tree of the window.
+     */
+    size_t _flat_index = flat_widget_tree::no_index;
+
     typename decltype(enabled)::callback_ptr_type _enabled_callback;
+
+    friend class flat_widget_tree;
 };
 
 } // namespace tt
@@ -16,6 +16,7 @@
 #include "selection_widget.hpp"
 #include "toggle_widget.hpp"
 #include "overlay_view_widget.hpp"
+#include "performance_overlay_widget.hpp"
 #include "radio_button_widget.hpp"
 #include "tab_view_widget.hpp"
 #include "toolbar_widget.hpp"
@@ -24,6 +25,7 @@
 #include "window_widget.hpp"
 #include "row_column_layout_widget.hpp"
 #include "grid_layout_widget.hpp"
+#include "virtual_column_widget.hpp"
 #include "../GUI/gui_window.hpp"
 
 namespace tt {
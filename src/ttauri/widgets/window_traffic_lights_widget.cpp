@@ -180,7 +180,7 @@ void window_traffic_lights_widget::drawWindows(
         context.draw_filled_quad(maximizeRectangle, theme::global->fillColor(_semantic_layer));
     }
 
-    ttlet glyph_color = window.active ? label_color() : foreground_color();
+    ttlet glyph_color = window.active ? style().label_color : style().foreground_color;
 
     context.draw_glyph(closeWindowGlyph, translate_z(0.1f) * closeWindowGlyphRectangle, glyph_color);
     context.draw_glyph(minimizeWindowGlyph, translate_z(0.1f) * minimizeWindowGlyphRectangle, glyph_color);
@@ -266,7 +266,7 @@ bool window_traffic_lights_widget::handle_event(mouse_event const &event) noexce
 
 hit_box window_traffic_lights_widget::hitbox_test(point2 position) const noexcept
 {
-    tt_axiom(gui_system_mutex.recurse_lock_count());
+    tt_axiom(gui_system_mutex.recurse_shared_lock_count());
 
     if (_visible_rectangle.contains(position)) {
         if (closeRectangle.contains(position) || minimizeRectangle.contains(position) || maximizeRectangle.contains(position)) {
@@ -6,6 +6,7 @@
 #include "window_traffic_lights_widget.hpp"
 #include "toolbar_widget.hpp"
 #include "grid_layout_widget.hpp"
+#include "performance_overlay_widget.hpp"
 #if TT_OPERATING_SYSTEM == TT_OS_WINDOWS
 #include "system_menu_widget.hpp"
 #endif
@@ -38,6 +39,7 @@ void window_widget::init() noexcept
     }
 
     _content = make_widget<grid_layout_widget>(_content_delegate);
+    _performance_overlay = make_widget<performance_overlay_widget>();
 }
 
 [[nodiscard]] bool
@@ -81,14 +83,26 @@ void window_widget::update_layout(hires_utc_clock::time_point display_time_point
 
         ttlet content_rectangle = aarectangle{0.0f, 0.0f, rectangle().width(), rectangle().height() - toolbar_height};
         _content->set_layout_parameters_from_parent(content_rectangle);
+
+        ttlet overlay_extent = min(performance_overlay_widget::size, content_rectangle.extent());
+        ttlet overlay_rectangle = aarectangle{
+            point2{content_rectangle.right() - overlay_extent.width(), content_rectangle.top() - overlay_extent.height()},
+            overlay_extent};
+        _performance_overlay->set_layout_parameters_from_parent(overlay_rectangle);
     }
 
     abstract_container_widget::update_layout(display_time_point, need_layout);
 }
 
-hit_box window_widget::hitbox_test(point2 position) const noexcept
+void window_widget::toggle_performance_overlay() noexcept
 {
     tt_axiom(gui_system_mutex.recurse_lock_count());
+    _performance_overlay->toggle();
+}
+
+hit_box window_widget::hitbox_test(point2 position) const noexcept
+{
+    tt_axiom(gui_system_mutex.recurse_shared_lock_count());
 
     constexpr float BORDER_WIDTH = 10.0f;
 
@@ -127,6 +141,7 @@ hit_box window_widget::hitbox_test(point2 position) const noexcept
     }
 
     for (ttlet &child : _children) {
+        increment_counter<"widget_hitbox_test">();
         r = std::max(r, child->hitbox_test(point2{child->parent_to_local() * position}));
     }
 
@@ -11,6 +11,7 @@ namespace tt {
 
 class toolbar_widget;
 class grid_layout_widget;
+class performance_overlay_widget;
 
 class window_widget final : public abstract_container_widget {
 public:
@@ -44,18 +45,22 @@ public:
 
     [[nodiscard]] std::shared_ptr<grid_layout_widget> content() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         tt_axiom(_content);
         return _content;
     }
 
     [[nodiscard]] std::shared_ptr<toolbar_widget> toolbar() const noexcept
     {
-        tt_axiom(gui_system_mutex.recurse_lock_count());
+        tt_axiom(gui_system_mutex.recurse_shared_lock_count());
         tt_axiom(_toolbar);
         return _toolbar;
     }
 
+    /** Show or hide the performance overlay in the top-right corner of the window.
+     */
+    void toggle_performance_overlay() noexcept;
+
     [[nodiscard]] bool is_toolbar() const noexcept override
     {
         return false;
@@ -66,6 +71,7 @@ private:
     std::weak_ptr<grid_layout_delegate> _content_delegate;
     std::shared_ptr<grid_layout_widget> _content;
     std::shared_ptr<toolbar_widget> _toolbar;
+    std::shared_ptr<performance_overlay_widget> _performance_overlay;
 
     bool left_resize_border_has_priority = true;
     bool right_resize_border_has_priority = true;
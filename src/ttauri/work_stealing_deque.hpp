@@ -0,0 +1,136 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "required.hpp"
+#include "os_detect.hpp"
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+
+namespace tt {
+
+/** A fixed-capacity Chase-Lev work-stealing deque of pointers.
+ *
+ * The owner thread pushes and pops items at the bottom, in LIFO order, so that
+ * the items it works on are still in its cache. Any other thread may steal items
+ * from the top, in FIFO order; the oldest items are generally the largest pieces of work.
+ *
+ * The memory orders follow "Correct and Efficient Work-Stealing for Weak Memory Models",
+ * Lê, Pop, Cohen and Zappa Nardelli, 2013. The deque does not grow, push() fails when it is full.
+ *
+ * @tparam T The type of the items pointed to.
+ * @tparam Capacity The maximum number of items, a power of two.
+ */
+template<typename T, size_t Capacity>
+class work_stealing_deque {
+public:
+    static_assert(std::has_single_bit(Capacity), "Capacity must be a power of two");
+
+    using value_type = T *;
+    static constexpr size_t capacity = Capacity;
+
+    constexpr work_stealing_deque() noexcept = default;
+    work_stealing_deque(work_stealing_deque const &) = delete;
+    work_stealing_deque(work_stealing_deque &&) = delete;
+    work_stealing_deque &operator=(work_stealing_deque const &) = delete;
+    work_stealing_deque &operator=(work_stealing_deque &&) = delete;
+
+    /** The number of items in the deque.
+     * The value is approximate when other threads are stealing.
+     */
+    [[nodiscard]] size_t size() const noexcept
+    {
+        ttlet b = _bottom.load(std::memory_order::relaxed);
+        ttlet t = _top.load(std::memory_order::relaxed);
+        return b > t ? static_cast<size_t>(b - t) : size_t{0};
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /** Push an item at the bottom of the deque.
+     * May only be called from the owner thread.
+     *
+     * @return false when the deque is full.
+     */
+    [[nodiscard]] bool push(value_type item) noexcept
+    {
+        ttlet b = _bottom.load(std::memory_order::relaxed);
+        ttlet t = _top.load(std::memory_order::acquire);
+        if (b - t >= static_cast<int64_t>(capacity)) {
+            return false;
+        }
+
+        _items[b & mask].store(item, std::memory_order::relaxed);
+        // Publish the item to the thieves.
+        _bottom.store(b + 1, std::memory_order::release);
+        return true;
+    }
+
+    /** Pop the last pushed item from the bottom of the deque.
+     * May only be called from the owner thread.
+     *
+     * @return The item, or nullptr when the deque is empty.
+     */
+    [[nodiscard]] value_type pop() noexcept
+    {
+        ttlet b = _bottom.load(std::memory_order::relaxed) - 1;
+        _bottom.store(b, std::memory_order::relaxed);
+        std::atomic_thread_fence(std::memory_order::seq_cst);
+        auto t = _top.load(std::memory_order::relaxed);
+
+        if (t > b) {
+            // The deque was empty.
+            _bottom.store(b + 1, std::memory_order::relaxed);
+            return nullptr;
+        }
+
+        auto item = _items[b & mask].load(std::memory_order::relaxed);
+        if (t == b) {
+            // The last item, race against the thieves for it.
+            if (!_top.compare_exchange_strong(t, t + 1, std::memory_order::seq_cst, std::memory_order::relaxed)) {
+                item = nullptr;
+            }
+            _bottom.store(b + 1, std::memory_order::relaxed);
+        }
+        return item;
+    }
+
+    /** Steal the oldest item from the top of the deque.
+     * May be called from any thread.
+     *
+     * @return The item, or nullptr when the deque is empty or when another thread took the item first.
+     */
+    [[nodiscard]] value_type steal() noexcept
+    {
+        auto t = _top.load(std::memory_order::acquire);
+        std::atomic_thread_fence(std::memory_order::seq_cst);
+        ttlet b = _bottom.load(std::memory_order::acquire);
+
+        if (t >= b) {
+            return nullptr;
+        }
+
+        ttlet item = _items[t & mask].load(std::memory_order::relaxed);
+        if (!_top.compare_exchange_strong(t, t + 1, std::memory_order::seq_cst, std::memory_order::relaxed)) {
+            return nullptr;
+        }
+        return item;
+    }
+
+private:
+    static constexpr int64_t mask = static_cast<int64_t>(capacity - 1);
+
+    // The top is written by the thieves and the bottom by the owner, keep them on separate cache lines.
+    alignas(hardware_destructive_interference_size) std::atomic<int64_t> _top = 0;
+    alignas(hardware_destructive_interference_size) std::atomic<int64_t> _bottom = 0;
+    std::array<std::atomic<value_type>, capacity> _items = {};
+};
+
+} // namespace tt
@@ -0,0 +1,112 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/work_stealing_deque.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace tt;
+
+TEST(WorkStealingDeque, PopIsLIFO)
+{
+    auto deque = work_stealing_deque<int, 8>{};
+    int values[3] = {1, 2, 3};
+
+    ASSERT_TRUE(deque.push(&values[0]));
+    ASSERT_TRUE(deque.push(&values[1]));
+    ASSERT_TRUE(deque.push(&values[2]));
+    ASSERT_EQ(deque.size(), 3);
+
+    ASSERT_EQ(deque.pop(), &values[2]);
+    ASSERT_EQ(deque.pop(), &values[1]);
+    ASSERT_EQ(deque.pop(), &values[0]);
+    ASSERT_EQ(deque.pop(), nullptr);
+    ASSERT_TRUE(deque.empty());
+}
+
+TEST(WorkStealingDeque, StealIsFIFO)
+{
+    auto deque = work_stealing_deque<int, 8>{};
+    int values[3] = {1, 2, 3};
+
+    ASSERT_TRUE(deque.push(&values[0]));
+    ASSERT_TRUE(deque.push(&values[1]));
+    ASSERT_TRUE(deque.push(&values[2]));
+
+    ASSERT_EQ(deque.steal(), &values[0]);
+    ASSERT_EQ(deque.pop(), &values[2]);
+    ASSERT_EQ(deque.steal(), &values[1]);
+    ASSERT_EQ(deque.steal(), nullptr);
+    ASSERT_EQ(deque.pop(), nullptr);
+}
+
+TEST(WorkStealingDeque, Full)
+{
+    auto deque = work_stealing_deque<int, 4>{};
+    int value = 0;
+
+    for (int i = 0; i != 4; ++i) {
+        ASSERT_TRUE(deque.push(&value));
+    }
+    ASSERT_FALSE(deque.push(&value));
+
+    // Stealing makes room again, also across the wrap around of the ring.
+    ASSERT_EQ(deque.steal(), &value);
+    ASSERT_TRUE(deque.push(&value));
+    ASSERT_EQ(deque.size(), 4);
+}
+
+TEST(WorkStealingDeque, ConcurrentSteal)
+{
+    constexpr int nr_items = 100000;
+
+    auto deque = work_stealing_deque<int, 256>{};
+    auto items = std::vector<int>(nr_items, 0);
+    auto taken = std::vector<std::atomic<int>>(nr_items);
+    auto done = std::atomic<bool>{false};
+
+    auto take = [&](int *item) {
+        taken[item - items.data()].fetch_add(1, std::memory_order::relaxed);
+    };
+
+    auto thieves = std::vector<std::thread>{};
+    for (int i = 0; i != 3; ++i) {
+        thieves.emplace_back([&] {
+            while (!done.load(std::memory_order::acquire)) {
+                if (auto *item = deque.steal()) {
+                    take(item);
+                }
+            }
+        });
+    }
+
+    // The owner pops every other item itself, so that pop and steal race for the last item.
+    for (int i = 0; i != nr_items; ++i) {
+        while (!deque.push(&items[i])) {
+            if (auto *item = deque.pop()) {
+                take(item);
+            }
+        }
+        if (i % 2 == 0) {
+            if (auto *item = deque.pop()) {
+                take(item);
+            }
+        }
+    }
+    while (auto *item = deque.pop()) {
+        take(item);
+    }
+
+    done.store(true, std::memory_order::release);
+    for (auto &thief : thieves) {
+        thief.join();
+    }
+
+    for (int i = 0; i != nr_items; ++i) {
+        ASSERT_EQ(taken[i].load(), 1) << "item " << i;
+    }
+}
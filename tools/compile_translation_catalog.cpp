@@ -0,0 +1,50 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/text/translation_catalog.hpp"
+#include "ttauri/text/po_parser.hpp"
+#include "ttauri/file.hpp"
+#include "ttauri/URL.hpp"
+#include <fmt/format.h>
+#include <iostream>
+#include <exception>
+#include <string_view>
+#include <span>
+
+template<typename... Args>
+void print(std::string_view fmt, Args const &... args) noexcept
+{
+    std::cerr << fmt::format(fmt, args...) << std::endl;
+}
+
+void usage(std::string_view program, std::string_view str)
+{
+    print("Argument Error: {}\n", str);
+    print("Usage: {} <po-file> <output-tcat-file>", program);
+    exit(2);
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 3) {
+        usage(argv[0], "Expected two arguments.");
+    }
+
+    auto const input_url = tt::URL::urlFromPath(argv[1]);
+    auto const output_url = tt::URL::urlFromPath(argv[2]);
+
+    try {
+        auto const catalog = tt::make_translation_catalog(tt::parse_po(input_url));
+
+        auto output = tt::file(output_url, tt::access_mode::truncate_or_create_for_write);
+        output.write(std::span<std::byte const>{catalog});
+        output.close();
+
+    } catch (std::exception const &e) {
+        print("Could not compile '{}' into '{}'. '{}'", argv[1], argv[2], e.what());
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,189 @@
+// Copyright Take Vos 2021.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ttauri/log_binary.hpp"
+#include "ttauri/log_level.hpp"
+#include "ttauri/hires_utc_clock.hpp"
+#include <fmt/format.h>
+#include <fmt/args.h>
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <exception>
+#include <stdexcept>
+#include <string_view>
+#include <string>
+#include <vector>
+#include <iterator>
+#include <cstring>
+
+template<typename... Args>
+void print(std::string_view fmt, Args const &... args) noexcept
+{
+    std::cerr << fmt::format(fmt, args...) << std::endl;
+}
+
+void usage(std::string_view program, std::string_view str)
+{
+    print("Argument Error: {}\n", str);
+    print("Usage: {} <binary-log-file>", program);
+    exit(2);
+}
+
+struct log_site {
+    tt::log_level level;
+    uint32_t source_line;
+    std::string source_file;
+    std::string fmt;
+    std::string type_codes;
+};
+
+/** Reads values from a record.
+ */
+class record_reader {
+public:
+    record_reader(std::string_view bytes) noexcept : _bytes(bytes) {}
+
+    template<typename T>
+    [[nodiscard]] T read()
+    {
+        if (_bytes.size() < sizeof(T)) {
+            throw std::runtime_error("Truncated record");
+        }
+
+        T r;
+        std::memcpy(&r, _bytes.data(), sizeof(T));
+        _bytes = _bytes.substr(sizeof(T));
+        return r;
+    }
+
+    [[nodiscard]] std::string read_string()
+    {
+        auto const size = read<uint32_t>();
+        if (_bytes.size() < size) {
+            throw std::runtime_error("Truncated string in record");
+        }
+
+        auto r = std::string{_bytes.substr(0, size)};
+        _bytes = _bytes.substr(size);
+        return r;
+    }
+
+private:
+    std::string_view _bytes;
+};
+
+[[nodiscard]] std::string format_message(log_site const &site, record_reader &reader)
+{
+    using tt::log_binary::type_code;
+
+    auto args = fmt::dynamic_format_arg_store<fmt::format_context>{};
+    for (auto const code : site.type_codes) {
+        switch (static_cast<type_code>(code)) {
+        case type_code::boolean: args.push_back(reader.read<uint8_t>() != 0); break;
+        case type_code::character: args.push_back(reader.read<char>()); break;
+        case type_code::signed_integer: args.push_back(reader.read<int64_t>()); break;
+        case type_code::unsigned_integer: args.push_back(reader.read<uint64_t>()); break;
+        case type_code::floating_point: args.push_back(reader.read<double>()); break;
+        case type_code::pointer: args.push_back(reinterpret_cast<void const *>(reader.read<uint64_t>())); break;
+        case type_code::string: args.push_back(reader.read_string()); break;
+        default: throw std::runtime_error(fmt::format("Unknown argument type code '{}'", code));
+        }
+    }
+
+    return fmt::vformat(site.fmt, args);
+}
+
+void decode(std::string_view bytes, std::ostream &output)
+{
+    namespace log_binary = tt::log_binary;
+
+    if (bytes.size() < sizeof(log_binary::magic) ||
+        std::memcmp(bytes.data(), log_binary::magic, sizeof(log_binary::magic)) != 0) {
+        throw std::runtime_error("Not a binary log file");
+    }
+    bytes = bytes.substr(sizeof(log_binary::magic));
+
+    auto sites = std::vector<log_site>{};
+    while (bytes.size() >= sizeof(uint32_t)) {
+        uint32_t size;
+        std::memcpy(&size, bytes.data(), sizeof(size));
+        if (size == 0) {
+            // End of the log; the rest of the mapped file is zero.
+            break;
+        } else if (size > bytes.size() || size < sizeof(uint32_t) + sizeof(log_binary::record_tag)) {
+            throw std::runtime_error("Truncated record");
+        }
+
+        auto reader = record_reader{bytes.substr(sizeof(uint32_t), size - sizeof(uint32_t))};
+        bytes = bytes.substr(size);
+
+        switch (reader.read<log_binary::record_tag>()) {
+        case log_binary::record_tag::site: {
+            auto const id = reader.read<uint32_t>();
+            auto site = log_site{};
+            site.level = reader.read<tt::log_level>();
+            site.source_line = reader.read<uint32_t>();
+            site.source_file = reader.read_string();
+            site.fmt = reader.read_string();
+            site.type_codes = reader.read_string();
+            if (id != sites.size()) {
+                throw std::runtime_error(fmt::format("Unexpected site id {}", id));
+            }
+            sites.push_back(std::move(site));
+        } break;
+
+        case log_binary::record_tag::message: {
+            auto const id = reader.read<uint32_t>();
+            if (id >= sites.size()) {
+                throw std::runtime_error(fmt::format("Unknown site id {}", id));
+            }
+            auto const &site = sites[id];
+
+            auto const time_point = tt::hires_utc_clock::time_point{std::chrono::nanoseconds{reader.read<int64_t>()}};
+            auto const local_timestring = tt::format_iso8601(time_point);
+            auto const what = format_message(site, reader);
+
+            if (static_cast<bool>(site.level & tt::log_level::statistics)) {
+                output << fmt::format("{} {:5} {}\n", local_timestring, tt::to_const_string(site.level), what);
+            } else {
+                output << fmt::format(
+                    "{} {:5} {} ({}:{})\n",
+                    local_timestring,
+                    tt::to_const_string(site.level),
+                    what,
+                    site.source_file,
+                    site.source_line);
+            }
+        } break;
+
+        default:
+            // Skip unknown records.
+            break;
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 2) {
+        usage(argv[0], "Expected one argument.");
+    }
+
+    try {
+        auto stream = std::ifstream(std::filesystem::path(argv[1]), std::ios::binary);
+        if (!stream) {
+            throw std::runtime_error(fmt::format("Could not open '{}'", argv[1]));
+        }
+        auto const bytes = std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+
+        decode(bytes, std::cout);
+
+    } catch (std::exception const &e) {
+        print("Could not decode binary log: '{}'", e.what());
+        return 1;
+    }
+
+    return 0;
+}
@@ -10,6 +10,11 @@
 #include <stdexcept>
 #include <string_view>
 #include <string>
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 
 template<typename... Args>
 void print(std::string_view fmt, Args const &... args) noexcept
@@ -20,7 +25,7 @@ void print(std::string_view fmt, Args const &... args) noexcept
 void usage(std::string_view program, std::string_view str)
 {
     print("Argument Error: {}\n", str);
-    print("Usage: {} <binary-file> <output-hpp-file>", program);
+    print("Usage: {} [--compress] <binary-file> <output-cpp-file>", program);
     exit(2);
 }
 
@@ -57,6 +62,170 @@ void write_bytes_as_text(std::ostream& stream, std::string_view bytes) noexcept
     }
 }
 
+/** Write bits to a byte string, least significant bit first, as used by deflate.
+ */
+class bit_writer {
+public:
+    void write(uint32_t value, int nr_bits) noexcept
+    {
+        _buffer |= static_cast<uint64_t>(value) << _nr_bits;
+        _nr_bits += nr_bits;
+        while (_nr_bits >= 8) {
+            _bytes.push_back(static_cast<char>(_buffer & 0xff));
+            _buffer >>= 8;
+            _nr_bits -= 8;
+        }
+    }
+
+    /** Write a Huffman code, which is stored most significant bit first.
+     */
+    void write_code(uint32_t code, int nr_bits) noexcept
+    {
+        auto reversed = uint32_t{0};
+        for (auto i = 0; i != nr_bits; ++i) {
+            reversed = (reversed << 1) | ((code >> i) & 1);
+        }
+        write(reversed, nr_bits);
+    }
+
+    [[nodiscard]] std::string finish() noexcept
+    {
+        if (_nr_bits > 0) {
+            write(0, 8 - _nr_bits);
+        }
+        return std::move(_bytes);
+    }
+
+private:
+    std::string _bytes;
+    uint64_t _buffer = 0;
+    int _nr_bits = 0;
+};
+
+void write_fixed_literal(bit_writer &writer, int symbol) noexcept
+{
+    if (symbol < 144) {
+        writer.write_code(0x30 + symbol, 8);
+    } else if (symbol < 256) {
+        writer.write_code(0x190 + symbol - 144, 9);
+    } else if (symbol < 280) {
+        writer.write_code(symbol - 256, 7);
+    } else {
+        writer.write_code(0xc0 + symbol - 280, 8);
+    }
+}
+
+void write_fixed_match(bit_writer &writer, size_t length, size_t distance) noexcept
+{
+    constexpr auto length_base = std::array<int, 29>{
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+    constexpr auto length_extra =
+        std::array<int, 29>{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+    constexpr auto distance_base = std::array<int, 30>{1,    2,    3,    4,    5,    7,     9,     13,    17,  25,
+                                                       33,   49,   65,   97,   129,  193,   257,   385,   513, 769,
+                                                       1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+    constexpr auto distance_extra = std::array<int, 30>{0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+    auto l = 28;
+    while (length_base[l] > static_cast<int>(length)) {
+        --l;
+    }
+    write_fixed_literal(writer, 257 + l);
+    writer.write(static_cast<uint32_t>(length - length_base[l]), length_extra[l]);
+
+    auto d = 29;
+    while (distance_base[d] > static_cast<int>(distance)) {
+        --d;
+    }
+    writer.write_code(d, 5);
+    writer.write(static_cast<uint32_t>(distance - distance_base[d]), distance_extra[d]);
+}
+
+/** Compress data in the zlib format.
+ * A single deflate block with the fixed Huffman codes is written, matches are found with hash chains.
+ * The result is decompressed at run-time by tt::zlib_decompress().
+ */
+[[nodiscard]] std::string zlib_compress(std::string_view data) noexcept
+{
+    constexpr size_t window_size = 32768;
+    constexpr size_t min_match = 3;
+    constexpr size_t max_match = 258;
+    constexpr int max_chain = 128;
+    constexpr size_t hash_size = 1 << 15;
+    constexpr size_t no_position = std::numeric_limits<size_t>::max();
+
+    auto hash = [&](size_t i) {
+        auto const h = (static_cast<uint32_t>(static_cast<uint8_t>(data[i])) << 16) |
+            (static_cast<uint32_t>(static_cast<uint8_t>(data[i + 1])) << 8) | static_cast<uint8_t>(data[i + 2]);
+        return (h * 2654435761u) >> 17;
+    };
+
+    auto head = std::vector<size_t>(hash_size, no_position);
+    auto prev = std::vector<size_t>(data.size(), no_position);
+    auto insert = [&](size_t i) {
+        if (i + min_match <= data.size()) {
+            auto const h = hash(i);
+            prev[i] = head[h];
+            head[h] = i;
+        }
+    };
+
+    auto writer = bit_writer{};
+    // Final block, with fixed Huffman codes.
+    writer.write(1, 1);
+    writer.write(1, 2);
+
+    size_t i = 0;
+    while (i < data.size()) {
+        size_t best_length = 0;
+        size_t best_distance = 0;
+
+        if (i + min_match <= data.size()) {
+            auto const max_length = std::min(max_match, data.size() - i);
+            auto chain = max_chain;
+            for (auto j = head[hash(i)]; j != no_position and i - j <= window_size and chain-- > 0; j = prev[j]) {
+                size_t length = 0;
+                while (length < max_length and data[j + length] == data[i + length]) {
+                    ++length;
+                }
+                if (length > best_length) {
+                    best_length = length;
+                    best_distance = i - j;
+                    if (length == max_length) {
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (best_length >= min_match) {
+            write_fixed_match(writer, best_length, best_distance);
+            for (auto const end = i + best_length; i != end; ++i) {
+                insert(i);
+            }
+        } else {
+            write_fixed_literal(writer, static_cast<uint8_t>(data[i]));
+            insert(i++);
+        }
+    }
+    write_fixed_literal(writer, 256);
+
+    // A zlib header for deflate with a 32 KByte window, and the Adler-32 of the data.
+    auto r = std::string{"\x78\x01", 2} + writer.finish();
+
+    uint32_t a = 1;
+    uint32_t b = 0;
+    for (auto const c : data) {
+        a = (a + static_cast<uint8_t>(c)) % 65521;
+        b = (b + a) % 65521;
+    }
+    auto const adler = (b << 16) | a;
+    for (auto shift = 24; shift >= 0; shift -= 8) {
+        r += static_cast<char>((adler >> shift) & 0xff);
+    }
+    return r;
+}
+
 [[nodiscard]] std::string read_file(std::filesystem::path const& path) noexcept
 {
     std::ifstream input_file;
@@ -97,16 +266,34 @@ void write_bytes_as_text(std::ostream& stream, std::string_view bytes) noexcept
 
 int main(int argc, char* argv[])
 {
-    if (argc != 3) {
+    auto args = std::vector<std::string_view>(argv + 1, argv + argc);
+
+    auto compress = false;
+    if (not args.empty() and args.front() == "--compress") {
+        compress = true;
+        args.erase(args.begin());
+    }
+
+    if (args.size() != 2) {
         usage(argv[0], "Expected two arguments.");
     }
 
-    auto const input_path = std::filesystem::path(argv[1]);
-    auto const input_data = read_file(input_path);
+    auto const input_path = std::filesystem::path(args[0]);
+    auto input_data = read_file(input_path);
     auto const input_filename = input_path.filename();
     auto const identifier = make_identifier(input_filename.generic_string());
 
-    auto const output_path = std::filesystem::path(argv[2]);
+    // Only keep the compressed data when it is smaller.
+    size_t uncompressed_size = 0;
+    if (compress) {
+        auto compressed_data = zlib_compress(input_data);
+        if (compressed_data.size() < input_data.size()) {
+            uncompressed_size = input_data.size();
+            input_data = std::move(compressed_data);
+        }
+    }
+
+    auto const output_path = std::filesystem::path(args[1]);
     auto os = open_output(output_path);
 
     write(os, "#include \"ttauri/static_resource_list.hpp\"\n");
@@ -127,11 +314,12 @@ int main(int argc, char* argv[])
     write(os, "tt::static_resource_item {}_sri = {{\n", identifier);
     write(os, "    nullptr,\n");
     write(os, "    \"{}\",\n", input_filename.generic_string());
-    write(os, "    {{reinterpret_cast<std::byte const *>({}_srd), {}}}\n", identifier, input_data.size());
+    write(os, "    {{reinterpret_cast<std::byte const *>({}_srd), {}}},\n", identifier, input_data.size());
+    write(os, "    {}\n", uncompressed_size);
     write(os, "}};\n");
 
     write(os, "extern \"C\" {{\n");
     write(os, "tt::static_resource_item const *{}_srip = tt::static_resource_item::add(&{}_sri);\n", identifier, identifier);
     write(os, "}}\n");
 
-}
+}
\ No newline at end of file
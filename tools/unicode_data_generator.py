@@ -261,6 +261,126 @@ def setDecompositionIndices(descriptions, compositions, decompositions):
         decomposition.description.decompositionIndex = index
         index += len(decomposition)
 
+DESCRIPTION_INDEX_BLOCK_SIZE = 128
+DESCRIPTION_INDEX_NOT_FOUND = 0xffff
+
+def makeDescriptionIndex(descriptions):
+    """Make a two-stage table from a code point to the index in the description table.
+
+    The second stage is split in blocks of DESCRIPTION_INDEX_BLOCK_SIZE entries, identical
+    blocks, like the blocks of unassigned code points, are stored only once.
+    The first stage is indexed by the code point divided by DESCRIPTION_INDEX_BLOCK_SIZE
+    and contains the index of the block in the second stage.
+    """
+    if len(descriptions) >= DESCRIPTION_INDEX_NOT_FOUND:
+        raise RuntimeError("Too many descriptions for a 16 bit description index")
+
+    indices = [DESCRIPTION_INDEX_NOT_FOUND] * 0x110000
+    for i, description in enumerate(descriptions):
+        indices[description.codePoint] = i
+
+    blocks = []
+    block_numbers = {}
+    stage1 = []
+    for block_start in range(0, 0x110000, DESCRIPTION_INDEX_BLOCK_SIZE):
+        block = tuple(indices[block_start:block_start + DESCRIPTION_INDEX_BLOCK_SIZE])
+        if block not in block_numbers:
+            block_numbers[block] = len(blocks)
+            blocks.append(block)
+        stage1.append(block_numbers[block])
+
+    return stage1, blocks
+
+def writeDescriptionIndex(fd, descriptions):
+    stage1, blocks = makeDescriptionIndex(descriptions)
+
+    fd.write('constexpr size_t unicode_db_description_index_block_size = {};\n'.format(DESCRIPTION_INDEX_BLOCK_SIZE))
+    fd.write('constexpr uint16_t unicode_db_description_index_not_found = {:#x};\n\n'.format(DESCRIPTION_INDEX_NOT_FOUND))
+
+    fd.write('constexpr auto unicode_db_description_index_stage1 = std::array<uint16_t,{}>{{'.format(len(stage1)))
+    for i, block_number in enumerate(stage1):
+        if i != 0:
+            fd.write(",")
+        if i % 16 == 0:
+            fd.write("\n    ")
+        fd.write("{}".format(block_number))
+    fd.write('};\n\n')
+
+    fd.write('constexpr auto unicode_db_description_index_stage2 = std::array<uint16_t,{}>{{'.format(len(blocks) * DESCRIPTION_INDEX_BLOCK_SIZE))
+    for i, block in enumerate(blocks):
+        for j, index in enumerate(block):
+            if i != 0 or j != 0:
+                fd.write(",")
+            if j % 16 == 0:
+                fd.write("\n    ")
+            fd.write("{:#x}".format(index))
+    fd.write('};\n\n')
+
+def composition_key(composition):
+    return composition.startCodePoint << 21 | composition.secondCodePoint
+
+def composition_hash(key, salt, size):
+    """Must be the same as unicode_composition_hash() in unicode_composition.hpp."""
+    mask = 0xffff_ffff_ffff_ffff
+    y = ((key + salt) * 0x9e37_79b9_7f4a_7c15) & mask
+    y ^= (key * 0x3141_5926_5358_9793) & mask
+    return ((y >> 32) * size) >> 32
+
+def makeCompositionHash(compositions):
+    """Make a minimal perfect hash of the (first, second) code-points of the compositions.
+
+    The keys are first distributed over buckets with a salt of zero. Then, starting at the largest
+    bucket, a salt is searched that moves all the keys of the bucket to free slots.
+
+    Returns a table of salts, indexed by the hash with a salt of zero, and a table of indices into
+    the composition table, indexed by the hash with the salt of the bucket.
+    """
+    size = len(compositions)
+    buckets = [[] for _ in range(size)]
+    for index, composition in enumerate(compositions):
+        buckets[composition_hash(composition_key(composition), 0, size)].append(index)
+
+    salts = [0] * size
+    indices = [None] * size
+    for bucket_index in sorted(range(size), key=lambda i: len(buckets[i]), reverse=True):
+        bucket = buckets[bucket_index]
+        if not bucket:
+            break
+
+        for salt in range(1, 0x10000):
+            slots = set(composition_hash(composition_key(compositions[i]), salt, size) for i in bucket)
+            if len(slots) == len(bucket) and all(indices[slot] is None for slot in slots):
+                break
+        else:
+            raise RuntimeError("Could not find a salt for the composition hash")
+
+        salts[bucket_index] = salt
+        for i in bucket:
+            indices[composition_hash(composition_key(compositions[i]), salt, size)] = i
+
+    return salts, indices
+
+def writeCompositionHash(fd, compositions):
+    salts, indices = makeCompositionHash(compositions)
+
+    fd.write('constexpr auto unicode_db_composition_salts = std::array<uint16_t,{}>{{'.format(len(salts)))
+    for i, salt in enumerate(salts):
+        if i != 0:
+            fd.write(",")
+        if i % 16 == 0:
+            fd.write("\n    ")
+        fd.write("{}".format(salt))
+    fd.write('};\n\n')
+
+    fd.write('constexpr auto unicode_db_composition_indices = std::array<uint16_t,{}>{{'.format(len(indices)))
+    for i, index in enumerate(indices):
+        if i != 0:
+            fd.write(",")
+        if i % 16 == 0:
+            fd.write("\n    ")
+        fd.write("{}".format(index))
+    fd.write('};\n\n')
+
 def writeUnicodeData(filename, descriptions, compositions, decompositions):
     fd = open(filename, "w")
     fd.write('// This file is generated by unicode_data_generator.py\n\n')
@@ -293,6 +413,8 @@ def writeUnicodeData(filename, descriptions, compositions, decompositions):
     fd.write('#undef TTXBB\n')
     fd.write('#undef TTXGU\n')
 
+    writeDescriptionIndex(fd, descriptions)
+
     fd.write('#define TTXC unicode_composition\n')
     fd.write('constexpr auto unicode_db_composition_table = std::array{')
     for i, composition in enumerate(compositions):
@@ -303,6 +425,8 @@ def writeUnicodeData(filename, descriptions, compositions, decompositions):
     fd.write('};\n\n')
     fd.write('#undef TTXC\n')
 
+    writeCompositionHash(fd, compositions)
+
     decomposition_characters = []
     for decomposition in decompositions:
         for c in decomposition: